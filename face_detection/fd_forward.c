@@ -31,8 +31,259 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#if ESP_PLATFORM
+#include "freertos/semphr.h"
+#else
+#include <pthread.h>
+#endif
+
+#if CONFIG_XTENSA_IMPL
+#define FD_CONV_MODE DL_XTENSA_IMPL
+#else
+#define FD_CONV_MODE DL_C_IMPL
+#endif
+
+#define FD_WORKER_STACK_SIZE 4096
+
+#define FD_MAX_WORKER_NUMBER 8
+
+typedef void (*fd_job_fn)(void *arg, int index, int worker);
+
+typedef struct
+{
+    fd_job_fn fn;     /*!< job of one index */
+    void *arg;        /*!< argument of the job */
+    int count;        /*!< number of indexes */
+    int next;         /*!< next index to take, updated atomically */
+} fd_parallel_t;
 
-box_array_t *pnet_forward(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyramid, net_config_t *config)
+static void fd_parallel_run(fd_parallel_t *p, int worker)
+{ /*{{{*/
+    for (;;)
+    {
+        int index = __atomic_fetch_add(&p->next, 1, __ATOMIC_RELAXED);
+        if (index >= p->count)
+            break;
+        p->fn(p->arg, index, worker);
+    }
+} /*}}}*/
+
+typedef struct
+{
+    mtmn_workers_t *workers; /*!< pool of the worker */
+    int index;               /*!< index of the worker in the pool */
+} fd_worker_t;
+
+/*
+ * Workers started once by mtmn_workers_create. Worker 0 is the thread calling fd_parallel_for,
+ * the others wait for a job between the calls.
+ */
+struct mtmn_workers
+{
+    int number;                                    /*!< workers, the calling thread included */
+    fd_parallel_t *job;                            /*!< job of the current call */
+    int quit;                                      /*!< set by mtmn_workers_destroy */
+#if ESP_PLATFORM
+    SemaphoreHandle_t call;                        /*!< one fd_parallel_for at a time */
+    SemaphoreHandle_t start[FD_MAX_WORKER_NUMBER]; /*!< given to a worker for every job */
+    SemaphoreHandle_t done;                        /*!< given by a worker after every job */
+#else
+    pthread_mutex_t call;                          /*!< one fd_parallel_for at a time */
+    pthread_mutex_t lock;                          /*!< protects the fields below */
+    pthread_cond_t start;                          /*!< a job is posted */
+    pthread_cond_t done;                           /*!< the last worker finished the job */
+    int generation;                                /*!< jobs posted so far */
+    int busy;                                      /*!< workers still running the job */
+    pthread_t thread[FD_MAX_WORKER_NUMBER];
+#endif
+    fd_worker_t worker[FD_MAX_WORKER_NUMBER];      /*!< argument of the loop of each worker */
+};
+
+#if ESP_PLATFORM
+static void fd_worker_task(void *arg)
+{ /*{{{*/
+    mtmn_workers_t *workers = ((fd_worker_t *)arg)->workers;
+    int worker = ((fd_worker_t *)arg)->index;
+    for (;;)
+    {
+        xSemaphoreTake(workers->start[worker], portMAX_DELAY);
+        if (workers->quit)
+            break;
+        fd_parallel_run(workers->job, worker);
+        xSemaphoreGive(workers->done);
+    }
+    xSemaphoreGive(workers->done);
+    vTaskDelete(NULL);
+} /*}}}*/
+#else
+static void *fd_worker_task(void *arg)
+{ /*{{{*/
+    mtmn_workers_t *workers = ((fd_worker_t *)arg)->workers;
+    int worker = ((fd_worker_t *)arg)->index;
+    int seen = 0;
+    pthread_mutex_lock(&workers->lock);
+    for (;;)
+    {
+        while (!workers->quit && workers->generation == seen)
+            pthread_cond_wait(&workers->start, &workers->lock);
+        if (workers->quit)
+            break;
+        seen = workers->generation;
+        fd_parallel_t *job = workers->job;
+        pthread_mutex_unlock(&workers->lock);
+
+        fd_parallel_run(job, worker);
+
+        pthread_mutex_lock(&workers->lock);
+        if (0 == --workers->busy)
+            pthread_cond_signal(&workers->done);
+    }
+    pthread_mutex_unlock(&workers->lock);
+    return NULL;
+} /*}}}*/
+#endif
+
+mtmn_workers_t *mtmn_workers_create(int worker_number)
+{ /*{{{*/
+    worker_number = DL_IMAGE_MIN(worker_number, FD_MAX_WORKER_NUMBER);
+    if (worker_number <= 1)
+        return NULL;
+
+    // the workers live as long as the caller keeps them, not one frame
+    mtmn_workers_t *workers = (mtmn_workers_t *)dl_lib_heap_calloc(1, sizeof(mtmn_workers_t), 0);
+    if (NULL == workers)
+        return NULL;
+    workers->number = 1;
+    for (int i = 0; i < FD_MAX_WORKER_NUMBER; i++)
+    {
+        workers->worker[i].workers = workers;
+        workers->worker[i].index = i;
+    }
+
+#if ESP_PLATFORM
+    workers->call = xSemaphoreCreateMutex();
+    workers->done = xSemaphoreCreateCounting(FD_MAX_WORKER_NUMBER, 0);
+    if (NULL == workers->call || NULL == workers->done)
+    {
+        mtmn_workers_destroy(workers);
+        return NULL;
+    }
+    for (int i = 1; i < worker_number; i++)
+    {
+        workers->start[i] = xSemaphoreCreateBinary();
+        if (NULL == workers->start[i])
+            break;
+        if (pdPASS != xTaskCreate(fd_worker_task, "fd_worker", FD_WORKER_STACK_SIZE, &workers->worker[i], uxTaskPriorityGet(NULL), NULL))
+        {
+            vSemaphoreDelete(workers->start[i]);
+            workers->start[i] = NULL;
+            break;
+        }
+        workers->number++;
+    }
+#else
+    pthread_mutex_init(&workers->call, NULL);
+    pthread_mutex_init(&workers->lock, NULL);
+    pthread_cond_init(&workers->start, NULL);
+    pthread_cond_init(&workers->done, NULL);
+    for (int i = 1; i < worker_number; i++)
+    {
+        if (pthread_create(&workers->thread[i], NULL, fd_worker_task, &workers->worker[i]))
+            break;
+        workers->number++;
+    }
+#endif
+
+    // not a single worker could be started, serial is the same
+    if (1 == workers->number)
+    {
+        mtmn_workers_destroy(workers);
+        return NULL;
+    }
+    return workers;
+} /*}}}*/
+
+void mtmn_workers_destroy(mtmn_workers_t *workers)
+{ /*{{{*/
+    if (NULL == workers)
+        return;
+
+#if ESP_PLATFORM
+    workers->quit = 1;
+    for (int i = 1; i < workers->number; i++)
+        xSemaphoreGive(workers->start[i]);
+    for (int i = 1; i < workers->number; i++)
+        xSemaphoreTake(workers->done, portMAX_DELAY);
+    for (int i = 1; i < workers->number; i++)
+        vSemaphoreDelete(workers->start[i]);
+    if (workers->done)
+        vSemaphoreDelete(workers->done);
+    if (workers->call)
+        vSemaphoreDelete(workers->call);
+#else
+    pthread_mutex_lock(&workers->lock);
+    workers->quit = 1;
+    pthread_cond_broadcast(&workers->start);
+    pthread_mutex_unlock(&workers->lock);
+    for (int i = 1; i < workers->number; i++)
+        pthread_join(workers->thread[i], NULL);
+    pthread_cond_destroy(&workers->done);
+    pthread_cond_destroy(&workers->start);
+    pthread_mutex_destroy(&workers->lock);
+    pthread_mutex_destroy(&workers->call);
+#endif
+    dl_lib_free(workers);
+} /*}}}*/
+
+static inline int fd_worker_number(const mtmn_workers_t *workers)
+{
+    return workers ? workers->number : 1;
+}
+
+/*
+ * Call fn(arg, index, worker) for every index in [0, count), spread over the workers.
+ * The calling thread is worker 0. Runs on the calling thread alone when 'workers' is NULL.
+ * fn must not call fd_parallel_for on the same workers.
+ */
+static void fd_parallel_for(fd_job_fn fn, void *arg, int count, mtmn_workers_t *workers)
+{ /*{{{*/
+    fd_parallel_t p = {fn, arg, count, 0};
+
+    if (NULL == workers || count <= 1)
+    {
+        fd_parallel_run(&p, 0);
+        return;
+    }
+
+#if ESP_PLATFORM
+    xSemaphoreTake(workers->call, portMAX_DELAY);
+    workers->job = &p;
+    for (int i = 1; i < workers->number; i++)
+        xSemaphoreGive(workers->start[i]);
+    fd_parallel_run(&p, 0);
+    for (int i = 1; i < workers->number; i++)
+        xSemaphoreTake(workers->done, portMAX_DELAY);
+    xSemaphoreGive(workers->call);
+#else
+    pthread_mutex_lock(&workers->call);
+    pthread_mutex_lock(&workers->lock);
+    workers->job = &p;
+    workers->busy = workers->number - 1;
+    workers->generation++;
+    pthread_cond_broadcast(&workers->start);
+    pthread_mutex_unlock(&workers->lock);
+
+    fd_parallel_run(&p, 0);
+
+    pthread_mutex_lock(&workers->lock);
+    while (workers->busy)
+        pthread_cond_wait(&workers->done, &workers->lock);
+    pthread_mutex_unlock(&workers->lock);
+    pthread_mutex_unlock(&workers->call);
+#endif
+} /*}}}*/
+
+box_array_t *pnet_forward(const image_frame_t *image, fptp_t min_face, fptp_t pyramid, net_config_t *config)
 { /*{{{*/
     mtmn_net_t *out;
     fptp_t scale = 1.0f * config->w / min_face;
@@ -45,13 +296,13 @@ box_array_t *pnet_forward(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyramid
     int width = round(image->w * scale);
     int height = round(image->h * scale);
 
-    dl_matrix3du_t *in = dl_matrix3du_alloc(1, width, height, image->c);
+    dl_matrix3du_t *in = dl_matrix3du_alloc(1, width, height, 3);
     for (int i = 0; i < 4; i++)
     {
         if (DL_IMAGE_MIN(width, height) <= config->w)
             break;
 
-        image_resize_linear(in->item, image->item, width, height, in->c, image->w, image->h);
+        image_frame_resize(in->item, width, height, image, 0, 0, image->w, image->h);
 
         in->h = height;
         in->w = width;
@@ -62,11 +313,11 @@ box_array_t *pnet_forward(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyramid
 #endif
 
 #if CONFIG_MTMN_LITE_QUANT
-        out = pnet_lite_q(in, DL_XTENSA_IMPL);
+        out = pnet_lite_q(in, FD_CONV_MODE);
 #endif
 
 #if CONFIG_MTMN_HEAVY_QUANT
-        out = pnet_heavy_q(in, DL_XTENSA_IMPL);
+        out = pnet_heavy_q(in, FD_CONV_MODE);
 #endif
 
         if (out)
@@ -140,7 +391,7 @@ box_array_t *pnet_forward(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyramid
     return pnet_box_list;
 } /*}}}*/
 
-box_array_t *pnet_forward2(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyramid, int pyramid_times, net_config_t *config)
+box_array_t *pnet_forward2(const image_frame_t *image, fptp_t min_face, fptp_t pyramid, int pyramid_times, net_config_t *config)
 { /*{{{*/
     mtmn_net_t *out;
     fptp_t scale = 1.0f * config->w / min_face;
@@ -153,13 +404,13 @@ box_array_t *pnet_forward2(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyrami
     int width = round(image->w * scale);
     int height = round(image->h * scale);
 
-    dl_matrix3du_t *in = dl_matrix3du_alloc(1, width, height, image->c);
+    dl_matrix3du_t *in = dl_matrix3du_alloc(1, width, height, 3);
     for (int i = 0; i < pyramid_times; i++)
     {
         if (DL_IMAGE_MIN(width, height) <= config->w)
             break;
 
-        image_resize_linear(in->item, image->item, width, height, in->c, image->w, image->h);
+        image_frame_resize(in->item, width, height, image, 0, 0, image->w, image->h);
 
         in->h = height;
         in->w = width;
@@ -170,11 +421,11 @@ box_array_t *pnet_forward2(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyrami
 #endif
 
 #if CONFIG_MTMN_LITE_QUANT
-        out = pnet_lite_q(in, DL_XTENSA_IMPL);
+        out = pnet_lite_q(in, FD_CONV_MODE);
 #endif
 
 #if CONFIG_MTMN_HEAVY_QUANT
-        out = pnet_heavy_q(in, DL_XTENSA_IMPL);
+        out = pnet_heavy_q(in, FD_CONV_MODE);
 #endif
 
         if (out)
@@ -251,9 +502,173 @@ box_array_t *pnet_forward2(dl_matrix3du_t *image, fptp_t min_face, fptp_t pyrami
     return pnet_box_list;
 } /*}}}*/
 
-box_array_t *pnet_forward_fast(dl_matrix3du_t *image, fptp_t min_face, int pyramid_times, net_config_t *config)
+/*
+ * Run P-Net on one pyramid level, keep the boxes above the score threshold and suppress
+ * the overlapping ones of the level.
+ */
+static void pnet_level_forward(dl_matrix3du_t *resized_image, fptp_t resized_scale, net_config_t *config, image_list_t *sorted_list, image_list_t **origin_head)
 { /*{{{*/
     mtmn_net_t *out;
+#if CONFIG_MTMN_LITE_FLOAT
+    out = pnet_lite_f(resized_image);
+#endif
+
+#if CONFIG_MTMN_LITE_QUANT
+    out = pnet_lite_q(resized_image, FD_CONV_MODE);
+#endif
+
+#if CONFIG_MTMN_HEAVY_QUANT
+    out = pnet_heavy_q(resized_image, FD_CONV_MODE);
+#endif
+
+    if (out)
+    {
+        *origin_head = image_get_valid_boxes(out->category->item,
+                                             out->offset->item,
+                                             NULL,
+                                             out->category->w,
+                                             out->category->h,
+                                             1,
+                                             &config->w,
+                                             config->threshold.score,
+                                             2,
+                                             resized_scale,
+                                             resized_scale,
+                                             false);
+
+        if (*origin_head)
+        {
+            image_sort_insert_by_score(sorted_list, *origin_head);
+
+            image_nms_process(sorted_list, 0.5, true);
+        }
+
+        dl_matrix3d_free(out->category);
+        dl_matrix3d_free(out->offset);
+        dl_matrix3d_free(out->landmark);
+        dl_lib_free(out);
+    }
+} /*}}}*/
+
+/*
+ * The FAST pyramid is two chains of levels. The first level of a chain is resized from the
+ * image, every next one is the previous one zoomed out twice.
+ */
+typedef struct
+{
+    const image_frame_t *image;     /*!< input image */
+    net_config_t *config;           /*!< P-Net configuration */
+    int chain_start[3];             /*!< first level of each chain, chain_start[2] is the number of levels */
+    int chain_end[2];               /*!< end of the levels of each chain that are not smaller than the net */
+    int *order;                     /*!< levels sorted by size, the largest first */
+    dl_matrix3du_t **resized_image; /*!< image of each level */
+    fptp_t *resized_scale;          /*!< scale of each level */
+    image_list_t *sorted_list;      /*!< boxes of each level */
+    image_list_t **origin_head;     /*!< allocation of the boxes of each level */
+} pnet_pyramid_job_t;
+
+static void pnet_pyramid_build_job(void *arg, int index, int worker)
+{ /*{{{*/
+    pnet_pyramid_job_t *job = (pnet_pyramid_job_t *)arg;
+    for (int i = job->chain_start[index]; i < job->chain_end[index]; i++)
+    {
+        dl_matrix3du_t *resized_image = job->resized_image[i];
+        if (job->chain_start[index] == i)
+            image_frame_resize(resized_image->item,
+                               resized_image->w,
+                               resized_image->h,
+                               job->image,
+                               0,
+                               0,
+                               job->image->w,
+                               job->image->h);
+        else
+            image_zoom_in_twice(resized_image->item,
+                                resized_image->w,
+                                resized_image->h,
+                                resized_image->c,
+                                job->resized_image[i - 1]->item,
+                                job->resized_image[i - 1]->w,
+                                job->resized_image[i - 1]->c);
+    }
+} /*}}}*/
+
+static void pnet_pyramid_level_job(void *arg, int index, int worker)
+{ /*{{{*/
+    pnet_pyramid_job_t *job = (pnet_pyramid_job_t *)arg;
+    int i = job->order[index];
+    pnet_level_forward(job->resized_image[i], job->resized_scale[i], job->config, &(job->sorted_list[i]), &(job->origin_head[i]));
+} /*}}}*/
+
+/*
+ * Build every level into its own image, then run P-Net on the levels in parallel.
+ * Returns false when the images can not be allocated.
+ */
+static bool pnet_pyramid_parallel(const image_frame_t *image, fptp_t origin_scale, fptp_t pyramid, int pyramid_times, net_config_t *config, image_list_t *sorted_list, image_list_t **origin_head)
+{ /*{{{*/
+    pnet_pyramid_job_t job = {image, config, {0, (pyramid_times + 1) / 2, pyramid_times}};
+    job.order = (int *)dl_lib_calloc(pyramid_times, sizeof(int), 0);
+    job.resized_image = (dl_matrix3du_t **)dl_lib_calloc(pyramid_times, sizeof(dl_matrix3du_t *), 0);
+    job.resized_scale = (fptp_t *)dl_lib_calloc(pyramid_times, sizeof(fptp_t), 0);
+    job.sorted_list = sorted_list;
+    job.origin_head = origin_head;
+    bool allocated = job.order && job.resized_image && job.resized_scale;
+
+    int level_number = 0;
+    for (int chain = 0; allocated && chain < 2; chain++)
+    {
+        fptp_t resized_scale = chain ? origin_scale * pyramid : origin_scale;
+        int resized_w = round(image->w * resized_scale);
+        int resized_h = round(image->h * resized_scale);
+        int i = job.chain_start[chain];
+        for (; i < job.chain_start[chain + 1]; i++)
+        {
+            if (DL_IMAGE_MIN(resized_w, resized_h) < config->w)
+                break;
+            job.resized_image[i] = dl_matrix3du_alloc(1, resized_w, resized_h, 3);
+            if (NULL == job.resized_image[i])
+            {
+                allocated = false;
+                break;
+            }
+            job.resized_scale[i] = resized_scale;
+            resized_w /= 2;
+            resized_h /= 2;
+            resized_scale /= 2;
+        }
+        job.chain_end[chain] = i;
+        level_number += i - job.chain_start[chain];
+    }
+
+    if (allocated)
+    {
+        // The two chains interleave by size, P-Net takes the largest levels first
+        int a = job.chain_start[0], b = job.chain_start[1];
+        for (int k = 0; k < level_number; k++)
+        {
+            if (b >= job.chain_end[1] || (a < job.chain_end[0] && a - job.chain_start[0] <= b - job.chain_start[1]))
+                job.order[k] = a++;
+            else
+                job.order[k] = b++;
+        }
+
+        fd_parallel_for(pnet_pyramid_build_job, &job, 2, config->workers);
+        fd_parallel_for(pnet_pyramid_level_job, &job, level_number, config->workers);
+    }
+
+    for (int i = 0; job.resized_image && i < pyramid_times; i++)
+    {
+        if (job.resized_image[i])
+            dl_matrix3du_free(job.resized_image[i]);
+    }
+    dl_lib_free(job.order);
+    dl_lib_free(job.resized_image);
+    dl_lib_free(job.resized_scale);
+    return allocated;
+} /*}}}*/
+
+box_array_t *pnet_forward_fast(const image_frame_t *image, fptp_t min_face, int pyramid_times, net_config_t *config)
+{ /*{{{*/
     fptp_t origin_scale = 1.0f * config->w / min_face;
     fptp_t pyramid = 0.707106781; // sqrt(0.5)
     image_list_t *sorted_list = (image_list_t *)dl_lib_calloc(pyramid_times, sizeof(image_list_t), 0);
@@ -261,13 +676,30 @@ box_array_t *pnet_forward_fast(dl_matrix3du_t *image, fptp_t min_face, int pyram
     image_list_t all_box_list = {NULL};
     box_array_t *pnet_box_list = NULL;
     box_t *pnet_box = NULL;
+    if (NULL == sorted_list || NULL == origin_head)
+    {
+        dl_lib_free(sorted_list);
+        dl_lib_free(origin_head);
+        return NULL;
+    }
+
+    // Levels are merged in their order below, so the result does not depend on the workers
+    bool done = false;
+    if (config->workers)
+        done = pnet_pyramid_parallel(image, origin_scale, pyramid, pyramid_times, config, sorted_list, origin_head);
 
     int resized_w = round(image->w * origin_scale);
     int resized_h = round(image->h * origin_scale);
     fptp_t resized_scale = origin_scale;
-    dl_matrix3du_t *resized_image = dl_matrix3du_alloc(1, resized_w, resized_h, image->c);
+    dl_matrix3du_t *resized_image = done ? NULL : dl_matrix3du_alloc(1, resized_w, resized_h, 3);
+    if (!done && NULL == resized_image)
+    {
+        dl_lib_free(sorted_list);
+        dl_lib_free(origin_head);
+        return NULL;
+    }
 
-    for (size_t i = 0; i < (pyramid_times + 1) / 2; i++)
+    for (size_t i = 0; !done && i < (pyramid_times + 1) / 2; i++)
     {
         if (DL_IMAGE_MIN(resized_w, resized_h) < config->w)
         {
@@ -275,13 +707,14 @@ box_array_t *pnet_forward_fast(dl_matrix3du_t *image, fptp_t min_face, int pyram
         }
 
         if (0 == i)
-            image_resize_linear(resized_image->item,
-                                image->item,
-                                resized_w,
-                                resized_h,
-                                resized_image->c,
-                                image->w,
-                                image->h);
+            image_frame_resize(resized_image->item,
+                               resized_w,
+                               resized_h,
+                               image,
+                               0,
+                               0,
+                               image->w,
+                               image->h);
         else
             image_zoom_in_twice(resized_image->item,
                                 resized_w,
@@ -295,45 +728,7 @@ box_array_t *pnet_forward_fast(dl_matrix3du_t *image, fptp_t min_face, int pyram
         resized_image->h = resized_h;
         resized_image->stride = resized_image->w * resized_image->c;
 
-#if CONFIG_MTMN_LITE_FLOAT
-        out = pnet_lite_f(resized_image);
-#endif
-
-#if CONFIG_MTMN_LITE_QUANT
-        out = pnet_lite_q(resized_image, DL_XTENSA_IMPL);
-#endif
-
-#if CONFIG_MTMN_HEAVY_QUANT
-        out = pnet_heavy_q(resized_image, DL_XTENSA_IMPL);
-#endif
-
-        if (out)
-        {
-            origin_head[i] = image_get_valid_boxes(out->category->item,
-                                                   out->offset->item,
-                                                   NULL,
-                                                   out->category->w,
-                                                   out->category->h,
-                                                   1,
-                                                   &config->w,
-                                                   config->threshold.score,
-                                                   2,
-                                                   resized_scale,
-                                                   resized_scale,
-                                                   false);
-
-            if (origin_head[i])
-            {
-                image_sort_insert_by_score(&sorted_list[i], origin_head[i]);
-
-                image_nms_process(&sorted_list[i], 0.5, true);
-            }
-
-            dl_matrix3d_free(out->category);
-            dl_matrix3d_free(out->offset);
-            dl_matrix3d_free(out->landmark);
-            dl_lib_free(out);
-        }
+        pnet_level_forward(resized_image, resized_scale, config, &sorted_list[i], &origin_head[i]);
 
         resized_w /= 2;
         resized_h /= 2;
@@ -343,19 +738,20 @@ box_array_t *pnet_forward_fast(dl_matrix3du_t *image, fptp_t min_face, int pyram
     resized_w = round(image->w * origin_scale * pyramid);
     resized_h = round(image->h * origin_scale * pyramid);
     resized_scale = origin_scale * pyramid;
-    for (int i = (pyramid_times + 1) / 2; i < pyramid_times; i++)
+    for (int i = (pyramid_times + 1) / 2; !done && i < pyramid_times; i++)
     {
         if (DL_IMAGE_MIN(resized_w, resized_h) < config->w)
             break;
 
         if ((pyramid_times + 1) / 2 == i)
-            image_resize_linear(resized_image->item,
-                                image->item,
-                                resized_w,
-                                resized_h,
-                                resized_image->c,
-                                image->w,
-                                image->h);
+            image_frame_resize(resized_image->item,
+                               resized_w,
+                               resized_h,
+                               image,
+                               0,
+                               0,
+                               image->w,
+                               image->h);
         else
             image_zoom_in_twice(resized_image->item,
                                 resized_w,
@@ -369,51 +765,14 @@ box_array_t *pnet_forward_fast(dl_matrix3du_t *image, fptp_t min_face, int pyram
         resized_image->h = resized_h;
         resized_image->stride = resized_image->w * resized_image->c;
 
-#if CONFIG_MTMN_LITE_FLOAT
-        out = pnet_lite_f(resized_image);
-#endif
-
-#if CONFIG_MTMN_LITE_QUANT
-        out = pnet_lite_q(resized_image, DL_XTENSA_IMPL);
-#endif
-
-#if CONFIG_MTMN_HEAVY_QUANT
-        out = pnet_heavy_q(resized_image, DL_XTENSA_IMPL);
-#endif
-
-        if (out)
-        {
-            origin_head[i] = image_get_valid_boxes(out->category->item,
-                                                   out->offset->item,
-                                                   NULL,
-                                                   out->category->w,
-                                                   out->category->h,
-                                                   1,
-                                                   &config->w,
-                                                   config->threshold.score,
-                                                   2,
-                                                   resized_scale,
-                                                   resized_scale,
-                                                   false);
-
-            if (origin_head[i])
-            {
-                image_sort_insert_by_score(&sorted_list[i], origin_head[i]);
-
-                image_nms_process(&sorted_list[i], 0.5, true);
-            }
-
-            dl_matrix3d_free(out->category);
-            dl_matrix3d_free(out->offset);
-            dl_matrix3d_free(out->landmark);
-            dl_lib_free(out);
-        }
+        pnet_level_forward(resized_image, resized_scale, config, &sorted_list[i], &origin_head[i]);
 
         resized_w /= 2;
         resized_h /= 2;
         resized_scale /= 2;
     }
-    dl_matrix3du_free(resized_image);
+    if (resized_image)
+        dl_matrix3du_free(resized_image);
 
     for (int i = 0; i < pyramid_times; i++)
         image_sort_insert_by_score(&all_box_list, &sorted_list[i]);
@@ -455,79 +814,234 @@ box_array_t *pnet_forward_fast(dl_matrix3du_t *image, fptp_t min_face, int pyram
     return pnet_box_list;
 } /*}}}*/
 
-box_array_t *rnet_forward(dl_matrix3du_t *image, box_array_t *net_boxes, net_config_t *config)
+static inline dl_matrix3du_t net_batch_item(dl_matrix3du_t *batch, int index)
+{
+    dl_matrix3du_t item = *batch;
+    item.n = 1;
+    item.item = batch->item + index * batch->w * batch->h * batch->c;
+    return item;
+}
+
+typedef struct
+{
+    dl_matrix3du_t *in;         /*!< crops of the batch */
+    mtmn_net_batch_t *out;      /*!< results of the batch */
+    float threshold;            /*!< score threshold */
+    bool is_onet;               /*!< O-Net or R-Net */
+} net_batch_job_t;
+
+static void net_batch_job(void *arg, int index, int worker)
 { /*{{{*/
-    int valid_count = 0;
-    image_list_t valid_list = {NULL};
-    image_list_t sorted_list = {NULL};
-    dl_matrix3du_t *resized_image;
-    dl_matrix3du_t *sliced_image;
-    image_box_t *valid_box = NULL;
-    box_t *net_box = NULL;
-    box_array_t *net_box_list = NULL;
-
-    if (NULL == net_boxes)
-        return NULL;
-
-    valid_box = (image_box_t *)dl_lib_calloc(config->threshold.candidate_number, sizeof(image_box_t), 0);
-    resized_image = dl_matrix3du_alloc(1, config->w, config->h, image->c);
-
-    image_rect2sqr(net_boxes, image->w, image->h);
-    for (int i = 0; i < net_boxes->len; i++)
-    {
-        int x = round(net_boxes->box[i].box_p[0]);
-        int y = round(net_boxes->box[i].box_p[1]);
-        int w = round(net_boxes->box[i].box_p[2]) - x + 1;
-        int h = round(net_boxes->box[i].box_p[3]) - y + 1;
-        sliced_image = dl_matrix3du_alloc(1, w, h, image->c);
-
-        dl_matrix3du_slice_copy(sliced_image, image, x, y, w, h);
-
-        image_resize_linear(resized_image->item, sliced_image->item, config->w, config->h, image->c, w, h);
+    net_batch_job_t *job = (net_batch_job_t *)arg;
+    dl_matrix3du_t in = net_batch_item(job->in, index);
 
+    mtmn_net_t *out;
 #if CONFIG_MTMN_LITE_FLOAT
-        mtmn_net_t *out = rnet_lite_f_with_score_verify(resized_image, config->threshold.score);
+    if (job->is_onet)
+        out = onet_lite_f_with_score_verify(&in, job->threshold);
+    else
+        out = rnet_lite_f_with_score_verify(&in, job->threshold);
 #endif
 
 #if CONFIG_MTMN_LITE_QUANT
-        mtmn_net_t *out = rnet_lite_q_with_score_verify(resized_image, config->threshold.score, DL_XTENSA_IMPL);
+    if (job->is_onet)
+        out = onet_lite_q_with_score_verify(&in, job->threshold, FD_CONV_MODE);
+    else
+        out = rnet_lite_q_with_score_verify(&in, job->threshold, FD_CONV_MODE);
 #endif
 
 #if CONFIG_MTMN_HEAVY_QUANT
-        mtmn_net_t *out = rnet_heavy_q_with_score_verify(resized_image, config->threshold.score, DL_XTENSA_IMPL);
+    if (job->is_onet)
+        out = onet_heavy_q_with_score_verify(&in, job->threshold, FD_CONV_MODE);
+    else
+        out = rnet_heavy_q_with_score_verify(&in, job->threshold, FD_CONV_MODE);
 #endif
 
-        if (out)
+    if (NULL == out)
+        return;
+
+    assert(out->category->stride == 2);
+    assert(out->offset->stride == 4);
+    assert(out->offset->c == 4);
+    memcpy(job->out->net.category->item + index * 2, out->category->item, 2 * sizeof(fptp_t));
+    memcpy(job->out->net.offset->item + index * 4, out->offset->item, 4 * sizeof(fptp_t));
+    if (job->is_onet)
+    {
+        assert(out->landmark->stride == 10);
+        memcpy(job->out->net.landmark->item + index * 10, out->landmark->item, 10 * sizeof(fptp_t));
+        dl_matrix3d_free(out->landmark);
+    }
+    job->out->valid[index] = 1;
+
+    dl_matrix3d_free(out->category);
+    dl_matrix3d_free(out->offset);
+    dl_lib_free(out);
+} /*}}}*/
+
+static mtmn_net_batch_t *net_batch_alloc(int n, bool is_onet)
+{ /*{{{*/
+    mtmn_net_batch_t *out = (mtmn_net_batch_t *)dl_lib_calloc(1, sizeof(mtmn_net_batch_t) + n, 0);
+    if (NULL == out)
+        return NULL;
+    out->n = n;
+    out->valid = (uint8_t *)(out + 1);
+    out->net.category = dl_matrix3d_alloc(n, 1, 1, 2);
+    out->net.offset = dl_matrix3d_alloc(n, 1, 1, 4);
+    out->net.landmark = is_onet ? dl_matrix3d_alloc(n, 1, 1, 10) : NULL;
+    if (NULL == out->net.category || NULL == out->net.offset || (is_onet && NULL == out->net.landmark))
+    {
+        mtmn_net_batch_free(out);
+        return NULL;
+    }
+    return out;
+} /*}}}*/
+
+void mtmn_net_batch_free(mtmn_net_batch_t *out)
+{ /*{{{*/
+    if (NULL == out)
+        return;
+    if (out->net.category)
+        dl_matrix3d_free(out->net.category);
+    if (out->net.offset)
+        dl_matrix3d_free(out->net.offset);
+    if (out->net.landmark)
+        dl_matrix3d_free(out->net.landmark);
+    dl_lib_free(out);
+} /*}}}*/
+
+/*
+ * Run R-Net or O-Net over a batch of crops. When 'box' is given the crops are cut from 'image' first,
+ * all of them in one pass. The nets take one crop at a time, so every item is evaluated on its own
+ * and its results are copied into the batch tensors. NULL if out of memory or the crops fail.
+ */
+static mtmn_net_batch_t *net_batch_forward(const image_frame_t *image,
+                                           box_t *box,
+                                           dl_matrix3du_t *in,
+                                           float threshold,
+                                           bool is_onet,
+                                           mtmn_workers_t *workers)
+{ /*{{{*/
+    if (box && image_crop_resize_batch(in->item, in->w, in->h, image, box, in->n) < 0)
+        return NULL;
+
+    mtmn_net_batch_t *out = net_batch_alloc(in->n, is_onet);
+    if (NULL == out)
+        return NULL;
+    net_batch_job_t job = {in, out, threshold, is_onet};
+
+    fd_parallel_for(net_batch_job, &job, in->n, workers);
+    return out;
+} /*}}}*/
+
+mtmn_net_batch_t *rnet_with_score_verify_batch(dl_matrix3du_t *in, float threshold)
+{ /*{{{*/
+    return net_batch_forward(NULL, NULL, in, threshold, false, NULL);
+} /*}}}*/
+
+mtmn_net_batch_t *onet_with_score_verify_batch(dl_matrix3du_t *in, float threshold)
+{ /*{{{*/
+    return net_batch_forward(NULL, NULL, in, threshold, true, NULL);
+} /*}}}*/
+
+/*
+ * Evaluate the candidates in order and keep the first 'candidate_number' that pass, linked in order.
+ * The candidates are cropped into one n>1 tensor and evaluated a batch at a time. A batch is only as
+ * large as the number of results still needed, so no candidate after the last kept one is evaluated,
+ * unless several workers are used, then a batch has at least one candidate per worker.
+ * Returns the number of kept candidates, or -1 if out of memory.
+ */
+static int net_candidates_forward(const image_frame_t *image,
+                                  box_array_t *net_boxes,
+                                  net_config_t *config,
+                                  bool is_onet,
+                                  image_box_t *valid_box)
+{ /*{{{*/
+    int valid_count = 0;
+    int worker_number = fd_worker_number(config->workers);
+    int batch_size = DL_IMAGE_MAX(config->threshold.candidate_number, worker_number);
+    batch_size = DL_IMAGE_MIN(batch_size, net_boxes->len);
+
+    if (batch_size <= 0)
+    {
+        valid_box[0].next = NULL;
+        return 0;
+    }
+
+    dl_matrix3du_t *batch = dl_matrix3du_alloc_uninit(batch_size, config->w, config->h, 3);
+    if (NULL == batch)
+        return -1;
+
+    for (int i = 0; i < net_boxes->len && valid_count < config->threshold.candidate_number;)
+    {
+        batch->n = DL_IMAGE_MIN(config->threshold.candidate_number - valid_count, net_boxes->len - i);
+        batch->n = DL_IMAGE_MIN(DL_IMAGE_MAX(batch->n, worker_number), net_boxes->len - i);
+
+        mtmn_net_batch_t *out = net_batch_forward(image, &(net_boxes->box[i]), batch, config->threshold.score, is_onet, config->workers);
+        if (NULL == out)
+        {
+            batch->n = batch_size;
+            dl_matrix3du_free(batch);
+            return -1;
+        }
+
+        for (int k = 0; k < batch->n && valid_count < config->threshold.candidate_number; k++)
         {
-            assert(out->category->stride == 2);
-            assert(out->offset->stride == 4);
-            assert(out->offset->c == 4);
-            valid_box[valid_count].score = out->category->item[1];
-            valid_box[valid_count].box = net_boxes->box[i];
-            valid_box[valid_count].offset.box_p[0] = out->offset->item[0];
-            valid_box[valid_count].offset.box_p[1] = out->offset->item[1];
-            valid_box[valid_count].offset.box_p[2] = out->offset->item[2];
-            valid_box[valid_count].offset.box_p[3] = out->offset->item[3];
+            if (!out->valid[k])
+                continue;
+
+            fptp_t *category = out->net.category->item + k * 2;
+            fptp_t *offset = out->net.offset->item + k * 4;
+            valid_box[valid_count].score = category[1];
+            valid_box[valid_count].box = net_boxes->box[i + k];
+            valid_box[valid_count].offset.box_p[0] = offset[0];
+            valid_box[valid_count].offset.box_p[1] = offset[1];
+            valid_box[valid_count].offset.box_p[2] = offset[2];
+            valid_box[valid_count].offset.box_p[3] = offset[3];
+            if (is_onet)
+                memcpy(&(valid_box[valid_count].landmark), out->net.landmark->item + k * 10, sizeof(landmark_t));
             valid_box[valid_count].next = &(valid_box[valid_count + 1]);
             valid_count++;
-
-            dl_matrix3d_free(out->category);
-            dl_matrix3d_free(out->offset);
-            dl_lib_free(out);
         }
-        dl_matrix3du_free(sliced_image);
 
-        if (valid_count > config->threshold.candidate_number - 1)
-            break;
+        i += batch->n;
+        mtmn_net_batch_free(out);
     }
 
-    dl_matrix3du_free(resized_image);
+    batch->n = batch_size;
+    dl_matrix3du_free(batch);
 
     if (valid_count)
         valid_box[valid_count - 1].next = NULL;
     else
         valid_box[0].next = NULL;
 
+    return valid_count;
+} /*}}}*/
+
+box_array_t *rnet_forward(const image_frame_t *image, box_array_t *net_boxes, net_config_t *config)
+{ /*{{{*/
+    int valid_count = 0;
+    image_list_t valid_list = {NULL};
+    image_list_t sorted_list = {NULL};
+    image_box_t *valid_box = NULL;
+    box_t *net_box = NULL;
+    box_array_t *net_box_list = NULL;
+
+    if (NULL == net_boxes)
+        return NULL;
+
+    valid_box = (image_box_t *)dl_lib_calloc(config->threshold.candidate_number, sizeof(image_box_t), 0);
+    if (NULL == valid_box)
+        return NULL;
+
+    image_rect2sqr(net_boxes, image->w, image->h);
+    valid_count = net_candidates_forward(image, net_boxes, config, false, valid_box);
+    if (valid_count < 0)
+    {
+        dl_lib_free(valid_box);
+        return NULL;
+    }
+
     valid_list.head = valid_box;
     valid_list.len = valid_count;
     image_sort_insert_by_score(&sorted_list, &valid_list);
@@ -557,13 +1071,11 @@ box_array_t *rnet_forward(dl_matrix3du_t *image, box_array_t *net_boxes, net_con
     return net_box_list;
 } /*}}}*/
 
-box_array_t *onet_forward(dl_matrix3du_t *image, box_array_t *net_boxes, net_config_t *config)
+box_array_t *onet_forward(const image_frame_t *image, box_array_t *net_boxes, net_config_t *config)
 { /*{{{*/
     int valid_count = 0;
     image_list_t valid_list = {NULL};
     image_list_t sorted_list = {NULL};
-    dl_matrix3du_t *resized_image;
-    dl_matrix3du_t *sliced_image;
     image_box_t *valid_box = NULL;
     box_t *net_box = NULL;
     fptp_t *net_score = NULL;
@@ -574,67 +1086,17 @@ box_array_t *onet_forward(dl_matrix3du_t *image, box_array_t *net_boxes, net_con
         return NULL;
 
     valid_box = (image_box_t *)dl_lib_calloc(config->threshold.candidate_number, sizeof(image_box_t), 0);
-    resized_image = dl_matrix3du_alloc(1, config->w, config->h, image->c);
+    if (NULL == valid_box)
+        return NULL;
 
     image_rect2sqr(net_boxes, image->w, image->h);
-    for (int i = 0; i < net_boxes->len; i++)
+    valid_count = net_candidates_forward(image, net_boxes, config, true, valid_box);
+    if (valid_count < 0)
     {
-        int x = round(net_boxes->box[i].box_p[0]);
-        int y = round(net_boxes->box[i].box_p[1]);
-        int w = round(net_boxes->box[i].box_p[2]) - x + 1;
-        int h = round(net_boxes->box[i].box_p[3]) - y + 1;
-        sliced_image = dl_matrix3du_alloc(1, w, h, image->c);
-
-        dl_matrix3du_slice_copy(sliced_image, image, x, y, w, h);
-
-        image_resize_linear(resized_image->item, sliced_image->item, config->w, config->h, image->c, w, h);
-
-#if CONFIG_MTMN_LITE_FLOAT
-        mtmn_net_t *out = onet_lite_f_with_score_verify(resized_image, config->threshold.score);
-#endif
-
-#if CONFIG_MTMN_LITE_QUANT
-        mtmn_net_t *out = onet_lite_q_with_score_verify(resized_image, config->threshold.score, DL_XTENSA_IMPL);
-#endif
-
-#if CONFIG_MTMN_HEAVY_QUANT
-        mtmn_net_t *out = onet_heavy_q_with_score_verify(resized_image, config->threshold.score, DL_XTENSA_IMPL);
-#endif
-
-        if (out)
-        {
-            assert(out->category->stride == 2);
-            assert(out->offset->stride == 4);
-            assert(out->offset->c == 4);
-            valid_box[valid_count].score = out->category->item[1];
-            valid_box[valid_count].box = net_boxes->box[i];
-            valid_box[valid_count].offset.box_p[0] = out->offset->item[0];
-            valid_box[valid_count].offset.box_p[1] = out->offset->item[1];
-            valid_box[valid_count].offset.box_p[2] = out->offset->item[2];
-            valid_box[valid_count].offset.box_p[3] = out->offset->item[3];
-            assert(out->landmark->stride == 10);
-            memcpy(&(valid_box[valid_count].landmark), out->landmark->item, sizeof(landmark_t));
-            valid_box[valid_count].next = &(valid_box[valid_count + 1]);
-            valid_count++;
-
-            dl_matrix3d_free(out->category);
-            dl_matrix3d_free(out->offset);
-            dl_matrix3d_free(out->landmark);
-            dl_lib_free(out);
-        }
-        dl_matrix3du_free(sliced_image);
-
-        if (valid_count > config->threshold.candidate_number - 1)
-            break;
+        dl_lib_free(valid_box);
+        return NULL;
     }
 
-    dl_matrix3du_free(resized_image);
-
-    if (valid_count)
-        valid_box[valid_count - 1].next = NULL;
-    else
-        valid_box[0].next = NULL;
-
     valid_list.head = valid_box;
     valid_list.len = valid_count;
     image_sort_insert_by_score(&sorted_list, &valid_list);
@@ -670,35 +1132,42 @@ box_array_t *onet_forward(dl_matrix3du_t *image, box_array_t *net_boxes, net_con
 
     return net_box_list;
 } /*}}}*/
-box_array_t *face_detect(dl_matrix3du_t *image_matrix, mtmn_config_t *config)
+static box_array_t *face_detect_pnet(const image_frame_t *image, mtmn_config_t *config)
 { /*{{{*/
     net_config_t pnet_config = {0};
     pnet_config.w = 12;
     pnet_config.h = 12;
     pnet_config.threshold = config->p_threshold;
+    pnet_config.workers = config->workers;
 
     box_array_t *pnet_boxes = NULL;
     if (FAST == config->type)
-        pnet_boxes = pnet_forward_fast(image_matrix,
+        pnet_boxes = pnet_forward_fast(image,
                                        config->min_face,
                                        config->pyramid_times,
                                        &pnet_config);
     else if (NORMAL == config->type)
-        pnet_boxes = pnet_forward2(image_matrix,
+        pnet_boxes = pnet_forward2(image,
                                    config->min_face,
                                    config->pyramid,
                                    config->pyramid_times,
                                    &pnet_config);
 
-    if (NULL == pnet_boxes)
-        return NULL;
+    return pnet_boxes;
+} /*}}}*/
 
+/*
+ * R-Net and O-Net on the P-Net candidates, pnet_boxes is freed.
+ */
+static box_array_t *face_detect_refine(const image_frame_t *image, box_array_t *pnet_boxes, mtmn_config_t *config)
+{ /*{{{*/
     net_config_t rnet_config = {0};
     rnet_config.w = 24;
     rnet_config.h = 24;
     rnet_config.threshold = config->r_threshold;
+    rnet_config.workers = config->workers;
 
-    box_array_t *rnet_boxes = rnet_forward(image_matrix,
+    box_array_t *rnet_boxes = rnet_forward(image,
                                            pnet_boxes,
                                            &rnet_config);
 
@@ -712,8 +1181,9 @@ box_array_t *face_detect(dl_matrix3du_t *image_matrix, mtmn_config_t *config)
     onet_config.w = 48;
     onet_config.h = 48;
     onet_config.threshold = config->o_threshold;
+    onet_config.workers = config->workers;
 
-    box_array_t *onet_boxes = onet_forward(image_matrix,
+    box_array_t *onet_boxes = onet_forward(image,
                                            rnet_boxes,
                                            &onet_config);
 
@@ -721,5 +1191,210 @@ box_array_t *face_detect(dl_matrix3du_t *image_matrix, mtmn_config_t *config)
     dl_lib_free(rnet_boxes);
 
     return onet_boxes;
+} /*}}}*/
+
+box_array_t *face_detect_frame(const image_frame_t *frame, mtmn_config_t *config)
+{ /*{{{*/
+    box_array_t *pnet_boxes = face_detect_pnet(frame, config);
+
+    if (NULL == pnet_boxes)
+        return NULL;
+
+    return face_detect_refine(frame, pnet_boxes, config);
+} /*}}}*/
+
+box_array_t *face_detect(dl_matrix3du_t *image_matrix, mtmn_config_t *config)
+{ /*{{{*/
+    image_frame_t frame = image_frame(image_matrix->item, image_matrix->w, image_matrix->h, IMAGE_PIXEL_RGB888);
+    return face_detect_frame(&frame, config);
+} /*}}}*/
+
+box_array_t *face_detect_roi(dl_matrix3du_t *image_matrix, mtmn_config_t *config, const box_t *rois, int roi_number)
+{ /*{{{*/
+    if (NULL == rois)
+        return face_detect(image_matrix, config);
+    if (roi_number <= 0)
+        return NULL;
+
+    box_t *regions = (box_t *)dl_lib_malloc(roi_number, sizeof(box_t), 0);
+    box_array_t **region_boxes = (box_array_t **)dl_lib_calloc(roi_number, sizeof(box_array_t *), 0);
+    if (NULL == regions || NULL == region_boxes)
+    {
+        dl_lib_free(regions);
+        dl_lib_free(region_boxes);
+        return NULL;
+    }
+    int region_number = image_rois_merge(regions, rois, roi_number, ceilf(config->min_face), image_matrix->w, image_matrix->h);
+
+    // P-Net on each region, R-Net and O-Net on the candidates of all regions
+    image_frame_t frame = image_frame(image_matrix->item, image_matrix->w, image_matrix->h, IMAGE_PIXEL_RGB888);
+    int len = 0;
+    for (int i = 0; i < region_number; i++)
+    {
+        int x = regions[i].box_p[0];
+        int y = regions[i].box_p[1];
+        image_frame_t region = frame;
+        region.data += y * frame.stride + x * 3;
+        region.w = regions[i].box_p[2] - x + 1;
+        region.h = regions[i].box_p[3] - y + 1;
+        region_boxes[i] = face_detect_pnet(&region, config);
+
+        if (region_boxes[i])
+            len += region_boxes[i]->len;
+    }
+
+    box_array_t *pnet_boxes = NULL;
+    if (len)
+    {
+        pnet_boxes = (box_array_t *)dl_lib_calloc(1, sizeof(box_array_t), 0);
+        box_t *box = (box_t *)dl_lib_calloc(len, sizeof(box_t), 0);
+        if (pnet_boxes && box)
+        {
+            pnet_boxes->box = box;
+            for (int i = 0; i < region_number; i++)
+            {
+                for (int j = 0; region_boxes[i] && j < region_boxes[i]->len; j++)
+                {
+                    box_t *b = &(pnet_boxes->box[pnet_boxes->len++]);
+                    *b = region_boxes[i]->box[j];
+                    b->box_p[0] += regions[i].box_p[0];
+                    b->box_p[1] += regions[i].box_p[1];
+                    b->box_p[2] += regions[i].box_p[0];
+                    b->box_p[3] += regions[i].box_p[1];
+                }
+            }
+        }
+        else
+        {
+            dl_lib_free(box);
+            dl_lib_free(pnet_boxes);
+            pnet_boxes = NULL;
+        }
+    }
+
+    for (int i = 0; i < region_number; i++)
+    {
+        if (region_boxes[i])
+        {
+            dl_lib_free(region_boxes[i]->box);
+            dl_lib_free(region_boxes[i]);
+        }
+    }
+    dl_lib_free(region_boxes);
+    dl_lib_free(regions);
+
+    if (NULL == pnet_boxes)
+        return NULL;
+
+    return face_detect_refine(&frame, pnet_boxes, config);
+} /*}}}*/
+
+static void face_boxes_free(box_array_t *boxes)
+{ /*{{{*/
+    if (NULL == boxes)
+        return;
+    dl_lib_free(boxes->score);
+    dl_lib_free(boxes->box);
+    dl_lib_free(boxes->landmark);
+    dl_lib_free(boxes);
+} /*}}}*/
+
+/*
+ * Run O-Net on the tracked boxes grown by config->track.expand.
+ * Returns NULL when a tracked face is not found again with enough confidence.
+ */
+static box_array_t *face_track(dl_matrix3du_t *image_matrix, mtmn_config_t *config, mtmn_tracker_t *tracker)
+{ /*{{{*/
+    box_array_t roi_list = {0};
+    roi_list.box = (box_t *)dl_lib_calloc(tracker->len, sizeof(box_t), 0);
+    if (NULL == roi_list.box)
+        return NULL;
+    roi_list.len = tracker->len;
+
+    // O-Net squares the boxes, the square must fit in the image
+    fptp_t side = DL_IMAGE_MIN(image_matrix->w, image_matrix->h) - 1;
+    for (int i = 0; i < tracker->len; i++)
+    {
+        fptp_t w, h;
+        image_get_width_and_height(&(tracker->box[i]), &w, &h);
+        fptp_t l = DL_IMAGE_MAX(w, h);
+        if (l > side)
+        {
+            dl_lib_free(roi_list.box);
+            return NULL;
+        }
+        fptp_t expand = DL_IMAGE_MIN(config->track.expand, 0.5 * (side / l - 1));
+        fptp_t dx = w * expand;
+        fptp_t dy = h * expand;
+        roi_list.box[i].box_p[0] = DL_IMAGE_MAX(0, tracker->box[i].box_p[0] - dx);
+        roi_list.box[i].box_p[1] = DL_IMAGE_MAX(0, tracker->box[i].box_p[1] - dy);
+        roi_list.box[i].box_p[2] = DL_IMAGE_MIN(image_matrix->w - 1, tracker->box[i].box_p[2] + dx);
+        roi_list.box[i].box_p[3] = DL_IMAGE_MIN(image_matrix->h - 1, tracker->box[i].box_p[3] + dy);
+    }
+
+    net_config_t onet_config = {0};
+    onet_config.w = 48;
+    onet_config.h = 48;
+    onet_config.threshold = config->o_threshold;
+    onet_config.threshold.candidate_number = DL_IMAGE_MAX(config->o_threshold.candidate_number, tracker->len);
+    onet_config.workers = config->workers;
+
+    image_frame_t frame = image_frame(image_matrix->item, image_matrix->w, image_matrix->h, IMAGE_PIXEL_RGB888);
+    box_array_t *onet_boxes = onet_forward(&frame, &roi_list, &onet_config);
+    dl_lib_free(roi_list.box);
+
+    if (NULL == onet_boxes)
+        return NULL;
+
+    bool lost = onet_boxes->len < tracker->len;
+    for (int i = 0; !lost && i < onet_boxes->len; i++)
+        lost = onet_boxes->score[i] < config->track.score;
+    if (lost)
+    {
+        face_boxes_free(onet_boxes);
+        return NULL;
+    }
+    return onet_boxes;
+} /*}}}*/
+
+box_array_t *face_detect_track(dl_matrix3du_t *image_matrix, mtmn_config_t *config, mtmn_tracker_t *tracker)
+{ /*{{{*/
+    box_array_t *faces = NULL;
+    bool whole = config->track.interval <= 1 || 0 == tracker->len || tracker->frame >= config->track.interval;
+
+    if (!whole)
+    {
+        faces = face_track(image_matrix, config, tracker);
+        whole = (NULL == faces);
+    }
 
+    if (whole)
+    {
+        faces = face_detect(image_matrix, config);
+        tracker->frame = 0;
+    }
+    tracker->frame++;
+
+    dl_lib_free(tracker->box);
+    tracker->box = NULL;
+    tracker->len = 0;
+    if (faces && faces->len)
+    {
+        tracker->box = (box_t *)dl_lib_heap_calloc(faces->len, sizeof(box_t), 0);
+        if (tracker->box)
+        {
+            memcpy(tracker->box, faces->box, faces->len * sizeof(box_t));
+            tracker->len = faces->len;
+        }
+    }
+
+    return faces;
+} /*}}}*/
+
+void mtmn_tracker_clear(mtmn_tracker_t *tracker)
+{ /*{{{*/
+    dl_lib_free(tracker->box);
+    tracker->box = NULL;
+    tracker->len = 0;
+    tracker->frame = 0;
 } /*}}}*/
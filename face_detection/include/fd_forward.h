@@ -32,6 +32,11 @@ extern "C"
 #include "dl_lib_matrix3d.h"
 #include "mtmn.h"
 
+    /**
+     * @brief Workers of the parallel stages, started once and kept between frames. See mtmn_workers_create.
+     */
+    typedef struct mtmn_workers mtmn_workers_t;
+
     typedef enum
     {
         FAST = 0,            /*!< fast resize type */         
@@ -50,8 +55,16 @@ extern "C"
         int w;                        /*!< net width */
         int h;                        /*!< net height */
         threshold_config_t threshold; /*!< threshold of net */
+        mtmn_workers_t *workers;      /*!< workers evaluating candidates or pyramid levels in parallel, NULL for serial */
     } net_config_t;
 
+    typedef struct
+    {
+        int interval; /*!< Run the whole cascade every 'interval' frames and only O-Net around the tracked faces in between, 0 or 1 to run the whole cascade on every frame */
+        float expand; /*!< Each side of a tracked box grows by this ratio of the box size before O-Net, room for the motion between two frames */
+        float score;  /*!< Run the whole cascade when a tracked face scores below it */
+    } track_config_t;
+
     typedef struct
     {
         float min_face;                 /*!< The minimum size of a detectable face */
@@ -61,8 +74,17 @@ extern "C"
         threshold_config_t r_threshold; /*!< The thresholds for R-Net. For details, see the definition of threshold_config_t */
         threshold_config_t o_threshold; /*!< The thresholds for O-Net. For details, see the definition of threshold_config_t */
         mtmn_resize_type type;          /*!< The image resize type. 'pyramid' will lose efficacy, when 'type'==FAST. */
+        mtmn_workers_t *workers;        /*!< Workers from mtmn_workers_create evaluating P-Net pyramid levels (FAST only), R-Net and O-Net candidates in parallel, NULL for serial */
+        track_config_t track;           /*!< Tracking of face_detect_track. For details, see the definition of track_config_t */
     } mtmn_config_t;
 
+    typedef struct
+    {
+        box_t *box; /*!< Faces found in the last frame, from the heap so it outlives the arena */
+        int len;    /*!< Number of faces found in the last frame */
+        int frame;  /*!< Frames since the last run of the whole cascade */
+    } mtmn_tracker_t;
+
     /**
      * @brief Get the initial MTMN model configuration
      * 
@@ -84,6 +106,10 @@ extern "C"
         mtmn_config.o_threshold.score = 0.7;
         mtmn_config.o_threshold.nms = 0.7;
         mtmn_config.o_threshold.candidate_number = 1;
+        mtmn_config.workers = NULL;
+        mtmn_config.track.interval = 0;
+        mtmn_config.track.expand = 0.2;
+        mtmn_config.track.score = 0.8;
 
         return mtmn_config;
     }
@@ -98,6 +124,111 @@ extern "C"
     box_array_t *face_detect(dl_matrix3du_t *image_matrix,
                              mtmn_config_t *config);
 
+    /**
+     * @brief Do MTMN face detection on a frame in any image_pixel_format_t, e.g. a RGB565 or YUV422 camera frame.
+     *
+     *        The pyramid levels and the R-Net and O-Net crops are resampled from the frame directly, the
+     *        frame is never converted to RGB888 as a whole. For a RGB888 frame the result is that of face_detect().
+     *
+     * @param frame             Frame, see image_frame()
+     * @param config            Configuration of MTMN
+     * @return box_array_t*     A list of boxes and score.
+     */
+    box_array_t *face_detect_frame(const image_frame_t *frame,
+                                   mtmn_config_t *config);
+
+    /**
+     * @brief Do MTMN face detection only around the given regions, e.g. the motion regions of image_motion_rois().
+     *
+     *        The regions are grown to at least min_face and merged when they overlap. P-Net runs on each
+     *        of them, R-Net and O-Net on the candidates of all of them, in the coordinates of the image.
+     *        A face has to lie inside a region to be found.
+     *
+     * @param image_matrix      Image matrix, rgb888 format
+     * @param config            Configuration of MTMN
+     * @param rois              Regions in the image, NULL for the whole image like face_detect()
+     * @param roi_number        Number of regions
+     * @return box_array_t*     A list of boxes and score, NULL if no face or no region
+     */
+    box_array_t *face_detect_roi(dl_matrix3du_t *image_matrix,
+                                 mtmn_config_t *config,
+                                 const box_t *rois,
+                                 int roi_number);
+
+    /**
+     * @brief Do MTMN face detection on a video, following the faces of the last frame.
+     *
+     *        Between two runs of the whole cascade, only O-Net runs, on the tracked boxes grown by
+     *        config->track.expand. When a tracked face is lost or scores below config->track.score,
+     *        the whole cascade runs on that frame. New faces are found at the next whole run.
+     *
+     * @param image_matrix      Image matrix, rgb888 format
+     * @param config            Configuration of MTMN, config->track sets the tracking
+     * @param tracker           State kept between frames, zero-initialize it before the first frame
+     * @return box_array_t*     A list of boxes and score, the same as face_detect
+     */
+    box_array_t *face_detect_track(dl_matrix3du_t *image_matrix,
+                                   mtmn_config_t *config,
+                                   mtmn_tracker_t *tracker);
+
+    /**
+     * @brief Forget the tracked faces and free their memory, the next frame runs the whole cascade.
+     *
+     * @param tracker           State of face_detect_track
+     */
+    void mtmn_tracker_clear(mtmn_tracker_t *tracker);
+
+    /**
+     * @brief Start the workers of the parallel stages. They wait between the calls, so no task or thread
+     *        is created per frame. The calling task is one of the workers, set the result to
+     *        mtmn_config_t.workers. One set of workers serves one call of face_detect at a time.
+     * 
+     * @param worker_number         Number of workers, the calling task included, at most 8. On ESP32, 2 uses both cores
+     * @return mtmn_workers_t*      NULL for worker_number <= 1, or when no worker could be started, which means serial
+     */
+    mtmn_workers_t *mtmn_workers_create(int worker_number);
+
+    /**
+     * @brief Stop the workers of mtmn_workers_create. No face_detect may be using them.
+     * 
+     * @param workers               Workers, NULL is ignored
+     */
+    void mtmn_workers_destroy(mtmn_workers_t *workers);
+
+    typedef struct
+    {
+        int n;          /*!< Number of candidates */
+        uint8_t *valid; /*!< valid[i] is 1 if candidate i passed the score threshold, its results in 'net' are then set */
+        mtmn_net_t net; /*!< Results of all candidates, category (n, 1, 1, 2), offset (n, 1, 1, 4), landmark (n, 1, 1, 10) or NULL */
+    } mtmn_net_batch_t;
+
+    /**
+     * @brief Run R-Net on a batch of candidates. The net takes one crop at a time, so this evaluates
+     *        the candidates one by one and copies their results into the batch tensors.
+     * 
+     * @param in                        Candidate crops, size (n, 24, 24, 3)
+     * @param threshold                 Score threshold
+     * @return mtmn_net_batch_t*        Results of all candidates, landmark is NULL. NULL if out of memory.
+     *                                  Free with mtmn_net_batch_free
+     */
+    mtmn_net_batch_t *rnet_with_score_verify_batch(dl_matrix3du_t *in, float threshold);
+
+    /**
+     * @brief Run O-Net on a batch of candidates, one by one like rnet_with_score_verify_batch.
+     * 
+     * @param in                        Candidate crops, size (n, 48, 48, 3)
+     * @param threshold                 Score threshold
+     * @return mtmn_net_batch_t*        Results of all candidates. NULL if out of memory. Free with mtmn_net_batch_free
+     */
+    mtmn_net_batch_t *onet_with_score_verify_batch(dl_matrix3du_t *in, float threshold);
+
+    /**
+     * @brief Free the results of rnet_with_score_verify_batch and onet_with_score_verify_batch.
+     * 
+     * @param out               Results of a batch
+     */
+    void mtmn_net_batch_free(mtmn_net_batch_t *out);
+
 #if __cplusplus
 }
 #endif
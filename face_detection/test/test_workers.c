@@ -0,0 +1,151 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * face_detect gives the same faces with persistent workers as serially.
+ * The nets come from the prebuilt model library, which the host build does not link, so they are
+ * replaced by deterministic scores of the mean green of each window.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fd_forward.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+static mtmn_net_t *net_alloc(int w, int h, int landmark)
+{
+    mtmn_net_t *out = (mtmn_net_t *)dl_lib_calloc(1, sizeof(mtmn_net_t), 0);
+    out->category = dl_matrix3d_alloc(1, w, h, 2);
+    out->offset = dl_matrix3d_alloc(1, w, h, 4);
+    out->landmark = landmark ? dl_matrix3d_alloc(1, w, h, 10) : NULL;
+    for (int i = 0; landmark && i < w * h * 10; i++)
+        out->landmark->item[i] = 0.5;
+    return out;
+}
+
+static float window_mean(dl_matrix3du_t *in, int x0, int y0, int size)
+{
+    int sum = 0;
+    for (int y = y0; y < y0 + size; y++)
+        for (int x = x0; x < x0 + size; x++)
+            sum += in->item[(y * in->w + x) * 3 + 1];
+    return sum / (255.0f * size * size);
+}
+
+mtmn_net_t *pnet_lite_q(dl_matrix3du_t *in, dl_conv_mode mode)
+{
+    int w = (in->w - 12) / 2 + 1;
+    int h = (in->h - 12) / 2 + 1;
+    mtmn_net_t *out = net_alloc(w, h, 0);
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+            out->category->item[2 * (y * w + x) + 1] = window_mean(in, 2 * x, 2 * y, 12);
+    return out;
+}
+
+static mtmn_net_t *crop_net(dl_matrix3du_t *in, float threshold, int landmark)
+{
+    float score = window_mean(in, 0, 0, in->w);
+    if (score < threshold)
+        return NULL;
+    mtmn_net_t *out = net_alloc(1, 1, landmark);
+    out->category->item[1] = score;
+    return out;
+}
+
+mtmn_net_t *rnet_lite_q_with_score_verify(dl_matrix3du_t *in, float threshold, dl_conv_mode mode)
+{
+    return crop_net(in, threshold, 0);
+}
+
+mtmn_net_t *onet_lite_q_with_score_verify(dl_matrix3du_t *in, float threshold, dl_conv_mode mode)
+{
+    return crop_net(in, threshold, 1);
+}
+
+static void boxes_free(box_array_t *boxes)
+{
+    if (NULL == boxes)
+        return;
+    dl_lib_free(boxes->score);
+    dl_lib_free(boxes->box);
+    dl_lib_free(boxes->landmark);
+    dl_lib_free(boxes);
+}
+
+int main(void)
+{
+    dl_matrix3du_t *image = dl_matrix3du_alloc(1, 320, 240, 3);
+    CHECK(image);
+    srand(1);
+    for (int i = 0; i < 320 * 240 * 3; i++)
+        image->item[i] = rand() & 0x3f;
+
+    mtmn_config_t config = mtmn_init_config();
+    config.p_threshold.score = 0.6;
+    config.r_threshold.score = 0.6;
+    config.o_threshold.score = 0.6;
+    config.o_threshold.candidate_number = 4;
+
+    CHECK(NULL == mtmn_workers_create(1));
+    mtmn_workers_t *workers = mtmn_workers_create(4);
+    CHECK(workers);
+
+    for (int frame = 0; frame < 20; frame++)
+    {
+        // a bright square moving across the frames
+        int x0 = 40 + frame * 8, y0 = 60 + frame * 3;
+        for (int y = y0; y < y0 + 70; y++)
+            for (int x = x0; x < x0 + 70; x++)
+                image->item[(y * 320 + x) * 3 + 1] = 0xe0 - frame;
+
+        config.type = frame & 1 ? NORMAL : FAST;
+        config.workers = NULL;
+        box_array_t *serial = face_detect(image, &config);
+        config.workers = workers;
+        box_array_t *parallel = face_detect(image, &config);
+
+        CHECK(serial && parallel);
+        CHECK(serial->len == parallel->len);
+        CHECK(0 == memcmp(serial->box, parallel->box, serial->len * sizeof(box_t)));
+        CHECK(0 == memcmp(serial->score, parallel->score, serial->len * sizeof(fptp_t)));
+        boxes_free(serial);
+        boxes_free(parallel);
+    }
+
+    mtmn_workers_destroy(workers);
+    mtmn_workers_destroy(NULL);
+    dl_matrix3du_free(image);
+    printf("workers: ok\n");
+    return 0;
+}
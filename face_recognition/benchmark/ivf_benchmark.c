@@ -0,0 +1,266 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Recall and latency of face_id_ivf_search against the exact face_id_index_search.
+ *
+ *   ivf_benchmark [-n gallery] [-q queries] [-l nlist] [-t f32|f16|q8] [-f embeddings.bin]
+ *
+ * Without -f the gallery is synthetic: one random unit face id per identity,
+ * queries are noisy copies of random identities. With -f the gallery is read
+ * from a file of float32 face ids (FACE_ID_SIZE each, e.g. dumped from
+ * get_face_ids) and the queries are noisy copies of its rows.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "fr_ivf.h"
+
+#define BENCH_TOP_K 10
+#define BENCH_NOISE 0.05f
+
+static uint32_t bench_seed = 1;
+
+static fptp_t bench_uniform(void)
+{
+    bench_seed = bench_seed * 1664525u + 1013904223u;
+    return (bench_seed >> 8) * (1.0f / 16777216.0f) - 0.5f;
+}
+
+static void bench_normalize(fptp_t *v, int n)
+{
+    fptp_t norm = 0;
+    for (int i = 0; i < n; i++)
+        norm += v[i] * v[i];
+    norm = 1 / sqrtf(norm);
+    for (int i = 0; i < n; i++)
+        v[i] *= norm;
+}
+
+static double bench_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static fptp_t *bench_load(const char *path, int *n)
+{
+    FILE *f = fopen(path, "rb");
+    if (NULL == f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    long bytes = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    int rows = bytes / (FACE_ID_SIZE * sizeof(fptp_t));
+    if (*n > 0 && *n < rows)
+        rows = *n;
+    fptp_t *gallery = (fptp_t *)malloc((size_t)rows * FACE_ID_SIZE * sizeof(fptp_t));
+    if (gallery && rows != (int)fread(gallery, FACE_ID_SIZE * sizeof(fptp_t), rows, f))
+    {
+        free(gallery);
+        gallery = NULL;
+    }
+    fclose(f);
+
+    for (int i = 0; gallery && i < rows; i++)
+        bench_normalize(gallery + (size_t)i * FACE_ID_SIZE, FACE_ID_SIZE);
+    *n = rows;
+    return gallery;
+}
+
+static int bench_contains(face_id_match_t *matches, int n, int32_t label)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if (matches[i].label == label)
+            return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int n = 100000;
+    int queries = 1000;
+    int nlist = 0;
+    const char *path = NULL;
+    face_id_index_type type = FACE_ID_INDEX_F32;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (0 == strcmp(argv[i], "-n"))
+            n = atoi(argv[i + 1]);
+        else if (0 == strcmp(argv[i], "-q"))
+            queries = atoi(argv[i + 1]);
+        else if (0 == strcmp(argv[i], "-l"))
+            nlist = atoi(argv[i + 1]);
+        else if (0 == strcmp(argv[i], "-f"))
+            path = argv[i + 1];
+        else if (0 == strcmp(argv[i], "-t"))
+            type = 0 == strcmp(argv[i + 1], "q8") ? FACE_ID_INDEX_Q8 : (0 == strcmp(argv[i + 1], "f16") ? FACE_ID_INDEX_F16 : FACE_ID_INDEX_F32);
+    }
+
+    fptp_t *gallery = NULL;
+    if (path)
+    {
+        gallery = bench_load(path, &n);
+    }
+    else
+    {
+        gallery = (fptp_t *)malloc((size_t)n * FACE_ID_SIZE * sizeof(fptp_t));
+        for (size_t i = 0; gallery && i < (size_t)n * FACE_ID_SIZE; i++)
+            gallery[i] = bench_uniform();
+        for (int i = 0; gallery && i < n; i++)
+            bench_normalize(gallery + (size_t)i * FACE_ID_SIZE, FACE_ID_SIZE);
+    }
+    if (NULL == gallery || n <= 0)
+    {
+        printf("No gallery\n");
+        return 1;
+    }
+    if (nlist <= 0)
+        nlist = 4 * (int)sqrtf((float)n);
+    if (nlist > n)
+        nlist = n;
+
+    int32_t *labels = (int32_t *)malloc(n * sizeof(int32_t));
+    for (int i = 0; i < n; i++)
+        labels[i] = i;
+
+    fptp_t *query = (fptp_t *)malloc((size_t)queries * FACE_ID_SIZE * sizeof(fptp_t));
+    for (int q = 0; q < queries; q++)
+    {
+        const fptp_t *src = gallery + (size_t)((bench_seed = bench_seed * 1664525u + 1013904223u) % n) * FACE_ID_SIZE;
+        fptp_t *dst = query + (size_t)q * FACE_ID_SIZE;
+        for (int j = 0; j < FACE_ID_SIZE; j++)
+            dst[j] = src[j] + BENCH_NOISE * bench_uniform();
+        bench_normalize(dst, FACE_ID_SIZE);
+    }
+
+    face_id_index_t *exact = face_id_index_create(FACE_ID_SIZE, n, type);
+    for (int i = 0; i < n; i++)
+        face_id_index_add(exact, gallery + (size_t)i * FACE_ID_SIZE, labels[i]);
+
+    double start = bench_now_us();
+    face_id_ivf_t *ivf = face_id_ivf_create(FACE_ID_SIZE, nlist, type);
+    if (NULL == ivf || DL_SUCCESS != face_id_ivf_build(ivf, gallery, labels, n))
+    {
+        printf("Build failed\n");
+        return 1;
+    }
+    printf("gallery %d, queries %d, nlist %d, type %d, build %.1f ms\n", n, queries, nlist, type, (bench_now_us() - start) / 1e3);
+
+    face_id_match_t *truth = (face_id_match_t *)malloc((size_t)queries * BENCH_TOP_K * sizeof(face_id_match_t));
+    start = bench_now_us();
+    for (int q = 0; q < queries; q++)
+        face_id_index_search(exact, query + (size_t)q * FACE_ID_SIZE, BENCH_TOP_K, truth + q * BENCH_TOP_K);
+    printf("%-8s %10s %10s %12s\n", "nprobe", "recall@1", "recall@10", "us/query");
+    printf("%-8s %10.4f %10.4f %12.1f\n", "exact", 1.0, 1.0, (bench_now_us() - start) / queries);
+
+    for (int nprobe = 1; nprobe <= nlist; nprobe *= 2)
+    {
+        face_id_match_t matches[BENCH_TOP_K];
+        int hit1 = 0;
+        int hit10 = 0;
+        ivf->nprobe = nprobe;
+
+        start = bench_now_us();
+        for (int q = 0; q < queries; q++)
+        {
+            face_id_match_t *t = truth + q * BENCH_TOP_K;
+            int found = face_id_ivf_search(ivf, query + (size_t)q * FACE_ID_SIZE, BENCH_TOP_K, matches);
+            hit1 += found > 0 && matches[0].label == t[0].label;
+            for (int j = 0; j < BENCH_TOP_K; j++)
+                hit10 += bench_contains(matches, found, t[j].label);
+        }
+        printf("%-8d %10.4f %10.4f %12.1f\n", nprobe, (double)hit1 / queries, (double)hit10 / (queries * BENCH_TOP_K), (bench_now_us() - start) / queries);
+    }
+
+    // save and load, the loaded index must give the same top match
+    FILE *f = tmpfile();
+    start = bench_now_us();
+    if (NULL == f || DL_SUCCESS != face_id_ivf_save(ivf, f))
+    {
+        printf("Save failed\n");
+        return 1;
+    }
+    long bytes = ftell(f);
+    double save_ms = (bench_now_us() - start) / 1e3;
+    rewind(f);
+    start = bench_now_us();
+    face_id_ivf_t *loaded = face_id_ivf_load(f);
+    double load_ms = (bench_now_us() - start) / 1e3;
+    fclose(f);
+    if (NULL == loaded)
+    {
+        printf("Load failed\n");
+        return 1;
+    }
+    int same = 0;
+    for (int q = 0; q < queries; q++)
+    {
+        face_id_match_t a, b;
+        const fptp_t *face_id = query + (size_t)q * FACE_ID_SIZE;
+        same += face_id_ivf_search(ivf, face_id, 1, &a) == face_id_ivf_search(loaded, face_id, 1, &b) && a.label == b.label;
+    }
+    printf("save %.1f ms, load %.1f ms, %ld bytes, same top match %d / %d\n", save_ms, load_ms, bytes, same, queries);
+
+    // delete the top match of every query, then no search may return a deleted face id
+    char *gone = (char *)calloc(n, 1);
+    int removed = 0;
+    start = bench_now_us();
+    for (int q = 0; gone && q < queries; q++)
+    {
+        face_id_match_t match;
+        if (face_id_ivf_search(loaded, query + (size_t)q * FACE_ID_SIZE, 1, &match) && DL_SUCCESS == face_id_ivf_remove(loaded, match.label))
+        {
+            gone[match.label] = 1;
+            removed++;
+        }
+    }
+    double remove_us = (bench_now_us() - start) / queries;
+    int returned = 0;
+    for (int q = 0; gone && q < queries; q++)
+    {
+        face_id_match_t matches[BENCH_TOP_K];
+        int found = face_id_ivf_search(loaded, query + (size_t)q * FACE_ID_SIZE, BENCH_TOP_K, matches);
+        for (int j = 0; j < found; j++)
+            returned += gone[matches[j].label];
+    }
+    printf("removed %d, %.1f us/remove with its search, count %d, removed ids returned %d\n", removed, remove_us, loaded->count, returned);
+    free(gone);
+    face_id_ivf_free(loaded);
+
+    face_id_ivf_free(ivf);
+    face_id_index_free(exact);
+    free(truth);
+    free(query);
+    free(labels);
+    free(gallery);
+    return 0;
+}
@@ -4,220 +4,172 @@
 #include <math.h>
 #include "esp_log.h"
 #include "fr_flash.h"
+#include "fr_store.h"
 #include "freertos/FreeRTOS.h"
 #include "esp_partition.h"
 
 static const char *TAG = "fr_flash";
-int8_t enroll_face_id_to_flash(face_id_list *l,
-              dl_matrix3du_t *aligned_face)
-{
-    int8_t left_sample = enroll_face(l, aligned_face);
-    if (left_sample == 0)
-    {
-        const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
-        if (pt == NULL){
-            ESP_LOGE(TAG, "Not found");
-            return -2;
-        }
-
-        const int block_len = FACE_ID_SIZE * sizeof(float);
-        const int block_num = (4096 + block_len - 1) / block_len;
-        float *backup_buf = (float *)dl_lib_calloc(1, block_len, 0);
-        int flash_info_flag = FR_FLASH_INFO_FLAG;
-        uint8_t enroll_id_idx = l->tail == 0 ? (l->size - 1) : (l->tail - 1) % l->size;
-
-        if(enroll_id_idx % block_num == 0)
-        {
-            // save the other block TODO: if block != 2
-            esp_partition_read(pt, 4096 + (enroll_id_idx + 1) * block_len, backup_buf, block_len);
 
-            esp_partition_erase_range(pt, 4096 + enroll_id_idx * block_len, 4096);
+static esp_err_t fr_flash_read(fr_storage_t *storage, size_t offset, void *dst, size_t len)
+{
+    return esp_partition_read((const esp_partition_t *)storage->ctx, offset, dst, len);
+}
 
-            esp_partition_write(pt, 4096 + enroll_id_idx * block_len, l->id_list[enroll_id_idx]->item, block_len);
-            esp_partition_write(pt, 4096 + (enroll_id_idx + 1) * block_len, backup_buf, block_len); 
-        }
-        else
-        {
-            // save the other block TODO: if block != 2
-            esp_partition_read(pt, 4096 + (enroll_id_idx - 1) * block_len, backup_buf, block_len);
+static esp_err_t fr_flash_write(fr_storage_t *storage, size_t offset, const void *src, size_t len)
+{
+    return esp_partition_write((const esp_partition_t *)storage->ctx, offset, src, len);
+}
 
-            esp_partition_erase_range(pt, 4096 + (enroll_id_idx - 1) * block_len, 4096);
+static esp_err_t fr_flash_erase(fr_storage_t *storage, size_t offset, size_t len)
+{
+    return esp_partition_erase_range((const esp_partition_t *)storage->ctx, offset, len);
+}
 
-            esp_partition_write(pt, 4096 + (enroll_id_idx - 1) * block_len, backup_buf, block_len);
-            esp_partition_write(pt, 4096 + enroll_id_idx * block_len, l->id_list[enroll_id_idx]->item, block_len); 
-        }
+/*
+ * The face id log on the FR_FLASH_PARTITION_NAME partition, opened and
+ * replayed on first use.
+ */
+static fr_store_t *fr_flash_store()
+{
+    static fr_storage_t storage;
+    static fr_store_t *store = NULL;
+    if (store)
+        return store;
 
-        dl_lib_free(backup_buf);
+    const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
+    if (pt == NULL)
+    {
+        ESP_LOGE(TAG, "Not found");
+        return NULL;
+    }
+
+    storage.ctx = (void *)pt;
+    storage.size = pt->size;
+    storage.erase_size = SPI_FLASH_SEC_SIZE;
+    storage.read = fr_flash_read;
+    storage.write = fr_flash_write;
+    storage.erase = fr_flash_erase;
+    storage.close = NULL;
+    store = fr_store_open(&storage);
+    return store;
+}
 
-        esp_partition_erase_range(pt, 0, 4096);
-        esp_partition_write(pt, 0, &flash_info_flag, sizeof(int));
-        esp_partition_write(pt, sizeof(int), l, sizeof(face_id_list));
+int8_t enroll_face_id_to_flash(face_id_list *l,
+                               dl_matrix3du_t *aligned_face)
+{
+    int8_t left_sample = enroll_face(l, aligned_face);
+    if (left_sample == 0)
+    {
+        fr_store_t *store = fr_flash_store();
+        if (store == NULL)
+            return -2;
 
+        // The slot in the list is the key, enrolling into a used slot replaces it
+        int enroll_id_idx = (l->tail + l->size - 1) % l->size;
+        if (fr_store_add(store, enroll_id_idx, NULL, l->id_list[enroll_id_idx]->item) < 0)
+            return -2;
         return 0;
     }
 
     return left_sample;
 }
 
-int8_t read_face_id_from_flash(face_id_list *l)
+int read_face_id_from_flash(face_id_list *l)
 {
-    const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
-    if (pt == NULL){
-        ESP_LOGE(TAG, "Not found");
+    fr_store_t *store = fr_flash_store();
+    if (store == NULL)
         return -1;
-    }
-
-    int flash_info_flag = 0;
 
-    esp_partition_read(pt, 0, &flash_info_flag, sizeof(int));
-    if(flash_info_flag != FR_FLASH_INFO_FLAG)
+    if (store->count == 0)
     {
         ESP_LOGE(TAG, "No ID Infomation");
         return -2;
     }
 
-    uint8_t size = l->size;
-    uint8_t confirm_times = l->confirm_times;
-    dl_matrix3d_t **id_list = l->id_list;
-
-    esp_partition_read(pt, sizeof(int), l, sizeof(face_id_list));
-    const int block_len = FACE_ID_SIZE * sizeof(float);
-
-    assert(l->size == size);
-    assert(l->confirm_times == confirm_times);
-
-    for(int i = 0; i < l->count; i++)
+    // Entries are in enrollment order, the first one is the head of the ring
+    l->count = 0;
+    for (int i = 0; i < store->count && l->count < l->size; i++)
     {
-        uint8_t head = (l->head + i) % size;
-        id_list[head] = dl_matrix3d_alloc(1, 1, 1, FACE_ID_SIZE);
-        esp_partition_read(pt, 4096 + head * block_len, id_list[head]->item, block_len);
+        int id = store->entries[i].key;
+        if (id < 0 || id >= l->size)
+            continue;
+        if (l->id_list[id] == NULL)
+            l->id_list[id] = dl_matrix3d_alloc(1, 1, 1, FACE_ID_SIZE);
+        fr_store_read(store, i, l->id_list[id]->item);
+        if (l->count == 0)
+            l->head = id;
+        l->count++;
     }
+    l->tail = (l->head + l->count) % l->size;
 
-    l->id_list = id_list;
+    face_id_list_reindex(l);
 
     return l->count;
 }
 
-int8_t delete_face_id_in_flash(face_id_list *l)
+int delete_face_id_in_flash(face_id_list *l)
 {
-    delete_face(l);
+    if (l->count == 0)
+        return 0;
 
-    const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
-    if (pt == NULL){
-        ESP_LOGE(TAG, "Not found");
+    fr_store_t *store = fr_flash_store();
+    if (store == NULL)
         return -1;
-    }
 
-    int flash_info_flag = 0;
-    esp_partition_read(pt, 0, &flash_info_flag, sizeof(int));
-    if((flash_info_flag != FR_FLASH_INFO_FLAG))
+    // The list only forgets the id once the flash has
+    int stored = fr_store_find(store, l->head) >= 0;
+    if (stored && ESP_OK != fr_store_delete(store, l->head))
     {
-        ESP_LOGE(TAG, "No ID Infomation");
+        ESP_LOGE(TAG, "Delete failed");
         return -2;
     }
 
-    esp_partition_erase_range(pt, 0, 4096);
-    if (l->count)
+    delete_face(l);
+    if (!stored)
     {
-        esp_partition_write(pt, 0, &flash_info_flag, sizeof(int));
-        esp_partition_write(pt, sizeof(int), l, sizeof(face_id_list));
+        ESP_LOGE(TAG, "No ID Infomation");
+        return -2;
     }
     return l->count;
 }
 
 int8_t enroll_face_id_to_flash_with_name(face_id_name_list *l,
-                                dl_matrix3d_t *face_id,
-                                char *name)
+                                         dl_matrix3d_t *face_id,
+                                         char *name)
 {
     int8_t left_sample = enroll_face_with_name(l, face_id, name);
     if (left_sample)
         return left_sample;
 
     // left_sample == 0
-    const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
-    if (pt == NULL){
-        ESP_LOGE(TAG, "Not found");
+    fr_store_t *store = fr_flash_store();
+    if (store == NULL)
         return -2;
-    }
-
-    uint8_t enroll_id_idx = l->count - 1;
-
-    // flash can only be erased divided by 4K
-    const int block_len = FACE_ID_SIZE * sizeof(float);
-    const int block_num = (4096 + block_len - 1) / block_len;
-
-    if(enroll_id_idx % block_num == 0)
-    {
-        // save the other block TODO: if block != 2
-        esp_partition_erase_range(pt, 4096 + enroll_id_idx * block_len, 4096);
-
-        esp_partition_write(pt, 4096 + enroll_id_idx * block_len, l->tail->id_vec->item, block_len);
-    }
-    else
-    {
-        // save the other block TODO: if block != 2
-        float *backup_buf = (float *)dl_lib_calloc(1, block_len, 0);
-        esp_partition_read(pt, 4096 + (enroll_id_idx - 1) * block_len, backup_buf, block_len);
-
-        esp_partition_erase_range(pt, 4096 + (enroll_id_idx - 1) * block_len, 4096);
-
-        esp_partition_write(pt, 4096 + (enroll_id_idx - 1) * block_len, backup_buf, block_len);
-        esp_partition_write(pt, 4096 + enroll_id_idx * block_len, l->tail->id_vec->item, block_len); 
-        dl_lib_free(backup_buf);
-    }
-
-    const int name_len = ENROLL_NAME_LEN * sizeof(char);
-    char *backup_name = (char *)dl_lib_calloc(l->count, name_len, 0);
-    esp_partition_read(pt, sizeof(int) + sizeof(uint8_t), backup_name, name_len * (l->count - 1));
-    memcpy(backup_name + (l->count - 1) * name_len, l->tail->id_name, name_len);
-    esp_partition_erase_range(pt, 0, 4096);
-    int flash_info_flag = FR_FLASH_INFO_FLAG;
-    esp_partition_write(pt, 0, &flash_info_flag, sizeof(int));
-    esp_partition_write(pt, sizeof(int), &l->count, sizeof(uint8_t));
-    esp_partition_write(pt, sizeof(int) + sizeof(uint8_t), backup_name, name_len * l->count);
-    dl_lib_free(backup_name);
 
+    if (fr_store_add(store, -1, l->tail->id_name, l->tail->id_vec->item) < 0)
+        return -2;
     return 0;
 }
 
-int8_t read_face_id_from_flash_with_name(face_id_name_list *l)
+int read_face_id_from_flash_with_name(face_id_name_list *l)
 {
-    const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
-    if (pt == NULL){
-        ESP_LOGE(TAG, "Not found");
+    fr_store_t *store = fr_flash_store();
+    if (store == NULL)
         return -1;
-    }
 
-    int flash_info_flag = 0;
-    int offset = 0;
-
-    esp_partition_read(pt, offset, &flash_info_flag, sizeof(int));
-    offset += sizeof(int);
-    if(flash_info_flag != FR_FLASH_INFO_FLAG)
+    if (store->count == 0)
     {
         ESP_LOGE(TAG, "No ID Infomation");
         return -2;
     }
 
-    // name and list have been initialized, need to copy them to prevent overwriting after read from flash
-    uint8_t count = 0;
-
-    esp_partition_read(pt, offset, &count, sizeof(uint8_t));
-    offset += sizeof(uint8_t);
-    const int name_len = count * ENROLL_NAME_LEN;
-    char *name = (char *)dl_lib_calloc(name_len, sizeof(char), 0);
-
-    esp_partition_read(pt, offset, name, name_len);
-    offset += name_len;
-
-    const int block_len = FACE_ID_SIZE * sizeof(float);
-    for (int i = 0; i < count; i++)
+    for (int i = 0; i < store->count; i++)
     {
         face_id_node *new_node = (face_id_node *)dl_lib_calloc(1, sizeof(face_id_node), 0);
         new_node->next = NULL;
-        memcpy(new_node->id_name, name + i * ENROLL_NAME_LEN * sizeof(char), ENROLL_NAME_LEN * sizeof(char));
+        memcpy(new_node->id_name, store->entries[i].name, ENROLL_NAME_LEN * sizeof(char));
         new_node->id_vec = dl_matrix3d_alloc(1, 1, 1, FACE_ID_SIZE);
-        esp_partition_read(pt, 4096 + i * block_len, new_node->id_vec->item, block_len);
+        fr_store_read(store, i, new_node->id_vec->item);
         if (NULL == l->head)
         {
             l->head = new_node;
@@ -230,81 +182,32 @@ int8_t read_face_id_from_flash_with_name(face_id_name_list *l)
         }
     }
 
-    dl_lib_free(name);
-
-    l->count = count;
+    l->count = store->count;
+    face_id_name_list_reindex(l);
 
-    return count;
+    return l->count;
 }
 
-int8_t delete_face_id_in_flash_with_name(face_id_name_list *l, char *name)
+int delete_face_id_in_flash_with_name(face_id_name_list *l, char *name)
 {
-    int8_t index = delete_face_with_name(l, name);
-    if (index < 0)
-        return -3;
-
-    const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
-    if (pt == NULL){
-        ESP_LOGE(TAG, "Not found");
+    fr_store_t *store = fr_flash_store();
+    if (store == NULL)
         return -1;
-    }
 
-    int flash_info_flag = 0;
-    esp_partition_read(pt, 0, &flash_info_flag, sizeof(int));
-    if((flash_info_flag != FR_FLASH_INFO_FLAG))
+    // The list only forgets the name once the flash has
+    int i = fr_store_find_name(store, name);
+    if (i >= 0 && ESP_OK != fr_store_delete(store, store->entries[i].key))
     {
-        ESP_LOGE(TAG, "No ID Infomation");
+        ESP_LOGE(TAG, "Delete failed");
         return -2;
     }
 
-    esp_partition_erase_range(pt, 0, 4096);
-    esp_partition_write(pt, 0, &flash_info_flag, sizeof(int));
-    esp_partition_write(pt, sizeof(int), &l->count, sizeof(uint8_t));
-
-    // Last one don't need shift
-    if (0 == l->count)
-        return 0;
-
-    int i = 0;
-    face_id_node *f = l->head;
-    while (i < index)
-    {
-        esp_partition_write(pt, sizeof(int) + sizeof(uint8_t) + i * ENROLL_NAME_LEN * sizeof(char), f->id_name, ENROLL_NAME_LEN * sizeof(char));
-        f = f->next;
-        i++;
-    }
-
-    const int block_len = FACE_ID_SIZE * sizeof(float);
-    const int block_num = (4096 + block_len - 1) / block_len;
-    while (i < l->count)
+    if (delete_face_with_name(l, name) < 0)
+        return -3;
+    if (i < 0)
     {
-        if (i % block_num == 0)
-        {
-            esp_partition_erase_range(pt, 4096 + i * block_len, 4096);
-
-            esp_partition_write(pt, 4096 + i * block_len, f->id_vec->item, block_len);
-            esp_partition_write(pt, sizeof(int) + sizeof(uint8_t) + i * ENROLL_NAME_LEN * sizeof(char), f->id_name, ENROLL_NAME_LEN * sizeof(char));
-
-            if (f == l->tail)
-                break;
-            
-            f = f->next;
-            esp_partition_write(pt, 4096 + (i + 1) * block_len, f->id_vec->item, block_len);
-            esp_partition_write(pt, sizeof(int) + sizeof(uint8_t) + (i + 1) * ENROLL_NAME_LEN * sizeof(char), f->id_name, ENROLL_NAME_LEN * sizeof(char));
-            i += 2;
-        }
-        else
-        {
-            float *backup_buf = (float *)dl_lib_calloc(1, block_len, 0);
-            esp_partition_read(pt, 4096 + (i - 1) * block_len, backup_buf, block_len);
-            esp_partition_erase_range(pt, 4096 + (i - 1) * block_len, 4096);
-
-            esp_partition_write(pt, 4096 + (i - 1) * block_len, backup_buf, block_len);
-            esp_partition_write(pt, 4096 + i * block_len, f->id_vec->item, block_len);
-            esp_partition_write(pt, sizeof(int) + sizeof(uint8_t) + i * ENROLL_NAME_LEN * sizeof(char), f->id_name, ENROLL_NAME_LEN * sizeof(char));
-            i += 1;
-            dl_lib_free(backup_buf);
-        }
+        ESP_LOGE(TAG, "No ID Infomation");
+        return -2;
     }
 
     return l->count;
@@ -312,20 +215,15 @@ int8_t delete_face_id_in_flash_with_name(face_id_name_list *l, char *name)
 
 void delete_face_all_in_flash_with_name(face_id_name_list *l)
 {
-    const esp_partition_t *pt = esp_partition_find_first(FR_FLASH_TYPE, FR_FLASH_SUBTYPE, FR_FLASH_PARTITION_NAME);
-    if (pt == NULL){
-        ESP_LOGE(TAG, "Not found");
+    fr_store_t *store = fr_flash_store();
+    if (store == NULL)
         return;
-    }
 
-    int flash_info_flag = 0;
-    esp_partition_read(pt, 0, &flash_info_flag, sizeof(int));
-    if((flash_info_flag != FR_FLASH_INFO_FLAG))
+    if (ESP_OK != fr_store_format(store))
     {
-        ESP_LOGE(TAG, "No ID Infomation");
+        ESP_LOGE(TAG, "Delete failed");
         return;
     }
-    esp_partition_erase_range(pt, 0, 4096 * (l->count + 1));
 
     delete_face_all_with_name(l);
 }
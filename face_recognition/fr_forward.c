@@ -5,14 +5,57 @@
 #include "esp_log.h"
 #include "fr_forward.h"
 #include "freertos/FreeRTOS.h"
-#include "esp_partition.h"
+#include "esp_err.h"
 
 static const char *TAG = "face_recognition";
 
 static float dst_ldk_x[5] = {19.1473,36.7659,28.0126,20.77465,35.36495};
 static float dst_ldk_y[5] = {25.84815,25.7507,35.8683,46.18275,46.10205};
 
-void face_id_init(face_id_list *l, uint8_t size, uint8_t confirm_times)
+#define FRMN_INPUT_EXPONENT -10
+
+/*
+ * nodes[] always has the capacity of the index, both grow here.
+ */
+static dl_error_type face_id_name_index_reserve(face_id_name_list *l, int capacity)
+{
+    if (capacity <= l->index->capacity)
+        return DL_SUCCESS;
+
+    face_id_node **nodes = (face_id_node **)dl_lib_calloc(capacity, sizeof(face_id_node *), 0);
+    if (NULL == nodes || DL_SUCCESS != face_id_index_reserve(l->index, capacity))
+    {
+        dl_lib_free(nodes);
+        return DL_FAIL;
+    }
+
+    if (l->nodes)
+        memcpy(nodes, l->nodes, l->index->count * sizeof(face_id_node *));
+    dl_lib_free(l->nodes);
+    l->nodes = nodes;
+    return DL_SUCCESS;
+}
+
+static int face_id_name_index_add(face_id_name_list *l, face_id_node *node)
+{
+    if (l->index->count == l->index->capacity)
+    {
+        int capacity = l->index->capacity ? l->index->capacity * 2 : 16;
+        if (DL_SUCCESS != face_id_name_index_reserve(l, capacity))
+            return -1;
+    }
+
+    int row = face_id_index_add(l->index, node->id_vec->item, 0);
+    l->nodes[row] = node;
+    return row;
+}
+
+dl_error_type face_id_init(face_id_list *l, int size, uint8_t confirm_times)
+{
+    return face_id_init_with_type(l, size, confirm_times, FACE_ID_INDEX_F32);
+}
+
+dl_error_type face_id_init_with_type(face_id_list *l, int size, uint8_t confirm_times, face_id_index_type type)
 {
     l->head = 0;
     l->tail = 0;
@@ -20,14 +63,62 @@ void face_id_init(face_id_list *l, uint8_t size, uint8_t confirm_times)
     l->size = size;
     l->confirm_times = confirm_times;
     l->id_list = (dl_matrix3d_t **)dl_lib_calloc(size, sizeof(dl_matrix3d_t *), 0);
+    l->index = face_id_index_create(FACE_ID_SIZE, size, type);
+    if (NULL == l->id_list || NULL == l->index)
+    {
+        ESP_LOGE(TAG, "Face id list alloc failed");
+        face_id_free(l);
+        return DL_FAIL;
+    }
+    return DL_SUCCESS;
+}
+
+void face_id_free(face_id_list *l)
+{
+    if (l->id_list)
+    {
+        for (int i = 0; i < l->size; i++)
+            dl_matrix3d_free(l->id_list[i]);
+        dl_lib_free(l->id_list);
+    }
+    face_id_index_free(l->index);
+    l->id_list = NULL;
+    l->index = NULL;
+    l->head = 0;
+    l->tail = 0;
+    l->count = 0;
+}
+
+dl_error_type face_id_name_init(face_id_name_list *l, int size, uint8_t confirm_times)
+{
+    return face_id_name_init_with_type(l, size, confirm_times, FACE_ID_INDEX_F32);
 }
 
-void face_id_name_init(face_id_name_list *l, uint8_t size, uint8_t confirm_times)
+dl_error_type face_id_name_init_with_type(face_id_name_list *l, int size, uint8_t confirm_times, face_id_index_type type)
 {
     l->head = NULL;
     l->tail = NULL;
     l->count = 0;
     l->confirm_times = confirm_times;
+    l->index = face_id_index_create(FACE_ID_SIZE, 0, type);
+    l->nodes = NULL;
+    if (NULL == l->index || DL_SUCCESS != face_id_name_index_reserve(l, size))
+    {
+        ESP_LOGE(TAG, "Face id list alloc failed");
+        face_id_name_free(l);
+        return DL_FAIL;
+    }
+    return DL_SUCCESS;
+}
+
+void face_id_name_free(face_id_name_list *l)
+{
+    if (l->index)
+        delete_face_all_with_name(l);
+    face_id_index_free(l->index);
+    dl_lib_free(l->nodes);
+    l->index = NULL;
+    l->nodes = NULL;
 }
 
 void l2_norm(dl_matrix3d_t *feature)
@@ -37,31 +128,35 @@ void l2_norm(dl_matrix3d_t *feature)
     for(int i=0;i<len;i++){
         norm += (feature->item[i] * feature->item[i]);
     }
+    // an all-zero feature has no direction, keep it zero instead of NaN
+    if(0 == norm)
+        return;
     norm = sqrt(norm);
     for(int i=0;i<len;i++){
         feature->item[i] /= norm;
     }
 }
 
-dl_matrix3dq_t *transform_frmn_input(dl_matrix3du_t *image)
+/*
+ * (pixel - 127.5) * 0.0078125 at exponent FRMN_INPUT_EXPONENT (-10) is exactly 8 * pixel - 1020,
+ * so the input is quantized without going through floats.
+ */
+static void transform_frmn_input_item(qtp_t *dst, uc_t *src, int count)
 {
-    dl_matrix3d_t *image_3d = dl_matrix3d_alloc(image->n,
-                                                image->w,
-                                                image->h,
-                                                image->c);
+    for (int i = 0; i < count; i++)
+        dst[i] = ((qtp_t)src[i] << 3) - 1020;
+}
 
-    fptp_t r = 0;
-    fptp_t *a = image_3d->item;
-    uc_t *b = image->item;
-    uint32_t count = (image->n) * (image->w) * (image->h) * (image->c);
-    for (uint32_t i = 0; i < count; i++)
-    {
-        r = *b++;
-        r = (r - 127.5) * (0.0078125);
-        *a++ = r;
-    }
-    dl_matrix3dq_t *image_3dq = dl_matrixq_from_matrix3d_qmf(image_3d, -10);
-    dl_matrix3d_free(image_3d);
+dl_matrix3dq_t *transform_frmn_input(dl_matrix3du_t *image)
+{
+    dl_matrix3dq_t *image_3dq = dl_matrix3dq_alloc_uninit(image->n,
+                                                   image->w,
+                                                   image->h,
+                                                   image->c,
+                                                   FRMN_INPUT_EXPONENT);
+    if (NULL == image_3dq)
+        return NULL;
+    transform_frmn_input_item(image_3dq->item, image->item, image->n * image->w * image->h * image->c);
     return image_3dq;
 }
 
@@ -191,20 +286,17 @@ int8_t align_face_sim(box_array_t *onet_boxes,
     src_ldk_x[4] = onet_boxes->landmark[0].landmark_p[RIGHT_MOUTH_X];
     src_ldk_y[4] = onet_boxes->landmark[0].landmark_p[RIGHT_MOUTH_Y];
 
-    Matrix *M = get_similarity_matrix(src_ldk_x,src_ldk_y,dst_ldk_x,dst_ldk_y, 5);
-    if(M == NULL){
+    image_affine_t M;
+    if(image_similarity_transform(&M, src_ldk_x, src_ldk_y, dst_ldk_x, dst_ldk_y, 5) < 0){
         return ESP_FAIL;
     }
-    warp_affine(src,dest,M);
-    matrix_free(M);
+    image_warp_affine(src, dest, &M);
 
     return ESP_OK;
 }
 
-dl_matrix3d_t *get_face_id(dl_matrix3du_t *aligned_face)
+static dl_matrix3dq_t *face_id_forward(dl_matrix3dq_t *mobileface_in)
 {
-    dl_matrix3d_t *face_id = NULL;
-    dl_matrix3dq_t *mobileface_in = transform_frmn_input(aligned_face);
 #if CONFIG_XTENSA_IMPL
     #if CONFIG_FRMN
         dl_matrix3dq_t *face_id_q = frmn_q(mobileface_in, DL_XTENSA_IMPL);
@@ -230,12 +322,80 @@ dl_matrix3d_t *get_face_id(dl_matrix3du_t *aligned_face)
         dl_matrix3dq_t *face_id_q = mfn56_156m_q(mobileface_in, DL_C_IMPL);
     #endif
 #endif
+    return face_id_q;
+}
+
+dl_matrix3d_t *get_face_id(dl_matrix3du_t *aligned_face)
+{
+    dl_matrix3d_t *face_id = NULL;
+    dl_matrix3dq_t *mobileface_in = transform_frmn_input(aligned_face);
+    if (NULL == mobileface_in)
+        return NULL;
+    dl_matrix3dq_t *face_id_q = face_id_forward(mobileface_in);
+    if (NULL == face_id_q)
+        return NULL;
     face_id = dl_matrix3d_from_matrixq(face_id_q);
-    l2_norm(face_id);
     dl_matrix3dq_free(face_id_q);
+    if (NULL == face_id)
+        return NULL;
+    l2_norm(face_id);
     return face_id;
 }
 
+dl_matrix3du_t *aligned_faces_alloc(int n)
+{
+    return dl_matrix3du_alloc(n,
+                              FACE_WIDTH,
+                              FACE_HEIGHT,
+                              3);
+}
+
+dl_matrix3d_t *get_face_ids(dl_matrix3du_t *aligned_faces)
+{
+    int n = aligned_faces->n;
+    int face_size = aligned_faces->w * aligned_faces->h * aligned_faces->c;
+    dl_matrix3d_t *face_ids = dl_matrix3d_alloc_uninit(n, 1, 1, FACE_ID_SIZE);
+    if (NULL == face_ids)
+        return NULL;
+
+    for (int i = 0; i < n; i++)
+    {
+        // The recognition model consumes its input, so every face gets its own.
+        dl_matrix3dq_t *mobileface_in = dl_matrix3dq_alloc_uninit(1,
+                                                           aligned_faces->w,
+                                                           aligned_faces->h,
+                                                           aligned_faces->c,
+                                                           FRMN_INPUT_EXPONENT);
+        if (NULL == mobileface_in)
+        {
+            dl_matrix3d_free(face_ids);
+            return NULL;
+        }
+        transform_frmn_input_item(mobileface_in->item, aligned_faces->item + i * face_size, face_size);
+
+        dl_matrix3dq_t *face_id_q = face_id_forward(mobileface_in);
+        if (NULL == face_id_q)
+        {
+            dl_matrix3d_free(face_ids);
+            return NULL;
+        }
+        fptp_t *face_id = face_ids->item + i * FACE_ID_SIZE;
+        fptp_t norm = 0;
+        for (int j = 0; j < FACE_ID_SIZE; j++)
+        {
+            face_id[j] = ldexpf(face_id_q->item[j], face_id_q->exponent);
+            norm += face_id[j] * face_id[j];
+        }
+        dl_matrix3dq_free(face_id_q);
+        if (0 == norm)
+            continue;
+        norm = sqrt(norm);
+        for (int j = 0; j < FACE_ID_SIZE; j++)
+            face_id[j] /= norm;
+    }
+    return face_ids;
+}
+
 fptp_t cos_distance(dl_matrix3d_t *id_1,
                     dl_matrix3d_t *id_2)
 {
@@ -315,35 +475,23 @@ void devide_face_id(dl_matrix3d_t *id, uint8_t num)
     }
 }
 
-int8_t recognize_face(face_id_list *l,
-                      dl_matrix3du_t *algined_face)
+int recognize_face(face_id_list *l,
+                   dl_matrix3du_t *algined_face)
 {
-    fptp_t similarity = 0;
-    fptp_t max_similarity = -1;
-    int8_t matched_id = -1;
+    face_id_match_t match = {-1, -1, -1};
+    int matched_id = -1;
     dl_matrix3d_t *face_id = NULL;
 
     face_id = get_face_id(algined_face);
+    if (NULL == face_id)
+        return -1;
 
-    for (uint16_t i = 0; i < l->count; i++)
-    {
-        uint8_t head = (l->head + i) % l->size;
-        similarity = cos_distance_unit_id(l->id_list[head], face_id);
-
-        if (similarity > max_similarity)
-        {
-            max_similarity = similarity;
-            matched_id = head;
-        }
-    }
+    if (face_id_index_search(l->index, face_id->item, 1, &match) && match.similarity >= FACE_REC_THRESHOLD)
+        matched_id = match.label;
 
-    if (max_similarity < FACE_REC_THRESHOLD)
-    {
-        matched_id = -1;
-    }
     dl_matrix3d_free(face_id);
 
-    ESP_LOGI(TAG, "\nSimilarity: %.6f, id: %d", max_similarity, matched_id);
+    ESP_LOGI(TAG, "\nSimilarity: %.6f, id: %d", match.similarity, matched_id);
 
     return matched_id;
 }
@@ -354,9 +502,22 @@ int8_t enroll_face(face_id_list *l, dl_matrix3du_t *aligned_face)
 
     // add new_id to dest_id
     dl_matrix3d_t *new_id = get_face_id(aligned_face);
+    if (NULL == new_id)
+        return -1;
 
-    if ((l->count < l->size) && (confirm_counter == 0))
-        l->id_list[l->tail] = dl_matrix3d_alloc(1, 1, 1, FACE_ID_SIZE);
+    if (confirm_counter == 0)
+    {
+        // A full list overwrites its oldest id
+        if (NULL == l->id_list[l->tail])
+            l->id_list[l->tail] = dl_matrix3d_alloc(1, 1, 1, FACE_ID_SIZE);
+        else
+            bzero(l->id_list[l->tail]->item, FACE_ID_SIZE * sizeof(fptp_t));
+        if (NULL == l->id_list[l->tail])
+        {
+            dl_matrix3d_free(new_id);
+            return -1;
+        }
+    }
 
     add_face_id(l->id_list[l->tail], new_id);
     dl_matrix3d_free(new_id);
@@ -368,6 +529,14 @@ int8_t enroll_face(face_id_list *l, dl_matrix3du_t *aligned_face)
         devide_face_id(l->id_list[l->tail], l->confirm_times);
         confirm_counter = 0;
 
+        int row = face_id_index_find(l->index, l->tail);
+        if (row < 0)
+            row = face_id_index_add(l->index, l->id_list[l->tail]->item, l->tail);
+        else
+            face_id_index_set(l->index, row, l->id_list[l->tail]->item);
+        if (row < 0)
+            ESP_LOGE(TAG, "Face id index alloc failed, id %d can not be recognized", l->tail);
+
         l->tail = (l->tail + 1) % l->size;
         l->count++;
         // Overlap head
@@ -383,13 +552,20 @@ int8_t enroll_face(face_id_list *l, dl_matrix3du_t *aligned_face)
     return l->confirm_times - confirm_counter;
 }
 
-uint8_t delete_face(face_id_list *l)
+int delete_face(face_id_list *l)
 {
     if (l->count == 0)
         return 0;
 
     if (l->id_list[l->head])
+    {
         dl_matrix3d_free(l->id_list[l->head]);
+        l->id_list[l->head] = NULL;
+    }
+
+    int row = face_id_index_find(l->index, l->head);
+    if (row >= 0)
+        face_id_index_remove(l->index, row);
 
     l->head = (l->head + 1) % l->size;
     l->count--;
@@ -401,35 +577,41 @@ uint8_t delete_face(face_id_list *l)
     return l->count;
 }
 
+dl_error_type face_id_list_reindex(face_id_list *l)
+{
+    face_id_index_clear(l->index);
+    for (int i = 0; i < l->count; i++)
+    {
+        int id = (l->head + i) % l->size;
+        if (face_id_index_add(l->index, l->id_list[id]->item, id) < 0)
+            return DL_FAIL;
+    }
+    return DL_SUCCESS;
+}
+
 face_id_node *recognize_face_with_name(face_id_name_list *l,
                                        dl_matrix3d_t *face_id)
 {
-    fptp_t similarity = 0;
-    fptp_t max_similarity = -1;
+    face_id_match_t match;
 
-    face_id_node *head = l->head;
+    if (0 == face_id_index_search(l->index, face_id->item, 1, &match) || match.similarity < FACE_REC_THRESHOLD)
+        return NULL;
 
-    for (face_id_node *p = head; p != NULL; p = p->next)
-    {
-        similarity = cos_distance_unit_id(p->id_vec, face_id);
+    face_id_node *head = l->nodes[match.row];
+    ESP_LOGI(TAG, "\nSimilarity: %.6f, name: %s", match.similarity, head->id_name);
 
-        if (similarity > max_similarity)
-        {
-            max_similarity = similarity;
-            head = p;
-        }
-    }
+    return head;
+}
 
-    if (max_similarity < FACE_REC_THRESHOLD)
-    {
-        head = NULL;
-    }
-    else
+dl_error_type face_id_name_list_reindex(face_id_name_list *l)
+{
+    face_id_index_clear(l->index);
+    for (face_id_node *p = l->head; p != NULL; p = p->next)
     {
-        ESP_LOGI(TAG, "\nSimilarity: %.6f, name: %s", max_similarity, head->id_name);
+        if (face_id_name_index_add(l, p) < 0)
+            return DL_FAIL;
     }
-
-    return head;
+    return DL_SUCCESS;
 }
 
 int8_t enroll_face_with_name(face_id_name_list *l,
@@ -468,23 +650,36 @@ int8_t enroll_face_with_name(face_id_name_list *l,
         l->tail->next = NULL;
         l->count++;
 
+        if (face_id_name_index_add(l, new_tail) < 0)
+            ESP_LOGE(TAG, "Face id index alloc failed, %s can not be recognized", new_tail->id_name);
+
         return 0;
     }
 
     return l->confirm_times - confirm_counter;
 }
 
-int8_t delete_face_with_name(face_id_name_list *l, char *name)
+int delete_face_with_name(face_id_name_list *l, char *name)
 {
     if (l->count == 0)
         return -1;
 
     face_id_node *p = l->head;
     face_id_node *q = p;
-    for (int8_t i = 0; i < l->count; i++)
+    for (int i = 0; i < l->count; i++)
     {
         if (strcmp(q->id_name, name) == 0)
         {
+            for (int row = 0; row < l->index->count; row++)
+            {
+                if (l->nodes[row] == q)
+                {
+                    l->nodes[row] = l->nodes[l->index->count - 1];
+                    face_id_index_remove(l->index, row);
+                    break;
+                }
+            }
+
             dl_matrix3d_free(q->id_vec);
             p->next = q->next;
             if (q == l->head)
@@ -517,7 +712,7 @@ void delete_face_all_with_name(face_id_name_list *l)
         return;
 
     face_id_node *p = l->head;
-    for (int8_t i = 0; i < l->count; i++)
+    for (int i = 0; i < l->count; i++)
     {
         dl_matrix3d_free(p->id_vec);
         l->head = p->next;
@@ -526,4 +721,5 @@ void delete_face_all_with_name(face_id_name_list *l)
     }
     l->count = 0;
     l->tail = NULL;
+    face_id_index_clear(l->index);
 }
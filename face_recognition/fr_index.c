@@ -0,0 +1,575 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fr_index.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FR_INDEX_AVX2 1
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FR_INDEX_NEON 1
+#endif
+
+/*
+ * Row scorers. A query is scored against one row at a time, the rows are
+ * contiguous so the scan streams through the matrix.
+ */
+typedef struct
+{
+    fptp_t (*dot_f32)(const fptp_t *row, const fptp_t *q, int n);
+    fptp_t (*dot_f16)(const uint16_t *row, const fptp_t *q, int n);
+    int32_t (*dot_q8)(const int8_t *row, const int8_t *q, int n);
+} face_id_index_kernels_t;
+
+/*
+ * Half precision conversion. Face ids are unit vectors, values below the
+ * smallest normal half (6.1e-5) are flushed to zero.
+ */
+static uint16_t fp32_to_fp16(fptp_t value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = (bits >> 16) & 0x8000;
+    int exp = (int)((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mant = bits & 0x7fffff;
+
+    if (exp <= 0)
+        return sign;
+    if (exp >= 31)
+        return sign | 0x7c00;
+
+    // round to nearest even
+    uint32_t half = ((uint32_t)exp << 10) | (mant >> 13);
+    uint32_t rest = mant & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+        half++;
+    return sign | (uint16_t)half;
+}
+
+static fptp_t fp16_to_fp32(uint16_t value)
+{
+    uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+    uint32_t exp = (value >> 10) & 0x1f;
+    uint32_t mant = value & 0x3ff;
+    uint32_t bits;
+
+    if (0 == exp)
+        bits = sign;
+    else if (31 == exp)
+        bits = sign | 0x7f800000 | (mant << 13);
+    else
+        bits = sign | ((exp - 15 + 127) << 23) | (mant << 13);
+
+    fptp_t f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static fptp_t dot_f32_c(const fptp_t *row, const fptp_t *q, int n)
+{
+    fptp_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s0 += row[i] * q[i];
+        s1 += row[i + 1] * q[i + 1];
+        s2 += row[i + 2] * q[i + 2];
+        s3 += row[i + 3] * q[i + 3];
+    }
+    for (; i < n; i++)
+        s0 += row[i] * q[i];
+    return (s0 + s1) + (s2 + s3);
+}
+
+static fptp_t dot_f16_c(const uint16_t *row, const fptp_t *q, int n)
+{
+    fptp_t sum = 0;
+    for (int i = 0; i < n; i++)
+        sum += fp16_to_fp32(row[i]) * q[i];
+    return sum;
+}
+
+static int32_t dot_q8_c(const int8_t *row, const int8_t *q, int n)
+{
+    int32_t sum = 0;
+    for (int i = 0; i < n; i++)
+        sum += (int16_t)row[i] * q[i];
+    return sum;
+}
+
+#if FR_INDEX_AVX2
+__attribute__((target("avx2,fma"))) static fptp_t dot_f32_avx2(const fptp_t *row, const fptp_t *q, int n)
+{
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        acc0 = _mm256_fmadd_ps(_mm256_load_ps(row + i), _mm256_loadu_ps(q + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_load_ps(row + i + 8), _mm256_loadu_ps(q + i + 8), acc1);
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, _mm256_add_ps(acc0, acc1));
+    fptp_t sum = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < n; i++)
+        sum += row[i] * q[i];
+    return sum;
+}
+
+__attribute__((target("avx2,fma,f16c"))) static fptp_t dot_f16_avx2(const uint16_t *row, const fptp_t *q, int n)
+{
+    __m256 acc = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 r = _mm256_cvtph_ps(_mm_load_si128((const __m128i *)(row + i)));
+        acc = _mm256_fmadd_ps(r, _mm256_loadu_ps(q + i), acc);
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc);
+    fptp_t sum = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < n; i++)
+        sum += fp16_to_fp32(row[i]) * q[i];
+    return sum;
+}
+
+/*
+ * int8 values are in [-127, 127], a madd pair is at most 32258 and a 512 long
+ * face id sums to less than 2^23, the 32-bit lanes cannot overflow.
+ */
+__attribute__((target("avx2"))) static int32_t dot_q8_avx2(const int8_t *row, const int8_t *q, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m256i r = _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(row + i)));
+        __m256i v = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(q + i)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(r, v));
+    }
+
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int32_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    for (; i < n; i++)
+        sum += (int16_t)row[i] * q[i];
+    return sum;
+}
+#endif
+
+#if FR_INDEX_NEON
+static fptp_t dot_f32_neon(const fptp_t *row, const fptp_t *q, int n)
+{
+    float32x4_t acc0 = vdupq_n_f32(0);
+    float32x4_t acc1 = vdupq_n_f32(0);
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(row + i), vld1q_f32(q + i));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(row + i + 4), vld1q_f32(q + i + 4));
+    }
+
+    fptp_t sum = vaddvq_f32(vaddq_f32(acc0, acc1));
+    for (; i < n; i++)
+        sum += row[i] * q[i];
+    return sum;
+}
+
+static fptp_t dot_f16_neon(const uint16_t *row, const fptp_t *q, int n)
+{
+    float32x4_t acc = vdupq_n_f32(0);
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4_t r = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(row + i)));
+        acc = vfmaq_f32(acc, r, vld1q_f32(q + i));
+    }
+
+    fptp_t sum = vaddvq_f32(acc);
+    for (; i < n; i++)
+        sum += fp16_to_fp32(row[i]) * q[i];
+    return sum;
+}
+
+static int32_t dot_q8_neon(const int8_t *row, const int8_t *q, int n)
+{
+    int32x4_t acc = vdupq_n_s32(0);
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        int8x16_t r = vld1q_s8(row + i);
+        int8x16_t v = vld1q_s8(q + i);
+        acc = vpadalq_s16(acc, vmull_s8(vget_low_s8(r), vget_low_s8(v)));
+        acc = vpadalq_s16(acc, vmull_high_s8(r, v));
+    }
+
+    int32_t sum = vaddvq_s32(acc);
+    for (; i < n; i++)
+        sum += (int16_t)row[i] * q[i];
+    return sum;
+}
+#endif
+
+static const face_id_index_kernels_t face_id_index_kernels_c = {dot_f32_c, dot_f16_c, dot_q8_c};
+#if FR_INDEX_AVX2
+static const face_id_index_kernels_t face_id_index_kernels_avx2 = {dot_f32_avx2, dot_f16_avx2, dot_q8_avx2};
+#endif
+#if FR_INDEX_NEON
+static const face_id_index_kernels_t face_id_index_kernels_neon = {dot_f32_neon, dot_f16_neon, dot_q8_neon};
+#endif
+
+static const face_id_index_kernels_t *face_id_index_kernels(void)
+{
+    // Selection is idempotent, a race between threads only repeats it.
+    static const face_id_index_kernels_t *selected = NULL;
+    if (selected)
+        return selected;
+
+    selected = &face_id_index_kernels_c;
+#if FR_INDEX_AVX2
+    __builtin_cpu_init();
+    if (!getenv("ESP_FACE_HOST_NO_SIMD") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c"))
+        selected = &face_id_index_kernels_avx2;
+#endif
+#if FR_INDEX_NEON
+    if (!getenv("ESP_FACE_HOST_NO_SIMD"))
+        selected = &face_id_index_kernels_neon;
+#endif
+    return selected;
+}
+
+/*
+ * Symmetric int8 quantization, one scale per vector.
+ */
+static fptp_t quantize_q8(int8_t *dst, const fptp_t *src, int n)
+{
+    fptp_t max_abs = 0;
+    for (int i = 0; i < n; i++)
+    {
+        fptp_t a = fabsf(src[i]);
+        if (a > max_abs)
+            max_abs = a;
+    }
+    if (max_abs == 0)
+    {
+        memset(dst, 0, n);
+        return 0;
+    }
+
+    fptp_t scale = max_abs / 127;
+    fptp_t inv = 127 / max_abs;
+    for (int i = 0; i < n; i++)
+    {
+        int v = (int)lrintf(src[i] * inv);
+        dst[i] = (int8_t)(v > 127 ? 127 : (v < -127 ? -127 : v));
+    }
+    return scale;
+}
+
+static int face_id_index_item_size(face_id_index_type type)
+{
+    switch (type)
+    {
+    case FACE_ID_INDEX_F16:
+        return sizeof(uint16_t);
+    case FACE_ID_INDEX_Q8:
+        return sizeof(int8_t);
+    default:
+        return sizeof(fptp_t);
+    }
+}
+
+face_id_index_t *face_id_index_create(int dim, int capacity, face_id_index_type type)
+{
+    face_id_index_t *index = (face_id_index_t *)dl_lib_calloc(1, sizeof(face_id_index_t), 0);
+    if (NULL == index)
+        return NULL;
+
+    index->type = type;
+    index->dim = dim;
+    index->stride = (dim * face_id_index_item_size(type) + FACE_ID_INDEX_ALIGN - 1) & -FACE_ID_INDEX_ALIGN;
+
+    if (capacity > 0 && DL_SUCCESS != face_id_index_reserve(index, capacity))
+    {
+        dl_lib_free(index);
+        return NULL;
+    }
+    return index;
+}
+
+void face_id_index_free(face_id_index_t *index)
+{
+    if (NULL == index)
+        return;
+    dl_lib_free(index->data);
+    dl_lib_free(index->scale);
+    dl_lib_free(index->label);
+    dl_lib_free(index);
+}
+
+dl_error_type face_id_index_reserve(face_id_index_t *index, int capacity)
+{
+    if (capacity <= index->capacity)
+        return DL_SUCCESS;
+
+    uint8_t *data = (uint8_t *)dl_lib_malloc(capacity, index->stride, FACE_ID_INDEX_ALIGN);
+    int32_t *label = (int32_t *)dl_lib_malloc(capacity, sizeof(int32_t), 0);
+    fptp_t *scale = NULL;
+    if (FACE_ID_INDEX_Q8 == index->type)
+        scale = (fptp_t *)dl_lib_malloc(capacity, sizeof(fptp_t), 0);
+
+    if (NULL == data || NULL == label || (FACE_ID_INDEX_Q8 == index->type && NULL == scale))
+    {
+        dl_lib_free(data);
+        dl_lib_free(label);
+        dl_lib_free(scale);
+        return DL_FAIL;
+    }
+
+    if (index->count)
+    {
+        memcpy(data, index->data, (size_t)index->count * index->stride);
+        memcpy(label, index->label, index->count * sizeof(int32_t));
+        if (scale)
+            memcpy(scale, index->scale, index->count * sizeof(fptp_t));
+    }
+    dl_lib_free(index->data);
+    dl_lib_free(index->label);
+    dl_lib_free(index->scale);
+
+    index->data = data;
+    index->label = label;
+    index->scale = scale;
+    index->capacity = capacity;
+    return DL_SUCCESS;
+}
+
+void face_id_index_set(face_id_index_t *index, int row, const fptp_t *face_id)
+{
+    uint8_t *dst = index->data + (size_t)row * index->stride;
+    switch (index->type)
+    {
+    case FACE_ID_INDEX_F16:
+        for (int i = 0; i < index->dim; i++)
+            ((uint16_t *)dst)[i] = fp32_to_fp16(face_id[i]);
+        break;
+    case FACE_ID_INDEX_Q8:
+        index->scale[row] = quantize_q8((int8_t *)dst, face_id, index->dim);
+        break;
+    default:
+        memcpy(dst, face_id, index->dim * sizeof(fptp_t));
+        break;
+    }
+}
+
+void face_id_index_get(face_id_index_t *index, int row, fptp_t *face_id)
+{
+    const uint8_t *src = index->data + (size_t)row * index->stride;
+    switch (index->type)
+    {
+    case FACE_ID_INDEX_F16:
+        for (int i = 0; i < index->dim; i++)
+            face_id[i] = fp16_to_fp32(((const uint16_t *)src)[i]);
+        break;
+    case FACE_ID_INDEX_Q8:
+        for (int i = 0; i < index->dim; i++)
+            face_id[i] = ((const int8_t *)src)[i] * index->scale[row];
+        break;
+    default:
+        memcpy(face_id, src, index->dim * sizeof(fptp_t));
+        break;
+    }
+}
+
+int face_id_index_add(face_id_index_t *index, const fptp_t *face_id, int32_t label)
+{
+    if (index->count == index->capacity)
+    {
+        int capacity = index->capacity ? index->capacity * 2 : 16;
+        if (DL_SUCCESS != face_id_index_reserve(index, capacity))
+            return -1;
+    }
+
+    int row = index->count++;
+    index->label[row] = label;
+    face_id_index_set(index, row, face_id);
+    return row;
+}
+
+int face_id_index_remove(face_id_index_t *index, int row)
+{
+    int last = --index->count;
+    if (row == last)
+        return -1;
+
+    memcpy(index->data + (size_t)row * index->stride, index->data + (size_t)last * index->stride, index->stride);
+    index->label[row] = index->label[last];
+    if (index->scale)
+        index->scale[row] = index->scale[last];
+    return row;
+}
+
+int face_id_index_find(face_id_index_t *index, int32_t label)
+{
+    for (int i = 0; i < index->count; i++)
+    {
+        if (index->label[i] == label)
+            return i;
+    }
+    return -1;
+}
+
+void face_id_index_clear(face_id_index_t *index)
+{
+    index->count = 0;
+}
+
+static void face_id_index_keep(face_id_match_t *matches, int *found, int k, int32_t label, int row, fptp_t similarity)
+{
+    int i = *found;
+    if (i == k)
+    {
+        if (similarity <= matches[k - 1].similarity)
+            return;
+        i--;
+    }
+    else
+    {
+        (*found)++;
+    }
+
+    for (; i > 0 && matches[i - 1].similarity < similarity; i--)
+        matches[i] = matches[i - 1];
+    matches[i].label = label;
+    matches[i].row = row;
+    matches[i].similarity = similarity;
+}
+
+int face_id_index_search(face_id_index_t *index, const fptp_t *face_id, int k, face_id_match_t *matches)
+{
+    if (k <= 0 || 0 == index->count)
+        return 0;
+
+    const face_id_index_kernels_t *kernels = face_id_index_kernels();
+    const uint8_t *row = index->data;
+    int found = 0;
+
+    switch (index->type)
+    {
+    case FACE_ID_INDEX_F16:
+        for (int i = 0; i < index->count; i++, row += index->stride)
+            face_id_index_keep(matches, &found, k, index->label[i], i, kernels->dot_f16((const uint16_t *)row, face_id, index->dim));
+        break;
+    case FACE_ID_INDEX_Q8:
+    {
+        int8_t *query = (int8_t *)dl_lib_malloc(index->dim, sizeof(int8_t), FACE_ID_INDEX_ALIGN);
+        if (NULL == query)
+            return 0;
+        fptp_t query_scale = quantize_q8(query, face_id, index->dim);
+        for (int i = 0; i < index->count; i++, row += index->stride)
+        {
+            int32_t dot = kernels->dot_q8((const int8_t *)row, query, index->dim);
+            face_id_index_keep(matches, &found, k, index->label[i], i, dot * query_scale * index->scale[i]);
+        }
+        dl_lib_free(query);
+        break;
+    }
+    default:
+        for (int i = 0; i < index->count; i++, row += index->stride)
+            face_id_index_keep(matches, &found, k, index->label[i], i, kernels->dot_f32((const fptp_t *)row, face_id, index->dim));
+        break;
+    }
+    return found;
+}
+
+#define FACE_ID_INDEX_MAGIC 0x58444946 /* "FIDX" */
+
+dl_error_type face_id_index_save(face_id_index_t *index, FILE *f)
+{
+    int32_t header[4] = {FACE_ID_INDEX_MAGIC, index->type, index->dim, index->count};
+    int row_size = index->dim * face_id_index_item_size(index->type);
+
+    if (1 != fwrite(header, sizeof(header), 1, f))
+        return DL_FAIL;
+    for (int i = 0; i < index->count; i++)
+    {
+        if (1 != fwrite(index->data + (size_t)i * index->stride, row_size, 1, f))
+            return DL_FAIL;
+    }
+    if (index->count)
+    {
+        if (1 != fwrite(index->label, index->count * sizeof(int32_t), 1, f))
+            return DL_FAIL;
+        if (index->scale && 1 != fwrite(index->scale, index->count * sizeof(fptp_t), 1, f))
+            return DL_FAIL;
+    }
+    return DL_SUCCESS;
+}
+
+static dl_error_type face_id_index_read_rows(face_id_index_t *index, int count, FILE *f)
+{
+    int row_size = index->dim * face_id_index_item_size(index->type);
+    for (int i = 0; i < count; i++)
+    {
+        if (1 != fread(index->data + (size_t)i * index->stride, row_size, 1, f))
+            return DL_FAIL;
+    }
+    if (count)
+    {
+        if (1 != fread(index->label, count * sizeof(int32_t), 1, f))
+            return DL_FAIL;
+        if (index->scale && 1 != fread(index->scale, count * sizeof(fptp_t), 1, f))
+            return DL_FAIL;
+    }
+    index->count = count;
+    return DL_SUCCESS;
+}
+
+face_id_index_t *face_id_index_load(FILE *f)
+{
+    int32_t header[4];
+    if (1 != fread(header, sizeof(header), 1, f) || FACE_ID_INDEX_MAGIC != header[0])
+        return NULL;
+    if (header[1] < FACE_ID_INDEX_F32 || header[1] > FACE_ID_INDEX_Q8 || header[2] <= 0 || header[3] < 0)
+        return NULL;
+
+    face_id_index_t *index = face_id_index_create(header[2], header[3], (face_id_index_type)header[1]);
+    if (NULL == index)
+        return NULL;
+
+    if (DL_SUCCESS != face_id_index_read_rows(index, header[3], f))
+    {
+        face_id_index_free(index);
+        return NULL;
+    }
+    return index;
+}
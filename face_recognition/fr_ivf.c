@@ -0,0 +1,389 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fr_ivf.h"
+
+#define FACE_ID_IVF_MAGIC 0x46564946 /* "FIVF" */
+
+static void face_id_ivf_normalize(fptp_t *v, int n)
+{
+    fptp_t norm = 0;
+    for (int i = 0; i < n; i++)
+        norm += v[i] * v[i];
+    if (norm <= 0)
+        return;
+    norm = 1 / sqrtf(norm);
+    for (int i = 0; i < n; i++)
+        v[i] *= norm;
+}
+
+static int face_id_ivf_cluster(face_id_ivf_t *ivf, const fptp_t *face_id)
+{
+    face_id_match_t match;
+    if (0 == face_id_index_search(ivf->centroids, face_id, 1, &match))
+        return -1;
+    return match.label;
+}
+
+static void face_id_ivf_free_lists(face_id_index_t **lists, int nlist)
+{
+    if (NULL == lists)
+        return;
+    for (int i = 0; i < nlist; i++)
+        face_id_index_free(lists[i]);
+    dl_lib_free(lists);
+}
+
+static face_id_index_t **face_id_ivf_alloc_lists(int dim, int nlist, face_id_index_type type)
+{
+    face_id_index_t **lists = (face_id_index_t **)dl_lib_calloc(nlist, sizeof(face_id_index_t *), 0);
+    if (NULL == lists)
+        return NULL;
+    for (int i = 0; i < nlist; i++)
+    {
+        lists[i] = face_id_index_create(dim, 0, type);
+        if (NULL == lists[i])
+        {
+            face_id_ivf_free_lists(lists, nlist);
+            return NULL;
+        }
+    }
+    return lists;
+}
+
+face_id_ivf_t *face_id_ivf_create(int dim, int nlist, face_id_index_type type)
+{
+    if (dim <= 0 || nlist <= 0)
+        return NULL;
+
+    face_id_ivf_t *ivf = (face_id_ivf_t *)dl_lib_calloc(1, sizeof(face_id_ivf_t), 0);
+    if (NULL == ivf)
+        return NULL;
+
+    ivf->dim = dim;
+    ivf->nlist = nlist;
+    ivf->nprobe = FACE_ID_IVF_NPROBE < nlist ? FACE_ID_IVF_NPROBE : nlist;
+    ivf->type = type;
+    ivf->centroids = face_id_index_create(dim, nlist, FACE_ID_INDEX_F32);
+    ivf->lists = face_id_ivf_alloc_lists(dim, nlist, type);
+    if (NULL == ivf->centroids || NULL == ivf->lists)
+    {
+        face_id_ivf_free(ivf);
+        return NULL;
+    }
+    return ivf;
+}
+
+void face_id_ivf_free(face_id_ivf_t *ivf)
+{
+    if (NULL == ivf)
+        return;
+    face_id_index_free(ivf->centroids);
+    face_id_ivf_free_lists(ivf->lists, ivf->nlist);
+    dl_lib_free(ivf);
+}
+
+/*
+ * Move the face ids of the old clusters to the clusters of the new centroids.
+ */
+static dl_error_type face_id_ivf_reassign(face_id_ivf_t *ivf)
+{
+    face_id_index_t **old_lists = ivf->lists;
+    face_id_index_t **lists = face_id_ivf_alloc_lists(ivf->dim, ivf->nlist, ivf->type);
+    fptp_t *face_id = (fptp_t *)dl_lib_malloc(ivf->dim, sizeof(fptp_t), FACE_ID_INDEX_ALIGN);
+    if (NULL == lists || NULL == face_id)
+    {
+        face_id_ivf_free_lists(lists, ivf->nlist);
+        dl_lib_free(face_id);
+        return DL_FAIL;
+    }
+
+    ivf->lists = lists;
+    dl_error_type ret = DL_SUCCESS;
+    for (int c = 0; c < ivf->nlist && DL_SUCCESS == ret; c++)
+    {
+        for (int i = 0; i < old_lists[c]->count; i++)
+        {
+            face_id_index_get(old_lists[c], i, face_id);
+            if (face_id_index_add(lists[face_id_ivf_cluster(ivf, face_id)], face_id, old_lists[c]->label[i]) < 0)
+            {
+                ret = DL_FAIL;
+                break;
+            }
+        }
+    }
+
+    if (DL_SUCCESS == ret)
+    {
+        face_id_ivf_free_lists(old_lists, ivf->nlist);
+    }
+    else
+    {
+        ivf->lists = old_lists;
+        face_id_ivf_free_lists(lists, ivf->nlist);
+    }
+    dl_lib_free(face_id);
+    return ret;
+}
+
+dl_error_type face_id_ivf_train(face_id_ivf_t *ivf, const fptp_t *face_ids, int n, int iterations)
+{
+    if (n < ivf->nlist)
+        return DL_FAIL;
+
+    const int dim = ivf->dim;
+    const int nlist = ivf->nlist;
+    fptp_t *sum = (fptp_t *)dl_lib_malloc(nlist * dim, sizeof(fptp_t), FACE_ID_INDEX_ALIGN);
+    int *members = (int *)dl_lib_malloc(nlist, sizeof(int), 0);
+    if (NULL == sum || NULL == members)
+    {
+        dl_lib_free(sum);
+        dl_lib_free(members);
+        return DL_FAIL;
+    }
+
+    // Seed with samples spread over the input
+    face_id_index_clear(ivf->centroids);
+    for (int c = 0; c < nlist; c++)
+    {
+        fptp_t *centroid = sum + c * dim;
+        memcpy(centroid, face_ids + (size_t)((int64_t)c * n / nlist) * dim, dim * sizeof(fptp_t));
+        face_id_ivf_normalize(centroid, dim);
+        face_id_index_add(ivf->centroids, centroid, c);
+    }
+
+    for (int it = 0; it < iterations; it++)
+    {
+        memset(sum, 0, (size_t)nlist * dim * sizeof(fptp_t));
+        memset(members, 0, nlist * sizeof(int));
+
+        for (int i = 0; i < n; i++)
+        {
+            const fptp_t *x = face_ids + (size_t)i * dim;
+            int c = face_id_ivf_cluster(ivf, x);
+            fptp_t *s = sum + c * dim;
+            for (int j = 0; j < dim; j++)
+                s[j] += x[j];
+            members[c]++;
+        }
+
+        for (int c = 0; c < nlist; c++)
+        {
+            fptp_t *centroid = sum + c * dim;
+            if (0 == members[c])
+            {
+                // Reseed an empty cluster with a pseudo random sample
+                int pick = (int)(((uint32_t)c * 2654435761u + (uint32_t)it * 40503u) % (uint32_t)n);
+                memcpy(centroid, face_ids + (size_t)pick * dim, dim * sizeof(fptp_t));
+            }
+            face_id_ivf_normalize(centroid, dim);
+            face_id_index_set(ivf->centroids, c, centroid);
+        }
+    }
+
+    dl_lib_free(sum);
+    dl_lib_free(members);
+
+    if (ivf->count)
+        return face_id_ivf_reassign(ivf);
+    return DL_SUCCESS;
+}
+
+dl_error_type face_id_ivf_build(face_id_ivf_t *ivf, const fptp_t *face_ids, const int32_t *labels, int n)
+{
+    if (n < ivf->nlist)
+        return DL_FAIL;
+
+    // k-means converges on a subset, training on all of a large gallery only costs time
+    int train_n = ivf->nlist * FACE_ID_IVF_TRAIN_PER_LIST;
+    dl_error_type ret;
+    if (train_n >= n)
+    {
+        ret = face_id_ivf_train(ivf, face_ids, n, FACE_ID_IVF_TRAIN_ITERATIONS);
+    }
+    else
+    {
+        fptp_t *train = (fptp_t *)dl_lib_malloc(train_n * ivf->dim, sizeof(fptp_t), FACE_ID_INDEX_ALIGN);
+        if (NULL == train)
+            return DL_FAIL;
+        for (int i = 0; i < train_n; i++)
+            memcpy(train + (size_t)i * ivf->dim, face_ids + (size_t)((int64_t)i * n / train_n) * ivf->dim, ivf->dim * sizeof(fptp_t));
+        ret = face_id_ivf_train(ivf, train, train_n, FACE_ID_IVF_TRAIN_ITERATIONS);
+        dl_lib_free(train);
+    }
+    if (DL_SUCCESS != ret)
+        return ret;
+
+    for (int i = 0; i < n; i++)
+    {
+        if (DL_SUCCESS != face_id_ivf_add(ivf, face_ids + (size_t)i * ivf->dim, labels[i]))
+            return DL_FAIL;
+    }
+    return DL_SUCCESS;
+}
+
+dl_error_type face_id_ivf_add(face_id_ivf_t *ivf, const fptp_t *face_id, int32_t label)
+{
+    int c = face_id_ivf_cluster(ivf, face_id);
+    if (c < 0 || face_id_index_add(ivf->lists[c], face_id, label) < 0)
+        return DL_FAIL;
+    ivf->count++;
+    return DL_SUCCESS;
+}
+
+dl_error_type face_id_ivf_remove(face_id_ivf_t *ivf, int32_t label)
+{
+    for (int c = 0; c < ivf->nlist; c++)
+    {
+        int row = face_id_index_find(ivf->lists[c], label);
+        if (row >= 0)
+        {
+            face_id_index_remove(ivf->lists[c], row);
+            ivf->count--;
+            return DL_SUCCESS;
+        }
+    }
+    return DL_FAIL;
+}
+
+int face_id_ivf_search(face_id_ivf_t *ivf, const fptp_t *face_id, int k, face_id_match_t *matches)
+{
+    if (k <= 0 || 0 == ivf->count)
+        return 0;
+
+    int nprobe = ivf->nprobe < ivf->nlist ? ivf->nprobe : ivf->nlist;
+    face_id_match_t *probes = (face_id_match_t *)dl_lib_malloc(nprobe + k, sizeof(face_id_match_t), 0);
+    if (NULL == probes)
+        return 0;
+    face_id_match_t *candidates = probes + nprobe;
+
+    nprobe = face_id_index_search(ivf->centroids, face_id, nprobe, probes);
+
+    // Merge the top k of every probed cluster
+    int found = 0;
+    for (int p = 0; p < nprobe; p++)
+    {
+        int n = face_id_index_search(ivf->lists[probes[p].label], face_id, k, candidates);
+        for (int j = 0; j < n; j++)
+        {
+            int i = found;
+            if (i == k)
+            {
+                if (candidates[j].similarity <= matches[k - 1].similarity)
+                    break;
+                i--;
+            }
+            else
+            {
+                found++;
+            }
+            for (; i > 0 && matches[i - 1].similarity < candidates[j].similarity; i--)
+                matches[i] = matches[i - 1];
+            matches[i] = candidates[j];
+        }
+    }
+
+    dl_lib_free(probes);
+    return found;
+}
+
+int face_id_ivf_recognize(face_id_ivf_t *ivf, const fptp_t *face_id, face_id_match_t *match)
+{
+    match->label = -1;
+    match->row = -1;
+    match->similarity = -1;
+
+    if (0 == face_id_ivf_search(ivf, face_id, 1, match))
+        return 0;
+    return match->similarity >= FACE_REC_THRESHOLD;
+}
+
+dl_error_type face_id_ivf_save(face_id_ivf_t *ivf, FILE *f)
+{
+    int32_t header[5] = {FACE_ID_IVF_MAGIC, ivf->dim, ivf->nlist, ivf->nprobe, ivf->type};
+    if (1 != fwrite(header, sizeof(header), 1, f))
+        return DL_FAIL;
+    if (DL_SUCCESS != face_id_index_save(ivf->centroids, f))
+        return DL_FAIL;
+    for (int c = 0; c < ivf->nlist; c++)
+    {
+        if (DL_SUCCESS != face_id_index_save(ivf->lists[c], f))
+            return DL_FAIL;
+    }
+    return DL_SUCCESS;
+}
+
+face_id_ivf_t *face_id_ivf_load(FILE *f)
+{
+    int32_t header[5];
+    if (1 != fread(header, sizeof(header), 1, f) || FACE_ID_IVF_MAGIC != header[0])
+        return NULL;
+    // dim and nlist are checked by face_id_ivf_create
+    if (header[3] < 1 || header[3] > header[2])
+        return NULL;
+    if (FACE_ID_INDEX_F32 != header[4] && FACE_ID_INDEX_F16 != header[4] && FACE_ID_INDEX_Q8 != header[4])
+        return NULL;
+
+    face_id_ivf_t *ivf = face_id_ivf_create(header[1], header[2], (face_id_index_type)header[4]);
+    if (NULL == ivf)
+        return NULL;
+    ivf->nprobe = header[3];
+
+    // Row i of the centroids is cluster i, a search uses the label as the list to scan.
+    // An untrained index has no centroids.
+    face_id_index_free(ivf->centroids);
+    ivf->centroids = face_id_index_load(f);
+    bool valid = ivf->centroids && ivf->centroids->dim == ivf->dim && FACE_ID_INDEX_F32 == ivf->centroids->type;
+    valid = valid && (ivf->centroids->count == ivf->nlist || 0 == ivf->centroids->count);
+    for (int c = 0; valid && c < ivf->centroids->count; c++)
+        valid = ivf->centroids->label[c] == c;
+    if (!valid)
+    {
+        face_id_ivf_free(ivf);
+        return NULL;
+    }
+
+    for (int c = 0; c < ivf->nlist; c++)
+    {
+        face_id_index_free(ivf->lists[c]);
+        ivf->lists[c] = face_id_index_load(f);
+        if (NULL == ivf->lists[c] || ivf->lists[c]->dim != ivf->dim || ivf->lists[c]->type != ivf->type)
+        {
+            face_id_ivf_free(ivf);
+            return NULL;
+        }
+        ivf->count += ivf->lists[c]->count;
+    }
+
+    // face ids need clusters
+    if (ivf->count && 0 == ivf->centroids->count)
+    {
+        face_id_ivf_free(ivf);
+        return NULL;
+    }
+    return ivf;
+}
@@ -0,0 +1,712 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "fr_store.h"
+
+static const char *TAG = "fr_store";
+
+#define FR_STORE_SEGMENT_MAGIC 0x47534652 /* "RFSG" */
+#define FR_STORE_RECORD_MAGIC 0x43524652  /* "RFRC" */
+#define FR_STORE_ERASED 0xffffffff
+
+#define FR_STORE_ADD 1
+#define FR_STORE_DELETE 2
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t source; /* seq of the segment being compacted into this one, FR_STORE_ERASED if none */
+    uint32_t crc;    /* of magic, seq and source */
+} fr_store_segment_header_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t type;
+    uint16_t length; /* payload bytes */
+    int32_t key;
+    uint32_t seq;
+    uint32_t crc;    /* of the header with crc 0, then the payload */
+} fr_store_record_t;
+
+/* Payload of FR_STORE_ADD, FR_STORE_DELETE has none */
+#define FR_STORE_ADD_LENGTH (ENROLL_NAME_LEN + FACE_ID_SIZE * sizeof(fptp_t))
+#define FR_STORE_RECORD_MAX (sizeof(fr_store_record_t) + FR_STORE_ADD_LENGTH)
+
+/*{{{ storage*/
+void fr_storage_close(fr_storage_t *storage)
+{
+    if (storage && storage->close)
+        storage->close(storage);
+}
+
+typedef struct
+{
+    FILE *f;
+    long budget;
+} fr_storage_file_t;
+
+static esp_err_t fr_storage_file_read(fr_storage_t *storage, size_t offset, void *dst, size_t len)
+{
+    fr_storage_file_t *file = (fr_storage_file_t *)storage->ctx;
+    if (offset + len > storage->size || fseek(file->f, offset, SEEK_SET))
+        return ESP_FAIL;
+    return len == fread(dst, 1, len, file->f) ? ESP_OK : ESP_FAIL;
+}
+
+/*
+ * Like NOR flash, writing ANDs the new bits into the old ones.
+ */
+static esp_err_t fr_storage_file_write(fr_storage_t *storage, size_t offset, const void *src, size_t len)
+{
+    fr_storage_file_t *file = (fr_storage_file_t *)storage->ctx;
+    if (offset + len > storage->size)
+        return ESP_FAIL;
+
+    esp_err_t ret = ESP_OK;
+    if (file->budget >= 0 && (long)len > file->budget)
+    {
+        len = file->budget;
+        ret = ESP_FAIL;
+    }
+    if (file->budget >= 0)
+        file->budget -= len;
+
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t buf[256];
+    while (len)
+    {
+        size_t n = len < sizeof(buf) ? len : sizeof(buf);
+        if (fseek(file->f, offset, SEEK_SET) || n != fread(buf, 1, n, file->f))
+            return ESP_FAIL;
+        for (size_t i = 0; i < n; i++)
+            buf[i] &= s[i];
+        if (fseek(file->f, offset, SEEK_SET) || n != fwrite(buf, 1, n, file->f))
+            return ESP_FAIL;
+        offset += n;
+        s += n;
+        len -= n;
+    }
+    fflush(file->f);
+    return ret;
+}
+
+static esp_err_t fr_storage_file_fill(FILE *f, size_t offset, size_t len)
+{
+    uint8_t buf[256];
+    memset(buf, 0xff, sizeof(buf));
+    if (fseek(f, offset, SEEK_SET))
+        return ESP_FAIL;
+    while (len)
+    {
+        size_t n = len < sizeof(buf) ? len : sizeof(buf);
+        if (n != fwrite(buf, 1, n, f))
+            return ESP_FAIL;
+        len -= n;
+    }
+    fflush(f);
+    return ESP_OK;
+}
+
+static esp_err_t fr_storage_file_erase(fr_storage_t *storage, size_t offset, size_t len)
+{
+    fr_storage_file_t *file = (fr_storage_file_t *)storage->ctx;
+    if (offset % storage->erase_size || len % storage->erase_size || offset + len > storage->size)
+        return ESP_FAIL;
+    return fr_storage_file_fill(file->f, offset, len);
+}
+
+static void fr_storage_file_close(fr_storage_t *storage)
+{
+    fr_storage_file_t *file = (fr_storage_file_t *)storage->ctx;
+    fclose(file->f);
+    free(file);
+    free(storage);
+}
+
+fr_storage_t *fr_storage_file_open(const char *path, size_t size, size_t erase_size)
+{
+    if (0 == erase_size || size % erase_size)
+        return NULL;
+
+    FILE *f = fopen(path, "r+b");
+    if (NULL == f)
+        f = fopen(path, "w+b");
+    if (NULL == f)
+        return NULL;
+
+    // A new or short file is extended with erased bytes
+    fseek(f, 0, SEEK_END);
+    long end = ftell(f);
+    if (end < (long)size && ESP_OK != fr_storage_file_fill(f, end, size - end))
+    {
+        fclose(f);
+        return NULL;
+    }
+
+    fr_storage_t *storage = (fr_storage_t *)calloc(1, sizeof(fr_storage_t));
+    fr_storage_file_t *file = (fr_storage_file_t *)calloc(1, sizeof(fr_storage_file_t));
+    if (NULL == storage || NULL == file)
+    {
+        free(storage);
+        free(file);
+        fclose(f);
+        return NULL;
+    }
+
+    file->f = f;
+    file->budget = -1;
+    storage->ctx = file;
+    storage->size = size;
+    storage->erase_size = erase_size;
+    storage->read = fr_storage_file_read;
+    storage->write = fr_storage_file_write;
+    storage->erase = fr_storage_file_erase;
+    storage->close = fr_storage_file_close;
+    return storage;
+}
+
+void fr_storage_file_set_write_budget(fr_storage_t *storage, long budget)
+{
+    ((fr_storage_file_t *)storage->ctx)->budget = budget;
+}
+/*}}}*/
+
+/*{{{ log*/
+static uint32_t fr_store_crc32(uint32_t crc, const void *data, size_t len)
+{
+    static const uint32_t table[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc = (crc >> 4) ^ table[(crc ^ p[i]) & 0xf];
+        crc = (crc >> 4) ^ table[(crc ^ (p[i] >> 4)) & 0xf];
+    }
+    return ~crc;
+}
+
+static uint32_t fr_store_record_crc(const fr_store_record_t *record, const void *payload)
+{
+    fr_store_record_t header = *record;
+    header.crc = 0;
+    uint32_t crc = fr_store_crc32(0, &header, sizeof(header));
+    return fr_store_crc32(crc, payload, record->length);
+}
+
+static uint32_t fr_store_record_size(const fr_store_record_t *record)
+{
+    return (sizeof(fr_store_record_t) + record->length + 3) & ~3;
+}
+
+static size_t fr_store_address(fr_store_t *store, int segment, uint32_t offset)
+{
+    return (size_t)segment * store->segment_size + offset;
+}
+
+static esp_err_t fr_store_read_record(fr_store_t *store, int segment, uint32_t offset, fr_store_record_t *record, uint8_t *payload)
+{
+    fr_storage_t *storage = store->storage;
+    size_t address = fr_store_address(store, segment, offset);
+    if (offset + sizeof(fr_store_record_t) > (uint32_t)store->segment_size ||
+        ESP_OK != storage->read(storage, address, record, sizeof(fr_store_record_t)))
+        return ESP_FAIL;
+    if (FR_STORE_RECORD_MAGIC != record->magic || record->length > FR_STORE_ADD_LENGTH ||
+        offset + fr_store_record_size(record) > (uint32_t)store->segment_size)
+        return ESP_FAIL;
+    if (ESP_OK != storage->read(storage, address + sizeof(fr_store_record_t), payload, record->length))
+        return ESP_FAIL;
+    return record->crc == fr_store_record_crc(record, payload) ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t fr_store_entry_reserve(fr_store_t *store)
+{
+    if (store->count < store->capacity)
+        return ESP_OK;
+
+    int capacity = store->capacity ? store->capacity * 2 : 16;
+    fr_store_entry_t *entries = (fr_store_entry_t *)dl_lib_malloc(capacity, sizeof(fr_store_entry_t), 0);
+    if (NULL == entries)
+        return ESP_FAIL;
+    if (store->count)
+        memcpy(entries, store->entries, store->count * sizeof(fr_store_entry_t));
+    dl_lib_free(store->entries);
+    store->entries = entries;
+    store->capacity = capacity;
+    return ESP_OK;
+}
+
+static void fr_store_entry_remove(fr_store_t *store, int i)
+{
+    memmove(store->entries + i, store->entries + i + 1, (store->count - i - 1) * sizeof(fr_store_entry_t));
+    store->count--;
+}
+
+int fr_store_find(fr_store_t *store, int32_t key)
+{
+    for (int i = 0; i < store->count; i++)
+    {
+        if (store->entries[i].key == key)
+            return i;
+    }
+    return -1;
+}
+
+int fr_store_find_name(fr_store_t *store, const char *name)
+{
+    for (int i = 0; i < store->count; i++)
+    {
+        if (0 == strncmp(store->entries[i].name, name, ENROLL_NAME_LEN))
+            return i;
+    }
+    return -1;
+}
+
+/*
+ * Apply one record read back from the log.
+ */
+static esp_err_t fr_store_replay_record(fr_store_t *store, const fr_store_record_t *record, const uint8_t *payload, int segment, uint32_t offset)
+{
+    int i = fr_store_find(store, record->key);
+    if (FR_STORE_DELETE == record->type)
+    {
+        if (i >= 0)
+            fr_store_entry_remove(store, i);
+    }
+    else if (FR_STORE_ADD == record->type && FR_STORE_ADD_LENGTH == record->length)
+    {
+        if (i < 0)
+        {
+            if (ESP_OK != fr_store_entry_reserve(store))
+                return ESP_FAIL;
+            i = store->count++;
+        }
+        fr_store_entry_t *entry = store->entries + i;
+        entry->key = record->key;
+        entry->seq = record->seq;
+        memcpy(entry->name, payload, ENROLL_NAME_LEN);
+        entry->name[ENROLL_NAME_LEN - 1] = 0;
+        entry->segment = segment;
+        entry->offset = offset;
+    }
+
+    if (record->seq >= store->next_seq)
+        store->next_seq = record->seq + 1;
+    if (record->key >= store->next_key)
+        store->next_key = record->key + 1;
+    return ESP_OK;
+}
+
+/*
+ * Scan one segment. Returns the offset after its last good record, or the
+ * segment size if the segment ends with a damaged record.
+ */
+static uint32_t fr_store_replay_segment(fr_store_t *store, int segment, uint8_t *payload)
+{
+    uint32_t offset = sizeof(fr_store_segment_header_t);
+    fr_store_record_t record;
+
+    while (offset + sizeof(fr_store_record_t) <= (uint32_t)store->segment_size)
+    {
+        if (ESP_OK != store->storage->read(store->storage, fr_store_address(store, segment, offset), &record, sizeof(record)))
+            return store->segment_size;
+        if (FR_STORE_ERASED == record.magic)
+            break;
+        if (ESP_OK != fr_store_read_record(store, segment, offset, &record, payload))
+        {
+            ESP_LOGW(TAG, "Damaged record in segment %d at %u", segment, (unsigned)offset);
+            return store->segment_size;
+        }
+        if (ESP_OK != fr_store_replay_record(store, &record, payload, segment, offset))
+            return store->segment_size;
+        offset += fr_store_record_size(&record);
+    }
+
+    // Appending is only safe into bytes that are still erased
+    for (uint32_t o = offset; o < (uint32_t)store->segment_size; o += FR_STORE_RECORD_MAX)
+    {
+        uint32_t len = store->segment_size - o < FR_STORE_RECORD_MAX ? store->segment_size - o : FR_STORE_RECORD_MAX;
+        if (ESP_OK != store->storage->read(store->storage, fr_store_address(store, segment, o), payload, len))
+            return store->segment_size;
+        for (uint32_t j = 0; j < len; j++)
+        {
+            if (0xff != payload[j])
+                return store->segment_size;
+        }
+    }
+    return offset;
+}
+
+static int fr_store_entry_compare(const void *a, const void *b)
+{
+    uint32_t sa = ((const fr_store_entry_t *)a)->seq;
+    uint32_t sb = ((const fr_store_entry_t *)b)->seq;
+    return sa < sb ? -1 : (sa > sb ? 1 : 0);
+}
+
+static esp_err_t fr_store_replay(fr_store_t *store)
+{
+    uint8_t *payload = (uint8_t *)dl_lib_malloc(1, FR_STORE_RECORD_MAX, 4);
+    if (NULL == payload)
+        return ESP_FAIL;
+
+    uint32_t *source = (uint32_t *)dl_lib_malloc(store->segment_count, sizeof(uint32_t), 0);
+    if (NULL == source)
+    {
+        dl_lib_free(payload);
+        return ESP_FAIL;
+    }
+
+    store->free_segments = 0;
+    for (int s = 0; s < store->segment_count; s++)
+    {
+        fr_store_segment_header_t header;
+        store->segment_seq[s] = 0;
+        if (ESP_OK == store->storage->read(store->storage, fr_store_address(store, s, 0), &header, sizeof(header)) &&
+            FR_STORE_SEGMENT_MAGIC == header.magic && 0 != header.seq &&
+            header.crc == fr_store_crc32(0, &header, 3 * sizeof(uint32_t)))
+        {
+            store->segment_seq[s] = header.seq;
+            source[s] = header.source;
+        }
+        else
+            store->free_segments++;
+        if (store->segment_seq[s] >= store->next_segment_seq)
+            store->next_segment_seq = store->segment_seq[s] + 1;
+    }
+
+    // A compaction that spilled into a fresh segment is only done once its source is erased.
+    // Until then the copies are dropped, they would outlive the deletes of the source.
+    esp_err_t ret = ESP_OK;
+    for (int s = 0; s < store->segment_count && ESP_OK == ret; s++)
+    {
+        if (0 == store->segment_seq[s] || FR_STORE_ERASED == source[s])
+            continue;
+        for (int t = 0; t < store->segment_count; t++)
+        {
+            if (t != s && store->segment_seq[t] == source[s])
+            {
+                ESP_LOGW(TAG, "Unfinished compaction into segment %d", s);
+                ret = store->storage->erase(store->storage, fr_store_address(store, s, 0), store->segment_size);
+                store->segment_seq[s] = 0;
+                store->free_segments++;
+                break;
+            }
+        }
+    }
+    dl_lib_free(source);
+    if (ESP_OK != ret)
+    {
+        dl_lib_free(payload);
+        return ret;
+    }
+
+    // Segments in the order they were written
+    uint32_t last = 0;
+    for (;;)
+    {
+        int segment = -1;
+        for (int s = 0; s < store->segment_count; s++)
+        {
+            if (store->segment_seq[s] > last && (segment < 0 || store->segment_seq[s] < store->segment_seq[segment]))
+                segment = s;
+        }
+        if (segment < 0)
+            break;
+
+        last = store->segment_seq[segment];
+        store->head = segment;
+        store->head_offset = fr_store_replay_segment(store, segment, payload);
+    }
+
+    dl_lib_free(payload);
+    qsort(store->entries, store->count, sizeof(fr_store_entry_t), fr_store_entry_compare);
+    return ESP_OK;
+}
+
+fr_store_t *fr_store_open(fr_storage_t *storage)
+{
+    int segment_size = (FR_STORE_SEGMENT_SIZE + storage->erase_size - 1) / storage->erase_size * storage->erase_size;
+    int segment_count = storage->size / segment_size;
+    if (segment_count < FR_STORE_RESERVE_SEGMENTS + 2)
+    {
+        ESP_LOGE(TAG, "Storage too small, %d segments", segment_count);
+        return NULL;
+    }
+
+    fr_store_t *store = (fr_store_t *)dl_lib_calloc(1, sizeof(fr_store_t), 0);
+    if (NULL == store)
+        return NULL;
+    store->storage = storage;
+    store->segment_size = segment_size;
+    store->segment_count = segment_count;
+    store->head = -1;
+    store->next_segment_seq = 1;
+    store->segment_seq = (uint32_t *)dl_lib_calloc(segment_count, sizeof(uint32_t), 0);
+
+    if (NULL == store->segment_seq || ESP_OK != fr_store_replay(store))
+    {
+        fr_store_close(store);
+        return NULL;
+    }
+    return store;
+}
+
+void fr_store_close(fr_store_t *store)
+{
+    if (NULL == store)
+        return;
+    fr_storage_close(store->storage);
+    dl_lib_free(store->segment_seq);
+    dl_lib_free(store->entries);
+    dl_lib_free(store);
+}
+
+/*
+ * Erase the next free segment after the head and make it the head. 'source' is the
+ * segment being compacted, FR_STORE_ERASED if none.
+ */
+static esp_err_t fr_store_open_segment(fr_store_t *store, uint32_t source)
+{
+    int segment = -1;
+    for (int i = 1; i <= store->segment_count; i++)
+    {
+        int s = (store->head + i + store->segment_count) % store->segment_count;
+        if (0 == store->segment_seq[s])
+        {
+            segment = s;
+            break;
+        }
+    }
+    if (segment < 0)
+        return ESP_FAIL;
+
+    fr_storage_t *storage = store->storage;
+    fr_store_segment_header_t header;
+    memset(&header, 0xff, sizeof(header));
+    header.magic = FR_STORE_SEGMENT_MAGIC;
+    header.seq = store->next_segment_seq;
+    header.source = source;
+    header.crc = fr_store_crc32(0, &header, 3 * sizeof(uint32_t));
+
+    store->head = segment;
+    store->head_offset = store->segment_size;
+    if (ESP_OK != storage->erase(storage, fr_store_address(store, segment, 0), store->segment_size) ||
+        ESP_OK != storage->write(storage, fr_store_address(store, segment, 0), &header, sizeof(header)))
+        return ESP_FAIL;
+
+    store->segment_seq[segment] = store->next_segment_seq++;
+    store->free_segments--;
+    store->head_offset = sizeof(header);
+    return ESP_OK;
+}
+
+static esp_err_t fr_store_append(fr_store_t *store, const fr_store_record_t *record, const void *payload, uint32_t source, int *segment, uint32_t *offset)
+{
+    uint32_t size = fr_store_record_size(record);
+    if (store->head < 0 || store->head_offset + size > (uint32_t)store->segment_size)
+    {
+        if (ESP_OK != fr_store_open_segment(store, source))
+            return ESP_FAIL;
+    }
+
+    fr_storage_t *storage = store->storage;
+    size_t address = fr_store_address(store, store->head, store->head_offset);
+    *segment = store->head;
+    *offset = store->head_offset;
+    store->head_offset += size;
+    if (ESP_OK != storage->write(storage, address, record, sizeof(fr_store_record_t)) ||
+        (record->length && ESP_OK != storage->write(storage, address + sizeof(fr_store_record_t), payload, record->length)))
+    {
+        // A replay stops at the damaged record, nothing may follow it in this segment
+        store->head_offset = store->segment_size;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/*
+ * Copy the live face ids of the oldest segment to the head, then erase it. Copies that
+ * do not fit go to a fresh segment marked with the source, see fr_store_replay.
+ */
+static esp_err_t fr_store_compact(fr_store_t *store, int segment)
+{
+    uint8_t *payload = (uint8_t *)dl_lib_malloc(1, FR_STORE_RECORD_MAX, 4);
+    if (NULL == payload)
+        return ESP_FAIL;
+
+    esp_err_t ret = ESP_OK;
+    uint32_t source = store->segment_seq[segment];
+    fr_store_record_t record;
+    for (int i = 0; i < store->count && ESP_OK == ret; i++)
+    {
+        fr_store_entry_t *entry = store->entries + i;
+        if (entry->segment != segment)
+            continue;
+        // The record keeps its seq, so the enrollment order survives
+        ret = fr_store_read_record(store, segment, entry->offset, &record, payload);
+        if (ESP_OK == ret)
+            ret = fr_store_append(store, &record, payload, source, &entry->segment, &entry->offset);
+    }
+    dl_lib_free(payload);
+    if (ESP_OK != ret)
+        return ret;
+
+    // The header sits in the first erase unit, so a cut erase leaves an invalid header
+    fr_storage_t *storage = store->storage;
+    if (ESP_OK != storage->erase(storage, fr_store_address(store, segment, 0), store->segment_size))
+        return ESP_FAIL;
+    store->segment_seq[segment] = 0;
+    store->free_segments++;
+    return ESP_OK;
+}
+
+static esp_err_t fr_store_make_room(fr_store_t *store, uint32_t size)
+{
+    if (store->head >= 0 && store->head_offset + size <= (uint32_t)store->segment_size)
+        return ESP_OK;
+
+    for (int tries = 0; store->free_segments <= FR_STORE_RESERVE_SEGMENTS && tries < store->segment_count; tries++)
+    {
+        int oldest = -1;
+        for (int s = 0; s < store->segment_count; s++)
+        {
+            if (store->segment_seq[s] && s != store->head && (oldest < 0 || store->segment_seq[s] < store->segment_seq[oldest]))
+                oldest = s;
+        }
+        if (oldest < 0 || ESP_OK != fr_store_compact(store, oldest))
+            return ESP_FAIL;
+    }
+
+    if (store->free_segments <= FR_STORE_RESERVE_SEGMENTS)
+    {
+        ESP_LOGE(TAG, "Store full, %d face ids", store->count);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+int32_t fr_store_add(fr_store_t *store, int32_t key, const char *name, const fptp_t *face_id)
+{
+    uint8_t *payload = (uint8_t *)dl_lib_calloc(1, FR_STORE_ADD_LENGTH, 4);
+    if (NULL == payload || ESP_OK != fr_store_entry_reserve(store))
+    {
+        dl_lib_free(payload);
+        return -1;
+    }
+
+    if (key < 0)
+        key = store->next_key;
+    if (name)
+        strncpy((char *)payload, name, ENROLL_NAME_LEN - 1);
+    memcpy(payload + ENROLL_NAME_LEN, face_id, FACE_ID_SIZE * sizeof(fptp_t));
+
+    fr_store_record_t record;
+    record.magic = FR_STORE_RECORD_MAGIC;
+    record.type = FR_STORE_ADD;
+    record.length = FR_STORE_ADD_LENGTH;
+    record.key = key;
+    record.seq = store->next_seq;
+    record.crc = fr_store_record_crc(&record, payload);
+
+    int segment;
+    uint32_t offset;
+    esp_err_t ret = fr_store_make_room(store, fr_store_record_size(&record));
+    if (ESP_OK == ret)
+        ret = fr_store_append(store, &record, payload, FR_STORE_ERASED, &segment, &offset);
+    if (ESP_OK != ret)
+    {
+        dl_lib_free(payload);
+        return -1;
+    }
+
+    int i = fr_store_find(store, key);
+    if (i >= 0)
+        fr_store_entry_remove(store, i);
+    fr_store_entry_t *entry = store->entries + store->count++;
+    entry->key = key;
+    entry->seq = store->next_seq++;
+    memcpy(entry->name, payload, ENROLL_NAME_LEN);
+    entry->segment = segment;
+    entry->offset = offset;
+    if (key >= store->next_key)
+        store->next_key = key + 1;
+
+    dl_lib_free(payload);
+    return key;
+}
+
+esp_err_t fr_store_delete(fr_store_t *store, int32_t key)
+{
+    int i = fr_store_find(store, key);
+    if (i < 0)
+        return ESP_FAIL;
+
+    fr_store_record_t record;
+    record.magic = FR_STORE_RECORD_MAGIC;
+    record.type = FR_STORE_DELETE;
+    record.length = 0;
+    record.key = key;
+    record.seq = store->next_seq++;
+    record.crc = fr_store_record_crc(&record, NULL);
+
+    int segment;
+    uint32_t offset;
+    if (ESP_OK != fr_store_make_room(store, fr_store_record_size(&record)) ||
+        ESP_OK != fr_store_append(store, &record, NULL, FR_STORE_ERASED, &segment, &offset))
+        return ESP_FAIL;
+
+    // Compaction may have moved the entries
+    fr_store_entry_remove(store, fr_store_find(store, key));
+    return ESP_OK;
+}
+
+esp_err_t fr_store_read(fr_store_t *store, int i, fptp_t *face_id)
+{
+    fr_store_entry_t *entry = store->entries + i;
+    size_t address = fr_store_address(store, entry->segment, entry->offset) + sizeof(fr_store_record_t) + ENROLL_NAME_LEN;
+    return store->storage->read(store->storage, address, face_id, FACE_ID_SIZE * sizeof(fptp_t));
+}
+
+esp_err_t fr_store_format(fr_store_t *store)
+{
+    fr_storage_t *storage = store->storage;
+    esp_err_t ret = storage->erase(storage, 0, (size_t)store->segment_count * store->segment_size);
+
+    memset(store->segment_seq, 0, store->segment_count * sizeof(uint32_t));
+    store->free_segments = store->segment_count;
+    store->head = -1;
+    store->head_offset = 0;
+    store->next_segment_seq = 1;
+    store->count = 0;
+    return ret;
+}
+/*}}}*/
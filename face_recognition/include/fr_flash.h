@@ -10,7 +10,7 @@ extern "C"
 #define FR_FLASH_TYPE   32
 #define FR_FLASH_SUBTYPE   32
 #define FR_FLASH_PARTITION_NAME "fr"
-#define FR_FLASH_INFO_FLAG 12138
+#define FR_FLASH_INFO_FLAG 12138 /* flag of the old layout, the partition now holds an fr_store log */
         
      /**
      * @brief Produce face id according to the input aligned face, and save it to dest_id and flash.
@@ -41,34 +41,34 @@ extern "C"
      * @brief Read the enrolled face IDs from the flash.
      * 
      * @param l                     Face id list
-     * @return int8_t               The number of IDs remaining in flash
+     * @return int                  The number of IDs remaining in flash
      */
-    int8_t read_face_id_from_flash(face_id_list *l);
+    int read_face_id_from_flash(face_id_list *l);
     
     /**
      * @brief Read the enrolled face IDs and their corresponding names from the flash.
      * 
      * @param l                     Face id list
-     * @return int8_t               The number of IDs remaining in flash
+     * @return int                  The number of IDs remaining in flash
      */
-    int8_t read_face_id_from_flash_with_name(face_id_name_list *l);
+    int read_face_id_from_flash_with_name(face_id_name_list *l);
 
     /**
      * @brief Delete the enrolled face IDs in the flash.
      * 
      * @param l                     Face id list
-     * @return int8_t               The number of IDs remaining in flash
+     * @return int                  The number of IDs remaining in flash, -2 if the flash write failed and the list is unchanged
      */
-    int8_t delete_face_id_in_flash(face_id_list *l);
+    int delete_face_id_in_flash(face_id_list *l);
 
     /**
      * @brief Delete the enrolled face ID corresponding to the name in the flash.
      * 
      * @param l                     Face id list
      * @param name                  The name that needs to be deleted
-     * @return int8_t               The number of IDs remaining in flash
+     * @return int                  The number of IDs remaining in flash, -2 if the flash write failed and the list is unchanged
      */
-    int8_t delete_face_id_in_flash_with_name(face_id_name_list *l, char *name);
+    int delete_face_id_in_flash_with_name(face_id_name_list *l, char *name);
 
     /**
      * @brief Delete all the enrolled face IDs and names paris in the flash.
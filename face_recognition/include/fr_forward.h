@@ -8,6 +8,7 @@ extern "C"
 #include "image_util.h"
 #include "dl_lib_matrix3d.h"
 #include "frmn.h"
+#include "fr_index.h"
 
 #define FACE_WIDTH 56
 #define FACE_HEIGHT 56
@@ -40,20 +41,23 @@ extern "C"
 
     typedef struct
     {
-        face_id_node *head;    /*!< head pointer of the id list */
-        face_id_node *tail;    /*!< tail pointer of the id list */
-        uint8_t count;         /*!< number of enrolled ids */
-        uint8_t confirm_times; /*!< images needed for one enrolling */
+        face_id_node *head;      /*!< head pointer of the id list */
+        face_id_node *tail;      /*!< tail pointer of the id list */
+        int count;               /*!< number of enrolled ids */
+        uint8_t confirm_times;   /*!< images needed for one enrolling */
+        face_id_index_t *index;  /*!< enrolled ids for matching, row i belongs to nodes[i] */
+        face_id_node **nodes;    /*!< node of each index row */
     } face_id_name_list;
 
     typedef struct
     {
-        uint8_t head;            /*!< head index of the id list */
-        uint8_t tail;            /*!< tail index of the id list */
-        uint8_t count;           /*!< number of enrolled ids */
-        uint8_t size;            /*!< max len of id list */
+        int head;                /*!< head index of the id list */
+        int tail;                /*!< tail index of the id list */
+        int count;               /*!< number of enrolled ids */
+        int size;                /*!< max len of id list */
         uint8_t confirm_times;   /*!< images needed for one enrolling */
         dl_matrix3d_t **id_list; /*!< stores face id vectors */
+        face_id_index_t *index;  /*!< enrolled ids for matching, labelled by their id_list index */
     } face_id_list;
 
     /**
@@ -62,8 +66,27 @@ extern "C"
      * @param l                    Face id list
      * @param size                 Size of list, one list contains one vector
      * @param confirm_times        Enroll times for one id
+     * @return dl_error_type       DL_FAIL if out of memory, the list is left empty
+     */
+    dl_error_type face_id_init(face_id_list *l, int size, uint8_t confirm_times);
+
+    /**
+     * @brief Initialize face id list, matching against ids stored as the given type.
+     * 
+     * @param l                    Face id list
+     * @param size                 Size of list, one list contains one vector
+     * @param confirm_times        Enroll times for one id
+     * @param type                 Storage type of the matching index, face_id_init uses FACE_ID_INDEX_F32
+     * @return dl_error_type       DL_FAIL if out of memory, the list is left empty
+     */
+    dl_error_type face_id_init_with_type(face_id_list *l, int size, uint8_t confirm_times, face_id_index_type type);
+
+    /**
+     * @brief Free the enrolled ids and the matching index of a list set up by face_id_init.
+     * 
+     * @param l                    Face id list
      */
-    void face_id_init(face_id_list *l, uint8_t size, uint8_t confirm_times);
+    void face_id_free(face_id_list *l);
 
     /**
      * @brief Initialize face id list with name.
@@ -71,8 +94,27 @@ extern "C"
      * @param l                    Face id list
      * @param size                 Size of list, one list contains one vector
      * @param confirm_times        Enroll times for one id
+     * @return dl_error_type       DL_FAIL if out of memory, the list is left empty
+     */
+    dl_error_type face_id_name_init(face_id_name_list *l, int size, uint8_t confirm_times);
+
+    /**
+     * @brief Initialize face id list with name, matching against ids stored as the given type.
+     * 
+     * @param l                    Face id list
+     * @param size                 Expected number of ids, the list grows beyond it
+     * @param confirm_times        Enroll times for one id
+     * @param type                 Storage type of the matching index, face_id_name_init uses FACE_ID_INDEX_F32
+     * @return dl_error_type       DL_FAIL if out of memory, the list is left empty
      */
-    void face_id_name_init(face_id_name_list *l, uint8_t size, uint8_t confirm_times);
+    dl_error_type face_id_name_init_with_type(face_id_name_list *l, int size, uint8_t confirm_times, face_id_index_type type);
+
+    /**
+     * @brief Free the enrolled ids, names and the matching index of a list set up by face_id_name_init.
+     * 
+     * @param l                    Face id list with names
+     */
+    void face_id_name_free(face_id_name_list *l);
 
     /**
      * @brief Alloc memory for aligned face.
@@ -115,6 +157,24 @@ extern "C"
      */
     dl_matrix3d_t *get_face_id(dl_matrix3du_t *aligned_face);
 
+    /**
+     * @brief Alloc memory for a batch of aligned faces.
+     * 
+     * @param n                         Number of faces
+     * @return dl_matrix3du_t*          Size: nxFACE_WIDTHxFACE_HEIGHTx3, face i starts at item + i * FACE_WIDTH * FACE_HEIGHT * 3
+     */
+    dl_matrix3du_t *aligned_faces_alloc(int n);
+
+    /**
+     * @brief Run the face recognition model on a batch of aligned faces. The model takes one face at a time,
+     *        so it runs once per face, the ids are written into one output matrix.
+     * 
+     * @param aligned_faces     n aligned 56x56x3 images, stored along the n dimension, see aligned_faces_alloc
+     * @return face_ids         n normalized face ids, size (n, 1, 1, 512), face id i starts at item + i * FACE_ID_SIZE.
+     *                          An all-zero id is left zero. NULL if the model or an allocation failed
+     */
+    dl_matrix3d_t *get_face_ids(dl_matrix3du_t *aligned_faces);
+
     /**
      * @brief Add src_id to dest_id
      * 
@@ -129,9 +189,17 @@ extern "C"
      *
      * @param l                     An ID list 
      * @param algined_face          An aligned face
-     * @return int8_t               Matched face id
+     * @return int                  Matched face id, -1 if no id is similar enough or the model failed
+     */
+    int recognize_face(face_id_list *l, dl_matrix3du_t *algined_face);
+
+    /**
+     * @brief Rebuild the matching index after id_list was filled directly, e.g. read from flash.
+     *
+     * @param l                     An ID list
+     * @return DL_SUCCESS or DL_FAIL if out of memory
      */
-    int8_t recognize_face(face_id_list *l, dl_matrix3du_t *algined_face);
+    dl_error_type face_id_list_reindex(face_id_list *l);
 
     /**
      * @brief Match face id with the id_list, and return matched face id node.
@@ -141,6 +209,14 @@ extern "C"
      * @return face_id_node* 
      */
     face_id_node *recognize_face_with_name(face_id_name_list *l, dl_matrix3d_t *face_id);
+
+    /**
+     * @brief Rebuild the matching index after nodes were linked directly, e.g. read from flash.
+     *
+     * @param l                     An ID list with name
+     * @return DL_SUCCESS or DL_FAIL if out of memory
+     */
+    dl_error_type face_id_name_list_reindex(face_id_name_list *l);
     
     /**
      * @brief Produce face id according to the input aligned face, and save it to dest_id.
@@ -148,7 +224,7 @@ extern "C"
      * @param l                     Face id list
      * @param aligned_face          An aligned face
      * @param enroll_confirm_times  Confirm times for each face id enrollment
-     * @return -1                   Wrong input enroll_confirm_times
+     * @return -1                   Wrong input enroll_confirm_times, or the model or an allocation failed
      * @return 0                    Enrollment finish
      * @return >=1                  The left piece of aligned faces should be input
      */
@@ -170,18 +246,18 @@ extern "C"
      * @brief Delete the enrolled face IDs
      * 
      * @param l            Face id list
-     * @return uint8_t     The number of IDs remaining in face id list
+     * @return int         The number of IDs remaining in face id list
      */
-    uint8_t delete_face(face_id_list *l);
+    int delete_face(face_id_list *l);
 
     /**
      * @brief Delete the enrolled face IDs and associated names
      * 
      * @param l             Face id list
      * @param name          The name that needs to be deleted
-     * @return int8_t       The number of IDs remaining in face id list
+     * @return int          Position of the deleted ID in the list, -1 if not found
      */
-    int8_t delete_face_with_name(face_id_name_list *l, char *name);
+    int delete_face_with_name(face_id_name_list *l, char *name);
     
     /**
      * @brief               Delete all the enrolled face IDs and names paris
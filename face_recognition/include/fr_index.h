@@ -0,0 +1,134 @@
+#pragma once
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdio.h>
+#include "dl_lib_matrix3d.h"
+
+#define FACE_ID_INDEX_ALIGN 64
+
+    typedef enum
+    {
+        FACE_ID_INDEX_F32 = 0, /*!< float rows, exact scores */
+        FACE_ID_INDEX_F16,     /*!< IEEE half rows, 1/2 of the memory */
+        FACE_ID_INDEX_Q8,      /*!< int8 rows with one scale per row, 1/4 of the memory */
+    } face_id_index_type;
+
+    /**
+     * @brief Enrolled face ids stored as one contiguous matrix.
+     *
+     * Row i starts at data + i * stride, stride is a multiple of FACE_ID_INDEX_ALIGN
+     * so every row sits on its own cache lines. Rows are kept dense, removing a row
+     * moves the last row into its place.
+     */
+    typedef struct
+    {
+        face_id_index_type type; /*!< storage type of the rows */
+        int dim;                 /*!< length of one face id */
+        int stride;              /*!< bytes between two rows */
+        int count;               /*!< number of rows in use */
+        int capacity;            /*!< number of rows allocated */
+        uint8_t *data;           /*!< capacity x stride, FACE_ID_INDEX_ALIGN aligned */
+        fptp_t *scale;           /*!< dequantization scale of each row, FACE_ID_INDEX_Q8 only */
+        int32_t *label;          /*!< label given to each row by the caller */
+    } face_id_index_t;
+
+    typedef struct
+    {
+        int32_t label;     /*!< label of the matched row */
+        int row;           /*!< matched row */
+        fptp_t similarity; /*!< dot product, the cosine similarity for unit face ids */
+    } face_id_match_t;
+
+    /**
+     * @brief Create an empty index.
+     *
+     * @param dim                   Length of one face id, FACE_ID_SIZE for get_face_id
+     * @param capacity              Rows to allocate up front, the index grows when it is full
+     * @param type                  Storage type of the rows
+     * @return face_id_index_t*     NULL if out of memory
+     */
+    face_id_index_t *face_id_index_create(int dim, int capacity, face_id_index_type type);
+
+    /**
+     * @brief Free the index and all its rows.
+     */
+    void face_id_index_free(face_id_index_t *index);
+
+    /**
+     * @brief Make room for at least capacity rows.
+     *
+     * @return DL_SUCCESS or DL_FAIL if out of memory
+     */
+    dl_error_type face_id_index_reserve(face_id_index_t *index, int capacity);
+
+    /**
+     * @brief Append a face id.
+     *
+     * @param index         Index
+     * @param face_id       dim floats
+     * @param label         Label returned by face_id_index_search for this row
+     * @return int          Row of the face id, -1 if out of memory
+     */
+    int face_id_index_add(face_id_index_t *index, const fptp_t *face_id, int32_t label);
+
+    /**
+     * @brief Overwrite the face id of a row, the label is kept.
+     */
+    void face_id_index_set(face_id_index_t *index, int row, const fptp_t *face_id);
+
+    /**
+     * @brief Read a row back as floats, quantized rows are dequantized.
+     */
+    void face_id_index_get(face_id_index_t *index, int row, fptp_t *face_id);
+
+    /**
+     * @brief Remove a row. The last row moves into its place.
+     *
+     * @return int          The row that now holds the former last row, -1 if nothing moved
+     */
+    int face_id_index_remove(face_id_index_t *index, int row);
+
+    /**
+     * @brief Find the row of a label.
+     *
+     * @return int          Row, -1 if the label is not in the index
+     */
+    int face_id_index_find(face_id_index_t *index, int32_t label);
+
+    /**
+     * @brief Remove all rows, the memory is kept.
+     */
+    void face_id_index_clear(face_id_index_t *index);
+
+    /**
+     * @brief Score a face id against every row and keep the k most similar ones.
+     *
+     * @param index         Index
+     * @param face_id       dim floats
+     * @param k             Number of matches wanted
+     * @param matches       k items, sorted by descending similarity
+     * @return int          Number of matches written, min(k, count)
+     */
+    int face_id_index_search(face_id_index_t *index, const fptp_t *face_id, int k, face_id_match_t *matches);
+
+    /**
+     * @brief Write the index to a file, rows are written in their storage type.
+     *
+     * @return DL_SUCCESS or DL_FAIL if the write failed
+     */
+    dl_error_type face_id_index_save(face_id_index_t *index, FILE *f);
+
+    /**
+     * @brief Read an index written by face_id_index_save.
+     *
+     * @return face_id_index_t*     NULL if the file is not an index or out of memory
+     */
+    face_id_index_t *face_id_index_load(FILE *f);
+
+#if __cplusplus
+}
+#endif
@@ -0,0 +1,124 @@
+#pragma once
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+#include "fr_forward.h"
+
+#define FACE_ID_IVF_NPROBE 8             /* default clusters scanned by one search */
+#define FACE_ID_IVF_TRAIN_PER_LIST 64    /* face ids per cluster used by face_id_ivf_build to train */
+#define FACE_ID_IVF_TRAIN_ITERATIONS 10  /* k-means iterations of face_id_ivf_build */
+
+    /**
+     * @brief Inverted file index for large galleries.
+     *
+     * Face ids are clustered around nlist centroids (spherical k-means), and every
+     * cluster keeps its face ids in a face_id_index_t. A search scores the centroids,
+     * then only the face ids of the nprobe closest clusters, so its cost is roughly
+     * nlist + count * nprobe / nlist dot products instead of count.
+     */
+    typedef struct
+    {
+        int dim;                     /*!< length of one face id */
+        int nlist;                   /*!< number of clusters */
+        int nprobe;                  /*!< clusters scanned by a search, trades recall for time */
+        int count;                   /*!< number of face ids */
+        face_id_index_type type;     /*!< storage type of the face ids */
+        face_id_index_t *centroids;  /*!< nlist unit centroids, row i is cluster i, empty until trained */
+        face_id_index_t **lists;     /*!< face ids of each cluster */
+    } face_id_ivf_t;
+
+    /**
+     * @brief Create an empty, untrained index.
+     *
+     * @param dim                   Length of one face id, FACE_ID_SIZE for get_face_id
+     * @param nlist                 Number of clusters, about 4 * sqrt(expected count) is a good start
+     * @param type                  Storage type of the face ids, the centroids are always float
+     * @return face_id_ivf_t*       NULL if out of memory
+     */
+    face_id_ivf_t *face_id_ivf_create(int dim, int nlist, face_id_index_type type);
+
+    /**
+     * @brief Free the index and all its face ids.
+     */
+    void face_id_ivf_free(face_id_ivf_t *ivf);
+
+    /**
+     * @brief Compute the centroids from sample face ids. Face ids already added are reassigned.
+     *
+     * @param ivf               Index
+     * @param face_ids          n x dim floats
+     * @param n                 Number of samples, at least nlist
+     * @param iterations        k-means iterations
+     * @return DL_SUCCESS or DL_FAIL if n < nlist or out of memory
+     */
+    dl_error_type face_id_ivf_train(face_id_ivf_t *ivf, const fptp_t *face_ids, int n, int iterations);
+
+    /**
+     * @brief Train on a subset of the face ids, then add all of them.
+     *
+     * @param ivf               Index
+     * @param face_ids          n x dim floats
+     * @param labels            n labels
+     * @param n                 Number of face ids, at least nlist
+     * @return DL_SUCCESS or DL_FAIL
+     */
+    dl_error_type face_id_ivf_build(face_id_ivf_t *ivf, const fptp_t *face_ids, const int32_t *labels, int n);
+
+    /**
+     * @brief Add a face id to the cluster of its closest centroid.
+     *
+     * @return DL_SUCCESS or DL_FAIL if the index is not trained or out of memory
+     */
+    dl_error_type face_id_ivf_add(face_id_ivf_t *ivf, const fptp_t *face_id, int32_t label);
+
+    /**
+     * @brief Remove the face id of a label.
+     *
+     * @return DL_SUCCESS or DL_FAIL if the label is not in the index
+     */
+    dl_error_type face_id_ivf_remove(face_id_ivf_t *ivf, int32_t label);
+
+    /**
+     * @brief Find the k most similar face ids among the nprobe closest clusters.
+     *
+     * @param ivf               Index
+     * @param face_id           dim floats
+     * @param k                 Number of matches wanted
+     * @param matches           k items, sorted by descending similarity, row is the row inside the cluster
+     * @return int              Number of matches written
+     */
+    int face_id_ivf_search(face_id_ivf_t *ivf, const fptp_t *face_id, int k, face_id_match_t *matches);
+
+    /**
+     * @brief Match a face id the way recognize_face_with_name does: the best match only counts
+     *        when its similarity reaches FACE_REC_THRESHOLD.
+     *
+     * @param ivf               Index
+     * @param face_id           dim floats
+     * @param match             Best match, also written when it is below the threshold
+     * @return 1                Recognized, match->label is the identity
+     * @return 0                No face id is similar enough
+     */
+    int face_id_ivf_recognize(face_id_ivf_t *ivf, const fptp_t *face_id, face_id_match_t *match);
+
+    /**
+     * @brief Write the centroids and all face ids to a file.
+     *
+     * @return DL_SUCCESS or DL_FAIL if the write failed
+     */
+    dl_error_type face_id_ivf_save(face_id_ivf_t *ivf, FILE *f);
+
+    /**
+     * @brief Read an index written by face_id_ivf_save.
+     *
+     * @return face_id_ivf_t*   NULL if the file is not a valid index or out of memory. A valid index has
+     *                          1 <= nprobe <= nlist, a known type, and nlist centroids, or none if untrained and empty
+     */
+    face_id_ivf_t *face_id_ivf_load(FILE *f);
+
+#if __cplusplus
+}
+#endif
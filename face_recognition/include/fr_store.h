@@ -0,0 +1,142 @@
+#pragma once
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "fr_forward.h"
+
+#define FR_STORE_SEGMENT_SIZE (16 * 1024) /* bytes per log segment, a multiple of the erase size */
+#define FR_STORE_RESERVE_SEGMENTS 1       /* segments kept erased for compaction */
+
+    /**
+     * @brief Raw NOR flash style storage: erase sets bytes to 0xff, write can only clear bits.
+     */
+    typedef struct fr_storage
+    {
+        void *ctx;          /*!< backend state */
+        size_t size;        /*!< bytes */
+        size_t erase_size;  /*!< erase unit, offsets and lengths of erase are multiples of it */
+        esp_err_t (*read)(struct fr_storage *storage, size_t offset, void *dst, size_t len);
+        esp_err_t (*write)(struct fr_storage *storage, size_t offset, const void *src, size_t len);
+        esp_err_t (*erase)(struct fr_storage *storage, size_t offset, size_t len);
+        void (*close)(struct fr_storage *storage);
+    } fr_storage_t;
+
+    /**
+     * @brief File backed storage that behaves like a flash partition, for tests on Linux.
+     *
+     * @param path                  File, created erased if it does not exist
+     * @param size                  Bytes of the simulated partition
+     * @param erase_size            Erase unit, 4096 like the SPI flash
+     * @return fr_storage_t*        NULL if the file can not be opened
+     */
+    fr_storage_t *fr_storage_file_open(const char *path, size_t size, size_t erase_size);
+
+    /**
+     * @brief Let the file storage write only this many more bytes, then fail. A negative budget never fails.
+     *        Simulates a power cut in the middle of a write.
+     */
+    void fr_storage_file_set_write_budget(fr_storage_t *storage, long budget);
+
+    /**
+     * @brief Close a storage.
+     */
+    void fr_storage_close(fr_storage_t *storage);
+
+    typedef struct
+    {
+        int32_t key;                  /*!< key of the face id */
+        uint32_t seq;                 /*!< enrollment order */
+        char name[ENROLL_NAME_LEN];   /*!< name of the face id, empty for face_id_list */
+        int segment;                  /*!< segment of the record */
+        uint32_t offset;              /*!< offset of the record in its segment */
+    } fr_store_entry_t;
+
+    /**
+     * @brief Append-only face id log.
+     *
+     * The storage is split into segments. Every enroll or delete appends one
+     * checksummed record to the newest segment, a segment is erased once when the
+     * log moves into it. When only FR_STORE_RESERVE_SEGMENTS erased segments are
+     * left, the live records of the oldest segment are copied to the head and the
+     * oldest segment is erased, so erases rotate over the whole storage.
+     *
+     * Opening a store replays the log. A record cut by a power loss fails its
+     * checksum and is ignored, the log continues in a fresh segment. A compaction
+     * cut after it spilled into a fresh segment is undone by erasing that segment.
+     */
+    typedef struct
+    {
+        fr_storage_t *storage;      /*!< backend */
+        int segment_size;           /*!< bytes per segment */
+        int segment_count;          /*!< segments in the storage */
+        uint32_t *segment_seq;      /*!< sequence of each segment, 0 if erased */
+        int free_segments;          /*!< segments with segment_seq 0 */
+        int head;                   /*!< segment records are appended to, -1 if none yet */
+        uint32_t head_offset;       /*!< next free byte of the head segment */
+        uint32_t next_segment_seq;  /*!< sequence of the next segment */
+        uint32_t next_seq;          /*!< sequence of the next enrolled face id */
+        int32_t next_key;           /*!< key given by fr_store_add to the next face id */
+        fr_store_entry_t *entries;  /*!< live face ids, sorted by seq */
+        int count;                  /*!< number of live face ids */
+        int capacity;               /*!< entries allocated */
+    } fr_store_t;
+
+    /**
+     * @brief Open a store and replay its log.
+     *
+     * @param storage               Backend, owned by the store from now on
+     * @return fr_store_t*          NULL if the storage is too small or out of memory
+     */
+    fr_store_t *fr_store_open(fr_storage_t *storage);
+
+    /**
+     * @brief Close the store and its storage.
+     */
+    void fr_store_close(fr_store_t *store);
+
+    /**
+     * @brief Append a face id. A key that is already stored is replaced.
+     *
+     * @param store                 Store
+     * @param key                   Key of the face id, -1 to get a new key
+     * @param name                  Name, NULL for none
+     * @param face_id               FACE_ID_SIZE floats
+     * @return int32_t              Key of the face id, -1 if the store is full or the write failed
+     */
+    int32_t fr_store_add(fr_store_t *store, int32_t key, const char *name, const fptp_t *face_id);
+
+    /**
+     * @brief Delete a face id.
+     *
+     * @return ESP_OK or ESP_FAIL if the key is not stored or the write failed
+     */
+    esp_err_t fr_store_delete(fr_store_t *store, int32_t key);
+
+    /**
+     * @brief Read the face id of entries[i].
+     *
+     * @return ESP_OK or ESP_FAIL if the read failed
+     */
+    esp_err_t fr_store_read(fr_store_t *store, int i, fptp_t *face_id);
+
+    /**
+     * @brief Find the entry of a key or of a name.
+     *
+     * @return int                  Index in entries, -1 if not found
+     */
+    int fr_store_find(fr_store_t *store, int32_t key);
+    int fr_store_find_name(fr_store_t *store, const char *name);
+
+    /**
+     * @brief Erase the whole storage.
+     */
+    esp_err_t fr_store_format(fr_store_t *store);
+
+#if __cplusplus
+}
+#endif
@@ -0,0 +1,151 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Save, load and remove of the inverted file index, and the load of corrupt headers.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fr_ivf.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+#define TEST_DIM 32
+#define TEST_N 200
+#define TEST_NLIST 8
+
+static fptp_t gallery[TEST_N * TEST_DIM];
+static int32_t labels[TEST_N];
+
+static void random_unit(fptp_t *v, uint32_t *seed)
+{
+    fptp_t norm = 0;
+    for (int i = 0; i < TEST_DIM; i++)
+    {
+        *seed = *seed * 1664525u + 1013904223u;
+        v[i] = (*seed >> 8) * (1.0f / 16777216.0f) - 0.5f;
+        norm += v[i] * v[i];
+    }
+    for (int i = 0; i < TEST_DIM; i++)
+        v[i] /= sqrtf(norm);
+}
+
+/*
+ * Save 'ivf', change header field 'field' to 'value', and load it back.
+ */
+static face_id_ivf_t *reload(face_id_ivf_t *ivf, int field, int32_t value)
+{
+    FILE *f = tmpfile();
+    if (NULL == f || DL_SUCCESS != face_id_ivf_save(ivf, f))
+        return NULL;
+    if (field >= 0)
+    {
+        fseek(f, field * sizeof(int32_t), SEEK_SET);
+        fwrite(&value, sizeof(value), 1, f);
+    }
+    rewind(f);
+    face_id_ivf_t *loaded = face_id_ivf_load(f);
+    fclose(f);
+    return loaded;
+}
+
+int main(void)
+{
+    uint32_t seed = 1;
+    for (int i = 0; i < TEST_N; i++)
+    {
+        random_unit(gallery + i * TEST_DIM, &seed);
+        labels[i] = 1000 + i;
+    }
+
+    for (int type = FACE_ID_INDEX_F32; type <= FACE_ID_INDEX_Q8; type++)
+    {
+        face_id_ivf_t *ivf = face_id_ivf_create(TEST_DIM, TEST_NLIST, (face_id_index_type)type);
+        CHECK(ivf);
+        CHECK(DL_SUCCESS == face_id_ivf_build(ivf, gallery, labels, TEST_N));
+        ivf->nprobe = 3;
+
+        // a loaded index gives the same matches
+        face_id_ivf_t *loaded = reload(ivf, -1, 0);
+        CHECK(loaded);
+        CHECK(loaded->count == TEST_N && loaded->nprobe == 3 && loaded->type == type);
+        for (int q = 0; q < 20; q++)
+        {
+            face_id_match_t a[5], b[5];
+            const fptp_t *query = gallery + q * 7 * TEST_DIM;
+            int found = face_id_ivf_search(ivf, query, 5, a);
+            CHECK(found > 0 && found == face_id_ivf_search(loaded, query, 5, b));
+            for (int j = 0; j < found; j++)
+                CHECK(a[j].label == b[j].label && a[j].similarity == b[j].similarity);
+            CHECK(labels[q * 7] == b[0].label);
+        }
+
+        // removed face ids are not found any more, also after a reload
+        for (int i = 0; i < TEST_N; i += 2)
+            CHECK(DL_SUCCESS == face_id_ivf_remove(loaded, labels[i]));
+        CHECK(DL_FAIL == face_id_ivf_remove(loaded, labels[0]));
+        CHECK(TEST_N / 2 == loaded->count);
+        face_id_ivf_t *removed = reload(loaded, -1, 0);
+        CHECK(removed && TEST_N / 2 == removed->count);
+        removed->nprobe = TEST_NLIST;
+        for (int i = 0; i < TEST_N; i++)
+        {
+            face_id_match_t match;
+            CHECK(1 == face_id_ivf_search(removed, gallery + i * TEST_DIM, 1, &match));
+            CHECK((i & 1) ? labels[i] == match.label : labels[i] != match.label);
+        }
+        face_id_ivf_free(removed);
+        face_id_ivf_free(loaded);
+
+        // corrupt headers: nprobe out of [1, nlist], unknown type, nlist without as many centroids
+        CHECK(NULL == reload(ivf, 3, 0));
+        CHECK(NULL == reload(ivf, 3, TEST_NLIST + 1));
+        CHECK(NULL == reload(ivf, 4, 7));
+        CHECK(NULL == reload(ivf, 2, TEST_NLIST + 1));
+        CHECK(NULL == reload(ivf, 2, TEST_NLIST - 1));
+        CHECK(NULL == reload(ivf, 0, 0));
+        face_id_ivf_free(ivf);
+    }
+
+    // an untrained, empty index round-trips
+    face_id_ivf_t *empty = face_id_ivf_create(TEST_DIM, TEST_NLIST, FACE_ID_INDEX_F32);
+    CHECK(empty);
+    face_id_ivf_t *loaded = reload(empty, -1, 0);
+    CHECK(loaded && 0 == loaded->count);
+    face_id_ivf_free(loaded);
+    face_id_ivf_free(empty);
+
+    printf("ivf: ok\n");
+    return 0;
+}
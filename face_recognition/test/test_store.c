@@ -0,0 +1,172 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Power cuts in the middle of the face id log writes. After every cut the store
+ * is reopened and must hold the face ids from just before or just after the
+ * operation that was cut, never a mix.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fr_store.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+#define TEST_PATH "test_store.bin"
+#define TEST_SIZE (6 * FR_STORE_SEGMENT_SIZE)
+#define TEST_KEYS 6
+#define TEST_CUTS 300
+#define TEST_RECORD (ENROLL_NAME_LEN + FACE_ID_SIZE * sizeof(fptp_t))
+
+typedef struct
+{
+    int count;
+    int32_t order[TEST_KEYS];      /* live keys in enrollment order */
+    uint32_t version[TEST_KEYS];   /* written into the face id of a key */
+} model_t;
+
+static fptp_t face_id[FACE_ID_SIZE];
+
+static void model_face_id(uint32_t version, fptp_t *v)
+{
+    for (int i = 0; i < FACE_ID_SIZE; i++)
+        v[i] = (fptp_t)(version * FACE_ID_SIZE + i);
+}
+
+static int model_find(const model_t *m, int32_t key)
+{
+    for (int i = 0; i < m->count; i++)
+    {
+        if (m->order[i] == key)
+            return i;
+    }
+    return -1;
+}
+
+static void model_remove(model_t *m, int32_t key)
+{
+    int i = model_find(m, key);
+    if (i < 0)
+        return;
+    memmove(m->order + i, m->order + i + 1, (m->count - i - 1) * sizeof(int32_t));
+    m->count--;
+}
+
+static int model_equal(fr_store_t *store, const model_t *m)
+{
+    if (store->count != m->count)
+        return 0;
+    for (int i = 0; i < m->count; i++)
+    {
+        char name[ENROLL_NAME_LEN];
+        int32_t key = m->order[i];
+        snprintf(name, sizeof(name), "key%d", key);
+        if (store->entries[i].key != key || strcmp(store->entries[i].name, name) ||
+            ESP_OK != fr_store_read(store, i, face_id))
+            return 0;
+        for (int j = 0; j < FACE_ID_SIZE; j++)
+        {
+            if (face_id[j] != (fptp_t)(m->version[key] * FACE_ID_SIZE + j))
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Apply one random enroll or delete to 'next'. Returns 0 if the store write failed.
+ */
+static int step(fr_store_t *store, model_t *next, uint32_t *version)
+{
+    int32_t key = rand() % TEST_KEYS;
+    if (model_find(next, key) >= 0 && 0 == rand() % 3)
+    {
+        model_remove(next, key);
+        return ESP_OK == fr_store_delete(store, key);
+    }
+
+    char name[ENROLL_NAME_LEN];
+    snprintf(name, sizeof(name), "key%d", key);
+    model_remove(next, key);
+    next->order[next->count++] = key;
+    next->version[key] = ++*version;
+    model_face_id(next->version[key], face_id);
+    return key == fr_store_add(store, key, name, face_id);
+}
+
+int main(void)
+{
+    srand(1);
+    remove(TEST_PATH);
+    fr_storage_t *storage = fr_storage_file_open(TEST_PATH, TEST_SIZE, 4096);
+    CHECK(storage);
+    fr_store_t *store = fr_store_open(storage);
+    CHECK(store && 0 == store->count);
+
+    model_t cur = {0};
+    uint32_t version = 0;
+    for (int cut = 0; cut < TEST_CUTS; cut++)
+    {
+        // Cut anywhere within the next few records
+        fr_storage_file_set_write_budget(store->storage, rand() % (4 * TEST_RECORD));
+        model_t next = cur;
+        while (step(store, &next, &version))
+            cur = next;
+
+        fr_store_close(store);
+        storage = fr_storage_file_open(TEST_PATH, TEST_SIZE, 4096);
+        CHECK(storage);
+        store = fr_store_open(storage);
+        CHECK(store);
+        if (model_equal(store, &next))
+            cur = next;
+        else
+            CHECK(model_equal(store, &cur));
+    }
+    // The cuts hit the log while it wrapped around the storage several times
+    CHECK(store->next_segment_seq > 4 * (uint32_t)store->segment_count);
+
+    // The store is still usable after all the cuts
+    model_t next = cur;
+    for (int i = 0; i < 100; i++)
+    {
+        CHECK(step(store, &next, &version));
+        cur = next;
+    }
+    CHECK(model_equal(store, &cur));
+
+    fr_store_close(store);
+    remove(TEST_PATH);
+    printf("store: ok\n");
+    return 0;
+}
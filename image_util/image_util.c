@@ -0,0 +1,3207 @@
+/*
+  * ESPRESSIF MIT License
+  *
+  * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+  *
+  * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+  * it is free of charge, to any person obtaining a copy of this software and associated
+  * documentation files (the "Software"), to deal in the Software without restriction, including
+  * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+  * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+  * to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all copies or
+  * substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+  * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+  * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+  *
+  */
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+#include "image_util.h"
+#include "esp_timer.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IMAGE_NMS_AVX 1
+#define IMAGE_MOTION_SSSE3 1
+#define IMAGE_RESIZE_SSE2 1
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define IMAGE_NMS_NEON 1
+#define IMAGE_MOTION_NEON 1
+#define IMAGE_RESIZE_NEON 1
+#endif
+
+#define IMAGE_NMS_INSERTION_SORT_MAX 32 /* shorter buffers are insertion sorted, longer ones radix sorted */
+
+#define IMAGE_RESIZER_ROW_SHIFT 4 /* fraction bits of the rows between the horizontal and the vertical pass */
+
+void image_zoom_in_twice(uint8_t *dimage,
+                         int dw,
+                         int dh,
+                         int dc,
+                         uint8_t *simage,
+                         int sw,
+                         int sc)
+{
+    for (int dyi = 0; dyi < dh; dyi++)
+    {
+        int _di = dyi * dw;
+
+        int _si0 = dyi * 2 * sw;
+        int _si1 = _si0 + sw;
+
+        for (int dxi = 0; dxi < dw; dxi++)
+        {
+            int di = (_di + dxi) * dc;
+            int si0 = (_si0 + dxi * 2) * sc;
+            int si1 = (_si1 + dxi * 2) * sc;
+
+            if (1 == dc)
+            {
+                dimage[di] = (uint8_t)((simage[si0] + simage[si0 + 1] + simage[si1] + simage[si1 + 1]) >> 2);
+            }
+            else if (3 == dc)
+            {
+                dimage[di] = (uint8_t)((simage[si0] + simage[si0 + 3] + simage[si1] + simage[si1 + 3]) >> 2);
+                dimage[di + 1] = (uint8_t)((simage[si0 + 1] + simage[si0 + 4] + simage[si1 + 1] + simage[si1 + 4]) >> 2);
+                dimage[di + 2] = (uint8_t)((simage[si0 + 2] + simage[si0 + 5] + simage[si1 + 2] + simage[si1 + 5]) >> 2);
+            }
+            else
+            {
+                for (int dci = 0; dci < dc; dci++)
+                {
+                    dimage[di + dci] = (uint8_t)((simage[si0 + dci] + simage[si0 + 3 + dci] + simage[si1 + dci] + simage[si1 + 3 + dci] + 2) >> 2);
+                }
+            }
+        }
+    }
+    return;
+}
+
+void image_resize_linear(uint8_t *dst_image, uint8_t *src_image, int dst_w, int dst_h, int dst_c, int src_w, int src_h)
+{ /*{{{*/
+    float scale_x = (float)src_w / dst_w;
+    float scale_y = (float)src_h / dst_h;
+
+    int dst_stride = dst_c * dst_w;
+    int src_stride = dst_c * src_w;
+
+    if (fabs(scale_x - 2) <= 1e-6 && fabs(scale_y - 2) <= 1e-6)
+    {
+        image_zoom_in_twice(
+            dst_image,
+            dst_w,
+            dst_h,
+            dst_c,
+            src_image,
+            src_w,
+            dst_c);
+    }
+    else
+    {
+        image_resizer_t *temp = NULL;
+        const image_resizer_t *resizer = image_resizer_get(dst_w, dst_h, src_w, src_h);
+        if (NULL == resizer)
+            resizer = temp = image_resizer_alloc(dst_w, dst_h, src_w, src_h);
+        if (NULL == resizer || image_resizer_run(resizer, dst_image, src_image, src_stride, dst_c) < 0)
+        {
+            // out of memory, per pixel in float
+            for (int y = 0; y < dst_h; y++)
+            {
+                float fy[2];
+                fy[0] = (float)((y + 0.5) * scale_y - 0.5); // y
+                int src_y = (int)fy[0];                     // y1
+                fy[0] -= src_y;                             // y - y1
+                fy[1] = 1 - fy[0];                          // y2 - y
+                src_y = DL_IMAGE_MAX(0, src_y);
+                src_y = DL_IMAGE_MIN(src_y, src_h - 2);
+
+                for (int x = 0; x < dst_w; x++)
+                {
+                    float fx[2];
+                    fx[0] = (float)((x + 0.5) * scale_x - 0.5); // x
+                    int src_x = (int)fx[0];                     // x1
+                    fx[0] -= src_x;                             // x - x1
+                    if (src_x < 0)
+                    {
+                        fx[0] = 0;
+                        src_x = 0;
+                    }
+                    if (src_x > src_w - 2)
+                    {
+                        fx[0] = 0;
+                        src_x = src_w - 2;
+                    }
+                    fx[1] = 1 - fx[0]; // x2 - x
+
+                    for (int c = 0; c < dst_c; c++)
+                    {
+                        dst_image[y * dst_stride + x * dst_c + c] = round(src_image[src_y * src_stride + src_x * dst_c + c] * fx[1] * fy[1] + src_image[src_y * src_stride + (src_x + 1) * dst_c + c] * fx[0] * fy[1] + src_image[(src_y + 1) * src_stride + src_x * dst_c + c] * fx[1] * fy[0] + src_image[(src_y + 1) * src_stride + (src_x + 1) * dst_c + c] * fx[0] * fy[0]);
+                    }
+                }
+            }
+        }
+        image_resizer_free(temp);
+    }
+} /*}}}*/
+
+#define IMAGE_RESIZER_TABLE_SIZE(dst_w, dst_h) ((size_t)((dst_w) + (dst_h)) * (sizeof(int) + sizeof(int16_t)))
+
+/*
+ * Compute the tables of a geometry into 'tables', IMAGE_RESIZER_TABLE_SIZE bytes.
+ */
+static void image_resizer_init(image_resizer_t *resizer, void *tables, int dst_w, int dst_h, int src_w, int src_h)
+{ /*{{{*/
+    resizer->dst_w = dst_w;
+    resizer->dst_h = dst_h;
+    resizer->src_w = src_w;
+    resizer->src_h = src_h;
+    resizer->x_index = (int *)tables;
+    resizer->y_index = resizer->x_index + dst_w;
+    resizer->x_weight = (int16_t *)(resizer->y_index + dst_h);
+    resizer->y_weight = resizer->x_weight + dst_w;
+
+    // the coordinates of image_resize_linear, the weight of the upper row is not reset when clamped
+    float scale_x = (float)src_w / dst_w;
+    float scale_y = (float)src_h / dst_h;
+    for (int y = 0; y < dst_h; y++)
+    {
+        float fy = (float)((y + 0.5) * scale_y - 0.5);
+        int src_y = (int)fy;
+        fy -= src_y;
+        src_y = DL_IMAGE_MIN(src_y, src_h - 2);
+        resizer->y_index[y] = DL_IMAGE_MAX(0, src_y);
+        resizer->y_weight[y] = lrintf(fy * (1 << IMAGE_RESIZER_SHIFT));
+    }
+    for (int x = 0; x < dst_w; x++)
+    {
+        float fx = (float)((x + 0.5) * scale_x - 0.5);
+        int src_x = (int)fx;
+        fx -= src_x;
+        if (src_x < 0 || src_x > src_w - 2)
+        {
+            fx = 0;
+            src_x = DL_IMAGE_MAX(0, DL_IMAGE_MIN(src_x, src_w - 2));
+        }
+        resizer->x_index[x] = src_x;
+        resizer->x_weight[x] = lrintf(fx * (1 << IMAGE_RESIZER_SHIFT));
+    }
+} /*}}}*/
+
+image_resizer_t *image_resizer_alloc(int dst_w, int dst_h, int src_w, int src_h)
+{ /*{{{*/
+    image_resizer_t *resizer = (image_resizer_t *)dl_lib_malloc(sizeof(image_resizer_t) + IMAGE_RESIZER_TABLE_SIZE(dst_w, dst_h), 1, 0);
+    if (resizer)
+        image_resizer_init(resizer, resizer + 1, dst_w, dst_h, src_w, src_h);
+    return resizer;
+} /*}}}*/
+
+void image_resizer_free(image_resizer_t *resizer)
+{ /*{{{*/
+    dl_lib_free(resizer);
+} /*}}}*/
+
+const image_resizer_t *image_resizer_get(int dst_w, int dst_h, int src_w, int src_h)
+{ /*{{{*/
+    // Slots are filled once and never freed, so readers need no lock.
+    static image_resizer_t *cache[IMAGE_RESIZER_CACHE_NUMBER];
+    image_resizer_t *resizer = NULL;
+    for (int i = 0; i < IMAGE_RESIZER_CACHE_NUMBER; i++)
+    {
+        image_resizer_t *slot = __atomic_load_n(&cache[i], __ATOMIC_ACQUIRE);
+        if (NULL == slot)
+        {
+            // cached tables outlive the frame, keep them out of the arena and plan
+            if (NULL == resizer)
+            {
+                resizer = (image_resizer_t *)dl_lib_heap_malloc(sizeof(image_resizer_t) + IMAGE_RESIZER_TABLE_SIZE(dst_w, dst_h), 1, 0);
+                if (NULL == resizer)
+                    return NULL;
+                image_resizer_init(resizer, resizer + 1, dst_w, dst_h, src_w, src_h);
+            }
+            if (__atomic_compare_exchange_n(&cache[i], &slot, resizer, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                return resizer;
+            // another task took the slot, slot is its resizer now
+        }
+        if (slot->dst_w == dst_w && slot->dst_h == dst_h && slot->src_w == src_w && slot->src_h == src_h)
+        {
+            image_resizer_free(resizer);
+            return slot;
+        }
+    }
+    image_resizer_free(resizer);
+    return NULL;
+} /*}}}*/
+
+/*
+ * Horizontal pass of one source row, Q IMAGE_RESIZER_ROW_SHIFT.
+ */
+static void image_resizer_row(const image_resizer_t *resizer, int16_t *dst, const uint8_t *src, int c)
+{ /*{{{*/
+    const int shift = IMAGE_RESIZER_SHIFT - IMAGE_RESIZER_ROW_SHIFT;
+    const int one = 1 << IMAGE_RESIZER_SHIFT;
+    const int right = resizer->src_w > 1 ? c : 0;
+    if (3 == c)
+    {
+        for (int x = 0; x < resizer->dst_w; x++)
+        {
+            const uint8_t *s = src + resizer->x_index[x] * 3;
+            int w1 = resizer->x_weight[x];
+            int w0 = one - w1;
+            dst[0] = (s[0] * w0 + s[right] * w1 + (1 << (shift - 1))) >> shift;
+            dst[1] = (s[1] * w0 + s[right + 1] * w1 + (1 << (shift - 1))) >> shift;
+            dst[2] = (s[2] * w0 + s[right + 2] * w1 + (1 << (shift - 1))) >> shift;
+            dst += 3;
+        }
+        return;
+    }
+    for (int x = 0; x < resizer->dst_w; x++)
+    {
+        const uint8_t *s = src + resizer->x_index[x] * c;
+        int w1 = resizer->x_weight[x];
+        int w0 = one - w1;
+        for (int i = 0; i < c; i++)
+            dst[i] = (s[i] * w0 + s[right + i] * w1 + (1 << (shift - 1))) >> shift;
+        dst += c;
+    }
+} /*}}}*/
+
+/*
+ * Vertical pass, dst[i] = round(row0[i] * (1 - w1) + row1[i] * w1) of n values.
+ */
+typedef void (*image_resizer_blend_t)(int16_t *dst, const int16_t *row0, const int16_t *row1, int w1, int n);
+
+#define IMAGE_RESIZER_BLEND_SHIFT (IMAGE_RESIZER_SHIFT + IMAGE_RESIZER_ROW_SHIFT)
+
+static void image_resizer_blend_c(int16_t *dst, const int16_t *row0, const int16_t *row1, int w1, int n)
+{ /*{{{*/
+    int w0 = (1 << IMAGE_RESIZER_SHIFT) - w1;
+    for (int i = 0; i < n; i++)
+        dst[i] = (row0[i] * w0 + row1[i] * w1 + (1 << (IMAGE_RESIZER_BLEND_SHIFT - 1))) >> IMAGE_RESIZER_BLEND_SHIFT;
+} /*}}}*/
+
+#if IMAGE_RESIZE_SSE2
+__attribute__((target("sse2"))) static void image_resizer_blend_sse2(int16_t *dst, const int16_t *row0, const int16_t *row1, int w1, int n)
+{ /*{{{*/
+    int w0 = (1 << IMAGE_RESIZER_SHIFT) - w1;
+    __m128i weight = _mm_set1_epi32((w0 & 0xffff) | (w1 << 16));
+    __m128i round = _mm_set1_epi32(1 << (IMAGE_RESIZER_BLEND_SHIFT - 1));
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(row0 + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(row1 + i));
+        // pairs (row0, row1) times (w0, w1), summed by madd
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), weight);
+        __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), weight);
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, round), IMAGE_RESIZER_BLEND_SHIFT);
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, round), IMAGE_RESIZER_BLEND_SHIFT);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(lo, hi));
+    }
+    image_resizer_blend_c(dst + i, row0 + i, row1 + i, w1, n - i);
+} /*}}}*/
+#endif
+
+#if IMAGE_RESIZE_NEON
+static void image_resizer_blend_neon(int16_t *dst, const int16_t *row0, const int16_t *row1, int w1, int n)
+{ /*{{{*/
+    int16x4_t weight0 = vdup_n_s16((1 << IMAGE_RESIZER_SHIFT) - w1);
+    int16x4_t weight1 = vdup_n_s16(w1);
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        int16x8_t a = vld1q_s16(row0 + i);
+        int16x8_t b = vld1q_s16(row1 + i);
+        int32x4_t lo = vmlal_s16(vmull_s16(vget_low_s16(a), weight0), vget_low_s16(b), weight1);
+        int32x4_t hi = vmlal_s16(vmull_s16(vget_high_s16(a), weight0), vget_high_s16(b), weight1);
+        vst1q_s16(dst + i, vcombine_s16(vrshrn_n_s32(lo, IMAGE_RESIZER_BLEND_SHIFT), vrshrn_n_s32(hi, IMAGE_RESIZER_BLEND_SHIFT)));
+    }
+    image_resizer_blend_c(dst + i, row0 + i, row1 + i, w1, n - i);
+} /*}}}*/
+#endif
+
+static image_resizer_blend_t image_resizer_blend_kernel(void)
+{ /*{{{*/
+    // Selection is idempotent, a race between threads only repeats it.
+    static image_resizer_blend_t selected = NULL;
+    if (selected)
+        return selected;
+
+    selected = image_resizer_blend_c;
+#if IMAGE_RESIZE_SSE2
+    __builtin_cpu_init();
+    if (!getenv("ESP_FACE_HOST_NO_SIMD") && __builtin_cpu_supports("sse2"))
+        selected = image_resizer_blend_sse2;
+#endif
+#if IMAGE_RESIZE_NEON
+    if (!getenv("ESP_FACE_HOST_NO_SIMD"))
+        selected = image_resizer_blend_neon;
+#endif
+    return selected;
+} /*}}}*/
+
+static const uint8_t *image_frame_row(const image_frame_t *frame, int x, int y, int w, uint8_t *rows, int *cached);
+
+/*
+ * Bytes of scratch of image_resizer_apply, src_w is the widest region read from a frame.
+ */
+static size_t image_resizer_scratch_size(int dst_w, int c, const image_frame_t *frame, int src_w)
+{ /*{{{*/
+    bool convert = frame && IMAGE_PIXEL_RGB888 != frame->format;
+    return 3 * dst_w * c * sizeof(int16_t) + (convert ? 2 * src_w * 3 : 0);
+} /*}}}*/
+
+/*
+ * Resample rows of src_image, or of a region of a frame when frame is not NULL,
+ * into dst_image, or into dst_q quantized by shift when dst_image is NULL.
+ * Each source row is filtered horizontally once and kept while the next output row needs it.
+ * The scratch is allocated when 'scratch' is NULL.
+ */
+static int image_resizer_apply(const image_resizer_t *resizer, uint8_t *dst_image, qtp_t *dst_q, int shift, int c,
+                               const uint8_t *src_image, int src_stride, const image_frame_t *frame, int x, int y, void *scratch)
+{ /*{{{*/
+    int n = resizer->dst_w * c;
+    int16_t *buffer = (int16_t *)scratch;
+    if (NULL == scratch)
+    {
+        buffer = (int16_t *)dl_lib_malloc(image_resizer_scratch_size(resizer->dst_w, c, frame, resizer->src_w), 1, 0);
+        if (NULL == buffer)
+            return -1;
+    }
+    int16_t *rows[2] = {buffer, buffer + n};
+    int16_t *out = buffer + 2 * n;
+    uint8_t *frame_rows = (uint8_t *)(buffer + 3 * n);
+    int frame_cached[2] = {-1, -1};
+    int held[2] = {-1, -1};
+
+    image_resizer_blend_t blend = image_resizer_blend_kernel();
+    int below = resizer->src_h > 1 ? 1 : 0;
+    for (int dy = 0; dy < resizer->dst_h; dy++)
+    {
+        int src_y = resizer->y_index[dy];
+        if (held[0] != src_y)
+        {
+            if (held[1] == src_y)
+            {
+                int16_t *t = rows[0];
+                rows[0] = rows[1];
+                rows[1] = t;
+                held[0] = src_y;
+                held[1] = -1;
+            }
+            else
+            {
+                const uint8_t *src = frame ? image_frame_row(frame, x, y + src_y, resizer->src_w, frame_rows, frame_cached) : src_image + src_y * src_stride;
+                image_resizer_row(resizer, rows[0], src, c);
+                held[0] = src_y;
+            }
+        }
+        if (held[1] != src_y + below)
+        {
+            const uint8_t *src = frame ? image_frame_row(frame, x, y + src_y + below, resizer->src_w, frame_rows, frame_cached) : src_image + (src_y + below) * src_stride;
+            image_resizer_row(resizer, rows[1], src, c);
+            held[1] = src_y + below;
+        }
+
+        blend(out, rows[0], rows[1], resizer->y_weight[dy], n);
+        if (dst_image)
+        {
+            uint8_t *d = dst_image + dy * n;
+            for (int i = 0; i < n; i++)
+                d[i] = DL_IMAGE_MIN(DL_IMAGE_MAX(out[i], 0), 255);
+        }
+        else
+        {
+            qtp_t *d = dst_q + dy * n;
+            for (int i = 0; i < n; i++)
+                d[i] = out[i] << shift;
+        }
+    }
+
+    if (NULL == scratch)
+        dl_lib_free(buffer);
+    return 0;
+} /*}}}*/
+
+int image_resizer_run(const image_resizer_t *resizer, uint8_t *dst_image, const uint8_t *src_image, int src_stride, int c)
+{ /*{{{*/
+    return image_resizer_apply(resizer, dst_image, NULL, 0, c, src_image, src_stride, NULL, 0, 0, NULL);
+} /*}}}*/
+
+int image_resizer_run_q(const image_resizer_t *resizer, qtp_t *dst_image, const uint8_t *src_image, int src_stride, int c, int shift)
+{ /*{{{*/
+    return image_resizer_apply(resizer, NULL, dst_image, shift, c, src_image, src_stride, NULL, 0, 0, NULL);
+} /*}}}*/
+
+/*
+ * Pixels [x, x + w) of row y of a frame in RGB888. RGB888 rows are returned in place,
+ * other formats are converted into the buffer of the row parity, unless it holds the row already.
+ */
+static const uint8_t *image_frame_row(const image_frame_t *frame, int x, int y, int w, uint8_t *rows, int *cached)
+{ /*{{{*/
+    const uint8_t *row = frame->data + y * frame->stride;
+    if (IMAGE_PIXEL_RGB888 == frame->format)
+        return row + x * 3;
+
+    uint8_t *dst = rows + (y & 1) * w * 3;
+    if (cached[y & 1] == y)
+        return dst;
+    cached[y & 1] = y;
+
+    if (IMAGE_PIXEL_RGB565 == frame->format)
+    {
+        for (int i = 0; i < w; i++)
+            rgb565_to_888(row[(x + i) * 2] | row[(x + i) * 2 + 1] << 8, dst + i * 3);
+    }
+    else
+    {
+        for (int i = 0; i < w; i++)
+        {
+            const uint8_t *pair = row + ((x + i) & ~1) * 2;
+            yuv_to_888(row[(x + i) * 2], pair[1], pair[3], dst + i * 3);
+        }
+    }
+    return dst;
+} /*}}}*/
+
+/*
+ * image_zoom_in_twice of a region of a frame, rows holds 2 converted rows of w pixels.
+ */
+static void image_frame_zoom_in_twice(uint8_t *dst_image, int dst_w, int dst_h, const image_frame_t *frame, int x, int y, int w, uint8_t *rows)
+{ /*{{{*/
+    int cached[2] = {-1, -1};
+    for (int dy = 0; dy < dst_h; dy++)
+    {
+        const uint8_t *s0 = image_frame_row(frame, x, y + dy * 2, w, rows, cached);
+        const uint8_t *s1 = image_frame_row(frame, x, y + dy * 2 + 1, w, rows, cached);
+        uint8_t *d = dst_image + dy * dst_w * 3;
+        for (int dx = 0; dx < dst_w; dx++)
+        {
+            for (int c = 0; c < 3; c++)
+                d[c] = (uint8_t)((s0[c] + s0[3 + c] + s1[c] + s1[3 + c]) >> 2);
+            d += 3;
+            s0 += 6;
+            s1 += 6;
+        }
+    }
+} /*}}}*/
+
+int image_frame_resize(uint8_t *dst_image, int dst_w, int dst_h, const image_frame_t *frame, int x, int y, int w, int h)
+{ /*{{{*/
+    float scale_x = (float)w / dst_w;
+    float scale_y = (float)h / dst_h;
+
+    if (fabs(scale_x - 2) <= 1e-6 && fabs(scale_y - 2) <= 1e-6)
+    {
+        // image_zoom_in_twice
+        uint8_t *rows = NULL;
+        if (IMAGE_PIXEL_RGB888 != frame->format)
+        {
+            rows = (uint8_t *)dl_lib_malloc(2 * w * 3, sizeof(uint8_t), 0);
+            if (NULL == rows)
+            {
+                memset(dst_image, 0, dst_w * dst_h * 3);
+                return -1;
+            }
+        }
+        image_frame_zoom_in_twice(dst_image, dst_w, dst_h, frame, x, y, w, rows);
+        dl_lib_free(rows);
+    }
+    else
+    {
+        // image_resize_linear, the tables of whole frames are kept for the next frames
+        bool whole = 0 == x && 0 == y && w == frame->w && h == frame->h && frame->stride == w * (IMAGE_PIXEL_RGB888 == frame->format ? 3 : 2);
+        image_resizer_t *temp = NULL;
+        const image_resizer_t *resizer = whole ? image_resizer_get(dst_w, dst_h, w, h) : NULL;
+        if (NULL == resizer)
+            resizer = temp = image_resizer_alloc(dst_w, dst_h, w, h);
+        int ret = resizer ? image_resizer_apply(resizer, dst_image, NULL, 0, 3, NULL, 0, frame, x, y, NULL) : -1;
+        image_resizer_free(temp);
+        if (ret < 0)
+        {
+            memset(dst_image, 0, dst_w * dst_h * 3);
+            return -1;
+        }
+    }
+    return 0;
+} /*}}}*/
+
+int image_crop_resize_batch(uint8_t *dst_image, int dst_w, int dst_h, const image_frame_t *frame, const box_t *boxes, int n)
+{ /*{{{*/
+    int max_w = 0;
+    for (int i = 0; i < n; i++)
+        max_w = DL_IMAGE_MAX(max_w, (int)(round(boxes[i].box_p[2]) - round(boxes[i].box_p[0]) + 1));
+
+    // one buffer for the tables and the rows of every crop
+    size_t table_size = IMAGE_RESIZER_TABLE_SIZE(dst_w, dst_h);
+    size_t scratch_size = DL_IMAGE_MAX(image_resizer_scratch_size(dst_w, 3, frame, max_w), (size_t)2 * max_w * 3);
+    uint8_t *buffer = (uint8_t *)dl_lib_malloc(table_size + scratch_size, 1, 0);
+    if (NULL == buffer)
+    {
+        memset(dst_image, 0, (size_t)n * dst_w * dst_h * 3);
+        return -1;
+    }
+    void *scratch = buffer + table_size;
+
+    image_resizer_t resizer;
+    for (int i = 0; i < n; i++)
+    {
+        int x = round(boxes[i].box_p[0]);
+        int y = round(boxes[i].box_p[1]);
+        int w = round(boxes[i].box_p[2]) - x + 1;
+        int h = round(boxes[i].box_p[3]) - y + 1;
+        uint8_t *dst = dst_image + (size_t)i * dst_w * dst_h * 3;
+
+        if (fabs((float)w / dst_w - 2) <= 1e-6 && fabs((float)h / dst_h - 2) <= 1e-6)
+        {
+            image_frame_zoom_in_twice(dst, dst_w, dst_h, frame, x, y, w, (uint8_t *)scratch);
+        }
+        else
+        {
+            image_resizer_init(&resizer, buffer, dst_w, dst_h, w, h);
+            image_resizer_apply(&resizer, dst, NULL, 0, 3, NULL, 0, frame, x, y, scratch);
+        }
+    }
+
+    dl_lib_free(buffer);
+    return 0;
+} /*}}}*/
+
+void image_cropper(uint8_t *rot_data, uint8_t *src_data, int rot_w, int rot_h, int rot_c, int src_w, int src_h, float rotate_angle, float ratio, float *center)
+{ /*{{{*/
+    int rot_stride = rot_w * rot_c;
+    float rot_w_start = 0.5f - (float)rot_w / 2;
+    float rot_h_start = 0.5f - (float)rot_h / 2;
+
+    //rotate_angle must be radius
+    float si = sin(rotate_angle);
+    float co = cos(rotate_angle);
+
+    int src_stride = src_w * rot_c;
+
+    for (int y = 0; y < rot_h; y++)
+    {
+        for (int x = 0; x < rot_w; x++)
+        {
+            float xs, ys, xr, yr;
+            xs = ratio * (rot_w_start + x);
+            ys = ratio * (rot_h_start + y);
+
+            xr = xs * co + ys * si;
+            yr = -xs * si + ys * co;
+
+            float fy[2];
+            fy[0] = center[1] + yr; // y
+            int src_y = (int)fy[0]; // y1
+            fy[0] -= src_y;         // y - y1
+            fy[1] = 1 - fy[0];      // y2 - y
+            src_y = DL_IMAGE_MAX(0, src_y);
+            src_y = DL_IMAGE_MIN(src_y, src_h - 2);
+
+            float fx[2];
+            fx[0] = center[0] + xr; // x
+            int src_x = (int)fx[0]; // x1
+            fx[0] -= src_x;         // x - x1
+            if (src_x < 0)
+            {
+                fx[0] = 0;
+                src_x = 0;
+            }
+            if (src_x > src_w - 2)
+            {
+                fx[0] = 0;
+                src_x = src_w - 2;
+            }
+            fx[1] = 1 - fx[0]; // x2 - x
+
+            for (int c = 0; c < rot_c; c++)
+            {
+                rot_data[y * rot_stride + x * rot_c + c] = round(src_data[src_y * src_stride + src_x * rot_c + c] * fx[1] * fy[1] + src_data[src_y * src_stride + (src_x + 1) * rot_c + c] * fx[0] * fy[1] + src_data[(src_y + 1) * src_stride + src_x * rot_c + c] * fx[1] * fy[0] + src_data[(src_y + 1) * src_stride + (src_x + 1) * rot_c + c] * fx[0] * fy[0]);
+            }
+        }
+    }
+} /*}}}*/
+
+static image_box_t *image_merge_by_score(image_box_t *a, image_box_t *b)
+{ /*{{{*/
+    // On equal scores the boxes of a come first
+    image_box_t *head = NULL;
+    image_box_t **tail = &head;
+    while (a && b)
+    {
+        if (b->score > a->score)
+        {
+            *tail = b;
+            b = b->next;
+        }
+        else
+        {
+            *tail = a;
+            a = a->next;
+        }
+        tail = &((*tail)->next);
+    }
+    *tail = a ? a : b;
+    return head;
+} /*}}}*/
+
+static image_box_t *image_sort_by_score(image_box_t *list)
+{ /*{{{*/
+    // Bottom-up merge sort, runs[i] is a sorted run of 2^i boxes
+    image_box_t *runs[32] = {NULL};
+    while (list)
+    {
+        image_box_t *run = list;
+        list = list->next;
+        run->next = NULL;
+
+        int i = 0;
+        for (; runs[i]; i++)
+        {
+            run = image_merge_by_score(runs[i], run);
+            runs[i] = NULL;
+        }
+        runs[i] = run;
+    }
+
+    image_box_t *sorted = NULL;
+    for (int i = 0; i < 32; i++)
+        sorted = image_merge_by_score(runs[i], sorted);
+    return sorted;
+} /*}}}*/
+
+void image_sort_insert_by_score(image_list_t *image_sorted_list, const image_list_t *insert_list)
+{ /*{{{*/
+    if (insert_list == NULL || insert_list->head == NULL)
+        return;
+    image_box_t *sorted = image_sort_by_score(insert_list->head);
+    image_sorted_list->head = image_merge_by_score(image_sorted_list->head, sorted);
+    image_sorted_list->len += insert_list->len;
+} /*}}}*/
+
+image_list_t *image_get_valid_boxes(fptp_t *score,
+                                    fptp_t *offset,
+                                    fptp_t *landmark,
+                                    int width,
+                                    int height,
+                                    int anchor_number,
+                                    int *anchors_size,
+                                    fptp_t score_threshold,
+                                    int stride,
+                                    fptp_t y_resize_scale,
+                                    fptp_t x_resize_scale,
+                                    bool do_regression)
+{ /*{{{*/
+    typedef struct
+    {
+        short x;
+        short y;
+        int index;
+        uc_t anchor_index;
+    } valid_index_t;
+    valid_index_t *valid_indexes = (valid_index_t *)dl_lib_calloc(width * height, sizeof(valid_index_t), 0);
+    int valid_count = 0;
+    int index = 0;
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            for (size_t c = 0; c < anchor_number; c++)
+            {
+                if (score[2 * index + 1] > score_threshold)
+                {
+                    valid_indexes[valid_count].x = x;
+                    valid_indexes[valid_count].y = y;
+                    valid_indexes[valid_count].index = index;
+                    valid_indexes[valid_count].anchor_index = c;
+                    valid_count++;
+                }
+                index++;
+            }
+        }
+    }
+
+    if (0 == valid_count)
+    {
+        dl_lib_free(valid_indexes);
+        return NULL;
+    }
+
+    image_box_t *valid_box = (image_box_t *)dl_lib_calloc(valid_count, sizeof(image_box_t), 0);
+    image_list_t *valid_list = (image_list_t *)dl_lib_calloc(1, sizeof(image_list_t), 0);
+    valid_list->head = valid_box;
+    valid_list->origin_head = valid_box;
+    valid_list->len = valid_count;
+
+    if (do_regression)
+    {
+        for (int i = 0; i < valid_count; i++)
+        {
+            // TODO: score
+            valid_box[i].score = score[2 * valid_indexes[i].index + 1];
+
+            // TODO: box
+            int anchor_size = anchors_size[valid_indexes[i].anchor_index];
+            int anchor_left_up_x = valid_indexes[i].x * stride;
+            int anchor_left_up_y = valid_indexes[i].y * stride;
+            
+
+            valid_box[i].box.box_p[0] = (offset[valid_indexes[i].index * 4 + 0] * anchor_size + anchor_left_up_x) / x_resize_scale;
+            valid_box[i].box.box_p[1] = (offset[valid_indexes[i].index * 4 + 1] * anchor_size + anchor_left_up_y) / y_resize_scale;
+            valid_box[i].box.box_p[2] = (offset[valid_indexes[i].index * 4 + 2] * anchor_size + anchor_left_up_x + anchor_size - 1) / x_resize_scale;
+            valid_box[i].box.box_p[3] = (offset[valid_indexes[i].index * 4 + 3] * anchor_size + anchor_left_up_y + anchor_size - 1) / y_resize_scale;
+
+            // TODO: landmark
+            if (landmark)
+            {
+                valid_box[i].landmark.landmark_p[0] = (landmark[valid_indexes[i].index * 10 + 0] * anchor_size + anchor_left_up_x) / x_resize_scale;
+                valid_box[i].landmark.landmark_p[1] = (landmark[valid_indexes[i].index * 10 + 1] * anchor_size + anchor_left_up_y) / y_resize_scale;
+                valid_box[i].landmark.landmark_p[2] = (landmark[valid_indexes[i].index * 10 + 2] * anchor_size + anchor_left_up_x) / x_resize_scale;
+                valid_box[i].landmark.landmark_p[3] = (landmark[valid_indexes[i].index * 10 + 3] * anchor_size + anchor_left_up_y) / y_resize_scale;
+                valid_box[i].landmark.landmark_p[4] = (landmark[valid_indexes[i].index * 10 + 4] * anchor_size + anchor_left_up_x) / x_resize_scale;
+                valid_box[i].landmark.landmark_p[5] = (landmark[valid_indexes[i].index * 10 + 5] * anchor_size + anchor_left_up_y) / y_resize_scale;
+                valid_box[i].landmark.landmark_p[6] = (landmark[valid_indexes[i].index * 10 + 6] * anchor_size + anchor_left_up_x) / x_resize_scale;
+                valid_box[i].landmark.landmark_p[7] = (landmark[valid_indexes[i].index * 10 + 7] * anchor_size + anchor_left_up_y) / y_resize_scale;
+                valid_box[i].landmark.landmark_p[8] = (landmark[valid_indexes[i].index * 10 + 8] * anchor_size + anchor_left_up_x) / x_resize_scale;
+                valid_box[i].landmark.landmark_p[9] = (landmark[valid_indexes[i].index * 10 + 9] * anchor_size + anchor_left_up_y) / y_resize_scale;
+            }
+            valid_box[i].next = &(valid_box[i + 1]);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < valid_count; i++)
+        {
+            valid_box[i].score = score[2 * valid_indexes[i].index + 1];
+
+            int anchor_size = anchors_size[valid_indexes[i].anchor_index];
+            valid_box[i].box.box_p[0] = valid_indexes[i].x / x_resize_scale * stride;
+            valid_box[i].box.box_p[1] = valid_indexes[i].y / y_resize_scale * stride;
+            valid_box[i].box.box_p[2] = valid_box[i].box.box_p[0] + anchor_size / x_resize_scale;
+            valid_box[i].box.box_p[3] = valid_box[i].box.box_p[1] + anchor_size / y_resize_scale;
+
+            valid_box[i].offset.box_p[0] = offset[valid_indexes[i].index * 4 + 0];
+            valid_box[i].offset.box_p[1] = offset[valid_indexes[i].index * 4 + 1];
+            valid_box[i].offset.box_p[2] = offset[valid_indexes[i].index * 4 + 2];
+            valid_box[i].offset.box_p[3] = offset[valid_indexes[i].index * 4 + 3];
+
+            if (landmark)
+                for (size_t j = 0; j < 10; j++)
+                    valid_box[i].landmark.landmark_p[j] = landmark[valid_indexes[i].index * 10 + j];
+
+            valid_box[i].next = &(valid_box[i + 1]);
+        }
+    }
+    valid_box[valid_count - 1].next = NULL;
+
+    dl_lib_free(valid_indexes);
+
+    return valid_list;
+} /*}}}*/
+
+image_nms_boxes_t *image_nms_boxes_alloc(int capacity)
+{ /*{{{*/
+    image_nms_boxes_t *boxes = (image_nms_boxes_t *)dl_lib_calloc(1, sizeof(image_nms_boxes_t), 0);
+    if (NULL == boxes)
+        return NULL;
+
+    // 6 float arrays, the categories, the ids and 3 words of scratch per box, every array starts
+    // 32-byte aligned. One spare slot past capacity holds a box while the others shift.
+    int n = (DL_IMAGE_MAX(capacity, 0) + 1 + 7) & ~7;
+    fptp_t *block = (fptp_t *)dl_lib_malloc(n * 11, sizeof(fptp_t), 32);
+    if (NULL == block)
+    {
+        dl_lib_free(boxes);
+        return NULL;
+    }
+    boxes->x1 = block;
+    boxes->y1 = block + n;
+    boxes->x2 = block + 2 * n;
+    boxes->y2 = block + 3 * n;
+    boxes->score = block + 4 * n;
+    boxes->area = block + 5 * n;
+    boxes->category = (int *)(block + 6 * n);
+    boxes->index = (int *)(block + 7 * n);
+    boxes->scratch = block + 8 * n;
+    boxes->capacity = capacity;
+    return boxes;
+} /*}}}*/
+
+void image_nms_boxes_free(image_nms_boxes_t *boxes)
+{ /*{{{*/
+    if (NULL == boxes)
+        return;
+    dl_lib_free(boxes->x1);
+    dl_lib_free(boxes);
+} /*}}}*/
+
+static inline void image_nms_boxes_copy(image_nms_boxes_t *boxes, int from, int to)
+{
+    boxes->x1[to] = boxes->x1[from];
+    boxes->y1[to] = boxes->y1[from];
+    boxes->x2[to] = boxes->x2[from];
+    boxes->y2[to] = boxes->y2[from];
+    boxes->score[to] = boxes->score[from];
+    boxes->area[to] = boxes->area[from];
+    boxes->category[to] = boxes->category[from];
+    boxes->index[to] = boxes->index[from];
+}
+
+static inline uint32_t image_nms_score_key(fptp_t score)
+{
+    // Unsigned key in the order of the floats, inverted so that ascending keys are descending scores
+    uint32_t u;
+    memcpy(&u, &score, sizeof(u));
+    u = (u & 0x80000000) ? ~u : (u | 0x80000000);
+    return ~u;
+}
+
+static void image_nms_permute_float(fptp_t *item, const int *order, fptp_t *tmp, int n)
+{
+    for (int i = 0; i < n; i++)
+        tmp[i] = item[order[i]];
+    memcpy(item, tmp, n * sizeof(fptp_t));
+}
+
+static void image_nms_permute_int(int *item, const int *order, int *tmp, int n)
+{
+    for (int i = 0; i < n; i++)
+        tmp[i] = item[order[i]];
+    memcpy(item, tmp, n * sizeof(int));
+}
+
+void image_nms_boxes_sort(image_nms_boxes_t *boxes)
+{ /*{{{*/
+    int n = boxes->len;
+    if (n < 2)
+        return;
+
+    uint32_t *key = (uint32_t *)boxes->scratch;
+    int *order = (int *)(key + n);
+    int *swap = order + n;
+    for (int i = 0; i < n; i++)
+    {
+        key[i] = image_nms_score_key(boxes->score[i]);
+        order[i] = i;
+    }
+
+    if (n <= IMAGE_NMS_INSERTION_SORT_MAX)
+    {
+        for (int i = 1; i < n; i++)
+        {
+            int o = order[i];
+            int j = i;
+            for (; j > 0 && key[order[j - 1]] > key[o]; j--)
+                order[j] = order[j - 1];
+            order[j] = o;
+        }
+    }
+    else
+    {
+        // LSD radix sort on 8-bit digits, every pass is stable
+        int count[256];
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            memset(count, 0, sizeof(count));
+            for (int i = 0; i < n; i++)
+                count[(key[order[i]] >> shift) & 0xff]++;
+
+            // Scores of one model usually share the high digits
+            if (count[(key[order[0]] >> shift) & 0xff] == n)
+                continue;
+
+            int offset = 0;
+            for (int d = 0; d < 256; d++)
+            {
+                int c = count[d];
+                count[d] = offset;
+                offset += c;
+            }
+            for (int i = 0; i < n; i++)
+                swap[count[(key[order[i]] >> shift) & 0xff]++] = order[i];
+
+            int *tmp = order;
+            order = swap;
+            swap = tmp;
+        }
+    }
+
+    // The keys are not needed anymore, their words hold the gathered items
+    fptp_t *tmp = (fptp_t *)key;
+    image_nms_permute_float(boxes->x1, order, tmp, n);
+    image_nms_permute_float(boxes->y1, order, tmp, n);
+    image_nms_permute_float(boxes->x2, order, tmp, n);
+    image_nms_permute_float(boxes->y2, order, tmp, n);
+    image_nms_permute_float(boxes->score, order, tmp, n);
+    image_nms_permute_float(boxes->area, order, tmp, n);
+    image_nms_permute_int(boxes->category, order, (int *)key, n);
+    image_nms_permute_int(boxes->index, order, (int *)key, n);
+} /*}}}*/
+
+static inline fptp_t image_nms_iou(const image_nms_boxes_t *boxes, int i, int j)
+{
+    fptp_t inter_w = DL_IMAGE_MIN(boxes->x2[i], boxes->x2[j]) - DL_IMAGE_MAX(boxes->x1[i], boxes->x1[j]) + 1;
+    fptp_t inter_h = DL_IMAGE_MIN(boxes->y2[i], boxes->y2[j]) - DL_IMAGE_MAX(boxes->y1[i], boxes->y1[j]) + 1;
+    if (inter_w <= 0 || inter_h <= 0)
+        return 0;
+    fptp_t inter_area = inter_w * inter_h;
+    return inter_area / (boxes->area[i] + boxes->area[j] - inter_area);
+}
+
+/*
+ * Flag every box in [start, end) whose IOU with box kept is above the threshold.
+ * Returns the number of boxes flagged by this call.
+ */
+typedef int (*image_nms_suppress_t)(const image_nms_boxes_t *boxes, int kept, int start, int end, const image_nms_config_t *config, int32_t *removed);
+
+static int image_nms_suppress_c(const image_nms_boxes_t *boxes, int kept, int start, int end, const image_nms_config_t *config, int32_t *removed)
+{ /*{{{*/
+    int count = 0;
+    for (int j = start; j < end; j++)
+    {
+        if (removed[j])
+            continue;
+        if (config->class_aware && boxes->category[j] != boxes->category[kept])
+            continue;
+        fptp_t inter_w = DL_IMAGE_MIN(boxes->x2[kept], boxes->x2[j]) - DL_IMAGE_MAX(boxes->x1[kept], boxes->x1[j]) + 1;
+        fptp_t inter_h = DL_IMAGE_MIN(boxes->y2[kept], boxes->y2[j]) - DL_IMAGE_MAX(boxes->y1[kept], boxes->y1[j]) + 1;
+        if (inter_w > 0 && inter_h > 0)
+        {
+            fptp_t inter_area = inter_w * inter_h;
+            fptp_t iou = inter_area / (boxes->area[kept] + boxes->area[j] - inter_area);
+            if (iou > config->nms_threshold)
+            {
+                removed[j] = -1;
+                count++;
+            }
+        }
+    }
+    return count;
+} /*}}}*/
+
+#if IMAGE_NMS_AVX
+__attribute__((target("avx"))) static int image_nms_suppress_avx(const image_nms_boxes_t *boxes, int kept, int start, int end, const image_nms_config_t *config, int32_t *removed)
+{ /*{{{*/
+    const __m256 x1 = _mm256_set1_ps(boxes->x1[kept]);
+    const __m256 y1 = _mm256_set1_ps(boxes->y1[kept]);
+    const __m256 x2 = _mm256_set1_ps(boxes->x2[kept]);
+    const __m256 y2 = _mm256_set1_ps(boxes->y2[kept]);
+    const __m256 area = _mm256_set1_ps(boxes->area[kept]);
+    const __m256 category = _mm256_set1_ps(boxes->category[kept]);
+    const __m256 any_category = _mm256_castsi256_ps(_mm256_set1_epi32(config->class_aware ? 0 : -1));
+    const __m256 threshold = _mm256_set1_ps(config->nms_threshold);
+    const __m256 one = _mm256_set1_ps(1);
+    const __m256 zero = _mm256_setzero_ps();
+
+    int count = 0;
+    int j = start;
+    for (; j + 8 <= end; j += 8)
+    {
+        __m256 inter_w = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(x2, _mm256_loadu_ps(boxes->x2 + j)), _mm256_max_ps(x1, _mm256_loadu_ps(boxes->x1 + j))), one);
+        __m256 inter_h = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(y2, _mm256_loadu_ps(boxes->y2 + j)), _mm256_max_ps(y1, _mm256_loadu_ps(boxes->y1 + j))), one);
+        __m256 inter_area = _mm256_mul_ps(inter_w, inter_h);
+        __m256 iou = _mm256_div_ps(inter_area, _mm256_sub_ps(_mm256_add_ps(area, _mm256_loadu_ps(boxes->area + j)), inter_area));
+        __m256 hit = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(inter_w, zero, _CMP_GT_OQ), _mm256_cmp_ps(inter_h, zero, _CMP_GT_OQ)), _mm256_cmp_ps(iou, threshold, _CMP_GT_OQ));
+        __m256 same = _mm256_cmp_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(boxes->category + j))), category, _CMP_EQ_OQ);
+        hit = _mm256_and_ps(hit, _mm256_or_ps(same, any_category));
+        __m256 flag = _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i *)(removed + j)));
+        count += __builtin_popcount(_mm256_movemask_ps(_mm256_andnot_ps(flag, hit)));
+        _mm256_storeu_si256((__m256i *)(removed + j), _mm256_castps_si256(_mm256_or_ps(flag, hit)));
+    }
+    return count + image_nms_suppress_c(boxes, kept, j, end, config, removed);
+} /*}}}*/
+#endif
+
+#if IMAGE_NMS_NEON
+static int image_nms_suppress_neon(const image_nms_boxes_t *boxes, int kept, int start, int end, const image_nms_config_t *config, int32_t *removed)
+{ /*{{{*/
+    const float32x4_t x1 = vdupq_n_f32(boxes->x1[kept]);
+    const float32x4_t y1 = vdupq_n_f32(boxes->y1[kept]);
+    const float32x4_t x2 = vdupq_n_f32(boxes->x2[kept]);
+    const float32x4_t y2 = vdupq_n_f32(boxes->y2[kept]);
+    const float32x4_t area = vdupq_n_f32(boxes->area[kept]);
+    const int32x4_t category = vdupq_n_s32(boxes->category[kept]);
+    const uint32x4_t any_category = vdupq_n_u32(config->class_aware ? 0 : 0xffffffff);
+    const float32x4_t threshold = vdupq_n_f32(config->nms_threshold);
+    const float32x4_t one = vdupq_n_f32(1);
+    const float32x4_t zero = vdupq_n_f32(0);
+
+    int count = 0;
+    int j = start;
+    for (; j + 4 <= end; j += 4)
+    {
+        float32x4_t inter_w = vaddq_f32(vsubq_f32(vminq_f32(x2, vld1q_f32(boxes->x2 + j)), vmaxq_f32(x1, vld1q_f32(boxes->x1 + j))), one);
+        float32x4_t inter_h = vaddq_f32(vsubq_f32(vminq_f32(y2, vld1q_f32(boxes->y2 + j)), vmaxq_f32(y1, vld1q_f32(boxes->y1 + j))), one);
+        float32x4_t inter_area = vmulq_f32(inter_w, inter_h);
+        float32x4_t iou = vdivq_f32(inter_area, vsubq_f32(vaddq_f32(area, vld1q_f32(boxes->area + j)), inter_area));
+        uint32x4_t hit = vandq_u32(vandq_u32(vcgtq_f32(inter_w, zero), vcgtq_f32(inter_h, zero)), vcgtq_f32(iou, threshold));
+        hit = vandq_u32(hit, vorrq_u32(vceqq_s32(vld1q_s32(boxes->category + j), category), any_category));
+        uint32x4_t flag = vld1q_u32((const uint32_t *)(removed + j));
+        count += vaddvq_u32(vshrq_n_u32(vbicq_u32(hit, flag), 31));
+        vst1q_u32((uint32_t *)(removed + j), vorrq_u32(flag, hit));
+    }
+    return count + image_nms_suppress_c(boxes, kept, j, end, config, removed);
+} /*}}}*/
+#endif
+
+static image_nms_suppress_t image_nms_suppress_kernel(void)
+{ /*{{{*/
+    // Selection is idempotent, a race between threads only repeats it.
+    static image_nms_suppress_t selected = NULL;
+    if (selected)
+        return selected;
+
+    selected = image_nms_suppress_c;
+#if IMAGE_NMS_AVX
+    __builtin_cpu_init();
+    if (!getenv("ESP_FACE_HOST_NO_SIMD") && __builtin_cpu_supports("avx"))
+        selected = image_nms_suppress_avx;
+#endif
+#if IMAGE_NMS_NEON
+    if (!getenv("ESP_FACE_HOST_NO_SIMD"))
+        selected = image_nms_suppress_neon;
+#endif
+    return selected;
+} /*}}}*/
+
+/*
+ * Move the boxes of [start, end) that are not removed to the front of the range, in their order.
+ * Returns the new end.
+ */
+static int image_nms_boxes_compact(image_nms_boxes_t *boxes, int32_t *removed, int start, int end)
+{ /*{{{*/
+    int k = start;
+    for (int j = start; j < end; j++)
+    {
+        if (removed[j])
+            continue;
+        image_nms_boxes_copy(boxes, j, k);
+        removed[k] = 0;
+        k++;
+    }
+    return k;
+} /*}}}*/
+
+static void image_nms_boxes_hard(image_nms_boxes_t *boxes, const image_nms_config_t *config)
+{ /*{{{*/
+    int end = boxes->len;
+    int max_keep = config->max_keep > 0 ? config->max_keep : end;
+    int32_t *removed = (int32_t *)boxes->scratch;
+    memset(removed, 0, end * sizeof(int32_t));
+    image_nms_suppress_t suppress = image_nms_suppress_kernel();
+
+    int kept = 0;
+    int pending = 0; // removed boxes still in [i + 1, end)
+    for (int i = 0; i < end && kept < max_keep; i++)
+    {
+        if (removed[i])
+        {
+            pending--;
+            continue;
+        }
+        // The last box needs no scan, boxes after it are never output
+        if (kept + 1 < max_keep)
+            pending += suppress(boxes, i, i + 1, end, config, removed);
+
+        // Slots before i are done with, the kept boxes are packed there
+        image_nms_boxes_copy(boxes, i, kept);
+        kept++;
+
+        // Drop the removed boxes once they are a quarter of the rest, so that later scans get shorter
+        if (pending * 4 > end - i)
+        {
+            end = image_nms_boxes_compact(boxes, removed, i + 1, end);
+            pending = 0;
+        }
+    }
+    boxes->len = kept;
+} /*}}}*/
+
+static void image_nms_boxes_soft(image_nms_boxes_t *boxes, const image_nms_config_t *config)
+{ /*{{{*/
+    int end = boxes->len;
+    int max_keep = config->max_keep > 0 ? config->max_keep : end;
+    int spare = boxes->capacity;
+
+    int kept = 0;
+    for (; kept < end && kept < max_keep; kept++)
+    {
+        // Decayed scores are out of order, take the highest one left. The boxes in
+        // between shift by one, so that equal scores keep their order.
+        int best = kept;
+        for (int j = kept + 1; j < end; j++)
+        {
+            if (boxes->score[j] > boxes->score[best])
+                best = j;
+        }
+        if (best != kept)
+        {
+            image_nms_boxes_copy(boxes, best, spare);
+            for (int j = best; j > kept; j--)
+                image_nms_boxes_copy(boxes, j - 1, j);
+            image_nms_boxes_copy(boxes, spare, kept);
+        }
+
+        int k = kept + 1;
+        for (int j = kept + 1; j < end; j++)
+        {
+            fptp_t score = boxes->score[j];
+            if (!config->class_aware || boxes->category[j] == boxes->category[kept])
+            {
+                fptp_t iou = image_nms_iou(boxes, kept, j);
+                if (IMAGE_NMS_SOFT_GAUSSIAN == config->mode)
+                    score *= expf(-iou * iou / config->sigma);
+                else if (iou > config->nms_threshold)
+                    score *= 1 - iou;
+            }
+            if (score < config->score_threshold)
+                continue;
+            image_nms_boxes_copy(boxes, j, k);
+            boxes->score[k] = score;
+            k++;
+        }
+        end = k;
+    }
+    boxes->len = kept;
+} /*}}}*/
+
+int image_nms_config_check(const image_nms_config_t *config)
+{ /*{{{*/
+    if (config->mode < IMAGE_NMS_HARD || config->mode > IMAGE_NMS_SOFT_GAUSSIAN)
+        return -1;
+    // exp(-IOU^2 / sigma) is NaN or not a decay for sigma <= 0, the test also rejects NaN
+    if (IMAGE_NMS_SOFT_GAUSSIAN == config->mode && !(config->sigma > 0))
+        return -1;
+    return 0;
+} /*}}}*/
+
+void image_nms_boxes_process(image_nms_boxes_t *boxes, const image_nms_config_t *config)
+{ /*{{{*/
+    if (IMAGE_NMS_HARD == config->mode)
+        image_nms_boxes_hard(boxes, config);
+    else
+        image_nms_boxes_soft(boxes, config);
+} /*}}}*/
+
+void image_nms_process(image_list_t *image_list, fptp_t nms_threshold, int same_area)
+{ /*{{{*/
+    int n = 0;
+    for (image_box_t *box = image_list->head; box; box = box->next)
+        n++;
+    if (n < 2)
+        return;
+
+    image_nms_boxes_t *boxes = image_nms_boxes_alloc(n);
+    image_box_t **nodes = (image_box_t **)dl_lib_malloc(n, sizeof(image_box_t *), 0);
+    if (NULL == boxes || NULL == nodes)
+    {
+        // Out of memory, the boxes are left unsuppressed
+        image_nms_boxes_free(boxes);
+        dl_lib_free(nodes);
+        return;
+    }
+
+    int i = 0;
+    for (image_box_t *box = image_list->head; box; box = box->next, i++)
+    {
+        nodes[i] = box;
+        image_nms_boxes_push(boxes, &box->box, box->score, box->category, i);
+    }
+    if (same_area)
+    {
+        for (i = 1; i < n; i++)
+            boxes->area[i] = boxes->area[0];
+    }
+
+    image_nms_config_t config = {IMAGE_NMS_HARD, nms_threshold};
+    image_nms_boxes_process(boxes, &config);
+
+    // Relink the kept boxes, they are still in score order
+    for (i = 0; i < boxes->len - 1; i++)
+        nodes[boxes->index[i]]->next = nodes[boxes->index[i + 1]];
+    nodes[boxes->index[boxes->len - 1]]->next = NULL;
+    image_list->head = nodes[boxes->index[0]];
+    image_list->len -= n - boxes->len;
+
+    image_nms_boxes_free(boxes);
+    dl_lib_free(nodes);
+} /*}}}*/
+
+void image_rgb565_to_888(uint8_t *m, uint16_t *bmp, int count)
+{ /*{{{*/
+    uc_t dst[24];
+    for (int x = 0; x < count; x += 8)
+    {
+        rgb565_to_888(*bmp++, dst);
+        rgb565_to_888(*bmp++, dst + 3);
+        rgb565_to_888(*bmp++, dst + 6);
+        rgb565_to_888(*bmp++, dst + 9);
+        rgb565_to_888(*bmp++, dst + 12);
+        rgb565_to_888(*bmp++, dst + 15);
+        rgb565_to_888(*bmp++, dst + 18);
+        rgb565_to_888(*bmp++, dst + 21);
+        memcpy(m + x * 3, dst, 24 * sizeof(uint8_t));
+    }
+} /*}}}*/
+
+void image_rgb888_to_565(uint16_t *bmp, uint8_t *m, int count)
+{ /*{{{*/
+    for (int x = 0; x < count; x++)
+    {
+        rgb888_to_565(bmp, m[2], m[1], m[0]);
+        bmp++;
+        m += 3;
+    }
+} /*}}}*/
+
+void transform_output_image_adjustable(uint16_t *bmp, uint8_t *m, int src_w, int src_h, int dst_w, int dst_h)
+{ /*{{{*/
+    if (src_w == dst_w && src_h == dst_h)
+        image_rgb888_to_565(bmp, m, src_h*src_w);
+    else
+    {
+        for (int y = 0; y < dst_h; y++)
+        {
+            m += (src_w - dst_w) / 2 * 3;
+            for (int x = 0; x < dst_w; x++)
+            {
+                rgb888_to_565(bmp, m[2], m[1], m[0]);
+                bmp++;
+                m += 3;
+            }
+            m += (src_w - dst_w) / 2 * 3;
+        }
+    }
+} /*}}}*/
+
+void draw_rectangle_rgb565(uint16_t *buf, box_array_t *boxes, int width)
+{ /*{{{*/
+    uint16_t p[14];
+    for (int i = 0; i < boxes->len; i++)
+    {
+        // rectangle box
+        for (int j = 0; j < 4; j++)
+            p[j] = (uint16_t)boxes->box[i].box_p[j];
+
+        // landmark
+        for (int j = 0; j < 10; j++)
+            p[j + 4] = (uint16_t)boxes->landmark[i].landmark_p[j];
+
+        if ((p[2] < p[0]) || (p[3] < p[1]))
+            return;
+
+        // rectangle box
+        for (int w = p[0]; w < p[2] + 1; w++)
+        {
+            int x1 = (p[1] * width + w);
+            int x2 = (p[3] * width + w);
+            buf[x1] = RGB565_MASK_GREEN;
+            buf[x2] = RGB565_MASK_GREEN;
+        }
+        for (int h = p[1]; h < p[3] + 1; h++)
+        {
+            int y1 = (h * width + p[0]);
+            int y2 = (h * width + p[2]);
+            buf[y1] = RGB565_MASK_GREEN;
+            buf[y2] = RGB565_MASK_GREEN;
+        }
+
+        // landmark
+        for (int j = 0; j < 10; j += 2)
+        {
+            int x = p[j + 5] * width + p[j + 4];
+            buf[x] = RGB565_MASK_RED;
+            buf[x + 1] = RGB565_MASK_RED;
+            buf[x + 2] = RGB565_MASK_RED;
+
+            buf[width + x] = RGB565_MASK_RED;
+            buf[width + x + 1] = RGB565_MASK_RED;
+            buf[width + x + 2] = RGB565_MASK_RED;
+
+            buf[2 * width + x] = RGB565_MASK_RED;
+            buf[2 * width + x + 1] = RGB565_MASK_RED;
+            buf[2 * width + x + 2] = RGB565_MASK_RED;
+        }
+    }
+} /*}}}*/
+
+void draw_rectangle_rgb888(uint8_t *buf, box_array_t *boxes, int width)
+{ /*{{{*/
+    uint16_t p[14];
+    for (int i = 0; i < boxes->len; i++)
+    {
+        // rectangle box
+        for (int j = 0; j < 4; j++)
+            p[j] = (uint16_t)boxes->box[i].box_p[j];
+
+        // landmark
+        for (int j = 0; j < 10; j++)
+            p[j + 4] = (uint16_t)boxes->landmark[i].landmark_p[j];
+
+        if ((p[2] < p[0]) || (p[3] < p[1]))
+            return;
+
+#define DRAW_PIXEL_GREEN(BUF, X) \
+    do                           \
+    {                            \
+        BUF[X + 0] = 0;          \
+        BUF[X + 1] = 0xFF;       \
+        BUF[X + 2] = 0;          \
+    } while (0)
+
+        // rectangle box
+        for (int w = p[0]; w < p[2] + 1; w++)
+        {
+            int x1 = (p[1] * width + w) * 3;
+            int x2 = (p[3] * width + w) * 3;
+            DRAW_PIXEL_GREEN(buf, x1);
+            DRAW_PIXEL_GREEN(buf, x2);
+        }
+        for (int h = p[1]; h < p[3] + 1; h++)
+        {
+            int y1 = (h * width + p[0]) * 3;
+            int y2 = (h * width + p[2]) * 3;
+            DRAW_PIXEL_GREEN(buf, y1);
+            DRAW_PIXEL_GREEN(buf, y2);
+        }
+
+        // landmark
+        for (int j = 0; j < 10; j += 2)
+        {
+            int x = (p[j + 5] * width + p[j + 4]) * 3;
+            DRAW_PIXEL_GREEN(buf, x);
+            DRAW_PIXEL_GREEN(buf, x + 3);
+            DRAW_PIXEL_GREEN(buf, x + 6);
+
+            DRAW_PIXEL_GREEN(buf, width * 3 + x);
+            DRAW_PIXEL_GREEN(buf, width * 3 + x + 3);
+            DRAW_PIXEL_GREEN(buf, width * 3 + x + 6);
+
+            DRAW_PIXEL_GREEN(buf, width * 6 + x);
+            DRAW_PIXEL_GREEN(buf, width * 6 + x + 3);
+            DRAW_PIXEL_GREEN(buf, width * 6 + x + 6);
+        }
+    }
+} /*}}}*/
+
+void image_abs_diff(uint8_t *dst, uint8_t *src1, uint8_t *src2, int count)
+{
+    while (count > 0)
+    {
+        *dst = (uint8_t)abs((int)*src1 - (int)*src2);
+        dst++;
+        src1++;
+        src2++;
+        count--;
+    }
+}
+
+void image_threshold(uint8_t *dst, uint8_t *src, int threshold, int value, int count, en_threshold_mode mode)
+{
+    int l_val = 0;
+    int r_val = 0;
+    switch (mode)
+    {
+    case BINARY:
+        r_val = value;
+        break;
+    default:
+        break;
+    }
+    while (count > 0)
+    {
+        *dst = (*src > threshold) ? r_val : l_val;
+
+        dst++;
+        src++;
+        count--;
+    }
+}
+
+void image_kernel_get_min(uint8_t *dst, uint8_t *src, int w, int h, int c, int stride)
+{
+    uint8_t min1 = 255;
+    uint8_t min2 = 255;
+    uint8_t min3 = 255;
+
+    if (c == 3)
+    {
+        for (int j = 0; j < h; j++)
+        {
+            for (int i = 0; i < w; i++)
+            {
+                if (src[0] < min1)
+                    min1 = src[0];
+                if (src[1] < min2)
+                    min2 = src[1];
+                if (src[2] < min3)
+                    min3 = src[2];
+                src += 3;
+            }
+            src += stride - w * 3;
+        }
+        dst[0] = min1;
+        dst[1] = min2;
+        dst[2] = min3;
+    }
+    else if (c == 1)
+    {
+        for (int j = 0; j < h; j++)
+        {
+            for (int i = 0; i < w; i++)
+            {
+                if (src[0] < min1)
+                    min1 = src[0];
+                src += 1;
+            }
+            src += stride - w;
+        }
+        dst[0] = min1;
+    }
+    else
+    {
+    }
+}
+/*
+ * By default 3x3 Kernel, so padding is 2
+ */
+void image_erode(uint8_t *dst, uint8_t *src, int src_w, int src_h, int src_c)
+{
+    int stride = src_w * src_c;
+
+    // 1st row, 1st col
+    image_kernel_get_min(dst, src, 2, 2, src_c, stride);
+    dst += src_c;
+
+    // 1st row
+    for (int i = 1; i < src_w - 1; i++)
+    {
+        image_kernel_get_min(dst, src, 3, 2, src_c, stride);
+        dst += src_c;
+        src += src_c;
+    }
+
+    // 1st row, last col
+    image_kernel_get_min(dst, src, 2, 2, src_c, stride);
+    dst += src_c;
+    src -= src_c * (src_w - 2);
+
+    for (int j = 1; j < src_h - 1; j++)
+    {
+        // 1st col
+        image_kernel_get_min(dst, src, 2, 3, src_c, stride);
+        dst += src_c;
+
+        for (int i = 1; i < src_w - 1; i++)
+        {
+            image_kernel_get_min(dst, src, 3, 3, src_c, stride);
+            dst += src_c;
+            src += src_c;
+        }
+
+        // last col
+        image_kernel_get_min(dst, src, 2, 3, src_c, stride);
+        dst += src_c;
+        src += src_c * 2;
+    }
+
+    // last row
+    image_kernel_get_min(dst, src, 2, 2, src_c, stride);
+    dst += src_c;
+
+    for (int i = 1; i < src_w - 1; i++)
+    {
+        image_kernel_get_min(dst, src, 3, 2, src_c, stride);
+        dst += src_c;
+        src += src_c;
+    }
+
+    // last row, last col
+    image_kernel_get_min(dst, src, 2, 2, src_c, stride);
+}
+
+/*
+ * One row of motion flags: 255 where every channel differs by more than threshold.
+ */
+typedef void (*image_motion_row_t)(uint8_t *dst, const uint8_t *src1, const uint8_t *src2, int w, int c, int threshold);
+
+static void image_motion_row_c(uint8_t *dst, const uint8_t *src1, const uint8_t *src2, int w, int c, int threshold)
+{ /*{{{*/
+    for (int x = 0; x < w; x++)
+    {
+        uint8_t moved = 255;
+        for (int k = 0; k < c; k++)
+        {
+            if (abs((int)src1[k] - (int)src2[k]) <= threshold)
+                moved = 0;
+        }
+        dst[x] = moved;
+        src1 += c;
+        src2 += c;
+    }
+} /*}}}*/
+
+#if IMAGE_MOTION_SSSE3
+/*
+ * 0xff in every byte whose difference is above t.
+ */
+__attribute__((target("ssse3"))) static inline __m128i image_motion_moved_ssse3(const uint8_t *src1, const uint8_t *src2, __m128i t)
+{ /*{{{*/
+    __m128i a = _mm_loadu_si128((const __m128i *)src1);
+    __m128i b = _mm_loadu_si128((const __m128i *)src2);
+    __m128i d = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+    return _mm_xor_si128(_mm_cmpeq_epi8(_mm_subs_epu8(d, t), _mm_setzero_si128()), _mm_set1_epi8(-1));
+} /*}}}*/
+
+__attribute__((target("ssse3"))) static void image_motion_row_ssse3(uint8_t *dst, const uint8_t *src1, const uint8_t *src2, int w, int c, int threshold)
+{ /*{{{*/
+    if ((c != 1 && c != 3) || threshold < 0 || threshold > 255)
+    {
+        image_motion_row_c(dst, src1, src2, w, c, threshold);
+        return;
+    }
+
+    __m128i t = _mm_set1_epi8((char)threshold);
+    int x = 0;
+    if (c == 1)
+    {
+        for (; x + 16 <= w; x += 16)
+            _mm_storeu_si128((__m128i *)(dst + x), image_motion_moved_ssse3(src1 + x, src2 + x, t));
+    }
+    else
+    {
+        // Byte 3p of h0 | h1 | h2 is the AND of the 3 channels of pixel p, then every third byte is gathered
+        const __m128i g0 = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m128i g1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+        const __m128i g2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+        for (; x + 16 <= w; x += 16)
+        {
+            const uint8_t *s1 = src1 + 3 * x;
+            const uint8_t *s2 = src2 + 3 * x;
+            __m128i f0 = image_motion_moved_ssse3(s1, s2, t);
+            __m128i f1 = image_motion_moved_ssse3(s1 + 16, s2 + 16, t);
+            __m128i f2 = image_motion_moved_ssse3(s1 + 32, s2 + 32, t);
+            __m128i h0 = _mm_and_si128(f0, _mm_and_si128(_mm_alignr_epi8(f1, f0, 1), _mm_alignr_epi8(f1, f0, 2)));
+            __m128i h1 = _mm_and_si128(f1, _mm_and_si128(_mm_alignr_epi8(f2, f1, 1), _mm_alignr_epi8(f2, f1, 2)));
+            __m128i h2 = _mm_and_si128(f2, _mm_and_si128(_mm_srli_si128(f2, 1), _mm_srli_si128(f2, 2)));
+            __m128i r = _mm_or_si128(_mm_shuffle_epi8(h0, g0), _mm_or_si128(_mm_shuffle_epi8(h1, g1), _mm_shuffle_epi8(h2, g2)));
+            _mm_storeu_si128((__m128i *)(dst + x), r);
+        }
+    }
+    image_motion_row_c(dst + x, src1 + x * c, src2 + x * c, w - x, c, threshold);
+} /*}}}*/
+#endif
+
+#if IMAGE_MOTION_NEON
+static void image_motion_row_neon(uint8_t *dst, const uint8_t *src1, const uint8_t *src2, int w, int c, int threshold)
+{ /*{{{*/
+    if ((c != 1 && c != 3) || threshold < 0 || threshold > 255)
+    {
+        image_motion_row_c(dst, src1, src2, w, c, threshold);
+        return;
+    }
+
+    uint8x16_t t = vdupq_n_u8((uint8_t)threshold);
+    int x = 0;
+    if (c == 1)
+    {
+        for (; x + 16 <= w; x += 16)
+            vst1q_u8(dst + x, vcgtq_u8(vabdq_u8(vld1q_u8(src1 + x), vld1q_u8(src2 + x)), t));
+    }
+    else
+    {
+        for (; x + 16 <= w; x += 16)
+        {
+            uint8x16x3_t a = vld3q_u8(src1 + 3 * x);
+            uint8x16x3_t b = vld3q_u8(src2 + 3 * x);
+            uint8x16_t r = vcgtq_u8(vabdq_u8(a.val[0], b.val[0]), t);
+            r = vandq_u8(r, vcgtq_u8(vabdq_u8(a.val[1], b.val[1]), t));
+            r = vandq_u8(r, vcgtq_u8(vabdq_u8(a.val[2], b.val[2]), t));
+            vst1q_u8(dst + x, r);
+        }
+    }
+    image_motion_row_c(dst + x, src1 + x * c, src2 + x * c, w - x, c, threshold);
+} /*}}}*/
+#endif
+
+static image_motion_row_t image_motion_row_kernel(void)
+{ /*{{{*/
+    // Selection is idempotent, a race between threads only repeats it.
+    static image_motion_row_t selected = NULL;
+    if (selected)
+        return selected;
+
+    selected = image_motion_row_c;
+#if IMAGE_MOTION_SSSE3
+    __builtin_cpu_init();
+    if (!getenv("ESP_FACE_HOST_NO_SIMD") && __builtin_cpu_supports("ssse3"))
+        selected = image_motion_row_ssse3;
+#endif
+#if IMAGE_MOTION_NEON
+    if (!getenv("ESP_FACE_HOST_NO_SIMD"))
+        selected = image_motion_row_neon;
+#endif
+    return selected;
+} /*}}}*/
+
+/*
+ * The frames are read once, row by row. The flags of the last 3 rows stay in a
+ * rolling window, each output row is their vertical then horizontal 3 wide AND.
+ * With packed, the row is stored as bits.
+ */
+static int image_motion_mask_rows(uint8_t *mask, const uint8_t *src1, const uint8_t *src2, int w, int h, int c, int threshold, bool packed)
+{ /*{{{*/
+    // 3 rows of flags, the vertical AND and the output row
+    uint8_t *rows = (uint8_t *)dl_lib_malloc(5 * w, sizeof(uint8_t), 0);
+    if (NULL == rows)
+        return -1;
+    uint8_t *v = rows + 3 * w;
+    uint8_t *out = rows + 4 * w;
+
+    image_motion_row_t motion_row = image_motion_row_kernel();
+    int stride = w * c;
+    int count = 0;
+    motion_row(rows, src1, src2, w, c, threshold);
+    for (int y = 0; y < h; y++)
+    {
+        if (y + 1 < h)
+            motion_row(rows + (y + 1) % 3 * w, src1 + (y + 1) * stride, src2 + (y + 1) * stride, w, c, threshold);
+
+        const uint8_t *up = rows + (y ? y - 1 : y) % 3 * w;
+        const uint8_t *center = rows + y % 3 * w;
+        const uint8_t *down = rows + (y + 1 < h ? y + 1 : y) % 3 * w;
+        for (int x = 0; x < w; x++)
+            v[x] = up[x] & center[x] & down[x];
+
+        uint8_t *dst = packed ? out : mask + y * w;
+        dst[0] = v[0] & v[DL_IMAGE_MIN(1, w - 1)];
+        for (int x = 1; x < w - 1; x++)
+            dst[x] = v[x - 1] & v[x] & v[x + 1];
+        if (w > 1)
+            dst[w - 1] = v[w - 2] & v[w - 1];
+
+        for (int x = 0; x < w; x++)
+            count += dst[x] & 1;
+
+        if (packed)
+        {
+            // Multiplying moves bit 0 of byte k to bit 56 + k (little endian)
+            uint8_t *bits = mask + y * ((w + 7) / 8);
+            int x = 0;
+            for (; x + 8 <= w; x += 8)
+            {
+                uint64_t b;
+                memcpy(&b, out + x, sizeof(b));
+                bits[x / 8] = ((b & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56;
+            }
+            if (x < w)
+            {
+                uint8_t b = 0;
+                for (int k = 0; x + k < w; k++)
+                    b |= (out[x + k] & 1) << k;
+                bits[x / 8] = b;
+            }
+        }
+    }
+
+    dl_lib_free(rows);
+    return count;
+} /*}}}*/
+
+int image_motion_mask(uint8_t *mask, uint8_t *src1, uint8_t *src2, int w, int h, int c, int threshold)
+{ /*{{{*/
+    return image_motion_mask_rows(mask, src1, src2, w, h, c, threshold, false);
+} /*}}}*/
+
+int image_motion_mask_packed(uint8_t *mask, uint8_t *src1, uint8_t *src2, int w, int h, int c, int threshold)
+{ /*{{{*/
+    return image_motion_mask_rows(mask, src1, src2, w, h, c, threshold, true);
+} /*}}}*/
+
+typedef struct
+{
+    int parent; /*!< union-find parent, itself for a root */
+    int area;   /*!< pixels of the region, valid on the root */
+    int x1;     /*!< bounding box, valid on the root */
+    int y1;
+    int x2;
+    int y2;
+} image_region_t;
+
+typedef struct
+{
+    int x1;     /*!< first pixel */
+    int x2;     /*!< last pixel */
+    int region; /*!< region of the run */
+} image_run_t;
+
+static int image_region_find(image_region_t *regions, int i)
+{ /*{{{*/
+    while (regions[i].parent != i)
+    {
+        regions[i].parent = regions[regions[i].parent].parent;
+        i = regions[i].parent;
+    }
+    return i;
+} /*}}}*/
+
+static int image_region_union(image_region_t *regions, int a, int b)
+{ /*{{{*/
+    a = image_region_find(regions, a);
+    b = image_region_find(regions, b);
+    if (a == b)
+        return a;
+    if (b < a)
+    {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    regions[b].parent = a;
+    regions[a].area += regions[b].area;
+    regions[a].x1 = DL_IMAGE_MIN(regions[a].x1, regions[b].x1);
+    regions[a].y1 = DL_IMAGE_MIN(regions[a].y1, regions[b].y1);
+    regions[a].x2 = DL_IMAGE_MAX(regions[a].x2, regions[b].x2);
+    regions[a].y2 = DL_IMAGE_MAX(regions[a].y2, regions[b].y2);
+    return a;
+} /*}}}*/
+
+static int image_region_compare(const void *a, const void *b)
+{ /*{{{*/
+    return ((const image_region_t *)b)->area - ((const image_region_t *)a)->area;
+} /*}}}*/
+
+static inline bool image_motion_pixel(const uint8_t *row, int x, bool packed)
+{ /*{{{*/
+    return packed ? (row[x >> 3] >> (x & 7)) & 1 : row[x] != 0;
+} /*}}}*/
+
+static int image_motion_rois_rows(box_t *rois, int max_rois, const uint8_t *mask, int w, int h, fptp_t scale, int min_area, bool packed)
+{ /*{{{*/
+    int run_capacity = (w + 1) / 2;
+    int capacity = 64;
+    int region_number = 0;
+    image_run_t *runs = (image_run_t *)dl_lib_malloc(2 * run_capacity, sizeof(image_run_t), 0);
+    image_region_t *regions = (image_region_t *)dl_lib_malloc(capacity, sizeof(image_region_t), 0);
+    if (NULL == runs || NULL == regions)
+    {
+        dl_lib_free(runs);
+        dl_lib_free(regions);
+        return -1;
+    }
+
+    // Runs of the row above and of this row, a run joins the 8-connected runs above it
+    image_run_t *above = runs;
+    image_run_t *row = runs + run_capacity;
+    int above_number = 0;
+    for (int y = 0; y < h; y++)
+    {
+        const uint8_t *m = mask + y * (packed ? (w + 7) / 8 : w);
+        int row_number = 0;
+        int a = 0;
+        for (int x = 0; x < w; x++)
+        {
+            if (packed && 0 == (x & 7) && 0 == m[x >> 3])
+            {
+                x += 7;
+                continue;
+            }
+            if (!image_motion_pixel(m, x, packed))
+                continue;
+            int x1 = x;
+            while (x + 1 < w && image_motion_pixel(m, x + 1, packed))
+                x++;
+
+            if (region_number == capacity)
+            {
+                image_region_t *grown = (image_region_t *)dl_lib_malloc(2 * capacity, sizeof(image_region_t), 0);
+                if (NULL == grown)
+                {
+                    dl_lib_free(runs);
+                    dl_lib_free(regions);
+                    return -1;
+                }
+                memcpy(grown, regions, capacity * sizeof(image_region_t));
+                dl_lib_free(regions);
+                regions = grown;
+                capacity *= 2;
+            }
+            int r = region_number++;
+            regions[r] = (image_region_t){r, x - x1 + 1, x1, y, x, y};
+
+            while (a < above_number && above[a].x2 < x1 - 1)
+                a++;
+            for (int k = a; k < above_number && above[k].x1 <= x + 1; k++)
+                r = image_region_union(regions, r, above[k].region);
+
+            row[row_number++] = (image_run_t){x1, x, r};
+        }
+
+        image_run_t *t = above;
+        above = row;
+        row = t;
+        above_number = row_number;
+    }
+    dl_lib_free(runs);
+
+    int n = 0;
+    for (int i = 0; i < region_number; i++)
+    {
+        if (regions[i].parent == i && regions[i].area >= min_area)
+            regions[n++] = regions[i];
+    }
+    qsort(regions, n, sizeof(image_region_t), image_region_compare);
+
+    n = DL_IMAGE_MIN(n, max_rois);
+    for (int i = 0; i < n; i++)
+    {
+        rois[i].box_p[0] = regions[i].x1 / scale;
+        rois[i].box_p[1] = regions[i].y1 / scale;
+        rois[i].box_p[2] = (regions[i].x2 + 1) / scale - 1;
+        rois[i].box_p[3] = (regions[i].y2 + 1) / scale - 1;
+    }
+    dl_lib_free(regions);
+    return n;
+} /*}}}*/
+
+int image_motion_rois(box_t *rois, int max_rois, const uint8_t *mask, int w, int h, fptp_t scale, int min_area)
+{ /*{{{*/
+    return image_motion_rois_rows(rois, max_rois, mask, w, h, scale, min_area, false);
+} /*}}}*/
+
+int image_motion_rois_packed(box_t *rois, int max_rois, const uint8_t *mask, int w, int h, fptp_t scale, int min_area)
+{ /*{{{*/
+    return image_motion_rois_rows(rois, max_rois, mask, w, h, scale, min_area, true);
+} /*}}}*/
+
+int image_rois_merge(box_t *dst, const box_t *rois, int n, int min_side, int width, int height)
+{ /*{{{*/
+    for (int i = 0; i < n; i++)
+    {
+        for (int k = 0; k < 2; k++)
+        {
+            int size = (k ? height : width);
+            int side = DL_IMAGE_MIN(size, min_side);
+            int p1 = (int)floorf(rois[i].box_p[k]);
+            int p2 = (int)ceilf(rois[i].box_p[k + 2]);
+            if (p2 - p1 + 1 < side)
+            {
+                p1 -= (side - (p2 - p1 + 1)) / 2;
+                p2 = p1 + side - 1;
+            }
+            if (p1 < 0)
+            {
+                p2 -= p1;
+                p1 = 0;
+            }
+            if (p2 > size - 1)
+            {
+                p1 = DL_IMAGE_MAX(0, p1 - (p2 - size + 1));
+                p2 = size - 1;
+            }
+            dst[i].box_p[k] = p1;
+            dst[i].box_p[k + 2] = p2;
+        }
+    }
+
+    // Merge until no two regions overlap, a merged region may overlap the ones checked before
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = i + 1; j < n;)
+            {
+                if (dst[j].box_p[0] > dst[i].box_p[2] || dst[j].box_p[2] < dst[i].box_p[0] ||
+                    dst[j].box_p[1] > dst[i].box_p[3] || dst[j].box_p[3] < dst[i].box_p[1])
+                {
+                    j++;
+                    continue;
+                }
+                dst[i].box_p[0] = DL_IMAGE_MIN(dst[i].box_p[0], dst[j].box_p[0]);
+                dst[i].box_p[1] = DL_IMAGE_MIN(dst[i].box_p[1], dst[j].box_p[1]);
+                dst[i].box_p[2] = DL_IMAGE_MAX(dst[i].box_p[2], dst[j].box_p[2]);
+                dst[i].box_p[3] = DL_IMAGE_MAX(dst[i].box_p[3], dst[j].box_p[3]);
+                dst[j] = dst[--n];
+                merged = true;
+            }
+        }
+    }
+    return n;
+} /*}}}*/
+
+Matrix *matrix_alloc(int h, int w)
+{
+    Matrix *r = calloc(1, sizeof(Matrix));
+    r->w = w;
+    r->h = h;
+    r->array = calloc(h, sizeof(matrixType *));
+    for (int i = 0; i < h; i++)
+    {
+        r->array[i] = calloc(w, sizeof(matrixType));
+    }
+    return r;
+}
+
+void matrix_free(Matrix *m)
+{
+    for (int i = 0; i < m->h; i++)
+    {
+        free(m->array[i]);
+    }
+    free(m->array);
+    free(m);
+    //m = NULL;
+}
+
+void matrix_print(Matrix *m)
+{
+    printf("Matrix: %dx%d\n", m->h, m->w);
+    for (int i = 0; i < m->h; i++)
+    {
+        for (int j = 0; j < m->w; j++)
+        {
+            printf("%f ", m->array[i][j]);
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
+
+Matrix *malloc_rand_matrix(int h, int w, int thresh)
+{
+    Matrix *m = matrix_alloc(h, w);
+    unsigned int seed = esp_timer_get_time();
+    srand(seed);
+    for (int i = 0; i < m->h; i++)
+    {
+        for (int j = 0; j < m->w; j++)
+        {
+            m->array[i][j] = rand() % thresh;
+        }
+    }
+    return m;
+}
+
+int image_affine_transform(image_affine_t *T, const float *srcx, const float *srcy, const float *dstx, const float *dsty, int num)
+{ /*{{{*/
+    double src_mean_x = 0, src_mean_y = 0, dst_mean_x = 0, dst_mean_y = 0;
+    for (int i = 0; i < num; i++)
+    {
+        src_mean_x += srcx[i];
+        src_mean_y += srcy[i];
+        dst_mean_x += dstx[i];
+        dst_mean_y += dsty[i];
+    }
+    src_mean_x /= num;
+    src_mean_y /= num;
+    dst_mean_x /= num;
+    dst_mean_y /= num;
+
+    // normal equations of the demeaned points: [row] * C = B[row]
+    double cxx = 0, cxy = 0, cyy = 0;
+    double bxx = 0, bxy = 0, byx = 0, byy = 0;
+    for (int i = 0; i < num; i++)
+    {
+        double x = srcx[i] - src_mean_x;
+        double y = srcy[i] - src_mean_y;
+        double u = dstx[i] - dst_mean_x;
+        double v = dsty[i] - dst_mean_y;
+        cxx += x * x;
+        cxy += x * y;
+        cyy += y * y;
+        bxx += u * x;
+        bxy += u * y;
+        byx += v * x;
+        byy += v * y;
+    }
+    double det = cxx * cyy - cxy * cxy;
+    if (det <= 1e-12 * (cxx * cyy))
+        return -1;
+
+    double m00 = (bxx * cyy - bxy * cxy) / det;
+    double m01 = (bxy * cxx - bxx * cxy) / det;
+    double m10 = (byx * cyy - byy * cxy) / det;
+    double m11 = (byy * cxx - byx * cxy) / det;
+    T->m[0][0] = m00;
+    T->m[0][1] = m01;
+    T->m[0][2] = dst_mean_x - (m00 * src_mean_x + m01 * src_mean_y);
+    T->m[1][0] = m10;
+    T->m[1][1] = m11;
+    T->m[1][2] = dst_mean_y - (m10 * src_mean_x + m11 * src_mean_y);
+    return 0;
+} /*}}}*/
+
+int image_similarity_transform(image_affine_t *T, const float *srcx, const float *srcy, const float *dstx, const float *dsty, int num)
+{ /*{{{*/
+    double src_mean_x = 0, src_mean_y = 0, dst_mean_x = 0, dst_mean_y = 0;
+    for (int i = 0; i < num; i++)
+    {
+        src_mean_x += srcx[i];
+        src_mean_y += srcy[i];
+        dst_mean_x += dstx[i];
+        dst_mean_y += dsty[i];
+    }
+    src_mean_x /= num;
+    src_mean_y /= num;
+    dst_mean_x /= num;
+    dst_mean_y /= num;
+
+    // the least squares scaled rotation [a -b; b a] of the demeaned points
+    double var = 0, dot = 0, cross = 0;
+    for (int i = 0; i < num; i++)
+    {
+        double x = srcx[i] - src_mean_x;
+        double y = srcy[i] - src_mean_y;
+        double u = dstx[i] - dst_mean_x;
+        double v = dsty[i] - dst_mean_y;
+        var += x * x + y * y;
+        dot += u * x + v * y;
+        cross += v * x - u * y;
+    }
+    if (var == 0 || (dot == 0 && cross == 0))
+        return -1;
+
+    double a = dot / var;
+    double b = cross / var;
+    T->m[0][0] = a;
+    T->m[0][1] = -b;
+    T->m[0][2] = dst_mean_x - (a * src_mean_x - b * src_mean_y);
+    T->m[1][0] = b;
+    T->m[1][1] = a;
+    T->m[1][2] = dst_mean_y - (b * src_mean_x + a * src_mean_y);
+    return 0;
+} /*}}}*/
+
+static Matrix *image_affine_to_matrix(const image_affine_t *T)
+{ /*{{{*/
+    Matrix *m = matrix_alloc(2, 3);
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 3; j++)
+            m->array[i][j] = T->m[i][j];
+    return m;
+} /*}}}*/
+
+Matrix *get_affine_transform(float *srcx, float *srcy, float *dstx, float *dsty)
+{
+    image_affine_t T;
+    if (image_affine_transform(&T, srcx, srcy, dstx, dsty, 3) < 0)
+    {
+        printf("the src is linearly dependent\n");
+        return NULL;
+    }
+    return image_affine_to_matrix(&T);
+}
+
+Matrix *get_inv_affine_matrix(Matrix *m)
+{
+    Matrix *minv = matrix_alloc(2, 3);
+    float mdet = (m->array[0][0]) * (m->array[1][1]) - (m->array[1][0]) * (m->array[0][1]);
+    if (mdet == 0)
+    {
+        printf("the matrix m is wrong !\n");
+        return NULL;
+    }
+
+    minv->array[0][0] = m->array[1][1] / mdet;
+    minv->array[0][1] = -(m->array[0][1] / mdet);
+    minv->array[0][2] = ((m->array[0][1]) * (m->array[1][2]) - (m->array[0][2]) * (m->array[1][1])) / mdet;
+    minv->array[1][0] = -(m->array[1][0]) / mdet;
+    minv->array[1][1] = (m->array[0][0]) / mdet;
+    minv->array[1][2] = ((m->array[0][2]) * (m->array[1][0]) - (m->array[0][0]) * (m->array[1][2])) / mdet;
+    return minv;
+}
+
+Matrix *get_inverse_matrix(Matrix *m)
+{
+    if (m->w != m->h)
+    {
+        printf("the input is not a square matrix !\n");
+        return NULL;
+    }
+
+    Matrix *matw = matrix_alloc(m->h, 2 * (m->w));
+    Matrix *inv = matrix_alloc(m->h, m->w);
+    matrixType **w = matw->array;
+    float eps = 1e-6;
+
+    for (int i = 0; i < matw->h; i++)
+    {
+        for (int j = 0; j < m->w; j++)
+        {
+            w[i][j] = m->array[i][j];
+        }
+        w[i][(m->w) + i] = 1;
+    }
+
+    for (int i = 0; i < matw->h; i++)
+    {
+        if (fabs(w[i][i]) < eps)
+        {
+            int j;
+            for (j = i + 1; j < matw->h; j++)
+            {
+                if (fabs(w[j][i]) > eps)
+                    break;
+            }
+            if (j == matw->h)
+            {
+                printf("This matrix is irreversible!\n");
+                return NULL;
+            }
+            for (int k = i; k < matw->w; k++)
+            {
+                w[i][k] += w[j][k];
+            }
+        }
+        float factor = w[i][i];
+        for (int k = i; k < matw->w; k++)
+        {
+            w[i][k] /= factor;
+        }
+        for (int k = i + 1; k < matw->h; k++)
+        {
+            factor = -w[k][i];
+            for (int l = i; l < matw->w; l++)
+            {
+                w[k][l] += (factor * w[i][l]);
+            }
+        }
+    }
+    for (int i = (matw->h) - 1; i > 0; i--)
+    {
+        for (int j = i - 1; j >= 0; j--)
+        {
+            float factor = -w[j][i];
+            for (int k = i; k < matw->w; k++)
+            {
+                w[j][k] += (factor * w[i][k]);
+            }
+        }
+    }
+    for (int i = 0; i < m->h; i++)
+    {
+        for (int j = 0; j < m->w; j++)
+        {
+            inv->array[i][j] = w[i][(m->h) + j];
+        }
+    }
+    return inv;
+}
+
+Matrix *get_perspective_transform(float *srcx, float *srcy, float *dstx, float *dsty)
+{
+    // the 8 unknowns of m from the 4 point pairs, by gauss elimination with partial pivoting
+    double A[8][9];
+    for (int i = 0; i < 4; i++)
+    {
+        double r0[9] = {srcx[i], srcy[i], 1, 0, 0, 0, -dstx[i] * srcx[i], -dstx[i] * srcy[i], dstx[i]};
+        double r1[9] = {0, 0, 0, srcx[i], srcy[i], 1, -dsty[i] * srcx[i], -dsty[i] * srcy[i], dsty[i]};
+        memcpy(A[i], r0, sizeof(r0));
+        memcpy(A[i + 4], r1, sizeof(r1));
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        int pivot = i;
+        for (int j = i + 1; j < 8; j++)
+        {
+            if (fabs(A[j][i]) > fabs(A[pivot][i]))
+                pivot = j;
+        }
+        if (fabs(A[pivot][i]) < 1e-12)
+        {
+            printf("This matrix is irreversible!\n");
+            return NULL;
+        }
+        if (pivot != i)
+        {
+            double row[9];
+            memcpy(row, A[i], sizeof(row));
+            memcpy(A[i], A[pivot], sizeof(row));
+            memcpy(A[pivot], row, sizeof(row));
+        }
+        for (int j = 0; j < 8; j++)
+        {
+            if (j == i)
+                continue;
+            double factor = A[j][i] / A[i][i];
+            for (int k = i; k < 9; k++)
+                A[j][k] -= factor * A[i][k];
+        }
+    }
+
+    Matrix *m = matrix_alloc(3, 3);
+    for (int i = 0; i < 8; i++)
+    {
+        m->array[i / 3][i % 3] = A[i][8] / A[i][i];
+    }
+    m->array[2][2] = 1;
+    return m;
+}
+
+uint8_t get_otsu_thresh(dl_matrix3du_t *img)
+{
+    int numPixels = img->w * img->h;
+
+    const int HISTOGRAM_SIZE = 256;
+    unsigned int histogram[HISTOGRAM_SIZE];
+    memset(histogram, 0, (HISTOGRAM_SIZE) * sizeof(unsigned int));
+    uint8_t *ptr = img->item;
+    int length = numPixels;
+    while (length--)
+    {
+        uint8_t value = *ptr++;
+        histogram[value]++;
+    }
+
+    int sum = 0;
+    for (int i = 0; i < HISTOGRAM_SIZE; ++i)
+    {
+        sum += i * histogram[i];
+    }
+
+    int sumB = 0;
+    int q1 = 0;
+    double max = 0;
+    uint8_t threshold = 0;
+    for (int i = 0; i < HISTOGRAM_SIZE; ++i)
+    {
+        q1 += histogram[i];
+        if (q1 == 0)
+            continue;
+
+        const int q2 = numPixels - q1;
+        if (q2 == 0)
+            break;
+
+        sumB += i * histogram[i];
+        const double m1 = (double)sumB / q1;
+        const double m2 = ((double)sum - sumB) / q2;
+        const double m1m2 = m1 - m2;
+        const double variance = m1m2 * m1m2 * q1 * q2;
+        if (variance > max)
+        {
+            threshold = i;
+            max = variance;
+        }
+    }
+
+    return threshold;
+}
+
+dl_matrix3du_t *rgb2gray(dl_matrix3du_t *img)
+{
+    assert(img->c == 3);
+    dl_matrix3du_t *gray = dl_matrix3du_alloc(1, img->w, img->h, 1);
+    int count = (img->w) * (img->h);
+    uint8_t *r = img->item;
+    uint8_t *g = r + 1;
+    uint8_t *b = r + 2;
+
+    uint8_t *pgray = gray->item;
+    int x = 0;
+    for (int i = 0; i < count; i++)
+    {
+        x = (19595 * (*r) + 38469 * (*g) + 7472 * (*b)) >> 16; //fast algorithm
+        //Gray = R*0.299 + G*0.587 + B*0.114
+        //Gray = (R*30 + G*59 + B*11 + 50) / 100
+        //Gray = (R*38 + G*75 + B*15) >> 7
+
+        *(pgray++) = (uint8_t)x;
+
+        r += 3;
+        g += 3;
+        b += 3;
+    }
+    return gray;
+}
+
+dl_matrix3du_t *rgb2lab(dl_matrix3du_t *img)
+{
+    assert(img->c == 3);
+    dl_matrix3du_t *lab = dl_matrix3du_alloc(1, img->w, img->h, img->c);
+    int count = (img->w) * (img->h);
+    uint8_t *r = img->item;
+    uint8_t *g = r + 1;
+    uint8_t *b = r + 2;
+    float x, y, z;
+    uint8_t *plab = lab->item;
+    for (int i = 0; i < count; i++)
+    {
+        x = (0.433953 * (*r) + 0.376219 * (*g) + 0.189828 * (*b)) / 255;
+        y = (0.212671 * (*r) + 0.715160 * (*g) + 0.072169 * (*b)) / 255;
+        z = (0.017758 * (*r) + 0.109476 * (*g) + 0.872766 * (*b)) / 255;
+
+        x = (x > 0.008856) ? pow(x, 1.0 / 3) : (7.787037 * x + 0.137931);
+        y = (y > 0.008856) ? pow(y, 1.0 / 3) : (7.787037 * y + 0.137931);
+        z = (z > 0.008856) ? pow(z, 1.0 / 3) : (7.787037 * z + 0.137931);
+
+        *(plab++) = (uint8_t)(116 * y - 16);
+        *(plab++) = (uint8_t)(500 * (x - y) + 128);
+        *(plab++) = (uint8_t)(200 * (y - z) + 128);
+
+        r += 3;
+        g += 3;
+        b += 3;
+    }
+
+    return lab;
+}
+
+dl_matrix3du_t *rgb2lab_fast(dl_matrix3du_t *img)
+{
+    assert(img->c == 3);
+    dl_matrix3du_t *lab = dl_matrix3du_alloc(1, img->w, img->h, img->c);
+    int count = (img->w) * (img->h);
+    /*int c1 = 1<<16;
+	int c2 = 1<<24;*/
+    uint8_t *r = img->item;
+    uint8_t *g = r + 1;
+    uint8_t *b = r + 2;
+    int x, y, z;
+    //float temp = 0;
+    uint8_t *plab = lab->item;
+    for (int i = 0; i < count; i++)
+    {
+        x = (13933 * (*r) + 46871 * (*g) + 4732 * (*b)) >> 16;
+        y = (((5467631 * (*r) - 8376186 * (*g) + 2908178 * (*b))) >> 24) + 128;
+        z = (((2043680 * (*r) + 6351200 * (*g) - 8394880 * (*b))) >> 24) + 128;
+
+        *(plab++) = (uint8_t)x;
+        *(plab++) = (uint8_t)y;
+        *(plab++) = (uint8_t)z;
+
+        r += 3;
+        g += 3;
+        b += 3;
+    }
+
+    return lab;
+}
+
+dl_matrix3du_t *gen_binary_img(dl_matrix3du_t *lab, int *thresh)
+{
+    dl_matrix3du_t *bin = dl_matrix3du_alloc(1, lab->w, lab->h, 1);
+    uint8_t *l = lab->item;
+    uint8_t *a = l + 1;
+    uint8_t *b = l + 2;
+    uint8_t *pbin = bin->item;
+    int count = (lab->w) * (lab->h);
+    int num = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (((*l) > thresh[0]) && ((*l) < thresh[1]) && ((*a) > thresh[2]) && ((*a) < thresh[3]) && ((*b) > thresh[4]) && ((*b) < thresh[5]))
+        {
+            *(pbin++) = 255;
+            num++;
+        }
+        else
+        {
+            *(pbin++) = 0;
+        }
+        l += 3;
+        a += 3;
+        b += 3;
+    }
+
+    return bin;
+}
+
+void img_hist(dl_matrix3du_t *lab, float *rect)
+{
+    int x = (int)((lab->w) * rect[0]);
+    int y = (int)((lab->h) * rect[1]);
+    int w = (int)((lab->w) * rect[2]);
+    int h = (int)((lab->h) * rect[3]);
+
+    uint8_t *l = (lab->item) + (3 * y * lab->w) + (3 * x);
+
+    int *lHist = calloc(256, sizeof(int));
+    int *aHist = calloc(256, sizeof(int));
+    int *bHist = calloc(256, sizeof(int));
+    int num = w * h;
+
+    for (int i = 0; i < h; i++)
+    {
+        uint8_t *l_temp = l + 3 * i * lab->w;
+        uint8_t *a_temp = l_temp + 1;
+        uint8_t *b_temp = l_temp + 2;
+        for (int j = 0; j < w; j++)
+        {
+            lHist[*l_temp] += 1;
+            aHist[*a_temp] += 1;
+            bHist[*b_temp] += 1;
+            l_temp += 3;
+            a_temp += 3;
+            b_temp += 3;
+        }
+    }
+    int max[3] = {0};
+    int maxIndex[3] = {0};
+    float mean[3] = {0};
+    float std[3] = {0};
+
+    for (int i = 0; i < 256; i++)
+    {
+        mean[0] += i * lHist[i];
+        mean[1] += i * aHist[i];
+        mean[2] += i * bHist[i];
+
+        std[0] += i * i * lHist[i];
+        std[1] += i * i * aHist[i];
+        std[2] += i * i * bHist[i];
+
+        if (lHist[i] > max[0])
+        {
+            max[0] = lHist[i];
+            maxIndex[0] = i;
+        }
+        if (aHist[i] > max[1])
+        {
+            max[1] = aHist[i];
+            maxIndex[1] = i;
+        }
+        if (bHist[i] > max[2])
+        {
+            max[2] = bHist[i];
+            maxIndex[2] = i;
+        }
+    }
+    mean[0] /= num;
+    mean[1] /= num;
+    mean[2] /= num;
+
+    std[0] = sqrt((std[0] / num) - (mean[0] * mean[0]));
+    std[1] = sqrt((std[1] / num) - (mean[1] * mean[1]));
+    std[2] = sqrt((std[2] / num) - (mean[2] * mean[2]));
+    printf("L  \tmax:%d %d \tmean:%d \tstd:%d \n", maxIndex[0], max[0], (int)mean[0], (int)std[0]);
+    printf("A  \tmax:%d %d \tmean:%d \tstd:%d \n", maxIndex[1], max[1], (int)mean[1], (int)std[1]);
+    printf("B  \tmax:%d %d \tmean:%d \tstd:%d \n", maxIndex[2], max[2], (int)mean[2], (int)std[2]);
+    free(lHist);
+    free(aHist);
+    free(bHist);
+}
+
+Matrix *get_similarity_matrix(float *srcx, float *srcy, float *dstx, float *dsty, int num)
+{
+    image_affine_t T;
+    if (image_similarity_transform(&T, srcx, srcy, dstx, dsty, num) < 0)
+        return NULL;
+    return image_affine_to_matrix(&T);
+}
+
+#define IMAGE_WARP_SHIFT 16 /* fraction bits of the source coordinates of a warp */
+#define IMAGE_WARP_WEIGHT_SHIFT 11 /* fraction bits of the bilinear weights of a warp */
+
+/*
+ * Inverse of an affine matrix in Q IMAGE_WARP_SHIFT. Computed in double, so that the rounding to
+ * fixed point, and the whole warp after it, does not depend on the float unit. -1 if singular.
+ */
+static int image_affine_inverse_q(const image_affine_t *M, int32_t *inv)
+{ /*{{{*/
+    double m00 = M->m[0][0], m01 = M->m[0][1], m02 = M->m[0][2];
+    double m10 = M->m[1][0], m11 = M->m[1][1], m12 = M->m[1][2];
+    double det = m00 * m11 - m10 * m01;
+    if (det == 0)
+        return -1;
+
+    double one = 1 << IMAGE_WARP_SHIFT;
+    inv[0] = lrint(m11 / det * one);
+    inv[1] = lrint(-m01 / det * one);
+    inv[2] = lrint((m01 * m12 - m02 * m11) / det * one);
+    inv[3] = lrint(-m10 / det * one);
+    inv[4] = lrint(m00 / det * one);
+    inv[5] = lrint((m02 * m10 - m00 * m12) / det * one);
+    return 0;
+} /*}}}*/
+
+/*
+ * Narrow [*start, *end) to the columns j where 0 <= value + step * j < limit.
+ */
+static void image_warp_span(int64_t value, int32_t step, int32_t limit, int *start, int *end)
+{ /*{{{*/
+    int64_t first, last;
+    if (step > 0)
+    {
+        first = value >= 0 ? 0 : (-value + step - 1) / step;
+        last = value >= limit ? 0 : (limit - value + step - 1) / step;
+    }
+    else if (step < 0)
+    {
+        first = value < limit ? 0 : (value - limit + 1 - step - 1) / -step;
+        last = value < 0 ? 0 : value / -step + 1;
+    }
+    else
+    {
+        first = 0;
+        last = (value >= 0 && value < limit) ? *end : 0;
+    }
+    if (first > *start)
+        *start = first < *end ? first : *end;
+    if (last < *end)
+        *end = last > *start ? last : *start;
+} /*}}}*/
+
+/*
+ * Bilinear warp of image by the fixed point inverse matrix, pixels that fall outside image are 0.
+ * Each row is clipped to the columns inside image, which are then stepped without any test.
+ * Writes dst, or dst_q shifted by shift when dst is NULL.
+ */
+static void image_warp_affine_rows(const dl_matrix3du_t *image, const int32_t *inv, uint8_t *dst, qtp_t *dst_q, int shift, int dst_w, int dst_h)
+{ /*{{{*/
+    const int c = image->c;
+    const int stride = image->w * c;
+    const int32_t x_max = (image->w - 1) << IMAGE_WARP_SHIFT;
+    const int32_t y_max = (image->h - 1) << IMAGE_WARP_SHIFT;
+    const int fraction_shift = IMAGE_WARP_SHIFT - IMAGE_WARP_WEIGHT_SHIFT;
+    const int fraction_mask = (1 << IMAGE_WARP_WEIGHT_SHIFT) - 1;
+    const int round = 1 << (2 * IMAGE_WARP_WEIGHT_SHIFT - 1);
+    const int left = shift > 0 ? shift : 0;
+    const int right = shift < 0 ? -shift : 0;
+
+    for (int i = 0; i < dst_h; i++)
+    {
+        int64_t x_row = (int64_t)inv[1] * i + inv[2];
+        int64_t y_row = (int64_t)inv[4] * i + inv[5];
+        int start = 0, end = dst_w;
+        image_warp_span(x_row, inv[0], x_max, &start, &end);
+        image_warp_span(y_row, inv[3], y_max, &start, &end);
+
+        // inside the span the coordinates stay in [0, max), so int32 does not overflow
+        int32_t x_src = x_row + (int64_t)inv[0] * start;
+        int32_t y_src = y_row + (int64_t)inv[3] * start;
+        if (dst)
+        {
+            memset(dst, 0, start * c);
+            dst += start * c;
+        }
+        else
+        {
+            memset(dst_q, 0, start * c * sizeof(qtp_t));
+            dst_q += start * c;
+        }
+        for (int j = start; j < end; j++, x_src += inv[0], y_src += inv[3])
+        {
+            int fx = (x_src >> fraction_shift) & fraction_mask;
+            int fy = (y_src >> fraction_shift) & fraction_mask;
+            const uint8_t *s0 = image->item + (y_src >> IMAGE_WARP_SHIFT) * stride + (x_src >> IMAGE_WARP_SHIFT) * c;
+            const uint8_t *s1 = s0 + stride;
+            for (int k = 0; k < c; k++)
+            {
+                int top = (s0[k] << IMAGE_WARP_WEIGHT_SHIFT) + (s0[c + k] - s0[k]) * fx;
+                int bottom = (s1[k] << IMAGE_WARP_WEIGHT_SHIFT) + (s1[c + k] - s1[k]) * fx;
+                int v = ((top << IMAGE_WARP_WEIGHT_SHIFT) + (bottom - top) * fy + round) >> (2 * IMAGE_WARP_WEIGHT_SHIFT);
+                if (dst)
+                    *dst++ = v;
+                else
+                    *dst_q++ = (v << left) >> right;
+            }
+        }
+        if (dst)
+        {
+            memset(dst, 0, (dst_w - end) * c);
+            dst += (dst_w - end) * c;
+        }
+        else
+        {
+            memset(dst_q, 0, (dst_w - end) * c * sizeof(qtp_t));
+            dst_q += (dst_w - end) * c;
+        }
+    }
+} /*}}}*/
+
+int image_warp_affine(dl_matrix3du_t *img, dl_matrix3du_t *crop, const image_affine_t *M)
+{ /*{{{*/
+    int32_t inv[6];
+    if (image_affine_inverse_q(M, inv) < 0)
+    {
+        memset(crop->item, 0, crop->w * crop->h * crop->c);
+        return -1;
+    }
+    image_warp_affine_rows(img, inv, crop->item, NULL, 0, crop->w, crop->h);
+    return 0;
+} /*}}}*/
+
+void warp_affine(dl_matrix3du_t *img, dl_matrix3du_t *crop, Matrix *M)
+{ /*{{{*/
+    image_affine_t T;
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 3; j++)
+            T.m[i][j] = M->array[i][j];
+    image_warp_affine(img, crop, &T);
+} /*}}}*/
+
+int image_warp_affine_batch_q(qtp_t *dst_image, int dst_w, int dst_h, const dl_matrix3du_t *image, const image_affine_t *M, int n, int shift)
+{ /*{{{*/
+    for (int b = 0; b < n; b++)
+    {
+        int32_t inv[6];
+        if (image_affine_inverse_q(M + b, inv) < 0)
+            return -1;
+        image_warp_affine_rows(image, inv, NULL, dst_image + (size_t)b * dst_w * dst_h * image->c, shift, dst_w, dst_h);
+    }
+    return 0;
+} /*}}}*/
+
+
+void image_zoom_in_twice_q(qtp_t *dimage,
+                         int dst_w,
+                         int dst_h,
+                         int dst_c,
+                         uint8_t *simage,
+                         int src_w,
+                         int src_c)
+{
+    for (int dyi = 0; dyi < dst_h; dyi++)
+    {
+        int _di = dyi * dst_w;
+
+        int _si0 = dyi * 2 * src_w;
+        int _si1 = _si0 + src_w;
+
+        for (int dxi = 0; dxi < dst_w; dxi++)
+        {
+            int di = (_di + dxi) * dst_c;
+            int si0 = (_si0 + dxi * 2) * src_c;
+            int si1 = (_si1 + dxi * 2) * src_c;
+
+            if (1 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 1] + simage[si1] + simage[si1 + 1]) >> 2);
+            }
+            else if (3 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 3] + simage[si1] + simage[si1 + 3]) >> 2);
+                dimage[di + 1] = (uint16_t)((simage[si0 + 1] + simage[si0 + 4] + simage[si1 + 1] + simage[si1 + 4]) >> 2);
+                dimage[di + 2] = (uint16_t)((simage[si0 + 2] + simage[si0 + 5] + simage[si1 + 2] + simage[si1 + 5]) >> 2);
+            }
+            else
+            {
+                for (int dci = 0; dci < dst_c; dci++)
+                {
+                    dimage[di + dci] = (uint16_t)((simage[si0 + dci] + simage[si0 + 3 + dci] + simage[si1 + dci] + simage[si1 + 3 + dci] + 2) >> 2);
+                }
+            }
+        }
+    }
+    return;
+}
+
+
+void image_zoom_in_twice_q_shift(qtp_t *dimage,
+                         int dst_w,
+                         int dst_h,
+                         int dst_c,
+                         uint8_t *simage,
+                         int src_w,
+                         int src_c,
+                         int shift)
+{
+    assert(shift>=2);
+    int shift_real = shift - 2;
+    for (int dyi = 0; dyi < dst_h; dyi++)
+    {
+        int _di = dyi * dst_w;
+
+        int _si0 = dyi * 2 * src_w;
+        int _si1 = _si0 + src_w;
+
+        for (int dxi = 0; dxi < dst_w; dxi++)
+        {
+            int di = (_di + dxi) * dst_c;
+            int si0 = (_si0 + dxi * 2) * src_c;
+            int si1 = (_si1 + dxi * 2) * src_c;
+
+            if (1 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 1] + simage[si1] + simage[si1 + 1]) << shift_real);
+            }
+            else if (3 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 3] + simage[si1] + simage[si1 + 3]) << shift_real);
+                dimage[di + 1] = (uint16_t)((simage[si0 + 1] + simage[si0 + 4] + simage[si1 + 1] + simage[si1 + 4]) << shift_real);
+                dimage[di + 2] = (uint16_t)((simage[si0 + 2] + simage[si0 + 5] + simage[si1 + 2] + simage[si1 + 5]) << shift_real);
+            }
+            else
+            {
+                for (int dci = 0; dci < dst_c; dci++)
+                {
+                    dimage[di + dci] = (uint16_t)((simage[si0 + dci] + simage[si0 + 3 + dci] + simage[si1 + dci] + simage[si1 + 3 + dci] + 2) << shift_real);
+                }
+            }
+        }
+    }
+    return;
+}
+
+
+void image_resize_linear_q(qtp_t *dst_image, uint8_t *src_image, int dst_w, int dst_h, int dst_c, int src_w, int src_h, int shift)
+{ /*{{{*/
+    float scale_x = (float)src_w / dst_w;
+    float scale_y = (float)src_h / dst_h;
+
+    int dst_stride = dst_c * dst_w;
+    int src_stride = dst_c * src_w;
+
+    if (fabs(scale_x - 2) <= 1e-6 && fabs(scale_y - 2) <= 1e-6)
+    {
+        image_zoom_in_twice_q_shift(
+            dst_image,
+            dst_w,
+            dst_h,
+            dst_c,
+            src_image,
+            src_w,
+            dst_c,
+            shift);
+    }
+    else
+    {
+        image_resizer_t *temp = NULL;
+        const image_resizer_t *resizer = image_resizer_get(dst_w, dst_h, src_w, src_h);
+        if (NULL == resizer)
+            resizer = temp = image_resizer_alloc(dst_w, dst_h, src_w, src_h);
+        if (NULL == resizer || image_resizer_run_q(resizer, dst_image, src_image, src_stride, dst_c, shift) < 0)
+        {
+            // out of memory, per pixel in float
+            for (int y = 0; y < dst_h; y++)
+            {
+                float fy[2];
+                fy[0] = (float)((y + 0.5) * scale_y - 0.5); // y
+                int src_y = (int)fy[0];                     // y1
+                fy[0] -= src_y;                             // y - y1
+                fy[1] = 1 - fy[0];                          // y2 - y
+                src_y = DL_IMAGE_MAX(0, src_y);
+                src_y = DL_IMAGE_MIN(src_y, src_h - 2);
+
+                for (int x = 0; x < dst_w; x++)
+                {
+                    float fx[2];
+                    fx[0] = (float)((x + 0.5) * scale_x - 0.5); // x
+                    int src_x = (int)fx[0];                     // x1
+                    fx[0] -= src_x;                             // x - x1
+                    if (src_x < 0)
+                    {
+                        fx[0] = 0;
+                        src_x = 0;
+                    }
+                    if (src_x > src_w - 2)
+                    {
+                        fx[0] = 0;
+                        src_x = src_w - 2;
+                    }
+                    fx[1] = 1 - fx[0]; // x2 - x
+
+                    for (int c = 0; c < dst_c; c++)
+                    {
+                        dst_image[y * dst_stride + x * dst_c + c] = ((qtp_t)(round(src_image[src_y * src_stride + src_x * dst_c + c] * fx[1] * fy[1] + src_image[src_y * src_stride + (src_x + 1) * dst_c + c] * fx[0] * fy[1] + src_image[(src_y + 1) * src_stride + src_x * dst_c + c] * fx[1] * fy[0] + src_image[(src_y + 1) * src_stride + (src_x + 1) * dst_c + c] * fx[0] * fy[0])))<<shift;
+                    }
+                }
+            }
+        }
+        image_resizer_free(temp);
+    }
+} /*}}}*/
+
+
+void image_zoom_in_twice_padding_q(qtp_t *dimage,
+                         int dst_w,
+                         int dst_h,
+                         int dst_c,
+                         uint8_t *simage,
+                         int src_w,
+                         int src_c,
+                         int target_w,
+                         int target_h, 
+                         int out_w, 
+                         int out_h)
+{
+    for (int dyi = 0; dyi < target_h; dyi++)
+    {
+        int _di = (dyi + out_h) * dst_w;
+
+        int _si0 = dyi * 2 * src_w;
+        int _si1 = _si0 + src_w;
+
+        for (int dxi = 0; dxi < target_w; dxi++)
+        {
+            int di = (_di + dxi + out_w) * dst_c;
+            int si0 = (_si0 + dxi * 2) * src_c;
+            int si1 = (_si1 + dxi * 2) * src_c;
+
+            if (1 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 1] + simage[si1] + simage[si1 + 1]) >> 2);
+            }
+            else if (3 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 3] + simage[si1] + simage[si1 + 3]) >> 2);
+                dimage[di + 1] = (uint16_t)((simage[si0 + 1] + simage[si0 + 4] + simage[si1 + 1] + simage[si1 + 4]) >> 2);
+                dimage[di + 2] = (uint16_t)((simage[si0 + 2] + simage[si0 + 5] + simage[si1 + 2] + simage[si1 + 5]) >> 2);
+            }
+            else
+            {
+                for (int dci = 0; dci < dst_c; dci++)
+                {
+                    dimage[di + dci] = (uint16_t)((simage[si0 + dci] + simage[si0 + 3 + dci] + simage[si1 + dci] + simage[si1 + 3 + dci] + 2) >> 2);
+                }
+            }
+        }
+    }
+    return;
+}
+
+void image_zoom_in_twice_padding_q_shift(qtp_t *dimage,
+                         int dst_w,
+                         int dst_h,
+                         int dst_c,
+                         uint8_t *simage,
+                         int src_w,
+                         int src_c,
+                         int target_w,
+                         int target_h, 
+                         int out_w, 
+                         int out_h,
+                         int shift)
+{
+    assert(shift>=2);
+    int shift_real = shift - 2;
+    for (int dyi = 0; dyi < target_h; dyi++)
+    {
+        int _di = (dyi + out_h) * dst_w;
+
+        int _si0 = dyi * 2 * src_w;
+        int _si1 = _si0 + src_w;
+
+        for (int dxi = 0; dxi < target_w; dxi++)
+        {
+            int di = (_di + dxi + out_w) * dst_c;
+            int si0 = (_si0 + dxi * 2) * src_c;
+            int si1 = (_si1 + dxi * 2) * src_c;
+
+            if (1 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 1] + simage[si1] + simage[si1 + 1]) << shift_real);
+            }
+            else if (3 == dst_c)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 3] + simage[si1] + simage[si1 + 3]) << shift_real);
+                dimage[di + 1] = (uint16_t)((simage[si0 + 1] + simage[si0 + 4] + simage[si1 + 1] + simage[si1 + 4]) << shift_real);
+                dimage[di + 2] = (uint16_t)((simage[si0 + 2] + simage[si0 + 5] + simage[si1 + 2] + simage[si1 + 5]) << shift_real);
+            }
+            else
+            {
+                for (int dci = 0; dci < dst_c; dci++)
+                {
+                    dimage[di + dci] = (uint16_t)((simage[si0 + dci] + simage[si0 + 3 + dci] + simage[si1 + dci] + simage[si1 + 3 + dci] + 2) << shift_real);
+                }
+            }
+        }
+    }
+    return;
+}
+
+
+void image_resize_linear_padding_q(qtp_t *dst_image, uint8_t *src_image, int dst_w, int dst_h, int dst_c, int src_w, int src_h, 
+                                    int target_w, int target_h, int offset_w, int offset_h, int shift)
+{ /*{{{*/
+    float scale_x = (float)src_w / target_w;
+    float scale_y = (float)src_h / target_h;
+
+    int dst_stride = dst_c * dst_w;
+    int src_stride = dst_c * src_w;
+
+    // int start_offset = (offset_h * dst_stride)+(offset_w * dst_c);
+    // int step_offset = (dst_w - target_w) * dst_c;
+
+    if (fabs(scale_x - 2) <= 1e-6 && fabs(scale_y - 2) <= 1e-6)
+    {
+        image_zoom_in_twice_padding_q_shift(
+            dst_image,
+            dst_w,
+            dst_h,
+            dst_c,
+            src_image,
+            src_w,
+            dst_c,
+            target_w,
+            target_h,
+            offset_w,
+            offset_h,
+            shift
+            );
+    }
+    else
+    {
+        for (int y = 0; y < target_h; y++)
+        {
+            float fy[2];
+            fy[0] = (float)((y + 0.5) * scale_y - 0.5); // y
+            int src_y = (int)fy[0];                     // y1
+            fy[0] -= src_y;                             // y - y1
+            fy[1] = 1 - fy[0];                          // y2 - y
+            src_y = DL_IMAGE_MAX(0, src_y);
+            src_y = DL_IMAGE_MIN(src_y, src_h - 2);
+
+            for (int x = 0; x < target_w; x++)
+            {
+                float fx[2];
+                fx[0] = (float)((x + 0.5) * scale_x - 0.5); // x
+                int src_x = (int)fx[0];                     // x1
+                fx[0] -= src_x;                             // x - x1
+                if (src_x < 0)
+                {
+                    fx[0] = 0;
+                    src_x = 0;
+                }
+                if (src_x > src_w - 2)
+                {
+                    fx[0] = 0;
+                    src_x = src_w - 2;
+                }
+                fx[1] = 1 - fx[0]; // x2 - x
+
+                for (int c = 0; c < dst_c; c++)
+                {
+                    dst_image[(y + offset_h) * dst_stride + (x + offset_w) * dst_c + c] = ((qtp_t)(round(src_image[src_y * src_stride + src_x * dst_c + c] * fx[1] * fy[1] + src_image[src_y * src_stride + (src_x + 1) * dst_c + c] * fx[0] * fy[1] + src_image[(src_y + 1) * src_stride + src_x * dst_c + c] * fx[1] * fy[0] + src_image[(src_y + 1) * src_stride + (src_x + 1) * dst_c + c] * fx[0] * fy[0])))<<shift;
+                }
+            }
+        }
+    }
+} /*}}}*/
+
+
+dl_matrix3dq_t *image_resize_normalize_quantize(uint8_t *image, int input_w, int input_h, int target_size, int exponent, int process_mode)
+{
+    int c = 3;
+    int shift = (-exponent)-8;
+    assert(shift>=0);
+    float scale = 0.0;
+    int target_w, target_h = 0;
+    //int dw, dh = 0;
+    if(input_w >= input_h){
+        scale = (float)target_size / input_w;
+        target_w = target_size;
+        target_h = (int)(input_h*scale);
+        //dh = (target_size - target_h)/2;
+    }else{
+        scale = (float)target_size / input_h;
+        target_w = (int)(input_w*scale);
+        target_h = target_size;
+        //dw = (target_size - target_w)/2;
+    }
+    if(process_mode == 0){ //w = h, padding right bottom
+        dl_matrix3dq_t *out_image = dl_matrix3dq_alloc(1, target_size, target_size, c, exponent);
+        int padding_num = target_size - target_w;
+        qtp_t *tmp = out_image->item;
+        if(scale == 1.0){
+            int count = 0; 
+            for(int i=0;i<input_h;i++){
+                for(int j=0;j<input_w;j++){
+                    for(int k=0;k<c; k++){
+                        *tmp++ = ((qtp_t)(image[count++]))<<shift;
+                    }
+                }
+                tmp += (padding_num * c);
+            }
+        }else{
+            image_resize_linear_padding_q(tmp, image, out_image->w, out_image->h, out_image->c, input_w, input_h, 
+                                    target_w, target_h, 0, 0, shift);
+        }
+        return out_image;
+    }else{// no padding , just resize,  w != h
+        dl_matrix3dq_t *out_image = dl_matrix3dq_alloc(1, target_w, target_h, c, exponent);
+        qtp_t *tmp = out_image->item;
+        if(scale == 1.0){
+            int count = input_w*input_h*c;
+            for(int i=0; i<count; i++){
+                *tmp++ = ((qtp_t)(image[i]))<<shift;
+            }
+        }else{
+            image_resize_linear_q(tmp, image, out_image->w, out_image->h, out_image->c, input_w, input_h, shift);
+        }
+        return out_image;
+    }
+}
+
+
+void image_resize_n_shift(qtp_t *dimage, uint16_t *simage, int dw, int dh, int dc, int sw, int n, int shift)
+{
+    assert(shift >= 2);
+    int shift_real = shift - 2;
+    for (int dyi = 0; dyi < dh; dyi++)
+    {
+        int _di = dyi * dw;
+
+        int _si0 = dyi * n * sw;
+        int _si1 = _si0 + sw;
+
+        for (int dxi = 0; dxi < dw; dxi++)
+        {
+            int di = (_di + dxi) * dc;
+            int si0 = (_si0 + dxi * n);
+            int si1 = (_si1 + dxi * n);
+
+            if (1 == dc)
+            {
+                dimage[di] = (uint16_t)((simage[si0] + simage[si0 + 1] + simage[si1] + simage[si1 + 1]) << shift_real);
+            }
+            else if (3 == dc)
+            {
+                uint16_t in[4*3] = {0};
+                uint16_t in_tmp;
+                in_tmp = simage[si0];
+                in_tmp = (in_tmp & 0xFF) << 8 | (in_tmp & 0xFF00) >> 8;
+                in[0] = (in_tmp & RGB565_MASK_BLUE) << 3;  // blue
+                in[1] = (in_tmp & RGB565_MASK_GREEN) >> 3; // green
+                in[2] = (in_tmp & RGB565_MASK_RED) >> 8;   // red
+                in_tmp = simage[si0 + 1];
+                in_tmp = (in_tmp & 0xFF) << 8 | (in_tmp & 0xFF00) >> 8;
+                in[3] = (in_tmp & RGB565_MASK_BLUE) << 3;  // blue
+                in[4] = (in_tmp & RGB565_MASK_GREEN) >> 3; // green
+                in[5] = (in_tmp & RGB565_MASK_RED) >> 8;   // red
+                in_tmp = simage[si1];
+                in_tmp = (in_tmp & 0xFF) << 8 | (in_tmp & 0xFF00) >> 8;
+                in[6] = (in_tmp & RGB565_MASK_BLUE) << 3;  // blue
+                in[7] = (in_tmp & RGB565_MASK_GREEN) >> 3; // green
+                in[8] = (in_tmp & RGB565_MASK_RED) >> 8;   // red
+                in_tmp = simage[si1 + 1];
+                in_tmp = (in_tmp & 0xFF) << 8 | (in_tmp & 0xFF00) >> 8;
+                in[9] = (in_tmp & RGB565_MASK_BLUE) << 3;  // blue
+                in[10] = (in_tmp & RGB565_MASK_GREEN) >> 3; // green
+                in[11] = (in_tmp & RGB565_MASK_RED) >> 8;   // red
+
+                dimage[di] = ((in[0] + in[3] + in[6] + in[9]) << shift_real);
+                dimage[di + 1] = ((in[1] + in[4] + in[7] + in[10]) << shift_real);
+                dimage[di + 2] = ((in[2] + in[5] + in[8] + in[11]) << shift_real);
+            }
+            else
+            {
+                for (int dci = 0; dci < dc; dci++)
+                {
+                    dimage[di + dci] = (uint16_t)((simage[si0 + dci] + simage[si0 + 3 + dci] + simage[si1 + dci] + simage[si1 + 3 + dci] + 2) << shift_real);
+                }
+            }
+        }
+    }
+}
+
+void image_resize_shift_fast(qtp_t *dimage, uint16_t *simage, int dw, int dc, int sw, int sh, int tw, int th, int shift)
+{
+    assert(shift>=2);
+    assert(dc == 3);
+    int shift_real = shift - 2;
+    float ratio_w = (float)sw / tw;
+    float ratio_h = (float)sh / th;
+    int16_t dst[12];
+    for (int dyi = 0; dyi < th; dyi++)
+    {
+        int _di = dyi * dw;
+
+        int _si0 = (int)(dyi * ratio_h) * sw;
+        int _si1 = _si0 + sw;
+
+        for (int dxi = 0; dxi < tw; dxi++)
+        {
+            int di = (_di + dxi) * dc;
+    
+            int si0 = (_si0 + (int)(dxi * ratio_w));
+            int si1 = (_si1 + (int)(dxi * ratio_w));
+
+            rgb565_to_888_q16(simage[si0], dst);
+            rgb565_to_888_q16(simage[si0+1], dst + 3);
+            rgb565_to_888_q16(simage[si1], dst + 6);
+            rgb565_to_888_q16(simage[si1+1], dst + 9);
+            dimage[di] = ((dst[0]+dst[3]+dst[6]+dst[9]) << shift_real);
+            dimage[di+1] = ((dst[1]+dst[4]+dst[7]+dst[10]) << shift_real);
+            dimage[di+2] = ((dst[2]+dst[5]+dst[8]+dst[11]) << shift_real);
+        }
+    }
+    return;
+}
+
+
+void image_resize_nearest_shift(qtp_t *dimage, uint16_t *simage, int dw, int dc, int sw, int sh, int tw, int th, int shift)
+{
+    assert(shift>=0);
+    assert(dc == 3);
+    float ratio_w = (float)sw / tw;
+    float ratio_h = (float)sh / th;
+    int16_t dst[3];
+    for (int dyi = 0; dyi < th; dyi++)
+    {
+        int _di = dyi * dw;
+
+        float _si0 = (int)(dyi * ratio_h) * sw;
+
+        for (int dxi = 0; dxi < tw; dxi++)
+        {
+            int di = (_di + dxi) * dc;
+            int si0 = rintf(_si0 + dxi * ratio_w);
+            rgb565_to_888_q16(simage[si0], dst);
+            dimage[di] = ((int16_t)(dst[0]) << shift);
+            dimage[di+1] = ((int16_t)(dst[1]) << shift);
+            dimage[di+2] = ((int16_t)(dst[2]) << shift);
+        }
+    }
+    return;
+}
+
+void image_crop_shift_fast(qtp_t *dimage, uint16_t *simage, int dw, int sw, int sh, int x1, int y1, int x2, int y2, int shift)
+{
+    assert(shift>=2);
+    int shift_real = shift - 2;
+    int16_t dst[12];
+
+    int w = x2 - x1;
+    int h = y2 - y1;
+    int tw, th = 0;
+    float scale = 0.0;
+    if(w >= h){
+        scale = (float)w / dw;
+        tw = dw;
+        th = (int)(h / scale);
+    }else{
+        scale = (float)h / dw;
+        tw = (int)(w / scale);
+        th = dw;
+    }
+    for (int dyi = 0; dyi < th; dyi++)
+    {
+        int _di = dyi * dw;
+
+        int _si0 = ((int)(dyi * scale) + y1) * sw;
+        int _si1 = _si0 + sw;
+
+        for (int dxi = 0; dxi < tw; dxi++)
+        {
+            int di = (_di + dxi) * 3;
+    
+            int si0 = (_si0 + (int)(dxi * scale) + x1);
+            int si1 = (_si1 + (int)(dxi * scale) + x1);
+            rgb565_to_888_q16(simage[si0], dst);
+            rgb565_to_888_q16(simage[si0+1], dst + 3);
+            rgb565_to_888_q16(simage[si1], dst + 6);
+            rgb565_to_888_q16(simage[si1+1], dst + 9);
+            dimage[di] = ((dst[0]+dst[3]+dst[6]+dst[9]) << shift_real);
+            dimage[di+1] = ((dst[1]+dst[4]+dst[7]+dst[10]) << shift_real);
+            dimage[di+2] = ((dst[2]+dst[5]+dst[8]+dst[11]) << shift_real);
+        }
+    }
+    return;
+}
@@ -43,6 +43,13 @@ typedef enum
     IMAGE_RESIZE_NEAREST = 2   /*<! Resize image by taking the nearest pixel */
 } image_resize_t;
 
+typedef enum
+{
+    IMAGE_YUV_YUYV = 0, /*<! Packed 4:2:2, y0 u y1 v for each pair of pixels, even width */
+    IMAGE_YUV_NV12 = 1, /*<! Plane of y, then a plane of interleaved u v at half width and height, even width and height */
+    IMAGE_YUV_GRAY = 2  /*<! Plane of y only */
+} image_yuv_t;
+
 template <class T>
 class Image
 {
@@ -60,6 +67,24 @@ public:
         output[0] = input & 0xF8;                                    //red
     };
 
+    /**
+     * @brief Convert a YUV pixel to RGB888, BT.601 full range as yuv_to_888 in image_util.h
+     * 
+     * @param y         Luma
+     * @param u         Blue difference
+     * @param v         Red difference
+     * @param output    Pixel value in RGB888
+     */
+    static inline void pixel_yuv_to_rgb888(int y, int u, int v, T *output)
+    {
+        int r = y + ((91881 * (v - 128)) >> 16);
+        int g = y - ((22554 * (u - 128) + 46802 * (v - 128)) >> 16);
+        int b = y + ((116130 * (u - 128)) >> 16);
+        output[0] = r < 0 ? 0 : (r > 255 ? 255 : r);
+        output[1] = g < 0 ? 0 : (g > 255 ? 255 : g);
+        output[2] = b < 0 ? 0 : (b > 255 ? 255 : b);
+    };
+
     /**
      * @brief Resize a RGB565 image to a RGB88 image
      * 
@@ -95,8 +120,60 @@ public:
      * @param type          The resize type
      */
     static void resize_to_rgb888(T *dst_image, int y_start, int y_end, int x_start, int x_end, int channel, uint8_t *src_image, int src_h, int src_w, int dst_w, int shift_left, image_resize_t type);
+
+    /**
+     * @brief Resize a YUYV, NV12 or gray image to a RGB888 image, the color is converted while resizing.
+     *        Y, U and V are resampled first, then each destination pixel is converted once.
+     *        With channel 1 only the luma is written.
+     * 
+     * @param dst_image     The destination image
+     * @param y_start       The start y index of where resized image located
+     * @param y_end         The end y index of where resized image located
+     * @param x_start       The start x index of where resized image located
+     * @param x_end         The end x index of where resized image located
+     * @param channel       The channel number of destination image, 3 or 1
+     * @param src_image     The source image
+     * @param src_type      The layout of source image
+     * @param src_h         The height of source image
+     * @param src_w         The width of source image
+     * @param dst_w         The width of destination image
+     * @param shift_left    The bit number of left shifting
+     * @param type          The resize type
+     */
+    static void resize_to_rgb888(T *dst_image, int y_start, int y_end, int x_start, int x_end, int channel, uint8_t *src_image, image_yuv_t src_type, int src_h, int src_w, int dst_w, int shift_left, image_resize_t type);
     // static void resize_to_rgb565(uint16_t *dst_image, int y_start, int y_end, int x_start, int x_end, int channel, uint16_t *src_image, int src_h, int src_w, int dst_w, int shift_left, image_resize_t type);
     // static void resize_to_rgb565(uint16_t *dst_image, int y_start, int y_end, int x_start, int x_end, int channel, uint8_t *src_image, int src_h, int src_w, int dst_w, int shift_left, image_resize_t type);
+
+private:
+    static const int yuv_chunk = 64; // destination pixels resampled before one conversion pass
+
+    template <image_yuv_t F>
+    static inline void pixel_yuv(const uint8_t *src_image, int src_h, int src_w, int y, int x, int *yuv)
+    {
+        if (IMAGE_YUV_YUYV == F)
+        {
+            const uint8_t *pair = src_image + (y * src_w + (x & ~1)) * 2;
+            yuv[0] = pair[(x & 1) * 2];
+            yuv[1] = pair[1];
+            yuv[2] = pair[3];
+        }
+        else if (IMAGE_YUV_NV12 == F)
+        {
+            const uint8_t *uv = src_image + src_w * src_h + (y >> 1) * src_w + (x & ~1);
+            yuv[0] = src_image[y * src_w + x];
+            yuv[1] = uv[0];
+            yuv[2] = uv[1];
+        }
+        else
+        {
+            yuv[0] = src_image[y * src_w + x];
+            yuv[1] = 128;
+            yuv[2] = 128;
+        }
+    };
+
+    template <image_yuv_t F>
+    static void resize_yuv_to_rgb888(T *dst_image, int y_start, int y_end, int x_start, int x_end, int channel, uint8_t *src_image, int src_h, int src_w, int dst_w, int shift_left, image_resize_t type);
 };
 
 template <class T>
@@ -165,7 +242,7 @@ void Image<T>::resize_to_rgb888(T *dst_image, int y_start, int y_end, int x_star
 
                 for (int c = 0; c < channel; c++)
                 {
-                    temp[12] = round(temp[c] * ratio_x[1] * ratio_y[1] + temp[channel + c] * ratio_x[0] * ratio_y[1] + temp[channel + channel + c] * ratio_x[1] * ratio_y[0] + src_image[channel + channel + channel + c] * ratio_x[0] * ratio_y[0]);
+                    temp[12] = round(temp[c] * ratio_x[1] * ratio_y[1] + temp[channel + c] * ratio_x[0] * ratio_y[1] + temp[channel + channel + c] * ratio_x[1] * ratio_y[0] + temp[channel + channel + channel + c] * ratio_x[0] * ratio_y[0]);
                     dst_image[dst_i + c] = (shift_left > 0) ? (temp[12] << shift_left) : (temp[12] >> -shift_left);
                 }
             }
@@ -195,7 +272,7 @@ void Image<T>::resize_to_rgb888(T *dst_image, int y_start, int y_end, int x_star
 
                 dst_image[dst_i] = (shift_left > 0) ? ((temp[0] + temp[3] + temp[6] + temp[9]) << shift_left) : ((temp[0] + temp[3] + temp[6] + temp[9]) >> -shift_left);
                 dst_image[dst_i + 1] = (shift_left > 0) ? ((temp[1] + temp[4] + temp[7] + temp[10]) << shift_left) : ((temp[1] + temp[4] + temp[7] + temp[10]) >> -shift_left);
-                dst_image[dst_i + 2] = (shift_left > 0) ? ((temp[2] + temp[5] + temp[8] + temp[11]) << shift_left) : ((temp[1] + temp[4] + temp[7] + temp[10]) >> -shift_left);
+                dst_image[dst_i + 2] = (shift_left > 0) ? ((temp[2] + temp[5] + temp[8] + temp[11]) << shift_left) : ((temp[2] + temp[5] + temp[8] + temp[11]) >> -shift_left);
             }
         }
 
@@ -341,4 +418,174 @@ void Image<T>::resize_to_rgb888(T *dst_image, int y_start, int y_end, int x_star
     default:
         break;
     }
-}
\ No newline at end of file
+}
+
+template <class T>
+void Image<T>::resize_to_rgb888(T *dst_image, int y_start, int y_end, int x_start, int x_end, int channel, uint8_t *src_image, image_yuv_t src_type, int src_h, int src_w, int dst_w, int shift_left, image_resize_t type)
+{
+    assert(channel == 3 || channel == 1);
+    switch (src_type)
+    {
+    case IMAGE_YUV_YUYV:
+        resize_yuv_to_rgb888<IMAGE_YUV_YUYV>(dst_image, y_start, y_end, x_start, x_end, channel, src_image, src_h, src_w, dst_w, shift_left, type);
+        break;
+
+    case IMAGE_YUV_NV12:
+        resize_yuv_to_rgb888<IMAGE_YUV_NV12>(dst_image, y_start, y_end, x_start, x_end, channel, src_image, src_h, src_w, dst_w, shift_left, type);
+        break;
+
+    case IMAGE_YUV_GRAY:
+        resize_yuv_to_rgb888<IMAGE_YUV_GRAY>(dst_image, y_start, y_end, x_start, x_end, channel, src_image, src_h, src_w, dst_w, shift_left, type);
+        break;
+
+    default:
+        break;
+    }
+}
+
+template <class T>
+template <image_yuv_t F>
+void Image<T>::resize_yuv_to_rgb888(T *dst_image, int y_start, int y_end, int x_start, int x_end, int channel, uint8_t *src_image, int src_h, int src_w, int dst_w, int shift_left, image_resize_t type)
+{
+    float scale_y = (float)src_h / (y_end - y_start);
+    float scale_x = (float)src_w / (x_end - x_start);
+    int luma[yuv_chunk], u[yuv_chunk], v[yuv_chunk];
+    int temp[12];
+
+    for (int y = y_start; y < y_end; y++)
+    {
+        float ratio_y[2] = {0, 1};
+        int src_y;
+        if (IMAGE_RESIZE_BILINEAR == type)
+        {
+            ratio_y[0] = (float)((y + 0.5) * scale_y - 0.5); // y
+            src_y = (int)ratio_y[0];                         // y1
+            ratio_y[0] -= src_y;                             // y - y1
+            if (src_y < 0)
+            {
+                ratio_y[0] = 0;
+                src_y = 0;
+            }
+            if (src_y > src_h - 2)
+            {
+                ratio_y[0] = 0;
+                src_y = src_h - 2;
+            }
+            ratio_y[1] = 1 - ratio_y[0]; // y2 - y
+        }
+        else
+        {
+            src_y = rintf(y * scale_y);
+            if (src_y > src_h - 1)
+                src_y = src_h - 1;
+        }
+        int src_y_1 = (src_y < src_h - 1) ? src_y + 1 : src_y;
+
+        T *dst_row = dst_image + y * dst_w * channel;
+        for (int x_0 = x_start; x_0 < x_end; x_0 += yuv_chunk)
+        {
+            int n = (x_end - x_0 < yuv_chunk) ? x_end - x_0 : yuv_chunk;
+
+            // resample y, u and v
+            switch (type)
+            {
+            case IMAGE_RESIZE_BILINEAR:
+                for (int i = 0; i < n; i++)
+                {
+                    float ratio_x[2];
+                    ratio_x[0] = (float)((x_0 + i + 0.5) * scale_x - 0.5); // x
+                    int src_x = (int)ratio_x[0];                           // x1
+                    ratio_x[0] -= src_x;                                   // x - x1
+                    if (src_x < 0)
+                    {
+                        ratio_x[0] = 0;
+                        src_x = 0;
+                    }
+                    if (src_x > src_w - 2)
+                    {
+                        ratio_x[0] = 0;
+                        src_x = src_w - 2;
+                    }
+                    ratio_x[1] = 1 - ratio_x[0]; // x2 - x
+
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y, src_x, temp);
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y, src_x + 1, temp + 3);
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y_1, src_x, temp + 6);
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y_1, src_x + 1, temp + 9);
+
+                    float w_0 = ratio_x[1] * ratio_y[1], w_1 = ratio_x[0] * ratio_y[1];
+                    float w_2 = ratio_x[1] * ratio_y[0], w_3 = ratio_x[0] * ratio_y[0];
+                    luma[i] = round(temp[0] * w_0 + temp[3] * w_1 + temp[6] * w_2 + temp[9] * w_3);
+                    u[i] = round(temp[1] * w_0 + temp[4] * w_1 + temp[7] * w_2 + temp[10] * w_3);
+                    v[i] = round(temp[2] * w_0 + temp[5] * w_1 + temp[8] * w_2 + temp[11] * w_3);
+                }
+                break;
+
+            case IMAGE_RESIZE_MEAN:
+                for (int i = 0; i < n; i++)
+                {
+                    int src_x = rintf((x_0 + i) * scale_x);
+                    if (src_x > src_w - 1)
+                        src_x = src_w - 1;
+                    int src_x_1 = (src_x < src_w - 1) ? src_x + 1 : src_x;
+
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y, src_x, temp);
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y, src_x_1, temp + 3);
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y_1, src_x, temp + 6);
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y_1, src_x_1, temp + 9);
+
+                    luma[i] = (temp[0] + temp[3] + temp[6] + temp[9] + 2) >> 2;
+                    u[i] = (temp[1] + temp[4] + temp[7] + temp[10] + 2) >> 2;
+                    v[i] = (temp[2] + temp[5] + temp[8] + temp[11] + 2) >> 2;
+                }
+                break;
+
+            case IMAGE_RESIZE_NEAREST:
+                for (int i = 0; i < n; i++)
+                {
+                    int src_x = rintf((x_0 + i) * scale_x);
+                    if (src_x > src_w - 1)
+                        src_x = src_w - 1;
+
+                    pixel_yuv<F>(src_image, src_h, src_w, src_y, src_x, temp);
+                    luma[i] = temp[0];
+                    u[i] = temp[1];
+                    v[i] = temp[2];
+                }
+                break;
+
+            default:
+                return;
+            }
+
+            // convert, no branch on the pixel so that the compiler can vectorize it
+            T *dst = dst_row + x_0 * channel;
+            if (1 == channel || IMAGE_YUV_GRAY == F)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    int l = (shift_left > 0) ? (luma[i] << shift_left) : (luma[i] >> -shift_left);
+                    for (int c = 0; c < channel; c++)
+                        dst[i * channel + c] = l;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    int d = u[i] - 128;
+                    int e = v[i] - 128;
+                    int r = luma[i] + ((91881 * e) >> 16);
+                    int g = luma[i] - ((22554 * d + 46802 * e) >> 16);
+                    int b = luma[i] + ((116130 * d) >> 16);
+                    r = r < 0 ? 0 : (r > 255 ? 255 : r);
+                    g = g < 0 ? 0 : (g > 255 ? 255 : g);
+                    b = b < 0 ? 0 : (b > 255 ? 255 : b);
+                    dst[i * 3] = (shift_left > 0) ? (r << shift_left) : (r >> -shift_left);
+                    dst[i * 3 + 1] = (shift_left > 0) ? (g << shift_left) : (g >> -shift_left);
+                    dst[i * 3 + 2] = (shift_left > 0) ? (b << shift_left) : (b >> -shift_left);
+                }
+            }
+        }
+    }
+}
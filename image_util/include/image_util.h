@@ -27,6 +27,7 @@ extern "C"
 {
 #endif
 #include <stdint.h>
+#include <stdbool.h>
 #include <math.h>
 #include "mtmn.h"
 
@@ -41,6 +42,9 @@ extern "C"
 #define RGB565_MASK_GREEN 0x07E0
 #define RGB565_MASK_BLUE 0x001F
 
+#define IMAGE_RESIZER_SHIFT 11        /* fraction bits of the weights of image_resizer_t */
+#define IMAGE_RESIZER_CACHE_NUMBER 16 /* geometries kept by image_resizer_get */
+
     typedef enum
     {
         BINARY, /*!< binary */
@@ -82,6 +86,38 @@ extern "C"
         int len;                  /*!< Length of the image_list */
     } image_list_t;
 
+    typedef enum
+    {
+        IMAGE_PIXEL_RGB888 = 0, /*!< 3 bytes per pixel, r g b */
+        IMAGE_PIXEL_RGB565,     /*!< 2 bytes per pixel, high byte first, as the camera sends it */
+        IMAGE_PIXEL_YUV422,     /*!< 2 bytes per pixel, y0 u y1 v for each pair of pixels */
+    } image_pixel_format_t;
+
+    typedef struct
+    {
+        uint8_t *data;               /*!< First pixel */
+        int w;                       /*!< Width */
+        int h;                       /*!< Height */
+        int stride;                  /*!< Bytes from one row to the next */
+        image_pixel_format_t format; /*!< Pixel format */
+    } image_frame_t;
+
+    /**
+     * @brief Source rows, columns and weights of a bilinear resize, computed once for a geometry.
+     *        The sampling is the one of image_resize_linear, the weights are Q IMAGE_RESIZER_SHIFT.
+     */
+    typedef struct
+    {
+        int dst_w;          /*!< Width of the output */
+        int dst_h;          /*!< Height of the output */
+        int src_w;          /*!< Width of the source */
+        int src_h;          /*!< Height of the source */
+        int *x_index;       /*!< Left source column of each output column */
+        int16_t *x_weight;  /*!< Weight of the column right of x_index */
+        int *y_index;       /*!< Upper source row of each output row */
+        int16_t *y_weight;  /*!< Weight of the row below y_index */
+    } image_resizer_t;
+
     /**
      * @brief Get the width and height of the box.
      * 
@@ -192,13 +228,13 @@ extern "C"
             box->box_p[1] = DL_IMAGE_MAX(round(DL_IMAGE_MAX(0, y1) + 0.5 * (h - l)), 0);
 
             box->box_p[2] = box->box_p[0] + l - 1;
-            if (box->box_p[2] > width)
+            if (box->box_p[2] > width - 1)
             {
                 box->box_p[2] = width - 1;
                 box->box_p[0] = width - l;
             }
             box->box_p[3] = box->box_p[1] + l - 1;
-            if (box->box_p[3] > height)
+            if (box->box_p[3] > height - 1)
             {
                 box->box_p[3] = height - 1;
                 box->box_p[1] = height - l;
@@ -238,6 +274,26 @@ extern "C"
     } /*}}}*/
     /**@}*/
 
+    /**
+     * @brief Convert a YUV pixel to RGB888, BT.601 full range
+     * 
+     * @param y     Luma
+     * @param u     Blue difference
+     * @param v     Red difference
+     * @param dst   Resulting RGB888 pixel
+     */
+    static inline void yuv_to_888(uint8_t y, uint8_t u, uint8_t v, uint8_t *dst)
+    { /*{{{*/
+        int d = u - 128;
+        int e = v - 128;
+        int r = y + ((91881 * e) >> 16);
+        int g = y - ((22554 * d + 46802 * e) >> 16);
+        int b = y + ((116130 * d) >> 16);
+        dst[0] = DL_IMAGE_MIN(DL_IMAGE_MAX(r, 0), 255);
+        dst[1] = DL_IMAGE_MIN(DL_IMAGE_MAX(g, 0), 255);
+        dst[2] = DL_IMAGE_MIN(DL_IMAGE_MAX(b, 0), 255);
+    } /*}}}*/
+
     /**
      * @brief Convert RGB888 image to RGB565 image
      * 
@@ -302,6 +358,102 @@ extern "C"
      */
     void image_nms_process(image_list_t *image_list, fptp_t nms_threshold, int same_area);
 
+    /**
+     * @brief Boxes kept as one array per field, so that NMS compares one box against
+     *        all the others with contiguous loads.
+     */
+    typedef struct
+    {
+        fptp_t *x1;    /*!< left of each box */
+        fptp_t *y1;    /*!< top of each box */
+        fptp_t *x2;    /*!< right of each box */
+        fptp_t *y2;    /*!< bottom of each box */
+        fptp_t *score; /*!< confidence score of each box */
+        fptp_t *area;  /*!< (x2 - x1 + 1) * (y2 - y1 + 1) */
+        int *category; /*!< category of each box */
+        int *index;    /*!< id given by the caller, follows its box through sort and NMS */
+        int len;       /*!< number of boxes */
+        int capacity;  /*!< number of boxes allocated */
+        void *scratch; /*!< work memory of sort and NMS */
+    } image_nms_boxes_t;
+
+    /**
+     * @brief Allocate an empty box buffer.
+     *
+     * @param capacity                  Maximum number of boxes
+     * @return image_nms_boxes_t*       NULL if out of memory
+     */
+    image_nms_boxes_t *image_nms_boxes_alloc(int capacity);
+
+    /**
+     * @brief Free a box buffer.
+     */
+    void image_nms_boxes_free(image_nms_boxes_t *boxes);
+
+    /**
+     * @brief Append a box. The caller keeps len below capacity.
+     *
+     * @param boxes         Box buffer
+     * @param box           (x1, y1, x2, y2)
+     * @param score         Confidence score
+     * @param category      Category, only used by class aware NMS
+     * @param index         Id of the box, read back from boxes->index
+     */
+    static inline void image_nms_boxes_push(image_nms_boxes_t *boxes, box_t *box, fptp_t score, int category, int index)
+    {
+        int i = boxes->len++;
+        boxes->x1[i] = box->box_p[0];
+        boxes->y1[i] = box->box_p[1];
+        boxes->x2[i] = box->box_p[2];
+        boxes->y2[i] = box->box_p[3];
+        boxes->score[i] = score;
+        image_get_area(box, &boxes->area[i]);
+        boxes->category[i] = category;
+        boxes->index[i] = index;
+    }
+
+    /**
+     * @brief Sort the boxes by descending score. Boxes of equal score keep their order.
+     *
+     * @param boxes         Box buffer
+     */
+    void image_nms_boxes_sort(image_nms_boxes_t *boxes);
+
+    typedef enum
+    {
+        IMAGE_NMS_HARD = 0,      /*!< drop the boxes whose IOU with a kept box is above nms_threshold */
+        IMAGE_NMS_SOFT_LINEAR,   /*!< above nms_threshold, scale the score by (1 - IOU) */
+        IMAGE_NMS_SOFT_GAUSSIAN, /*!< scale the score by exp(-IOU^2 / sigma) */
+    } image_nms_mode_t;
+
+    typedef struct
+    {
+        image_nms_mode_t mode;  /*!< suppression strategy */
+        fptp_t nms_threshold;   /*!< IOU threshold of IMAGE_NMS_HARD and IMAGE_NMS_SOFT_LINEAR */
+        fptp_t sigma;           /*!< width of IMAGE_NMS_SOFT_GAUSSIAN, 0.5 is common */
+        fptp_t score_threshold; /*!< soft NMS drops the boxes whose score decays below it */
+        bool class_aware;       /*!< only boxes of the same category suppress each other */
+        int max_keep;           /*!< stop once this many boxes are kept, 0 for no limit */
+    } image_nms_config_t;
+
+    /**
+     * @brief Check a suppression strategy before running it.
+     *
+     * @param config        Suppression strategy
+     * @return int          0, or -1 if the mode is unknown or IMAGE_NMS_SOFT_GAUSSIAN has sigma <= 0
+     */
+    int image_nms_config_check(const image_nms_config_t *config);
+
+    /**
+     * @brief Run NMS on boxes sorted by descending score. The kept boxes are moved to
+     *        the front in the order they were kept and len becomes their number.
+     *        Soft NMS writes the decayed scores back to boxes->score.
+     *
+     * @param boxes         Box buffer, sorted
+     * @param config        Suppression strategy, valid for image_nms_config_check
+     */
+    void image_nms_boxes_process(image_nms_boxes_t *boxes, const image_nms_config_t *config);
+
     /**
      * @brief Resize an image to half size 
      * 
@@ -334,6 +486,98 @@ extern "C"
      */
     void image_resize_linear(uint8_t *dst_image, uint8_t *src_image, int dst_w, int dst_h, int dst_c, int src_w, int src_h);
 
+    /**
+     * @brief Compute the tables of a bilinear resize from src_w x src_h to dst_w x dst_h
+     * 
+     * @param dst_w                 Width of the output image
+     * @param dst_h                 Height of the output image
+     * @param src_w                 Width of the source image
+     * @param src_h                 Height of the source image
+     * @return image_resizer_t*     NULL if out of memory, free it with image_resizer_free
+     */
+    image_resizer_t *image_resizer_alloc(int dst_w, int dst_h, int src_w, int src_h);
+
+    /**
+     * @brief Free a resizer of image_resizer_alloc
+     */
+    void image_resizer_free(image_resizer_t *resizer);
+
+    /**
+     * @brief Get the shared resizer of a geometry. The first IMAGE_RESIZER_CACHE_NUMBER geometries
+     *        asked for are kept for the whole run, so the tables of the pyramid levels are computed once.
+     *        They come from the heap, not the bound arena or plan. Safe to call from several tasks.
+     * 
+     * @return image_resizer_t*     Do not free it. NULL if the cache is full or out of memory
+     */
+    const image_resizer_t *image_resizer_get(int dst_w, int dst_h, int src_w, int src_h);
+
+    /**
+     * @brief Resize an image with the tables of a resizer. Equal to image_resize_linear but for
+     *        the rounding of the fixed point weights, at most 1 apart.
+     * 
+     * @param resizer       Tables of the geometry
+     * @param dst_image     The output image, dst_w x dst_h x c
+     * @param src_image     Source image, src_w x src_h x c
+     * @param src_stride    Bytes from one source row to the next
+     * @param c             Channel of the images
+     * @return int          0, or -1 if out of memory
+     */
+    int image_resizer_run(const image_resizer_t *resizer, uint8_t *dst_image, const uint8_t *src_image, int src_stride, int c);
+
+    /**
+     * @brief image_resizer_run with the output quantized like image_resize_linear_q
+     */
+    int image_resizer_run_q(const image_resizer_t *resizer, qtp_t *dst_image, const uint8_t *src_image, int src_stride, int c, int shift);
+
+    /**
+     * @brief Describe a frame of packed rows, e.g. a camera frame buffer
+     * 
+     * @param data          First pixel
+     * @param w             Width of the frame
+     * @param h             Height of the frame
+     * @param format        Pixel format
+     * @return image_frame_t
+     */
+    static inline image_frame_t image_frame(uint8_t *data, int w, int h, image_pixel_format_t format)
+    { /*{{{*/
+        image_frame_t frame = {data, w, h, w * (IMAGE_PIXEL_RGB888 == format ? 3 : 2), format};
+        return frame;
+    } /*}}}*/
+
+    /**
+     * @brief Resize a region of a frame to a RGB888 image via bilinear interpolation
+     *
+     *        The result is the same as cropping the region of the frame in RGB888 and calling
+     *        image_resize_linear. Only the rows that are read are converted, one at a time, so the
+     *        frame is never converted as a whole.
+     * 
+     * @param dst_image     The output image, RGB888
+     * @param dst_w         Width of the output image
+     * @param dst_h         Height of the output image
+     * @param frame         Source frame
+     * @param x             Left of the region
+     * @param y             Top of the region
+     * @param w             Width of the region
+     * @param h             Height of the region
+     * @return int          0, or -1 if out of memory, the output image is then black
+     */
+    int image_frame_resize(uint8_t *dst_image, int dst_w, int dst_h, const image_frame_t *frame, int x, int y, int w, int h);
+
+    /**
+     * @brief Crop n boxes of a frame and resize each of them, like image_frame_resize, into one n x dst_h x dst_w x 3 image
+     *
+     *        All crops share one buffer for their tables and rows, nothing is allocated per box.
+     * 
+     * @param dst_image     The output images, one after the other
+     * @param dst_w         Width of each output image
+     * @param dst_h         Height of each output image
+     * @param frame         Source frame
+     * @param boxes         Boxes inside the frame, the corners are rounded to pixels
+     * @param n             Number of boxes
+     * @return int          0, or -1 if out of memory, the output images are then black
+     */
+    int image_crop_resize_batch(uint8_t *dst_image, int dst_w, int dst_h, const image_frame_t *frame, const box_t *boxes, int n);
+
     /**
      * @brief Crop， rotate and zoom the image in RGB888 format, 
      * 
@@ -414,6 +658,65 @@ extern "C"
      */
     void image_erode(uint8_t *dst, uint8_t *src, int src_w, int src_h, int src_c);
 
+    /**
+     * @brief Motion mask of two frames: image_abs_diff, image_threshold and image_erode in one pass
+     *
+     *        A pixel is set when every channel differs by more than threshold in its whole 3x3
+     *        neighbourhood, the pixels that are 255 in every channel after the three passes.
+     *        The frames are read once, row by row, and no frame sized buffer is needed.
+     *
+     * @param mask          The output mask, w * h bytes of 255 or 0
+     * @param src1          Frame 1
+     * @param src2          Frame 2
+     * @param w             Width of the frames
+     * @param h             Height of the frames
+     * @param c             Channel of the frames
+     * @param threshold     Threshold of the difference
+     * @return int          Number of pixels set, -1 if out of memory
+     */
+    int image_motion_mask(uint8_t *mask, uint8_t *src1, uint8_t *src2, int w, int h, int c, int threshold);
+
+    /**
+     * @brief image_motion_mask with one bit per pixel
+     *
+     * @param mask          The output mask, h rows of (w + 7) / 8 bytes, pixel x is bit x % 8 of byte x / 8
+     * @return int          Number of pixels set, -1 if out of memory
+     */
+    int image_motion_mask_packed(uint8_t *mask, uint8_t *src1, uint8_t *src2, int w, int h, int c, int threshold);
+
+    /**
+     * @brief Get the bounding boxes of the connected regions of a motion mask
+     * 
+     * @param rois          The output boxes, in the coordinates of the image
+     * @param max_rois      Size of rois, only the largest regions are kept
+     * @param mask          Motion mask, non-zero is motion
+     * @param w             Width of the mask
+     * @param h             Height of the mask
+     * @param scale         Size of the mask / size of the image, 1 if the mask is not resized
+     * @param min_area      Regions of fewer pixels are ignored
+     * @return int          Number of boxes written, -1 if out of memory
+     */
+    int image_motion_rois(box_t *rois, int max_rois, const uint8_t *mask, int w, int h, fptp_t scale, int min_area);
+
+    /**
+     * @brief image_motion_rois on a mask from image_motion_mask_packed
+     */
+    int image_motion_rois_packed(box_t *rois, int max_rois, const uint8_t *mask, int w, int h, fptp_t scale, int min_area);
+
+    /**
+     * @brief Prepare regions for a detector: grow each one to at least min_side around its centre,
+     *        keep it inside the image, and merge the ones that overlap
+     * 
+     * @param dst           The output regions, n boxes, with integer coordinates
+     * @param rois          Input regions
+     * @param n             Number of input regions
+     * @param min_side      Minimum width and height of a region
+     * @param width         Width of the image
+     * @param height        Height of the image
+     * @return int          Number of regions in dst
+     */
+    int image_rois_merge(box_t *dst, const box_t *rois, int n, int min_side, int width, int height);
+
     typedef float matrixType;
     typedef struct
     {
@@ -438,6 +741,37 @@ extern "C"
      */
     void matrix_free(Matrix *m);
 
+    typedef struct
+    {
+        float m[2][3]; /*!< x' = m[0][0] * x + m[0][1] * y + m[0][2], y' = m[1][0] * x + m[1][1] * y + m[1][2] */
+    } image_affine_t;
+
+    /**
+     * @brief Least squares similarity transformation (scale, rotation and translation) from src to dst, in closed form
+     * 
+     * @param T             The resulting transformation
+     * @param srcx          Source x coordinates
+     * @param srcy          Source y coordinates
+     * @param dstx          Destination x coordinates
+     * @param dsty          Destination y coordinates
+     * @param num           The number of the coordinates
+     * @return int          0, or -1 if the points are all the same
+     */
+    int image_similarity_transform(image_affine_t *T, const float *srcx, const float *srcy, const float *dstx, const float *dsty, int num);
+
+    /**
+     * @brief Least squares affine transformation from src to dst, in closed form. Exact for 3 points.
+     * 
+     * @param T             The resulting transformation
+     * @param srcx          Source x coordinates
+     * @param srcy          Source y coordinates
+     * @param dstx          Destination x coordinates
+     * @param dsty          Destination y coordinates
+     * @param num           The number of the coordinates, at least 3
+     * @return int          0, or -1 if the source points are on one line
+     */
+    int image_affine_transform(image_affine_t *T, const float *srcx, const float *srcy, const float *dstx, const float *dsty, int num);
+
     /**
      * @brief Get the similarity matrix of similarity transformation
      * 
@@ -463,6 +797,9 @@ extern "C"
 
     /**
      * @brief Applies an affine transformation to an image
+     *
+     *        The inverse matrix is rounded to 16 fraction bits once, then every pixel is sampled in fixed point,
+     *        so a matrix gives the same crop on every platform. Pixels that map outside img are 0.
      * 
      * @param img           Input image
      * @param crop          Dst output image that has the size dsize and the same type as src
@@ -470,6 +807,32 @@ extern "C"
      */
     void warp_affine(dl_matrix3du_t *img, dl_matrix3du_t *crop, Matrix *M);
 
+    /**
+     * @brief warp_affine by an image_affine_t, without any allocation
+     * 
+     * @param img           Input image
+     * @param crop          Output image, with the same channels as img
+     * @param M             Affine transformation from img to crop
+     * @return int          0, or -1 if M can not be inverted, crop is then all 0
+     */
+    int image_warp_affine(dl_matrix3du_t *img, dl_matrix3du_t *crop, const image_affine_t *M);
+
+    /**
+     * @brief warp_affine of n matrices, quantized straight into n x dst_h x dst_w x c, without a uint8 crop
+     *
+     *        Each value is the pixel of warp_affine shifted left by shift, or right by -shift.
+     * 
+     * @param dst_image     The quantized output, one crop after the other
+     * @param dst_w         Width of each crop
+     * @param dst_h         Height of each crop
+     * @param image         Source image
+     * @param M             n affine matrices from the source to each crop
+     * @param n             Number of crops
+     * @param shift         Shift of the quantization
+     * @return int          0, or -1 if a matrix can not be inverted
+     */
+    int image_warp_affine_batch_q(qtp_t *dst_image, int dst_w, int dst_h, const dl_matrix3du_t *image, const image_affine_t *M, int n, int shift);
+
     /**
      * @brief Resize the image in RGB888 format via bilinear interpolation, and quantify the output image
      * 
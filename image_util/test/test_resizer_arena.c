@@ -0,0 +1,107 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Cached resizer tables survive an arena reset and reuse.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "dl_lib_matrix3d.h"
+#include "image_util.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+#define SRC_W 64
+#define SRC_H 48
+#define DST_W 37
+#define DST_H 29
+
+static uint8_t src[SRC_W * SRC_H * 3];
+static uint8_t expect[DST_W * DST_H * 3];
+static uint8_t dst[DST_W * DST_H * 3];
+
+int main(void)
+{
+    for (int i = 0; i < sizeof(src); i++)
+        src[i] = (uint8_t)(i * 7 + (i >> 5));
+    image_resize_linear(expect, src, DST_W, DST_H, 3, SRC_W, SRC_H);
+
+    dl_lib_arena_t *arena = dl_lib_arena_create(64 * 1024);
+    CHECK(arena);
+    CHECK(NULL == dl_lib_arena_use(arena));
+
+    // the first resize of a new geometry fills a cache slot while the arena is bound
+    image_resize_linear(dst, src, DST_H, DST_W, 3, SRC_W, SRC_H);
+    const image_resizer_t *cached = image_resizer_get(DST_H, DST_W, SRC_W, SRC_H);
+    CHECK(cached);
+    CHECK((const uint8_t *)cached < arena->base || (const uint8_t *)cached >= arena->base + arena->size);
+
+    // reuse every byte of the arena, then resize with the cached tables
+    for (int frame = 0; frame < 3; frame++)
+    {
+        dl_lib_arena_reset(arena);
+        uint8_t *fill = (uint8_t *)dl_lib_malloc(arena->size, 1, 0);
+        CHECK(fill);
+        memset(fill, 0xa5, arena->size);
+        dl_lib_free(fill);
+        dl_lib_arena_reset(arena);
+
+        image_resize_linear(dst, src, DST_H, DST_W, 3, SRC_W, SRC_H);
+        CHECK(cached == image_resizer_get(DST_H, DST_W, SRC_W, SRC_H));
+        CHECK(cached->dst_w == DST_H && cached->dst_h == DST_W && cached->src_w == SRC_W && cached->src_h == SRC_H);
+    }
+
+    // and the geometry cached before the arena still gives the same image
+    memset(dst, 0, sizeof(dst));
+    image_resize_linear(dst, src, DST_W, DST_H, 3, SRC_W, SRC_H);
+    CHECK(0 == memcmp(dst, expect, sizeof(dst)));
+
+    // a geometry cached inside the arena gives the same image as a temporary resizer
+    dl_lib_arena_destroy(arena);
+    image_resizer_t *temp = image_resizer_alloc(DST_H, DST_W, SRC_W, SRC_H);
+    CHECK(temp);
+    uint8_t ref[DST_W * DST_H * 3];
+    CHECK(0 == image_resizer_run(temp, ref, src, SRC_W * 3, 3));
+    image_resizer_free(temp);
+    arena = dl_lib_arena_create(64 * 1024);
+    CHECK(arena);
+    CHECK(NULL == dl_lib_arena_use(arena));
+    uint8_t *fill = (uint8_t *)dl_lib_calloc(arena->size, 1, 0);
+    CHECK(fill);
+    memset(dst, 0, sizeof(dst));
+    image_resize_linear(dst, src, DST_H, DST_W, 3, SRC_W, SRC_H);
+    CHECK(0 == memcmp(dst, ref, sizeof(dst)));
+
+    dl_lib_arena_destroy(arena);
+    printf("resizer_arena: ok\n");
+    return 0;
+}
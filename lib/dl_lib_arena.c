@@ -0,0 +1,88 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "dl_lib_matrix3d.h"
+#if DL_SPIRAM_SUPPORT
+#include "esp_heap_caps.h"
+#endif
+
+__thread dl_lib_arena_t *dl_lib_arena_current = NULL;
+
+dl_lib_arena_t *dl_lib_arena_create(size_t size)
+{
+    dl_lib_arena_t *arena = (dl_lib_arena_t *)calloc(1, sizeof(dl_lib_arena_t));
+    if (NULL == arena)
+        return NULL;
+
+    void *buffer = malloc(size);
+#if DL_SPIRAM_SUPPORT
+    if (NULL == buffer)
+        buffer = heap_caps_malloc(size, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM);
+#endif
+    if (NULL == buffer)
+    {
+        printf("Arena alloc failed. Size: %d\n", (int)size);
+        free(arena);
+        return NULL;
+    }
+
+    dl_lib_arena_init(arena, buffer, size);
+    arena->owned = 1;
+    return arena;
+}
+
+void dl_lib_arena_init(dl_lib_arena_t *arena, void *buffer, size_t size)
+{
+    arena->base = (uint8_t *)buffer;
+    arena->size = size;
+    arena->used = 0;
+    arena->peak = 0;
+    arena->overflow = 0;
+    arena->owned = 0;
+}
+
+dl_lib_arena_t *dl_lib_arena_use(dl_lib_arena_t *arena)
+{
+    dl_lib_arena_t *previous = dl_lib_arena_current;
+    dl_lib_arena_current = arena;
+    return previous;
+}
+
+void dl_lib_arena_reset(dl_lib_arena_t *arena)
+{
+    arena->used = 0;
+    arena->overflow = 0;
+}
+
+void dl_lib_arena_destroy(dl_lib_arena_t *arena)
+{
+    if (NULL == arena)
+        return;
+    if (dl_lib_arena_current == arena)
+        dl_lib_arena_current = NULL;
+    if (arena->owned)
+    {
+        free(arena->base);
+        free(arena);
+    }
+}
@@ -0,0 +1,291 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "dl_lib_matrix3d.h"
+#if DL_SPIRAM_SUPPORT
+#include "esp_heap_caps.h"
+#endif
+
+__thread dl_lib_plan_t *dl_lib_plan_current = NULL;
+
+dl_lib_plan_t *dl_lib_plan_create(void)
+{
+    dl_lib_plan_t *plan = (dl_lib_plan_t *)calloc(1, sizeof(dl_lib_plan_t));
+    if (NULL == plan)
+        return NULL;
+    plan->recording = 1;
+    return plan;
+}
+
+void dl_lib_plan_begin(dl_lib_plan_t *plan)
+{
+    if (!plan->recording)
+        plan->event = 0;
+    plan->next = 0;
+    plan->mismatch = 0;
+    plan->diverged = 0;
+    plan->alive_count = 0;
+    dl_lib_plan_current = plan;
+}
+
+void *dl_lib_plan_alloc(dl_lib_plan_t *plan, size_t size)
+{
+    // An allocation at another event than recorded means the buffers alive now are not the
+    // recorded ones, so the slab offset could overlap one of them.
+    int i = plan->next;
+    if (plan->diverged || NULL == plan->slab || i >= plan->count || size != plan->size[i] || plan->event != plan->start[i])
+    {
+        plan->diverged = 1;
+        plan->mismatch++;
+        return NULL;
+    }
+    plan->next++;
+    plan->event++;
+    plan->alive[plan->alive_count++] = i;
+    return plan->slab + plan->offset[i];
+}
+
+void dl_lib_plan_record_alloc(dl_lib_plan_t *plan, void *pointer, size_t size)
+{
+    if (plan->count == plan->capacity)
+    {
+        int capacity = plan->capacity ? plan->capacity * 2 : 64;
+        size_t *new_size = (size_t *)realloc(plan->size, capacity * sizeof(size_t));
+        if (new_size)
+            plan->size = new_size;
+        int *new_start = (int *)realloc(plan->start, capacity * sizeof(int));
+        if (new_start)
+            plan->start = new_start;
+        int *new_end = (int *)realloc(plan->end, capacity * sizeof(int));
+        if (new_end)
+            plan->end = new_end;
+        void **new_pointer = (void **)realloc(plan->pointer, capacity * sizeof(void *));
+        if (new_pointer)
+            plan->pointer = new_pointer;
+        int *new_alive = (int *)realloc(plan->alive, capacity * sizeof(int));
+        if (new_alive)
+            plan->alive = new_alive;
+        if (NULL == new_size || NULL == new_start || NULL == new_end || NULL == new_pointer || NULL == new_alive)
+        {
+            plan->mismatch++;
+            return;
+        }
+        plan->capacity = capacity;
+    }
+
+    int i = plan->count++;
+    plan->size[i] = size;
+    plan->start[i] = plan->event++;
+    plan->end[i] = INT32_MAX;
+    plan->pointer[i] = pointer;
+    plan->alive[plan->alive_count++] = i;
+    plan->total += size;
+    plan->live += size;
+    if (plan->live > plan->live_peak)
+        plan->live_peak = plan->live;
+}
+
+/*
+ * Index in plan->alive of the buffer of 'pointer', -1 if it is not alive in this pass.
+ * Recently allocated buffers are usually the first to be freed.
+ */
+static int dl_lib_plan_find(dl_lib_plan_t *plan, void *pointer)
+{
+    for (int k = plan->alive_count - 1; k >= 0; k--)
+    {
+        int i = plan->alive[k];
+        if (plan->recording)
+        {
+            if (plan->pointer[i] == pointer)
+                return k;
+        }
+        else
+        {
+            uint8_t *base = plan->slab + plan->offset[i];
+            if ((uint8_t *)pointer >= base && (uint8_t *)pointer < base + plan->size[i])
+                return k;
+        }
+    }
+    return -1;
+}
+
+void dl_lib_plan_free(dl_lib_plan_t *plan, void *pointer)
+{
+    // Heap buffers of a replay are not in the recording, nor are buffers from before the pass.
+    if (!plan->recording && (plan->diverged || NULL == plan->slab || (uint8_t *)pointer < plan->slab || (uint8_t *)pointer >= plan->slab + plan->peak))
+        return;
+
+    int k = dl_lib_plan_find(plan, pointer);
+    if (k < 0)
+        return;
+    int i = plan->alive[k];
+    plan->alive_count--;
+    memmove(plan->alive + k, plan->alive + k + 1, (plan->alive_count - k) * sizeof(int));
+
+    if (plan->recording)
+    {
+        plan->pointer[i] = NULL;
+        plan->end[i] = plan->event++;
+        plan->live -= plan->size[i];
+    }
+    else if (plan->end[i] != plan->event++)
+    {
+        plan->diverged = 1;
+    }
+}
+
+typedef struct
+{
+    size_t offset;
+    size_t size;
+} dl_lib_plan_range_t;
+
+static const dl_lib_plan_t *dl_lib_plan_sorted;
+
+static int dl_lib_plan_size_compare(const void *a, const void *b)
+{
+    int i = *(const int *)a;
+    int j = *(const int *)b;
+    const dl_lib_plan_t *plan = dl_lib_plan_sorted;
+    if (plan->size[i] != plan->size[j])
+        return plan->size[i] < plan->size[j] ? 1 : -1;
+    return plan->start[i] - plan->start[j];
+}
+
+static int dl_lib_plan_offset_compare(const void *a, const void *b)
+{
+    const dl_lib_plan_range_t *x = (const dl_lib_plan_range_t *)a;
+    const dl_lib_plan_range_t *y = (const dl_lib_plan_range_t *)b;
+    return x->offset < y->offset ? -1 : x->offset > y->offset;
+}
+
+/*
+ * Greedy by size: place the largest allocations first, each at the lowest offset that does not
+ * overlap an already placed allocation alive at the same time. The placed allocations alive with
+ * the new one are sorted by offset and the first gap large enough is taken.
+ */
+static size_t dl_lib_plan_assign(dl_lib_plan_t *plan)
+{
+    int *order = (int *)malloc(plan->count * sizeof(int));
+    dl_lib_plan_range_t *ranges = (dl_lib_plan_range_t *)malloc(plan->count * sizeof(dl_lib_plan_range_t));
+    if ((NULL == order || NULL == ranges) && plan->count)
+    {
+        free(order);
+        free(ranges);
+        return 0;
+    }
+
+    for (int i = 0; i < plan->count; i++)
+        order[i] = i;
+    // plans are built once, before the passes, so a static context for the compare is enough
+    dl_lib_plan_sorted = plan;
+    qsort(order, plan->count, sizeof(int), dl_lib_plan_size_compare);
+
+    size_t peak = 0;
+    for (int k = 0; k < plan->count; k++)
+    {
+        int i = order[k];
+        int n = 0;
+        for (int p = 0; p < k; p++)
+        {
+            int j = order[p];
+            if (plan->start[i] >= plan->end[j] || plan->start[j] >= plan->end[i])
+                continue;
+            ranges[n].offset = plan->offset[j];
+            ranges[n].size = plan->size[j];
+            n++;
+        }
+        qsort(ranges, n, sizeof(dl_lib_plan_range_t), dl_lib_plan_offset_compare);
+
+        size_t offset = 0;
+        for (int r = 0; r < n && ranges[r].offset < offset + plan->size[i]; r++)
+        {
+            if (ranges[r].offset + ranges[r].size > offset)
+                offset = ranges[r].offset + ranges[r].size;
+        }
+        plan->offset[i] = offset;
+        if (offset + plan->size[i] > peak)
+            peak = offset + plan->size[i];
+    }
+
+    free(order);
+    free(ranges);
+    return peak;
+}
+
+dl_error_type dl_lib_plan_end(dl_lib_plan_t *plan)
+{
+    if (dl_lib_plan_current == plan)
+        dl_lib_plan_current = NULL;
+    if (!plan->recording)
+        return DL_SUCCESS;
+
+    plan->recording = 0;
+    free(plan->pointer);
+    plan->pointer = NULL;
+    if (plan->mismatch)
+    {
+        // an allocation is missing from the recording, replaying it would be wrong
+        printf("Plan record failed, %d allocations missing\n", plan->mismatch);
+        return DL_FAIL;
+    }
+
+    plan->offset = (size_t *)malloc(plan->count * sizeof(size_t));
+    if (NULL == plan->offset && plan->count)
+        return DL_FAIL;
+    plan->peak = dl_lib_plan_assign(plan);
+
+    plan->slab = (uint8_t *)malloc(plan->peak);
+#if DL_SPIRAM_SUPPORT
+    if (NULL == plan->slab)
+        plan->slab = (uint8_t *)heap_caps_malloc(plan->peak, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM);
+#endif
+    if (NULL == plan->slab)
+    {
+        printf("Plan slab alloc failed. Size: %d\n", (int)plan->peak);
+        return DL_FAIL;
+    }
+    return DL_SUCCESS;
+}
+
+void dl_lib_plan_report(dl_lib_plan_t *plan)
+{
+    printf("allocations: %d, total: %d bytes, live peak: %d bytes, slab: %d bytes, mismatch: %d\n",
+           plan->count, (int)plan->total, (int)plan->live_peak, (int)plan->peak, plan->mismatch);
+}
+
+void dl_lib_plan_destroy(dl_lib_plan_t *plan)
+{
+    if (NULL == plan)
+        return;
+    if (dl_lib_plan_current == plan)
+        dl_lib_plan_current = NULL;
+    free(plan->size);
+    free(plan->start);
+    free(plan->end);
+    free(plan->offset);
+    free(plan->pointer);
+    free(plan->alive);
+    free(plan->slab);
+    free(plan);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+/*
+ * Helpers shared by the portable C implementation of dl_lib_matrix3d.h and
+ * dl_lib_matrix3dq.h. Not part of the public interface.
+ */
+#include "dl_lib_matrix3d.h"
+#include "dl_lib_matrix3dq.h"
+
+/**
+ * @brief Calculate the output size and the leading padding of one dimension
+ *
+ * @param in            Input size
+ * @param kernel        Kernel size
+ * @param stride        Stride
+ * @param padding       Padding type
+ * @param out           Output size
+ * @param pad_before    Padding before the first item, left or top
+ */
+static inline void dl_lib_out_size(int in, int kernel, int stride, dl_padding_type padding, int *out, int *pad_before)
+{
+    if (PADDING_VALID == padding)
+    {
+        *out = (in - kernel) / stride + 1;
+        *pad_before = 0;
+        return;
+    }
+
+    *out = (in + stride - 1) / stride;
+    int pad_total = (*out - 1) * stride + kernel - in;
+    if (pad_total < 0)
+        pad_total = 0;
+
+    if (PADDING_SAME_MXNET == padding)
+        *pad_before = pad_total - pad_total / 2;
+    else
+        *pad_before = pad_total / 2;
+}
+
+/**
+ * @brief Shift an accumulator by 'shift' bits, rounding half up for right shifts
+ *
+ * @param value     Accumulator
+ * @param shift     Positive for right shift, negative for left shift
+ * @return int64_t  Shifted value
+ */
+static inline int64_t dl_lib_shift_round(int64_t value, int shift)
+{
+    if (shift > 0)
+    {
+        if (shift > 62)
+            return value < 0 ? -1 : 0;
+        return (value + ((int64_t)1 << (shift - 1))) >> shift;
+    }
+    if (shift < -32)
+        shift = -32;
+    return value * ((int64_t)1 << -shift);
+}
+
+/**
+ * @brief Saturate an accumulator to the qtp_t range
+ */
+static inline qtp_t dl_lib_saturate(int64_t value)
+{
+    if (value > DL_QTP_MAX)
+        return DL_QTP_MAX;
+    if (value < DL_QTP_MIN)
+        return DL_QTP_MIN;
+    return (qtp_t)value;
+}
+
+/**
+ * @brief int16 multiply-accumulate primitives, see dl_lib_kernels.c
+ */
+typedef struct
+{
+    const char *name;                                                /*!< Instruction set of the implementation */
+    int64_t (*dot)(const qtp_t *a, const qtp_t *b, int n);           /*!< Sum of a[i] * b[i] */
+    void (*mac)(int64_t *acc, const qtp_t *a, const qtp_t *b, int n); /*!< acc[i] += a[i] * b[i] */
+} dl_lib_q_kernels_t;
+
+/**
+ * @brief Get the fastest primitives supported by the running CPU
+ */
+const dl_lib_q_kernels_t *dl_lib_q_kernels(void);
+
+/**
+ * @brief Get the scalar reference primitives
+ */
+const dl_lib_q_kernels_t *dl_lib_q_kernels_reference(void);
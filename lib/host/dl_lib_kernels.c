@@ -0,0 +1,179 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * int16 multiply-accumulate primitives behind the quantized convolutions.
+ * The SIMD versions are selected at run time and give exactly the same
+ * 64-bit sums as the scalar reference, set ESP_FACE_HOST_NO_SIMD to force
+ * the scalar path.
+ */
+#include "dl_lib_host.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DL_LIB_AVX2 1
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DL_LIB_NEON 1
+#endif
+
+static int64_t dl_lib_dot_q_c(const qtp_t *a, const qtp_t *b, int n)
+{
+    int64_t sum = 0;
+    for (int i = 0; i < n; i++)
+        sum += (int32_t)a[i] * b[i];
+    return sum;
+}
+
+static void dl_lib_mac_q_c(int64_t *acc, const qtp_t *a, const qtp_t *b, int n)
+{
+    for (int i = 0; i < n; i++)
+        acc[i] += (int32_t)a[i] * b[i];
+}
+
+#if DL_LIB_AVX2
+/*
+ * _mm256_madd_epi16 adds two int16 products in 32 bits. The pair sum lies in
+ * (-2^31, 2^31], only (-32768)^2 + (-32768)^2 wraps and it wraps to INT32_MIN,
+ * which no other pair can produce. Widening (sum - 1) and adding the 1 back in
+ * 64 bits therefore restores the exact value.
+ */
+__attribute__((target("avx2"))) static int64_t dl_lib_dot_q_avx2(const qtp_t *a, const qtp_t *b, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi32(1);
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i s = _mm256_sub_epi32(_mm256_madd_epi16(va, vb), one);
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(s)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(s, 1)));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int64_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3] + (int64_t)(i / 2);
+    for (; i < n; i++)
+        sum += (int32_t)a[i] * b[i];
+    return sum;
+}
+
+__attribute__((target("avx2"))) static void dl_lib_mac_q_avx2(int64_t *acc, const qtp_t *a, const qtp_t *b, int n)
+{
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i va = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(a + i)));
+        __m256i vb = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(b + i)));
+        __m256i p = _mm256_mullo_epi32(va, vb);
+        __m256i lo = _mm256_add_epi64(_mm256_loadu_si256((const __m256i *)(acc + i)),
+                                      _mm256_cvtepi32_epi64(_mm256_castsi256_si128(p)));
+        __m256i hi = _mm256_add_epi64(_mm256_loadu_si256((const __m256i *)(acc + i + 4)),
+                                      _mm256_cvtepi32_epi64(_mm256_extracti128_si256(p, 1)));
+        _mm256_storeu_si256((__m256i *)(acc + i), lo);
+        _mm256_storeu_si256((__m256i *)(acc + i + 4), hi);
+    }
+    for (; i < n; i++)
+        acc[i] += (int32_t)a[i] * b[i];
+}
+#endif
+
+#if DL_LIB_NEON
+static int64_t dl_lib_dot_q_neon(const qtp_t *a, const qtp_t *b, int n)
+{
+    int64x2_t acc = vdupq_n_s64(0);
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        int16x8_t va = vld1q_s16(a + i);
+        int16x8_t vb = vld1q_s16(b + i);
+        acc = vpadalq_s32(acc, vmull_s16(vget_low_s16(va), vget_low_s16(vb)));
+        acc = vpadalq_s32(acc, vmull_high_s16(va, vb));
+    }
+
+    int64_t sum = vaddvq_s64(acc);
+    for (; i < n; i++)
+        sum += (int32_t)a[i] * b[i];
+    return sum;
+}
+
+static void dl_lib_mac_q_neon(int64_t *acc, const qtp_t *a, const qtp_t *b, int n)
+{
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        int16x8_t va = vld1q_s16(a + i);
+        int16x8_t vb = vld1q_s16(b + i);
+        int32x4_t lo = vmull_s16(vget_low_s16(va), vget_low_s16(vb));
+        int32x4_t hi = vmull_high_s16(va, vb);
+        vst1q_s64(acc + i, vaddw_s32(vld1q_s64(acc + i), vget_low_s32(lo)));
+        vst1q_s64(acc + i + 2, vaddw_high_s32(vld1q_s64(acc + i + 2), lo));
+        vst1q_s64(acc + i + 4, vaddw_s32(vld1q_s64(acc + i + 4), vget_low_s32(hi)));
+        vst1q_s64(acc + i + 6, vaddw_high_s32(vld1q_s64(acc + i + 6), hi));
+    }
+    for (; i < n; i++)
+        acc[i] += (int32_t)a[i] * b[i];
+}
+#endif
+
+static const dl_lib_q_kernels_t dl_lib_q_kernels_c = {"c", dl_lib_dot_q_c, dl_lib_mac_q_c};
+#if DL_LIB_AVX2
+static const dl_lib_q_kernels_t dl_lib_q_kernels_avx2 = {"avx2", dl_lib_dot_q_avx2, dl_lib_mac_q_avx2};
+#endif
+#if DL_LIB_NEON
+static const dl_lib_q_kernels_t dl_lib_q_kernels_neon = {"neon", dl_lib_dot_q_neon, dl_lib_mac_q_neon};
+#endif
+
+static const dl_lib_q_kernels_t *dl_lib_q_kernels_select(void)
+{
+    if (getenv("ESP_FACE_HOST_NO_SIMD"))
+        return &dl_lib_q_kernels_c;
+#if DL_LIB_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return &dl_lib_q_kernels_avx2;
+#endif
+#if DL_LIB_NEON
+    return &dl_lib_q_kernels_neon;
+#endif
+    return &dl_lib_q_kernels_c;
+}
+
+const dl_lib_q_kernels_t *dl_lib_q_kernels(void)
+{
+    // Selection is idempotent, a race between threads only repeats it.
+    static const dl_lib_q_kernels_t *selected = NULL;
+    if (NULL == selected)
+        selected = dl_lib_q_kernels_select();
+    return selected;
+}
+
+const dl_lib_q_kernels_t *dl_lib_q_kernels_reference(void)
+{
+    return &dl_lib_q_kernels_c;
+}
@@ -0,0 +1,650 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Portable C implementation of dl_lib_matrix3d.h, used by the host build in
+ * place of libdl.a. Every function behaves as the DL_C_IMPL path.
+ */
+#include "dl_lib_host.h"
+
+static dl_matrix3d_t *dl_matrix3d_from_matrixu(dl_matrix3du_t *in)
+{
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(in->n, in->w, in->h, in->c);
+    int count = in->n * in->w * in->h * in->c;
+    for (int i = 0; i < count; i++)
+        out->item[i] = in->item[i];
+    return out;
+}
+
+/*
+ * Generic convolution kernel. 'out' is preallocated, its size decides the output window.
+ * For depthwise convolution the filter is (1, w, h, c) and each channel is convolved alone.
+ */
+static void dl_matrix3d_conv_kernel(dl_matrix3d_t *out,
+                                    dl_matrix3d_t *in,
+                                    dl_matrix3d_t *filter,
+                                    dl_matrix3d_t *bias,
+                                    int stride_x,
+                                    int stride_y,
+                                    int pad_x,
+                                    int pad_y,
+                                    int depthwise)
+{
+    int out_c = depthwise ? in->c : filter->n;
+    for (int oy = 0; oy < out->h; oy++)
+    {
+        for (int ox = 0; ox < out->w; ox++)
+        {
+            fptp_t *o = out->item + oy * out->stride + ox * out->c;
+            for (int oc = 0; oc < out_c; oc++)
+            {
+                fptp_t sum = bias ? bias->item[oc] : 0;
+                for (int fy = 0; fy < filter->h; fy++)
+                {
+                    int iy = oy * stride_y + fy - pad_y;
+                    if (iy < 0 || iy >= in->h)
+                        continue;
+                    for (int fx = 0; fx < filter->w; fx++)
+                    {
+                        int ix = ox * stride_x + fx - pad_x;
+                        if (ix < 0 || ix >= in->w)
+                            continue;
+                        fptp_t *pi = in->item + iy * in->stride + ix * in->c;
+                        if (depthwise)
+                        {
+                            sum += pi[oc] * filter->item[(fy * filter->w + fx) * filter->c + oc];
+                        }
+                        else
+                        {
+                            fptp_t *pf = filter->item + ((oc * filter->h + fy) * filter->w + fx) * filter->c;
+                            for (int ic = 0; ic < in->c; ic++)
+                                sum += pi[ic] * pf[ic];
+                        }
+                    }
+                }
+                o[oc] = sum;
+            }
+        }
+    }
+}
+
+static dl_matrix3d_t *dl_matrix3d_conv_padded(dl_matrix3d_t *in,
+                                              dl_matrix3d_t *filter,
+                                              dl_matrix3d_t *bias,
+                                              int stride_x,
+                                              int stride_y,
+                                              dl_padding_type padding,
+                                              int depthwise)
+{
+    int out_w, out_h, pad_x, pad_y;
+    dl_lib_out_size(in->w, filter->w, stride_x, padding, &out_w, &pad_x);
+    dl_lib_out_size(in->h, filter->h, stride_y, padding, &out_h, &pad_y);
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(1, out_w, out_h, depthwise ? in->c : filter->n);
+    if (NULL == out)
+        return NULL;
+    dl_matrix3d_conv_kernel(out, in, filter, bias, stride_x, stride_y, pad_x, pad_y, depthwise);
+    return out;
+}
+
+void dl_matrix3dff_dot_product(dl_matrix3d_t *out, dl_matrix3d_t *in, dl_matrix3d_t *f)
+{
+    dl_matrix3dff_fc(out, in, f);
+}
+
+void dl_matrix3d_softmax(dl_matrix3d_t *m)
+{
+    int pixels = m->n * m->w * m->h;
+    for (int p = 0; p < pixels; p++)
+    {
+        fptp_t *item = m->item + p * m->c;
+        fptp_t max_value = item[0];
+        for (int i = 1; i < m->c; i++)
+            max_value = max(max_value, item[i]);
+
+        fptp_t sum = 0;
+        for (int i = 0; i < m->c; i++)
+        {
+            item[i] = expf(item[i] - max_value);
+            sum += item[i];
+        }
+        for (int i = 0; i < m->c; i++)
+            item[i] /= sum;
+    }
+}
+
+void dl_matrix3d_slice_copy(dl_matrix3d_t *dst,
+                            dl_matrix3d_t *src,
+                            int x,
+                            int y,
+                            int w,
+                            int h)
+{
+    for (int i = 0; i < h; i++)
+        memcpy(dst->item + i * dst->stride, src->item + (y + i) * src->stride + x * src->c, w * src->c * sizeof(fptp_t));
+}
+
+void dl_matrix3du_slice_copy(dl_matrix3du_t *dst,
+                             dl_matrix3du_t *src,
+                             int x,
+                             int y,
+                             int w,
+                             int h)
+{
+    for (int i = 0; i < h; i++)
+        memcpy(dst->item + i * dst->stride, src->item + (y + i) * src->stride + x * src->c, w * src->c * sizeof(uc_t));
+}
+
+void dl_matrix3d_sliced_transform_nchw(dl_matrix3d_t *out,
+                                       dl_matrix3d_t *in)
+{
+    int plane = in->w * in->h;
+    for (int i = 0; i < plane; i++)
+        for (int c = 0; c < in->c; c++)
+            out->item[c * plane + i] = in->item[i * in->c + c];
+}
+
+dl_matrix3d_t *dl_matrix3d_conv(dl_matrix3d_t *in,
+                                dl_matrix3d_t *filter,
+                                dl_matrix3d_t *bias,
+                                int stride_x,
+                                int stride_y,
+                                int padding,
+                                int mode)
+{
+    return dl_matrix3d_conv_padded(in, filter, bias, stride_x, stride_y, padding, 0);
+}
+
+dl_matrix3d_t *dl_matrix3d_global_pool(dl_matrix3d_t *in)
+{
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(1, 1, 1, in->c);
+    if (NULL == out)
+        return NULL;
+    int plane = in->w * in->h;
+    for (int c = 0; c < in->c; c++)
+    {
+        fptp_t sum = 0;
+        for (int i = 0; i < plane; i++)
+            sum += in->item[i * in->c + c];
+        out->item[c] = sum / plane;
+    }
+    return out;
+}
+
+dl_matrix3d_t *dl_matrix3d_pooling(dl_matrix3d_t *in,
+                                   int f_w,
+                                   int f_h,
+                                   int stride_x,
+                                   int stride_y,
+                                   dl_padding_type padding,
+                                   dl_pooling_type pooling_type)
+{
+    int out_w, out_h, pad_x, pad_y;
+    dl_lib_out_size(in->w, f_w, stride_x, padding, &out_w, &pad_x);
+    dl_lib_out_size(in->h, f_h, stride_y, padding, &out_h, &pad_y);
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(1, out_w, out_h, in->c);
+    if (NULL == out)
+        return NULL;
+
+    for (int oy = 0; oy < out_h; oy++)
+    {
+        int y1 = max(oy * stride_y - pad_y, 0);
+        int y2 = min(oy * stride_y - pad_y + f_h, in->h);
+        for (int ox = 0; ox < out_w; ox++)
+        {
+            int x1 = max(ox * stride_x - pad_x, 0);
+            int x2 = min(ox * stride_x - pad_x + f_w, in->w);
+            fptp_t *o = out->item + oy * out->stride + ox * out->c;
+            for (int c = 0; c < in->c; c++)
+            {
+                fptp_t value = (DL_POOLING_MAX == pooling_type) ? -INFINITY : 0;
+                for (int y = y1; y < y2; y++)
+                {
+                    for (int x = x1; x < x2; x++)
+                    {
+                        fptp_t v = in->item[y * in->stride + x * in->c + c];
+                        if (DL_POOLING_MAX == pooling_type)
+                            value = max(value, v);
+                        else
+                            value += v;
+                    }
+                }
+                if (DL_POOLING_AVG == pooling_type)
+                    value /= (y2 - y1) * (x2 - x1);
+                o[c] = value;
+            }
+        }
+    }
+    return out;
+}
+
+void dl_matrix3d_batch_normalize(dl_matrix3d_t *m,
+                                 dl_matrix3d_t *scale,
+                                 dl_matrix3d_t *offset)
+{
+    int pixels = m->n * m->w * m->h;
+    for (int p = 0; p < pixels; p++)
+    {
+        fptp_t *item = m->item + p * m->c;
+        for (int c = 0; c < m->c; c++)
+            item[c] = item[c] * scale->item[c] + offset->item[c];
+    }
+}
+
+dl_matrix3d_t *dl_matrix3d_add(dl_matrix3d_t *in_1, dl_matrix3d_t *in_2)
+{
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(in_1->n, in_1->w, in_1->h, in_1->c);
+    if (NULL == out)
+        return NULL;
+    int count = in_1->n * in_1->w * in_1->h * in_1->c;
+    for (int i = 0; i < count; i++)
+        out->item[i] = in_1->item[i] + in_2->item[i];
+    return out;
+}
+
+static dl_matrix3d_t *dl_matrix3d_concat_n(dl_matrix3d_t **in, int num)
+{
+    int c = 0;
+    for (int i = 0; i < num; i++)
+        c += in[i]->c;
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(1, in[0]->w, in[0]->h, c);
+    if (NULL == out)
+        return NULL;
+
+    int pixels = in[0]->w * in[0]->h;
+    fptp_t *o = out->item;
+    for (int p = 0; p < pixels; p++)
+    {
+        for (int i = 0; i < num; i++)
+        {
+            memcpy(o, in[i]->item + p * in[i]->c, in[i]->c * sizeof(fptp_t));
+            o += in[i]->c;
+        }
+    }
+    return out;
+}
+
+dl_matrix3d_t *dl_matrix3d_concat(dl_matrix3d_t *in_1, dl_matrix3d_t *in_2)
+{
+    dl_matrix3d_t *in[2] = {in_1, in_2};
+    return dl_matrix3d_concat_n(in, 2);
+}
+
+dl_matrix3d_t *dl_matrix3d_concat_4(dl_matrix3d_t *in_1,
+                                    dl_matrix3d_t *in_2,
+                                    dl_matrix3d_t *in_3,
+                                    dl_matrix3d_t *in_4)
+{
+    dl_matrix3d_t *in[4] = {in_1, in_2, in_3, in_4};
+    return dl_matrix3d_concat_n(in, 4);
+}
+
+dl_matrix3d_t *dl_matrix3d_concat_8(dl_matrix3d_t *in_1,
+                                    dl_matrix3d_t *in_2,
+                                    dl_matrix3d_t *in_3,
+                                    dl_matrix3d_t *in_4,
+                                    dl_matrix3d_t *in_5,
+                                    dl_matrix3d_t *in_6,
+                                    dl_matrix3d_t *in_7,
+                                    dl_matrix3d_t *in_8)
+{
+    dl_matrix3d_t *in[8] = {in_1, in_2, in_3, in_4, in_5, in_6, in_7, in_8};
+    return dl_matrix3d_concat_n(in, 8);
+}
+
+/*
+ * Pointwise convolution whose filter is split into 'num' groups of output channels.
+ */
+static dl_matrix3d_t *dl_matrix3d_conv_1x1_split(dl_matrix3d_t *in, dl_matrix3d_t **filter, int num)
+{
+    int c = 0;
+    for (int i = 0; i < num; i++)
+        c += filter[i]->n;
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(1, in->w, in->h, c);
+    if (NULL == out)
+        return NULL;
+
+    fptp_t *dst = out->item;
+    for (int i = 0; i < num; i++)
+    {
+        dl_matrix3d_t *tmp = dl_matrix3d_alloc_uninit(1, in->w, in->h, filter[i]->n);
+        dl_matrix3dff_conv_1x1(tmp, in, filter[i]);
+        int pixels = in->w * in->h;
+        for (int p = 0; p < pixels; p++)
+            memcpy(dst + p * c, tmp->item + p * tmp->c, tmp->c * sizeof(fptp_t));
+        dst += tmp->c;
+        dl_matrix3d_free(tmp);
+    }
+    return out;
+}
+
+static dl_matrix3d_t *dl_matrix3d_mobilefaceblock_common(dl_matrix3d_t *in,
+                                                         dl_matrix3d_t **pw,
+                                                         int pw_num,
+                                                         dl_matrix3d_t *pw_bn_scale,
+                                                         dl_matrix3d_t *pw_bn_offset,
+                                                         dl_matrix3d_t *dw,
+                                                         dl_matrix3d_t *dw_bn_scale,
+                                                         dl_matrix3d_t *dw_bn_offset,
+                                                         dl_matrix3d_t **pw_linear,
+                                                         int pw_linear_num,
+                                                         dl_matrix3d_t *pw_linear_bn_scale,
+                                                         dl_matrix3d_t *pw_linear_bn_offset,
+                                                         int stride_x,
+                                                         int stride_y,
+                                                         int padding,
+                                                         int shortcut)
+{
+    dl_matrix3d_t *pw_out = dl_matrix3d_conv_1x1_split(in, pw, pw_num);
+    dl_matrix3d_batch_normalize(pw_out, pw_bn_scale, pw_bn_offset);
+    dl_matrix3d_relu(pw_out);
+
+    dl_matrix3d_t *dw_out = dl_matrix3dff_depthwise_conv_common(pw_out, dw, stride_x, stride_y, padding);
+    dl_matrix3d_free(pw_out);
+    dl_matrix3d_batch_normalize(dw_out, dw_bn_scale, dw_bn_offset);
+    dl_matrix3d_relu(dw_out);
+
+    dl_matrix3d_t *out = dl_matrix3d_conv_1x1_split(dw_out, pw_linear, pw_linear_num);
+    dl_matrix3d_free(dw_out);
+    dl_matrix3d_batch_normalize(out, pw_linear_bn_scale, pw_linear_bn_offset);
+
+    if (shortcut)
+    {
+        int count = out->w * out->h * out->c;
+        for (int i = 0; i < count; i++)
+            out->item[i] += in->item[i];
+    }
+    return out;
+}
+
+dl_matrix3d_t *dl_matrix3d_mobilefaceblock(dl_matrix3d_t *in,
+                                           dl_matrix3d_t *pw,
+                                           dl_matrix3d_t *pw_bn_scale,
+                                           dl_matrix3d_t *pw_bn_offset,
+                                           dl_matrix3d_t *dw,
+                                           dl_matrix3d_t *dw_bn_scale,
+                                           dl_matrix3d_t *dw_bn_offset,
+                                           dl_matrix3d_t *pw_linear,
+                                           dl_matrix3d_t *pw_linear_bn_scale,
+                                           dl_matrix3d_t *pw_linear_bn_offset,
+                                           int stride_x,
+                                           int stride_y,
+                                           int padding,
+                                           int mode,
+                                           int shortcut)
+{
+    return dl_matrix3d_mobilefaceblock_common(in,
+                                              &pw, 1, pw_bn_scale, pw_bn_offset,
+                                              dw, dw_bn_scale, dw_bn_offset,
+                                              &pw_linear, 1, pw_linear_bn_scale, pw_linear_bn_offset,
+                                              stride_x, stride_y, padding, shortcut);
+}
+
+dl_matrix3d_t *dl_matrix3d_mobilefaceblock_split(dl_matrix3d_t *in,
+                                                 dl_matrix3d_t *pw_1,
+                                                 dl_matrix3d_t *pw_2,
+                                                 dl_matrix3d_t *pw_bn_scale,
+                                                 dl_matrix3d_t *pw_bn_offset,
+                                                 dl_matrix3d_t *dw,
+                                                 dl_matrix3d_t *dw_bn_scale,
+                                                 dl_matrix3d_t *dw_bn_offset,
+                                                 dl_matrix3d_t *pw_linear_1,
+                                                 dl_matrix3d_t *pw_linear_2,
+                                                 dl_matrix3d_t *pw_linear_bn_scale,
+                                                 dl_matrix3d_t *pw_linear_bn_offset,
+                                                 int stride_x,
+                                                 int stride_y,
+                                                 int padding,
+                                                 int mode,
+                                                 int shortcut)
+{
+    dl_matrix3d_t *pw[2] = {pw_1, pw_2};
+    dl_matrix3d_t *pw_linear[2] = {pw_linear_1, pw_linear_2};
+    return dl_matrix3d_mobilefaceblock_common(in,
+                                              pw, 2, pw_bn_scale, pw_bn_offset,
+                                              dw, dw_bn_scale, dw_bn_offset,
+                                              pw_linear, 2, pw_linear_bn_scale, pw_linear_bn_offset,
+                                              stride_x, stride_y, padding, shortcut);
+}
+
+void dl_matrix3d_init_bias(dl_matrix3d_t *out, dl_matrix3d_t *bias)
+{
+    int pixels = out->n * out->w * out->h;
+    for (int p = 0; p < pixels; p++)
+        memcpy(out->item + p * out->c, bias->item, out->c * sizeof(fptp_t));
+}
+
+void dl_matrix3d_multiply(dl_matrix3d_t *out, dl_matrix3d_t *in1, dl_matrix3d_t *in2)
+{
+    int count = out->n * out->w * out->h * out->c;
+    for (int i = 0; i < count; i++)
+        out->item[i] = in1->item[i] * in2->item[i];
+}
+
+void dl_matrix3d_relu(dl_matrix3d_t *m)
+{
+    int count = m->n * m->w * m->h * m->c;
+    for (int i = 0; i < count; i++)
+        if (m->item[i] < 0)
+            m->item[i] = 0;
+}
+
+void dl_matrix3d_relu_clip(dl_matrix3d_t *m, fptp_t clip)
+{
+    int count = m->n * m->w * m->h * m->c;
+    for (int i = 0; i < count; i++)
+        m->item[i] = min(max(m->item[i], 0), clip);
+}
+
+void dl_matrix3d_p_relu(dl_matrix3d_t *in, dl_matrix3d_t *alpha)
+{
+    int pixels = in->n * in->w * in->h;
+    for (int p = 0; p < pixels; p++)
+    {
+        fptp_t *item = in->item + p * in->c;
+        for (int c = 0; c < in->c; c++)
+            if (item[c] < 0)
+                item[c] *= alpha->item[c];
+    }
+}
+
+void dl_matrix3d_leaky_relu(dl_matrix3d_t *m, fptp_t alpha)
+{
+    int count = m->n * m->w * m->h * m->c;
+    for (int i = 0; i < count; i++)
+        if (m->item[i] < 0)
+            m->item[i] *= alpha;
+}
+
+void dl_matrix3dff_conv_1x1(dl_matrix3d_t *out,
+                            dl_matrix3d_t *in,
+                            dl_matrix3d_t *filter)
+{
+    dl_matrix3d_conv_kernel(out, in, filter, NULL, 1, 1, 0, 0, 0);
+}
+
+void dl_matrix3dff_conv_1x1_with_bias(dl_matrix3d_t *out,
+                                      dl_matrix3d_t *in,
+                                      dl_matrix3d_t *filter,
+                                      dl_matrix3d_t *bias)
+{
+    dl_matrix3d_conv_kernel(out, in, filter, bias, 1, 1, 0, 0, 0);
+}
+
+void dl_matrix3duf_conv_1x1(dl_matrix3d_t *out,
+                            dl_matrix3du_t *in,
+                            dl_matrix3d_t *filter)
+{
+    dl_matrix3duf_conv_1x1_with_bias(out, in, filter, NULL);
+}
+
+void dl_matrix3duf_conv_1x1_with_bias(dl_matrix3d_t *out,
+                                      dl_matrix3du_t *in,
+                                      dl_matrix3d_t *filter,
+                                      dl_matrix3d_t *bias)
+{
+    dl_matrix3d_t *in_f = dl_matrix3d_from_matrixu(in);
+    dl_matrix3d_conv_kernel(out, in_f, filter, bias, 1, 1, 0, 0, 0);
+    dl_matrix3d_free(in_f);
+}
+
+void dl_matrix3dff_conv_3x3_op(dl_matrix3d_t *out,
+                               dl_matrix3d_t *in,
+                               dl_matrix3d_t *f,
+                               int step_x,
+                               int step_y)
+{
+    dl_matrix3d_conv_kernel(out, in, f, NULL, step_x, step_y, 0, 0, 0);
+}
+
+dl_matrix3d_t *dl_matrix3dff_conv_3x3(dl_matrix3d_t *in,
+                                      dl_matrix3d_t *filter,
+                                      dl_matrix3d_t *bias,
+                                      int stride_x,
+                                      int stride_y,
+                                      dl_padding_type padding)
+{
+    return dl_matrix3d_conv_padded(in, filter, bias, stride_x, stride_y, padding, 0);
+}
+
+dl_matrix3d_t *dl_matrix3duf_conv_common(dl_matrix3du_t *in,
+                                         dl_matrix3d_t *filter,
+                                         dl_matrix3d_t *bias,
+                                         int stride_x,
+                                         int stride_y,
+                                         dl_padding_type padding)
+{
+    dl_matrix3d_t *in_f = dl_matrix3d_from_matrixu(in);
+    dl_matrix3d_t *out = dl_matrix3d_conv_padded(in_f, filter, bias, stride_x, stride_y, padding, 0);
+    dl_matrix3d_free(in_f);
+    return out;
+}
+
+dl_matrix3d_t *dl_matrix3dff_conv_common(dl_matrix3d_t *in,
+                                         dl_matrix3d_t *filter,
+                                         dl_matrix3d_t *bias,
+                                         int stride_x,
+                                         int stride_y,
+                                         dl_padding_type padding)
+{
+    return dl_matrix3d_conv_padded(in, filter, bias, stride_x, stride_y, padding, 0);
+}
+
+dl_matrix3d_t *dl_matrix3dff_depthwise_conv_3x3(dl_matrix3d_t *in,
+                                                dl_matrix3d_t *filter,
+                                                int stride_x,
+                                                int stride_y,
+                                                int padding)
+{
+    return dl_matrix3d_conv_padded(in, filter, NULL, stride_x, stride_y, padding, 1);
+}
+
+dl_matrix3d_t *dl_matrix3duf_depthwise_conv_3x3(dl_matrix3du_t *in,
+                                                dl_matrix3d_t *filter,
+                                                int stride_x,
+                                                int stride_y,
+                                                int padding)
+{
+    dl_matrix3d_t *in_f = dl_matrix3d_from_matrixu(in);
+    dl_matrix3d_t *out = dl_matrix3d_conv_padded(in_f, filter, NULL, stride_x, stride_y, padding, 1);
+    dl_matrix3d_free(in_f);
+    return out;
+}
+
+void dl_matrix3dff_depthwise_conv_3x3_op(dl_matrix3d_t *out,
+                                         dl_matrix3d_t *in,
+                                         dl_matrix3d_t *f,
+                                         int step_x,
+                                         int step_y)
+{
+    dl_matrix3d_conv_kernel(out, in, f, NULL, step_x, step_y, 0, 0, 1);
+}
+
+dl_matrix3d_t *dl_matrix3dff_depthwise_conv_common(dl_matrix3d_t *in,
+                                                   dl_matrix3d_t *filter,
+                                                   int stride_x,
+                                                   int stride_y,
+                                                   dl_padding_type padding)
+{
+    return dl_matrix3d_conv_padded(in, filter, NULL, stride_x, stride_y, padding, 1);
+}
+
+void dl_matrix3dff_fc(dl_matrix3d_t *out,
+                      dl_matrix3d_t *in,
+                      dl_matrix3d_t *filter)
+{
+    dl_matrix3dff_fc_with_bias(out, in, filter, NULL);
+}
+
+void dl_matrix3dff_fc_with_bias(dl_matrix3d_t *out,
+                                dl_matrix3d_t *in,
+                                dl_matrix3d_t *filter,
+                                dl_matrix3d_t *bias)
+{
+    for (int o = 0; o < filter->h; o++)
+    {
+        fptp_t *f = filter->item + o * filter->w;
+        fptp_t sum = bias ? bias->item[o] : 0;
+        for (int i = 0; i < filter->w; i++)
+            sum += in->item[i] * f[i];
+        out->item[o] = sum;
+    }
+}
+
+dl_matrix3d_t *dl_matrix3dff_mobilenet(dl_matrix3d_t *in,
+                                       dl_matrix3d_t *dilate_filter,
+                                       dl_matrix3d_t *dilate_prelu,
+                                       dl_matrix3d_t *depthwise_filter,
+                                       dl_matrix3d_t *depthwise_prelu,
+                                       dl_matrix3d_t *compress_filter,
+                                       dl_matrix3d_t *bias,
+                                       dl_matrix3d_mobilenet_config_t config)
+{
+    dl_matrix3d_t *dilate = dl_matrix3d_alloc_uninit(1, in->w, in->h, dilate_filter->n);
+    dl_matrix3dff_conv_1x1(dilate, in, dilate_filter);
+    dl_matrix3d_p_relu(dilate, dilate_prelu);
+
+    dl_matrix3d_t *depthwise = dl_matrix3dff_depthwise_conv_common(dilate, depthwise_filter, config.stride_x, config.stride_y, config.padding);
+    dl_matrix3d_free(dilate);
+    dl_matrix3d_p_relu(depthwise, depthwise_prelu);
+
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(1, depthwise->w, depthwise->h, compress_filter->n);
+    dl_matrix3dff_conv_1x1_with_bias(out, depthwise, compress_filter, bias);
+    dl_matrix3d_free(depthwise);
+    return out;
+}
+
+dl_matrix3d_t *dl_matrix3duf_mobilenet(dl_matrix3du_t *in,
+                                       dl_matrix3d_t *dilate_filter,
+                                       dl_matrix3d_t *dilate_prelu,
+                                       dl_matrix3d_t *depthwise_filter,
+                                       dl_matrix3d_t *depthwise_prelu,
+                                       dl_matrix3d_t *compress_filter,
+                                       dl_matrix3d_t *bias,
+                                       dl_matrix3d_mobilenet_config_t config)
+{
+    dl_matrix3d_t *in_f = dl_matrix3d_from_matrixu(in);
+    dl_matrix3d_t *out = dl_matrix3dff_mobilenet(in_f, dilate_filter, dilate_prelu, depthwise_filter, depthwise_prelu, compress_filter, bias, config);
+    dl_matrix3d_free(in_f);
+    return out;
+}
@@ -0,0 +1,1491 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Portable C implementation of dl_lib_matrix3dq.h, used by the host build in
+ * place of libdl.a. Every function behaves as the DL_C_IMPL path, the 'mode'
+ * arguments are accepted and ignored.
+ *
+ * Arithmetic rules of the reference path:
+ *  - products are accumulated in 64 bits with exponent in->exponent + filter->exponent,
+ *  - bias is aligned to the accumulator, then relu or prelu is applied,
+ *  - the accumulator is shifted to the resulting exponent, rounding half up,
+ *    and saturated to [DL_QTP_MIN, DL_QTP_MAX].
+ */
+#include "dl_lib_host.h"
+
+static dl_matrix3dq_t *dl_matrix3dq_from_matrixu(dl_matrix3du_t *in)
+{
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in->n, in->w, in->h, in->c, 0);
+    if (NULL == out)
+        return NULL;
+    int count = in->n * in->w * in->h * in->c;
+    for (int i = 0; i < count; i++)
+        out->item[i] = in->item[i];
+    return out;
+}
+
+/*
+ * Bias, activation and requantization of one accumulator.
+ */
+static inline qtp_t dl_matrix3dq_conv_output(int64_t acc,
+                                             int c,
+                                             dl_matrix3dq_t *bias,
+                                             int bias_shift,
+                                             dl_matrix3dq_t *prelu,
+                                             int prelu_shift,
+                                             int relu,
+                                             int out_shift)
+{
+    if (bias)
+        acc += dl_lib_shift_round(bias->item[c], bias_shift);
+    if (relu && acc < 0)
+        acc = 0;
+    if (prelu && acc < 0)
+        acc = dl_lib_shift_round(acc * prelu->item[c], prelu_shift);
+    return dl_lib_saturate(dl_lib_shift_round(acc, out_shift));
+}
+
+/*
+ * Generic quantized convolution kernel, 'out' is preallocated and its size decides the output window.
+ * The results are written to channels [out_c_offset, out_c_offset + filter->n) of 'out', bias and prelu
+ * are indexed the same way. For depthwise convolution the filter is (1, w, h, c). Every image of a
+ * batch is convolved, 'out' holds in->n images.
+ *
+ * Inside the input the taps of one filter row are contiguous in both the input and the filter,
+ * so every row is accumulated with a single dot product (or a per channel multiply-accumulate
+ * for depthwise) from dl_lib_q_kernels().
+ *
+ * Only depthwise convolution needs memory, one accumulator per channel, on the stack up to
+ * DL_LIB_CONV_STACK_CHANNELS. DL_FAIL if it can not be allocated or 'out' does not hold in->n
+ * images, 'out' is not written then.
+ */
+#define DL_LIB_CONV_STACK_CHANNELS 256
+
+static dl_error_type dl_matrix3dq_conv_kernel(dl_matrix3dq_t *out,
+                                     int out_c_offset,
+                                     dl_matrix3dq_t *in,
+                                     dl_matrix3dq_t *filter,
+                                     dl_matrix3dq_t *bias,
+                                     dl_matrix3dq_t *prelu,
+                                     int relu,
+                                     int stride_x,
+                                     int stride_y,
+                                     int pad_x,
+                                     int pad_y,
+                                     int depthwise)
+{
+    if (out->n != in->n)
+        return DL_FAIL;
+
+    const dl_lib_q_kernels_t *kernels = dl_lib_q_kernels();
+    int acc_exponent = in->exponent + filter->exponent;
+    int out_shift = out->exponent - acc_exponent;
+    int bias_shift = bias ? acc_exponent - bias->exponent : 0;
+    int prelu_shift = prelu ? -prelu->exponent : 0;
+    int out_c = depthwise ? in->c : filter->n;
+
+    int64_t acc_stack[DL_LIB_CONV_STACK_CHANNELS];
+    int64_t *acc = acc_stack;
+    if (depthwise && in->c > DL_LIB_CONV_STACK_CHANNELS)
+    {
+        acc = (int64_t *)malloc(in->c * sizeof(int64_t));
+        if (NULL == acc)
+            return DL_FAIL;
+    }
+
+    for (int b = 0; b < in->n; b++)
+    {
+        qtp_t *in_item = in->item + b * in->h * in->stride;
+        qtp_t *out_item = out->item + b * out->h * out->stride;
+        for (int oy = 0; oy < out->h; oy++)
+        {
+            int fy_start = max(pad_y - oy * stride_y, 0);
+            int fy_end = min(in->h + pad_y - oy * stride_y, filter->h);
+            for (int ox = 0; ox < out->w; ox++)
+            {
+                int fx_start = max(pad_x - ox * stride_x, 0);
+                int fx_end = min(in->w + pad_x - ox * stride_x, filter->w);
+                int run = (fx_end - fx_start) * in->c;
+                // First tap inside the input, the padding is skipped before forming the pointer
+                int iy = oy * stride_y - pad_y + fy_start;
+                int ix = ox * stride_x - pad_x + fx_start;
+                qtp_t *pi = in_item + iy * in->stride + ix * in->c;
+                qtp_t *o = out_item + oy * out->stride + ox * out->c + out_c_offset;
+
+                if (depthwise)
+                {
+                    memset(acc, 0, in->c * sizeof(int64_t));
+                    for (int fy = fy_start; fy < fy_end; fy++)
+                        for (int fx = fx_start; fx < fx_end; fx++)
+                            kernels->mac(acc,
+                                         pi + (fy - fy_start) * in->stride + (fx - fx_start) * in->c,
+                                         filter->item + (fy * filter->w + fx) * filter->c,
+                                         in->c);
+                    for (int oc = 0; oc < out_c; oc++)
+                        o[oc] = dl_matrix3dq_conv_output(acc[oc], out_c_offset + oc, bias, bias_shift, prelu, prelu_shift, relu, out_shift);
+                    continue;
+                }
+
+                for (int oc = 0; oc < out_c; oc++)
+                {
+                    int64_t sum = 0;
+                    for (int fy = fy_start; fy < fy_end; fy++)
+                        sum += kernels->dot(pi + (fy - fy_start) * in->stride,
+                                            filter->item + ((oc * filter->h + fy) * filter->w + fx_start) * filter->c,
+                                            run);
+                    o[oc] = dl_matrix3dq_conv_output(sum, out_c_offset + oc, bias, bias_shift, prelu, prelu_shift, relu, out_shift);
+                }
+            }
+        }
+    }
+    if (acc != acc_stack)
+        free(acc);
+    return DL_SUCCESS;
+}
+
+static dl_matrix3dq_t *dl_matrix3dq_conv_padded(dl_matrix3dq_t *in,
+                                               dl_matrix3dq_t *filter,
+                                               dl_matrix3dq_t *bias,
+                                               dl_matrix3dq_t *prelu,
+                                               int relu,
+                                               int stride_x,
+                                               int stride_y,
+                                               dl_padding_type padding,
+                                               int exponent,
+                                               int depthwise)
+{
+    int out_w, out_h, pad_x, pad_y;
+    dl_lib_out_size(in->w, filter->w, stride_x, padding, &out_w, &pad_x);
+    dl_lib_out_size(in->h, filter->h, stride_y, padding, &out_h, &pad_y);
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in->n, out_w, out_h, depthwise ? in->c : filter->n, exponent);
+    if (NULL == out)
+        return NULL;
+    if (DL_SUCCESS != dl_matrix3dq_conv_kernel(out, 0, in, filter, bias, prelu, relu, stride_x, stride_y, pad_x, pad_y, depthwise))
+    {
+        dl_matrix3dq_free(out);
+        return NULL;
+    }
+    return out;
+}
+
+static dl_matrix3dq_t *dl_matrix3duq_conv_padded(dl_matrix3du_t *in,
+                                                dl_matrix3dq_t *filter,
+                                                dl_matrix3dq_t *bias,
+                                                dl_matrix3dq_t *prelu,
+                                                int relu,
+                                                int stride_x,
+                                                int stride_y,
+                                                dl_padding_type padding,
+                                                int exponent,
+                                                int depthwise)
+{
+    dl_matrix3dq_t *in_q = dl_matrix3dq_from_matrixu(in);
+    if (NULL == in_q)
+        return NULL;
+    dl_matrix3dq_t *out = dl_matrix3dq_conv_padded(in_q, filter, bias, prelu, relu, stride_x, stride_y, padding, exponent, depthwise);
+    dl_matrix3dq_free(in_q);
+    return out;
+}
+
+//
+// Utility
+//
+
+void dl_matrix3dq_slice_copy(dl_matrix3dq_t *dst, dl_matrix3dq_t *src, int x, int y, int w, int h)
+{
+    for (int i = 0; i < h; i++)
+        memcpy(dst->item + i * dst->stride, src->item + (y + i) * src->stride + x * src->c, w * src->c * sizeof(qtp_t));
+}
+
+void dl_matrix3dq_sliced_transform_nchw(dl_matrix3dq_t *out,
+                                        dl_matrix3dq_t *in)
+{
+    int plane = in->w * in->h;
+    for (int i = 0; i < plane; i++)
+        for (int c = 0; c < in->c; c++)
+            out->item[c * plane + i] = in->item[i * in->c + c];
+}
+
+dl_matrix3d_t *dl_matrix3d_from_matrixq(dl_matrix3dq_t *m)
+{
+    dl_matrix3d_t *out = dl_matrix3d_alloc_uninit(m->n, m->w, m->h, m->c);
+    if (NULL == out)
+        return NULL;
+    int count = m->n * m->w * m->h * m->c;
+    for (int i = 0; i < count; i++)
+        out->item[i] = ldexpf(m->item[i], m->exponent);
+    return out;
+}
+
+dl_matrix3dq_t *dl_matrixq_from_matrix3d_qmf(dl_matrix3d_t *m, int exponent)
+{
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(m->n, m->w, m->h, m->c, exponent);
+    if (NULL == out)
+        return NULL;
+    int count = m->n * m->w * m->h * m->c;
+    for (int i = 0; i < count; i++)
+        out->item[i] = dl_lib_saturate(llround(ldexp(m->item[i], -exponent)));
+    return out;
+}
+
+dl_matrix3dq_t *dl_matrixq_from_matrix3d(dl_matrix3d_t *m)
+{
+    int count = m->n * m->w * m->h * m->c;
+    fptp_t max_value = 0;
+    for (int i = 0; i < count; i++)
+        max_value = max(max_value, fabsf(m->item[i]));
+
+    int exponent = 0;
+    if (max_value != 0)
+    {
+        while (max_value > DL_QTP_RANGE)
+        {
+            exponent++;
+            max_value /= 2;
+        }
+        while (max_value < DL_QTP_RANGE / 2)
+        {
+            exponent--;
+            max_value *= 2;
+        }
+    }
+    return dl_matrixq_from_matrix3d_qmf(m, exponent);
+}
+
+qtp_t dl_matrix3dq_quant_range_exceeded_checking(int64_t value, char *location)
+{
+    if (value > DL_QTP_MAX || value < DL_QTP_MIN)
+    {
+        if (location)
+            printf("%s: value %lld exceeds the qtp_t range\n", location, (long long)value);
+    }
+    return dl_lib_saturate(value);
+}
+
+void dl_matrix3dq_shift_exponent(dl_matrix3dq_t *out, dl_matrix3dq_t *in, int exponent)
+{
+    int shift = exponent - in->exponent;
+    int count = in->n * in->w * in->h * in->c;
+    for (int i = 0; i < count; i++)
+        out->item[i] = dl_lib_saturate(dl_lib_shift_round(in->item[i], shift));
+    out->exponent = exponent;
+}
+
+void dl_matrix3dq_batch_normalize(dl_matrix3dq_t *m, dl_matrix3dq_t *scale, dl_matrix3dq_t *offset)
+{
+    int offset_shift = m->exponent - offset->exponent;
+    int pixels = m->n * m->w * m->h;
+    for (int p = 0; p < pixels; p++)
+    {
+        qtp_t *item = m->item + p * m->c;
+        for (int c = 0; c < m->c; c++)
+        {
+            int64_t value = dl_lib_shift_round((int64_t)item[c] * scale->item[c], -scale->exponent);
+            value += dl_lib_shift_round(offset->item[c], offset_shift);
+            item[c] = dl_lib_saturate(value);
+        }
+    }
+}
+
+dl_matrix3dq_t *dl_matrix3dq_add(dl_matrix3dq_t *in_1, dl_matrix3dq_t *in_2, int exponent)
+{
+    return dl_matrix3dq_add_channel_diff(in_1, in_2, exponent);
+}
+
+dl_matrix3dq_t *dl_matrix3dq_add_channel_diff(dl_matrix3dq_t *in_1, dl_matrix3dq_t *in_2, int exponent)
+{
+    int c = max(in_1->c, in_2->c);
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in_1->n, in_1->w, in_1->h, c, exponent);
+    if (NULL == out)
+        return NULL;
+
+    int acc_exponent = min(in_1->exponent, in_2->exponent);
+    int shift_1 = in_1->exponent - acc_exponent;
+    int shift_2 = in_2->exponent - acc_exponent;
+    int out_shift = exponent - acc_exponent;
+    int pixels = in_1->n * in_1->w * in_1->h;
+    for (int p = 0; p < pixels; p++)
+    {
+        qtp_t *a = in_1->item + p * in_1->c;
+        qtp_t *b = in_2->item + p * in_2->c;
+        qtp_t *o = out->item + p * c;
+        for (int i = 0; i < c; i++)
+        {
+            int64_t acc = 0;
+            if (i < in_1->c)
+                acc += (int64_t)a[i] * ((int64_t)1 << shift_1);
+            if (i < in_2->c)
+                acc += (int64_t)b[i] * ((int64_t)1 << shift_2);
+            o[i] = dl_lib_saturate(dl_lib_shift_round(acc, out_shift));
+        }
+    }
+    return out;
+}
+
+//
+// Activation
+//
+
+void dl_matrix3dq_relu(dl_matrix3dq_t *in)
+{
+    int count = in->n * in->w * in->h * in->c;
+    for (int i = 0; i < count; i++)
+        if (in->item[i] < 0)
+            in->item[i] = 0;
+}
+
+void dl_matrix3dq_relu_clip(dl_matrix3dq_t *in, fptp_t clip)
+{
+    qtp_t clip_q = dl_lib_saturate(llround(ldexp(clip, -in->exponent)));
+    int count = in->n * in->w * in->h * in->c;
+    for (int i = 0; i < count; i++)
+        in->item[i] = min(max(in->item[i], 0), clip_q);
+}
+
+void dl_matrix3dq_leaky_relu(dl_matrix3dq_t *in, fptp_t alpha, fptp_t clip)
+{
+    qtp_t clip_q = (clip > 0) ? dl_lib_saturate(llround(ldexp(clip, -in->exponent))) : DL_QTP_MAX;
+    int count = in->n * in->w * in->h * in->c;
+    for (int i = 0; i < count; i++)
+    {
+        if (in->item[i] < 0)
+            in->item[i] = dl_lib_saturate(llround(in->item[i] * (double)alpha));
+        else if (in->item[i] > clip_q)
+            in->item[i] = clip_q;
+    }
+}
+
+void dl_matrix3dq_p_relu(dl_matrix3dq_t *in, dl_matrix3dq_t *alpha)
+{
+    int pixels = in->n * in->w * in->h;
+    for (int p = 0; p < pixels; p++)
+    {
+        qtp_t *item = in->item + p * in->c;
+        for (int c = 0; c < in->c; c++)
+            if (item[c] < 0)
+                item[c] = dl_lib_saturate(dl_lib_shift_round((int64_t)item[c] * alpha->item[c], -alpha->exponent));
+    }
+}
+
+//
+// Concat
+//
+
+static dl_matrix3dq_t *dl_matrix3dq_concat_n(dl_matrix3dq_t **in, int num)
+{
+    int c = 0;
+    int exponent = in[0]->exponent;
+    for (int i = 0; i < num; i++)
+    {
+        c += in[i]->c;
+        exponent = max(exponent, in[i]->exponent);
+    }
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in[0]->n, in[0]->w, in[0]->h, c, exponent);
+    if (NULL == out)
+        return NULL;
+
+    int pixels = in[0]->n * in[0]->w * in[0]->h;
+    qtp_t *o = out->item;
+    for (int p = 0; p < pixels; p++)
+    {
+        for (int i = 0; i < num; i++)
+        {
+            qtp_t *src = in[i]->item + p * in[i]->c;
+            int shift = exponent - in[i]->exponent;
+            if (0 == shift)
+            {
+                memcpy(o, src, in[i]->c * sizeof(qtp_t));
+            }
+            else
+            {
+                for (int j = 0; j < in[i]->c; j++)
+                    o[j] = dl_lib_saturate(dl_lib_shift_round(src[j], shift));
+            }
+            o += in[i]->c;
+        }
+    }
+    return out;
+}
+
+dl_matrix3dq_t *dl_matrix3dq_concat(dl_matrix3dq_t *in_1,
+                                    dl_matrix3dq_t *in_2)
+{
+    dl_matrix3dq_t *in[2] = {in_1, in_2};
+    return dl_matrix3dq_concat_n(in, 2);
+}
+
+dl_matrix3dq_t *dl_matrix3dq_concat_4(dl_matrix3dq_t *in_1,
+                                      dl_matrix3dq_t *in_2,
+                                      dl_matrix3dq_t *in_3,
+                                      dl_matrix3dq_t *in_4)
+{
+    dl_matrix3dq_t *in[4] = {in_1, in_2, in_3, in_4};
+    return dl_matrix3dq_concat_n(in, 4);
+}
+
+dl_matrix3dq_t *dl_matrix3dq_concat_8(dl_matrix3dq_t *in_1,
+                                      dl_matrix3dq_t *in_2,
+                                      dl_matrix3dq_t *in_3,
+                                      dl_matrix3dq_t *in_4,
+                                      dl_matrix3dq_t *in_5,
+                                      dl_matrix3dq_t *in_6,
+                                      dl_matrix3dq_t *in_7,
+                                      dl_matrix3dq_t *in_8)
+{
+    dl_matrix3dq_t *in[8] = {in_1, in_2, in_3, in_4, in_5, in_6, in_7, in_8};
+    return dl_matrix3dq_concat_n(in, 8);
+}
+
+//
+// Conv 1x1
+//
+
+/*
+ * 1x1 convolution into a preallocated 'out'. The public functions return nothing, a failure
+ * is reported under the layer name and 'out' is zeroed instead of left unwritten.
+ */
+static void dl_matrix3dq_conv_1x1(dl_matrix3dq_t *out,
+                                  dl_matrix3dq_t *in,
+                                  dl_matrix3dq_t *filter,
+                                  dl_matrix3dq_t *bias,
+                                  dl_matrix3dq_t *prelu,
+                                  int relu,
+                                  char *name)
+{
+    if (DL_SUCCESS == dl_matrix3dq_conv_kernel(out, 0, in, filter, bias, prelu, relu, 1, 1, 0, 0, 0))
+        return;
+    printf("%s: 1x1 convolution of %d images into %d failed\n", name ? name : "conv_1x1", in->n, out->n);
+    memset(out->item, 0, out->n * out->h * out->stride * sizeof(qtp_t));
+}
+
+void dl_matrix3dqq_conv_1x1(dl_matrix3dq_t *out,
+                            dl_matrix3dq_t *in,
+                            dl_matrix3dq_t *filter,
+                            dl_conv_mode mode,
+                            char *name)
+{
+    dl_matrix3dq_conv_1x1(out, in, filter, NULL, NULL, 0, name);
+}
+
+void dl_matrix3dqq_conv_1x1_with_relu(dl_matrix3dq_t *out,
+                                      dl_matrix3dq_t *in,
+                                      dl_matrix3dq_t *filter,
+                                      dl_conv_mode mode,
+                                      char *name)
+{
+    dl_matrix3dq_conv_1x1(out, in, filter, NULL, NULL, 1, name);
+}
+
+void dl_matrix3dqq_conv_1x1_with_bias(dl_matrix3dq_t *out,
+                                      dl_matrix3dq_t *in,
+                                      dl_matrix3dq_t *filter,
+                                      dl_matrix3dq_t *bias,
+                                      dl_conv_mode mode,
+                                      char *name)
+{
+    dl_matrix3dq_conv_1x1(out, in, filter, bias, NULL, 0, name);
+}
+
+void dl_matrix3dqq_conv_1x1_with_bias_relu(dl_matrix3dq_t *out,
+                                           dl_matrix3dq_t *in,
+                                           dl_matrix3dq_t *filter,
+                                           dl_matrix3dq_t *bias,
+                                           dl_conv_mode mode,
+                                           char *name)
+{
+    dl_matrix3dq_conv_1x1(out, in, filter, bias, NULL, 1, name);
+}
+
+void dl_matrix3dqq_conv_1x1_with_prelu(dl_matrix3dq_t *out,
+                                       dl_matrix3dq_t *in,
+                                       dl_matrix3dq_t *filter,
+                                       dl_matrix3dq_t *prelu,
+                                       dl_conv_mode mode,
+                                       char *name)
+{
+    dl_matrix3dq_conv_1x1(out, in, filter, NULL, prelu, 0, name);
+}
+
+void dl_matrix3duq_conv_1x1(dl_matrix3dq_t *out,
+                            dl_matrix3du_t *in,
+                            dl_matrix3dq_t *filter,
+                            dl_conv_mode mode,
+                            char *name)
+{
+    dl_matrix3duq_conv_1x1_with_bias(out, in, filter, NULL, mode, name);
+}
+
+void dl_matrix3duq_conv_1x1_with_bias(dl_matrix3dq_t *out,
+                                      dl_matrix3du_t *in,
+                                      dl_matrix3dq_t *filter,
+                                      dl_matrix3dq_t *bias,
+                                      dl_conv_mode mode,
+                                      char *name)
+{
+    dl_matrix3dq_t *in_q = dl_matrix3dq_from_matrixu(in);
+    if (NULL == in_q)
+        return;
+    dl_matrix3dq_conv_1x1(out, in_q, filter, bias, NULL, 0, name);
+    dl_matrix3dq_free(in_q);
+}
+
+//
+// Conv 3x3
+//
+
+dl_matrix3dq_t *dl_matrix3dqq_conv_3x3(dl_matrix3dq_t *input,
+                                       dl_matrix3dq_t *filter,
+                                       int stride_x,
+                                       int stride_y,
+                                       dl_padding_type padding,
+                                       int exponent,
+                                       char *name)
+{
+    return dl_matrix3dq_conv_padded(input, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 0);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_conv_3x3_with_bias(dl_matrix3dq_t *input,
+                                                 dl_matrix3dq_t *filter,
+                                                 dl_matrix3dq_t *bias,
+                                                 int stride_x,
+                                                 int stride_y,
+                                                 dl_padding_type padding,
+                                                 int exponent,
+                                                 char *name)
+{
+    return dl_matrix3dq_conv_padded(input, filter, bias, NULL, 0, stride_x, stride_y, padding, exponent, 0);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_conv_3x3_with_bias_relu(dl_matrix3dq_t *input,
+                                                      dl_matrix3dq_t *filter,
+                                                      dl_matrix3dq_t *bias,
+                                                      int stride_x,
+                                                      int stride_y,
+                                                      dl_padding_type padding,
+                                                      int exponent,
+                                                      char *name)
+{
+    return dl_matrix3dq_conv_padded(input, filter, bias, NULL, 1, stride_x, stride_y, padding, exponent, 0);
+}
+
+dl_matrix3dq_t *dl_matrix3duq_conv_3x3_with_bias(dl_matrix3du_t *input,
+                                                 dl_matrix3dq_t *filter,
+                                                 dl_matrix3dq_t *bias,
+                                                 int stride_x,
+                                                 int stride_y,
+                                                 dl_padding_type padding,
+                                                 int exponent,
+                                                 char *name)
+{
+    return dl_matrix3duq_conv_padded(input, filter, bias, NULL, 0, stride_x, stride_y, padding, exponent, 0);
+}
+
+dl_matrix3dq_t *dl_matrix3duq_conv_3x3_with_bias_prelu(dl_matrix3du_t *input,
+                                                       dl_matrix3dq_t *filter,
+                                                       dl_matrix3dq_t *bias,
+                                                       dl_matrix3dq_t *prelu,
+                                                       int stride_x,
+                                                       int stride_y,
+                                                       dl_padding_type padding,
+                                                       int exponent,
+                                                       char *name)
+{
+    return dl_matrix3duq_conv_padded(input, filter, bias, prelu, 0, stride_x, stride_y, padding, exponent, 0);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_conv_3x3_with_bias_prelu(dl_matrix3dq_t *input,
+                                                       dl_matrix3dq_t *filter,
+                                                       dl_matrix3dq_t *bias,
+                                                       dl_matrix3dq_t *prelu,
+                                                       int stride_x,
+                                                       int stride_y,
+                                                       dl_padding_type padding,
+                                                       int exponent,
+                                                       char *name)
+{
+    return dl_matrix3dq_conv_padded(input, filter, bias, prelu, 0, stride_x, stride_y, padding, exponent, 0);
+}
+
+//
+// Conv common
+//
+
+dl_matrix3dq_t *dl_matrix3dqq_conv_common(dl_matrix3dq_t *in,
+                                          dl_matrix3dq_t *filter,
+                                          dl_matrix3dq_t *bias,
+                                          int stride_x,
+                                          int stride_y,
+                                          dl_padding_type padding,
+                                          int exponent,
+                                          dl_conv_mode mode)
+{
+    return dl_matrix3dq_conv_padded(in, filter, bias, NULL, 0, stride_x, stride_y, padding, exponent, 0);
+}
+
+dl_matrix3dq_t *dl_matrix3duq_conv_common(dl_matrix3du_t *in,
+                                          dl_matrix3dq_t *filter,
+                                          dl_matrix3dq_t *bias,
+                                          int stride_x,
+                                          int stride_y,
+                                          dl_padding_type padding,
+                                          int exponent,
+                                          dl_conv_mode mode)
+{
+    return dl_matrix3duq_conv_padded(in, filter, bias, NULL, 0, stride_x, stride_y, padding, exponent, 0);
+}
+
+//
+// Depthwise 3x3
+//
+
+dl_matrix3dq_t *dl_matrix3duq_depthwise_conv_3x3(dl_matrix3du_t *in,
+                                                 dl_matrix3dq_t *filter,
+                                                 int stride_x,
+                                                 int stride_y,
+                                                 dl_padding_type padding,
+                                                 int exponent,
+                                                 char *name)
+{
+    return dl_matrix3duq_conv_padded(in, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_3x3(dl_matrix3dq_t *in,
+                                                 dl_matrix3dq_t *filter,
+                                                 int stride_x,
+                                                 int stride_y,
+                                                 dl_padding_type padding,
+                                                 int relu,
+                                                 int exponent,
+                                                 char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, NULL, relu, stride_x, stride_y, padding, exponent, 1);
+}
+
+#if CONFIG_DEVELOPING_CODE
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_3x3_2(dl_matrix3dq_t *in,
+                                                   dl_matrix3dq_t *filter,
+                                                   int stride_x,
+                                                   int stride_y,
+                                                   dl_padding_type padding,
+                                                   int exponent,
+                                                   char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_3x3_3(dl_matrix3dq_t *in,
+                                                   dl_matrix3dq_t *filter,
+                                                   int stride_x,
+                                                   int stride_y,
+                                                   dl_padding_type padding,
+                                                   int exponent,
+                                                   char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 1);
+}
+#endif
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_3x3_with_bias(dl_matrix3dq_t *in,
+                                                           dl_matrix3dq_t *f,
+                                                           dl_matrix3dq_t *bias,
+                                                           int stride_x,
+                                                           int stride_y,
+                                                           dl_padding_type padding,
+                                                           int exponent,
+                                                           int relu,
+                                                           char *name)
+{
+    return dl_matrix3dq_conv_padded(in, f, bias, NULL, relu, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_3x3s1_with_bias(dl_matrix3dq_t *in,
+                                                             dl_matrix3dq_t *f,
+                                                             dl_matrix3dq_t *bias,
+                                                             dl_padding_type padding,
+                                                             int exponent,
+                                                             int relu,
+                                                             char *name)
+{
+    return dl_matrix3dq_conv_padded(in, f, bias, NULL, relu, 1, 1, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_3x3_with_prelu(dl_matrix3dq_t *in,
+                                                            dl_matrix3dq_t *filter,
+                                                            dl_matrix3dq_t *prelu,
+                                                            int stride_x,
+                                                            int stride_y,
+                                                            dl_padding_type padding,
+                                                            int exponent,
+                                                            char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, prelu, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_3x3_with_bias_prelu(dl_matrix3dq_t *in,
+                                                                 dl_matrix3dq_t *f,
+                                                                 dl_matrix3dq_t *bias,
+                                                                 dl_matrix3dq_t *prelu,
+                                                                 int stride_x,
+                                                                 int stride_y,
+                                                                 dl_padding_type padding,
+                                                                 int exponent,
+                                                                 char *name)
+{
+    return dl_matrix3dq_conv_padded(in, f, bias, prelu, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_global_depthwise_conv_with_bias(dl_matrix3dq_t *in,
+                                                              dl_matrix3dq_t *filter,
+                                                              dl_matrix3dq_t *bias,
+                                                              int exponent,
+                                                              char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, bias, NULL, 0, 1, 1, PADDING_VALID, exponent, 1);
+}
+
+//
+// Depthwise 2x2
+//
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_2x2(dl_matrix3dq_t *in,
+                                                 dl_matrix3dq_t *filter,
+                                                 int stride_x,
+                                                 int stride_y,
+                                                 dl_padding_type padding,
+                                                 int exponent,
+                                                 char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_2x2_with_bias(dl_matrix3dq_t *in,
+                                                           dl_matrix3dq_t *f,
+                                                           dl_matrix3dq_t *bias,
+                                                           int stride_x,
+                                                           int stride_y,
+                                                           dl_padding_type padding,
+                                                           int exponent,
+                                                           int relu,
+                                                           char *name)
+{
+    return dl_matrix3dq_conv_padded(in, f, bias, NULL, relu, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_2x2_with_prelu(dl_matrix3dq_t *in,
+                                                            dl_matrix3dq_t *filter,
+                                                            dl_matrix3dq_t *prelu,
+                                                            int stride_x,
+                                                            int stride_y,
+                                                            dl_padding_type padding,
+                                                            int exponent,
+                                                            char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, prelu, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_2x2_with_bias_prelu(dl_matrix3dq_t *in,
+                                                                 dl_matrix3dq_t *f,
+                                                                 dl_matrix3dq_t *bias,
+                                                                 dl_matrix3dq_t *prelu,
+                                                                 int stride_x,
+                                                                 int stride_y,
+                                                                 dl_padding_type padding,
+                                                                 int exponent,
+                                                                 char *name)
+{
+    return dl_matrix3dq_conv_padded(in, f, bias, prelu, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+//
+// Depthwise 5x5
+//
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_5x5(dl_matrix3dq_t *in,
+                                                 dl_matrix3dq_t *filter,
+                                                 int stride_x,
+                                                 int stride_y,
+                                                 dl_padding_type padding,
+                                                 int exponent,
+                                                 char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_5x5_with_bias(dl_matrix3dq_t *in,
+                                                           dl_matrix3dq_t *f,
+                                                           dl_matrix3dq_t *bias,
+                                                           int stride_x,
+                                                           int stride_y,
+                                                           dl_padding_type padding,
+                                                           int exponent,
+                                                           int relu,
+                                                           char *name)
+{
+    return dl_matrix3dq_conv_padded(in, f, bias, NULL, relu, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_5x5_with_prelu(dl_matrix3dq_t *in,
+                                                            dl_matrix3dq_t *filter,
+                                                            dl_matrix3dq_t *prelu,
+                                                            int stride_x,
+                                                            int stride_y,
+                                                            dl_padding_type padding,
+                                                            int exponent,
+                                                            char *name)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, prelu, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_5x5_with_bias_prelu(dl_matrix3dq_t *in,
+                                                                 dl_matrix3dq_t *f,
+                                                                 dl_matrix3dq_t *bias,
+                                                                 dl_matrix3dq_t *prelu,
+                                                                 int stride_x,
+                                                                 int stride_y,
+                                                                 dl_padding_type padding,
+                                                                 int exponent,
+                                                                 char *name)
+{
+    return dl_matrix3dq_conv_padded(in, f, bias, prelu, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+//
+// Depthwise Common
+//
+
+#if CONFIG_DEVELOPING_CODE
+dl_matrix3dq_t *dl_matrix3dqq_depthwise_conv_common(dl_matrix3dq_t *in,
+                                                    dl_matrix3dq_t *filter,
+                                                    int stride_x,
+                                                    int stride_y,
+                                                    dl_padding_type padding,
+                                                    int exponent,
+                                                    dl_conv_mode mode)
+{
+    return dl_matrix3dq_conv_padded(in, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 1);
+}
+
+dl_matrix3dq_t *dl_matrix3duq_depthwise_conv_common(dl_matrix3du_t *in,
+                                                    dl_matrix3dq_t *filter,
+                                                    int stride_x,
+                                                    int stride_y,
+                                                    dl_padding_type padding,
+                                                    int exponent,
+                                                    dl_conv_mode mode)
+{
+    return dl_matrix3duq_conv_padded(in, filter, NULL, NULL, 0, stride_x, stride_y, padding, exponent, 1);
+}
+#endif
+
+//
+// Dot Product and FC
+//
+
+static void dl_matrix3dqq_fc_kernel(dl_matrix3dq_t *out,
+                                    dl_matrix3dq_t *in,
+                                    dl_matrix3dq_t *filter,
+                                    dl_matrix3dq_t *bias)
+{
+    const dl_lib_q_kernels_t *kernels = dl_lib_q_kernels();
+    int acc_exponent = in->exponent + filter->exponent;
+    int out_shift = out->exponent - acc_exponent;
+    for (int o = 0; o < filter->h; o++)
+    {
+        int64_t acc = kernels->dot(in->item, filter->item + o * filter->w, filter->w);
+        if (bias)
+            acc += dl_lib_shift_round(bias->item[o], acc_exponent - bias->exponent);
+        out->item[o] = dl_lib_saturate(dl_lib_shift_round(acc, out_shift));
+    }
+}
+
+void dl_matrix3dqq_dot_product(dl_matrix3dq_t *out,
+                               dl_matrix3dq_t *in,
+                               dl_matrix3dq_t *filter,
+                               dl_conv_mode mode)
+{
+    dl_matrix3dqq_fc_kernel(out, in, filter, NULL);
+}
+
+void dl_matrix3dqq_fc(dl_matrix3dq_t *out,
+                      dl_matrix3dq_t *in,
+                      dl_matrix3dq_t *filter,
+                      dl_conv_mode mode,
+                      char *name)
+{
+    dl_matrix3dqq_fc_kernel(out, in, filter, NULL);
+}
+
+void dl_matrix3dqq_fc_with_bias(dl_matrix3dq_t *out,
+                                dl_matrix3dq_t *in,
+                                dl_matrix3dq_t *filter,
+                                dl_matrix3dq_t *bias,
+                                dl_conv_mode mode,
+                                char *name)
+{
+    dl_matrix3dqq_fc_kernel(out, in, filter, bias);
+}
+
+//
+// Mobilefaceblock
+//
+
+/*
+ * Pointwise convolution whose filter is split into 'num' groups of output channels,
+ * bias and prelu span all the output channels.
+ */
+static dl_matrix3dq_t *dl_matrix3dqq_conv_1x1_split(dl_matrix3dq_t *in,
+                                                    dl_matrix3dq_t **filter,
+                                                    int num,
+                                                    dl_matrix3dq_t *bias,
+                                                    dl_matrix3dq_t *prelu,
+                                                    int relu,
+                                                    int exponent)
+{
+    int c = 0;
+    for (int i = 0; i < num; i++)
+        c += filter[i]->n;
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in->n, in->w, in->h, c, exponent);
+    if (NULL == out)
+        return NULL;
+
+    int offset = 0;
+    for (int i = 0; i < num; i++)
+    {
+        if (DL_SUCCESS != dl_matrix3dq_conv_kernel(out, offset, in, filter[i], bias, prelu, relu, 1, 1, 0, 0, 0))
+        {
+            dl_matrix3dq_free(out);
+            return NULL;
+        }
+        offset += filter[i]->n;
+    }
+    return out;
+}
+
+static dl_matrix3dq_t *dl_matrix3dqq_mobilefaceblock_common(dl_matrix3dq_t *in,
+                                                            dl_matrix3dq_t **pw,
+                                                            int pw_num,
+                                                            dl_matrix3dq_t *pw_bias,
+                                                            dl_matrix3dq_t *pw_prelu,
+                                                            dl_matrix3dq_t *dw,
+                                                            dl_matrix3dq_t *dw_bias,
+                                                            dl_matrix3dq_t *dw_prelu,
+                                                            dl_matrix3dq_t **pw_linear,
+                                                            int pw_linear_num,
+                                                            dl_matrix3dq_t *pw_linear_bias,
+                                                            int pw_exponent,
+                                                            int dw_exponent,
+                                                            int pw_linear_exponent,
+                                                            int stride_x,
+                                                            int stride_y,
+                                                            dl_padding_type padding,
+                                                            int shortcut)
+{
+    int relu = (NULL == pw_prelu);
+    dl_matrix3dq_t *pw_out = dl_matrix3dqq_conv_1x1_split(in, pw, pw_num, pw_bias, pw_prelu, relu, pw_exponent);
+    if (NULL == pw_out)
+        return NULL;
+
+    dl_matrix3dq_t *dw_out = dl_matrix3dq_conv_padded(pw_out, dw, dw_bias, dw_prelu, relu, stride_x, stride_y, padding, dw_exponent, 1);
+    dl_matrix3dq_free(pw_out);
+    if (NULL == dw_out)
+        return NULL;
+
+    dl_matrix3dq_t *out = dl_matrix3dqq_conv_1x1_split(dw_out, pw_linear, pw_linear_num, pw_linear_bias, NULL, 0, pw_linear_exponent);
+    dl_matrix3dq_free(dw_out);
+
+    if (shortcut && out)
+    {
+        dl_matrix3dq_t *sum = dl_matrix3dq_add(out, in, pw_linear_exponent);
+        dl_matrix3dq_free(out);
+        out = sum;
+    }
+    return out;
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_mobilefaceblock_split(dl_matrix3dq_t *in,
+                                                    dl_matrix3dq_t *pw_1,
+                                                    dl_matrix3dq_t *pw_2,
+                                                    dl_matrix3dq_t *pw_bias,
+                                                    dl_matrix3dq_t *dw,
+                                                    dl_matrix3dq_t *dw_bias,
+                                                    dl_matrix3dq_t *pw_linear_1,
+                                                    dl_matrix3dq_t *pw_linear_2,
+                                                    dl_matrix3dq_t *pw_linear_bias,
+                                                    int pw_exponent,
+                                                    int dw_exponent,
+                                                    int pw_linear_exponent,
+                                                    int stride_x,
+                                                    int stride_y,
+                                                    dl_padding_type padding,
+                                                    dl_conv_mode mode,
+                                                    int shortcut)
+{
+    dl_matrix3dq_t *pw[2] = {pw_1, pw_2};
+    dl_matrix3dq_t *pw_linear[2] = {pw_linear_1, pw_linear_2};
+    return dl_matrix3dqq_mobilefaceblock_common(in, pw, 2, pw_bias, NULL, dw, dw_bias, NULL, pw_linear, 2, pw_linear_bias,
+                                                pw_exponent, dw_exponent, pw_linear_exponent, stride_x, stride_y, padding, shortcut);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_mobilefaceblock(dl_matrix3dq_t *in,
+                                              dl_matrix3dq_t *pw,
+                                              dl_matrix3dq_t *pw_bias,
+                                              dl_matrix3dq_t *dw,
+                                              dl_matrix3dq_t *dw_bias,
+                                              dl_matrix3dq_t *pw_linear,
+                                              dl_matrix3dq_t *pw_linear_bias,
+                                              int pw_exponent,
+                                              int dw_exponent,
+                                              int pw_linear_exponent,
+                                              int stride_x,
+                                              int stride_y,
+                                              dl_padding_type padding,
+                                              dl_conv_mode mode,
+                                              int shortcut)
+{
+    return dl_matrix3dqq_mobilefaceblock_common(in, &pw, 1, pw_bias, NULL, dw, dw_bias, NULL, &pw_linear, 1, pw_linear_bias,
+                                                pw_exponent, dw_exponent, pw_linear_exponent, stride_x, stride_y, padding, shortcut);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_mobilefaceblock_prelu(dl_matrix3dq_t *in,
+                                                    dl_matrix3dq_t *pw,
+                                                    dl_matrix3dq_t *pw_bias,
+                                                    dl_matrix3dq_t *pw_prelu,
+                                                    dl_matrix3dq_t *dw,
+                                                    dl_matrix3dq_t *dw_bias,
+                                                    dl_matrix3dq_t *dw_prelu,
+                                                    dl_matrix3dq_t *pw_linear,
+                                                    dl_matrix3dq_t *pw_linear_bias,
+                                                    int pw_exponent,
+                                                    int dw_exponent,
+                                                    int pw_linear_exponent,
+                                                    int stride_x,
+                                                    int stride_y,
+                                                    dl_padding_type padding,
+                                                    dl_conv_mode mode,
+                                                    int shortcut)
+{
+    return dl_matrix3dqq_mobilefaceblock_common(in, &pw, 1, pw_bias, pw_prelu, dw, dw_bias, dw_prelu, &pw_linear, 1, pw_linear_bias,
+                                                pw_exponent, dw_exponent, pw_linear_exponent, stride_x, stride_y, padding, shortcut);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_mobilefaceblock_prelu_split_2_2(dl_matrix3dq_t *in,
+                                                              dl_matrix3dq_t *pw_1,
+                                                              dl_matrix3dq_t *pw_2,
+                                                              dl_matrix3dq_t *pw_bias,
+                                                              dl_matrix3dq_t *pw_prelu,
+                                                              dl_matrix3dq_t *dw,
+                                                              dl_matrix3dq_t *dw_bias,
+                                                              dl_matrix3dq_t *dw_prelu,
+                                                              dl_matrix3dq_t *pw_linear_1,
+                                                              dl_matrix3dq_t *pw_linear_2,
+                                                              dl_matrix3dq_t *pw_linear_bias,
+                                                              int pw_exponent,
+                                                              int dw_exponent,
+                                                              int pw_linear_exponent,
+                                                              int stride_x,
+                                                              int stride_y,
+                                                              dl_padding_type padding,
+                                                              dl_conv_mode mode,
+                                                              int shortcut)
+{
+    dl_matrix3dq_t *pw[2] = {pw_1, pw_2};
+    dl_matrix3dq_t *pw_linear[2] = {pw_linear_1, pw_linear_2};
+    return dl_matrix3dqq_mobilefaceblock_common(in, pw, 2, pw_bias, pw_prelu, dw, dw_bias, dw_prelu, pw_linear, 2, pw_linear_bias,
+                                                pw_exponent, dw_exponent, pw_linear_exponent, stride_x, stride_y, padding, shortcut);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_mobilefaceblock_prelu_split_4_4(dl_matrix3dq_t *in,
+                                                              dl_matrix3dq_t *pw_1,
+                                                              dl_matrix3dq_t *pw_2,
+                                                              dl_matrix3dq_t *pw_3,
+                                                              dl_matrix3dq_t *pw_4,
+                                                              dl_matrix3dq_t *pw_bias,
+                                                              dl_matrix3dq_t *pw_prelu,
+                                                              dl_matrix3dq_t *dw,
+                                                              dl_matrix3dq_t *dw_bias,
+                                                              dl_matrix3dq_t *dw_prelu,
+                                                              dl_matrix3dq_t *pw_linear_1,
+                                                              dl_matrix3dq_t *pw_linear_2,
+                                                              dl_matrix3dq_t *pw_linear_3,
+                                                              dl_matrix3dq_t *pw_linear_4,
+                                                              dl_matrix3dq_t *pw_linear_bias,
+                                                              int pw_exponent,
+                                                              int dw_exponent,
+                                                              int pw_linear_exponent,
+                                                              int stride_x,
+                                                              int stride_y,
+                                                              dl_padding_type padding,
+                                                              dl_conv_mode mode,
+                                                              int shortcut)
+{
+    dl_matrix3dq_t *pw[4] = {pw_1, pw_2, pw_3, pw_4};
+    dl_matrix3dq_t *pw_linear[4] = {pw_linear_1, pw_linear_2, pw_linear_3, pw_linear_4};
+    return dl_matrix3dqq_mobilefaceblock_common(in, pw, 4, pw_bias, pw_prelu, dw, dw_bias, dw_prelu, pw_linear, 4, pw_linear_bias,
+                                                pw_exponent, dw_exponent, pw_linear_exponent, stride_x, stride_y, padding, shortcut);
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_mobilefaceblock_prelu_split_1_2(dl_matrix3dq_t *in,
+                                                              dl_matrix3dq_t *pw,
+                                                              dl_matrix3dq_t *pw_bias,
+                                                              dl_matrix3dq_t *pw_prelu,
+                                                              dl_matrix3dq_t *dw,
+                                                              dl_matrix3dq_t *dw_bias,
+                                                              dl_matrix3dq_t *dw_prelu,
+                                                              dl_matrix3dq_t *pw_linear_1,
+                                                              dl_matrix3dq_t *pw_linear_2,
+                                                              dl_matrix3dq_t *pw_linear_bias,
+                                                              int pw_exponent,
+                                                              int dw_exponent,
+                                                              int pw_linear_exponent,
+                                                              int stride_x,
+                                                              int stride_y,
+                                                              dl_padding_type padding,
+                                                              dl_conv_mode mode,
+                                                              int shortcut)
+{
+    dl_matrix3dq_t *pw_linear[2] = {pw_linear_1, pw_linear_2};
+    return dl_matrix3dqq_mobilefaceblock_common(in, &pw, 1, pw_bias, pw_prelu, dw, dw_bias, dw_prelu, pw_linear, 2, pw_linear_bias,
+                                                pw_exponent, dw_exponent, pw_linear_exponent, stride_x, stride_y, padding, shortcut);
+}
+
+//
+//  blazeblock
+//
+
+static dl_matrix3dq_t *dl_matrix3dqq_blazeblock_shortcut(dl_matrix3dq_t *out,
+                                                         dl_matrix3dq_t *in,
+                                                         dl_matrix3dq_blazeblock_config_t *config,
+                                                         int exponent)
+{
+    dl_matrix3dq_t *shortcut = in;
+    if (config->stride_x > 1 || config->stride_y > 1)
+        shortcut = dl_matrix3dq_pooling(in, config->stride_x, config->stride_y, config->stride_x, config->stride_y,
+                                        (PADDING_VALID == config->padding) ? PADDING_VALID : PADDING_SAME_DONT_FREE_INPUT,
+                                        DL_POOLING_MAX);
+
+    dl_matrix3dq_t *sum = shortcut ? dl_matrix3dq_add_channel_diff(out, shortcut, exponent) : NULL;
+    if (shortcut != in)
+        dl_matrix3dq_free(shortcut);
+    dl_matrix3dq_free(out);
+    return sum;
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_blazeblock(dl_matrix3dq_t *in,
+                                         dl_matrix3dq_t *dw1_kernel,
+                                         dl_matrix3dq_t *dw1_bias,
+                                         dl_matrix3dq_t *pw1_kernel,
+                                         dl_matrix3dq_t *pw1_bias,
+                                         dl_matrix3dq_blazeblock_config_t config,
+                                         char *name)
+{
+    dl_matrix3dq_t *out = NULL;
+    dl_matrix3dq_t *dw1 = dl_matrix3dq_conv_padded(in, dw1_kernel, dw1_bias, NULL, 0, config.stride_x, config.stride_y, config.padding, config.dw1_exponent, 1);
+    if (dw1)
+        out = dl_matrix3dqq_conv_1x1_split(dw1, &pw1_kernel, 1, pw1_bias, NULL, 0, config.pw1_exponent);
+    dl_matrix3dq_free(dw1);
+
+    if (out && config.shortcut)
+        out = dl_matrix3dqq_blazeblock_shortcut(out, in, &config, config.pw1_exponent);
+    if (out)
+        dl_matrix3dq_relu(out);
+
+    if (!config.save_input)
+        dl_matrix3dq_free(in);
+    return out;
+}
+
+dl_matrix3dq_t *dl_matrix3dqq_double_blazeblock(dl_matrix3dq_t *in,
+                                                dl_matrix3dq_t *dw1_kernel,
+                                                dl_matrix3dq_t *dw1_bias,
+                                                dl_matrix3dq_t *pw1_kernel,
+                                                dl_matrix3dq_t *pw1_bias,
+                                                dl_matrix3dq_t *dw2_kernel,
+                                                dl_matrix3dq_t *dw2_bias,
+                                                dl_matrix3dq_t *pw2_kernel,
+                                                dl_matrix3dq_t *pw2_bias,
+                                                dl_matrix3dq_blazeblock_config_t config,
+                                                char *name)
+{
+    dl_matrix3dq_t *pw1 = NULL, *dw2 = NULL, *out = NULL;
+    dl_matrix3dq_t *dw1 = dl_matrix3dq_conv_padded(in, dw1_kernel, dw1_bias, NULL, 0, config.stride_x, config.stride_y, config.padding, config.dw1_exponent, 1);
+    if (dw1)
+        pw1 = dl_matrix3dqq_conv_1x1_split(dw1, &pw1_kernel, 1, pw1_bias, NULL, 1, config.pw1_exponent);
+    dl_matrix3dq_free(dw1);
+
+    if (pw1)
+        dw2 = dl_matrix3dq_conv_padded(pw1, dw2_kernel, dw2_bias, NULL, 0, 1, 1, config.padding, config.dw2_exponent, 1);
+    dl_matrix3dq_free(pw1);
+    if (dw2)
+        out = dl_matrix3dqq_conv_1x1_split(dw2, &pw2_kernel, 1, pw2_bias, NULL, 0, config.pw2_exponent);
+    dl_matrix3dq_free(dw2);
+
+    if (out && config.shortcut)
+        out = dl_matrix3dqq_blazeblock_shortcut(out, in, &config, config.pw2_exponent);
+    if (out)
+        dl_matrix3dq_relu(out);
+
+    if (!config.save_input)
+        dl_matrix3dq_free(in);
+    return out;
+}
+
+//
+// Mobilenet
+//
+
+dl_matrix3dq_t *dl_matrix3dqq_mobilenet(dl_matrix3dq_t *in,
+                                        dl_matrix3dq_t *dilate,
+                                        dl_matrix3dq_t *dilate_prelu,
+                                        dl_matrix3dq_t *depthwise,
+                                        dl_matrix3dq_t *depth_prelu,
+                                        dl_matrix3dq_t *compress,
+                                        dl_matrix3dq_t *bias,
+                                        dl_matrix3dq_mobilenet_config_t config,
+                                        char *name)
+{
+    dl_matrix3dq_t *dilate_out = dl_matrix3dqq_conv_1x1_split(in, &dilate, 1, NULL, dilate_prelu, 0, config.dilate_exponent);
+    if (NULL == dilate_out)
+        return NULL;
+
+    dl_matrix3dq_t *depth_out = dl_matrix3dq_conv_padded(dilate_out, depthwise, NULL, depth_prelu, 0,
+                                                         config.stride_x, config.stride_y, config.padding, config.depthwise_exponent, 1);
+    dl_matrix3dq_free(dilate_out);
+    if (NULL == depth_out)
+        return NULL;
+
+    dl_matrix3dq_t *out = dl_matrix3dqq_conv_1x1_split(depth_out, &compress, 1, bias, NULL, 0, config.compress_exponent);
+    dl_matrix3dq_free(depth_out);
+    return out;
+}
+
+dl_matrix3dq_t *dl_matrix3duq_mobilenet(dl_matrix3du_t *in,
+                                        dl_matrix3dq_t *dilate,
+                                        dl_matrix3dq_t *dilate_prelu,
+                                        dl_matrix3dq_t *depthwise,
+                                        dl_matrix3dq_t *depth_prelu,
+                                        dl_matrix3dq_t *compress,
+                                        dl_matrix3dq_t *bias,
+                                        dl_matrix3dq_mobilenet_config_t config,
+                                        char *name)
+{
+    dl_matrix3dq_t *in_q = dl_matrix3dq_from_matrixu(in);
+    if (NULL == in_q)
+        return NULL;
+    dl_matrix3dq_t *out = dl_matrix3dqq_mobilenet(in_q, dilate, dilate_prelu, depthwise, depth_prelu, compress, bias, config, name);
+    dl_matrix3dq_free(in_q);
+    return out;
+}
+
+//
+// Padding
+//
+
+dl_error_type dl_matrix3dqq_padding(dl_matrix3dq_t **padded_input,
+                                    int *output_height,
+                                    int *output_width,
+                                    dl_matrix3dq_t *input,
+                                    int stride_x,
+                                    int stride_y,
+                                    int kernel_size,
+                                    dl_padding_type padding_type)
+{
+    int pad_x, pad_y;
+    dl_lib_out_size(input->w, kernel_size, stride_x, padding_type, output_width, &pad_x);
+    dl_lib_out_size(input->h, kernel_size, stride_y, padding_type, output_height, &pad_y);
+    if (PADDING_VALID == padding_type)
+    {
+        *padded_input = input;
+        return DL_SUCCESS;
+    }
+
+    int padded_w = (*output_width - 1) * stride_x + kernel_size;
+    int padded_h = (*output_height - 1) * stride_y + kernel_size;
+    dl_matrix3dq_t *padded = dl_matrix3dq_alloc(input->n, max(padded_w, input->w), max(padded_h, input->h), input->c, input->exponent);
+    if (NULL == padded)
+        return DL_FAIL;
+
+    for (int b = 0; b < input->n; b++)
+        for (int y = 0; y < input->h; y++)
+            memcpy(padded->item + (b * padded->h + y + pad_y) * padded->stride + pad_x * padded->c,
+                   input->item + (b * input->h + y) * input->stride,
+                   input->stride * sizeof(qtp_t));
+
+    if (PADDING_SAME == padding_type)
+        dl_matrix3dq_free(input);
+    *padded_input = padded;
+    return DL_SUCCESS;
+}
+
+dl_error_type dl_matrix3duq_padding(dl_matrix3du_t **padded_input,
+                                    int *output_height,
+                                    int *output_width,
+                                    dl_matrix3du_t *input,
+                                    int stride_x,
+                                    int stride_y,
+                                    int kernel_size,
+                                    dl_padding_type padding_type)
+{
+    int pad_x, pad_y;
+    dl_lib_out_size(input->w, kernel_size, stride_x, padding_type, output_width, &pad_x);
+    dl_lib_out_size(input->h, kernel_size, stride_y, padding_type, output_height, &pad_y);
+    if (PADDING_VALID == padding_type)
+    {
+        *padded_input = input;
+        return DL_SUCCESS;
+    }
+
+    int padded_w = (*output_width - 1) * stride_x + kernel_size;
+    int padded_h = (*output_height - 1) * stride_y + kernel_size;
+    dl_matrix3du_t *padded = dl_matrix3du_alloc(input->n, max(padded_w, input->w), max(padded_h, input->h), input->c);
+    if (NULL == padded)
+        return DL_FAIL;
+
+    for (int b = 0; b < input->n; b++)
+        for (int y = 0; y < input->h; y++)
+            memcpy(padded->item + (b * padded->h + y + pad_y) * padded->stride + pad_x * padded->c,
+                   input->item + (b * input->h + y) * input->stride,
+                   input->stride * sizeof(uc_t));
+
+    if (PADDING_SAME == padding_type)
+        dl_matrix3du_free(input);
+    *padded_input = padded;
+    return DL_SUCCESS;
+}
+
+//
+// Upsample
+//
+
+dl_matrix3dq_t *dl_matrix3dqq_upsample_2x(dl_matrix3dq_t *in,
+                                          dl_upsample_type upsample)
+{
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in->n, in->w * 2, in->h * 2, in->c, in->exponent);
+    if (NULL == out)
+        return NULL;
+
+    // the rows of all images, an image never reads the rows of the next one
+    for (int row = 0; row < out->n * out->h; row++)
+    {
+        int oy = row % out->h;
+        qtp_t *in_item = in->item + row / out->h * in->h * in->stride;
+        for (int ox = 0; ox < out->w; ox++)
+        {
+            qtp_t *o = out->item + row * out->stride + ox * out->c;
+            if (UPSAMPLE_NEAREST_NEIGHBOR == upsample)
+            {
+                memcpy(o, in_item + (oy >> 1) * in->stride + (ox >> 1) * in->c, in->c * sizeof(qtp_t));
+                continue;
+            }
+
+            // Half pixel centers: the source lies a quarter pixel before or after the nearest item.
+            int y0 = oy >> 1, x0 = ox >> 1;
+            int y1 = (oy & 1) ? min(y0 + 1, in->h - 1) : max(y0 - 1, 0);
+            int x1 = (ox & 1) ? min(x0 + 1, in->w - 1) : max(x0 - 1, 0);
+            qtp_t *p00 = in_item + y0 * in->stride + x0 * in->c;
+            qtp_t *p01 = in_item + y0 * in->stride + x1 * in->c;
+            qtp_t *p10 = in_item + y1 * in->stride + x0 * in->c;
+            qtp_t *p11 = in_item + y1 * in->stride + x1 * in->c;
+            for (int c = 0; c < in->c; c++)
+            {
+                int32_t sum = 9 * p00[c] + 3 * p01[c] + 3 * p10[c] + p11[c];
+                o[c] = dl_lib_saturate(dl_lib_shift_round(sum, 4));
+            }
+        }
+    }
+    return out;
+}
+
+//
+// Pooling
+//
+
+dl_matrix3dq_t *dl_matrix3dq_global_pool(dl_matrix3dq_t *in)
+{
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in->n, 1, 1, in->c, in->exponent);
+    if (NULL == out)
+        return NULL;
+    int plane = in->w * in->h;
+    for (int b = 0; b < in->n; b++)
+    {
+        qtp_t *in_item = in->item + b * plane * in->c;
+        for (int c = 0; c < in->c; c++)
+        {
+            int64_t sum = 0;
+            for (int i = 0; i < plane; i++)
+                sum += in_item[i * in->c + c];
+            out->item[b * in->c + c] = dl_lib_saturate(llround((double)sum / plane));
+        }
+    }
+    return out;
+}
+
+dl_matrix3dq_t *dl_matrix3dq_pooling(dl_matrix3dq_t *in,
+                                     int f_w,
+                                     int f_h,
+                                     int stride_x,
+                                     int stride_y,
+                                     dl_padding_type padding,
+                                     dl_pooling_type pooling_type)
+{
+    int out_w, out_h, pad_x, pad_y;
+    dl_lib_out_size(in->w, f_w, stride_x, padding, &out_w, &pad_x);
+    dl_lib_out_size(in->h, f_h, stride_y, padding, &out_h, &pad_y);
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc_uninit(in->n, out_w, out_h, in->c, in->exponent);
+    if (NULL == out)
+        return NULL;
+
+    for (int row = 0; row < in->n * out_h; row++)
+    {
+        int oy = row % out_h;
+        qtp_t *in_item = in->item + row / out_h * in->h * in->stride;
+        int y1 = max(oy * stride_y - pad_y, 0);
+        int y2 = min(oy * stride_y - pad_y + f_h, in->h);
+        for (int ox = 0; ox < out_w; ox++)
+        {
+            int x1 = max(ox * stride_x - pad_x, 0);
+            int x2 = min(ox * stride_x - pad_x + f_w, in->w);
+            qtp_t *o = out->item + row * out->stride + ox * out->c;
+            for (int c = 0; c < in->c; c++)
+            {
+                int64_t value = (DL_POOLING_MAX == pooling_type) ? DL_QTP_MIN : 0;
+                for (int y = y1; y < y2; y++)
+                {
+                    for (int x = x1; x < x2; x++)
+                    {
+                        qtp_t v = in_item[y * in->stride + x * in->c + c];
+                        if (DL_POOLING_MAX == pooling_type)
+                            value = max(value, v);
+                        else
+                            value += v;
+                    }
+                }
+                if (DL_POOLING_AVG == pooling_type)
+                    value = llround((double)value / ((y2 - y1) * (x2 - x1)));
+                o[c] = dl_lib_saturate(value);
+            }
+        }
+    }
+    return out;
+}
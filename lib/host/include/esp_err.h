@@ -0,0 +1,11 @@
+#pragma once
+
+/*
+ * Host stand-in for the ESP-IDF error codes used by esp-face.
+ */
+#include <stdint.h>
+
+typedef int32_t esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+ * Host stand-in for the ESP-IDF logging macros, prints to stdout/stderr.
+ */
+#include <stdio.h>
+#include "esp_err.h"
+
+#ifndef ESP_HOST_LOG_LEVEL
+#define ESP_HOST_LOG_LEVEL 3 /*!< 1: error, 2: warning, 3: info, 4: debug, 5: verbose */
+#endif
+
+#define ESP_HOST_LOG(level, letter, stream, tag, format, ...)                  \
+    do                                                                         \
+    {                                                                          \
+        if (ESP_HOST_LOG_LEVEL >= level)                                       \
+            fprintf(stream, letter " (%s): " format "\n", tag, ##__VA_ARGS__); \
+    } while (0)
+
+#define ESP_LOGE(tag, format, ...) ESP_HOST_LOG(1, "E", stderr, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_HOST_LOG(2, "W", stderr, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_HOST_LOG(3, "I", stdout, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ESP_HOST_LOG(4, "D", stdout, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) ESP_HOST_LOG(5, "V", stdout, tag, format, ##__VA_ARGS__)
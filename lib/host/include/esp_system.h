@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Host stand-in for esp_system.h.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include "esp_err.h"
+
+static inline uint32_t esp_random(void)
+{
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Host stand-in for esp_timer, backed by the monotonic clock.
+ */
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief Get time in microseconds since an arbitrary point
+ *
+ * @return int64_t  Microseconds
+ */
+static inline int64_t esp_timer_get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
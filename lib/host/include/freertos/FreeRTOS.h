@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Host stand-in for FreeRTOS.h. esp-face only needs the basic types on host.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define portTICK_PERIOD_MS 1
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+
+static inline void vTaskDelay(const TickType_t ticks)
+{
+    usleep(ticks * portTICK_PERIOD_MS * 1000);
+}
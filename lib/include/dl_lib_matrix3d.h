@@ -82,15 +82,198 @@ typedef struct
     dl_padding_type padding;         /*!< Padding type */
 } dl_matrix3d_mobilenet_config_t;
 
+/**
+ * Arena for per-inference buffers.
+ *
+ * While an arena is bound to a thread with dl_lib_arena_use, every dl_lib_calloc / dl_lib_malloc
+ * of that thread, and so every dl_matrix3d(u/q)_alloc, is served from the arena by bumping an offset.
+ * dl_lib_free does nothing for arena buffers, they are all released by dl_lib_arena_reset,
+ * typically at the end of a frame. Requests that do not fit fall back to the heap.
+ *
+ * State that outlives a frame, e.g. caches and trackers, must come from dl_lib_heap_calloc /
+ * dl_lib_heap_malloc, which never use the arena nor a plan.
+ *
+ * The binding is per thread. The workers of fd_parallel_for do not see the arena of the caller,
+ * their allocations always go to the heap and are freed by dl_lib_free as usual.
+ */
+typedef struct
+{
+    uint8_t *base;   /*!< Start of the arena */
+    size_t size;     /*!< Size of the arena in bytes */
+    size_t used;     /*!< Bytes handed out since the last reset */
+    size_t peak;     /*!< Largest 'used' seen */
+    size_t overflow; /*!< Bytes taken from the heap because the arena was full, since the last reset */
+    int owned;       /*!< Whether 'base' was allocated by dl_lib_arena_create */
+} dl_lib_arena_t;
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Arena bound to the calling thread, NULL for heap allocation. Set it with dl_lib_arena_use.
+ */
+extern __thread dl_lib_arena_t *dl_lib_arena_current;
+
+/**
+ * @brief Create an arena with its own buffer.
+ *
+ * @param size      Size of the arena in bytes
+ * @return          Arena, NULL for failed
+ */
+dl_lib_arena_t *dl_lib_arena_create(size_t size);
+
+/**
+ * @brief Initialize an arena on a buffer provided by the caller, e.g. a static one.
+ *
+ * @param arena     Arena to initialize
+ * @param buffer    Buffer of the arena, 8-bytes aligned
+ * @param size      Size of buffer in bytes
+ */
+void dl_lib_arena_init(dl_lib_arena_t *arena, void *buffer, size_t size);
+
+/**
+ * @brief Bind an arena to the calling thread.
+ *
+ * @param arena     Arena to allocate from, NULL to go back to heap allocation
+ * @return          The arena bound before
+ */
+dl_lib_arena_t *dl_lib_arena_use(dl_lib_arena_t *arena);
+
+/**
+ * @brief Release everything allocated from the arena in one step. Buffers from the arena must not be used afterwards.
+ *
+ * @param arena     Arena to reset
+ */
+void dl_lib_arena_reset(dl_lib_arena_t *arena);
+
+/**
+ * @brief Destroy an arena, unbinding it from the calling thread if needed.
+ *
+ * @param arena     Arena from dl_lib_arena_create or dl_lib_arena_init
+ */
+void dl_lib_arena_destroy(dl_lib_arena_t *arena);
+
+/**
+ * Static memory plan of a fixed graph.
+ *
+ * The first pass between dl_lib_plan_begin and dl_lib_plan_end runs on the heap and records the size
+ * and the lifetime of every allocation. dl_lib_plan_end then assigns every allocation an offset in one
+ * slab, so that allocations alive at the same time do not overlap. The following passes take their
+ * allocations from the slab in the recorded order without touching the heap.
+ *
+ * A replay checks every allocation and every free of a slab buffer against the recorded sequence:
+ * same index, same size and same event, so the buffers alive at any time are the recorded ones and
+ * never overlap in the slab. From the first difference on, e.g. another input size or a buffer freed
+ * later than recorded, the rest of the pass allocates from the heap and counts it in 'mismatch'.
+ * Allocations never freed in the pass, e.g. the results, live until the next pass.
+ */
+typedef struct
+{
+    int count;        /*!< Number of recorded allocations */
+    int capacity;     /*!< Capacity of the arrays below */
+    size_t *size;     /*!< Size of every allocation */
+    int *start;       /*!< Event index of every allocation */
+    int *end;         /*!< Event index of every free, INT32_MAX if never freed */
+    size_t *offset;   /*!< Offset of every allocation in the slab */
+    void **pointer;   /*!< Recording: pointer of every allocation */
+    int *alive;       /*!< Allocations alive in the current pass, in allocation order */
+    int alive_count;  /*!< Number of entries of 'alive' */
+    int event;        /*!< Event counter of the current pass */
+    size_t live;      /*!< Recording: bytes alive */
+    int recording;    /*!< Whether the current pass is recorded */
+    int next;         /*!< Replay: next allocation */
+    int diverged;     /*!< Replay: the pass left the recorded sequence, the rest of it uses the heap */
+    int mismatch;     /*!< Replay: allocations that came from the heap. Recording: allocations not recorded */
+    uint8_t *slab;    /*!< Slab of the plan */
+    size_t total;     /*!< Sum of all allocations of one pass */
+    size_t live_peak; /*!< Largest amount alive at once, the lower bound of 'peak' */
+    size_t peak;      /*!< Size of the slab, the peak memory of one pass */
+} dl_lib_plan_t;
+
+/**
+ * @brief Plan bound to the calling thread by dl_lib_plan_begin.
+ */
+extern __thread dl_lib_plan_t *dl_lib_plan_current;
+
+/**
+ * @brief Create an empty plan.
+ *
+ * @return          Plan, NULL for failed
+ */
+dl_lib_plan_t *dl_lib_plan_create(void);
+
+/**
+ * @brief Start a pass on the calling thread. The first pass is recorded, the following ones replay the plan.
+ *
+ * @param plan      Plan
+ */
+void dl_lib_plan_begin(dl_lib_plan_t *plan);
+
+/**
+ * @brief End a pass. After the recorded pass, compute the offsets and allocate the slab.
+ *
+ * @param plan      Plan
+ * @return          DL_SUCCESS, or DL_FAIL if the recording or the slab allocation failed
+ */
+dl_error_type dl_lib_plan_end(dl_lib_plan_t *plan);
+
+/**
+ * @brief Print the allocation count and memory figures of a plan.
+ *
+ * @param plan      Plan
+ */
+void dl_lib_plan_report(dl_lib_plan_t *plan);
+
+/**
+ * @brief Destroy a plan and its slab.
+ *
+ * @param plan      Plan
+ */
+void dl_lib_plan_destroy(dl_lib_plan_t *plan);
+
+/**
+ * @brief Used by dl_lib_alloc / dl_lib_free while a plan is bound.
+ */
+void *dl_lib_plan_alloc(dl_lib_plan_t *plan, size_t size);
+void dl_lib_plan_record_alloc(dl_lib_plan_t *plan, void *pointer, size_t size);
+void dl_lib_plan_free(dl_lib_plan_t *plan, void *pointer);
+
+#if __cplusplus
+}
+#endif
+
 /*
- * @brief Allocate a zero-initialized space. Must use 'dl_lib_free' to free the memory.
+ * @brief Place the aligned pointer in a block of total_size bytes, storing base in front of it.
+ */
+static inline void *dl_lib_align(void *res, void *base, int total_size, int align, int zero)
+{
+    if (zero)
+        bzero(res, total_size);
+    void **data = (void **)res + 1;
+    void **aligned;
+    if (align)
+        aligned = (void **)(((size_t)data + (align - 1)) & -align);
+    else
+        aligned = data;
+
+    // Arena and plan buffers keep a NULL base, so that freeing them is a no-op.
+    aligned[-1] = base;
+    return (void *)aligned;
+}
+
+/*
+ * @brief Allocate a space from the heap, never from the arena or the plan of the thread.
+ *        Must use 'dl_lib_free' to free the memory.
  *
  * @param cnt  Count of units.
  * @param size Size of unit.
  * @param align Align of memory. If not required, set 0.
+ * @param zero Whether to zero-initialize the space.
  * @return Pointer of allocated memory. Null for failed.
  */
-static void *dl_lib_calloc(int cnt, int size, int align)
+static inline void *dl_lib_heap_alloc(int cnt, int size, int align, int zero)
 {
     int total_size = cnt * size + align + sizeof(void *);
     void *res = malloc(total_size);
@@ -107,20 +290,109 @@ static void *dl_lib_calloc(int cnt, int size, int align)
 #endif
         return NULL;
     }
-    bzero(res, total_size);
-    void **data = (void **)res + 1;
-    void **aligned;
-    if (align)
-        aligned = (void **)(((size_t)data + (align - 1)) & -align);
+    return dl_lib_align(res, res, total_size, align, zero);
+}
+
+/*
+ * @brief Allocate a space. Must use 'dl_lib_free' to free the memory.
+ *
+ * @param cnt  Count of units.
+ * @param size Size of unit.
+ * @param align Align of memory. If not required, set 0.
+ * @param zero Whether to zero-initialize the space.
+ * @return Pointer of allocated memory. Null for failed.
+ */
+static inline void *dl_lib_alloc(int cnt, int size, int align, int zero)
+{
+    int total_size = cnt * size + align + sizeof(void *);
+    size_t block_size = (total_size + 7) & ~7;
+    void *res = NULL;
+    dl_lib_arena_t *arena = dl_lib_arena_current;
+    dl_lib_plan_t *plan = dl_lib_plan_current;
+    if (plan && !plan->recording)
+    {
+        res = dl_lib_plan_alloc(plan, block_size);
+    }
+    else if (arena)
+    {
+        if (arena->used + block_size <= arena->size)
+        {
+            res = arena->base + arena->used;
+            arena->used += block_size;
+            if (arena->used > arena->peak)
+                arena->peak = arena->used;
+        }
+        else
+        {
+            arena->overflow += block_size;
+        }
+    }
+
+    void *aligned;
+    if (res)
+        aligned = dl_lib_align(res, NULL, total_size, align, zero);
     else
-        aligned = data;
+        aligned = dl_lib_heap_alloc(cnt, size, align, zero);
+    if (aligned && plan && plan->recording)
+        dl_lib_plan_record_alloc(plan, aligned, block_size);
+    return aligned;
+}
 
-    aligned[-1] = res;
-    return (void *)aligned;
+/*
+ * @brief Allocate a zero-initialized space. Must use 'dl_lib_free' to free the memory.
+ *
+ * @param cnt  Count of units.
+ * @param size Size of unit.
+ * @param align Align of memory. If not required, set 0.
+ * @return Pointer of allocated memory. Null for failed.
+ */
+static inline void *dl_lib_calloc(int cnt, int size, int align)
+{
+    return dl_lib_alloc(cnt, size, align, 1);
+}
+
+/*
+ * @brief Allocate a space without initializing it. Must use 'dl_lib_free' to free the memory.
+ *
+ * @param cnt  Count of units.
+ * @param size Size of unit.
+ * @param align Align of memory. If not required, set 0.
+ * @return Pointer of allocated memory. Null for failed.
+ */
+static inline void *dl_lib_malloc(int cnt, int size, int align)
+{
+    return dl_lib_alloc(cnt, size, align, 0);
+}
+
+/*
+ * @brief Allocate a zero-initialized space from the heap, for state that outlives the arena or plan
+ *        bound to the thread. Must use 'dl_lib_free' to free the memory.
+ *
+ * @param cnt  Count of units.
+ * @param size Size of unit.
+ * @param align Align of memory. If not required, set 0.
+ * @return Pointer of allocated memory. Null for failed.
+ */
+static inline void *dl_lib_heap_calloc(int cnt, int size, int align)
+{
+    return dl_lib_heap_alloc(cnt, size, align, 1);
+}
+
+/*
+ * @brief Allocate a space from the heap without initializing it, see 'dl_lib_heap_calloc'.
+ *
+ * @param cnt  Count of units.
+ * @param size Size of unit.
+ * @param align Align of memory. If not required, set 0.
+ * @return Pointer of allocated memory. Null for failed.
+ */
+static inline void *dl_lib_heap_malloc(int cnt, int size, int align)
+{
+    return dl_lib_heap_alloc(cnt, size, align, 0);
 }
 
 /**
- * @brief Free the memory space allocated by 'dl_lib_calloc'
+ * @brief Free the memory space allocated by 'dl_lib_calloc', 'dl_lib_malloc' or their heap versions
  * 
  */
 static inline void dl_lib_free(void *d)
@@ -128,11 +400,14 @@ static inline void dl_lib_free(void *d)
     if (NULL == d)
         return;
 
+    if (dl_lib_plan_current)
+        dl_lib_plan_free(dl_lib_plan_current, d);
     free(((void **)d)[-1]);
 }
 
 /*
- * @brief Allocate a 3D matrix with float items, the access sequence is NHWC
+ * @brief Allocate a 3D matrix with float items without initializing the items, the access sequence is NHWC.
+ *        For outputs that are fully overwritten.
  *
  * @param n     Number of matrix3d, for filters it is out channels, for others it is 1
  * @param w     Width of matrix3d
@@ -140,7 +415,7 @@ static inline void dl_lib_free(void *d)
  * @param c     Channel of matrix3d
  * @return      3d matrix
  */
-static inline dl_matrix3d_t *dl_matrix3d_alloc(int n, int w, int h, int c)
+static inline dl_matrix3d_t *dl_matrix3d_alloc_uninit(int n, int w, int h, int c)
 {
     dl_matrix3d_t *r = (dl_matrix3d_t *)dl_lib_calloc(1, sizeof(dl_matrix3d_t), 0);
     if (NULL == r)
@@ -148,7 +423,7 @@ static inline dl_matrix3d_t *dl_matrix3d_alloc(int n, int w, int h, int c)
         printf("internal r failed.\n");
         return NULL;
     }
-    fptp_t *items = (fptp_t *)dl_lib_calloc(n * w * h * c, sizeof(fptp_t), 0);
+    fptp_t *items = (fptp_t *)dl_lib_malloc(n * w * h * c, sizeof(fptp_t), 0);
     if (NULL == items)
     {
         printf("matrix3d item alloc failed.\n");
@@ -167,7 +442,7 @@ static inline dl_matrix3d_t *dl_matrix3d_alloc(int n, int w, int h, int c)
 }
 
 /*
- * @brief Allocate a 3D matrix with 8-bits items, the access sequence is NHWC
+ * @brief Allocate a 3D matrix with float items, the access sequence is NHWC
  *
  * @param n     Number of matrix3d, for filters it is out channels, for others it is 1
  * @param w     Width of matrix3d
@@ -175,7 +450,25 @@ static inline dl_matrix3d_t *dl_matrix3d_alloc(int n, int w, int h, int c)
  * @param c     Channel of matrix3d
  * @return      3d matrix
  */
-static inline dl_matrix3du_t *dl_matrix3du_alloc(int n, int w, int h, int c)
+static inline dl_matrix3d_t *dl_matrix3d_alloc(int n, int w, int h, int c)
+{
+    dl_matrix3d_t *r = dl_matrix3d_alloc_uninit(n, w, h, c);
+    if (r)
+        bzero(r->item, n * w * h * c * sizeof(fptp_t));
+    return r;
+}
+
+/*
+ * @brief Allocate a 3D matrix with 8-bits items without initializing the items, the access sequence is NHWC.
+ *        For outputs that are fully overwritten.
+ *
+ * @param n     Number of matrix3d, for filters it is out channels, for others it is 1
+ * @param w     Width of matrix3d
+ * @param h     Height of matrix3d
+ * @param c     Channel of matrix3d
+ * @return      3d matrix
+ */
+static inline dl_matrix3du_t *dl_matrix3du_alloc_uninit(int n, int w, int h, int c)
 {
     dl_matrix3du_t *r = (dl_matrix3du_t *)dl_lib_calloc(1, sizeof(dl_matrix3du_t), 0);
     if (NULL == r)
@@ -183,7 +476,7 @@ static inline dl_matrix3du_t *dl_matrix3du_alloc(int n, int w, int h, int c)
         printf("internal r failed.\n");
         return NULL;
     }
-    uc_t *items = (uc_t *)dl_lib_calloc(n * w * h * c, sizeof(uc_t), 0);
+    uc_t *items = (uc_t *)dl_lib_malloc(n * w * h * c, sizeof(uc_t), 0);
     if (NULL == items)
     {
         printf("matrix3du item alloc failed.\n");
@@ -201,6 +494,23 @@ static inline dl_matrix3du_t *dl_matrix3du_alloc(int n, int w, int h, int c)
     return r;
 }
 
+/*
+ * @brief Allocate a 3D matrix with 8-bits items, the access sequence is NHWC
+ *
+ * @param n     Number of matrix3d, for filters it is out channels, for others it is 1
+ * @param w     Width of matrix3d
+ * @param h     Height of matrix3d
+ * @param c     Channel of matrix3d
+ * @return      3d matrix
+ */
+static inline dl_matrix3du_t *dl_matrix3du_alloc(int n, int w, int h, int c)
+{
+    dl_matrix3du_t *r = dl_matrix3du_alloc_uninit(n, w, h, c);
+    if (r)
+        bzero(r->item, n * w * h * c * sizeof(uc_t));
+    return r;
+}
+
 /*
  * @brief Free a matrix3d
  *
@@ -75,7 +75,7 @@ typedef struct
 //
 
 /*
- * @brief Allocate a 3d quantised matrix
+ * @brief Allocate a 3d quantised matrix without initializing the items. For outputs that are fully overwritten.
  *
  * @param n Number of filters, for input and output, should be 1
  * @param w Width of matrix
@@ -84,7 +84,7 @@ typedef struct
  * @param e Exponent of matrix data
  * @return 3d quantized matrix
  */
-static inline dl_matrix3dq_t *dl_matrix3dq_alloc(int n, int w, int h, int c, int e)
+static inline dl_matrix3dq_t *dl_matrix3dq_alloc_uninit(int n, int w, int h, int c, int e)
 {
     dl_matrix3dq_t *r = (dl_matrix3dq_t *)dl_lib_calloc(1, sizeof(dl_matrix3dq_t), 0);
     if (NULL == r)
@@ -93,7 +93,7 @@ static inline dl_matrix3dq_t *dl_matrix3dq_alloc(int n, int w, int h, int c, int
         return NULL;
     }
 
-    qtp_t *items = (qtp_t *)dl_lib_calloc(n * w * h * c, sizeof(qtp_t), 16);
+    qtp_t *items = (qtp_t *)dl_lib_malloc(n * w * h * c, sizeof(qtp_t), 16);
     if (NULL == items)
     {
         printf("matrix3dq item alloc failed.\n");
@@ -112,6 +112,24 @@ static inline dl_matrix3dq_t *dl_matrix3dq_alloc(int n, int w, int h, int c, int
     return r;
 }
 
+/*
+ * @brief Allocate a 3d quantised matrix
+ *
+ * @param n Number of filters, for input and output, should be 1
+ * @param w Width of matrix
+ * @param h Height of matrix
+ * @param c Channel of matrix
+ * @param e Exponent of matrix data
+ * @return 3d quantized matrix
+ */
+static inline dl_matrix3dq_t *dl_matrix3dq_alloc(int n, int w, int h, int c, int e)
+{
+    dl_matrix3dq_t *r = dl_matrix3dq_alloc_uninit(n, w, h, c, e);
+    if (r)
+        bzero(r->item, n * w * h * c * sizeof(qtp_t));
+    return r;
+}
+
 /*
  * @brief Free a 3d quantized matrix
  *
@@ -0,0 +1,85 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Arena allocation, and heap allocations that survive an arena reset.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "dl_lib_matrix3d.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+static int in_arena(dl_lib_arena_t *arena, void *p)
+{
+    return (uint8_t *)p >= arena->base && (uint8_t *)p < arena->base + arena->size;
+}
+
+int main(void)
+{
+    dl_lib_arena_t *arena = dl_lib_arena_create(4096);
+    CHECK(arena);
+    CHECK(NULL == dl_lib_arena_use(arena));
+
+    uint8_t *frame = (uint8_t *)dl_lib_calloc(100, 1, 0);
+    CHECK(frame && in_arena(arena, frame));
+    CHECK(arena->used > 0);
+
+    uint8_t *state = (uint8_t *)dl_lib_heap_calloc(100, 1, 16);
+    CHECK(state && !in_arena(arena, state));
+    CHECK(0 == ((size_t)state & 15));
+    for (int i = 0; i < 100; i++)
+        CHECK(0 == state[i]);
+    memset(state, 0x5a, 100);
+
+    // a matrix does not fit any more, it comes from the heap
+    dl_matrix3d_t *big = dl_matrix3d_alloc(1, 32, 32, 4);
+    CHECK(big && !in_arena(arena, big->item));
+    CHECK(arena->overflow > 0);
+    dl_matrix3d_free(big);
+    dl_lib_free(frame);
+
+    // reusing the arena after a reset does not touch the heap state
+    dl_lib_arena_reset(arena);
+    CHECK(0 == arena->used);
+    uint8_t *reused = (uint8_t *)dl_lib_malloc(arena->size / 2, 1, 0);
+    CHECK(reused && in_arena(arena, reused));
+    memset(reused, 0xff, arena->size / 2);
+    for (int i = 0; i < 100; i++)
+        CHECK(0x5a == state[i]);
+
+    dl_lib_free(state);
+    dl_lib_arena_destroy(arena);
+    CHECK(NULL == dl_lib_arena_current);
+    printf("arena: ok\n");
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Every image of a batch goes through the layers as if it was on its own.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "dl_lib_matrix3dq.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+#define BATCH 3
+
+static uint32_t seed = 1;
+
+static dl_matrix3dq_t *random_matrix(int n, int w, int h, int c, int exponent)
+{
+    dl_matrix3dq_t *m = dl_matrix3dq_alloc(n, w, h, c, exponent);
+    for (int i = 0; m && i < n * w * h * c; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        m->item[i] = (int16_t)(seed >> 16) >> 4;
+    }
+    return m;
+}
+
+static dl_matrix3dq_t *image_of(dl_matrix3dq_t *m, int b)
+{
+    dl_matrix3dq_t *image = dl_matrix3dq_alloc(1, m->w, m->h, m->c, m->exponent);
+    if (image)
+        memcpy(image->item, m->item + b * m->h * m->stride, m->h * m->stride * sizeof(qtp_t));
+    return image;
+}
+
+/*
+ * 1 if image b of 'batch' is 'single'. Frees 'single'.
+ */
+static int same_image(dl_matrix3dq_t *batch, int b, dl_matrix3dq_t *single)
+{
+    int same = single && BATCH == batch->n && 1 == single->n && batch->w == single->w && batch->h == single->h &&
+               batch->c == single->c && batch->exponent == single->exponent &&
+               0 == memcmp(batch->item + b * batch->h * batch->stride, single->item, single->h * single->stride * sizeof(qtp_t));
+    dl_matrix3dq_free(single);
+    return same;
+}
+
+static dl_matrix3dq_t *layers(dl_matrix3dq_t *in, dl_matrix3dq_t *other, dl_matrix3dq_t **filters, int step)
+{
+    dl_matrix3dq_mobilenet_config_t mobilenet = {2, 2, PADDING_SAME_DONT_FREE_INPUT, DL_C_IMPL, -8, -8, -8};
+    dl_matrix3dq_blazeblock_config_t blazeblock = {2, 2, PADDING_SAME_DONT_FREE_INPUT, DL_C_IMPL, -8, -8, -8, -8, 1, 1};
+    dl_matrix3dq_t *padded = in;
+    int out_h, out_w;
+    switch (step)
+    {
+    case 0:
+        return dl_matrix3dq_pooling(in, 3, 3, 2, 2, PADDING_SAME_DONT_FREE_INPUT, DL_POOLING_MAX);
+    case 1:
+        return dl_matrix3dq_pooling(in, 2, 2, 2, 2, PADDING_VALID, DL_POOLING_AVG);
+    case 2:
+        return dl_matrix3dq_global_pool(in);
+    case 3:
+        return dl_matrix3dqq_upsample_2x(in, UPSAMPLE_NEAREST_NEIGHBOR);
+    case 4:
+        return dl_matrix3dqq_upsample_2x(in, UPSAMPLE_BILINEAR);
+    case 5:
+        return dl_matrix3dq_concat(in, other);
+    case 6:
+        return dl_matrix3dq_add(in, other, -7);
+    case 7:
+        return DL_SUCCESS == dl_matrix3dqq_padding(&padded, &out_h, &out_w, in, 2, 2, 3, PADDING_SAME_DONT_FREE_INPUT) ? padded : NULL;
+    case 8:
+        return dl_matrix3dqq_mobilenet(in, filters[0], NULL, filters[1], NULL, filters[2], NULL, mobilenet, "test");
+    case 9:
+        return dl_matrix3dqq_blazeblock(in, filters[1], NULL, filters[3], NULL, blazeblock, "test");
+    default:
+        return dl_matrix3dqq_double_blazeblock(in, filters[1], NULL, filters[0], NULL, filters[1], NULL, filters[3], NULL, blazeblock, "test");
+    }
+}
+
+int main(void)
+{
+    dl_matrix3dq_t *in = random_matrix(BATCH, 7, 6, 5, -8);
+    dl_matrix3dq_t *other = random_matrix(BATCH, 7, 6, 5, -7);
+    dl_matrix3dq_t *filters[4] = {random_matrix(5, 1, 1, 5, -8), random_matrix(1, 3, 3, 5, -8),
+                                  random_matrix(4, 1, 1, 5, -8), random_matrix(9, 1, 1, 5, -8)};
+    CHECK(in && other && filters[0] && filters[1] && filters[2] && filters[3]);
+
+    for (int step = 0; step <= 10; step++)
+    {
+        dl_matrix3dq_t *batch = layers(in, other, filters, step);
+        CHECK(batch);
+        for (int b = 0; b < BATCH; b++)
+        {
+            dl_matrix3dq_t *image = image_of(in, b);
+            dl_matrix3dq_t *other_image = image_of(other, b);
+            CHECK(image && other_image);
+            if (!same_image(batch, b, layers(image, other_image, filters, step)))
+            {
+                printf("step %d, image %d\n", step, b);
+                return 1;
+            }
+            dl_matrix3dq_free(other_image);
+            dl_matrix3dq_free(image);
+        }
+        dl_matrix3dq_free(batch);
+    }
+
+    // a preallocated output that is too small is zeroed, not overrun
+    dl_matrix3dq_t *out = dl_matrix3dq_alloc(1, 7, 6, 5, -8);
+    CHECK(out);
+    out->item[0] = 1;
+    dl_matrix3dqq_conv_1x1(out, in, filters[0], DL_C_IMPL, "test");
+    CHECK(0 == out->item[0]);
+    dl_matrix3dq_free(out);
+
+    for (int i = 0; i < 4; i++)
+        dl_matrix3dq_free(filters[i]);
+    dl_matrix3dq_free(other);
+    dl_matrix3dq_free(in);
+    printf("batch: ok\n");
+    return 0;
+}
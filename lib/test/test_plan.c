@@ -0,0 +1,222 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Static memory plan: replay of a graph of host kernels, and passes that leave the recording.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "dl_lib_matrix3d.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+static dl_matrix3d_t *weights(int n, int w, int h, int c, int seed)
+{
+    dl_matrix3d_t *m = dl_matrix3d_alloc(n, w, h, c);
+    int count = n * w * h * c;
+    for (int i = 0; i < count; i++)
+        m->item[i] = (float)(((i * 37 + seed * 101) % 23) - 11) / 32;
+    return m;
+}
+
+static dl_matrix3d_t *conv, *bias, *pw_1, *pw_2, *dw, *pw_linear_1, *pw_linear_2, *scale, *offset, *scale_linear, *offset_linear;
+
+/*
+ * conv 3x3, a mobileface block with a shortcut, global pooling.
+ */
+static dl_matrix3d_t *forward(dl_matrix3d_t *in)
+{
+    dl_matrix3d_t *x = dl_matrix3dff_conv_3x3(in, conv, bias, 1, 1, PADDING_SAME);
+    dl_matrix3d_relu(x);
+    dl_matrix3d_t *y = dl_matrix3d_mobilefaceblock_split(x, pw_1, pw_2, scale, offset, dw, scale, offset,
+                                                         pw_linear_1, pw_linear_2, scale_linear, offset_linear,
+                                                         1, 1, PADDING_SAME, 0, 1);
+    dl_matrix3d_free(x);
+    dl_matrix3d_t *out = dl_matrix3d_global_pool(y);
+    dl_matrix3d_free(y);
+    return out;
+}
+
+static int in_slab(dl_lib_plan_t *plan, void *p)
+{
+    return (uint8_t *)p >= plan->slab && (uint8_t *)p < plan->slab + plan->peak;
+}
+
+static int graph(void)
+{
+    conv = weights(16, 3, 3, 8, 1);
+    bias = weights(1, 1, 1, 16, 2);
+    pw_1 = weights(16, 1, 1, 16, 3);
+    pw_2 = weights(16, 1, 1, 16, 4);
+    dw = weights(1, 3, 3, 32, 5);
+    scale = weights(1, 1, 1, 32, 6);
+    offset = weights(1, 1, 1, 32, 7);
+    pw_linear_1 = weights(8, 1, 1, 32, 8);
+    pw_linear_2 = weights(8, 1, 1, 32, 9);
+    scale_linear = weights(1, 1, 1, 16, 10);
+    offset_linear = weights(1, 1, 1, 16, 11);
+    dl_matrix3d_t *in = weights(1, 12, 10, 8, 12);
+
+    dl_matrix3d_t *expect = forward(in);
+    CHECK(expect && 16 == expect->c);
+
+    dl_lib_plan_t *plan = dl_lib_plan_create();
+    CHECK(plan);
+    for (int pass = 0; pass < 4; pass++)
+    {
+        dl_lib_plan_begin(plan);
+        dl_matrix3d_t *out = forward(in);
+        CHECK(out);
+        CHECK(0 == memcmp(out->item, expect->item, 16 * sizeof(fptp_t)));
+        if (pass)
+        {
+            CHECK(in_slab(plan, out) && in_slab(plan, out->item));
+            CHECK(0 == plan->mismatch && !plan->diverged);
+        }
+        dl_matrix3d_free(out);
+        CHECK(DL_SUCCESS == dl_lib_plan_end(plan));
+        CHECK(0 == plan->alive_count);
+    }
+
+    // buffers alive at the same time never share slab memory
+    CHECK(plan->count > 8);
+    CHECK(plan->peak >= plan->live_peak && plan->peak < plan->total);
+    for (int i = 0; i < plan->count; i++)
+        for (int j = i + 1; j < plan->count; j++)
+        {
+            if (plan->start[i] >= plan->end[j] || plan->start[j] >= plan->end[i])
+                continue;
+            CHECK(plan->offset[i] >= plan->offset[j] + plan->size[j] || plan->offset[j] >= plan->offset[i] + plan->size[i]);
+        }
+
+    // another input size leaves the recording, the pass still gives the right result from the heap
+    dl_matrix3d_t *other = weights(1, 10, 9, 8, 12);
+    dl_matrix3d_t *other_expect = forward(other);
+    dl_lib_plan_begin(plan);
+    dl_matrix3d_t *out = forward(other);
+    CHECK(out && !in_slab(plan, out));
+    CHECK(0 == memcmp(out->item, other_expect->item, 16 * sizeof(fptp_t)));
+    CHECK(plan->diverged && plan->mismatch > 0);
+    dl_matrix3d_free(out);
+    dl_lib_plan_end(plan);
+
+    dl_lib_plan_report(plan);
+    dl_lib_plan_destroy(plan);
+    dl_matrix3d_free(other);
+    dl_matrix3d_free(other_expect);
+    dl_matrix3d_free(expect);
+    dl_matrix3d_free(in);
+    return 0;
+}
+
+static int lifetimes(void)
+{
+    // recorded: a and b are never alive together, so they share the slab
+    dl_lib_plan_t *plan = dl_lib_plan_create();
+    CHECK(plan);
+    dl_lib_plan_begin(plan);
+    void *a = dl_lib_malloc(64, 1, 0);
+    dl_lib_free(a);
+    void *b = dl_lib_malloc(64, 1, 0);
+    void *c = dl_lib_malloc(32, 1, 0);
+    dl_lib_free(c);
+    dl_lib_free(b);
+    CHECK(DL_SUCCESS == dl_lib_plan_end(plan));
+    CHECK(plan->offset[0] == plan->offset[1]);
+
+    // same sizes, but a is kept alive: b must not get its memory
+    dl_lib_plan_begin(plan);
+    a = dl_lib_malloc(64, 1, 0);
+    CHECK(in_slab(plan, a));
+    b = dl_lib_malloc(64, 1, 0);
+    CHECK(b && !in_slab(plan, b));
+    memset(a, 1, 64);
+    memset(b, 2, 64);
+    CHECK(1 == ((uint8_t *)a)[63]);
+    // the recording is not used for the rest of the pass, even for a matching size
+    c = dl_lib_malloc(32, 1, 0);
+    CHECK(c && !in_slab(plan, c));
+    CHECK(plan->diverged && 2 == plan->mismatch);
+    dl_lib_free(c);
+    dl_lib_free(b);
+    dl_lib_free(a);
+    dl_lib_plan_end(plan);
+
+    // a buffer freed later than recorded stops the replay before its memory is reused
+    dl_lib_plan_begin(plan);
+    a = dl_lib_malloc(64, 1, 0);
+    dl_lib_free(a);
+    b = dl_lib_malloc(64, 1, 0);
+    c = dl_lib_malloc(32, 1, 0);
+    CHECK(in_slab(plan, b) && in_slab(plan, c));
+    dl_lib_free(b);
+    CHECK(plan->diverged && 0 == plan->mismatch);
+    void *d = dl_lib_malloc(32, 1, 0);
+    CHECK(d && !in_slab(plan, d));
+    dl_lib_free(d);
+    dl_lib_free(c);
+    dl_lib_plan_end(plan);
+
+    // and a size that differs stops it too
+    dl_lib_plan_begin(plan);
+    a = dl_lib_malloc(48, 1, 0);
+    CHECK(a && !in_slab(plan, a));
+    dl_lib_free(a);
+    b = dl_lib_malloc(64, 1, 0);
+    CHECK(b && !in_slab(plan, b));
+    CHECK(2 == plan->mismatch);
+    dl_lib_free(b);
+    dl_lib_plan_end(plan);
+
+    // the recorded sequence replays again
+    dl_lib_plan_begin(plan);
+    a = dl_lib_malloc(64, 1, 0);
+    dl_lib_free(a);
+    b = dl_lib_malloc(64, 1, 0);
+    c = dl_lib_malloc(32, 1, 0);
+    dl_lib_free(c);
+    dl_lib_free(b);
+    CHECK(in_slab(plan, a) && a == b);
+    CHECK(!plan->diverged && 0 == plan->mismatch);
+    dl_lib_plan_end(plan);
+
+    dl_lib_plan_destroy(plan);
+    return 0;
+}
+
+int main(void)
+{
+    if (graph() || lifetimes())
+        return 1;
+    printf("plan: ok\n");
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * The quantized convolutions against a plain reference, with the SIMD kernels and then,
+ * re-run with ESP_FACE_HOST_NO_SIMD set, with the scalar ones. Channel counts cover the
+ * vector tails, the inputs the int16 extremes and the padding on every side.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "dl_lib_matrix3dq.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+#define TEST_SHIFT 12
+
+static uint32_t seed = 1;
+
+static qtp_t random_q(void)
+{
+    seed = seed * 1664525u + 1013904223u;
+    // a quarter of the items are the extremes, (-32768)^2 pairs are the hard case for the SIMD sums
+    switch (seed >> 30)
+    {
+    case 0:
+        return DL_QTP_MIN;
+    case 1:
+        return DL_QTP_MAX;
+    default:
+        return (qtp_t)(seed >> 8);
+    }
+}
+
+static dl_matrix3dq_t *random_matrix(int n, int w, int h, int c)
+{
+    dl_matrix3dq_t *m = dl_matrix3dq_alloc(n, w, h, c, -8);
+    for (int i = 0; m && i < n * w * h * c; i++)
+        m->item[i] = random_q();
+    return m;
+}
+
+static qtp_t reference_output(int64_t acc)
+{
+    acc = (acc + ((int64_t)1 << (TEST_SHIFT - 1))) >> TEST_SHIFT;
+    return acc > DL_QTP_MAX ? DL_QTP_MAX : (acc < DL_QTP_MIN ? DL_QTP_MIN : (qtp_t)acc);
+}
+
+/*
+ * Output (oy, ox, oc) of image b of a SAME padded convolution, 'depthwise' uses filter channel oc on input channel oc.
+ */
+static qtp_t reference(dl_matrix3dq_t *in, dl_matrix3dq_t *filter, int stride, int depthwise, int b, int oy, int ox, int oc)
+{
+    int pad_x = ((in->w + stride - 1) / stride - 1) * stride + filter->w - in->w;
+    int pad_y = ((in->h + stride - 1) / stride - 1) * stride + filter->h - in->h;
+    pad_x = pad_x > 0 ? pad_x / 2 : 0;
+    pad_y = pad_y > 0 ? pad_y / 2 : 0;
+    int64_t acc = 0;
+    for (int fy = 0; fy < filter->h; fy++)
+    {
+        for (int fx = 0; fx < filter->w; fx++)
+        {
+            int y = oy * stride + fy - pad_y;
+            int x = ox * stride + fx - pad_x;
+            if (y < 0 || y >= in->h || x < 0 || x >= in->w)
+                continue;
+            qtp_t *pi = in->item + (b * in->h + y) * in->stride + x * in->c;
+            if (depthwise)
+            {
+                acc += (int32_t)pi[oc] * filter->item[(fy * filter->w + fx) * filter->c + oc];
+                continue;
+            }
+            qtp_t *pf = filter->item + ((oc * filter->h + fy) * filter->w + fx) * filter->c;
+            for (int i = 0; i < in->c; i++)
+                acc += (int32_t)pi[i] * pf[i];
+        }
+    }
+    return reference_output(acc);
+}
+
+static int check_conv(int w, int h, int c, int n, int stride, int depthwise)
+{
+    // two images, the second one catches a kernel that only convolves the first
+    dl_matrix3dq_t *in = random_matrix(2, w, h, c);
+    dl_matrix3dq_t *filter = depthwise ? random_matrix(1, 3, 3, c) : random_matrix(n, 3, 3, c);
+    CHECK(in && filter);
+    int exponent = in->exponent + filter->exponent + TEST_SHIFT;
+    dl_matrix3dq_t *out = depthwise
+                              ? dl_matrix3dqq_depthwise_conv_3x3(in, filter, stride, stride, PADDING_SAME, 0, exponent, "test")
+                              : dl_matrix3dqq_conv_common(in, filter, NULL, stride, stride, PADDING_SAME, exponent, DL_C_IMPL);
+    CHECK(out);
+    CHECK(out->n == in->n && out->w == (w + stride - 1) / stride && out->h == (h + stride - 1) / stride);
+    for (int b = 0; b < out->n; b++)
+        for (int oy = 0; oy < out->h; oy++)
+            for (int ox = 0; ox < out->w; ox++)
+                for (int oc = 0; oc < out->c; oc++)
+                    CHECK(out->item[(b * out->h + oy) * out->stride + ox * out->c + oc] == reference(in, filter, stride, depthwise, b, oy, ox, oc));
+
+    dl_matrix3dq_free(out);
+    dl_matrix3dq_free(filter);
+    dl_matrix3dq_free(in);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    // 300 channels take the depthwise accumulators from the heap
+    static const int channels[] = {1, 3, 8, 15, 16, 17, 33, 300};
+    for (int i = 0; i < (int)(sizeof(channels) / sizeof(channels[0])); i++)
+    {
+        for (int stride = 1; stride <= 2; stride++)
+        {
+            if (check_conv(7, 5, channels[i], 1, stride, 1) || check_conv(5, 6, channels[i], 4, stride, 0))
+            {
+                printf("%d channels, stride %d\n", channels[i], stride);
+                return 1;
+            }
+        }
+    }
+
+    if (getenv("ESP_FACE_HOST_NO_SIMD"))
+    {
+        printf("simd: ok, scalar kernels\n");
+        return 0;
+    }
+    printf("simd: ok, fastest kernels\n");
+    fflush(stdout);
+    // The kernels are chosen once per process, the scalar run needs a new one
+    setenv("ESP_FACE_HOST_NO_SIMD", "1", 1);
+    execv("/proc/self/exe", argv);
+    perror("execv");
+    return 1;
+}
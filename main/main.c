@@ -23,7 +23,9 @@ void md_task(void *arg)
     dl_matrix3du_t *image_ori = dl_matrix3du_alloc(1, ori_w, ori_h, c);
     dl_matrix3du_t *image_motion = dl_matrix3du_alloc(1, w, h, c);
     dl_matrix3du_t *image_new = dl_matrix3du_alloc(1, w, h, c);
-    dl_matrix3du_t *image_tmp = dl_matrix3du_alloc(1, w, h, c);
+    uint8_t *mask = (uint8_t *)dl_lib_calloc((w + 7) / 8 * h, sizeof(uint8_t), 0);
+    box_t rois[4];
+    mtmn_config_t mtmn_config = mtmn_init_config();
 
     //dl_matrix3du_t *image1 = (dl_matrix3du_t *)get_coeff_ref_in.getter_3d("image1", NULL, 0);
     //dl_matrix3du_t *image2 = (dl_matrix3du_t *)get_coeff_ref_in.getter_3d("image2", NULL, 0);
@@ -53,25 +55,40 @@ void md_task(void *arg)
             continue;
         }
 
-        image_abs_diff(image_new->item, image_motion->item, image_new->item, count);
-        image_threshold(image_new->item, image_new->item, 35, 255, count, BINARY);
-        image_erode(image_tmp->item, image_new->item, w, h, c);
+        if (image_motion_mask_packed(mask, image_new->item, image_motion->item, w, h, c, 35) < 0)
+            continue;
 
+        // The same sampling as before the fused mask, every second pixel away from the border
         int motion_changes = 0;
         int padding = 10;
+        int mask_stride = (w + 7) / 8;
         for (int j = padding; j < h - padding - 1; j += 2)
         {
-            uint8_t *data = image_tmp->item + j * w * c;
+            uint8_t *bits = mask + j * mask_stride;
             for (int i = padding; i < w - padding - 1; i += 2)
             {
-                uint8_t *d = data + i * 3;
-                if (d[0] + d[1] + d[2] > 750)
+                if (bits[i / 8] & (1 << (i % 8)))
                 {
                     motion_changes++;
                 }
             }
         }
-        printf("changes: %lld\n", motion_changes);
+        printf("changes: %d\n", motion_changes);
+
+        // Run the detection only where something moved
+        int roi_number = image_motion_rois_packed(rois, 4, mask, w, h, ratio, 4);
+        if (roi_number > 0)
+        {
+            box_array_t *net_boxes = face_detect_roi(image_ori, &mtmn_config, rois, roi_number);
+            if (net_boxes)
+            {
+                printf("faces: %d\n", net_boxes->len);
+                dl_lib_free(net_boxes->score);
+                dl_lib_free(net_boxes->box);
+                dl_lib_free(net_boxes->landmark);
+                dl_lib_free(net_boxes);
+            }
+        }
     }
 
 }
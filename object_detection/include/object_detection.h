@@ -50,10 +50,59 @@ extern "C"
      * 
      * @param image             The input image
      * @param model             A 'detection_model_t' type point of detection model
-     * @return box_array_t*     The detection result with box and corresponding score and category
+     * @return box_array_t*     The detection result with box, class probability and category
      */
     box_array_t *detect_object(dl_matrix3du_t *image, detection_model_t *model);
 
+    /**
+     * @brief Detect objects with a chosen suppression strategy.
+     *
+     *        detect_object is the same as hard NMS with model_config.nms_threshold. The
+     *        strategy is not part of detection_model_config_t, that struct is laid out
+     *        by the prebuilt model archives.
+     *
+     *        The boxes of all stages are scored with the sigmoid of their best class logit,
+     *        so scores, nms_config->score_threshold and the soft NMS decay are probabilities.
+     *
+     * @param image             The input image
+     * @param model             A 'detection_model_t' type point of detection model
+     * @param nms_config        Soft or hard NMS, class aware or not, and a cap on the kept boxes.
+     *                          NULL for detect_object's behavior. A config that fails image_nms_config_check,
+     *                          e.g. IMAGE_NMS_SOFT_GAUSSIAN with sigma <= 0, is rejected and NULL is returned
+     * @return box_array_t*     The detection result, soft NMS reports the decayed probabilities
+     */
+    box_array_t *detect_object_with_nms(dl_matrix3du_t *image, detection_model_t *model, const image_nms_config_t *nms_config);
+
+    /**
+     * @brief Detect objects in a frame in any image_pixel_format_t, e.g. a RGB565 or YUV422 camera frame.
+     *
+     *        The frame is resized straight into the input of the net, it is never converted to RGB888
+     *        as a whole. The size of the frame must be the one given to update_detection_model.
+     *
+     * @param frame             Frame, see image_frame()
+     * @param model             A 'detection_model_t' type point of detection model
+     * @param nms_config        As in detect_object_with_nms, NULL for hard NMS
+     * @return box_array_t*     The detection result
+     */
+    box_array_t *detect_object_frame(const image_frame_t *frame, detection_model_t *model, const image_nms_config_t *nms_config);
+
+    /**
+     * @brief Detect objects only around the given regions, e.g. the motion regions of image_motion_rois().
+     *
+     *        The regions are grown to the smallest input of the first stage and merged when they
+     *        overlap. Each one is resized by the scale of update_detection_model() and goes through
+     *        the net, the boxes of all regions are suppressed together. An object has to lie inside
+     *        a region to be found.
+     *
+     * @param image             The input image
+     * @param model             A 'detection_model_t' type point of detection model
+     * @param rois              Regions in the image, NULL for the whole image
+     * @param roi_number        Number of regions
+     * @param nms_config        As in detect_object_with_nms, NULL for hard NMS
+     * @return box_array_t*     The detection result in the coordinates of the image, NULL if nothing is found
+     */
+    box_array_t *detect_object_roi(dl_matrix3du_t *image, detection_model_t *model, const box_t *rois, int roi_number, const image_nms_config_t *nms_config);
+
 #if __cplusplus
 }
 #endif
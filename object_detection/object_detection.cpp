@@ -26,6 +26,16 @@
 #include "math.h"
 #include "esp_image.hpp"
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#define GET_BOXES_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define GET_BOXES_NEON 1
+#endif
+
+#define GET_BOXES_CELLS_ON_STACK 64 /* valid cells of one stage kept on the stack, more go to the heap */
+
 inline fptp_t __get_shift_factor(int exponent)
 {
     fptp_t factor = 1.0;
@@ -46,9 +56,149 @@ inline fptp_t __fast_exp(double x, int steps)
     return x;
 }
 
+/*
+ * Quantized logit of a probability for a score map of the given exponent, saturated to the
+ * range of qtp_t: a threshold of 0 keeps every cell above DL_QTP_MIN, a threshold of 1 none.
+ */
 inline qtp_t __desigmoid(fptp_t value, int exponent)
 {
-    return -log(1 / value - 1) * (1 << exponent);
+    if (value <= 0)
+        return DL_QTP_MIN;
+    if (value >= 1)
+        return DL_QTP_MAX;
+    double logit = ldexp(-log(1 / value - 1), -exponent);
+    return max(min(logit, (double)DL_QTP_MAX), (double)DL_QTP_MIN);
+}
+
+/*
+ * Probability of a quantized logit, the scores of every stage are compared and decayed as probabilities.
+ */
+inline fptp_t __sigmoid(int score, int exponent)
+{
+    return 1 / (1 + exp(-ldexp(score, exponent)));
+}
+
+/*
+ * Find the cells that have a class score above the threshold. score holds class_number
+ * scores per cell. The first capacity cells are written to cells in ascending order,
+ * the return value is the number of all of them.
+ */
+static int __find_valid_cells(const qtp_t *score, int cell_number, int class_number, int threshold, int *cells, int capacity)
+{
+    int count = 0;
+    int last = -1;
+    int n = cell_number * class_number;
+    int i = 0;
+#if GET_BOXES_SSE2 || GET_BOXES_NEON
+    // Almost every score is below the threshold, skip 8 of them at a time
+#if GET_BOXES_SSE2
+    const __m128i simd_threshold = _mm_set1_epi16(threshold);
+#else
+    const int16x8_t simd_threshold = vdupq_n_s16(threshold);
+#endif
+    for (; i + 8 <= n; i += 8)
+    {
+#if GET_BOXES_SSE2
+        if (0 == _mm_movemask_epi8(_mm_cmpgt_epi16(_mm_loadu_si128((const __m128i *)(score + i)), simd_threshold)))
+            continue;
+#else
+        if (0 == vmaxvq_u16(vcgtq_s16(vld1q_s16(score + i), simd_threshold)))
+            continue;
+#endif
+        for (int k = i; k < i + 8; k++)
+        {
+            int cell = k / class_number;
+            if (score[k] > threshold && cell != last)
+            {
+                if (count < capacity)
+                    cells[count] = cell;
+                count++;
+                last = cell;
+            }
+        }
+    }
+#endif
+    for (; i < n; i++)
+    {
+        int cell = i / class_number;
+        if (score[i] > threshold && cell != last)
+        {
+            if (count < capacity)
+                cells[count] = cell;
+            count++;
+            last = cell;
+        }
+    }
+    return count;
+}
+
+/*
+ * Collect the valid cells of a stage, on the stack when there are few of them.
+ * Returns the number of cells, 0 if they do not fit in memory, *cells must be
+ * released with __free_valid_cells.
+ */
+static int __get_valid_cells(const qtp_t *score, int cell_number, int class_number, int threshold, int *cells_on_stack, int **cells)
+{
+    *cells = cells_on_stack;
+    int valid_number = __find_valid_cells(score, cell_number, class_number, threshold, cells_on_stack, GET_BOXES_CELLS_ON_STACK);
+    if (valid_number > GET_BOXES_CELLS_ON_STACK)
+    {
+        *cells = (int *)dl_lib_malloc(valid_number, sizeof(int), 0);
+        if (NULL == *cells)
+        {
+            *cells = cells_on_stack;
+            return 0;
+        }
+        __find_valid_cells(score, cell_number, class_number, threshold, *cells, valid_number);
+    }
+    return valid_number;
+}
+
+static void __free_valid_cells(int *cells, int *cells_on_stack)
+{
+    if (cells != cells_on_stack)
+        dl_lib_free(cells);
+}
+
+/*
+ * Category and probability of the best class of a cell, the first one on a tie.
+ */
+static inline void __get_max_score(const qtp_t *score, int class_number, int exponent, image_box_t *box)
+{
+    int max_score = score[0];
+    int max_score_c = 0;
+    for (int c = 1; c < class_number; c++)
+    {
+        if (max_score < score[c])
+        {
+            max_score = score[c];
+            max_score_c = c;
+        }
+    }
+    box->category = max_score_c;
+    box->score = __sigmoid(max_score, exponent);
+}
+
+/*
+ * Link the boxes of an array into a list that owns the array, NULL and the array
+ * is freed if the list can not be allocated.
+ */
+static image_list_t *__link_valid_boxes(image_box_t *valid_box, int valid_number)
+{
+    for (int i = 0; i < valid_number - 1; i++)
+        valid_box[i].next = &(valid_box[i + 1]);
+    valid_box[valid_number - 1].next = NULL;
+
+    image_list_t *valid_list = (image_list_t *)dl_lib_calloc(1, sizeof(image_list_t), 0);
+    if (NULL == valid_list)
+    {
+        dl_lib_free(valid_box);
+        return NULL;
+    }
+    valid_list->head = valid_box;
+    valid_list->origin_head = valid_box;
+    valid_list->len = valid_number;
+    return valid_list;
 }
 
 void *__ab_get_boxes(detection_stage_result_t *stage, detection_model_config_t *model_config, detection_stage_config_t *stage_config, int stage_index)
@@ -70,85 +220,56 @@ void *__ab_get_boxes(detection_stage_result_t *stage, detection_model_config_t *
     int landmark_offset_shift = -stage[stage_index].landmark_offset->exponent;
 #endif
 
-    image_box_t *redundant = (image_box_t *)dl_lib_calloc(stage[stage_index].score->h * stage[stage_index].score->w * stage[stage_index].score->n, sizeof(image_box_t), 0);
-    image_list_t *valid_list = (image_list_t *)dl_lib_calloc(1, sizeof(image_list_t), 0);
-
     /*
         score format is (anchor_num, h, w, cls), box is (anchor_num, h, w, 4);
         while in the memory layout is (h, w, anchor, cls) and (h, w, anchor, 4)
     */
-    for (size_t y = 0; y < stage[stage_index].score->h; y++)
-    {
-        for (size_t x = 0; x < stage[stage_index].score->w; x++)
-        {
-            for (size_t a = 0; a < stage[stage_index].score->n; a++)
-            {
-                int max_score = *score++;
-                int max_score_c = 0;
-                for (size_t c = 1; c < stage[stage_index].score->c; c++)
-                {
-                    if (max_score < *score)
-                    {
-                        max_score = *score;
-                        max_score_c = c;
-                    }
-                    score++;
-                }
-                if (max_score > score_threshold)
-                {
-                    redundant[valid_list->len].category = max_score_c;
-                    redundant[valid_list->len].score = max_score;
-                    int center_y = (y * stride + project_offset) * y_resize_scale;
-                    int center_x = (x * stride + project_offset) * x_resize_scale;
-                    int anchor_h = anchors[a][0] * y_resize_scale;
-                    int anchor_w = anchors[a][1] * x_resize_scale;
-                    redundant[valid_list->len].box.box_p[0] = center_x - anchor_w / 2 + ((anchor_w * box_offset[0]) >> box_offset_shift);
-                    redundant[valid_list->len].box.box_p[1] = center_y - anchor_h / 2 + ((anchor_h * box_offset[1]) >> box_offset_shift);
-                    redundant[valid_list->len].box.box_p[2] = center_x + anchor_w / 2 + ((anchor_w * box_offset[2]) >> box_offset_shift);
-                    redundant[valid_list->len].box.box_p[3] = center_y + anchor_h / 2 + ((anchor_h * box_offset[3]) >> box_offset_shift);
-#if CONFIG_DETECT_WITH_LANDMARK
-                    redundant[valid_list->len].landmark.landmark_p[0] = center_x - anchor_w / 2 + ((anchor_w * landmark_offset[0]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[1] = center_y - anchor_h / 2 + ((anchor_h * landmark_offset[1]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[2] = center_x - anchor_w / 2 + ((anchor_w * landmark_offset[2]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[3] = center_y - anchor_h / 2 + ((anchor_h * landmark_offset[3]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[4] = center_x - anchor_w / 2 + ((anchor_w * landmark_offset[4]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[5] = center_y - anchor_h / 2 + ((anchor_h * landmark_offset[5]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[6] = center_x - anchor_w / 2 + ((anchor_w * landmark_offset[6]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[7] = center_y - anchor_h / 2 + ((anchor_h * landmark_offset[7]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[8] = center_x - anchor_w / 2 + ((anchor_w * landmark_offset[8]) >> landmark_offset_shift);
-                    redundant[valid_list->len].landmark.landmark_p[9] = center_y - anchor_h / 2 + ((anchor_h * landmark_offset[9]) >> landmark_offset_shift);
-#endif
-                    valid_list->len++;
-                }
-                box_offset += 4;
-#if CONFIG_DETECT_WITH_LANDMARK
-                landmark_offset += LANDMARKS_NUM;
-#endif
-            }
-        }
-    }
+    int width = stage[stage_index].score->w;
+    int anchor_number = stage[stage_index].score->n;
+    int class_number = stage[stage_index].score->c;
+    int cells_on_stack[GET_BOXES_CELLS_ON_STACK];
+    int *cells;
+    int valid_number = __get_valid_cells(score, stage[stage_index].score->h * width * anchor_number, class_number, score_threshold, cells_on_stack, &cells);
+    if (0 == valid_number)
+        return NULL;
 
-    if (0 == valid_list->len)
+    // Only the cells above the threshold are decoded
+    image_box_t *valid_box = (image_box_t *)dl_lib_calloc(valid_number, sizeof(image_box_t), 0);
+    if (NULL == valid_box)
     {
-        dl_lib_free(redundant);
-        dl_lib_free(valid_list);
+        __free_valid_cells(cells, cells_on_stack);
         return NULL;
     }
-
-    image_box_t *compact = (image_box_t *)dl_lib_calloc(valid_list->len, sizeof(image_box_t), 0);
-    size_t i = 0;
-    for (; i < valid_list->len - 1; i++)
+    for (int i = 0; i < valid_number; i++)
     {
-        compact[i] = redundant[i];
-        compact[i].next = &(compact[i + 1]);
+        int cell = cells[i];
+        int y = cell / (width * anchor_number);
+        int x = cell / anchor_number % width;
+        int a = cell % anchor_number;
+        image_box_t *box = &(valid_box[i]);
+        __get_max_score(score + cell * class_number, class_number, stage[stage_index].score->exponent, box);
+
+        int center_y = (y * stride + project_offset) * y_resize_scale;
+        int center_x = (x * stride + project_offset) * x_resize_scale;
+        int anchor_h = anchors[a][0] * y_resize_scale;
+        int anchor_w = anchors[a][1] * x_resize_scale;
+        qtp_t *offset = box_offset + cell * 4;
+        box->box.box_p[0] = center_x - anchor_w / 2 + ((anchor_w * offset[0]) >> box_offset_shift);
+        box->box.box_p[1] = center_y - anchor_h / 2 + ((anchor_h * offset[1]) >> box_offset_shift);
+        box->box.box_p[2] = center_x + anchor_w / 2 + ((anchor_w * offset[2]) >> box_offset_shift);
+        box->box.box_p[3] = center_y + anchor_h / 2 + ((anchor_h * offset[3]) >> box_offset_shift);
+#if CONFIG_DETECT_WITH_LANDMARK
+        qtp_t *landmark = landmark_offset + cell * LANDMARKS_NUM;
+        for (int k = 0; k < LANDMARKS_NUM; k += 2)
+        {
+            box->landmark.landmark_p[k] = center_x - anchor_w / 2 + ((anchor_w * landmark[k]) >> landmark_offset_shift);
+            box->landmark.landmark_p[k + 1] = center_y - anchor_h / 2 + ((anchor_h * landmark[k + 1]) >> landmark_offset_shift);
+        }
+#endif
     }
-    compact[i] = redundant[i];
-    dl_lib_free(redundant);
-
-    valid_list->head = compact;
-    valid_list->origin_head = compact;
+    __free_valid_cells(cells, cells_on_stack);
 
-    return valid_list;
+    return __link_valid_boxes(valid_box, valid_number);
 }
 
 void *__ap_get_boxes(detection_stage_result_t *stage, detection_model_config_t *model_config, detection_stage_config_t *stage_config, int stage_index)
@@ -164,61 +285,51 @@ void *__ap_get_boxes(detection_stage_result_t *stage, detection_model_config_t *
     qtp_t *box_offset = stage[stage_index].box_offset->item;
     fptp_t box_offset_shift_factor = __get_shift_factor(stage[stage_index].box_offset->exponent);
 
-    image_box_t *redundant = (image_box_t *)dl_lib_calloc(stage[stage_index].score->h * stage[stage_index].score->w, sizeof(image_box_t), 0);
-    image_list_t *valid_list = (image_list_t *)dl_lib_calloc(1, sizeof(image_list_t), 0);
-
-    for (size_t y = 0; y < stage[stage_index].score->h; y++)
-    {
-        for (size_t x = 0; x < stage[stage_index].score->w; x++)
-        {
-            int max_score = *score++;
-            int max_score_c = 0;
-            for (size_t c = 1; c < stage[stage_index].score->c; c++)
-            {
-                if (max_score < *score)
-                {
-                    max_score = *score;
-                    max_score_c = c;
-                }
-                score++;
-            }
-            if (max_score > score_threshold)
-            {
-                redundant[valid_list->len].category = max_score_c;
-                redundant[valid_list->len].score = max_score;
-                qtp_t center_y = y * stride + project_offset;
-                qtp_t center_x = x * stride + project_offset;
-                redundant[valid_list->len].box.box_p[0] = (center_x - __fast_exp(box_offset[0] * box_offset_shift_factor, 8)) * x_resize_scale;
-                redundant[valid_list->len].box.box_p[1] = (center_y - __fast_exp(box_offset[1] * box_offset_shift_factor, 8)) * y_resize_scale;
-                redundant[valid_list->len].box.box_p[2] = (center_x + __fast_exp(box_offset[2] * box_offset_shift_factor, 8)) * x_resize_scale;
-                redundant[valid_list->len].box.box_p[3] = (center_y + __fast_exp(box_offset[3] * box_offset_shift_factor, 8)) * y_resize_scale;
-                valid_list->len++;
-            }
-            box_offset += 4;
-        }
-    }
+    int width = stage[stage_index].score->w;
+    int class_number = stage[stage_index].score->c;
+    int cells_on_stack[GET_BOXES_CELLS_ON_STACK];
+    int *cells;
+    int valid_number = __get_valid_cells(score, stage[stage_index].score->h * width, class_number, score_threshold, cells_on_stack, &cells);
+    if (0 == valid_number)
+        return NULL;
 
-    if (0 == valid_list->len)
+    // Only the cells above the threshold are decoded
+    image_box_t *valid_box = (image_box_t *)dl_lib_calloc(valid_number, sizeof(image_box_t), 0);
+    if (NULL == valid_box)
     {
-        dl_lib_free(redundant);
-        dl_lib_free(valid_list);
+        __free_valid_cells(cells, cells_on_stack);
         return NULL;
     }
-
-    image_box_t *compact = (image_box_t *)dl_lib_calloc(valid_list->len, sizeof(image_box_t), 0);
-    size_t i = 0;
-    for (; i < valid_list->len - 1; i++)
+    for (int i = 0; i < valid_number; i++)
     {
-        compact[i] = redundant[i];
-        compact[i].next = &(compact[i + 1]);
+        int cell = cells[i];
+        image_box_t *box = &(valid_box[i]);
+        __get_max_score(score + cell * class_number, class_number, stage[stage_index].score->exponent, box);
+
+        qtp_t center_y = cell / width * stride + project_offset;
+        qtp_t center_x = cell % width * stride + project_offset;
+        qtp_t *offset = box_offset + cell * 4;
+        box->box.box_p[0] = (center_x - __fast_exp(offset[0] * box_offset_shift_factor, 8)) * x_resize_scale;
+        box->box.box_p[1] = (center_y - __fast_exp(offset[1] * box_offset_shift_factor, 8)) * y_resize_scale;
+        box->box.box_p[2] = (center_x + __fast_exp(offset[2] * box_offset_shift_factor, 8)) * x_resize_scale;
+        box->box.box_p[3] = (center_y + __fast_exp(offset[3] * box_offset_shift_factor, 8)) * y_resize_scale;
     }
-    compact[i] = redundant[i];
-    dl_lib_free(redundant);
+    __free_valid_cells(cells, cells_on_stack);
 
-    valid_list->head = compact;
-    valid_list->origin_head = compact;
+    return __link_valid_boxes(valid_box, valid_number);
+}
 
-    return valid_list;
+static int __get_enabled_top_k(detection_model_t *model, int short_side)
+{
+    int enabled_top_k = 0;
+    for (size_t i = 0; i < model->stage_number; i++)
+    {
+        if (short_side >= model->stage_config[i].boundary)
+            enabled_top_k++;
+        else
+            break;
+    }
+    return enabled_top_k;
 }
 
 void update_detection_model(detection_model_t *model, fptp_t resize_scale, fptp_t score_threshold, fptp_t nms_threshold, int image_height, int image_width)
@@ -238,49 +349,124 @@ void update_detection_model(detection_model_t *model, fptp_t resize_scale, fptp_
     model->model_config.free_image = true;
 
     int short_side = min(model->model_config.resized_height, model->model_config.resized_width);
-    model->model_config.enabled_top_k = 0;
-    for (size_t i = 0; i < model->stage_number; i++)
+    model->model_config.enabled_top_k = __get_enabled_top_k(model, short_side);
+    assert(model->model_config.enabled_top_k > 0);
+}
+
+/*
+ * Resize a frame into the input of the net. Whole frames are read by Image, views into
+ * a larger frame are resampled bilinearly a row at a time.
+ */
+static void __resize_frame(dl_matrix3dq_t *resized_image, const image_frame_t *frame)
+{
+    if (IMAGE_PIXEL_RGB888 == frame->format && frame->stride == frame->w * 3)
     {
-        if (short_side >= model->stage_config[i].boundary)
-            model->model_config.enabled_top_k++;
-        else
-            break;
+        Image<qtp_t>::resize_to_rgb888(resized_image->item, 0, resized_image->h, 0, resized_image->w, resized_image->c, frame->data, frame->h, frame->w, resized_image->w, 0, IMAGE_RESIZE_MEAN);
+        return;
     }
-    assert(model->model_config.enabled_top_k > 0);
+    if (IMAGE_PIXEL_RGB565 == frame->format && frame->stride == frame->w * 2)
+    {
+        Image<qtp_t>::resize_to_rgb888(resized_image->item, 0, resized_image->h, 0, resized_image->w, resized_image->c, (uint16_t *)frame->data, frame->h, frame->w, resized_image->w, 0, IMAGE_RESIZE_MEAN);
+        return;
+    }
+    if (IMAGE_PIXEL_YUV422 == frame->format && frame->stride == frame->w * 2)
+    {
+        Image<qtp_t>::resize_to_rgb888(resized_image->item, 0, resized_image->h, 0, resized_image->w, resized_image->c, frame->data, IMAGE_YUV_YUYV, frame->h, frame->w, resized_image->w, 0, IMAGE_RESIZE_MEAN);
+        return;
+    }
+
+    int count = resized_image->w * resized_image->h * 3;
+    uint8_t *rgb = (uint8_t *)dl_lib_malloc(count, sizeof(uint8_t), 0);
+    if (NULL == rgb)
+    {
+        memset(resized_image->item, 0, count * sizeof(qtp_t));
+        return;
+    }
+    image_frame_resize(rgb, resized_image->w, resized_image->h, frame, 0, 0, frame->w, frame->h);
+    for (int i = 0; i < count; i++)
+        resized_image->item[i] = rgb[i];
+    dl_lib_free(rgb);
 }
 
-box_array_t *detect_object(dl_matrix3du_t *image, detection_model_t *model)
+/*
+ * Resize the image, run the net and decode the boxes of every enabled stage
+ * into origin_head, moved by (x, y). Returns the number of boxes.
+ */
+static int __get_candidates(const image_frame_t *image, detection_model_t *model, detection_model_config_t *model_config, int x, int y, image_list_t **origin_head)
 {
     // resize image
-    dl_matrix3dq_t *resized_image = dl_matrix3dq_alloc(1, model->model_config.resized_width, model->model_config.resized_height, image->c, 0);
-    Image<qtp_t>::resize_to_rgb888(resized_image->item, 0, resized_image->h, 0, resized_image->w, resized_image->c, image->item, image->h, image->w, resized_image->w, 0, IMAGE_RESIZE_MEAN);
+    dl_matrix3dq_t *resized_image = dl_matrix3dq_alloc(1, model_config->resized_width, model_config->resized_height, 3, 0);
+    __resize_frame(resized_image, image);
 
     // net operation
-    detection_stage_result_t *stage_result = model->op(resized_image, &model->model_config);
+    detection_stage_result_t *stage_result = model->op(resized_image, model_config);
 
     // filter by score
-    image_list_t **origin_head = (image_list_t **)dl_lib_calloc(model->model_config.enabled_top_k, sizeof(image_list_t *), 0);
-    image_list_t all_box_list = {NULL, NULL, 0};
-    for (size_t i = 0; i < model->model_config.enabled_top_k; i++)
+    int box_number = 0;
+    for (size_t i = 0; i < model_config->enabled_top_k; i++)
     {
-        origin_head[i] = (image_list_t *)model->get_boxes(stage_result, &model->model_config, model->stage_config, i);
+        origin_head[i] = (image_list_t *)model->get_boxes(stage_result, model_config, model->stage_config, i);
 
         if (origin_head[i])
-            image_sort_insert_by_score(&all_box_list, origin_head[i]);
+        {
+            box_number += origin_head[i]->len;
+            for (image_box_t *t = (x || y) ? origin_head[i]->head : NULL; t; t = t->next)
+            {
+                t->box.box_p[0] += x;
+                t->box.box_p[1] += y;
+                t->box.box_p[2] += x;
+                t->box.box_p[3] += y;
+#if CONFIG_DETECT_WITH_LANDMARK
+                for (int k = 0; k < LANDMARKS_NUM; k += 2)
+                {
+                    t->landmark.landmark_p[k] += x;
+                    t->landmark.landmark_p[k + 1] += y;
+                }
+#endif
+            }
+        }
 
         free_detection_stage_result(stage_result[i]);
     }
     dl_lib_free(stage_result);
 
-    // nms
-    image_nms_process(&all_box_list, model->model_config.nms_threshold, false);
+    return box_number;
+}
+
+/*
+ * Sort and suppress the boxes of all lists together, then free the lists.
+ */
+static box_array_t *__nms_candidates(image_list_t **origin_head, int head_number, int box_number, const image_nms_config_t *nms_config)
+{
+    // sort and nms, the boxes of every stage go into one buffer
+    image_nms_boxes_t *boxes = NULL;
+    image_box_t **nodes = NULL;
+    if (box_number)
+    {
+        boxes = image_nms_boxes_alloc(box_number);
+        nodes = (image_box_t **)dl_lib_malloc(box_number, sizeof(image_box_t *), 0);
+    }
+    if (boxes && nodes)
+    {
+        int n = 0;
+        for (int i = 0; i < head_number; i++)
+        {
+            for (image_box_t *t = origin_head[i] ? origin_head[i]->head : NULL; t; t = t->next, n++)
+            {
+                nodes[n] = t;
+                image_nms_boxes_push(boxes, &t->box, t->score, t->category, n);
+            }
+        }
+        image_nms_boxes_sort(boxes);
+        image_nms_boxes_process(boxes, nms_config);
+    }
 
     // build up result
     box_array_t *targets_list = NULL;
-    if (all_box_list.len)
+    if (boxes && nodes && boxes->len)
     {
         targets_list = (box_array_t *)dl_lib_calloc(1, sizeof(box_array_t), 0);
-        targets_list->len = all_box_list.len;
+        targets_list->len = boxes->len;
         targets_list->category = (uint8_t *)dl_lib_calloc(targets_list->len, sizeof(uint8_t), 0);
         targets_list->score = (fptp_t *)dl_lib_calloc(targets_list->len, sizeof(fptp_t), 0);
         targets_list->box = (box_t *)dl_lib_calloc(targets_list->len, sizeof(box_t), 0);
@@ -288,19 +474,21 @@ box_array_t *detect_object(dl_matrix3du_t *image, detection_model_t *model)
         targets_list->landmark = (landmark_t *)dl_lib_calloc(targets_list->len, sizeof(landmark_t), 0);
 #endif
 
-        image_box_t *t = all_box_list.head;
-        for (int i = 0; i < all_box_list.len; i++, t = t->next)
+        for (int i = 0; i < boxes->len; i++)
         {
+            image_box_t *t = nodes[boxes->index[i]];
             targets_list->category[i] = t->category;
-            targets_list->score[i] = t->score;
+            targets_list->score[i] = boxes->score[i];
             targets_list->box[i] = t->box;
 #if CONFIG_DETECT_WITH_LANDMARK
             targets_list->landmark[i] = t->landmark;
 #endif
         }
     }
+    image_nms_boxes_free(boxes);
+    dl_lib_free(nodes);
 
-    for (int i = 0; i < model->model_config.enabled_top_k; i++)
+    for (int i = 0; i < head_number; i++)
     {
         if (origin_head[i])
         {
@@ -308,7 +496,102 @@ box_array_t *detect_object(dl_matrix3du_t *image, detection_model_t *model)
             dl_lib_free(origin_head[i]);
         }
     }
+
+    return targets_list;
+}
+
+box_array_t *detect_object_frame(const image_frame_t *frame, detection_model_t *model, const image_nms_config_t *nms_config)
+{
+    if (nms_config && image_nms_config_check(nms_config) < 0)
+    {
+        printf("Invalid NMS config, sigma must be > 0 for IMAGE_NMS_SOFT_GAUSSIAN\n");
+        return NULL;
+    }
+
+    image_nms_config_t hard_nms = {IMAGE_NMS_HARD, model->model_config.nms_threshold};
+    if (NULL == nms_config)
+        nms_config = &hard_nms;
+
+    image_list_t **origin_head = (image_list_t **)dl_lib_calloc(model->model_config.enabled_top_k, sizeof(image_list_t *), 0);
+    int box_number = __get_candidates(frame, model, &model->model_config, 0, 0, origin_head);
+    box_array_t *targets_list = __nms_candidates(origin_head, model->model_config.enabled_top_k, box_number, nms_config);
+    dl_lib_free(origin_head);
+
+    return targets_list;
+}
+
+box_array_t *detect_object_with_nms(dl_matrix3du_t *image, detection_model_t *model, const image_nms_config_t *nms_config)
+{
+    image_frame_t frame = image_frame(image->item, image->w, image->h, IMAGE_PIXEL_RGB888);
+    return detect_object_frame(&frame, model, nms_config);
+}
+
+box_array_t *detect_object_roi(dl_matrix3du_t *image, detection_model_t *model, const box_t *rois, int roi_number, const image_nms_config_t *nms_config)
+{
+    if (NULL == rois)
+        return detect_object_with_nms(image, model, nms_config);
+    if (roi_number <= 0)
+        return NULL;
+    if (nms_config && image_nms_config_check(nms_config) < 0)
+    {
+        printf("Invalid NMS config, sigma must be > 0 for IMAGE_NMS_SOFT_GAUSSIAN\n");
+        return NULL;
+    }
+
+    image_nms_config_t hard_nms = {IMAGE_NMS_HARD, model->model_config.nms_threshold};
+    if (NULL == nms_config)
+        nms_config = &hard_nms;
+
+    // the smallest region the first stage still runs on
+    fptp_t x_resize_scale = model->model_config.x_resize_scale;
+    fptp_t y_resize_scale = model->model_config.y_resize_scale;
+    int min_side = ceil(model->stage_config[0].boundary * max(x_resize_scale, y_resize_scale));
+
+    box_t *regions = (box_t *)dl_lib_malloc(roi_number, sizeof(box_t), 0);
+    image_list_t **origin_head = (image_list_t **)dl_lib_calloc(roi_number * model->stage_number, sizeof(image_list_t *), 0);
+    if (NULL == regions || NULL == origin_head)
+    {
+        dl_lib_free(regions);
+        dl_lib_free(origin_head);
+        return NULL;
+    }
+    int region_number = image_rois_merge(regions, rois, roi_number, min_side, image->w, image->h);
+
+    // each region is resized by the scale of the whole image
+    int box_number = 0;
+    for (int i = 0; i < region_number; i++)
+    {
+        int x = regions[i].box_p[0];
+        int y = regions[i].box_p[1];
+        int w = regions[i].box_p[2] - x + 1;
+        int h = regions[i].box_p[3] - y + 1;
+
+        detection_model_config_t model_config = model->model_config;
+        model_config.resized_height = max(1, (int)round(h / y_resize_scale));
+        model_config.resized_width = max(1, (int)round(w / x_resize_scale));
+        model_config.y_resize_scale = (fptp_t)h / (fptp_t)model_config.resized_height;
+        model_config.x_resize_scale = (fptp_t)w / (fptp_t)model_config.resized_width;
+        model_config.enabled_top_k = __get_enabled_top_k(model, min(model_config.resized_height, model_config.resized_width));
+        if (0 == model_config.enabled_top_k)
+            continue;
+
+        dl_matrix3du_t *region = dl_matrix3du_alloc(1, w, h, image->c);
+        if (NULL == region)
+            continue;
+        dl_matrix3du_slice_copy(region, image, x, y, w, h);
+        image_frame_t frame = image_frame(region->item, w, h, IMAGE_PIXEL_RGB888);
+        box_number += __get_candidates(&frame, model, &model_config, x, y, origin_head + i * model->stage_number);
+        dl_matrix3du_free(region);
+    }
+
+    box_array_t *targets_list = __nms_candidates(origin_head, region_number * model->stage_number, box_number, nms_config);
     dl_lib_free(origin_head);
+    dl_lib_free(regions);
 
     return targets_list;
 }
+
+box_array_t *detect_object(dl_matrix3du_t *image, detection_model_t *model)
+{
+    return detect_object_with_nms(image, model, NULL);
+}
@@ -0,0 +1,153 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Gaussian soft NMS rejects sigma <= 0 instead of producing NaN scores, and decays
+ * probabilities, also when the net scores its boxes with negative logits.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "image_util.h"
+#include "object_detection.h"
+
+#define CHECK(x)                                                      \
+    do                                                                \
+    {                                                                 \
+        if (!(x))                                                     \
+        {                                                             \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            return 1;                                                 \
+        }                                                             \
+    } while (0)
+
+/*
+ * Part of the prebuilt detection library, which the host build does not link.
+ */
+void free_detection_stage_result(detection_stage_result_t value)
+{
+    dl_matrix3dq_free(value.score);
+    dl_matrix3dq_free(value.box_offset);
+}
+
+#define LOGIT_EXPONENT -10
+
+/*
+ * One anchor point stage with a 4x4 map: cells 0 and 1 hold 12x12 boxes that overlap
+ * with logits -1 and -1.2, every other cell a 2x2 box with logit -8.
+ */
+static detection_stage_result_t *negative_logit_op(dl_matrix3dq_t *image, detection_model_config_t *config)
+{
+    dl_matrix3dq_free(image);
+    detection_stage_result_t *stage = (detection_stage_result_t *)dl_lib_calloc(1, sizeof(detection_stage_result_t), 0);
+    stage->score = dl_matrix3dq_alloc(1, 4, 4, 1, LOGIT_EXPONENT);
+    stage->box_offset = dl_matrix3dq_alloc(1, 4, 4, 4, LOGIT_EXPONENT);
+    for (int i = 0; i < 16; i++)
+        stage->score->item[i] = -8 << -LOGIT_EXPONENT;
+    stage->score->item[0] = -1 << -LOGIT_EXPONENT;
+    stage->score->item[1] = -1.2 * (1 << -LOGIT_EXPONENT);
+    // half a side of log(6), the box is center -+ 6
+    for (int i = 0; i < 8; i++)
+        stage->box_offset->item[i] = log(6) * (1 << -LOGIT_EXPONENT);
+    return stage;
+}
+
+static fptp_t sigmoid(fptp_t x)
+{
+    return 1 / (1 + exp(-x));
+}
+
+int main(void)
+{
+    image_nms_config_t config = {IMAGE_NMS_SOFT_GAUSSIAN, 0.5, 0.5, 0.1, false, 0};
+    CHECK(0 == image_nms_config_check(&config));
+    config.sigma = 0;
+    CHECK(image_nms_config_check(&config) < 0);
+    config.sigma = -0.5;
+    CHECK(image_nms_config_check(&config) < 0);
+    config.sigma = NAN;
+    CHECK(image_nms_config_check(&config) < 0);
+
+    // sigma is only read by the gaussian mode
+    config.mode = IMAGE_NMS_HARD;
+    CHECK(0 == image_nms_config_check(&config));
+    config.mode = IMAGE_NMS_SOFT_LINEAR;
+    CHECK(0 == image_nms_config_check(&config));
+    config.mode = (image_nms_mode_t)7;
+    CHECK(image_nms_config_check(&config) < 0);
+
+    // detect_object rejects the config before touching the image or the model
+    config.mode = IMAGE_NMS_SOFT_GAUSSIAN;
+    config.sigma = 0;
+    detection_model_t model;
+    memset(&model, 0, sizeof(model));
+    dl_matrix3du_t *image = dl_matrix3du_alloc(1, 32, 32, 3);
+    CHECK(image);
+    CHECK(NULL == detect_object_with_nms(image, &model, &config));
+    box_t roi = {{0, 0, 31, 31}};
+    CHECK(NULL == detect_object_roi(image, &model, &roi, 1, &config));
+    dl_matrix3du_free(image);
+
+    // a valid sigma decays the overlapping box and keeps the score finite
+    config.sigma = 0.5;
+    image_nms_boxes_t *boxes = image_nms_boxes_alloc(2);
+    CHECK(boxes);
+    box_t a = {{0, 0, 9, 9}};
+    box_t b = {{1, 0, 10, 9}};
+    image_nms_boxes_push(boxes, &a, 0.9, 0, 0);
+    image_nms_boxes_push(boxes, &b, 0.8, 0, 1);
+    image_nms_boxes_sort(boxes);
+    image_nms_boxes_process(boxes, &config);
+    CHECK(2 == boxes->len);
+    CHECK(isfinite(boxes->score[1]) && boxes->score[1] > 0 && boxes->score[1] < 0.8f);
+    image_nms_boxes_free(boxes);
+
+    // the candidates of a net that scores below 0.5 are decayed as probabilities
+    int *anchors[1] = {NULL};
+    detection_stage_config_t stage_config = {anchors, 8, 16, 4};
+    model.stage_config = &stage_config;
+    model.stage_number = 1;
+    model.model_type = Anchor_Point;
+    model.op = negative_logit_op;
+    update_detection_model(&model, 1, 0, 0.5, 32, 32);
+    image = dl_matrix3du_alloc(1, 32, 32, 3);
+    CHECK(image);
+    config.score_threshold = 0.01;
+    box_array_t *targets = detect_object_with_nms(image, &model, &config);
+    dl_matrix3du_free(image);
+    CHECK(targets && 2 == targets->len);
+    CHECK(fabsf(targets->score[0] - sigmoid(-1)) < 1e-3);
+    CHECK(targets->score[1] > config.score_threshold && targets->score[1] < sigmoid(-1.2) - 1e-3);
+    CHECK(fabsf(targets->box[0].box_p[0] + 2) < 0.2f && fabsf(targets->box[1].box_p[0] - 6) < 0.2f);
+    dl_lib_free(targets->category);
+    dl_lib_free(targets->score);
+    dl_lib_free(targets->box);
+#if CONFIG_DETECT_WITH_LANDMARK
+    dl_lib_free(targets->landmark);
+#endif
+    dl_lib_free(targets);
+
+    printf("nms_config: ok\n");
+    return 0;
+}
@@ -144,7 +144,8 @@ extern "C"
      * @param image              Image matrix, rgb888 format
      * @param od_boxes           The output of the hand detection network
      * @param target_size        The input size of hand pose estimation network
-     * @return dl_matrix3d_t*    The coordinates of 21 landmarks on the input image for each hand, size (n, 1, 21, 2)
+     * @return dl_matrix3d_t*    The coordinates of 21 landmarks on the input image for each hand, size (n, 1, 21, 2).
+     *                           The landmarks of a box that can not be cropped are 0, NULL if out of memory
      */
     dl_matrix3d_t *handpose_estimation_forward(dl_matrix3du_t *image, od_box_array_t *od_boxes, int target_size);
 
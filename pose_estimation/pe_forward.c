@@ -35,57 +35,60 @@
 
 #define HD_LITE_FEATURE_MAP_NUM 1
 
-void od_image_sort_insert_by_score(od_image_list_t *image_sorted_list, const od_image_list_t *insert_list)
+static od_image_box_t *od_image_merge_by_score(od_image_box_t *a, od_image_box_t *b)
 { /*{{{*/
-    if (insert_list == NULL || insert_list->head == NULL)
-        return;
-    od_image_box_t *box = insert_list->head;
-    if (NULL == image_sorted_list->head)
+    // On equal scores the boxes of a come first
+    od_image_box_t *head = NULL;
+    od_image_box_t **tail = &head;
+    while (a && b)
     {
-        image_sorted_list->head = insert_list->head;
-        box = insert_list->head->next;
-        image_sorted_list->head->next = NULL;
-    }
-    od_image_box_t *head = image_sorted_list->head;
-
-    while (box)
-    {
-        // insert in head
-        if (box->score > head->score)
+        if (b->score > a->score)
         {
-            od_image_box_t *tmp = box;
-            box = box->next;
-            tmp->next = head;
-            head = tmp;
+            *tail = b;
+            b = b->next;
         }
         else
         {
-            od_image_box_t *curr = head->next;
-            od_image_box_t *prev = head;
-            while (curr)
-            {
-                if (box->score > curr->score)
-                {
-                    od_image_box_t *tmp = box;
-                    box = box->next;
-                    tmp->next = curr;
-                    prev->next = tmp;
-                    break;
-                }
-                prev = curr;
-                curr = curr->next;
-            }
-            // insert in tail
-            if (NULL == curr)
-            {
-                od_image_box_t *tmp = box;
-                box = box->next;
-                tmp->next = NULL;
-                prev->next = tmp;
-            }
+            *tail = a;
+            a = a->next;
         }
+        tail = &((*tail)->next);
     }
-    image_sorted_list->head = head;
+    *tail = a ? a : b;
+    return head;
+} /*}}}*/
+
+static od_image_box_t *od_image_sort_by_score(od_image_box_t *list)
+{ /*{{{*/
+    // Bottom-up merge sort, runs[i] is a sorted run of 2^i boxes
+    od_image_box_t *runs[32] = {NULL};
+    while (list)
+    {
+        od_image_box_t *run = list;
+        list = list->next;
+        run->next = NULL;
+
+        int i = 0;
+        for (; runs[i]; i++)
+        {
+            run = od_image_merge_by_score(runs[i], run);
+            runs[i] = NULL;
+        }
+        runs[i] = run;
+    }
+
+    od_image_box_t *sorted = NULL;
+    for (int i = 0; i < 32; i++)
+        sorted = od_image_merge_by_score(runs[i], sorted);
+    return sorted;
+} /*}}}*/
+
+void od_image_sort_insert_by_score(od_image_list_t *image_sorted_list, const od_image_list_t *insert_list)
+{ /*{{{*/
+    if (insert_list == NULL || insert_list->head == NULL)
+        return;
+    od_image_box_t *sorted = od_image_sort_by_score(insert_list->head);
+    image_sorted_list->head = od_image_merge_by_score(image_sorted_list->head, sorted);
     image_sorted_list->len += insert_list->len;
 } /*}}}*/
 
@@ -163,57 +166,41 @@ od_image_list_t *od_image_get_valid_boxes(fptp_t *score,
 
 void od_image_nms_process(od_image_list_t *image_list, fptp_t nms_threshold)
 { /*{{{*/
-    /**** Init ****/
-    int num_supressed = 0;
-    od_image_box_t *head = image_list->head;
-
-    /**** Compute Box Area ****/
-    fptp_t kept_box_area = 0;
-    fptp_t other_box_area = 0;
+    int n = 0;
+    for (od_image_box_t *box = image_list->head; box; box = box->next)
+        n++;
+    if (n < 2)
+        return;
 
-    /**** Compare IOU ****/
-    od_image_box_t *kept_box = head;
-    while (kept_box)
+    image_nms_boxes_t *boxes = image_nms_boxes_alloc(n);
+    od_image_box_t **nodes = (od_image_box_t **)dl_lib_malloc(n, sizeof(od_image_box_t *), 0);
+    if (NULL == boxes || NULL == nodes)
     {
-        od_image_box_t *other_box = kept_box->next;
-        od_image_box_t *prev = kept_box;
-        while (other_box)
-        {
-
-            box_t inter_box;
-            inter_box.box_p[0] = DL_IMAGE_MAX(kept_box->box.box_p[0], other_box->box.box_p[0]);
-            inter_box.box_p[1] = DL_IMAGE_MAX(kept_box->box.box_p[1], other_box->box.box_p[1]);
-            inter_box.box_p[2] = DL_IMAGE_MIN(kept_box->box.box_p[2], other_box->box.box_p[2]);
-            inter_box.box_p[3] = DL_IMAGE_MIN(kept_box->box.box_p[3], other_box->box.box_p[3]);
-
-            fptp_t inter_w, inter_h;
-            image_get_width_and_height(&inter_box, &inter_w, &inter_h);
+        // Out of memory, the boxes are left unsuppressed
+        image_nms_boxes_free(boxes);
+        dl_lib_free(nodes);
+        return;
+    }
 
-            if (inter_w > 0 && inter_h > 0)
-            {
+    int i = 0;
+    for (od_image_box_t *box = image_list->head; box; box = box->next, i++)
+    {
+        nodes[i] = box;
+        image_nms_boxes_push(boxes, &box->box, box->score, box->cls, i);
+    }
 
-                image_get_area(&(kept_box->box), &kept_box_area);
-                image_get_area(&(other_box->box), &other_box_area);
+    image_nms_config_t config = {IMAGE_NMS_HARD, nms_threshold};
+    image_nms_boxes_process(boxes, &config);
 
-                fptp_t inter_area = inter_w * inter_h;
-                fptp_t iou = inter_area / (kept_box_area + other_box_area - inter_area);
-                if (iou > nms_threshold)
-                {
-                    num_supressed++;
-                    // Delete duplicated box
-                    // Here we cannot free a single box, because these boxes are allocated by calloc, we need to free all the calloced memory together.
-                    prev->next = other_box->next;
-                    other_box = other_box->next;
-                    continue;
-                }
-            }
-            prev = other_box;
-            other_box = other_box->next;
-        }
-        kept_box = kept_box->next;
-    }
+    // Relink the kept boxes, they are still in score order
+    for (i = 0; i < boxes->len - 1; i++)
+        nodes[boxes->index[i]]->next = nodes[boxes->index[i + 1]];
+    nodes[boxes->index[boxes->len - 1]]->next = NULL;
+    image_list->head = nodes[boxes->index[0]];
+    image_list->len -= n - boxes->len;
 
-    image_list->len -= num_supressed;
+    image_nms_boxes_free(boxes);
+    dl_lib_free(nodes);
 } /*}}}*/
 
 
@@ -323,32 +310,13 @@ od_box_array_t *hand_detection_forward(dl_matrix3du_t *image, hd_config_t hd_con
     return targets_list;
 }
 
-static inline dl_matrix3dq_t *dl_matrix3dq_from_3du(dl_matrix3du_t *m, int exponent, int shift_offset)
-{
-    dl_matrix3dq_t *out = dl_matrix3dq_alloc(m->n, m->w, m->h, m->c, exponent);
-    qtp_t *o_item = out->item;
-    uint8_t *m_item = m->item;
-    int shift = (-exponent)-shift_offset;
-    int count=(m->n)*(m->w)*(m->h)*(m->c);
-    if(shift>=0){
-        for(int i=0;i<count;i++){
-            *o_item++ = ((qtp_t)(*(m_item++)))<<shift;
-        }
-    }else{
-        shift = -shift;
-        for(int i=0;i<count;i++){
-            *o_item++ = ((qtp_t)(*(m_item++)))>>shift;
-        }
-    }
-    return out;
-    
-}
-
 
 dl_matrix3d_t *handpose_estimation_forward(dl_matrix3du_t *image, od_box_array_t *od_boxes, int target_size)
 {
     int landmark_num = 21;
     dl_matrix3d_t *landmarks = dl_matrix3d_alloc(od_boxes->len, 1, landmark_num, 2);
+    if (NULL == landmarks)
+        return NULL;
     float dilat_ratio = 1.2;
     int hp_exponent = INPUT_EXPONENT;
     int shift_offset = 8;
@@ -393,12 +361,19 @@ dl_matrix3d_t *handpose_estimation_forward(dl_matrix3du_t *image, od_box_array_t
         float srcy[3] = {y1, y2, y1};
         float dstx[3] = {dw, dw+target_w, dw+target_w};
         float dsty[3] = {dh, dh+target_h, dh};
-        Matrix *M = get_affine_transform(srcx, srcy, dstx, dsty);
-        dl_matrix3du_t *hp_input_image_u = dl_matrix3du_alloc(1, target_size, target_size, image->c);
-        warp_affine(image, hp_input_image_u, M);
-        matrix_free(M);
-        dl_matrix3dq_t *hp_input_image = dl_matrix3dq_from_3du(hp_input_image_u, hp_exponent, shift_offset);
-        dl_matrix3du_free(hp_input_image_u);
+        // the net frees its input, so each crop is warped and quantized straight into its own
+        dl_matrix3dq_t *hp_input_image = dl_matrix3dq_alloc(1, target_size, target_size, image->c, hp_exponent);
+        if(NULL == hp_input_image){
+            dl_matrix3d_free(landmarks);
+            return NULL;
+        }
+        // a degenerate box can not be warped, its landmarks are left 0
+        image_affine_t M;
+        if(image_affine_transform(&M, srcx, srcy, dstx, dsty, 3) < 0 ||
+           image_warp_affine_batch_q(hp_input_image->item, target_size, target_size, image, &M, 1, (-hp_exponent) - shift_offset) < 0){
+            dl_matrix3dq_free(hp_input_image);
+            continue;
+        }
 #if CONFIG_XTENSA_IMPL
     #if CONFIG_HD_LITE1
         dl_matrix3d_t *landmark = hp_lite1_q(hp_input_image, DL_XTENSA_IMPL);
@@ -412,6 +387,8 @@ dl_matrix3d_t *handpose_estimation_forward(dl_matrix3du_t *image, od_box_array_t
         dl_matrix3d_t *landmark = hp_nano1_ls16_q(hp_input_image, DL_C_IMPL);
     #endif
 #endif
+        if(NULL == landmark)
+            continue;
         for(int j=0; j<landmark_num; j++){
             landmarks->item[i*(landmark_num*2)+j*2] = (landmark->item[j*2])/scale + x1;
             landmarks->item[i*(landmark_num*2)+j*2+1] = landmark->item[j*2+1]/scale + y1;
@@ -0,0 +1,582 @@
+"""
+Generate a forward function specialized for one model.
+
+The layers are listed in MODEL. Their coefficients are the .npy files in weights/,
+the same ones that are written to output/cnn.h. The generated function:
+
+- has every shape as a constant, so the compiler can unroll the inner loops,
+- keeps the activations in two static buffers, so it never allocates,
+- does conv, bias, relu and max pooling of a layer in one pass, the pooled
+  output is computed straight from the input, without the full conv output.
+
+Run `python3 model_codegen.py` in the tutorial directory, or call generate()
+from the notebook, then include output/cnn_forward.h after output/cnn.h.
+
+`python3 model_codegen.py -q 2.npy ...` also writes the quantized model:
+output/cnn_q.h holds the coefficients as int16 dl_matrix3dq_t, and
+output/cnn_q_forward.h the same forward in integers, with the exponent of every
+activation calibrated on the sample inputs and shifted and noisy copies of them.
+The sums are int32, each kernel keeps as many bits as that allows for any input.
+It then compiles both forwards on the host and reports how far the quantized
+output is from the float one. test/main/app_main.c runs both on the ESP32.
+"""
+import argparse
+import os
+import subprocess
+import tempfile
+
+import numpy as np
+
+# Each conv is followed by relu and max pooling, each dense by relu, except the last.
+MODEL = [
+    {'type': 'conv', 'name': 'conv2d', 'stride': 1, 'padding': 'same', 'relu': True, 'pool': 2},
+    {'type': 'conv', 'name': 'conv2d_1', 'stride': 1, 'padding': 'same', 'relu': True, 'pool': 2},
+    {'type': 'conv', 'name': 'conv2d_2', 'stride': 1, 'padding': 'same', 'relu': True, 'pool': 2},
+    {'type': 'dense', 'name': 'dense', 'relu': True},
+    {'type': 'dense', 'name': 'dense_1', 'relu': False},
+]
+INPUT_SHAPE = (28, 28, 1)  # h, w, c
+
+
+def conv_output_size(size, kernel, stride, padding):
+    """Output size and the padding before the first pixel, like keras."""
+    if padding == 'same':
+        out = (size + stride - 1) // stride
+        pad = max((out - 1) * stride + kernel - size, 0) // 2
+    else:
+        out = (size - kernel) // stride + 1
+        pad = 0
+    return out, pad
+
+
+def plan(model, input_shape, weights_dir='weights'):
+    """Shapes of every layer, from the shapes of the coefficients."""
+    layers = []
+    shape = tuple(input_shape)
+    for layer in model:
+        kernel = np.load(os.path.join(weights_dir, layer['name'] + '_kernel.npy'))
+        l = dict(layer, input=shape)
+        if layer['type'] == 'conv':
+            (kh, kw, c, n) = kernel.shape
+            assert c == shape[2], f"{layer['name']}: {c} input channels, expected {shape[2]}"
+            pool = layer.get('pool', 1)
+            oh, pad_y = conv_output_size(shape[0], kh, layer['stride'], layer['padding'])
+            ow, pad_x = conv_output_size(shape[1], kw, layer['stride'], layer['padding'])
+            l.update(kernel=(kh, kw, c, n), pad=(pad_y, pad_x), conv=(oh, ow, n), pool=pool)
+            # max pooling with the stride equal to the window, the rest is dropped like PADDING_VALID
+            shape = (oh // pool, ow // pool, n)
+        else:
+            (size, n) = kernel.shape
+            assert size == shape[0] * shape[1] * shape[2], f"{layer['name']}: {size} inputs, expected {shape}"
+            shape = (1, 1, n)
+        l['output'] = shape
+        layers.append(l)
+    return layers
+
+
+class Writer:
+    def __init__(self):
+        self.lines = []
+        self.depth = 0
+
+    def __call__(self, line=''):
+        self.lines.append(('    ' * self.depth + line) if line else '')
+
+    def open(self, line):
+        self(line)
+        self('{')
+        self.depth += 1
+
+    def close(self):
+        self.depth -= 1
+        self('}')
+
+
+def emit_conv(w, l, src, dst):
+    (h, iw, c) = l['input']
+    (kh, kw, _, n) = l['kernel']
+    (pad_y, pad_x) = l['pad']
+    (oh, ow, _) = l['output']
+    s = l['stride']
+    p = l['pool']
+    kernel = l['name'] + '_kernel_item_array'
+    bias = l['name'] + '_bias_item_array'
+    w(f"// {l['name']}: {h}x{iw}x{c}, {kh}x{kw} {l['padding']} conv, bias"
+      + (", relu" if l['relu'] else "") + (f", {p}x{p} max pool" if p > 1 else "") + f" -> {oh}x{ow}x{n}")
+    w.open(f"for (int y = 0; y < {oh}; y++)")
+    w.open(f"for (int x = 0; x < {ow}; x++)")
+    w.open(f"for (int n = 0; n < {n}; n++)")
+    # relu after max pooling is a max with 0
+    w("fptp_t best = 0;" if l['relu'] else "fptp_t best = -FLT_MAX;")
+    w.open(f"for (int p = 0; p < {p * p}; p++)")
+    w(f"int oy = y * {p} + p / {p};")
+    w(f"int ox = x * {p} + p % {p};")
+    w(f"fptp_t sum = {bias}[n];")
+    w.open(f"for (int ky = 0; ky < {kh}; ky++)")
+    w(f"int iy = oy * {s} + ky - {pad_y};")
+    w(f"if (iy < 0 || iy >= {h})")
+    w("    continue;")
+    w.open(f"for (int kx = 0; kx < {kw}; kx++)")
+    w(f"int ix = ox * {s} + kx - {pad_x};")
+    w(f"if (ix < 0 || ix >= {iw})")
+    w("    continue;")
+    w(f"const fptp_t *in = {src} + (iy * {iw} + ix) * {c};")
+    w(f"const fptp_t *k = {kernel} + ((n * {kh} + ky) * {kw} + kx) * {c};")
+    w(f"for (int i = 0; i < {c}; i++)")
+    w("    sum += in[i] * k[i];")
+    w.close()
+    w.close()
+    w("if (sum > best)")
+    w("    best = sum;")
+    w.close()
+    w(f"{dst}[(y * {ow} + x) * {n} + n] = best;")
+    w.close()
+    w.close()
+    w.close()
+
+
+def emit_dense(w, l, src, dst):
+    size = l['input'][0] * l['input'][1] * l['input'][2]
+    n = l['output'][2]
+    kernel = l['name'] + '_kernel_item_array'
+    bias = l['name'] + '_bias_item_array'
+    w(f"// {l['name']}: {size} -> {n}" + (", relu" if l['relu'] else ""))
+    w.open(f"for (int n = 0; n < {n}; n++)")
+    w(f"const fptp_t *k = {kernel} + n * {size};")
+    w(f"fptp_t sum = {bias}[n];")
+    w(f"for (int i = 0; i < {size}; i++)")
+    w(f"    sum += {src}[i] * k[i];")
+    w(f"{dst}[n] = sum > 0 ? sum : 0;" if l['relu'] else f"{dst}[n] = sum;")
+    w.close()
+
+
+def load(layer, weights_dir='weights'):
+    """Kernel in the order of the generated code, and bias."""
+    kernel = np.load(os.path.join(weights_dir, layer['name'] + '_kernel.npy')).astype(np.float64)
+    bias = np.load(os.path.join(weights_dir, layer['name'] + '_bias.npy')).astype(np.float64)
+    if layer['type'] == 'conv':
+        kernel = kernel.transpose(3, 0, 1, 2)  # n, kh, kw, c
+    else:
+        kernel = kernel.T  # n, size
+    return kernel, bias
+
+
+def float_forward(layers, x, weights_dir='weights'):
+    """Output of every layer for one input, in numpy, the way the generated code computes it."""
+    outputs = []
+    for l in layers:
+        kernel, bias = load(l, weights_dir)
+        if l['type'] == 'conv':
+            (h, w, c) = l['input']
+            (kh, kw, _, n) = l['kernel']
+            (pad_y, pad_x) = l['pad']
+            (oh, ow, _) = l['conv']
+            s = l['stride']
+            padded = np.zeros((max(h + 2 * pad_y, (oh - 1) * s + kh), max(w + 2 * pad_x, (ow - 1) * s + kw), c))
+            padded[pad_y:pad_y + h, pad_x:pad_x + w] = x
+            conv = np.zeros((oh, ow, n)) + bias
+            for ky in range(kh):
+                for kx in range(kw):
+                    patch = padded[ky:ky + (oh - 1) * s + 1:s, kx:kx + (ow - 1) * s + 1:s]
+                    conv += patch @ kernel[:, ky, kx, :].T
+            p = l['pool']
+            (ph, pw, _) = l['output']
+            x = conv[:ph * p, :pw * p].reshape(ph, p, pw, p, n).max(axis=(1, 3))
+        else:
+            x = kernel @ x.reshape(-1) + bias
+            x = x.reshape(l['output'])
+        if l['relu']:
+            x = np.maximum(x, 0)
+        outputs.append(x)
+    return outputs
+
+
+def exponent_of(max_abs, limit=2**15 - 1):
+    """Smallest exponent with max_abs * 2^-exponent <= limit."""
+    exponent = 0
+    if max_abs > 0:
+        while max_abs * 2.0**(-exponent) > limit:
+            exponent += 1
+        while max_abs * 2.0**(-exponent + 1) <= limit:
+            exponent -= 1
+    return exponent
+
+
+def quantize(data, exponent):
+    return np.clip(np.round(data * 2.0**(-exponent)), -2**15, 2**15 - 1).astype(np.int16)
+
+
+def emit_q_array(f, name, data, shape, exponent):
+    """The same layout as the qtp_t output of the notebook."""
+    (n, h, w, c) = shape
+    item = f"const static qtp_t {name}_item_array[] = {{\n\t"
+    for i, d in enumerate(data.flat):
+        item += f"{d:d}, "
+        if (i + 1) % 8 == 0:
+            item += "\n\t"
+    item += "\n};\n\n"
+    f.write(item)
+    f.write(f"const static dl_matrix3dq_t {name} = {{\n"
+            f"\t.w = {w},\n\t.h = {h},\n\t.c = {c},\n\t.n = {n},\n\t.stride = {w * c},\n"
+            f"\t.exponent = {exponent},\n"
+            f"\t.item = (qtp_t *)(&{name}_item_array[0])\n}};\n\n")
+
+
+INT32_MAX = 2**31 - 1
+
+
+def shift_expression(value, shift):
+    """value * 2^-shift in int32, rounded. The caller checks that it fits."""
+    if shift > 0:
+        return f"(({value}) + (1 << {shift - 1})) >> {shift}"
+    if shift < 0:
+        return f"(int32_t)({value}) * {2**-shift}"
+    return f"(int32_t)({value})"
+
+
+def shifted(value, shift):
+    """What shift_expression computes, for the bounds."""
+    assert shift < 32
+    return (value + (1 << (shift - 1))) >> shift if shift > 0 else value * 2**-shift
+
+
+def accumulator_bound(l, kernel_q, bias_q, kernel_exponent):
+    """
+    Largest |sum| a layer can reach for any int16 input, so the whole layer can use int32. Every output
+    of a relu layer is >= 0, after that the positive and the negative kernel items are bounded apart.
+    """
+    e_sum = l['in_exponent'] + kernel_exponent
+    kernel_q = kernel_q.reshape(kernel_q.shape[0], -1).astype(np.int64)
+    bias = np.array([shifted(int(b), e_sum - l['bias_exponent']) for b in bias_q], dtype=np.int64)
+    if l['in_relu']:
+        high = bias + np.clip(kernel_q, 0, None).sum(axis=1) * (2**15 - 1)
+        low = bias + np.clip(kernel_q, None, 0).sum(axis=1) * (2**15 - 1)
+    else:
+        high = bias + np.abs(kernel_q).sum(axis=1) * 2**15
+        low = bias - np.abs(kernel_q).sum(axis=1) * 2**15
+    bound = int(max(high.max(), -low.min()))
+    # the rounding of the output shift is added to the sum, a left shift multiplies it
+    shift = l['out_exponent'] - e_sum
+    return bound + (1 << (shift - 1)) if shift > 0 else bound * 2**-shift
+
+
+def quantize_kernel(l, kernel, bias):
+    """
+    The kernel exponent that keeps the most bits while accumulator_bound fits int32. Sets the
+    exponents and the bound of l, returns the int16 kernel and bias.
+    """
+    l['bias_exponent'] = exponent_of(np.abs(bias).max())
+    bias_q = quantize(bias, l['bias_exponent'])
+    exponent = exponent_of(np.abs(kernel).max())
+    while True:
+        kernel_q = quantize(kernel, exponent)
+        bound = accumulator_bound(l, kernel_q, bias_q, exponent)
+        if bound <= INT32_MAX:
+            break
+        exponent += 1
+    l['kernel_exponent'] = exponent
+    l['kernel_bits'] = int(np.abs(kernel_q).max()).bit_length() + 1
+    l['bound'] = bound
+    return kernel_q, bias_q
+
+
+def emit_q_layer(w, l, src, dst, name):
+    kernel = l['name'] + '_kernel_q_item_array'
+    bias = l['name'] + '_bias_q_item_array'
+    # the sum is at exponent in + kernel, the bias is moved there, the result to the output exponent.
+    # accumulator_bound has checked that none of it overflows int32.
+    e_sum = l['in_exponent'] + l['kernel_exponent']
+    bias_term = shift_expression(f"{bias}[n]", e_sum - l['bias_exponent'])
+    result = f"{name}_q_saturate({shift_expression('best', l['out_exponent'] - e_sum)})"
+    if l['type'] == 'conv':
+        (h, iw, c) = l['input']
+        (kh, kw, _, n) = l['kernel']
+        (pad_y, pad_x) = l['pad']
+        (oh, ow, _) = l['output']
+        s = l['stride']
+        p = l['pool']
+        w(f"// {l['name']}: {h}x{iw}x{c}, {kh}x{kw} {l['padding']} conv, bias"
+          + (", relu" if l['relu'] else "") + (f", {p}x{p} max pool" if p > 1 else "") + f" -> {oh}x{ow}x{n}")
+        w(f"// {l['kernel_bits']}-bit kernel, |sum| <= {l['bound']}")
+        w.open(f"for (int y = 0; y < {oh}; y++)")
+        w.open(f"for (int x = 0; x < {ow}; x++)")
+        w.open(f"for (int n = 0; n < {n}; n++)")
+        w("int32_t best = 0;" if l['relu'] else "int32_t best = INT32_MIN;")
+        w.open(f"for (int p = 0; p < {p * p}; p++)")
+        w(f"int oy = y * {p} + p / {p};")
+        w(f"int ox = x * {p} + p % {p};")
+        w(f"int32_t sum = {bias_term};")
+        w.open(f"for (int ky = 0; ky < {kh}; ky++)")
+        w(f"int iy = oy * {s} + ky - {pad_y};")
+        w(f"if (iy < 0 || iy >= {h})")
+        w("    continue;")
+        w.open(f"for (int kx = 0; kx < {kw}; kx++)")
+        w(f"int ix = ox * {s} + kx - {pad_x};")
+        w(f"if (ix < 0 || ix >= {iw})")
+        w("    continue;")
+        w(f"const qtp_t *in = {src} + (iy * {iw} + ix) * {c};")
+        w(f"const qtp_t *k = {kernel} + ((n * {kh} + ky) * {kw} + kx) * {c};")
+        w(f"for (int i = 0; i < {c}; i++)")
+        w("    sum += in[i] * k[i];")
+        w.close()
+        w.close()
+        w("if (sum > best)")
+        w("    best = sum;")
+        w.close()
+        w(f"{dst}[(y * {ow} + x) * {n} + n] = {result};")
+        w.close()
+        w.close()
+        w.close()
+    else:
+        size = l['input'][0] * l['input'][1] * l['input'][2]
+        n = l['output'][2]
+        w(f"// {l['name']}: {size} -> {n}" + (", relu" if l['relu'] else ""))
+        w(f"// {l['kernel_bits']}-bit kernel, |sum| <= {l['bound']}")
+        w.open(f"for (int n = 0; n < {n}; n++)")
+        w(f"const qtp_t *k = {kernel} + n * {size};")
+        w(f"int32_t best = {bias_term};")
+        w(f"for (int i = 0; i < {size}; i++)")
+        w(f"    best += {src}[i] * k[i];")
+        if l['relu']:
+            w("if (best < 0)")
+            w("    best = 0;")
+        w(f"{dst}[n] = {result};")
+        w.close()
+
+
+def calibration_set(inputs, variants=16, seed=0):
+    """
+    The inputs, plus variants made from them in turn: shifted by up to 3 pixels, with gaussian noise,
+    or uniform noise. All in [0, 1].
+    """
+    rng = np.random.default_rng(seed)
+    samples = list(inputs)
+    for i in range(variants):
+        x = inputs[i % len(inputs)]
+        kind = i % 3
+        if kind == 0:
+            x = np.roll(x, tuple(rng.integers(-3, 4, size=2)), axis=(0, 1))
+        elif kind == 1:
+            x = np.clip(x + rng.normal(0, 0.1, x.shape), 0, 1)
+        else:
+            x = rng.uniform(0, 1, x.shape)
+        samples.append(x)
+    return samples
+
+
+def generate_quantized(samples, model=MODEL, input_shape=INPUT_SHAPE, name='cnn', weights_dir='weights',
+                       output_dir='output'):
+    """
+    Write {name}_q.h and {name}_q_forward.h. samples are float inputs of input_shape. Every activation
+    gets the exponent that fits the largest value seen on the samples with one bit to spare, larger
+    values saturate. Every kernel gets the exponent that keeps the sums in int32 for any input, the
+    ESP32 has no 64-bit multiply-accumulate.
+    """
+    layers = plan(model, input_shape, weights_dir)
+    NAME = name.upper()
+    max_abs = [0.0] * len(layers)
+    input_max = 0.0
+    for x in samples:
+        input_max = max(input_max, float(np.abs(x).max()))
+        for i, out in enumerate(float_forward(layers, x.reshape(input_shape), weights_dir)):
+            max_abs[i] = max(max_abs[i], float(np.abs(out).max()))
+
+    input_exponent = exponent_of(input_max)
+    e_in = input_exponent
+    with open(os.path.join(output_dir, f'{name}_q.h'), mode='w', encoding='utf-8') as f:
+        f.write('#pragma once\n#include "dl_lib_matrix3d.h"\n#include "dl_lib_matrix3dq.h"\n\n')
+        for i, l in enumerate(layers):
+            kernel, bias = load(l, weights_dir)
+            l['in_exponent'] = e_in
+            l['in_relu'] = i > 0 and layers[i - 1]['relu']
+            l['out_exponent'] = e_in = exponent_of(max_abs[i], (2**15 - 1) / 2)
+            kernel_q, bias_q = quantize_kernel(l, kernel, bias)
+            shape = (1, kernel.shape[0], kernel.shape[1], 1) if l['type'] == 'dense' else kernel.shape
+            emit_q_array(f, l['name'] + '_kernel_q', kernel_q, shape, l['kernel_exponent'])
+            emit_q_array(f, l['name'] + '_bias_q', bias_q, (1, 1, 1, len(bias)), l['bias_exponent'])
+
+    (ih, iw, ic) = layers[0]['input']
+    buffer_size = max(l['output'][0] * l['output'][1] * l['output'][2] for l in layers[:-1]) if len(layers) > 1 else 1
+    w = Writer()
+    w('#pragma once')
+    w('#include <stdint.h>')
+    w(f'#include "{name}_q.h"')
+    w()
+    w(f'// generated by model_codegen.py, exponents calibrated on {len(samples)} sample inputs')
+    w(f'#define {NAME}_Q_INPUT_H {ih}')
+    w(f'#define {NAME}_Q_INPUT_W {iw}')
+    w(f'#define {NAME}_Q_INPUT_C {ic}')
+    w(f'#define {NAME}_Q_INPUT_EXPONENT {input_exponent}')
+    w(f'#define {NAME}_Q_OUTPUT_SIZE {layers[-1]["output"][2]}')
+    w(f'#define {NAME}_Q_OUTPUT_EXPONENT {layers[-1]["out_exponent"]}')
+    w(f'#define {NAME}_Q_BUFFER_SIZE {buffer_size} /* largest activation between two layers */')
+    w()
+    w(f'static qtp_t {name}_q_buffer[2][{NAME}_Q_BUFFER_SIZE];')
+    w()
+    w.open(f'static inline qtp_t {name}_q_saturate(int32_t v)')
+    w('return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);')
+    w.close()
+    w()
+    w('/**')
+    w(f' * @brief Forward the model in 16-bit fixed point, see {name}_forward. A value q stands')
+    w(' *        for q * 2^exponent, the exponents of the activations are constants.')
+    w(' *')
+    w(f' * @param input     {NAME}_Q_INPUT_H x {NAME}_Q_INPUT_W x {NAME}_Q_INPUT_C, in hwc order, at {NAME}_Q_INPUT_EXPONENT')
+    w(f' * @param output    {NAME}_Q_OUTPUT_SIZE, at {NAME}_Q_OUTPUT_EXPONENT')
+    w(' */')
+    w.open(f'static void {name}_q_forward(const qtp_t *input, qtp_t *output)')
+    src = 'input'
+    for i, l in enumerate(layers):
+        dst = 'output' if i == len(layers) - 1 else f'{name}_q_buffer[{i % 2}]'
+        if i:
+            w()
+        emit_q_layer(w, l, src, dst, name)
+        src = dst
+    w.close()
+    with open(os.path.join(output_dir, f'{name}_q_forward.h'), mode='w', encoding='utf-8') as f:
+        f.write('\n'.join(w.lines) + '\n')
+    return layers
+
+
+REPORT_MAIN = r"""
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "%(name)s_forward.h"
+#include "%(name)s_q_forward.h"
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+    int count = atoi(argv[1]), repeat = atoi(argv[2]);
+    static fptp_t input[%(NAME)s_INPUT_H * %(NAME)s_INPUT_W * %(NAME)s_INPUT_C];
+    static qtp_t input_q[%(NAME)s_INPUT_H * %(NAME)s_INPUT_W * %(NAME)s_INPUT_C];
+    fptp_t output[%(NAME)s_OUTPUT_SIZE];
+    qtp_t output_q[%(NAME)s_OUTPUT_SIZE];
+    double float_time = 0, q_time = 0;
+    for (int s = 0; s < count; s++)
+    {
+        for (int i = 0; i < %(NAME)s_INPUT_H * %(NAME)s_INPUT_W * %(NAME)s_INPUT_C; i++)
+        {
+            if (scanf("%%f", &input[i]) != 1)
+                return 1;
+            float q = roundf(ldexpf(input[i], -(%(NAME)s_Q_INPUT_EXPONENT)));
+            input_q[i] = q > INT16_MAX ? INT16_MAX : (q < INT16_MIN ? INT16_MIN : q);
+        }
+        double t0 = now();
+        for (int r = 0; r < repeat; r++)
+            %(name)s_forward(input, output);
+        double t1 = now();
+        for (int r = 0; r < repeat; r++)
+            %(name)s_q_forward(input_q, output_q);
+        double t2 = now();
+        float_time += t1 - t0;
+        q_time += t2 - t1;
+        for (int i = 0; i < %(NAME)s_OUTPUT_SIZE; i++)
+            printf("%%g %%g ", output[i], ldexpf(output_q[i], %(NAME)s_Q_OUTPUT_EXPONENT));
+        printf("\n");
+    }
+    printf("%%g %%g\n", float_time / count / repeat, q_time / count / repeat);
+    return 0;
+}
+"""
+
+
+def report(samples, name='cnn', output_dir='output', repeat=20, cc='cc'):
+    """Compile the float and the quantized forward on the host, run both on samples and compare."""
+    here = os.path.dirname(os.path.abspath(__file__))
+    with tempfile.TemporaryDirectory() as tmp:
+        main = os.path.join(tmp, 'report.c')
+        with open(main, 'w') as f:
+            f.write(REPORT_MAIN % {'name': name, 'NAME': name.upper()})
+        binary = os.path.join(tmp, 'report')
+        subprocess.run([cc, '-O2', '-include', 'stdlib.h', '-I', os.path.abspath(output_dir),
+                        '-I', os.path.join(here, '..', 'lib', 'include'), main, '-o', binary, '-lm'], check=True)
+        text = '\n'.join(' '.join(f'{v:.9g}' for v in x.flat) for x in samples) + '\n'
+        result = subprocess.run([binary, str(len(samples)), str(repeat)], input=text, capture_output=True,
+                                text=True, check=True).stdout.split('\n')
+
+    outputs = np.array([[float(v) for v in line.split()] for line in result[:len(samples)]])
+    float_out, q_out = outputs[:, 0::2], outputs[:, 1::2]
+    float_time, q_time = (float(v) for v in result[len(samples)].split())
+    error = np.abs(float_out - q_out)
+    same = int((float_out.argmax(axis=1) == q_out.argmax(axis=1)).sum())
+    print(f'samples              {len(samples)}')
+    print(f'top-1 agreement      {same}/{len(samples)}')
+    print(f'max abs error        {error.max():.6f}')
+    print(f'mean abs error       {error.mean():.6f}')
+    print(f'max relative error   {error.max() / max(np.abs(float_out).max(), 1e-12):.6f}')
+    print(f'float forward        {float_time * 1e6:.1f} us')
+    print(f'quantized forward    {q_time * 1e6:.1f} us')
+    return {'agreement': same, 'max_error': float(error.max()), 'float_time': float_time, 'q_time': q_time}
+
+
+def generate(model=MODEL, input_shape=INPUT_SHAPE, name='cnn', weights_dir='weights', path='output/cnn_forward.h'):
+    layers = plan(model, input_shape, weights_dir)
+    NAME = name.upper()
+    (ih, iw, ic) = layers[0]['input']
+    output_size = layers[-1]['output'][2]
+    # the output of the last layer goes to the caller, the others alternate between two buffers
+    buffer_size = max(l['output'][0] * l['output'][1] * l['output'][2] for l in layers[:-1]) if len(layers) > 1 else 1
+
+    w = Writer()
+    w('#pragma once')
+    w('#include <float.h>')
+    w(f'#include "{name}.h"')
+    w()
+    w(f'// generated by model_codegen.py')
+    w(f'#define {NAME}_INPUT_H {ih}')
+    w(f'#define {NAME}_INPUT_W {iw}')
+    w(f'#define {NAME}_INPUT_C {ic}')
+    w(f'#define {NAME}_OUTPUT_SIZE {output_size}')
+    w(f'#define {NAME}_BUFFER_SIZE {buffer_size} /* largest activation between two layers */')
+    w()
+    w(f'static fptp_t {name}_buffer[2][{NAME}_BUFFER_SIZE];')
+    w()
+    w('/**')
+    w(' * @brief Forward the model. Nothing is allocated, the activations are kept in')
+    w(f' *        {name}_buffer, so only one forward can run at a time.')
+    w(' *')
+    w(f' * @param input     {NAME}_INPUT_H x {NAME}_INPUT_W x {NAME}_INPUT_C, in hwc order')
+    w(f' * @param output    {NAME}_OUTPUT_SIZE')
+    w(' */')
+    w.open(f'static void {name}_forward(const fptp_t *input, fptp_t *output)')
+    src = 'input'
+    for i, l in enumerate(layers):
+        dst = 'output' if i == len(layers) - 1 else f'{name}_buffer[{i % 2}]'
+        if i:
+            w()
+        if l['type'] == 'conv':
+            emit_conv(w, l, src, dst)
+        else:
+            emit_dense(w, l, src, dst)
+        src = dst
+    w.close()
+
+    with open(path, mode='w', encoding='utf-8') as f:
+        f.write('\n'.join(w.lines) + '\n')
+    return layers
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Generate the forward functions of MODEL.')
+    parser.add_argument('-q', '--quantize', nargs='+', metavar='NPY',
+                        help='uint8 sample inputs like 2.npy, to calibrate and check the quantized model')
+    parser.add_argument('--variants', type=int, default=16,
+                        help='shifted and noisy copies of the sample inputs added to the calibration set')
+    args = parser.parse_args()
+    for l in generate():
+        print(l['name'], l['input'], '->', l['output'])
+    if args.quantize:
+        # the same scaling as the input of the test app
+        samples = calibration_set([np.load(f).astype(np.float64) / 255.0 for f in args.quantize], args.variants)
+        for l in generate_quantized(samples):
+            print(l['name'], 'exponents: in', l['in_exponent'], 'kernel', l['kernel_exponent'],
+                  'bias', l['bias_exponent'], 'out', l['out_exponent'], f"{l['kernel_bits']}-bit kernel, |sum| <= {l['bound']}")
+        report(samples)
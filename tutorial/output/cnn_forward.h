@@ -0,0 +1,153 @@
+#pragma once
+#include <float.h>
+#include "cnn.h"
+
+// generated by model_codegen.py
+#define CNN_INPUT_H 28
+#define CNN_INPUT_W 28
+#define CNN_INPUT_C 1
+#define CNN_OUTPUT_SIZE 10
+#define CNN_BUFFER_SIZE 6272 /* largest activation between two layers */
+
+static fptp_t cnn_buffer[2][CNN_BUFFER_SIZE];
+
+/**
+ * @brief Forward the model. Nothing is allocated, the activations are kept in
+ *        cnn_buffer, so only one forward can run at a time.
+ *
+ * @param input     CNN_INPUT_H x CNN_INPUT_W x CNN_INPUT_C, in hwc order
+ * @param output    CNN_OUTPUT_SIZE
+ */
+static void cnn_forward(const fptp_t *input, fptp_t *output)
+{
+    // conv2d: 28x28x1, 5x5 same conv, bias, relu, 2x2 max pool -> 14x14x32
+    for (int y = 0; y < 14; y++)
+    {
+        for (int x = 0; x < 14; x++)
+        {
+            for (int n = 0; n < 32; n++)
+            {
+                fptp_t best = 0;
+                for (int p = 0; p < 4; p++)
+                {
+                    int oy = y * 2 + p / 2;
+                    int ox = x * 2 + p % 2;
+                    fptp_t sum = conv2d_bias_item_array[n];
+                    for (int ky = 0; ky < 5; ky++)
+                    {
+                        int iy = oy * 1 + ky - 2;
+                        if (iy < 0 || iy >= 28)
+                            continue;
+                        for (int kx = 0; kx < 5; kx++)
+                        {
+                            int ix = ox * 1 + kx - 2;
+                            if (ix < 0 || ix >= 28)
+                                continue;
+                            const fptp_t *in = input + (iy * 28 + ix) * 1;
+                            const fptp_t *k = conv2d_kernel_item_array + ((n * 5 + ky) * 5 + kx) * 1;
+                            for (int i = 0; i < 1; i++)
+                                sum += in[i] * k[i];
+                        }
+                    }
+                    if (sum > best)
+                        best = sum;
+                }
+                cnn_buffer[0][(y * 14 + x) * 32 + n] = best;
+            }
+        }
+    }
+
+    // conv2d_1: 14x14x32, 5x5 same conv, bias, relu, 2x2 max pool -> 7x7x64
+    for (int y = 0; y < 7; y++)
+    {
+        for (int x = 0; x < 7; x++)
+        {
+            for (int n = 0; n < 64; n++)
+            {
+                fptp_t best = 0;
+                for (int p = 0; p < 4; p++)
+                {
+                    int oy = y * 2 + p / 2;
+                    int ox = x * 2 + p % 2;
+                    fptp_t sum = conv2d_1_bias_item_array[n];
+                    for (int ky = 0; ky < 5; ky++)
+                    {
+                        int iy = oy * 1 + ky - 2;
+                        if (iy < 0 || iy >= 14)
+                            continue;
+                        for (int kx = 0; kx < 5; kx++)
+                        {
+                            int ix = ox * 1 + kx - 2;
+                            if (ix < 0 || ix >= 14)
+                                continue;
+                            const fptp_t *in = cnn_buffer[0] + (iy * 14 + ix) * 32;
+                            const fptp_t *k = conv2d_1_kernel_item_array + ((n * 5 + ky) * 5 + kx) * 32;
+                            for (int i = 0; i < 32; i++)
+                                sum += in[i] * k[i];
+                        }
+                    }
+                    if (sum > best)
+                        best = sum;
+                }
+                cnn_buffer[1][(y * 7 + x) * 64 + n] = best;
+            }
+        }
+    }
+
+    // conv2d_2: 7x7x64, 3x3 same conv, bias, relu, 2x2 max pool -> 3x3x64
+    for (int y = 0; y < 3; y++)
+    {
+        for (int x = 0; x < 3; x++)
+        {
+            for (int n = 0; n < 64; n++)
+            {
+                fptp_t best = 0;
+                for (int p = 0; p < 4; p++)
+                {
+                    int oy = y * 2 + p / 2;
+                    int ox = x * 2 + p % 2;
+                    fptp_t sum = conv2d_2_bias_item_array[n];
+                    for (int ky = 0; ky < 3; ky++)
+                    {
+                        int iy = oy * 1 + ky - 1;
+                        if (iy < 0 || iy >= 7)
+                            continue;
+                        for (int kx = 0; kx < 3; kx++)
+                        {
+                            int ix = ox * 1 + kx - 1;
+                            if (ix < 0 || ix >= 7)
+                                continue;
+                            const fptp_t *in = cnn_buffer[1] + (iy * 7 + ix) * 64;
+                            const fptp_t *k = conv2d_2_kernel_item_array + ((n * 3 + ky) * 3 + kx) * 64;
+                            for (int i = 0; i < 64; i++)
+                                sum += in[i] * k[i];
+                        }
+                    }
+                    if (sum > best)
+                        best = sum;
+                }
+                cnn_buffer[0][(y * 3 + x) * 64 + n] = best;
+            }
+        }
+    }
+
+    // dense: 576 -> 128, relu
+    for (int n = 0; n < 128; n++)
+    {
+        const fptp_t *k = dense_kernel_item_array + n * 576;
+        fptp_t sum = dense_bias_item_array[n];
+        for (int i = 0; i < 576; i++)
+            sum += cnn_buffer[0][i] * k[i];
+        cnn_buffer[1][n] = sum > 0 ? sum : 0;
+    }
+
+    // dense_1: 128 -> 10
+    for (int n = 0; n < 10; n++)
+    {
+        const fptp_t *k = dense_1_kernel_item_array + n * 128;
+        fptp_t sum = dense_1_bias_item_array[n];
+        for (int i = 0; i < 128; i++)
+            sum += cnn_buffer[1][i] * k[i];
+        output[n] = sum;
+    }
+}
@@ -0,0 +1,20665 @@
+#pragma once
+#include "dl_lib_matrix3d.h"
+#include "dl_lib_matrix3dq.h"
+
+const static qtp_t conv2d_kernel_q_item_array[] = {
+	-1945, -270, 849, -2194, 871, -1283, 1403, 573, 
+	352, 969, 1610, -1307, -514, 711, -1233, -589, 
+	-1411, 518, 294, -187, -2185, 702, 1819, -1066, 
+	-2336, 866, 1117, 58, 1376, -915, 336, 1185, 
+	-748, -1072, 942, -1311, 1106, 574, 619, 1572, 
+	-1169, 1668, -648, -1887, -25, 450, 925, -182, 
+	-542, -1713, -1234, -2217, -1079, 584, -654, -542, 
+	-505, 1662, 1294, 586, -1265, 1076, 12, 80, 
+	-567, 1333, -374, -610, -1202, -1525, -869, -1966, 
+	-65, -389, 99, 846, 1088, -2102, -1145, -868, 
+	2425, -101, -1306, -3203, 377, 2769, 534, -1017, 
+	-4869, 190, 2515, 1025, -1413, -2960, -598, 2241, 
+	3419, -544, 983, 429, -1319, -2306, -2114, 1339, 
+	-77, 1416, 2132, 2373, 685, -1262, 1524, -1041, 
+	-1707, -1443, 481, -2588, 348, 499, 1112, 107, 
+	209, 1270, -960, 466, -942, -424, -438, 918, 
+	733, 722, 459, -637, -991, -96, 1403, -2413, 
+	312, 443, 1330, 399, -1045, 650, 1111, 144, 
+	-156, 1336, 178, -307, 80, -133, 1268, -2126, 
+	-2425, -743, 1558, 347, -2676, -3215, -744, 2736, 
+	-1778, -3667, -1780, -999, 1358, -854, -1744, -2332, 
+	521, 2839, -1220, -748, -782, 628, 483, -561, 
+	-326, 438, -984, -1550, -1117, -208, 2654, -735, 
+	-4113, -626, 63, 2562, -1397, -1570, 118, 650, 
+	475, 2568, 1065, -783, 138, -755, 431, 1006, 
+	628, -1437, -2760, -986, -385, -1518, -4484, -2115, 
+	-848, 580, -3185, -2043, -700, 2015, 1612, -4114, 
+	306, 1740, 2425, 312, -425, 1262, 2000, 2020, 
+	-1475, -109, 1449, 2264, 3088, 1488, 951, -796, 
+	-113, -2826, -2653, -710, -1779, -5513, -3147, -633, 
+	-171, -1522, -1705, 610, 2306, 1350, 3631, 3228, 
+	2320, -333, -2364, -1254, -1198, 1330, 731, -1728, 
+	-2658, -2299, 1004, 2127, -3388, -1049, -2239, 1810, 
+	1354, -97, -660, -1068, 725, 244, 2009, -804, 
+	-1319, 1648, 13, -627, -1354, -4070, -2843, 67, 
+	695, -1657, -587, 2398, 1078, 2323, 276, -358, 
+	2302, -1222, -23, -702, -1129, 271, -2475, 1118, 
+	102, 2404, 2125, -409, 1141, 2011, 817, 1138, 
+	2997, -457, -1118, -748, 838, 2312, -2271, -3841, 
+	-3569, -1946, 837, -1794, -2769, -3423, -2121, -2415, 
+	1579, -530, -2480, -1908, 295, 558, 1876, 1214, 
+	1398, 655, -32, 82, 427, 1556, 99, -2089, 
+	-1217, 237, 2427, 2882, -4002, -2378, -4254, -205, 
+	2032, -1505, -2655, -3661, -1577, 667, -976, 1873, 
+	2578, 2201, 1982, 650, 1669, 1320, 1080, 459, 
+	-360, 693, -1994, -2489, -3409, 336, -3122, -5976, 
+	-3851, -1421, -530, -1411, 959, 2585, 2028, -1125, 
+	-911, 731, 1046, -466, -500, -988, 10, 1846, 
+	945, -2071, -1146, -315, 737, -2168, -1578, -389, 
+	925, 448, -1872, 1069, -77, -11, 975, 884, 
+	409, -214, 293, -802, -1445, -684, -1909, -147, 
+	-468, -2429, -55, -667, -1290, -604, 464, -307, 
+	-314, 263, 671, 570, 1602, 1167, -1694, 1468, 
+	1860, -2452, -3024, -243, 1263, 1274, 790, 209, 
+	2196, 313, -1357, 57, 1624, 996, -2857, 32, 
+	489, -1018, -2491, -196, 730, -1087, -820, 1406, 
+	-219, 889, -2270, -660, -722, 1363, 911, -1275, 
+	-779, 939, 1440, 1614, -1969, -115, -684, 1723, 
+	703, 478, -190, 1505, 784, 1488, -267, -168, 
+	-622, 984, 1192, 769, 2350, 2180, 198, -780, 
+	-1604, 274, 2898, 2140, 1099, -2739, -2883, -1059, 
+	2491, 2738, -2073, -3425, -5307, -2057, -197, 2270, 
+	-358, -1316, -2977, 43, 682, -178, -1936, -2139, 
+	-1855, -428, -1885, -1931, 901, -269, -2344, -2182, 
+	1639, 1636, 243, -2832, -269, 1647, -1009, -108, 
+	-925, 2439, 1013, 1310, 1570, -444, 638, 479, 
+	1410, -479, 1103, 1068, 1486, 2052, 1029, 2064, 
+	2471, -139, 1468, 307, 556, -2155, -2497, -1817, 
+	-2240, -2478, -3860, -3162, -423, 553, 1232, 12, 
+	-2453, -1095, 1061, -2136, -4597, -1515, 2849, 2326, 
+	-2398, -1645, 2589, 2615, -1702, -396, 2080, 1448, 
+	-515, -422, 1315, 400, -530, -1852, -2099, 855, 
+	-304, -758, 1111, 1394, -446, 10, 1136, -1226, 
+	627, 598, -1114, -1613, -1295, -1307, 759, 2343, 
+	-1405, 544, 2369, -1754, 1120, 1175, -864, -1443, 
+	1907, -1288, 490, 2064, -1271, -435, -1935, 1006, 
+	1233, -1523, -3944, -227, 2853, 2049, -2329, -589, 
+	1555, 1719, -268, -2574, -404, 575, 565, -1588, 
+	-2386, -456, -448, -2220, 111, 1516, 706, -2348, 
+	-2063, -4771, -2004, 1861, 760, -2705, -2131, -3518, 
+	2228, 3089, 201, 2442, -513, -188, 1225, 2472, 
+	827, 3314, -917, 439, -1389, -3157, -1330, 1186, 
+	1724, 1194, -2619, -4163, 673, 1515, 2220, 383, 
+	-3590, -1879, 947, 3669, 955, -2532, -1989, -1086, 
+	1937, 3061, 828, 495, -131, 202, 2651, 2118, 
+	837, 2512, 1598, 1671, 1202, 2242, 288, -791, 
+	-643, -1585, -2317, -2118, -1167, -4782, -3269, -1577, 
+	-789, -1480, 403, 584, -427, 1511, 122, 330, 
+	-86, -293, -1831, 26, 608, -43, -918, -1981, 
+	-867, 344, 814, -285, 2101, 2163, -971, 489, 
+	181, -1070, -1422, -2787, -3251, 2683, 1294, 932, 
+	441, -1336, 1215, 1989, 998, -2666, -3227, 3288, 
+	1156, -697, -5122, -1668, 2873, -525, -3319, -7123, 
+	-736, 55, -3163, -3946, -752, 2202, -1313, 883, 
+	-1297, -1775, -268, 976, 1355, -1046, -1348, -2116, 
+	-1625, 774, 2381, 3685, 849, -1340, 462, -2134, 
+	-393, 570, -64, -310, -2448, -808, 946, 916, 
+	874, 1031, -1836, -2174, -1012, -2905, -3585, -2396, 
+	-634, 1473, -1467, -74, 965, 2877, 1550, 2261, 
+	1902, 2786, 985, -866, 485, 309, -1463, -1987, 
+	
+};
+
+const static dl_matrix3dq_t conv2d_kernel_q = {
+	.w = 5,
+	.h = 5,
+	.c = 1,
+	.n = 32,
+	.stride = 5,
+	.exponent = -14,
+	.item = (qtp_t *)(&conv2d_kernel_q_item_array[0])
+};
+
+const static qtp_t conv2d_bias_q_item_array[] = {
+	-7581, -17710, -686, -6649, -11514, -17244, -191, -8138, 
+	-6275, -5541, -7142, -5252, 6453, -2151, -2082, -18936, 
+	-1282, -6842, -13529, 2920, -2390, -2846, -9650, -18738, 
+	-6346, -1314, -7655, -668, -6544, 639, -5268, -4396, 
+	
+};
+
+const static dl_matrix3dq_t conv2d_bias_q = {
+	.w = 1,
+	.h = 1,
+	.c = 32,
+	.n = 1,
+	.stride = 32,
+	.exponent = -17,
+	.item = (qtp_t *)(&conv2d_bias_q_item_array[0])
+};
+
+const static qtp_t conv2d_1_kernel_q_item_array[] = {
+	78, -26, 23, -47, -34, 32, 94, 18, 
+	99, 55, 36, 5, -65, 73, 0, 2, 
+	12, -15, 44, -21, 48, -38, 45, 36, 
+	128, 17, 23, -96, 16, -6, -1, 86, 
+	85, 12, 40, 2, 5, 22, -7, -135, 
+	130, -20, 50, 109, -64, -17, -44, -13, 
+	-60, 0, 53, -3, 64, -7, 154, -36, 
+	113, -26, -146, 32, 48, 15, -68, 48, 
+	59, -64, 61, -72, 52, 63, -183, -89, 
+	-27, -93, -28, -77, -39, 34, 88, 2, 
+	-49, 58, -67, -9, -44, 82, 24, 8, 
+	75, -116, -116, 69, 8, 41, -21, -34, 
+	-7, -42, 72, -60, -4, -58, -206, -140, 
+	26, 29, -59, -30, -40, 34, 98, -70, 
+	-99, 40, -61, -14, -44, 48, 0, -24, 
+	-78, -86, 33, 68, -12, 81, -3, -38, 
+	-25, -30, 39, 25, -13, -58, -66, -78, 
+	-100, 52, -64, -74, 54, 2, 89, -51, 
+	-30, 53, -132, -117, 2, 42, -4, 18, 
+	-131, -84, -19, 91, -21, 101, -133, -54, 
+	8, -35, -6, -129, -4, 92, 56, -36, 
+	62, -139, 41, 43, -191, -85, -39, 83, 
+	-36, 69, 79, -176, -13, -50, 151, 3, 
+	173, -81, -40, -45, -45, 83, -79, 44, 
+	59, -23, 48, 13, -63, 30, -27, -79, 
+	-55, -160, 41, -61, -75, -56, 1, 42, 
+	-126, -33, 76, -128, -128, -6, 72, -12, 
+	100, -144, -146, -33, 3, 156, -23, -54, 
+	-1, -53, -20, 45, -50, -81, -80, -46, 
+	-72, -102, -43, -156, 31, -3, 16, -49, 
+	-145, 13, -109, 92, -64, 6, -128, -2, 
+	-75, -137, -58, 13, -38, 92, -8, -143, 
+	-18, -41, 7, -71, -96, -66, -116, -32, 
+	-93, -102, -48, -206, 5, 8, 42, -94, 
+	-132, -40, -113, 66, -63, -15, -54, -21, 
+	31, -129, -59, 0, -1, -9, -24, -75, 
+	-97, -9, -18, -38, -27, -96, -118, -48, 
+	-104, -85, -142, -86, -78, -14, -13, -123, 
+	-9, -63, -115, 5, -79, 14, -82, -16, 
+	-128, -36, 77, -56, -46, 18, 6, -86, 
+	27, -33, 4, -70, 28, 79, -38, -9, 
+	55, -126, -13, 20, -93, -27, -53, 63, 
+	-101, 88, 112, -145, -12, 11, 47, 6, 
+	-37, -76, 47, -13, -20, 16, -52, -138, 
+	-18, 70, -32, 85, -66, 5, -54, -31, 
+	-84, -66, 11, -74, -195, -46, -90, -5, 
+	-96, -17, -48, -108, -51, -69, -62, 92, 
+	-54, -61, 66, -120, -55, -11, -86, -39, 
+	-27, -73, -1, 103, -53, -48, -37, -133, 
+	-126, -45, 64, -151, -2, -24, -90, -70, 
+	-31, -45, -88, -38, -165, -85, -78, 26, 
+	-91, -100, -106, -91, -62, -17, 21, -35, 
+	-85, -80, 14, -131, -77, -45, -130, -166, 
+	-139, -114, -54, -105, 16, 61, -26, -34, 
+	-113, -99, -129, 15, -188, -90, -11, -40, 
+	-31, -250, -207, -32, -32, -147, -4, -93, 
+	-71, -123, -49, -198, -64, -141, -59, -108, 
+	-151, -92, -54, -77, -74, 3, 17, -107, 
+	-101, -110, -63, -10, -128, -104, -137, -77, 
+	-73, -103, -109, -31, -76, -10, 87, -114, 
+	34, -1, 69, -30, 8, 44, -111, -24, 
+	-34, -39, -74, -32, 67, 37, -10, 50, 
+	65, -12, -10, 108, 35, 7, -27, -23, 
+	-8, -33, 89, 5, 39, -41, 59, -89, 
+	-4, 9, -31, 19, -25, -104, -2, 59, 
+	-7, -16, -7, 80, -164, 17, -7, -16, 
+	-15, 55, -109, -13, 16, 58, -153, 65, 
+	-46, 16, 165, -44, -46, -59, 60, -18, 
+	-50, -24, -39, 164, -31, -82, -70, 10, 
+	-13, 41, -68, 15, -85, -163, 4, -44, 
+	76, 37, -138, -104, 78, -26, -92, 89, 
+	-47, 30, -22, -91, -46, 57, -59, -21, 
+	-109, -93, -72, -60, -51, -80, -33, -12, 
+	3, 73, -17, 30, -14, -158, 16, -36, 
+	-36, -54, -72, -62, 74, -54, -19, 32, 
+	1, 11, -86, -94, -30, -102, -80, -77, 
+	-14, -13, -87, -75, -64, -24, 50, -107, 
+	28, 104, -12, 19, 32, -59, 45, -14, 
+	-16, -86, -49, 34, 33, -129, -13, -24, 
+	33, 3, -143, -39, -27, -199, -17, -108, 
+	5, 44, 44, -60, -35, 37, -30, 69, 
+	-45, 124, -74, 26, 76, -16, 63, -68, 
+	25, 31, 29, 125, -2, 7, 21, -13, 
+	-95, 35, 14, 109, 65, -15, 26, 50, 
+	-27, 37, -32, 64, 10, -67, 29, 58, 
+	73, -1, 63, -44, 89, 119, 22, 66, 
+	68, 0, -55, 169, 64, 110, 67, -39, 
+	112, 66, 100, -9, 72, 137, 136, 45, 
+	25, 40, -36, 95, 14, -22, -120, 68, 
+	40, 117, -15, -10, -90, 71, -37, 24, 
+	122, 36, 52, -44, 87, -1, -8, 55, 
+	26, 97, 51, -3, -41, 44, 50, 92, 
+	-21, -46, 26, 11, 43, 9, -81, 85, 
+	14, 152, -101, 37, -133, -192, -67, -23, 
+	103, 0, -60, -98, 50, -153, 93, 22, 
+	2, 62, -2, -143, -15, -109, 22, 123, 
+	-96, -23, 78, -33, -13, -2, 54, 17, 
+	30, 112, -7, 60, -97, -32, 26, -10, 
+	68, 69, 20, -117, 6, -31, 27, -27, 
+	-31, 85, -24, -93, 36, -95, -3, 98, 
+	32, 11, -92, 88, -45, -59, -108, 74, 
+	-86, -103, -17, -71, 1, 13, -172, 7, 
+	-82, -51, 7, 66, -2, -41, -75, 43, 
+	10, -15, 136, -79, 22, -35, 60, -43, 
+	-70, -62, -45, 43, -61, -69, -69, 51, 
+	-125, -129, -97, -108, 1, -80, -84, -101, 
+	-38, -91, -72, -21, -92, -9, -128, -52, 
+	-128, 32, -36, -90, -11, 97, 84, -2, 
+	-56, -80, 25, -101, 10, -39, -43, -37, 
+	17, 12, 20, -36, 38, -59, 15, -30, 
+	9, 47, -33, -62, 73, 28, -67, -14, 
+	-17, -43, -58, 34, -5, -55, -77, 8, 
+	-4, -54, -33, -64, -8, 17, 33, -26, 
+	14, 65, 46, 38, 11, -3, 59, -6, 
+	95, 49, 61, -58, 33, 28, -16, -72, 
+	-53, 38, -35, -58, -11, -78, 56, 41, 
+	3, -20, -28, 6, 77, 20, 107, 99, 
+	65, 37, 66, 30, -117, 10, -107, 25, 
+	73, -12, 11, -79, 95, -158, 39, -39, 
+	-40, 40, 11, -107, -10, 1, 3, 10, 
+	51, 47, -48, 134, -14, 23, -159, 54, 
+	-67, -140, -34, 27, 61, 60, 43, -6, 
+	-18, -34, -79, 54, 12, 58, -89, -53, 
+	10, 90, 83, -35, -20, 62, -113, -43, 
+	-4, 1, -48, -19, -102, -48, 14, -67, 
+	-60, -168, -56, -100, 68, -3, -64, -121, 
+	-148, -134, -86, 15, -122, 0, -51, -128, 
+	-135, -97, -123, -86, -90, 7, 18, -55, 
+	3, -68, -30, -237, 14, 30, 12, -78, 
+	-6, -80, -92, -97, -78, 41, -7, -61, 
+	17, -9, 49, -77, -5, -66, -28, -58, 
+	-76, -34, -289, -79, -55, -23, 93, -96, 
+	111, -57, -1, -133, 35, 36, 120, 4, 
+	111, 7, 65, 40, -98, 3, -47, -21, 
+	32, -18, 90, -181, 59, -70, -28, 25, 
+	-52, -36, -47, -17, -25, -59, 11, 76, 
+	84, 37, 63, -12, 15, 25, 71, 1, 
+	89, 1, -1, 13, 68, -85, 25, 17, 
+	38, 20, 54, 42, 81, 88, 83, 6, 
+	41, 34, -32, 128, 65, 39, 22, 88, 
+	21, -20, -14, 78, -127, -51, -54, 68, 
+	-16, -70, -148, 1, 100, -14, 18, -71, 
+	-23, -76, -72, -13, 14, 27, 5, -52, 
+	-8, 74, 19, 30, -93, 101, -2, -81, 
+	-79, -68, -45, -34, -55, -101, -37, -140, 
+	-141, 26, -32, -89, 51, -88, 22, -97, 
+	-20, -59, -109, -40, -58, 4, -104, 2, 
+	-123, -34, -100, -3, -95, -43, -128, -119, 
+	51, -42, -23, -150, 32, -40, 49, -102, 
+	77, 102, 13, 38, -14, 28, -19, -64, 
+	60, 20, 77, -48, 19, -109, -4, -37, 
+	-34, -56, -225, -91, -9, 27, -75, -46, 
+	40, -10, 3, -213, 54, 47, 119, -10, 
+	61, -107, 81, -19, -147, 37, -231, -12, 
+	31, 0, 18, -82, 4, -100, -3, 30, 
+	113, -79, -50, -93, 64, -44, -51, 37, 
+	-37, 6, 14, 30, -16, -28, -63, 21, 
+	-62, 3, -114, -54, 35, -221, 59, 28, 
+	-9, -6, -2, -162, -4, 91, 18, -1, 
+	54, 16, 64, 48, -33, 94, 22, -70, 
+	-120, -48, -56, 36, -54, -92, -27, 28, 
+	-44, -25, -197, 19, -61, -143, 60, 10, 
+	26, -4, -77, -71, 27, 72, -4, -41, 
+	-50, 63, 29, -20, -37, 75, -17, 4, 
+	-59, -10, -51, -32, -40, -42, -11, -31, 
+	19, 54, -132, -14, -61, -87, -22, -40, 
+	15, -51, -65, -198, 71, -143, -53, -7, 
+	-133, 12, 12, -143, -73, -87, 45, -29, 
+	-58, -29, 9, -126, 51, 19, 167, -129, 
+	60, -7, 51, 78, -25, 25, -218, 43, 
+	69, -49, 59, -109, -13, -152, 53, -19, 
+	-34, 61, -74, -142, 0, -173, 33, -30, 
+	3, 20, 41, -146, 48, 72, 34, 13, 
+	119, -95, 31, 38, -66, -47, -127, 18, 
+	-17, 1, 44, -162, 79, -82, 60, 13, 
+	123, -89, -19, -24, 59, -76, -133, -50, 
+	-96, 17, -83, 118, -76, -40, -24, 94, 
+	-232, -44, -159, -37, -162, -124, 0, -84, 
+	-53, -66, -83, -132, -137, 36, -140, 63, 
+	-69, 63, -8, -49, 26, 69, 21, -6, 
+	-19, -27, 32, 37, -33, 20, -7, -69, 
+	76, 83, -115, 71, -65, -121, 83, -47, 
+	14, 44, -68, -174, 105, 147, 95, -49, 
+	-22, 27, -41, 88, -41, 108, 36, 53, 
+	-74, -74, -53, -75, -8, -9, 41, -8, 
+	18, 28, -60, -37, 35, -64, -1, -32, 
+	20, 11, -14, -97, 64, -23, -8, 22, 
+	-103, -83, -83, -61, -18, -94, 43, 30, 
+	40, -55, 50, -91, 17, 60, 141, -141, 
+	76, -255, 86, 61, 20, 5, -143, -53, 
+	6, 6, 97, -9, 16, 1, 61, 58, 
+	-35, -106, -126, -50, 39, -17, 2, 21, 
+	31, 34, -11, -58, 65, 60, 42, 68, 
+	-53, -210, 7, -57, -101, -52, -114, 46, 
+	16, -43, 61, -55, -70, 9, -75, 2, 
+	-9, -53, 27, -13, 17, 37, 27, -47, 
+	-80, 64, 18, 31, -86, -127, -10, 19, 
+	-62, 71, -101, 32, -39, -78, -14, -100, 
+	4, -65, -146, -112, -46, 62, -123, 17, 
+	-109, 85, 61, 59, -19, 121, 33, 37, 
+	-63, -121, -54, 95, -141, -56, -20, -47, 
+	-168, -50, 1, 25, 89, -4, 59, -41, 
+	-103, 22, -58, 21, -129, -51, -32, -11, 
+	-94, 28, -27, 74, -29, 13, -84, -66, 
+	-15, -3, 27, 10, 26, -47, 54, -33, 
+	-51, -81, 133, -25, -4, 108, -28, 1, 
+	-32, -33, 65, 25, -128, -55, -37, -116, 
+	44, -130, -101, -5, -56, 59, -39, -68, 
+	26, 21, 25, 20, -46, 59, 32, -28, 
+	99, 19, 94, 57, -83, -20, -45, 11, 
+	-32, -43, 34, -178, 85, -190, 23, -9, 
+	60, -45, 27, -53, -73, 98, 12, -31, 
+	45, 85, -9, 8, 51, 15, 57, -38, 
+	11, 32, -36, 67, -79, -73, 17, 65, 
+	47, 21, -8, -273, 88, -77, 81, 36, 
+	80, -44, -23, -38, 41, -16, -130, 8, 
+	82, 70, 57, -58, 48, -1, 33, 52, 
+	89, 66, -89, 46, -144, -133, 45, 3, 
+	-2, 27, 18, -255, 112, 24, 90, -21, 
+	60, -30, -14, 60, 115, -83, 49, 2, 
+	-73, -91, -147, 24, -87, -172, -10, 71, 
+	-313, -282, -47, -52, -19, 22, -142, -224, 
+	-146, -92, -177, -72, -176, 48, -168, -82, 
+	-265, -88, 205, -15, -60, 28, 73, -30, 
+	35, -46, -12, 21, -21, -16, 41, -48, 
+	-72, -239, 118, -82, 52, 83, -230, -62, 
+	-105, 38, 39, 63, -183, -94, -66, -80, 
+	-8, -71, 75, -158, 54, -151, 24, -90, 
+	-12, -69, 44, 89, 50, 25, 28, 127, 
+	-9, -133, 67, -45, -81, 47, -202, 93, 
+	11, 39, 114, 75, -73, -39, -14, -6, 
+	27, -49, 47, -111, 1, -288, 92, -47, 
+	100, -2, 82, 71, 37, 3, 20, 3, 
+	14, 35, 60, 24, -64, 8, -99, -13, 
+	-48, 106, -2, -39, -11, 23, -4, 109, 
+	93, -37, -42, -68, 47, -116, 38, 158, 
+	73, 8, 79, -138, 66, 96, 110, 29, 
+	105, 60, 47, 18, -110, -19, -26, -1, 
+	26, 121, 33, -80, -32, 59, 119, -73, 
+	125, -122, -110, 99, 112, 103, 15, 136, 
+	-91, -121, -165, 72, -123, -192, -71, -127, 
+	-157, 53, -98, -111, 59, -45, 48, -141, 
+	-68, -117, -230, 88, -115, 22, -207, -65, 
+	-247, -26, 60, -23, -58, 48, -31, -108, 
+	20, -84, -51, -81, -75, -26, 11, -229, 
+	-135, -96, 43, -202, 109, 59, 12, -31, 
+	-191, -150, -127, 134, -143, -5, -78, -101, 
+	-103, -75, 63, -14, 46, -246, -102, -189, 
+	77, 8, 25, -144, -73, 13, -27, -211, 
+	-224, -22, 93, -210, 82, 158, 79, 70, 
+	-144, 19, -42, 207, -181, 52, -1, -27, 
+	-18, -229, -82, 75, 105, -223, 68, -197, 
+	41, -16, 69, -236, -58, 15, 20, -259, 
+	-150, 60, 47, -232, 138, 134, 81, -14, 
+	-249, -14, -85, 210, -295, 128, -75, -104, 
+	-7, -308, -217, 167, 89, -105, -30, 21, 
+	-3, 46, 102, -103, -83, -7, 26, -242, 
+	-132, -71, 57, -220, 45, 45, 103, 52, 
+	-219, 36, -2, 53, -224, 186, 50, -89, 
+	-23, -403, -301, 138, 17, 62, -125, -42, 
+	-155, -134, -66, 3, -51, -166, -90, 9, 
+	-54, -15, -74, -4, -73, -119, -71, -64, 
+	83, -50, -86, -105, -11, -136, -56, -58, 
+	-91, 79, -5, -185, -111, -112, 1, 20, 
+	-136, -164, -80, -18, -45, -104, -82, 69, 
+	-68, 4, -141, -3, 7, -171, -5, -28, 
+	60, -50, -80, -152, -33, -70, -111, 50, 
+	-122, 108, -9, 6, -146, -136, -64, -18, 
+	-167, -114, -36, -89, -30, -72, -125, -14, 
+	-3, 188, -63, -81, 124, -116, 152, -2, 
+	49, 43, -125, 68, 66, 46, -106, 85, 
+	-178, 185, -4, 182, -41, -131, -125, 82, 
+	-46, -132, -125, -130, 13, -35, -128, -25, 
+	-4, 178, -46, -29, 56, -15, 201, 5, 
+	77, -24, -68, 130, 3, -7, -72, 27, 
+	-114, 100, -123, 142, -100, -93, -33, 25, 
+	-23, -62, -126, -58, -63, -28, -64, -59, 
+	-30, 86, -59, 13, -86, -34, 98, 40, 
+	-14, -44, -117, -62, 18, -5, 5, 42, 
+	-12, 38, -48, 18, -136, -21, -128, -21, 
+	-66, -37, 12, 32, 1, -29, -44, 25, 
+	16, -72, 60, 56, -153, -86, -111, 38, 
+	73, -49, -43, -59, -12, -84, -68, -35, 
+	-66, 81, -30, -223, 7, -93, 55, -26, 
+	3, 27, -16, 54, 63, -34, -9, 67, 
+	57, 52, -35, 57, -102, -222, 10, 20, 
+	25, -41, -47, -175, 70, -82, -22, 55, 
+	-117, 77, 50, -196, -78, -103, -37, 119, 
+	7, 10, -14, -56, 68, 46, -34, -17, 
+	90, 114, -42, 99, -131, -91, 23, -65, 
+	96, -15, -82, -162, 91, -45, 50, 28, 
+	64, 41, -25, -3, 71, -71, 85, 154, 
+	11, -13, -5, -74, 98, 42, -20, 105, 
+	78, 55, -67, 103, -139, -68, 119, 11, 
+	129, 63, 1, -28, 72, 120, 37, 26, 
+	49, 131, 0, 75, 31, -28, 149, 112, 
+	12, -29, 8, -28, 7, 4, 46, 93, 
+	86, 30, -5, 24, -140, -35, 60, 14, 
+	82, 66, -3, -109, 132, 38, 15, 27, 
+	61, 94, 76, -3, 21, 61, 70, 81, 
+	13, -3, 31, 72, 5, -33, 13, -94, 
+	77, 24, -21, -16, 93, 95, 114, 26, 
+	-15, 14, -34, 86, 19, 110, -39, -35, 
+	-22, -18, -31, 80, -28, 179, -18, -69, 
+	-42, 39, 33, 47, -71, 21, 2, -18, 
+	-56, -106, 31, -55, 100, 70, 60, -51, 
+	-160, -30, -53, 53, -44, 16, -64, -19, 
+	50, -107, 49, 51, -37, 90, 88, -118, 
+	41, -34, -31, 77, -2, -18, 36, 27, 
+	1, -49, 58, -100, 93, 77, 71, -46, 
+	-71, -18, -43, 70, -101, -28, 60, -29, 
+	6, -52, 73, 50, 55, 121, -32, -50, 
+	46, -42, 15, -70, -63, -2, 23, -3, 
+	-114, -2, 36, -165, 81, 43, 81, -59, 
+	-100, 42, 4, 117, -153, 79, 0, 4, 
+	-22, -76, -13, 85, 45, 116, -83, -16, 
+	-11, 0, 30, -68, -93, -41, -68, -60, 
+	-102, -101, 69, -137, 14, 68, 57, 11, 
+	-160, -64, -65, 51, -189, -3, -16, -65, 
+	37, -147, -16, 68, 21, 96, -69, -152, 
+	6, 10, -36, 58, 37, -45, -72, -94, 
+	24, -46, -41, 23, 13, 2, -85, 32, 
+	-20, -45, -59, 34, 23, -48, 73, 0, 
+	45, -43, -30, -14, 24, 83, -67, -1, 
+	-46, -85, -111, -52, -86, -32, -66, -34, 
+	-144, -173, -44, -226, 35, -118, -14, -35, 
+	-152, -33, -66, 3, -126, -54, -55, 28, 
+	-98, -164, -46, 37, -58, 62, -87, -245, 
+	-72, -87, -85, -46, -68, -94, -139, -203, 
+	-127, -25, -123, -163, -48, -85, 42, -32, 
+	-99, 0, -146, 55, -112, 31, -33, -106, 
+	-18, -88, -147, 24, -19, -32, -143, -43, 
+	-86, -144, -47, -168, -72, -117, -75, -175, 
+	-64, 72, -102, -68, -42, -110, 129, -27, 
+	-26, -47, -138, 9, -6, 1, 17, 6, 
+	-155, 32, -165, 68, -48, 67, -77, -105, 
+	-117, -139, -116, -134, -5, -52, 13, 54, 
+	61, 201, -60, -66, -104, -67, 134, -7, 
+	107, 4, -32, 8, 84, -102, -147, 15, 
+	-188, 87, -68, -27, -75, 14, -38, -15, 
+	-60, -26, -26, -43, -63, 12, -100, -36, 
+	-121, -126, -161, 2, -33, -88, -32, -35, 
+	38, -31, -122, -90, -69, -90, 25, -5, 
+	5, -1, -77, -48, -40, 23, -102, -25, 
+	-119, -67, -102, -113, -60, -68, -106, -93, 
+	-114, -137, -166, -137, -51, -222, -29, -127, 
+	-141, -101, -212, -189, -30, -31, -77, -70, 
+	-121, -78, -119, -75, -75, 56, -117, -86, 
+	-79, -124, -110, -121, -27, -60, -52, -31, 
+	-15, 67, -115, -67, -174, -131, 91, -139, 
+	-53, -2, -46, -201, -45, -52, -26, -54, 
+	-118, 0, -94, -44, -63, 58, -4, -49, 
+	7, -14, -47, -105, 59, -36, 28, 4, 
+	119, 178, -7, -70, -136, -107, 108, -59, 
+	13, -3, -16, -90, 100, -153, 59, -23, 
+	-46, 9, -142, -183, 40, 81, 8, 91, 
+	47, 51, 101, -157, 42, 77, 58, 85, 
+	187, 83, 75, 8, -112, -40, -158, -61, 
+	68, -28, 36, 8, 33, -15, 90, 25, 
+	-16, 53, -50, -66, 69, -187, 160, 127, 
+	-109, -21, -44, 81, 7, -47, -17, -61, 
+	-18, 42, -66, 35, -193, -232, 48, 8, 
+	1, -18, -125, -237, 24, -82, -86, 44, 
+	-66, 13, -17, -113, -83, 119, -57, -56, 
+	-103, -100, -121, -19, -5, -92, 73, -39, 
+	52, 159, -36, -57, -55, -247, 6, 12, 
+	37, 16, -21, -206, -10, -152, -61, 9, 
+	10, 55, -59, -116, -118, 4, -122, -9, 
+	41, 12, -24, -12, 10, 54, 55, -3, 
+	75, 175, 36, -19, -24, -78, -11, 56, 
+	32, -99, 58, -49, 58, -90, 117, -7, 
+	61, 51, -110, -97, -18, -78, -25, 37, 
+	65, -8, 87, -16, -42, 77, -62, 12, 
+	108, 62, 19, 105, 82, 45, 135, -20, 
+	32, 30, 28, 9, 48, 70, 80, -53, 
+	79, -67, -81, 186, 59, -88, 53, 29, 
+	80, -11, 102, -60, 32, 51, -162, -75, 
+	-88, 129, 27, 58, 148, 14, 145, 37, 
+	-66, 115, 48, 78, -88, 50, 61, 0, 
+	-75, 2, 0, 179, 66, -171, 53, 13, 
+	-58, 44, 14, 238, -14, 21, -21, -2, 
+	-35, 51, -98, 179, -141, -146, -176, -36, 
+	112, 22, -31, -163, 75, -54, 25, 42, 
+	-20, 135, 144, -119, -45, 88, 69, 106, 
+	-43, 34, -9, 100, -19, 14, 64, 18, 
+	136, 16, 35, 64, -112, 23, -133, -12, 
+	99, -50, 32, -14, 81, -109, 21, -18, 
+	-80, 128, -20, -81, -55, -142, 117, 76, 
+	54, 15, 64, -45, 41, 36, 56, 43, 
+	118, -194, 74, 112, 3, 52, -76, 51, 
+	-3, -76, 50, -14, 107, -84, 59, 27, 
+	-1, 20, 1, 1, 49, -95, -4, 66, 
+	41, 57, -61, 126, -28, -65, -74, 88, 
+	-178, 62, 17, 20, 35, 12, 22, 30, 
+	-87, 27, -64, 68, -96, -38, -77, 91, 
+	-13, 95, -3, 64, 27, -109, 56, 28, 
+	17, 43, 7, 28, -30, -99, -146, -16, 
+	-104, 108, -84, 10, 19, -3, -29, 27, 
+	0, -53, -118, 89, -134, 48, -127, -8, 
+	0, 83, 18, 11, -11, -137, 72, 58, 
+	45, -53, -61, 38, -6, -23, 67, -30, 
+	54, 24, 35, 20, 74, 52, 59, 62, 
+	5, -39, 26, 7, 23, -9, 11, -62, 
+	12, -9, -63, 50, -62, 150, 26, -42, 
+	15, -10, -4, 10, -17, -35, -23, 15, 
+	51, -46, -8, -10, -55, -1, -39, 56, 
+	-74, -85, -47, -12, 31, -50, -18, 16, 
+	79, 6, -8, -93, 34, 40, 35, -63, 
+	-33, -87, 19, 86, -52, -66, -139, -63, 
+	-71, -140, -130, 19, -79, -123, -125, -19, 
+	-75, -57, -163, -169, -100, -122, -2, 10, 
+	28, -56, -3, -40, -65, 63, -93, -81, 
+	-97, -149, -11, -26, -32, -85, 145, -191, 
+	-39, -175, 96, -111, -11, 57, -106, -60, 
+	-145, -26, -18, 31, -157, -79, -112, -109, 
+	-91, -121, -158, -26, -80, -54, -101, -157, 
+	96, -52, 49, -146, -45, 15, 68, 102, 
+	35, -212, 196, -39, 29, 99, -58, 142, 
+	-96, 13, 52, -7, -134, -74, -9, -79, 
+	128, -262, 40, -34, 17, -217, 15, -144, 
+	-63, -54, 9, 8, -3, 74, 95, 24, 
+	58, -18, 73, 49, 34, 39, -85, 70, 
+	-57, -53, 67, 23, 54, -141, 16, -37, 
+	-63, -2, 28, -153, -40, -89, -26, 53, 
+	-62, -39, 25, -61, 36, 68, -57, 26, 
+	1, 26, 25, -54, 23, -43, -12, 84, 
+	-31, 13, -32, -27, 56, -138, 144, -48, 
+	94, -6, 64, -163, -12, -122, -28, 59, 
+	-59, -8, -44, 19, 9, -117, -143, 9, 
+	-64, -82, -204, -30, -177, -98, -35, -18, 
+	-4, 8, -128, -161, 58, -90, -76, -6, 
+	-89, 67, 76, -174, -90, 24, 62, 12, 
+	-68, -50, -112, -44, -53, -44, 43, -93, 
+	21, -132, 45, -52, 8, 17, -194, -46, 
+	-106, -89, -49, 2, -66, -88, -160, -41, 
+	-70, 11, 20, -54, -121, -97, -146, -124, 
+	-26, -100, -31, -24, 16, -19, 17, -18, 
+	-32, -146, 79, -85, -59, 12, -125, 10, 
+	-144, -88, 57, 61, -187, -105, -79, -44, 
+	80, -192, -80, -103, 13, -210, -81, -234, 
+	-37, -25, 68, -101, -42, 54, 86, -74, 
+	-59, -56, -3, -21, 69, 26, 50, 15, 
+	16, 62, -19, 52, -87, 90, 14, -19, 
+	-48, -78, -148, 79, -14, -76, 53, 36, 
+	-15, 20, 79, -35, 11, -18, -46, -33, 
+	-145, -72, -63, -69, -39, 23, 28, 105, 
+	-30, 92, -59, 81, -9, 19, -63, -24, 
+	81, -24, 38, -17, 35, -39, 79, -74, 
+	-25, -21, -60, 0, -31, -84, -57, -37, 
+	1, -79, 8, 31, -116, -46, 61, -11, 
+	-6, 21, -70, 17, 34, -36, -56, 10, 
+	16, 29, 120, -110, -52, 27, 171, 6, 
+	17, -9, -11, 24, 1, -41, 31, -20, 
+	38, -6, 40, 2, -90, -132, -12, 58, 
+	8, -2, -49, -70, 28, -151, -68, 25, 
+	-28, 5, 75, -112, -88, -130, 60, -60, 
+	-16, -53, -19, 35, 25, -6, 2, 93, 
+	44, 97, 40, -36, -76, -66, 5, 7, 
+	25, 19, 58, -6, -40, -177, 12, 58, 
+	105, 64, 65, -78, 6, -169, 71, 24, 
+	-51, -41, -52, 53, 16, 3, -3, -52, 
+	-52, 117, -28, 1, 15, -4, 36, 0, 
+	46, 74, -82, 8, 40, -37, -48, 58, 
+	-130, 62, -5, -11, -59, 17, -120, 12, 
+	-57, -43, -65, -70, -25, 7, 8, -5, 
+	0, 99, -15, -18, 29, 0, 34, 32, 
+	2, 34, 7, 33, 32, -22, -74, 9, 
+	-83, -45, 26, -3, -105, 2, -136, -1, 
+	-36, 27, -43, 41, 30, 35, 146, 33, 
+	108, 150, 80, -30, 99, 53, 61, 32, 
+	102, 65, 54, -36, 42, -25, 25, -64, 
+	41, 21, 4, -50, -88, 91, -73, 65, 
+	32, -4, 19, 58, 34, -55, 55, 42, 
+	7, 63, 79, 23, -85, 1, -90, 4, 
+	-16, 24, 25, -75, 105, -130, 16, -52, 
+	170, -34, -56, -89, -16, 6, -49, 55, 
+	16, 39, -54, 19, -4, 6, 42, 53, 
+	41, 68, -27, 31, -160, -79, -79, -6, 
+	58, 21, 28, -121, 43, -143, -2, 10, 
+	36, 61, -16, -115, -23, 39, 9, 110, 
+	-42, 27, -85, 71, -16, -69, -62, 47, 
+	-84, -94, 19, -34, -18, 82, -137, 7, 
+	28, -36, -47, 103, 53, -74, -112, -37, 
+	-188, 71, 85, -141, 8, -99, 42, 27, 
+	36, -66, 15, -102, 31, 31, -37, 20, 
+	-37, -10, -37, 53, -176, -55, -220, -60, 
+	49, -60, 11, -112, 53, -124, -76, 19, 
+	-78, 40, 6, -236, -78, -206, -12, 76, 
+	4, -83, -17, 9, 22, 17, 78, -7, 
+	72, -29, 75, 108, -17, -11, -233, -34, 
+	82, -2, 97, -85, -4, -150, 44, 61, 
+	-35, 42, -52, -176, -25, -63, -26, 58, 
+	3, 37, -16, 33, 26, 30, -13, 27, 
+	38, 17, 40, 36, -100, -39, -94, 14, 
+	4, 38, -10, -79, 58, -123, 40, 55, 
+	165, -44, 49, -76, -31, -81, 6, -23, 
+	-30, 31, -11, 81, 45, 41, -18, 16, 
+	58, 47, -8, 121, -182, -149, -56, 45, 
+	-20, -4, -10, -135, -73, -72, -55, 91, 
+	42, 9, -18, -50, -73, -39, -5, 7, 
+	-8, 32, -44, 90, -23, -26, 90, 21, 
+	58, -61, 88, -47, 107, 122, 27, -4, 
+	-8, -42, 17, 57, 10, -15, -48, 42, 
+	-25, 56, 37, 3, -18, 20, 147, 53, 
+	-42, 71, -25, 124, -85, -8, -77, 53, 
+	-96, -102, -99, -81, -53, -32, -13, -73, 
+	-38, -7, -90, 39, 20, 16, 3, -27, 
+	-71, 30, 56, 11, -26, 148, 102, -21, 
+	-38, -80, -48, 62, -1, 3, 92, -57, 
+	-65, -113, 94, 25, 30, 27, 14, -11, 
+	-96, 78, -7, -9, -178, 22, -23, -39, 
+	-69, -50, -64, -72, -78, 106, -20, -64, 
+	38, -65, 74, -127, 87, 39, 132, -11, 
+	32, -185, 102, -100, -30, 86, -75, 35, 
+	-40, 109, 107, 6, -53, 5, 26, -26, 
+	61, -118, -110, 5, 49, 115, 16, -59, 
+	102, 100, 26, -82, 1, 1, 98, -3, 
+	171, 62, 103, -18, -10, 112, 36, 46, 
+	33, 39, 137, 70, 89, 32, 47, -67, 
+	12, -26, -60, 62, 64, 18, 75, 50, 
+	42, -4, -24, -4, -3, 10, 17, 20, 
+	77, -120, -11, -45, 5, -76, 69, 14, 
+	-82, -82, -35, -17, 20, 63, 72, -90, 
+	20, -121, -107, 67, 20, 183, -41, -86, 
+	-89, -9, -54, 40, -55, -96, -166, 19, 
+	-79, -125, -106, -162, -57, -24, 81, -96, 
+	-168, -28, -110, -13, -68, 62, -92, -122, 
+	-61, -64, -44, 54, -20, 102, -26, -128, 
+	-94, -135, -94, -57, -111, -113, -52, -198, 
+	-192, -118, -60, -78, 67, -34, -96, -82, 
+	-227, -120, -116, 79, -110, 8, -111, -115, 
+	-131, -148, -113, -5, -59, 73, -113, -166, 
+	17, -34, 12, -182, -89, -30, -29, -257, 
+	-211, -162, 101, -228, 81, 72, 12, 51, 
+	-245, -40, 21, 57, -224, -18, -34, -43, 
+	-80, -254, -211, -29, -22, -133, -18, -228, 
+	-3, -20, 39, -254, 5, -55, 67, -145, 
+	-58, -250, 123, -163, 105, 114, -57, 40, 
+	-208, 26, 27, 104, -211, 20, -160, -66, 
+	-103, -254, -108, 72, -6, -77, 39, -183, 
+	-35, 36, -41, 4, -47, -6, -98, -47, 
+	-1, 22, -106, -90, -70, -239, 59, 17, 
+	29, -80, -91, -292, 65, -140, 47, -13, 
+	-68, 13, -30, -111, -54, 57, -72, -58, 
+	-162, -23, -118, -17, 7, -37, -41, -38, 
+	23, 130, -75, -57, -199, -254, 93, -89, 
+	66, 23, -157, -264, 112, -150, -63, 47, 
+	-213, 82, -48, -6, -70, 59, -71, -54, 
+	-154, -103, -109, -30, -26, -43, -160, 54, 
+	-3, 67, -128, 99, -57, -205, 129, -39, 
+	42, -27, -85, -29, 108, -125, -80, 35, 
+	-181, 107, 62, -80, -101, -116, 60, -84, 
+	-63, -58, -119, 33, -22, -51, -57, -109, 
+	-20, 86, -108, -52, -68, -36, 104, 62, 
+	-5, -48, -99, 202, 12, -155, -66, 13, 
+	-164, 26, 66, -48, -63, -273, -101, -89, 
+	-27, -13, -90, -140, 10, 56, 7, -133, 
+	-4, 97, 54, -48, -11, 6, -1, 36, 
+	-5, -77, -35, 231, -84, -159, -44, 65, 
+	-16, -80, -220, -46, -59, -294, 11, -103, 
+	-55, 42, -25, 15, 57, 16, 3, 65, 
+	24, 49, -71, -22, -75, -118, 71, -6, 
+	102, 51, 12, -114, 5, -32, -40, 97, 
+	-103, 87, 47, 13, -22, -54, -68, 116, 
+	-38, -11, 10, 24, 43, -44, -38, 38, 
+	44, 125, -8, 61, -91, -71, 64, -31, 
+	35, 41, -40, 46, 2, 61, 4, 27, 
+	-53, 103, -82, 56, 37, -157, 37, 174, 
+	-46, -42, 71, -116, 93, 30, -34, 62, 
+	20, 108, -20, 30, -99, 23, -46, -49, 
+	95, -61, 11, 124, 87, 58, 41, 18, 
+	50, 94, 44, 78, 92, -112, 86, 62, 
+	-63, -63, 25, -16, -2, 6, -107, 115, 
+	11, 93, -8, 49, -279, 7, -122, -62, 
+	96, 38, -55, -6, 32, 41, -62, 51, 
+	0, 154, 145, -103, -8, -145, 174, 133, 
+	29, -41, 10, -51, 4, 12, -27, 31, 
+	90, 28, 9, 115, -210, -131, -83, -5, 
+	75, 13, 13, -110, 15, -145, 21, 108, 
+	88, 134, 21, -80, -23, -25, -6, 21, 
+	46, 81, -27, -32, 25, -20, -56, -37, 
+	-63, -116, -34, 42, -41, -49, 53, -20, 
+	-15, 13, -19, -3, -78, 0, 4, -5, 
+	-91, -87, -8, 82, 31, 7, -53, 115, 
+	-18, 33, 79, -117, 19, 41, -165, -1, 
+	-71, -62, 4, 64, 39, -39, 186, 46, 
+	-17, 57, -50, 61, -48, 117, 57, -50, 
+	-30, -110, 6, 167, 66, -28, -17, 54, 
+	33, 4, 113, -46, 34, 33, -96, -48, 
+	-151, -15, 48, 48, 191, 88, 136, -81, 
+	-24, 9, 0, 203, -152, 68, -68, 23, 
+	-127, -68, -6, 82, 15, -37, -8, 26, 
+	102, 18, 88, -99, 50, -41, -116, 20, 
+	-78, -56, 12, -37, 70, 154, 93, 37, 
+	-69, 38, -50, 137, -161, 58, -22, -84, 
+	-46, -44, 33, 53, 34, -44, 94, -38, 
+	85, 116, -17, -47, 29, -17, -181, -16, 
+	-77, 24, -77, 12, -52, 71, -42, 26, 
+	-48, -13, 55, 52, -45, 89, 37, 64, 
+	4, 94, 69, 48, 66, -67, 148, 45, 
+	-54, 20, 54, -58, -3, 59, -4, 32, 
+	-8, -45, -63, -130, -88, -4, 18, 18, 
+	-15, -15, -37, -66, -18, 13, 63, 72, 
+	-17, 4, 58, 1, -22, 62, 47, -7, 
+	-22, -4, -11, -15, -35, 23, 54, 0, 
+	26, 18, 50, 15, -56, -83, -21, 14, 
+	0, -61, 25, -196, -35, 39, 68, -53, 
+	25, -74, 38, -64, 0, 109, -41, 43, 
+	-6, -34, -1, -26, -12, 53, 128, 87, 
+	104, 13, 83, -11, -18, -30, -30, 33, 
+	-48, -43, 95, -119, 27, 5, 44, -53, 
+	99, -19, -30, -66, 61, 220, -59, 27, 
+	-8, -64, 66, 41, -35, 29, 113, 104, 
+	139, -68, 199, -23, -81, 23, 49, 80, 
+	32, 16, 124, -93, 97, 11, 56, -88, 
+	115, 44, 22, -45, -1, 145, -14, -15, 
+	90, 15, 46, 98, -14, 33, 87, 72, 
+	103, -9, 98, 42, -101, -55, -35, 37, 
+	2, -45, 60, -72, 66, 4, 24, 23, 
+	155, 43, 133, -4, -21, 120, -78, 111, 
+	-11, -2, 40, 69, -18, 68, -39, -26, 
+	74, 126, -8, 38, -189, -185, 112, 19, 
+	40, 17, 39, -107, 71, -17, 55, 61, 
+	-58, 51, 19, -25, -96, 53, 22, 34, 
+	-26, -47, 5, 78, 24, 50, 34, -21, 
+	40, 45, 32, 84, -46, -136, 20, 6, 
+	46, -95, -59, -90, 4, -82, 151, -21, 
+	48, 35, -112, -58, -31, 98, -45, 19, 
+	11, 24, 46, 12, -42, -22, 12, -84, 
+	3, 34, -6, 24, -32, -48, 14, 54, 
+	-77, -62, 15, 15, -55, 92, 134, -68, 
+	106, -165, -174, 79, 21, 54, 61, -50, 
+	19, -68, 56, -29, -37, 64, 63, -51, 
+	-95, -7, 149, -105, -59, 32, -24, -45, 
+	-124, 64, 12, 74, -110, 148, -36, -29, 
+	-28, -257, -32, 73, -36, 8, -7, -96, 
+	55, -62, 8, -9, -34, -40, 34, 40, 
+	-16, -123, 62, -63, -57, 32, 6, -48, 
+	-132, -67, 28, -36, -64, 34, -68, 18, 
+	115, 3, 104, -40, -29, -29, 4, -1, 
+	40, 99, 33, -129, 21, 62, -122, 61, 
+	40, -89, -67, -31, -150, 26, -179, 3, 
+	13, 54, 15, 1, -4, 71, -19, 8, 
+	-48, 64, 28, -116, 69, -119, 166, 69, 
+	-17, -54, -63, -2, 50, -48, -46, 76, 
+	-13, 28, -95, 108, -246, -49, -332, 95, 
+	22, 1, -16, -56, -35, -48, -7, 54, 
+	-59, 130, 84, -248, 29, -244, 197, 69, 
+	-86, -45, 6, 51, 31, -15, -146, 97, 
+	-71, 191, -99, -29, -424, -224, -121, 5, 
+	64, 56, -48, -242, -4, -169, -21, 151, 
+	-76, 194, 134, -223, -96, -291, -16, 142, 
+	-54, -91, -49, 81, 13, 28, -88, -63, 
+	-100, 181, 69, -21, -165, -237, -35, 64, 
+	82, -31, 36, 94, 28, -65, 55, 103, 
+	70, 56, -88, -169, 0, -197, -61, 118, 
+	-37, 46, -24, -26, 3, 7, 101, 117, 
+	49, 71, 42, -75, -38, -72, 1, 85, 
+	-9, -11, 4, 15, 43, -58, 42, 8, 
+	100, 2, -15, -60, 53, -81, 13, 38, 
+	36, 87, 6, -132, -13, -52, -152, -148, 
+	-53, -7, 10, -102, 137, 21, 187, -41, 
+	-144, -128, -2, 172, -53, 162, -90, 27, 
+	31, -200, -82, 231, 90, -19, 14, -129, 
+	-67, 80, 63, -298, 31, -56, -143, -34, 
+	-147, -87, -22, -83, 226, 174, 77, 29, 
+	-28, -64, -63, 284, -61, 177, -167, 1, 
+	-49, -170, 28, 137, 41, -239, 116, -105, 
+	22, 14, -2, -77, 27, -126, -208, 76, 
+	-147, -166, -102, -42, 60, 29, -90, -80, 
+	8, -26, -67, 209, -45, -31, -183, -28, 
+	-72, 71, 160, -78, -52, -172, 181, -4, 
+	-4, -32, 40, -6, 23, 19, -230, -68, 
+	-140, -84, -115, 57, -18, -28, -48, -11, 
+	80, 9, -27, 16, -110, -47, -107, 75, 
+	-119, 64, 86, 3, -79, -149, 26, 87, 
+	16, 18, 28, -5, 62, 59, -84, 18, 
+	-16, -18, 13, -24, 27, -124, -19, 36, 
+	-18, 31, 101, -57, -33, -41, 59, 17, 
+	-101, 19, 2, -19, -70, -91, -78, 92, 
+	-1, 32, -49, 60, -23, -55, 6, 111, 
+	-2, 58, -33, -60, -83, -59, 85, 34, 
+	-51, -37, -98, -154, -48, -64, -82, -10, 
+	83, 31, 87, -3, -34, 3, -84, -122, 
+	44, -29, -47, -75, -24, -20, 44, -58, 
+	106, 226, -7, 18, -14, 51, 14, -5, 
+	15, -50, 2, -46, 3, -61, -13, 38, 
+	79, -28, -90, 23, 20, -230, -84, -3, 
+	102, 38, -52, -132, 4, 89, 54, -22, 
+	-72, 157, 43, -144, -51, 31, -11, 36, 
+	-72, -59, -25, 119, 86, -7, 100, 48, 
+	145, -109, -118, -73, 146, -94, 3, -114, 
+	13, 50, -51, -105, -25, 52, -116, -122, 
+	-142, -147, 23, -87, -83, -7, -31, 53, 
+	-45, -31, 6, -9, -39, 43, -47, -54, 
+	31, -124, -30, 11, 85, 61, 16, -39, 
+	-19, 72, -28, -117, -2, 46, -226, -128, 
+	-242, -255, -163, -46, -52, -107, -43, -141, 
+	-140, -10, -30, -89, -188, 104, -114, 21, 
+	-77, -137, -50, -26, 26, 64, -62, -44, 
+	-82, -29, -6, -32, -8, -5, -1, -68, 
+	37, 93, 34, -71, -25, -141, 7, 17, 
+	57, 2, -54, -112, 39, -72, 81, 12, 
+	45, 17, -137, -19, 16, 70, -84, 58, 
+	40, -71, -2, -21, -58, 61, 48, -34, 
+	66, 35, -22, 21, -94, -99, -19, 10, 
+	48, -82, -18, -102, -8, -68, 104, -74, 
+	89, -57, -159, -31, 44, 115, -106, 54, 
+	6, -49, -10, -63, -5, 27, 67, 55, 
+	60, -30, -18, -102, 16, -39, 97, 1, 
+	-57, -20, -65, -44, 52, 92, 64, -46, 
+	139, -69, -45, 79, 16, 112, -12, -43, 
+	30, -89, -4, -32, 19, 79, 58, -2, 
+	42, -139, 118, -40, -53, 95, 64, -26, 
+	-109, 39, 26, -21, -51, 47, 34, -79, 
+	21, -116, -114, 18, 37, 59, -27, -53, 
+	103, -35, -40, -31, -5, 20, 94, -61, 
+	-42, -125, 37, -33, -35, -8, -11, 60, 
+	-37, -43, 59, -90, -1, 39, 67, -95, 
+	87, -101, -30, 32, -58, -11, -36, -67, 
+	-21, 88, -56, 24, 110, 47, -64, 0, 
+	-15, 76, 3, 64, -200, -146, -120, 72, 
+	120, -15, -8, -231, 50, -173, -9, -32, 
+	-43, 92, 29, -197, -39, 10, -22, 0, 
+	12, -63, 48, 14, 24, 22, -91, -10, 
+	41, 51, -83, 81, -207, -156, 72, 28, 
+	65, 41, -68, -316, 73, -211, 125, 65, 
+	-27, 101, 28, -57, -73, -107, -1, -10, 
+	-25, -114, 38, 145, -44, 40, -64, -3, 
+	72, 138, -66, 53, -26, -226, 179, -40, 
+	49, -39, -58, -66, 65, -96, 93, 27, 
+	-20, 55, -4, 28, -9, 17, -13, -15, 
+	-9, -106, -22, 24, -33, 28, 102, -115, 
+	112, 66, 116, -14, 21, 42, 60, 52, 
+	-42, 10, 65, 17, -45, 34, 115, -66, 
+	10, -33, -112, 49, 60, -68, -8, -25, 
+	43, -35, -63, -39, -53, 29, 95, -68, 
+	52, -12, 68, -89, -57, 12, -5, 2, 
+	-49, 23, 12, 0, -37, 31, -32, -18, 
+	2, -142, -97, -16, -5, 51, -9, -95, 
+	-36, 131, -14, -39, 27, 60, -22, 48, 
+	25, -30, -2, -62, -36, 7, -85, -2, 
+	62, 42, 46, 28, -45, 56, -14, 61, 
+	20, 18, 52, -18, 58, -134, 5, 40, 
+	-50, 90, -51, -58, 0, 5, -162, 53, 
+	-52, 14, -69, -3, -218, -56, -216, 16, 
+	-27, 41, -13, 58, -74, -38, -80, -4, 
+	1, 98, 109, -135, -87, -234, 81, 62, 
+	-14, -79, -70, 91, 30, -10, -223, 15, 
+	-164, 60, -94, 56, -209, -119, -169, -41, 
+	94, -17, -44, -88, -59, -123, -25, 53, 
+	-65, 199, 133, -224, -23, -266, 73, 152, 
+	-42, -39, 28, 76, -13, -19, -11, -23, 
+	36, 107, 34, -30, -178, -158, -27, -25, 
+	29, -3, 43, -127, 13, -128, 63, -13, 
+	73, 103, 41, -15, -67, -48, -53, 69, 
+	-13, -40, -11, 47, -34, 0, 45, -59, 
+	44, 56, 73, 7, -92, -170, 25, 59, 
+	-55, 20, 24, -165, 67, -102, 18, 9, 
+	15, 41, -102, -48, -19, 58, -96, 7, 
+	35, 44, -12, -162, -22, 8, -49, 13, 
+	-43, -107, -41, 0, 3, 47, 94, 11, 
+	-125, 11, -32, 52, -7, 54, 57, 2, 
+	2, -199, 48, 136, 27, -7, -28, -51, 
+	30, 53, 20, -128, -12, -39, -73, -12, 
+	-58, -24, -39, -90, -29, 52, 29, 65, 
+	-108, 0, 24, 66, -32, 64, -20, 14, 
+	99, -103, 39, 13, -31, -73, 52, -85, 
+	9, 95, -20, -35, -21, 2, -178, -83, 
+	-238, -12, -38, -60, -28, -3, -28, -44, 
+	-68, -43, -98, 18, -35, -43, -50, -21, 
+	52, -45, 42, -14, 38, -64, -8, -83, 
+	17, 24, 12, 40, 8, 70, -111, -32, 
+	-116, -69, -95, -63, 1, -50, 0, -42, 
+	-40, 31, -66, 43, -66, 16, -46, -93, 
+	-102, 21, -33, 22, 24, 55, 32, 8, 
+	35, 26, 64, 7, 50, -34, -140, -134, 
+	-82, -164, -102, 19, -16, 55, 87, -60, 
+	-111, 63, -64, 82, -8, 104, -1, -19, 
+	-34, -73, -87, 93, 21, 25, 75, -69, 
+	-23, 55, 47, -2, 45, -36, 62, -16, 
+	-30, -19, -45, -119, 8, -9, 12, -55, 
+	-129, 39, -43, -67, -52, 146, 55, -7, 
+	104, -130, -48, 32, 4, 62, 72, 6, 
+	22, 88, 30, -100, 63, 79, -51, -73, 
+	40, 45, -56, -42, -93, 46, -31, -10, 
+	-51, 87, 15, -125, -7, 8, 85, 31, 
+	80, -256, -151, -20, 82, -40, 49, 8, 
+	18, 58, 45, -76, 31, 1, -52, 19, 
+	-124, -117, -99, -125, -87, -49, -44, -17, 
+	-126, 18, -41, -101, 28, -13, 83, -31, 
+	121, -159, -6, 52, 45, -86, -17, -139, 
+	-15, -6, -32, 96, -61, -33, -91, -56, 
+	-95, -41, -88, 1, 25, -30, 105, -2, 
+	-94, 29, -95, -75, -14, 97, 5, -43, 
+	-49, -30, 35, 82, 4, 123, -33, -102, 
+	-51, 8, -37, -4, -11, -106, 6, -163, 
+	-142, 30, 0, -68, 101, 20, 91, -39, 
+	-111, -36, -56, 52, -169, 53, -154, -44, 
+	-58, -67, -47, 58, -59, 20, -81, -157, 
+	13, 25, 18, -139, -4, 66, 85, 37, 
+	66, 95, -57, -40, -216, -127, -6, 35, 
+	19, 39, 102, -208, 140, -80, 99, 88, 
+	81, 10, -95, -171, 7, -45, 59, 25, 
+	3, 37, 52, 9, -12, 7, 51, 18, 
+	103, -89, 34, 46, -44, -72, -140, 25, 
+	72, -52, 65, -85, 85, 21, 46, 2, 
+	100, 8, -30, 16, 79, 27, 21, 106, 
+	-36, 4, -28, 35, -43, 8, -79, 47, 
+	-40, -284, -19, 39, -23, -87, -91, 3, 
+	20, -11, 17, -17, 12, 72, -67, -61, 
+	21, 28, 2, 30, -14, 43, -26, 12, 
+	19, 52, -18, 52, -68, -30, -188, -14, 
+	-95, -189, -147, 32, -95, -32, -87, 15, 
+	-86, -80, -87, 15, -63, -43, -87, -23, 
+	-213, 32, 27, 2, -62, -39, -87, -12, 
+	-92, -56, -8, 5, 7, -105, -39, 15, 
+	-68, -41, -44, -10, -39, -5, -102, -37, 
+	-21, -85, -50, -39, 50, -31, -2, -22, 
+	-43, 42, -18, -13, -41, -11, -58, -59, 
+	30, -42, 119, -223, 58, 32, -5, -48, 
+	73, -84, -12, 26, 31, 100, 1, 46, 
+	-23, 165, 58, 51, 101, 128, 35, -36, 
+	60, -188, -53, 84, 7, -1, 89, 23, 
+	94, 24, 43, -13, 48, 37, -49, 52, 
+	65, -179, -9, 17, -46, 26, -12, -37, 
+	29, 28, 39, -78, 53, 62, -48, 66, 
+	101, -23, 19, 119, 21, 131, 3, -46, 
+	12, 21, 20, 99, 0, -24, -45, -4, 
+	-81, -172, -27, -74, -11, -83, 28, -16, 
+	-25, -29, -28, -63, -135, -3, -77, 40, 
+	-70, -34, 33, 17, 38, 115, -25, -88, 
+	-30, -68, -29, 22, -70, -44, -146, -39, 
+	-120, -89, -110, -134, -1, 4, -13, -44, 
+	-88, -69, -70, -39, -128, 29, -195, -64, 
+	-143, -144, 11, 4, 5, -2, -66, -40, 
+	-37, -33, -19, -20, 19, -110, -51, 29, 
+	-161, -155, -51, -25, 6, 46, -5, -68, 
+	-47, 14, -92, -6, -24, -44, -97, -22, 
+	-96, 5, 31, 19, 64, -96, 24, -56, 
+	-15, -81, 41, -59, 43, -17, 208, -67, 
+	62, 11, 120, -104, 132, 123, 78, 14, 
+	-31, 13, 38, 81, 13, 76, 51, -55, 
+	69, -285, -94, 55, 19, 145, -25, -78, 
+	31, 28, -54, 67, -18, 32, -49, 22, 
+	-3, -219, 41, -66, -113, -44, -28, 82, 
+	-22, -3, -2, -84, -53, -57, -31, 18, 
+	165, -62, -7, -1, 42, 60, 6, -109, 
+	-2, -28, -79, 34, -86, -47, 8, 28, 
+	-48, -220, -119, -32, -56, -79, -111, -88, 
+	-57, -23, -118, -93, -78, 8, -157, 10, 
+	-102, 16, 52, -106, -25, 85, -35, -102, 
+	-60, -62, -48, -56, -114, -71, -98, -64, 
+	-140, -129, -164, -137, -28, 6, -37, -31, 
+	-145, -99, -133, -30, -99, -20, -96, -51, 
+	-4, -70, -74, -12, -59, -69, -54, -56, 
+	-62, -48, -54, -110, -13, -78, 66, -52, 
+	-3, 55, -1, -42, -30, -5, 49, -31, 
+	17, 35, -91, 62, -3, 7, -3, -33, 
+	-82, 18, -67, 17, 7, -49, 14, -86, 
+	-43, -76, 52, -44, 10, -6, 219, -70, 
+	67, -222, 186, -58, 18, 102, -59, 54, 
+	-74, 5, 50, 10, -112, -52, -52, 17, 
+	8, -230, -212, -5, 27, 57, -63, -166, 
+	70, 56, 33, 14, -16, 3, 11, 81, 
+	77, -321, 45, -133, -97, -61, -6, 126, 
+	-135, -35, 80, -87, 0, 16, -18, -13, 
+	114, -180, 52, -64, -42, 63, -26, -213, 
+	-40, 14, -112, 78, -73, -112, -96, -25, 
+	-139, -121, -86, -31, -134, -88, -108, -60, 
+	-96, -91, -146, -179, -185, 1, -162, 42, 
+	-87, -85, 35, -79, -145, 73, 4, -124, 
+	-82, -87, -55, -106, -88, -125, 30, -92, 
+	-13, 2, -62, -83, -81, -69, -103, -58, 
+	-60, 4, -32, -99, -55, -101, -112, -76, 
+	-33, -100, -129, -48, -58, -47, -30, -94, 
+	-113, -33, -39, -54, -26, -57, 45, -42, 
+	-9, 23, -11, -80, -42, -39, -18, -44, 
+	-31, 14, -10, -63, 39, -119, 34, -44, 
+	6, -85, -112, -108, -64, -91, 22, -23, 
+	14, -44, 37, 24, -18, 43, 210, -87, 
+	110, 89, 203, -41, 150, 167, 32, 40, 
+	-78, 3, 85, 94, -118, 13, -49, 55, 
+	45, -29, -80, -54, 30, -8, -32, -99, 
+	-33, -37, 4, 40, 46, -6, 57, 35, 
+	-2, 19, 42, -105, -77, -17, -28, 110, 
+	31, -2, 52, -2, -21, -16, -90, -37, 
+	69, -54, 21, -105, -22, 35, -21, -61, 
+	-78, -6, -131, 118, -27, -45, -25, 48, 
+	79, 114, -64, -8, -94, -62, -198, 12, 
+	40, -64, -109, -113, 38, -139, -56, 57, 
+	-65, 21, 78, -161, -134, 28, 41, 29, 
+	-75, -36, -8, -60, 17, 36, -37, -4, 
+	16, 108, 10, 8, -14, -47, -105, -6, 
+	3, -58, -35, 22, 15, -123, 14, 4, 
+	12, 36, -93, -116, -16, -149, -73, -33, 
+	-54, -87, 13, -15, -29, -23, -2, -80, 
+	-24, 41, 40, 19, -22, 17, 15, 56, 
+	12, -28, 69, -2, 63, -41, 67, -15, 
+	8, 15, -47, -77, 14, -108, 32, -21, 
+	52, 53, 85, -33, 72, 61, -128, 36, 
+	104, 38, -108, 111, -12, -82, 109, 70, 
+	61, 162, 68, -68, 41, 109, 107, 106, 
+	-34, 72, 49, 139, 16, -7, 42, 98, 
+	-3, -56, -20, 14, 30, 26, -112, 79, 
+	-106, 154, -86, 45, -195, -11, 3, 64, 
+	89, 59, 4, -96, -71, -30, -58, 48, 
+	-22, 110, 120, -131, -57, -144, 26, 23, 
+	15, 52, -39, 59, -22, -9, 5, -45, 
+	-71, 155, -92, 39, -150, -132, -122, 35, 
+	62, -14, -62, -172, -23, -103, 13, 56, 
+	-48, 58, 11, -116, 9, -99, -28, 51, 
+	27, -23, 0, 50, 9, 43, 4, 15, 
+	49, -8, -74, -89, -233, -159, 2, 32, 
+	-5, 87, -35, -231, -41, 0, 31, -54, 
+	75, -42, -124, -16, 73, -30, 80, 59, 
+	33, 11, -47, -14, 34, 4, -105, 42, 
+	39, -7, 10, -17, -256, -267, 14, 14, 
+	-78, -4, -1, -263, 85, 26, 80, 35, 
+	50, -10, -28, 87, 1, 27, -18, 28, 
+	43, 151, 100, -111, 35, -5, -171, -47, 
+	-19, 14, -46, -29, 111, 142, 98, -46, 
+	-108, -19, -6, 181, 55, 192, -10, 36, 
+	35, -220, -14, 143, 115, 62, 77, 37, 
+	8, 5, 32, -183, 16, -26, -83, 5, 
+	-96, -98, -44, -34, 105, 101, -77, -97, 
+	-2, 38, -31, 211, -134, 144, -100, 50, 
+	-28, -89, 98, 48, 2, -254, 151, -10, 
+	27, 89, -31, 27, -20, -3, -84, 26, 
+	-133, -49, -66, 77, 2, 25, -175, 27, 
+	-20, 43, 8, 57, -69, -25, -58, 33, 
+	-74, 26, 116, -95, -72, -204, -9, -51, 
+	-32, -8, -27, 111, 53, -29, -85, -48, 
+	-66, 4, -9, 37, -28, -21, -109, 13, 
+	-59, -40, -6, -13, -80, 7, -17, 76, 
+	-57, -8, 7, 30, 4, -57, -80, 24, 
+	-43, 25, -10, 85, -10, 0, -152, 58, 
+	-98, 62, -74, -22, -106, -186, 33, 24, 
+	-55, -15, -118, -102, -30, -20, 44, 11, 
+	44, -88, -35, -22, -35, -42, -42, 1, 
+	19, 51, 16, -10, -7, -2, -79, -48, 
+	-132, 37, -87, -28, 43, -12, 128, -18, 
+	-93, 18, -107, 44, -16, 34, -37, -9, 
+	-11, -132, -63, 133, -22, 7, -56, -61, 
+	-1, 0, 25, -200, -6, 56, -36, -35, 
+	-53, 53, -15, -52, 83, 202, 55, -46, 
+	-63, -86, -24, 198, -27, 113, -26, -53, 
+	80, -239, -111, 86, 93, -131, 27, -130, 
+	61, 85, 3, -28, -4, 37, -16, 109, 
+	-127, -219, 66, -78, 38, 139, -112, -10, 
+	-6, -61, 33, 178, -10, 56, -86, -7, 
+	134, -46, 107, -72, 89, -90, 33, -183, 
+	43, -5, -46, 72, 14, 1, -60, 7, 
+	-174, -98, 71, 17, -5, 134, -185, -21, 
+	50, 55, -12, 79, -77, -42, -178, 74, 
+	-67, 43, 118, -88, -62, -3, 22, 35, 
+	-40, -19, -69, 81, -26, -99, -137, 155, 
+	-139, 80, -99, 27, -57, -39, -79, -12, 
+	57, 38, -113, -65, 43, -87, -80, -5, 
+	42, 134, 114, -68, -87, -71, -35, 17, 
+	-54, 53, -95, 12, -30, -9, -75, -39, 
+	-48, 106, -89, 28, -28, -144, 1, -47, 
+	-6, -40, -87, -105, 24, -49, 15, 9, 
+	-24, 25, -4, -94, 1, 4, -51, 95, 
+	59, -69, 38, -72, 23, 23, -22, -40, 
+	20, -62, 69, 24, 65, -14, 52, -40, 
+	5, -10, -17, -37, 10, -63, 80, -60, 
+	97, -122, -183, -25, -28, -67, -97, -83, 
+	17, 20, -33, -48, -53, 28, 77, 19, 
+	-33, -136, 103, -174, 49, 42, 14, -45, 
+	-120, 25, -39, 71, 13, 85, -35, 6, 
+	109, -111, 12, 44, 81, -9, 12, -169, 
+	3, 64, -32, 30, -75, 18, 27, 24, 
+	-80, -238, 112, -150, 45, 92, -47, -12, 
+	-101, -46, 36, 108, -59, 68, -84, -13, 
+	66, -76, 68, 32, 39, 10, 50, -103, 
+	15, -14, 58, -70, 39, 16, -136, 102, 
+	-41, -195, -48, -64, 38, 69, -128, -2, 
+	2, -88, 34, 52, 19, 36, -44, -6, 
+	-7, 79, 158, -65, -2, -22, 149, 20, 
+	-40, -49, -37, -132, -51, -89, -62, -45, 
+	10, -23, -107, -3, -32, -35, 83, -149, 
+	-61, 14, -95, -24, -49, 31, 80, -33, 
+	12, -119, -78, 97, -51, 89, -30, 3, 
+	9, -33, -35, -82, -35, -44, 57, 14, 
+	107, 29, -50, -35, -13, -122, 156, 11, 
+	-55, 36, -78, -167, 16, 77, 70, -33, 
+	43, -25, -62, 62, 23, 121, -16, -5, 
+	14, 35, -22, -113, -23, 49, 108, -20, 
+	90, 67, -41, 38, 21, 4, 153, -5, 
+	-42, 55, -47, -117, 100, 12, 98, -54, 
+	128, -20, -84, 8, -1, 91, -19, 56, 
+	23, -19, -20, -23, -56, 75, 67, -136, 
+	82, 9, 96, -50, 40, -19, 59, 27, 
+	18, -15, 54, 49, -46, 30, 115, -52, 
+	44, -172, -164, 68, 3, 52, -61, -63, 
+	-48, -45, -29, -80, -93, 67, -33, -64, 
+	-124, -150, 58, -175, 50, 90, 68, 45, 
+	-128, 10, 62, 173, -59, 53, 15, -8, 
+	-49, -210, -79, 101, 50, -61, -21, -288, 
+	46, 1, -30, 49, -88, -23, 20, 8, 
+	-4, 21, 12, -22, -24, -16, 54, -33, 
+	-16, -91, -21, 66, 76, 43, 37, -58, 
+	59, 24, -26, -36, 37, -35, 8, -26, 
+	-26, 38, 37, -77, -15, 29, 47, -76, 
+	-9, 23, 1, -12, 65, 89, 87, 85, 
+	6, 59, 63, 95, 8, 111, 51, 52, 
+	-56, -24, -75, 67, 57, -55, 154, -10, 
+	65, 74, 4, -27, 56, 71, -76, 143, 
+	-22, -106, 19, 26, -140, 119, -86, 64, 
+	18, 40, 78, -19, 50, 48, 16, -48, 
+	61, 22, 140, -91, 52, -190, 92, -19, 
+	42, 93, -32, 153, 19, 20, -112, -12, 
+	-75, -148, -89, 36, -101, -128, -125, 42, 
+	43, -10, 12, -98, -40, -136, -48, 57, 
+	-20, 113, -20, -84, 51, 107, 9, 32, 
+	-67, -75, 37, -70, -10, -53, -218, -76, 
+	-54, -93, -100, 20, 36, -130, 7, -94, 
+	17, -9, -52, 13, 36, 27, -118, 65, 
+	-202, 8, -18, 23, -24, 23, -10, 9, 
+	-22, 19, -13, 97, -89, -101, -87, -62, 
+	-207, 49, -103, -42, 91, 81, 101, -24, 
+	-16, -76, -77, 134, -147, 80, -34, -16, 
+	-90, 67, -75, 5, -62, 29, 32, 15, 
+	-2, -45, -21, -61, 63, -14, 104, -105, 
+	4, 15, 104, -31, 21, 128, 83, 35, 
+	52, 152, 82, 6, 4, 99, -4, 26, 
+	-82, 5, -200, 46, -63, -52, 54, -67, 
+	75, 65, -16, -101, 57, 34, -38, 80, 
+	71, -71, 6, -44, -76, 80, -236, 30, 
+	40, 91, 26, -103, 38, -104, 17, 29, 
+	183, -70, 104, -184, -20, -167, 10, -55, 
+	-40, 98, -17, 143, 3, 25, -5, -31, 
+	-12, -139, -33, -29, -80, -207, -52, 19, 
+	89, -27, -30, -118, -33, -31, -82, 50, 
+	-35, 93, 16, -68, 16, 166, 90, -8, 
+	-52, 0, -59, -13, -100, -4, -256, -98, 
+	-107, -37, -210, -46, 44, -41, 2, -134, 
+	-99, -31, -131, 47, 7, 10, -176, -31, 
+	-200, 0, -93, 60, -34, 10, -73, -81, 
+	-124, -10, -127, 95, -50, -90, -16, 48, 
+	-135, 75, -185, 37, 41, -10, 111, -82, 
+	14, 14, -68, -40, -46, 31, -152, 40, 
+	-174, 80, 23, 27, -112, 19, -22, -12, 
+	32, -42, 36, -223, 59, 112, 178, -60, 
+	61, 70, 68, 122, -11, 26, -177, 59, 
+	-5, 4, 83, 2, -17, -59, 63, 28, 
+	-57, -20, -164, -80, 17, -180, 7, 14, 
+	17, 59, 24, -117, 39, 65, -42, 50, 
+	25, -294, -11, -14, -78, -60, -115, 60, 
+	-24, 13, 77, -100, 93, -20, 42, -33, 
+	196, -66, 4, -61, 100, 36, -145, 12, 
+	22, 98, -63, 154, -127, -4, -267, -4, 
+	-75, -185, -59, 16, -65, -163, 17, -45, 
+	-48, -66, -93, -84, -177, 63, -108, -6, 
+	-116, 3, 90, 92, -18, 138, -10, 1, 
+	-67, -84, -63, 43, -86, -94, -180, -101, 
+	-49, 44, -215, -58, -9, 1, 66, -208, 
+	-64, -70, -204, -64, -42, 49, -93, -34, 
+	-325, -9, -1, 96, -28, 16, 30, 1, 
+	-8, 34, -46, -25, 25, -22, -43, -16, 
+	-8, 98, -160, 135, -74, -103, -70, -128, 
+	84, -75, -44, -132, 26, -73, 62, 72, 
+	-70, 18, 24, -83, -41, -48, -15, 93, 
+	72, -17, 85, -301, 4, 47, 113, -129, 
+	109, -218, 177, 158, 119, -14, -85, 79, 
+	-8, 64, 112, 9, -11, 54, 120, -51, 
+	30, -184, -190, 21, 42, 15, -106, 47, 
+	52, 68, 19, 46, 41, 37, -175, 54, 
+	-67, -70, -78, -156, -70, 30, 168, 51, 
+	-103, 72, 13, -7, -94, 153, -44, 13, 
+	68, -64, 1, 63, 24, 150, -62, -117, 
+	-19, 34, -75, 119, -163, -158, -53, -99, 
+	-19, 5, -165, -70, 71, -34, 47, -92, 
+	29, -80, -189, 2, -85, 120, -211, -9, 
+	-232, -67, 46, 57, -35, 118, 66, -61, 
+	-42, -2, -63, -17, -55, -70, -106, -16, 
+	23, -23, -131, 8, 49, -78, 65, -63, 
+	-40, -147, -155, -8, 78, -32, -25, 25, 
+	-103, -3, -41, 34, -35, -49, 27, 26, 
+	12, 33, 49, -183, 42, 46, -23, -67, 
+	-33, -112, -55, 126, -32, -33, 24, -73, 
+	59, 31, -31, -146, -14, 69, 36, 89, 
+	-124, -60, -96, 27, 77, 1, -76, -2, 
+	53, 13, -25, -70, 57, 34, 92, -37, 
+	-26, -78, 13, -12, 77, 2, -13, 64, 
+	-138, 47, 64, -6, -134, 57, 36, -45, 
+	33, -105, 8, 51, 19, 37, -7, -120, 
+	24, 35, -63, 21, -32, -77, -213, -47, 
+	-221, 155, -94, -143, -57, -21, 76, -60, 
+	-40, -73, -102, 74, -112, 89, -132, 1, 
+	-68, 16, -52, 40, -1, 55, 1, 85, 
+	-89, 36, -21, 15, -27, -148, 2, -84, 
+	-33, 54, -153, -32, -4, -78, -96, -89, 
+	-58, -49, -135, -4, 5, 32, -57, 41, 
+	-163, -86, -52, 32, -46, 22, 33, 81, 
+	-66, -94, -68, 0, -10, -80, -120, 14, 
+	13, 34, -79, -11, -5, -84, 9, -93, 
+	-28, -22, -112, -119, -2, -35, -103, -42, 
+	-65, 125, 42, 5, -107, -101, -3, -14, 
+	-55, -41, -8, 79, -9, -38, -14, 11, 
+	-45, -89, -65, -13, 93, -39, -71, -68, 
+	18, -34, -28, 18, -145, -109, -8, -46, 
+	11, 74, -120, 19, -69, 57, 16, 35, 
+	-16, -63, 19, -51, -26, -56, 108, -36, 
+	-96, 4, 18, 2, 139, -23, 105, -5, 
+	10, 21, -30, -32, 38, 12, 26, -41, 
+	45, -57, -47, 99, 15, -4, 28, -81, 
+	36, -67, 63, -88, 9, -84, 102, -48, 
+	-16, 171, -75, -69, 64, -40, 189, 41, 
+	61, 114, 32, -80, 40, 60, 10, 18, 
+	-8, -13, -165, 146, -55, 101, 17, 30, 
+	-12, -25, 52, -151, 99, 46, 69, -141, 
+	151, 174, -5, -22, 18, -91, 96, 87, 
+	87, 148, 48, -97, 49, 76, -14, 92, 
+	-56, -121, -304, 56, -73, 34, -78, 70, 
+	3, 56, 35, -193, 69, 45, 19, 89, 
+	85, 148, -51, -38, -96, -119, -19, 39, 
+	138, 43, 93, -225, 131, -37, -6, 68, 
+	-5, 49, -23, -89, -57, 10, 112, 119, 
+	-11, -6, -72, 13, -64, -47, 82, 8, 
+	-72, -2, -58, -1, 104, -23, 11, 6, 
+	-18, 28, -90, -61, -12, -92, -44, -9, 
+	-43, 57, 0, -13, -37, 77, 18, -7, 
+	-99, -51, -69, -30, -30, -95, 23, 52, 
+	118, 119, 73, 12, 73, -13, 49, -33, 
+	19, -14, -39, 35, -8, -77, -18, -104, 
+	12, 31, -10, -34, -68, -6, 66, 28, 
+	-9, -10, 34, -21, -11, 20, 109, -48, 
+	45, 166, 125, 64, 23, 50, -73, -19, 
+	94, -7, 117, 48, 121, -96, 185, -6, 
+	68, -58, -99, -37, -20, -24, 91, 136, 
+	74, -18, 123, -198, 29, 34, 30, -196, 
+	129, -29, -38, 102, -43, -92, -53, 60, 
+	-8, 26, 103, -155, 159, 74, 191, 68, 
+	75, -130, -212, -64, -60, -73, -82, 105, 
+	136, 96, 83, -187, 119, 71, -1, -154, 
+	-5, -148, -8, 154, -82, -22, -65, 4, 
+	37, 76, 98, -156, 125, 69, 86, 43, 
+	1, -184, -143, 94, 101, -119, 11, 40, 
+	-27, -56, -49, -12, -22, -50, 32, 16, 
+	6, -122, 55, -3, 85, -42, -115, -66, 
+	1, -112, -118, -17, 69, -90, -96, -94, 
+	-127, -6, 24, -79, -72, 63, -4, 48, 
+	26, -64, 24, 65, -57, -39, 36, 22, 
+	-6, -153, 79, 44, 88, -24, -93, -56, 
+	-87, -30, -12, 107, -7, 2, 14, -62, 
+	-78, -40, 86, -54, -72, -89, 10, -31, 
+	28, -15, 16, 1, -56, 13, 26, -84, 
+	-38, -129, 79, -31, 64, 101, -62, -33, 
+	-127, 61, 122, 154, -101, 17, 51, -30, 
+	-25, -127, 40, 23, -32, -151, -7, -72, 
+	11, -52, 19, -43, -27, -58, 57, 80, 
+	-70, -141, 26, -104, -4, 115, -23, 54, 
+	-53, 40, 105, 105, -16, -52, -89, 72, 
+	23, -158, -50, -12, -92, -40, -34, -64, 
+	31, 11, 36, -27, 8, 31, 119, 62, 
+	123, 149, 143, -19, 12, 126, 47, 16, 
+	32, 35, 105, -64, 136, 14, -52, 126, 
+	23, -22, -34, 50, 11, -13, -10, 44, 
+	-87, -20, -90, 45, -30, 20, -8, 36, 
+	1, 43, -65, -8, -20, -174, -11, 42, 
+	44, 28, -15, -64, 56, -103, 23, 17, 
+	-46, 77, -6, -94, -13, 69, -85, 60, 
+	-95, -118, -100, 3, -2, -54, -92, 77, 
+	-105, 31, 1, 40, 42, -46, 25, 6, 
+	-1, -37, -42, 56, -8, -25, -28, 23, 
+	-94, 41, 54, -73, -31, -61, -74, -106, 
+	-28, -5, -75, 35, -52, -66, -16, -67, 
+	-96, -22, -15, -63, 61, 5, 51, -17, 
+	-37, -79, -19, 80, -22, 8, -143, 23, 
+	-145, 85, -26, -11, 62, -162, -99, -75, 
+	22, -30, -1, -74, -97, 21, 48, -145, 
+	-96, -80, 52, -103, 106, 147, 80, 65, 
+	-46, 16, -22, 228, -142, -26, -81, 26, 
+	-20, -137, -112, 40, 24, -162, 69, -174, 
+	-6, 20, 26, -101, 34, -22, -16, -51, 
+	-173, -70, 123, -152, 90, 203, -74, 42, 
+	-104, 61, 88, 205, -104, 16, -157, -71, 
+	-71, -104, -64, 116, 42, 18, 174, -167, 
+	-65, 34, 18, 54, -16, 6, -106, 9, 
+	24, 12, -21, -1, -138, -181, -137, -30, 
+	41, 23, 20, -285, 44, -75, 38, -13, 
+	-23, -2, 19, -141, 19, -35, -1, 8, 
+	-47, -42, -32, -43, -35, -10, -82, 111, 
+	23, 67, -109, -8, -241, -118, -34, -75, 
+	17, -9, -59, -217, 148, -51, -114, 20, 
+	-77, 121, 32, -95, -50, -58, -76, 11, 
+	-104, -15, -146, -80, -3, -64, -152, 57, 
+	127, 137, -129, -4, -102, -123, -58, 20, 
+	110, -20, -18, -199, 127, -119, -42, 48, 
+	-77, 129, 99, -108, -105, -104, -2, 29, 
+	-76, -42, -114, -1, 32, 56, 22, 6, 
+	46, 214, 41, 12, -70, -119, 70, -35, 
+	28, 55, -18, -100, -51, -126, -82, 112, 
+	-109, 122, 0, -29, -77, -78, -71, -21, 
+	24, -3, -36, -151, 44, 138, 33, -127, 
+	27, 191, 146, -103, -9, -33, -16, 39, 
+	13, -51, 93, 87, -50, -71, -30, 112, 
+	22, -34, -112, -37, 16, -91, -155, -8, 
+	-9, -18, -17, -237, -13, 26, 12, -18, 
+	146, -75, 51, 42, -26, 6, -70, -22, 
+	40, 12, 62, -46, 63, -6, 74, -88, 
+	-62, -60, -107, -73, 3, -7, -12, 92, 
+	18, 35, 37, -160, 42, 81, -9, -27, 
+	3, -100, -28, 98, -84, -76, -52, 72, 
+	-46, -1, 49, -67, 7, -14, 123, 21, 
+	-18, -44, -81, -87, 60, -82, 0, 12, 
+	54, 34, 28, -67, 37, -40, -65, 81, 
+	-17, -46, -20, 89, -69, 29, 2, 72, 
+	20, 41, 43, -85, -33, -28, 8, 41, 
+	7, 12, 0, 44, 38, -29, -66, -65, 
+	17, 56, -2, 49, 59, -76, -126, 48, 
+	45, 146, -124, 23, -102, -70, 121, -18, 
+	38, 55, -48, -44, 64, -24, -58, 90, 
+	-116, 98, 94, 79, -30, -61, 16, 61, 
+	-64, -60, -70, 30, 10, -61, -117, -42, 
+	25, 141, -77, 41, 111, 22, 88, -47, 
+	-52, -67, -39, 255, 92, 16, 20, 30, 
+	-61, 69, -66, 110, -14, -115, -1, 74, 
+	-6, 41, 4, -170, -16, 83, 56, -75, 
+	-46, 10, 88, 7, 30, 1, 75, 21, 
+	-32, 56, 111, 44, -52, -44, 32, -13, 
+	-42, -88, -144, 37, 23, -35, -57, -54, 
+	18, 85, 5, -62, -29, 63, 3, -100, 
+	8, 1, -38, -17, -5, 43, 8, 0, 
+	3, 5, -20, 14, -13, -5, -40, 11, 
+	-44, -54, -76, 27, 5, -3, -72, -44, 
+	-43, 91, -4, -38, 2, -21, 17, -3, 
+	-80, -24, -71, -48, 61, 29, -196, -28, 
+	75, -41, -2, 132, 39, 19, -50, 21, 
+	15, -63, 59, -80, 40, -196, 81, 33, 
+	-27, 42, 16, 11, -26, -40, -83, 73, 
+	-60, -71, 39, 78, -132, 117, -213, 37, 
+	40, 23, 1, 85, 116, -82, -60, -50, 
+	-60, 26, 241, -188, -67, -128, 188, 69, 
+	-43, -25, 36, 144, -38, -100, -168, 8, 
+	-79, 116, -141, 139, -41, -66, -48, -77, 
+	29, -34, -91, -18, -8, -74, -48, 99, 
+	-80, 139, 172, -12, -70, -100, 77, 92, 
+	-36, 24, -57, -137, -38, 13, 76, -59, 
+	73, 76, 79, 36, -36, 77, 14, -21, 
+	46, -40, 60, 43, 55, -12, 16, 62, 
+	-3, 38, -72, -45, 48, -152, -69, 66, 
+	-21, 30, -6, -129, -15, -43, -129, -61, 
+	82, 8, -84, 30, -21, -81, 67, 2, 
+	-48, 9, 31, -122, 81, 68, 75, -96, 
+	34, -44, -163, 87, -8, 14, -110, 28, 
+	-71, -93, -25, -266, 2, 5, 30, -35, 
+	-71, 50, -22, 8, 131, 7, 52, -27, 
+	-22, 40, 15, 4, 56, 0, 18, -66, 
+	-74, -16, -10, 132, 28, -132, -60, -99, 
+	69, 60, 20, -66, 23, 3, 29, 112, 
+	-101, -24, 186, -70, 25, 70, -86, 34, 
+	30, 46, 51, 110, -37, -8, -6, -58, 
+	42, 5, 138, -10, 20, -132, 22, -58, 
+	58, 115, -50, 206, 11, -42, -272, 100, 
+	-180, -5, -76, 2, -79, -34, -119, 12, 
+	21, -30, -87, 95, -76, -107, -140, 18, 
+	-5, 120, 232, -110, 19, 51, 52, -52, 
+	47, -8, -4, -139, 22, 33, -38, -99, 
+	55, 26, 11, 40, -36, 7, 73, -2, 
+	23, 26, 61, 78, -42, 24, 77, -40, 
+	21, -42, -142, 94, 74, -6, -26, 82, 
+	9, -27, -17, -80, 43, 36, -156, -87, 
+	-12, 105, -119, 80, -206, -32, 72, 39, 
+	-19, 63, -42, -36, 27, 90, 1, 24, 
+	-65, -70, -96, 44, -30, 43, -1, 92, 
+	-68, 41, -72, -117, -3, -26, 27, -54, 
+	2, 39, -87, 3, -145, -31, -11, -66, 
+	47, -26, 37, -143, 84, -55, 49, -45, 
+	-3, -71, -71, -39, -66, -41, -4, -14, 
+	79, -19, 61, -66, 42, 135, 112, 11, 
+	91, -227, 86, 63, -94, -90, -53, 89, 
+	-43, 53, 78, -91, 23, -12, 110, -19, 
+	41, -144, -70, -52, 53, -25, -70, -115, 
+	21, 51, -19, 69, -35, 48, -88, 76, 
+	-83, -210, 36, -80, -88, -56, -88, 0, 
+	-124, -89, -1, -34, -55, -53, 6, -25, 
+	19, -104, 45, -71, 36, 92, -44, -170, 
+	26, 1, 28, -148, 50, -18, 40, -59, 
+	53, 204, 15, -59, -48, -24, 83, -58, 
+	17, 23, -20, -48, 23, 58, 21, 85, 
+	-42, 4, -124, 33, -2, -77, -26, 94, 
+	34, 15, 16, -66, -57, -25, -46, -70, 
+	47, 73, -73, 30, -12, 28, 37, -24, 
+	43, -49, 56, 27, -6, 12, 83, -3, 
+	34, -46, -134, 51, -11, -49, -17, 76, 
+	31, 64, 70, -145, 23, -16, 25, -14, 
+	-42, 68, -78, 66, -51, -36, 5, 13, 
+	-46, 42, 83, -39, 24, 48, 58, 35, 
+	40, -51, -165, -1, 68, 3, -1, 11, 
+	83, 68, 66, -59, 62, 77, 1, -42, 
+	54, -59, 75, 3, -156, 0, -25, 14, 
+	-67, 69, 15, -87, 8, 46, 17, -10, 
+	4, -156, -38, -30, -5, 83, -57, -63, 
+	42, -14, -9, 92, 29, 65, -66, 25, 
+	-21, -11, -118, -93, -149, -87, -105, 22, 
+	-29, 24, 8, -124, 9, -67, -89, -23, 
+	-11, -53, 58, -77, 45, 50, -97, 3, 
+	-11, -32, 59, 16, 82, 54, -67, 19, 
+	-17, -10, 19, 78, -66, 38, -108, -12, 
+	50, 68, -51, 5, 25, -53, 54, -48, 
+	-64, 88, 55, -44, 47, -64, 44, 27, 
+	-38, -6, 5, 35, 3, 13, -162, -50, 
+	-129, -36, -102, -12, -74, -175, 56, 26, 
+	-66, 11, -63, -110, -77, -34, 35, 17, 
+	40, 41, 72, -28, -51, 43, -184, -66, 
+	25, -12, -88, 93, -46, -68, 27, -40, 
+	-22, 127, -10, -10, -46, -61, 48, -42, 
+	38, -75, -59, -85, 8, 24, 40, -24, 
+	-12, -69, -78, 0, 33, 106, -82, -21, 
+	-5, 5, 11, -30, -24, -29, -18, -30, 
+	25, 53, -63, 7, -15, -20, -26, 38, 
+	27, -51, -49, -36, 42, -51, 115, -22, 
+	104, -26, -109, -100, 3, -92, -66, -40, 
+	2, -42, 3, 4, -12, 3, -125, -28, 
+	50, 8, -66, -65, -60, -77, 22, -31, 
+	-7, 36, -31, -25, 18, 88, 49, -7, 
+	80, -36, 17, 33, 49, -4, -69, -31, 
+	11, 40, -38, -2, 39, 16, -82, 14, 
+	-110, 8, -88, 19, -11, -25, 46, 46, 
+	59, 27, -13, -11, 12, 31, -57, 1, 
+	14, 5, 12, 19, 14, 7, -18, -53, 
+	-48, 10, -51, 111, 16, -63, -95, 93, 
+	-6, 168, -149, 26, -87, -87, -4, -64, 
+	12, -28, -3, -67, -24, 35, -77, 23, 
+	-57, 113, 74, -69, 43, 6, -10, 95, 
+	39, -9, 39, -15, -31, 44, 17, 14, 
+	26, 154, -37, 48, -85, -74, -4, -20, 
+	2, 47, -48, -217, 43, 27, 118, -64, 
+	76, 5, -102, 93, 51, -43, -66, 133, 
+	-49, -9, 26, -91, -16, 13, -39, 11, 
+	84, 198, 15, -47, -46, -36, 82, -37, 
+	-15, 39, 3, -57, -10, 132, 95, 18, 
+	70, -56, -99, 103, 46, 106, -73, 76, 
+	34, -60, -22, 14, 45, -80, -201, 41, 
+	-36, 33, -60, -81, -55, -83, 49, -7, 
+	-61, 25, -80, -52, -17, -15, -5, -7, 
+	124, -5, 66, 32, -73, 21, -65, -60, 
+	10, 47, 27, 51, -56, -16, -120, -54, 
+	-116, -96, -53, -65, -111, -60, -42, 19, 
+	-75, -63, 21, -20, -77, 20, 20, 18, 
+	-20, -22, 81, 14, -35, -22, 3, 16, 
+	75, -58, 19, -7, 23, 37, -66, -54, 
+	-40, -48, 10, -8, -20, -72, 11, 32, 
+	-8, -42, 6, 6, -56, 14, 79, -99, 
+	55, -148, -37, 23, -2, 40, 89, 121, 
+	62, -19, 58, 32, 18, -38, -115, -16, 
+	-1, 118, -88, 52, -114, -139, 150, 11, 
+	-76, 74, -38, -91, -45, 42, 118, 15, 
+	-4, -100, -76, 108, -45, 117, -28, 41, 
+	-2, -18, 45, 78, 28, -4, -172, -82, 
+	-78, 171, -114, 6, -101, -155, 93, -66, 
+	-36, 22, -105, -194, -12, -8, 63, 10, 
+	36, -72, -64, -11, -21, -4, 3, -17, 
+	-23, 39, 37, -31, 3, -62, -222, 18, 
+	-80, 32, -147, 3, -159, -93, -29, -23, 
+	-77, -3, -50, -90, -21, -144, -5, -10, 
+	227, -99, 10, -173, 23, -69, -25, -51, 
+	-35, -21, -4, 97, -46, -13, -17, 70, 
+	-93, 51, -79, 0, -81, -26, -54, 26, 
+	-32, -8, -71, 7, -66, -137, -21, 31, 
+	-23, 87, 120, -66, 7, -116, -10, -37, 
+	-60, -27, 9, 36, 34, 29, 38, 43, 
+	24, 114, -6, 5, -3, 31, -37, 40, 
+	6, 7, 28, -13, -37, -124, -11, -6, 
+	78, 85, -52, -98, 48, -30, -57, 54, 
+	-55, 56, 27, 130, 72, -20, -51, 119, 
+	-15, 106, -36, 2, -80, -71, -56, -35, 
+	10, -20, -49, -76, 55, -92, -47, 23, 
+	7, 100, 36, -136, -3, -112, 57, 70, 
+	-29, -29, -5, 0, 9, -45, -175, -61, 
+	-45, 145, -146, 100, -152, -196, -139, 26, 
+	68, 3, -105, -163, 46, -64, 66, 30, 
+	15, 52, -121, -39, -13, -119, 42, 70, 
+	-70, -31, 11, -119, -7, 30, -158, 73, 
+	4, 112, -156, 1, -160, -198, 55, 39, 
+	32, 43, 0, -120, -7, 70, 29, 2, 
+	81, 1, -51, 51, 11, 13, 14, 72, 
+	-25, 46, -55, -46, -15, -27, -129, -58, 
+	-96, -191, -21, -25, -22, 53, -71, -74, 
+	-19, 10, -62, 67, -46, 41, -50, -76, 
+	-139, -112, 25, 6, 36, -208, 30, -18, 
+	19, 49, 24, -69, 22, 0, -105, 11, 
+	-52, -157, -56, -43, -36, -87, -6, 7, 
+	-27, 13, -43, 58, -42, 26, -115, -64, 
+	-29, -26, 70, 53, 9, -93, 41, 68, 
+	93, -21, 41, -39, -3, -94, -34, 18, 
+	-92, 100, -55, 78, -3, -58, 29, -15, 
+	-37, 70, 2, 22, -53, 86, 10, -7, 
+	-57, -10, -39, 102, 4, -75, -4, 55, 
+	73, -46, 53, -124, 74, -84, -308, -3, 
+	-72, 193, -111, -29, 55, -19, 77, -69, 
+	17, 84, -31, 18, -92, 4, -28, 31, 
+	-75, -103, -74, 174, -10, -15, -19, -27, 
+	-25, -55, 0, -116, 63, -69, -147, -71, 
+	-90, 134, -89, -27, -108, -63, 53, -47, 
+	6, 86, -61, -23, -54, -23, -9, -40, 
+	-82, -61, -9, 58, 25, 51, -101, 9, 
+	35, -14, 55, 12, -7, 37, 63, -17, 
+	86, -149, 40, -30, 66, -2, -74, 15, 
+	-17, -41, -15, -30, 60, -61, 137, 8, 
+	66, -12, -30, -117, 62, 79, -43, 12, 
+	-18, 15, -2, 43, -72, -10, 101, 58, 
+	9, -169, 87, -56, -68, 0, -113, -25, 
+	-45, -4, 78, -78, -126, 21, 22, -58, 
+	132, -72, 30, -120, 44, 154, 51, -110, 
+	6, -73, 20, 21, -12, 23, 75, -105, 
+	25, -174, 179, -39, -121, 56, -69, 49, 
+	-146, -45, 36, -102, -48, -87, 2, -25, 
+	209, -177, -114, -134, 14, 67, -122, -133, 
+	70, -49, 25, 100, 27, 58, 38, -11, 
+	22, -145, 44, -76, -152, -76, -36, 59, 
+	-146, -68, 66, -74, -30, -66, 25, -43, 
+	158, -165, -46, -28, 39, 95, -4, -123, 
+	-64, 16, 27, 83, -77, -16, -131, -144, 
+	-59, -125, -92, -135, -44, -140, 119, -66, 
+	-192, -101, -102, -120, -148, 43, -56, -106, 
+	-8, -169, -166, 97, -11, 131, -59, -88, 
+	-32, -74, 72, 134, -25, -10, -64, -22, 
+	-38, 2, 3, 56, -76, -165, 45, 18, 
+	3, -26, -62, -116, 63, -30, 86, 30, 
+	76, -6, 42, -19, -31, 31, -124, -20, 
+	-35, -36, -17, 116, -103, 54, 31, -86, 
+	-86, -31, 129, -95, -3, -34, 14, -21, 
+	-61, -121, -31, -2, -34, 38, -26, -112, 
+	67, -44, -152, -8, -40, 89, -122, -163, 
+	-6, -42, -36, -30, -29, 13, 17, -44, 
+	12, -25, 175, -43, -70, 35, -33, 62, 
+	-81, 21, 17, -131, 21, -82, -34, -40, 
+	136, -128, -49, -96, -13, 93, -119, -117, 
+	43, -30, -15, 53, 25, 50, -66, -25, 
+	29, 24, 121, 49, -142, -105, 101, 99, 
+	8, 54, 22, -206, 24, -111, -30, -10, 
+	41, 8, 19, -131, -69, 126, -131, -24, 
+	-113, -25, -110, 131, 29, -43, -101, 2, 
+	-32, 119, -155, 40, -80, -235, 69, 46, 
+	65, -94, -132, -68, 67, -90, -42, -25, 
+	-60, 89, -23, 17, -47, 36, -11, -49, 
+	-116, 2, -27, 76, 20, -105, -116, 121, 
+	-91, 158, -191, 8, -230, 17, -218, 47, 
+	40, 36, -10, -6, 55, 30, -99, 44, 
+	-60, 191, 77, -193, -44, -169, 89, 116, 
+	-66, -125, -41, 147, -14, -42, 13, 27, 
+	5, 166, 55, -40, -176, -147, -80, 12, 
+	80, 63, 48, -144, -23, -11, -54, 148, 
+	-38, 96, -64, -217, -32, -62, -26, 122, 
+	36, -42, 24, -54, 37, 6, 45, 68, 
+	86, 160, 109, -2, -153, -182, -176, 46, 
+	69, 72, 71, -159, 74, -110, 24, 0, 
+	96, 41, -114, -179, 10, 19, -19, 57, 
+	-42, 88, -45, 25, -15, 15, 28, 34, 
+	-21, 119, -13, 26, -137, -243, -113, 73, 
+	4, -19, -24, -162, 61, -15, -29, 59, 
+	39, 21, 43, -137, -29, -149, 54, 148, 
+	-28, -22, 13, -50, -15, -24, -155, 81, 
+	13, 124, -107, 32, -43, -121, -111, -82, 
+	28, 22, -41, -31, 68, -54, -50, 83, 
+	23, 117, 21, -74, 25, -111, -5, 140, 
+	-37, -3, 64, -101, 27, -147, -127, -22, 
+	-64, 40, -30, -24, 217, 89, 150, -80, 
+	-96, -98, -37, 241, -114, 104, -147, -36, 
+	-21, -9, -35, 174, 49, 0, 177, -9, 
+	35, -22, 20, -160, 81, -7, -43, -94, 
+	-30, 16, 36, -67, 112, 72, 35, 41, 
+	-3, 17, -3, 68, -84, 83, 30, -63, 
+	34, -45, 7, 124, 36, -22, 96, 76, 
+	84, -29, 48, -155, 66, 52, -108, -95, 
+	-75, -48, -72, -17, 18, -6, 36, 18, 
+	-60, 36, 50, -73, -82, 76, 68, 12, 
+	11, -174, -127, 32, 8, 70, -87, -21, 
+	92, 41, 81, -195, 53, -35, -221, -10, 
+	6, 90, -74, -106, -6, -70, 49, 24, 
+	-118, 66, -28, -32, -81, 108, 33, -33, 
+	52, -244, -74, 150, 26, 22, -69, 6, 
+	8, 17, 97, -60, -20, -17, -129, -42, 
+	-93, 62, -73, -68, 20, -44, 65, -16, 
+	-100, 33, 38, -52, -21, 134, -13, -3, 
+	-47, -178, -69, 123, -6, 81, -28, -33, 
+	-23, 21, -108, 104, 8, -52, 92, -116, 
+	-73, 128, 35, -51, 76, 115, 106, 15, 
+	-77, -58, -35, 164, -48, -51, -107, -9, 
+	-33, 51, -111, 10, -7, -98, 5, -129, 
+	59, -38, -19, -14, 2, 8, 84, -28, 
+	26, 86, 64, -10, 91, 47, 118, 11, 
+	-21, 6, 23, 87, -81, 0, -42, -17, 
+	118, -100, -139, -4, -23, 9, -65, -160, 
+	65, 21, -4, 71, -25, -42, -47, -53, 
+	-91, 167, -3, -23, -26, -49, 91, 37, 
+	-131, 71, -62, -28, -17, 24, 25, 46, 
+	98, -76, -59, 71, -42, -25, -130, -53, 
+	11, -27, 16, -38, 26, 5, -61, -110, 
+	-94, 161, -123, -77, -74, -123, 17, 26, 
+	-41, 72, -18, -40, 21, 30, 34, -89, 
+	-16, -184, -175, 51, 46, 93, -107, -70, 
+	23, -43, -63, -93, -55, 54, 101, -139, 
+	37, 3, 14, -122, -102, -118, 23, -75, 
+	-56, -40, -27, -180, 66, -36, 45, 47, 
+	28, -194, -170, 56, -41, 122, -65, -8, 
+	49, 58, -12, -38, 13, -36, -19, -13, 
+	-38, 133, -57, 52, 20, -65, -51, 66, 
+	-15, 27, -42, -42, 31, -41, 9, 40, 
+	65, 3, -39, -20, 33, -85, -92, -25, 
+	-15, 66, 33, 72, 35, -29, 33, 1, 
+	27, 81, 29, -24, -6, 14, 101, -11, 
+	47, 15, 52, 44, 28, 59, -4, 24, 
+	31, -22, 34, 71, -12, 65, 12, -41, 
+	28, 44, -6, -71, 13, 43, 79, -74, 
+	-3, 86, 69, -51, 12, -13, 9, 17, 
+	12, 18, 66, 38, 4, 18, -83, 6, 
+	-7, -68, -58, 42, -67, 6, -30, 23, 
+	26, 23, 20, -157, 36, 67, -13, -22, 
+	29, 60, 0, -42, -69, -34, -49, 78, 
+	20, 43, 0, -99, 68, -113, 47, -1, 
+	125, -70, -19, -81, 33, -86, -13, 32, 
+	-7, 33, -29, 8, 38, 25, -70, 69, 
+	-38, 68, -170, 49, -127, -130, -83, 16, 
+	-33, -7, -62, -155, 59, -57, 22, -2, 
+	-20, 21, 8, -139, 27, -28, 7, 77, 
+	29, -29, 17, -26, 54, -59, -20, 59, 
+	-75, 16, -93, -22, -59, -141, 73, -73, 
+	45, 42, -86, -81, -66, 106, 3, 73, 
+	-8, -18, -8, 36, 31, 126, 36, 58, 
+	10, -44, 24, 83, 33, 50, 15, 48, 
+	63, 131, 128, 35, -25, 11, -81, 4, 
+	-16, 1, -13, 19, 14, 82, 17, 10, 
+	43, 16, 21, -21, 42, 120, -7, 58, 
+	-16, 30, 58, -71, -17, 29, -42, -37, 
+	114, -26, 95, 0, -23, -5, -94, 25, 
+	2, 5, 57, -76, 16, 51, 53, 7, 
+	83, -36, -58, -26, 17, -50, -36, 64, 
+	23, -10, 48, -106, -27, 14, 29, -79, 
+	23, -15, 24, 2, -80, -14, 17, 70, 
+	35, 65, 75, -23, -50, 3, 57, 21, 
+	45, -69, -141, 27, 13, -37, 75, 80, 
+	20, 42, 42, -90, 24, 10, -120, -10, 
+	-30, -30, 31, 3, -26, 41, 38, 41, 
+	28, 57, -5, -13, 75, 47, -54, 5, 
+	2, -56, -51, 33, -4, 23, -4, -42, 
+	5, 4, -70, 38, -85, -13, -12, -46, 
+	-94, 228, -33, -73, 69, 78, 96, 8, 
+	28, -42, -36, 150, -55, 59, -122, -22, 
+	-107, -44, 1, 144, -2, 36, 87, -18, 
+	42, -61, 20, 34, -59, -53, -8, -41, 
+	-68, 34, 28, -86, 135, 87, 76, 3, 
+	-11, -39, -54, 171, -60, 105, 21, -101, 
+	-39, -86, 40, 108, 23, -9, -17, -50, 
+	-20, -64, 46, -53, 23, -65, -162, -155, 
+	-178, 56, -60, -64, 8, 38, 14, -12, 
+	-59, 69, -77, 112, -102, 67, -60, -94, 
+	-84, -154, -135, 54, -32, 77, -41, -17, 
+	21, 20, -26, -160, -23, -12, 22, -25, 
+	-59, 79, 79, -192, 65, 61, 69, -37, 
+	-85, -66, -30, 57, -99, 28, -24, -6, 
+	-36, -209, -168, 48, 26, 13, -11, -93, 
+	33, 36, 39, -74, -31, 3, 38, -4, 
+	63, 43, 53, -140, 3, 83, -29, -6, 
+	-40, -25, 38, 36, -75, 0, 16, 20, 
+	98, -125, 4, -24, 42, -35, 26, 21, 
+	-40, -68, -79, 49, -67, -49, -59, -58, 
+	-58, 157, -123, 1, 99, 77, -21, -81, 
+	-53, -58, -51, 122, -37, -45, -90, 42, 
+	-47, 30, 24, -17, -7, -99, 78, 99, 
+	-23, -67, -38, -79, -14, -66, -157, -66, 
+	-113, 123, -80, -9, 48, -50, 11, -49, 
+	19, -33, -136, 106, -53, -93, -120, -14, 
+	-101, 47, -18, 53, -26, -19, -1, -26, 
+	-60, -63, -121, -42, -30, -72, -90, -101, 
+	-10, 156, -68, 5, -20, -1, 27, -77, 
+	-50, -41, -143, 60, -10, -59, -57, -43, 
+	-168, 18, -6, -16, -140, -112, -115, -40, 
+	-61, -29, -11, -89, -72, 32, 34, -90, 
+	-19, 103, 86, 7, 57, 55, 79, -26, 
+	-38, -56, -6, 55, -39, -27, 12, -15, 
+	-35, -18, -150, 89, 26, -139, -76, -49, 
+	73, 39, 56, -162, -75, -5, 16, -119, 
+	20, -36, 81, -97, -27, -23, 32, 84, 
+	-111, 2, 33, 40, -118, -6, 61, 20, 
+	29, -170, -46, 35, -11, -12, -56, -52, 
+	-1, 40, -54, 5, 10, -67, -18, -48, 
+	-5, 79, 8, -25, 29, -69, 84, 23, 
+	35, -81, -78, 11, -26, 66, 7, 7, 
+	-3, 31, 7, 82, -13, 25, 18, 28, 
+	-51, 40, -64, -27, -1, -100, -16, -4, 
+	9, 70, -60, 1, -25, -40, -62, -88, 
+	22, 39, -55, -1, 73, 27, -36, -37, 
+	-44, 83, 48, -93, -36, 16, 106, 55, 
+	-47, -47, -5, -12, 74, -55, 50, 37, 
+	41, 34, -28, 41, -149, -86, -118, -30, 
+	-5, 44, -40, -11, 104, -140, -69, 5, 
+	-68, 116, 113, -155, -28, -171, 46, 54, 
+	-63, -98, -50, -8, 39, 39, 35, 67, 
+	90, 99, 56, 71, -119, 26, 14, 0, 
+	79, 54, -21, -70, -7, -197, 43, 81, 
+	-30, 163, 114, -100, -66, -90, 47, 89, 
+	-22, -38, -77, -64, -5, 82, -90, 28, 
+	88, 38, 78, 56, -81, -20, -27, 35, 
+	75, 23, -11, -79, 9, -129, 2, 42, 
+	38, 94, 12, -157, 22, -65, -25, 60, 
+	36, -32, -32, -52, 14, -15, 54, 82, 
+	1, -42, -18, -12, 43, 62, -11, 34, 
+	10, 44, -19, 79, -98, 6, 35, 48, 
+	50, 0, 31, 20, 14, -63, 15, -20, 
+	2, -8, -10, 36, -75, 14, 13, 32, 
+	20, 50, 103, 39, -69, 23, 51, 39, 
+	-31, -4, 26, -33, -59, 63, -59, -10, 
+	-4, 76, 86, 28, -7, -72, 126, 9, 
+	32, -23, 3, 41, -65, 23, -101, -29, 
+	36, 36, -15, 10, -51, -23, -76, -12, 
+	-27, -2, -32, 26, -46, -96, -62, -2, 
+	13, 106, 44, -64, 7, -127, 25, 69, 
+	-106, 13, -51, 86, 29, -64, -132, 12, 
+	-55, -2, 13, 27, -107, 9, -57, 18, 
+	20, -58, -37, 103, -75, -57, -69, 9, 
+	9, 104, 82, 2, -20, -90, 52, -17, 
+	-57, -12, -63, 8, -9, -14, -175, 53, 
+	-26, -13, 5, -36, -126, -133, -72, 0, 
+	37, -95, -57, -17, -72, -36, -45, 19, 
+	-11, 60, 68, -79, -28, -96, 105, 90, 
+	16, -17, -56, 85, -44, -28, -14, 45, 
+	46, 9, 15, -82, -26, -9, -76, 10, 
+	-4, 15, -47, -48, -2, -29, 13, 29, 
+	78, 18, 16, -84, -63, -121, -65, 62, 
+	37, 15, -24, 48, -47, -18, -33, -1, 
+	-57, -73, 20, 58, -37, -30, -39, 87, 
+	18, -26, -31, 20, 47, -16, 43, -16, 
+	30, 21, 49, -24, -2, -36, -4, 2, 
+	17, 9, -15, 25, -1, 4, 35, 57, 
+	-68, 73, -23, 65, -88, -48, 33, -6, 
+	59, -4, -10, -21, -24, -135, -44, 78, 
+	48, 19, 43, -139, -97, -206, 55, -76, 
+	73, 7, -70, 27, 15, 56, -23, 68, 
+	54, 70, 27, 127, -242, -74, -101, 15, 
+	89, 84, 76, -87, 5, -161, -43, 68, 
+	-11, 73, 32, -117, -53, -3, -42, 39, 
+	-31, 74, 13, -44, 110, 9, -84, 22, 
+	-91, -5, -62, 18, -142, -192, -48, -9, 
+	37, -23, 50, -168, -21, -89, 27, -24, 
+	61, 44, -14, -165, 68, 1, -28, 48, 
+	42, -33, -51, 49, 16, -53, -8, 66, 
+	-81, 54, 15, 53, -23, 88, -105, 94, 
+	47, 15, 2, 13, 31, -10, -7, 18, 
+	54, 63, 140, -111, -5, -156, 11, 48, 
+	36, -12, -19, -2, 31, -18, -14, -1, 
+	-27, 141, -21, 64, -164, -58, -140, 80, 
+	49, -5, 8, -97, -38, -165, -42, 70, 
+	21, 60, -43, -214, -22, -105, -33, 86, 
+	59, 124, -32, -100, 5, 98, 29, 5, 
+	77, 100, 63, 55, -120, -125, -155, 74, 
+	-3, -33, 54, -158, 11, -78, 62, 54, 
+	104, -26, -22, -101, 79, -40, 52, 70, 
+	78, 128, -13, -50, 48, 55, 24, -59, 
+	11, -148, -33, 82, -162, -71, 2, 47, 
+	10, -52, 46, -11, 60, 137, 38, 57, 
+	81, -62, -37, 27, 48, 82, 43, -3, 
+	-6, 51, 51, -76, 46, 40, -185, 4, 
+	-237, -70, -125, -107, 13, 113, 22, -31, 
+	-121, 48, -67, 73, -128, 124, -26, -83, 
+	-58, -119, 36, 156, 29, -2, 29, -51, 
+	23, 49, 0, -61, 51, -13, -96, 16, 
+	-66, -2, 55, 17, -81, 37, -71, 28, 
+	-83, 12, 58, 158, -41, 58, -50, 57, 
+	0, -17, -76, -64, 86, -166, 99, 59, 
+	64, 43, 17, -121, -14, 52, -66, -93, 
+	-9, -114, -38, -1, -95, 18, -29, 46, 
+	-1, 41, 36, 69, -54, 110, 37, 44, 
+	69, -155, -147, 119, 63, -40, 15, 35, 
+	27, 52, 25, -92, 49, 38, -27, -17, 
+	-25, -59, 54, 54, -108, -2, 46, 23, 
+	-156, 62, -50, 12, -122, 110, 9, 26, 
+	-9, -166, -58, 198, 31, 127, -11, -92, 
+	52, -33, 43, 37, 34, -52, -180, 15, 
+	-81, 130, -42, -146, 66, 23, 124, 19, 
+	-116, 71, -137, 101, -83, 139, -75, -5, 
+	-7, -48, 120, 217, 15, 78, -40, -192, 
+	-72, -87, -37, -28, -61, -70, -117, -60, 
+	-148, 16, -76, -67, 42, 92, 107, -105, 
+	-130, -134, -71, 159, -88, 10, -121, 43, 
+	-66, -71, -49, 98, 23, -35, -17, -156, 
+	-11, 55, 16, 28, 6, -32, -83, -19, 
+	-84, -33, 9, -57, -42, 29, 49, 15, 
+	-48, 13, 16, 95, -43, 17, -78, 77, 
+	-63, -85, -25, 76, -34, -78, 45, -20, 
+	25, -48, -39, 92, 51, -39, -48, 59, 
+	-126, 246, 17, -64, 64, 105, 162, 10, 
+	-41, 55, -82, 119, -100, 84, -97, -6, 
+	9, -9, 44, 169, -68, -69, -46, -144, 
+	16, 64, -31, 141, 72, -50, -127, -75, 
+	-150, 210, -40, -100, 31, 33, 93, -58, 
+	-30, -12, -94, 110, 10, 29, -183, -36, 
+	-3, -11, -6, 57, -76, 70, 4, -14, 
+	-75, -57, -141, 59, -19, -174, -117, -25, 
+	-97, 44, -76, -21, 65, 11, -97, -41, 
+	21, -61, -127, 2, -38, -25, -128, 32, 
+	-67, 31, -46, -55, -151, -3, 59, -29, 
+	-68, -151, -138, -12, -108, -121, -8, -59, 
+	-33, -66, -26, -33, -59, 1, -130, -52, 
+	-63, -81, -49, -17, -12, -190, -69, -32, 
+	-31, -52, -25, -165, -118, -159, 49, -38, 
+	69, -118, 18, -84, 33, -30, 158, 18, 
+	61, -137, 145, 5, 73, 12, -12, 3, 
+	18, -20, 102, 18, -98, -18, 110, -80, 
+	93, -15, -66, 61, 70, -120, 51, 47, 
+	54, -83, 127, -118, -10, 63, -51, 16, 
+	8, -77, 13, -20, 35, 16, 32, 78, 
+	-88, 68, 38, -40, -42, 15, 106, -92, 
+	48, -114, -97, 27, 78, 46, -8, 129, 
+	16, 27, 56, -33, 69, 1, 20, -188, 
+	-64, -16, -78, -199, 103, 42, 123, -22, 
+	-49, 107, -1, -14, -49, 102, 35, 45, 
+	90, -161, -155, 187, -3, 15, -155, -161, 
+	-33, 26, -31, 16, -46, -16, 10, -10, 
+	-59, -76, 27, -131, 87, 90, 26, 22, 
+	-68, 17, -51, 87, -71, 63, -153, -53, 
+	60, -149, 90, 63, 29, -2, -66, -241, 
+	-23, -6, -121, 91, -148, -83, 60, -110, 
+	-149, -125, 73, -156, 84, 71, -74, -153, 
+	-140, -142, -192, 78, -187, -15, -202, -6, 
+	-84, -49, -109, -13, -22, 49, 2, -202, 
+	70, -101, 59, -167, 11, -79, 85, -304, 
+	-158, 163, 55, -18, 165, 78, 85, 19, 
+	-3, 68, -51, 129, -18, 27, -85, -126, 
+	-52, -87, -229, 135, 2, -66, -56, -72, 
+	3, -22, 77, -3, -21, -76, 50, -89, 
+	-32, 123, -28, 16, 1, 6, 73, 17, 
+	7, 17, -56, 18, -8, 54, 67, -22, 
+	-100, -102, -181, 110, -23, 115, -44, -125, 
+	-87, 6, -50, 20, 10, 22, 39, -104, 
+	78, 57, -17, 8, 86, -28, 80, -56, 
+	35, 44, 53, 22, 111, 12, -74, -7, 
+	27, 35, -120, 32, -70, 76, -5, -12, 
+	-22, -39, 5, -36, -46, -88, -123, 58, 
+	43, 17, -69, 17, -21, -53, -103, 23, 
+	-61, -61, -53, -130, 55, -19, -20, 0, 
+	123, 31, 29, -138, -62, -62, -100, -26, 
+	-61, 21, -122, 68, -97, -106, 60, -9, 
+	-148, -55, -18, 0, -22, -59, -138, -130, 
+	-5, -150, -236, -60, -117, -149, -140, -30, 
+	-81, -31, -16, -162, -92, 32, -95, -11, 
+	-197, -146, -133, -152, -128, -191, -16, -209, 
+	-172, -141, -150, -29, -37, -110, -129, -101, 
+	-117, -50, -205, -7, -85, -181, -125, -141, 
+	-106, -161, -275, -159, -83, -152, -158, -60, 
+	-39, -122, 30, -142, -17, -30, 70, -39, 
+	-1, -106, -47, -63, -60, -19, -66, -29, 
+	-12, -20, -6, -47, -87, -187, -82, -11, 
+	-71, -129, -214, -197, -77, -9, -21, -72, 
+	-19, -30, -12, -127, 71, 36, 80, -80, 
+	-9, -99, 84, 4, 67, -12, -195, 68, 
+	-46, -7, 32, -67, 27, -141, 40, 1, 
+	-16, -19, 36, -220, -42, -132, 22, 10, 
+	-55, 31, 37, 34, 63, -50, -165, 37, 
+	35, -154, -39, 11, -70, 11, -135, 24, 
+	25, -48, 40, -53, 103, -58, -32, 44, 
+	72, 48, 105, -149, -49, 17, -19, -33, 
+	-133, -40, -168, 109, -47, -158, -218, 33, 
+	-166, -126, -156, -10, -113, -248, -156, -104, 
+	-96, -185, -318, -240, -121, -132, -209, 13, 
+	-174, 52, 6, -216, -152, 68, -129, -25, 
+	-183, -167, -96, -81, -133, -147, -67, -127, 
+	-138, -165, -144, -96, -103, -194, -187, -110, 
+	-90, -105, -220, -91, -127, -54, -171, -87, 
+	-181, -105, -50, -170, -127, -146, -125, -140, 
+	-88, -117, -16, -126, -31, -63, 54, -112, 
+	-74, -157, -38, -81, 65, 13, -177, -71, 
+	-44, 6, 29, 46, -62, -95, -87, 16, 
+	-125, -119, -74, -66, -3, -244, 14, -56, 
+	-16, -24, 2, -180, 66, -18, 37, -42, 
+	-97, -173, -10, -147, 60, 71, -43, 70, 
+	-41, 75, 23, 57, -103, -64, -36, -11, 
+	0, -47, 21, -51, -15, 33, 99, -38, 
+	15, 74, 25, 107, 23, -43, -32, 73, 
+	-30, -65, -13, -30, 38, 38, 44, 89, 
+	83, 42, 11, 76, -20, -27, -67, 81, 
+	35, 109, 134, -86, -41, 149, -3, 2, 
+	-99, -9, -107, 85, -33, -138, -194, 97, 
+	-138, 8, -267, 31, -85, -139, -150, -83, 
+	44, -65, -232, -204, 46, -99, -184, -45, 
+	-147, 130, 83, -151, -54, 35, 54, 19, 
+	-132, -124, -26, -44, 10, -166, -71, -105, 
+	-76, -107, -183, -69, -12, -155, -156, -107, 
+	-109, -26, -171, -178, -94, -70, -121, -18, 
+	-133, -21, -20, -36, -93, -100, 1, 20, 
+	-68, -110, -17, -121, -28, 3, -9, -94, 
+	-117, -68, -25, -65, 25, -15, -45, -40, 
+	-71, 27, -13, 43, 3, -128, -53, 37, 
+	-84, -30, -86, -111, -16, -108, -48, -109, 
+	-39, -44, 59, -103, -29, -15, 127, 75, 
+	-11, 3, 49, -61, 51, 115, -2, 20, 
+	-20, 10, 62, 63, 29, -27, -96, 38, 
+	-15, -26, 52, -94, 74, 24, 137, -70, 
+	6, 17, 69, 61, 15, -42, 72, 101, 
+	59, 69, 91, -31, 66, 93, -34, 36, 
+	80, -62, 39, 36, 119, -40, -124, -34, 
+	66, 152, 69, -76, 102, 18, -10, 72, 
+	-128, -2, -53, 130, -19, -95, -89, 141, 
+	-31, 107, -204, 12, 13, 35, -83, -30, 
+	88, -62, -26, 14, 75, 17, -105, -32, 
+	-81, 175, 144, -38, -20, 27, 44, 138, 
+	-15, -20, 7, 12, -38, -36, 113, -56, 
+	-13, 37, 64, -34, 64, -19, 30, -46, 
+	-51, 15, -76, 21, -77, -26, 8, -22, 
+	14, 5, -49, 66, 19, 77, -31, -91, 
+	-60, -28, 10, -28, 23, 20, 154, 4, 
+	2, 26, 90, -73, 68, 101, 2, 67, 
+	-52, 73, 22, 146, 16, -16, -73, -38, 
+	-29, -14, -29, -83, -11, -13, -34, -50, 
+	27, 31, -5, 14, -27, 33, 61, 45, 
+	6, -31, 41, -54, -140, 95, -162, 91, 
+	-43, -4, 35, -3, -19, -102, -40, 18, 
+	88, -53, 62, -185, -12, -255, 36, -25, 
+	-47, 13, -100, 92, -105, 42, 12, 44, 
+	45, -73, 53, 3, -159, -23, -203, 77, 
+	10, -72, 51, -158, 67, -157, 24, 72, 
+	-41, 62, 83, -186, -46, 24, 43, -40, 
+	25, -74, -34, 74, -90, -22, -28, 13, 
+	-18, 2, 72, 110, -120, -22, -82, 29, 
+	-43, -2, -48, -13, 55, -122, 24, 100, 
+	13, 92, 34, -84, -48, -34, 6, 24, 
+	-70, 23, -57, 33, -74, -28, 13, 103, 
+	69, 223, 18, -43, 118, -21, 48, -28, 
+	41, -69, -8, 19, 133, -74, -8, 52, 
+	5, 136, 10, -82, -1, -90, -14, 27, 
+	-33, -29, -41, 35, 36, 12, 80, -62, 
+	24, -22, 66, 22, 123, 83, -106, 55, 
+	-1, -62, 55, 76, 16, -13, 25, 40, 
+	-34, -7, -12, -77, -45, -283, 119, -39, 
+	87, -47, 34, -65, 1, -21, -22, 60, 
+	-106, -130, 27, -20, -13, 90, -88, 30, 
+	-32, 21, 105, 93, 27, -35, -31, -44, 
+	67, -6, 37, -118, 73, -210, 71, -12, 
+	21, -42, -13, 77, 9, 10, 37, 65, 
+	-97, -49, 56, 35, -16, -44, -32, -24, 
+	-51, 2, -23, -18, -41, -29, -105, 3, 
+	-104, 25, 93, -86, 9, 2, 55, 36, 
+	-41, -22, -52, 77, 111, -13, -43, 77, 
+	-42, 73, -76, 9, -131, -64, 14, -19, 
+	27, -11, 35, -4, -28, -33, 46, 47, 
+	52, 28, 84, -36, 4, -43, 118, 99, 
+	-73, -59, 37, -169, -46, -62, -130, 16, 
+	-50, -40, -139, 45, 40, -47, 51, -50, 
+	-37, -47, -111, 28, 9, 73, 37, 14, 
+	-156, 39, -53, 68, -32, -116, 30, 160, 
+	-20, -56, 27, -185, 53, -2, 8, -47, 
+	-116, 56, -17, -48, -11, 74, 16, -67, 
+	-5, 133, 46, 0, -37, -13, 1, 49, 
+	-125, 17, -97, 54, -97, -229, -20, -12, 
+	11, 10, -9, -202, 35, 42, 54, 10, 
+	-14, -29, 68, -77, -31, 51, -178, -14, 
+	-46, 119, 63, -12, -45, -121, -66, 7, 
+	-15, -156, -57, -89, 16, -84, -44, -46, 
+	3, -18, -69, -26, -14, 78, 39, -71, 
+	-21, -152, 11, -27, -178, -129, -232, 33, 
+	-46, 0, 61, -76, 9, -136, -40, -14, 
+	-37, -71, -30, -120, -36, 37, 2, 24, 
+	34, -46, 21, 7, -17, 37, -58, 24, 
+	-76, -98, -73, 60, -59, -103, 30, 29, 
+	-37, 19, 30, -79, -48, -11, -21, 6, 
+	94, -67, -53, 6, 34, 78, 11, 30, 
+	29, -119, 36, -131, -21, -131, -105, 25, 
+	-31, 111, -78, 25, -23, 41, 166, -46, 
+	6, 31, -69, -17, -23, 71, -106, 24, 
+	-113, -53, -101, 170, -50, 7, 9, 54, 
+	66, -26, -40, -211, 46, 25, 29, -152, 
+	-2, 67, 12, 21, -97, -18, -15, -69, 
+	5, 0, 67, -44, 14, -62, 112, 17, 
+	-20, -36, -212, -60, 91, -71, 36, -18, 
+	-6, 45, -30, -211, 48, 64, 14, -105, 
+	69, -173, 82, 62, -97, -41, -159, -7, 
+	-60, 79, 106, -126, 24, 61, 114, 4, 
+	80, -178, -176, -83, 72, 83, -3, 30, 
+	5, 8, 27, -12, -34, -32, -52, -68, 
+	-34, -152, -34, -73, -109, -66, -147, -31, 
+	-91, -35, 16, -77, -21, 31, -25, 44, 
+	7, -199, -65, 82, 56, 1, -31, -110, 
+	-63, 41, 4, 68, -60, -45, -87, -73, 
+	-85, -30, -125, -89, -87, -19, -1, -88, 
+	-133, -107, -110, -30, -73, 96, -79, -34, 
+	-28, -88, -5, 84, -16, 33, -16, -126, 
+	6, -28, -15, -235, -7, 42, -65, 2, 
+	108, -8, -7, 77, 37, -8, -8, 20, 
+	10, -44, -5, -46, 121, -18, 35, -62, 
+	-74, -94, -180, -108, 42, -186, -33, 28, 
+	20, 51, -2, -92, 48, -14, 11, -97, 
+	17, -108, 1, -12, 79, 0, 73, -12, 
+	-7, 73, 43, -56, 12, 3, 169, -5, 
+	76, -143, -135, 46, 79, -68, -111, -66, 
+	40, -49, 87, -17, 34, 46, 30, -105, 
+	-94, 16, 48, 6, -55, 86, 127, -10, 
+	-82, 60, 1, 43, -125, 124, 2, -11, 
+	-30, -198, -86, 115, 38, 41, -20, -77, 
+	-14, -36, 47, 77, -112, 3, -20, -48, 
+	-51, 45, -80, -169, 12, 57, 75, -81, 
+	-39, -30, -53, 17, -28, 149, -54, 3, 
+	7, -49, 38, 68, -8, -22, 42, 1, 
+	-33, -52, -9, 14, -94, -45, -38, -88, 
+	-94, -36, -26, -45, 21, 49, 8, -99, 
+	-31, -49, -34, 52, -99, 141, -72, -30, 
+	-42, -29, 73, 83, -32, 46, 28, 21, 
+	69, 44, 47, -31, 9, -28, 61, 36, 
+	5, 90, -5, 40, -54, -15, -105, 47, 
+	-9, -6, 35, -11, -19, -43, 68, 14, 
+	40, -19, 4, -43, 26, 46, -88, 71, 
+	-83, 3, 37, 82, -20, 7, -41, 49, 
+	107, -39, -3, 35, -131, -45, -28, 54, 
+	-51, 29, 32, -9, -55, -15, 12, -83, 
+	46, 21, -55, -42, -28, 195, -18, -78, 
+	18, 22, -65, 28, -82, -41, -76, 49, 
+	-22, 7, 60, -31, -99, -43, 54, -4, 
+	-22, -8, 1, -10, -33, 14, -5, -35, 
+	-11, 50, 167, 60, -51, 19, -19, -57, 
+	-16, -6, -74, 46, -36, -50, 77, 17, 
+	41, 51, 114, 45, 22, 147, -45, -44, 
+	13, 19, 65, 78, -61, -46, -142, 43, 
+	-30, 85, -17, -1, 41, -66, 12, -39, 
+	-2, -4, -18, 54, -32, 24, -56, 78, 
+	14, -58, 132, 59, -40, 81, -132, 81, 
+	-61, -29, 75, 56, -47, -50, -53, 67, 
+	150, 66, 33, -89, -24, -165, -12, -30, 
+	-23, -45, -50, -21, -66, 0, -73, 74, 
+	-9, -80, -3, -3, -7, -99, -92, 56, 
+	-61, 38, 4, -90, -47, -125, 89, -29, 
+	45, 33, 121, -92, -81, -132, -39, 23, 
+	-53, -16, -35, 134, -40, -36, -107, -79, 
+	-70, 63, -37, -76, -68, -59, 83, 17, 
+	51, -36, -43, 87, -23, -1, 37, 42, 
+	-102, 62, -7, -9, 7, -63, 51, 78, 
+	-6, -11, -15, 9, -77, -21, -90, 71, 
+	-107, 83, -51, -75, -47, 42, -57, 58, 
+	25, -33, -38, 160, -45, -85, -43, 10, 
+	65, 28, 128, -11, -43, -205, -11, 36, 
+	-113, -25, -39, 42, -4, 14, 19, 23, 
+	-97, 16, 125, 55, -43, 104, -71, 25, 
+	10, -9, 44, 124, -16, 19, -8, -29, 
+	-67, 68, 12, -111, -56, -65, 27, -66, 
+	-33, -70, -41, 2, 25, 0, 22, 162, 
+	-11, 2, 129, -47, -111, -26, -113, 109, 
+	-46, 28, 102, 6, -27, -207, -70, 61, 
+	59, 7, 120, -187, -47, -80, -29, -95, 
+	-40, -26, -46, -49, -57, -47, -59, 57, 
+	-124, -20, -99, -77, -73, 67, -117, 21, 
+	-20, -40, -75, 97, -34, 10, -134, -19, 
+	40, 8, 106, -73, -21, -243, 96, 7, 
+	-60, -17, -22, 23, -29, -94, -66, 64, 
+	-75, 100, -95, 40, 31, -3, -80, -77, 
+	10, 16, -46, 118, 5, 32, -53, 43, 
+	-58, 160, 122, -97, 33, -186, 71, 173, 
+	-58, -27, 8, -58, 50, -14, -134, 110, 
+	-76, 134, -67, 32, 54, -38, 8, -5, 
+	94, -18, -23, 14, 6, 32, -39, 46, 
+	55, 107, 27, -2, -58, -156, 31, 48, 
+	-31, -35, -10, 12, 65, 61, 39, -63, 
+	-29, 86, 103, 42, -134, -52, -44, -24, 
+	54, 44, 70, -61, -85, -44, -109, 93, 
+	-124, -10, -65, -59, -39, -40, -39, -11, 
+	25, 20, 16, -115, 78, 135, 41, -26, 
+	53, 51, 1, 5, -230, -131, -250, 5, 
+	-52, -10, 135, -86, -58, -200, 34, -13, 
+	129, -53, -47, -308, 28, -7, -73, -32, 
+	56, 78, -36, -118, -33, -17, -31, -26, 
+	4, -58, 41, -12, 99, -6, 40, -25, 
+	-58, 17, -26, 88, -53, -10, -67, -34, 
+	69, -136, -66, 20, 43, -50, 57, -70, 
+	39, 40, -30, -68, 54, -30, -70, -59, 
+	-80, 40, -56, -41, 137, -6, 156, 33, 
+	-15, -4, -68, 71, -1, 92, 33, -8, 
+	23, 19, -16, 105, 2, -52, 85, -55, 
+	84, -7, 52, -85, 80, -38, -33, 7, 
+	-48, 222, -82, 127, -9, 38, 60, -21, 
+	81, 67, 10, 97, -22, 44, -66, -9, 
+	12, 34, -40, 58, -19, -79, -39, 129, 
+	42, 90, -19, -102, 1, 71, -60, -79, 
+	-27, 20, -17, 82, -133, -56, -80, -11, 
+	-15, -21, -43, -80, 36, -49, 63, -9, 
+	55, -59, -150, -45, -15, -45, -11, 66, 
+	48, 34, 62, -113, -9, 54, -118, -100, 
+	21, -73, -46, -42, -44, -88, 155, -36, 
+	-29, 98, 51, -19, -48, 58, 44, 59, 
+	11, -136, -104, 99, 24, 46, -90, -119, 
+	48, 49, -73, 85, -14, 2, 7, 3, 
+	-123, -16, -20, -70, 34, -22, 15, 49, 
+	-74, 27, -43, -10, -135, -38, -53, 76, 
+	-8, -60, 31, -6, -44, -82, -11, -165, 
+	8, 1, -4, -66, 59, 7, 22, -19, 
+	39, 102, 65, -59, -8, 47, 31, 18, 
+	15, 9, 53, 78, 5, -16, -19, -16, 
+	58, -152, -128, -25, 41, -134, 64, 16, 
+	-2, 61, -28, -74, -20, 51, -49, 28, 
+	62, -57, -39, 25, -35, 49, 4, -3, 
+	-43, -36, 17, 24, 134, 17, 98, 29, 
+	119, -152, -19, 33, 34, -6, -16, 122, 
+	51, 14, -30, -89, -48, -47, -186, -23, 
+	-20, -32, -136, 43, 12, -83, 85, -68, 
+	-110, 56, 32, -83, -103, 72, 117, -34, 
+	33, -98, -67, 113, 27, 56, -86, -49, 
+	-24, -2, -79, -4, 25, -21, 6, -72, 
+	-119, 101, -77, -57, -1, -8, 87, -49, 
+	-127, 15, -110, -27, -51, 113, -19, 35, 
+	-112, -85, -10, 42, 16, 30, -79, -43, 
+	-70, -74, -44, -72, -53, -68, -30, 89, 
+	67, 92, -131, -11, -121, -255, -5, -44, 
+	18, -5, -86, -247, 15, -164, 22, -3, 
+	31, 43, -71, -131, -87, -75, -18, 71, 
+	-89, -37, -87, -21, -34, -92, 4, 33, 
+	5, 132, -54, 68, -7, -67, 93, 8, 
+	115, 53, -11, -36, 32, -104, 44, -45, 
+	-133, 80, -14, -26, -42, -82, -75, 70, 
+	3, -99, -83, -47, 19, -29, 86, -46, 
+	71, 59, 63, 126, -85, -37, -32, 1, 
+	25, -25, -16, -42, 83, -60, 67, -9, 
+	-70, 90, 11, -77, -36, -192, -27, 94, 
+	72, -92, 41, -2, 7, -16, 31, -146, 
+	60, 3, 75, 32, -7, -27, -126, 41, 
+	13, -5, -30, -14, 55, -145, 89, -60, 
+	95, -17, -249, -57, 34, -135, -105, -50, 
+	-14, -45, -82, 22, -12, -67, -17, -18, 
+	-60, -30, -44, -81, 52, -102, 38, 23, 
+	-110, -129, -62, 30, -94, -9, 13, -9, 
+	-33, -61, -155, 46, 47, 75, -49, -162, 
+	18, 53, 17, -19, -65, -61, -91, -7, 
+	69, -9, -56, 59, -10, -22, -15, -89, 
+	-36, 2, -60, -62, 44, 37, 34, -33, 
+	-29, -12, -43, -26, 19, -53, 60, 29, 
+	-63, -16, 0, -32, 16, -53, 41, 23, 
+	30, -19, -22, 29, -51, 57, -71, -58, 
+	73, 64, 44, -88, 71, 8, 12, -52, 
+	-87, 70, 18, -107, -22, -8, 123, 31, 
+	17, 52, 73, 66, 23, 18, 50, 28, 
+	30, -60, 107, 113, -118, 25, -175, -36, 
+	-14, 15, 64, -104, 52, -102, -25, 39, 
+	85, 141, 63, -194, 21, -13, -1, 59, 
+	16, 23, -19, 84, 8, 25, 95, 75, 
+	-37, -157, -26, 26, -200, -119, -82, 46, 
+	24, -132, -53, -129, 17, -25, 53, 15, 
+	123, 108, 22, -81, 38, 98, -156, -26, 
+	-89, -47, 11, 34, -100, -43, 160, -14, 
+	35, -37, -25, -90, 2, -81, 41, -103, 
+	-46, -125, -57, -119, -43, -25, -67, -41, 
+	-27, 7, -60, -34, 26, 155, -86, -51, 
+	16, -58, -17, -54, -78, -63, 17, -64, 
+	-98, 21, -45, -62, 35, -7, 98, -45, 
+	-9, 59, -31, -52, 35, 109, 27, -77, 
+	-21, -11, -122, 110, -69, 73, -38, -33, 
+	31, -55, 48, -128, 81, 21, 164, -47, 
+	35, -52, 47, 4, -8, 101, -117, 52, 
+	-12, 105, 106, 1, -50, 56, 70, 2, 
+	43, -79, -15, -40, -9, 12, 51, -108, 
+	43, 1, 10, 23, 56, 13, 90, 60, 
+	58, -300, 136, 36, -135, 31, -250, 24, 
+	-13, 15, 115, -134, -17, -190, 7, -27, 
+	119, -69, 25, -268, 76, 26, -7, -39, 
+	38, 50, -39, 155, -26, -16, -23, 40, 
+	-1, -139, -29, -25, -72, -248, -67, -11, 
+	-71, -144, -8, -282, -117, 12, -103, -66, 
+	63, 35, 53, -16, -89, 171, -89, -121, 
+	-49, -125, -69, 70, -39, -19, 231, -85, 
+	166, 93, 48, -45, -74, -183, 5, -104, 
+	-37, -52, 7, -188, 55, -76, 3, -7, 
+	-111, 8, -29, 1, -47, 78, -131, 14, 
+	-75, 17, -36, -77, -18, -42, 50, -35, 
+	15, 122, -106, -23, -24, 24, -36, -34, 
+	-30, 90, -43, -103, 27, 20, 119, -20, 
+	-74, 25, -94, -16, -36, -60, -20, 28, 
+	-17, 23, 63, -132, -5, 108, 128, -123, 
+	16, -81, 107, -20, 10, -11, -191, 55, 
+	-50, 101, 104, -64, -32, -44, 126, 2, 
+	48, -75, -123, -124, 22, -73, -57, 15, 
+	-11, -2, 15, 54, 13, 87, 113, 47, 
+	24, -228, 138, -23, -69, 18, -117, 98, 
+	-26, 87, 108, -44, 35, 3, 11, 4, 
+	26, -27, 6, -133, 67, 158, -47, -146, 
+	-40, 10, -80, 83, -51, -84, -153, -18, 
+	-99, 31, -42, -54, -205, -126, -106, 22, 
+	-47, -93, -135, -309, -64, -101, -105, 53, 
+	30, 79, 61, -54, -31, 64, 3, -14, 
+	23, -65, 21, 117, -15, -12, 28, -51, 
+	-7, 101, -10, -8, -192, -170, -67, -116, 
+	75, -15, -10, -265, 47, -81, 138, -6, 
+	-55, 65, -12, -124, 0, -84, -64, 62, 
+	22, 29, 36, -181, 14, 53, 3, -60, 
+	111, 81, 1, 59, 10, -69, -57, 18, 
+	44, -1, 32, -64, -10, 10, 80, 22, 
+	0, -19, -136, -20, 60, -195, -29, 47, 
+	-22, 58, 25, -159, 60, 64, 50, -102, 
+	75, -61, 12, -26, 35, 20, 46, 54, 
+	-72, 18, 93, -20, -9, 49, 102, 12, 
+	30, -50, -99, 61, 55, 132, -15, -38, 
+	13, 14, 39, -66, 68, 28, 101, -72, 
+	16, -140, 131, -88, -17, 34, -75, 30, 
+	-3, 29, 101, 39, 6, 82, -22, 5, 
+	-33, -13, 43, -11, 44, -32, -52, -41, 
+	-6, -15, 7, -43, -31, -54, -208, 2, 
+	-63, -43, -130, -6, -75, -11, -105, -19, 
+	49, -70, -96, -46, -42, -1, -100, 92, 
+	-95, 56, 34, -101, -19, -96, 31, 80, 
+	-14, 4, 21, 27, -23, 37, -142, 24, 
+	-43, 52, -91, 32, -121, -63, 38, -31, 
+	57, 6, 17, -184, 62, 61, 57, 38, 
+	-111, 96, 30, -8, 27, -70, -34, 131, 
+	-20, 3, -73, 112, -64, 25, 103, -6, 
+	-41, -29, 21, -89, -43, -14, -114, -53, 
+	-15, -25, 33, -37, -72, -117, -18, 20, 
+	-35, 85, 85, -132, -45, 22, -83, -53, 
+	-15, -92, -59, 10, -68, 28, 63, 56, 
+	116, 49, 144, -13, -1, -29, -25, 20, 
+	100, -73, 84, -71, 64, -98, -28, 49, 
+	-54, 55, -110, -126, 20, -25, -58, 79, 
+	-29, -51, 37, -106, -14, 2, -30, -7, 
+	47, -8, -9, -13, -33, -51, -92, 33, 
+	42, 67, 52, -88, 57, -63, 76, 67, 
+	24, 13, 25, -69, -25, -104, -21, 60, 
+	37, -13, -10, 61, 14, -18, 3, -3, 
+	30, -64, -19, 45, -120, -30, -113, 58, 
+	98, 63, 19, -81, -36, -63, 36, 51, 
+	-14, 49, 47, -106, -61, -44, 6, 49, 
+	-23, -13, 9, 112, -31, 31, -59, 41, 
+	35, 15, -23, 48, -232, -51, -183, 59, 
+	50, -8, 36, -89, -3, -76, -21, 60, 
+	-33, 68, 16, -161, 9, -8, 9, 48, 
+	-46, -35, -60, 87, -28, -33, 85, 58, 
+	35, 0, 74, -31, -10, 50, 44, -66, 
+	100, 31, -57, 44, 39, 15, 11, -42, 
+	-9, 48, 19, 39, -36, 43, -1, 71, 
+	-13, -48, 47, -180, -5, 60, -16, -135, 
+	20, -77, 63, -44, 45, 58, -24, 31, 
+	-26, 55, 66, 51, -30, 71, 37, -56, 
+	-85, -126, -290, 32, -62, -46, 103, -45, 
+	48, -24, 39, -343, 22, 57, -28, -6, 
+	27, -129, 25, -76, -67, 64, -75, 7, 
+	15, 85, 74, -51, 45, 83, -17, -29, 
+	55, -139, -122, -7, 0, -47, 9, -76, 
+	67, 59, -16, 13, 42, 51, -11, 13, 
+	29, -101, -63, -15, -114, -31, -174, -25, 
+	11, 5, 8, -138, -39, -113, 36, 67, 
+	41, 2, 9, -17, 30, 108, -57, -18, 
+	-14, 71, -3, 100, -63, -50, -80, -46, 
+	-37, -166, -23, 27, -96, -112, -12, -12, 
+	-18, -46, 16, -28, 5, 42, 45, -22, 
+	19, -2, 43, 25, 14, 112, 11, 15, 
+	-81, -88, 33, 25, -82, -27, 76, 35, 
+	38, 125, 11, 17, 162, 126, 140, -95, 
+	39, 65, 10, 59, 16, 171, -9, 3, 
+	-115, 32, 16, 139, -7, 93, 16, 44, 
+	0, -15, 15, -137, 73, 12, 67, -174, 
+	-9, 53, -32, -8, 99, 65, 71, 1, 
+	-65, 116, -2, -35, 9, 14, -40, 24, 
+	-190, -112, -267, 19, -51, -60, -100, -56, 
+	22, 8, 4, -373, -13, 56, 63, -6, 
+	-29, -34, -11, 20, 18, 64, -192, -16, 
+	0, -3, 123, -113, -66, -105, -6, -37, 
+	-10, -127, -196, -154, 15, -138, -111, -107, 
+	50, 67, -21, 32, -14, 68, 72, 75, 
+	42, -208, -23, 0, -135, -84, -112, 68, 
+	-6, -21, -5, -141, -29, -100, 47, -10, 
+	13, -95, 40, -35, -13, 67, -51, -3, 
+	-89, 37, -48, 122, -100, -7, -110, 31, 
+	-123, 1, -124, 5, -1, -51, 78, -51, 
+	7, -60, -112, 4, -31, 64, -45, 22, 
+	-82, 12, 76, 60, -47, 128, 21, -14, 
+	-33, -81, 42, 38, -43, -20, 9, -24, 
+	142, 133, 27, 36, -3, 55, 95, -40, 
+	25, -14, 54, -44, 95, 58, 88, 36, 
+	-162, 54, 15, 85, -18, 79, -33, 138, 
+	-50, -71, -26, -76, 31, -13, 45, -156, 
+	31, -16, 8, 21, -63, -20, -123, -25, 
+	15, -31, 85, -77, -26, -33, 18, 29, 
+	-87, -40, -138, -171, 36, -16, -60, -9, 
+	35, -22, 62, -334, 11, -9, 118, -80, 
+	-36, -351, 12, -9, -29, -17, -192, 46, 
+	-72, 51, 99, -79, -9, -62, 41, -5, 
+	73, -186, -221, -81, -12, -89, 6, -83, 
+	33, 2, 53, 70, -16, -35, -65, 79, 
+	-84, -210, -31, -84, -134, -76, -59, -12, 
+	-37, -44, 32, -119, -46, 37, -37, 33, 
+	-2, 9, 55, -2, 14, 22, -11, -48, 
+	-24, -23, -91, 97, -98, -132, 74, 21, 
+	50, 67, -114, 11, -41, -129, -11, -114, 
+	-25, -56, -121, -105, 47, 66, -130, -15, 
+	-122, 60, 104, 20, -10, 78, 109, 67, 
+	-51, -1, -8, -26, 13, -6, -49, -60, 
+	80, 18, 15, 96, 74, 16, 20, 5, 
+	33, 11, 67, -64, 15, 38, 76, -3, 
+	-99, -21, -6, 85, -16, -2, 79, 32, 
+	-38, -1, -13, -152, -9, 52, 20, -124, 
+	-37, -81, -49, 8, 41, 51, -26, 15, 
+	-8, 78, 94, 32, -38, 54, -56, 44, 
+	-68, -57, -39, -27, -40, 18, 15, -55, 
+	37, 45, -26, -149, 80, 55, 129, -11, 
+	-42, -139, 28, -17, -39, 65, -93, -7, 
+	-1, 34, 104, -29, -9, -61, -21, 73, 
+	58, -118, -16, -78, -8, -16, -56, -139, 
+	9, 49, -38, 70, -65, 8, -2, 34, 
+	-50, -10, -16, -117, -96, -29, -57, 32, 
+	-27, 7, -44, -103, -73, -24, -98, 10, 
+	-8, 71, 17, -49, 102, 72, 10, 57, 
+	-40, -30, 2, 110, -39, -9, 69, 50, 
+	48, 94, 26, 2, -25, -16, 45, -102, 
+	17, -10, -68, -28, 49, 105, 98, 3, 
+	-55, 37, 63, 23, 30, 78, 2, 70, 
+	-85, 39, -15, 82, -62, -28, -46, 15, 
+	-81, 108, -119, 51, 60, -98, 44, -63, 
+	-16, -135, -121, -117, 43, -11, 33, 50, 
+	111, 97, 94, -33, -66, 79, -71, 28, 
+	-65, -33, -25, 130, 19, -8, 48, -51, 
+	20, 32, 21, 12, -17, 88, 53, 37, 
+	22, 83, -43, 27, 97, 8, 9, 0, 
+	21, 70, -116, -7, -33, 79, -66, -21, 
+	28, -68, -51, 50, 36, 21, 101, -7, 
+	12, 13, 93, 11, -53, 35, -41, 79, 
+	46, 5, 44, -38, 0, -145, 42, -1, 
+	26, -88, -54, -69, -11, 77, -50, -92, 
+	-2, 36, 46, 6, 91, 1, 122, 11, 
+	49, 79, 119, 16, -176, 0, -116, 162, 
+	40, -8, 74, -104, 121, -217, -24, 89, 
+	108, 22, -57, -219, -33, -158, -69, 42, 
+	2, 43, 24, -43, 35, 59, -1, 40, 
+	81, 281, 1, 0, -219, -101, 53, 82, 
+	39, 44, 93, -266, 118, -63, 81, 136, 
+	63, 69, -136, -27, 111, -107, -2, 73, 
+	-71, -20, -30, -18, -62, -91, -32, 145, 
+	-112, -139, -99, -54, -107, -75, -32, -110, 
+	-42, -111, -115, 7, -113, -20, -145, 18, 
+	-59, 53, 43, -17, -35, -9, 46, -11, 
+	-7, -86, 35, 15, 14, -76, -17, -26, 
+	-9, -84, 29, -47, 38, -7, -86, -63, 
+	6, -19, -56, -21, -82, -50, -98, -1, 
+	-84, 47, 110, -103, -43, -25, -28, 83, 
+	7, -108, 26, 4, -4, -11, 75, 45, 
+	-27, -250, 91, -11, 44, 92, -101, 4, 
+	-22, -8, 16, 125, -126, -6, 2, 7, 
+	-19, -8, 12, -67, 39, -144, 52, 43, 
+	69, -21, 88, -166, 83, 75, 70, 119, 
+	65, 68, 81, -13, 56, 60, 19, 5, 
+	70, 72, 29, 98, -9, 56, 12, -12, 
+	-27, 129, 18, 86, 66, -69, 61, 201, 
+	29, 70, 142, -182, 39, 34, -87, -103, 
+	69, 58, 39, -28, 110, 58, 176, -1, 
+	-31, 110, 60, 82, 2, 159, 180, -34, 
+	-26, -6, -152, 192, 96, 49, 76, 211, 
+	-55, -54, -107, 76, -105, -161, 28, -79, 
+	-47, 141, -101, -96, 166, 3, 151, -99, 
+	13, -125, -203, 214, -30, 59, -157, 6, 
+	-214, 76, -9, 63, -20, 6, 140, -133, 
+	-108, -91, -32, -26, -16, -99, 3, -46, 
+	-81, 105, -107, -37, 128, 19, 128, -77, 
+	-36, -104, -126, 185, 28, -32, -150, -40, 
+	-191, -16, -35, 108, -133, -66, 85, -177, 
+	-64, -36, 37, -49, 14, 5, -67, -60, 
+	-154, 117, 44, -129, 96, 48, 126, 59, 
+	-101, 36, -93, 169, -85, -3, -130, -30, 
+	-122, 75, -47, 109, 28, -228, -36, -276, 
+	9, -68, 48, -119, -53, 43, -65, -327, 
+	-155, 231, 3, -105, 203, 88, 256, 92, 
+	-168, -5, -84, 138, -143, 66, -156, -71, 
+	-291, -78, -264, 204, 41, -108, 10, -100, 
+	-38, 3, 5, -187, 28, -30, -169, -327, 
+	-141, 336, -113, -190, 59, 70, 324, -4, 
+	-120, 109, -120, 94, -77, 33, -173, -18, 
+	-187, -297, -385, 194, -29, -7, -58, -129, 
+	-114, -25, -74, 108, 72, -105, -50, 55, 
+	75, 35, -86, 113, -70, -47, -136, -9, 
+	156, -47, -5, -9, 88, -166, -65, 40, 
+	-23, 149, 98, -122, -27, -60, 43, 196, 
+	-112, -74, -132, 17, 51, -118, -143, 53, 
+	34, 78, -176, 97, -42, -138, -80, -25, 
+	58, -124, -102, -82, 72, -221, -48, -42, 
+	-69, 158, 10, -215, -117, -97, -49, 170, 
+	-105, -92, -177, -77, -34, -104, -85, 34, 
+	42, 84, -126, -29, -62, -241, -127, -144, 
+	7, -74, -128, -202, 16, -335, -79, 11, 
+	-163, 124, -77, -220, -174, -200, 10, 130, 
+	-169, -64, -133, -138, -84, -29, -166, 30, 
+	42, 117, -101, -50, -151, -150, -101, -20, 
+	75, -58, -113, -186, 40, -311, -41, 1, 
+	-153, 111, -52, -175, -141, -276, -61, 42, 
+	-34, -57, -106, -116, -2, -76, -17, -57, 
+	34, -9, -104, -8, -139, -124, -174, -58, 
+	47, -97, -58, -103, 24, -269, -40, -3, 
+	-50, 18, -44, -244, -51, -162, -35, 48, 
+	-21, 116, 16, -40, 93, 32, 19, 15, 
+	-23, -210, 70, 18, -121, -85, -88, 3, 
+	-23, -31, 63, -23, -41, -66, 8, -7, 
+	-18, -30, 90, -98, -2, 87, 24, -8, 
+	-30, 40, -5, 84, -1, 24, -26, 4, 
+	7, -66, -21, 82, -53, -75, -130, 22, 
+	-20, -35, 25, -28, -78, -53, -2, 11, 
+	-43, 34, 96, -91, -69, 80, -42, -36, 
+	72, 36, 41, 7, 5, 41, -64, -24, 
+	-10, -27, 24, 29, -24, 9, -53, 73, 
+	-36, -69, -44, -19, 10, -29, -26, -22, 
+	77, 22, 53, -80, -35, -92, -45, -54, 
+	-13, -50, 9, 22, -12, -33, -117, 76, 
+	5, -40, -22, 29, 85, 42, -7, -44, 
+	7, -4, -43, 159, 29, -23, -3, 39, 
+	-57, 31, 143, -66, -21, -62, 75, -4, 
+	33, 29, 25, 94, 29, -2, 11, 84, 
+	59, -17, -3, 70, 109, 202, -38, 40, 
+	89, -38, -26, 150, -9, -39, 31, 88, 
+	33, 154, 84, 15, -22, -136, 22, -42, 
+	-32, -3, -15, 2, -2, -43, 145, 16, 
+	105, -38, 166, -20, 21, -37, -89, -1, 
+	50, -38, -25, -130, -37, -238, 7, 1, 
+	-73, 22, -57, -183, -35, -41, -38, 17, 
+	-9, -77, -7, 45, -24, -10, 37, 65, 
+	26, 4, 117, -18, 8, -18, 0, 103, 
+	15, 66, 92, 35, -21, -76, 74, 9, 
+	26, -14, -43, -125, -3, 0, -80, -72, 
+	-4, -31, -87, 29, 34, -59, 48, 76, 
+	18, 28, -45, -75, 17, 4, -94, -43, 
+	5, 31, 56, -5, 37, -54, -64, 28, 
+	-34, 89, 109, -69, -64, -59, -87, 58, 
+	5, -5, 11, 80, 17, 45, 87, 3, 
+	125, 99, 28, -4, -41, 27, -44, 41, 
+	22, -4, 62, 40, -8, -92, 7, 4, 
+	17, 79, -35, -70, 14, -39, 10, 117, 
+	49, 23, -56, -18, 56, -14, -20, 180, 
+	10, 19, 6, 63, -205, -97, -135, 57, 
+	22, 35, 54, -43, 3, -133, 8, 82, 
+	92, 96, 101, -143, 32, -128, 68, 128, 
+	16, -19, -45, 91, 3, -31, 125, 36, 
+	103, -42, 33, 13, -36, 32, 19, 3, 
+	8, 10, 47, 10, 62, -9, -18, -63, 
+	44, 50, -5, 43, -2, 142, 32, 18, 
+	-103, -9, 11, 57, 31, -2, 61, 28, 
+	-1, 75, 59, 4, -7, 75, -38, 67, 
+	43, 54, 23, 76, 7, -62, 29, -16, 
+	-82, 99, 54, -149, -4, -68, 143, 34, 
+	-30, -38, -9, 58, 51, -2, 19, 44, 
+	-17, 37, 82, 43, 6, 21, -164, 51, 
+	66, 12, 65, -22, 0, -173, 8, -1, 
+	59, 70, 112, -136, -69, -197, 15, 37, 
+	-12, 46, -24, 132, 28, 21, 53, 41, 
+	-42, -54, 57, 38, -99, 26, -111, 58, 
+	25, -30, 30, -48, 12, -176, 80, 65, 
+	-21, -35, -23, -118, -24, 39, -18, 40, 
+	-28, -4, 8, -91, 60, 68, -31, -5, 
+	-15, -1, 51, 50, -77, -130, -82, 106, 
+	-14, 57, 106, -60, 6, -81, -41, 56, 
+	72, 19, -42, -36, -5, -176, 47, 19, 
+	31, -29, 45, 10, -43, -2, 34, 57, 
+	91, 35, 79, 17, 70, 31, 13, 65, 
+	-13, -28, 5, -46, -38, 93, 15, -16, 
+	14, -30, 111, -17, 22, 98, 13, 96, 
+	-74, -18, 22, -27, -1, 75, 24, -18, 
+	-58, 11, 102, -73, -11, 76, -4, 6, 
+	17, 55, 82, 30, -21, -7, 33, -59, 
+	-30, -5, -3, 5, 17, -117, 110, -4, 
+	69, -46, -20, -118, 26, 55, -80, -22, 
+	-57, -140, 23, -57, -134, 63, -213, -33, 
+	24, 106, 67, -76, 5, -54, -2, 34, 
+	110, -10, 16, -211, -44, -144, -61, -19, 
+	17, 5, -5, 103, 68, 35, 19, -85, 
+	-77, -283, 52, 26, -152, -82, -273, 71, 
+	-12, 36, 64, -172, -83, -120, -58, 9, 
+	-63, -96, -60, -118, -57, 74, -54, -32, 
+	-14, 64, -30, 16, -2, 38, -104, -98, 
+	-99, -118, -74, -88, -30, -127, -213, 3, 
+	-80, -7, 38, -51, -41, -90, -61, 87, 
+	25, -121, -33, -66, -19, -88, -13, -61, 
+	-17, -39, 4, 22, -19, -21, -90, 71, 
+	21, 105, -94, 3, -61, 14, 36, 27, 
+	-10, 25, -21, -18, 40, 57, 12, 7, 
+	-4, -37, 29, 62, -76, 53, -4, 10, 
+	-3, 2, -65, -60, 45, -20, 73, -48, 
+	-41, 77, 26, 59, -59, 58, 6, 52, 
+	-17, 70, 37, -83, -60, 18, 20, 83, 
+	43, -65, -16, -97, -17, -59, 8, -38, 
+	74, 94, 54, -83, 78, 64, 35, -40, 
+	-11, -172, 39, -55, -84, -15, -190, 52, 
+	-16, 30, 23, -11, -43, -85, 38, 4, 
+	102, -130, -39, -146, 101, 14, 2, -49, 
+	25, 42, 0, 30, 35, 23, 74, -93, 
+	35, -372, 85, -39, -90, -45, -138, -3, 
+	-109, 17, 16, -64, -1, 22, -14, 28, 
+	-115, -167, -46, 16, -19, 96, -60, -170, 
+	73, 80, 6, -37, -63, 6, -177, -25, 
+	-210, -75, -55, -118, -62, 57, -97, 18, 
+	-39, -4, -60, 23, -40, -21, -136, 111, 
+	-27, -32, 45, 36, 82, -86, 0, -98, 
+	30, 0, -67, -7, 27, -59, 22, 12, 
+	-50, 32, -54, -25, -79, -19, -94, -83, 
+	-18, -7, 30, -7, -37, -43, 31, 69, 
+	16, 14, -83, -55, -22, -4, -42, 74, 
+	14, 14, 61, -149, 51, 77, 60, -50, 
+	36, -5, 68, 118, -22, -12, -106, 24, 
+	-6, 69, 44, -37, -22, -16, 128, 42, 
+	200, -78, -111, -49, 72, -86, -26, -10, 
+	55, 82, 1, 65, 14, 64, 65, -32, 
+	-11, -46, -37, -7, 54, 28, 29, 21, 
+	-61, 6, 55, -12, -63, 101, 71, 35, 
+	27, -58, -75, 75, 120, 136, -10, -10, 
+	-11, -3, -13, -16, -46, 47, -43, -45, 
+	-39, -114, 2, -119, 83, 92, 104, 20, 
+	-55, -65, 47, 63, -123, 151, -22, -34, 
+	-105, -136, -21, 77, 33, 72, 28, -153, 
+	22, 52, -17, -29, -87, -40, -148, 32, 
+	-237, -2, -141, -114, 116, 53, 84, -88, 
+	-105, -81, -171, 105, -135, 39, -124, -8, 
+	-28, -105, 74, 112, 44, -13, 47, -16, 
+	47, -46, -26, -356, 67, 71, 66, -43, 
+	-2, -92, 3, 43, -162, 37, -15, 38, 
+	-6, 18, 69, 7, 49, -95, 27, -42, 
+	-143, -100, -175, -126, 31, -239, 8, -94, 
+	29, 13, -50, -116, -27, 61, 46, -80, 
+	47, -173, 8, -6, -103, 43, -214, 24, 
+	49, 27, 54, -126, 27, -90, 45, -46, 
+	61, -6, 21, -243, -24, -42, 114, -28, 
+	60, -31, 61, 37, -61, 62, 50, 18, 
+	148, -220, 109, 87, -125, -27, -134, -8, 
+	-35, -61, 53, -125, 47, 9, 56, -22, 
+	81, -46, 11, -60, 77, 54, -96, 15, 
+	-105, 6, -57, 153, -133, -98, -121, 37, 
+	-22, -221, -113, 5, -152, -178, 16, -4, 
+	-139, -43, -54, -176, -66, 21, -101, -116, 
+	49, -21, 80, 15, -91, 206, -47, -154, 
+	-31, -59, -108, 97, -19, -45, 71, -103, 
+	-66, -26, -22, -48, -12, -52, 9, -15, 
+	-90, -46, -62, -85, -144, -50, -63, -6, 
+	-110, -136, -93, -42, -137, 70, -149, -131, 
+	-3, -54, -17, -165, 72, 71, 41, -171, 
+	64, -35, 32, -3, -57, -45, -184, 84, 
+	4, -14, 83, -94, 85, -158, 140, -18, 
+	24, -140, -278, -117, 33, -100, -95, 0, 
+	19, -6, 120, -51, 22, 92, 103, -3, 
+	6, -380, 47, -66, 28, 64, -31, 22, 
+	-14, 35, 123, 23, -61, 35, 35, 22, 
+	58, -163, 10, 18, 117, 49, -140, -90, 
+	46, 77, 64, 61, -144, 92, -219, -24, 
+	-40, -166, 35, -80, -118, 23, 133, 37, 
+	-114, -18, 25, -71, -113, 120, 33, -53, 
+	210, -100, 26, 121, 14, 153, -84, -90, 
+	-130, -23, -121, 69, -100, -187, -127, -45, 
+	-125, -70, -244, -207, -165, -29, 72, -100, 
+	-26, -28, -165, -46, -28, 103, -124, -52, 
+	-100, 10, -62, 115, -56, 187, -22, -135, 
+	-4, 44, -46, -16, -21, 12, 43, -45, 
+	116, -14, -24, -11, -248, -91, -116, 44, 
+	-37, 13, -21, -217, 71, -128, 103, -48, 
+	109, -54, -17, -161, 22, -42, -80, -41, 
+	94, -50, 139, -133, 67, 56, -2, -59, 
+	-41, -102, 34, -65, 83, 12, 68, -15, 
+	-103, 146, 60, -28, -107, 60, 39, 24, 
+	-64, -105, -27, 77, 34, -66, -40, -105, 
+	70, 11, 33, -59, -23, -49, 33, -19, 
+	-29, 19, 29, -90, -37, 18, 127, 49, 
+	-59, 27, 33, 56, -136, 52, -96, 27, 
+	-45, -56, 8, 172, -1, 34, -9, -16, 
+	-92, 41, 20, 50, -1, -84, -134, -31, 
+	-14, 170, -193, -5, -82, -40, 169, 23, 
+	-12, 17, -156, 23, -35, 67, 41, 11, 
+	12, 38, 106, 110, -25, 193, -38, -34, 
+	6, -36, -3, -40, -24, -59, 8, -90, 
+	63, 97, -36, 67, 16, 21, 30, 27, 
+	5, -38, 37, -22, 87, 62, 64, 32, 
+	44, 51, -82, 55, 6, 44, -58, 70, 
+	-24, 8, 45, -26, -29, 20, 64, -5, 
+	33, -14, 11, 50, -74, -31, -144, 46, 
+	-12, -39, 17, -98, 52, -175, 150, -28, 
+	96, -27, -18, -161, 22, -16, 14, 40, 
+	-2, 51, -3, -40, -18, 23, -110, -3, 
+	-13, 116, -43, -71, 83, 52, 76, -69, 
+	13, 37, 3, 99, -5, 20, -90, 9, 
+	-66, -4, -60, 66, -10, -53, 52, -41, 
+	-39, -2, 33, -54, -33, -84, -157, -13, 
+	-1, 109, -43, 30, -67, -20, -14, -10, 
+	-24, 9, -28, -31, -56, -25, 23, 24, 
+	-58, 7, -40, -47, -56, -65, 2, 64, 
+	-50, 11, -15, 8, 18, -103, 19, 28, 
+	67, 96, -18, 52, -163, -43, -61, -121, 
+	41, -52, -71, -157, 45, -88, 15, -30, 
+	17, 9, -19, -89, -71, 83, 110, 114, 
+	26, -50, 68, -86, -16, 7, -9, 46, 
+	137, 63, 42, 67, -200, -81, -106, 26, 
+	13, 56, 77, -191, -1, -59, 112, 69, 
+	70, -3, -46, -113, 46, -76, 38, 97, 
+	-40, 4, 23, -47, -1, 39, -32, 53, 
+	-5, -67, 23, 14, -151, -75, 105, 50, 
+	57, 157, 91, -144, -15, -19, 79, -51, 
+	-41, -12, -35, -14, -74, 27, 94, 27, 
+	29, 22, -24, -171, 29, -4, -107, -32, 
+	31, 9, -70, -63, -85, -22, -32, -9, 
+	34, 18, 4, -95, 42, -2, -8, 19, 
+	-84, -16, 38, -36, -6, -113, -37, 62, 
+	32, -10, 25, -5, -16, 0, -88, -22, 
+	-83, -82, -66, 21, -128, -95, -110, 0, 
+	41, -48, -64, -111, -44, -136, 89, -8, 
+	31, 14, -41, -76, -19, -57, -54, 50, 
+	25, -47, 46, 3, 35, 36, 46, 32, 
+	110, 19, 41, 81, -82, 54, 5, 49, 
+	49, 45, 17, -37, -43, -79, 108, 5, 
+	-92, 16, 0, -48, -29, -5, -20, 58, 
+	32, -12, 4, -82, 100, 87, -1, 69, 
+	25, 53, 14, 67, -198, -45, 25, 14, 
+	-34, 130, 20, -72, 84, -47, 80, 72, 
+	2, -33, -12, -134, -30, -32, -27, 26, 
+	-37, -21, 12, -27, 76, 56, 48, 25, 
+	14, 66, -37, 52, -114, -112, -147, 56, 
+	26, 59, 93, -31, 82, -11, 41, 49, 
+	-70, 76, -29, -138, 1, -29, 50, 60, 
+	-115, -89, -21, -155, -9, -110, -24, 28, 
+	-22, 0, -63, -83, -24, -58, 8, -122, 
+	-84, -96, -68, 8, -10, -56, -61, -117, 
+	-162, -119, -70, -48, -16, -125, -14, -57, 
+	-10, -21, 32, -157, 25, -83, -18, 9, 
+	61, -20, -16, 22, -57, -27, 2, -47, 
+	31, 2, -14, -59, 60, -36, -6, -65, 
+	-67, -56, -105, -15, -28, -158, 40, 108, 
+	-51, -64, -32, -130, 59, -54, -16, -37, 
+	8, 104, -74, 10, -37, -140, 158, 44, 
+	40, 109, 36, -126, 4, -8, -10, -15, 
+	-31, 50, -70, 140, -26, -132, -9, 3, 
+	6, -116, 10, -72, 47, 7, -96, 33, 
+	43, 149, -75, 9, -46, 35, 199, 48, 
+	66, 44, -5, 76, -16, 45, 8, 60, 
+	21, 32, 30, 34, -99, -170, 18, -31, 
+	-44, 6, -57, 9, -22, 30, -95, 34, 
+	7, 107, -92, -24, 22, -2, 49, 11, 
+	82, -34, 33, 157, 25, -116, 44, 80, 
+	28, 4, 0, 4, 48, -275, 69, -3, 
+	-108, -84, -13, -150, 6, -9, 7, -18, 
+	-56, -17, -12, -76, 82, -1, -31, -113, 
+	-55, -53, -44, 30, 30, -130, -62, 26, 
+	-46, -84, -161, -9, 12, -145, -59, -33, 
+	-3, -18, 27, -107, -32, -31, 36, 6, 
+	-27, 6, 51, -83, 60, 58, 114, -44, 
+	20, -29, 11, 46, 56, 35, -51, -23, 
+	-26, -79, -78, 83, 12, -25, 11, -11, 
+	-14, 24, -21, -89, -19, -43, -51, -34, 
+	-15, 63, 6, 8, 2, -21, 17, -11, 
+	78, 4, -13, 90, 3, 9, -3, 42, 
+	-53, 4, 17, -16, 2, -45, 98, 33, 
+	-85, -7, 53, -140, -15, 54, -14, 71, 
+	17, 120, 8, 102, -170, 11, -188, 68, 
+	81, -3, 82, -48, 15, -10, 17, 54, 
+	-103, 81, 44, -186, -43, -346, 146, 85, 
+	-20, 16, -22, -73, 81, -9, -151, 132, 
+	-49, 26, -39, 62, -201, -140, -142, -14, 
+	71, -61, -5, -44, 70, -23, -1, 60, 
+	-96, 45, 173, -148, -42, -222, 22, 62, 
+	-87, -33, -4, -118, 1, -21, 54, 55, 
+	-19, 69, 45, 45, -9, -68, 14, -57, 
+	61, -65, 17, -137, 55, -120, -14, -46, 
+	-103, 3, -101, -66, -13, -87, -49, -42, 
+	-13, -62, -17, -96, 58, 46, -43, -8, 
+	24, 135, 99, -42, -23, 47, 126, -24, 
+	38, 38, 35, -29, 14, -50, 18, 6, 
+	-14, 41, -113, 26, 37, -64, -48, 48, 
+	-21, 34, 68, -221, -49, 85, 20, -129, 
+	55, 82, 23, 74, 158, 20, 85, 34, 
+	-39, 6, 18, 125, 65, -5, 43, -55, 
+	4, -69, -145, 98, 115, -116, -69, 123, 
+	-5, -54, 17, -295, 41, 21, -44, -35, 
+	-41, -65, 44, -18, 139, 169, 117, 9, 
+	-1, 8, 62, 40, -18, 56, 24, -25, 
+	-119, -74, -91, 97, -19, -128, 49, -63, 
+	45, 61, 18, 23, 35, -19, -195, 61, 
+	-164, -110, 16, -4, -99, 136, -126, 77, 
+	5, 30, 60, 45, 10, -42, -159, 2, 
+	67, -57, 81, -45, -13, -128, 51, -49, 
+	-2, -35, 21, 34, -34, -68, 36, -18, 
+	19, -95, 49, -31, -39, -94, -50, -72, 
+	-37, -15, 15, -18, -73, -57, 11, -108, 
+	-42, -109, -102, -61, 57, 3, 51, 33, 
+	1, 41, 35, -64, -38, 10, -71, -145, 
+	-44, -33, 36, -16, -7, -16, 101, 2, 
+	-119, -24, -2, 49, -49, 29, 41, -24, 
+	89, -155, -191, 73, 37, -29, 2, 22, 
+	-16, -35, -19, -62, 17, 24, -1, -115, 
+	-137, 104, -55, -47, 9, 52, 92, -93, 
+	-96, 77, -31, 1, -30, 63, 49, -40, 
+	76, -141, -211, 111, -21, 13, -110, -27, 
+	-18, 24, 9, -99, 79, 48, 98, -222, 
+	53, 66, 136, -105, 18, 100, -16, -7, 
+	-64, 53, 49, -46, -57, 67, 105, 29, 
+	26, -245, -221, -28, -55, 8, 37, -161, 
+	44, 87, 57, -58, 48, 91, 77, -2, 
+	-52, -177, 121, -71, -86, 14, -129, 90, 
+	-122, -37, 103, -66, 44, -60, 11, 48, 
+	159, -193, 93, -140, 44, -49, -87, -101, 
+	1, -1, 31, 44, -37, -11, 37, -117, 
+	-19, 60, -19, -152, 40, 9, 36, 37, 
+	3, 14, -7, 72, -64, 66, -21, -24, 
+	-33, -55, -62, 128, 2, 83, -52, -106, 
+	-33, -70, 5, -91, -30, -64, 21, -21, 
+	-2, 178, -70, -78, 7, 12, 160, 74, 
+	-2, -2, 31, -73, 71, 17, -46, 16, 
+	14, -65, -168, 119, -39, 64, -119, -77, 
+	12, -50, -2, -65, -58, -26, 75, -40, 
+	112, 117, -49, 9, -83, -136, -4, -43, 
+	-58, -4, 21, -180, 65, -73, 17, -12, 
+	20, -66, -68, -69, -11, 35, -61, 34, 
+	40, 30, 99, -82, 21, 52, 217, -122, 
+	129, -17, 106, 6, -70, -59, -57, 56, 
+	21, 31, 101, -116, 88, -133, 177, -47, 
+	120, -154, -157, -151, 64, 57, -61, -14, 
+	86, 14, 61, 13, -17, 100, 147, 7, 
+	133, -133, 119, -15, -135, 12, -79, 117, 
+	-73, -1, 77, -63, 44, 35, 20, 16, 
+	108, -167, 53, -1, 74, 11, -62, -71, 
+	-7, -15, 26, 19, 28, 6, -30, 107, 
+	55, 154, -21, 13, -57, -182, 25, 109, 
+	29, -53, 30, -187, 55, -28, 105, -45, 
+	75, 35, 39, 21, -4, 73, -18, 33, 
+	-5, -20, 51, 109, 21, 52, -72, -119, 
+	53, 42, 55, 104, -124, -99, 48, 41, 
+	35, -3, -34, -127, 29, 10, 129, -55, 
+	57, 9, -129, 7, -23, 28, 96, 105, 
+	-21, -43, 22, -122, -31, 72, -53, -1, 
+	-20, -75, 15, -3, -1, -2, 93, 48, 
+	-20, 26, 36, 28, -17, 73, 96, 12, 
+	107, -37, -14, 7, -64, -168, -6, -50, 
+	-5, 19, -24, 18, -34, -55, 54, -84, 
+	-100, -136, 87, -45, -117, 73, -45, 35, 
+	-61, 48, 38, 38, -18, 40, -53, 15, 
+	72, -84, -27, 7, -39, 92, 22, -149, 
+	-3, 18, -40, 57, -43, -43, 104, -9, 
+	-3, -77, 87, -9, -44, 3, -22, -3, 
+	-72, -37, 76, -30, -83, -33, -62, 18, 
+	68, -64, -65, -37, -11, 119, -67, -201, 
+	-14, -24, -20, -33, 16, -28, -94, 125, 
+	38, 71, -45, 75, -138, -112, 33, 21, 
+	79, 37, 19, -87, 37, -83, -31, 20, 
+	-61, 131, 29, -92, -28, -170, 81, 113, 
+	-40, -12, 28, 27, 38, -46, -68, 18, 
+	-12, 83, 3, 37, -178, -142, 21, -17, 
+	67, 51, -84, -127, 51, -123, -24, 158, 
+	-40, 187, 4, -80, 70, -179, 66, 134, 
+	-74, -26, 5, -24, 67, 6, -114, 32, 
+	-59, 180, -49, 46, -99, -162, 84, 61, 
+	44, 86, 13, -111, -1, -104, -67, 102, 
+	-41, 97, 32, -145, 27, -161, 6, 86, 
+	-57, -25, 26, 104, -33, 16, -52, 55, 
+	-2, 231, -21, -24, -119, -141, -39, 95, 
+	71, -9, -41, -142, 21, -114, -44, 134, 
+	10, 63, -41, -182, 16, -28, 16, 17, 
+	-27, 19, -33, 125, 42, 21, 8, 19, 
+	79, 131, 99, -14, -81, -54, -10, 76, 
+	24, 52, 45, -126, -44, -104, 22, 105, 
+	13, -11, -25, -197, 50, 27, 66, 48, 
+	28, 4, 57, -115, -7, 8, -7, -102, 
+	-31, 21, -13, -61, 14, 20, 81, 3, 
+	-10, -11, 4, 122, -39, 89, 32, -13, 
+	0, -25, -72, 59, 11, -44, 66, 2, 
+	-49, 49, -3, -174, 27, 1, -46, -63, 
+	40, 51, -113, -2, 39, -10, 47, -55, 
+	-35, 74, -29, 91, -11, 42, 16, -74, 
+	9, -76, -30, 52, 7, -102, 18, 88, 
+	-12, 47, -6, -193, 122, -31, -101, 61, 
+	-14, 86, -158, 37, 90, 9, 30, -94, 
+	44, 134, -3, 65, 32, 45, 14, -74, 
+	-156, 56, 28, 16, 35, -117, 18, 77, 
+	26, 27, 14, -142, 10, -50, -147, -27, 
+	-135, 16, -97, 70, -34, 37, -64, 21, 
+	44, 54, 29, 59, -66, -26, -14, -3, 
+	1, 61, 107, 1, -34, -173, -14, 128, 
+	35, -14, 37, 49, 59, 14, -44, -44, 
+	-59, -76, 26, 69, -90, 55, -165, 40, 
+	65, 66, 58, -20, -2, -93, -54, 18, 
+	-93, -34, 60, -50, -42, -124, -29, 32, 
+	-61, 47, -60, 30, -18, 45, -13, -77, 
+	15, -37, 62, -44, -86, 10, -67, -28, 
+	-73, 0, 36, -8, -2, -14, -27, 33, 
+	-32, -97, -5, -2, -60, 35, -42, -36, 
+	94, 17, -46, -105, 4, 20, -61, -101, 
+	111, -22, 18, 24, 24, -46, 50, 48, 
+	-73, -12, 1, 4, 32, -37, 39, 23, 
+	9, -225, -79, 93, 10, 20, -62, -16, 
+	-44, 69, 40, -68, -42, -4, -48, -170, 
+	-6, 108, -65, -48, 41, 45, 100, -61, 
+	-60, -59, -47, 21, 19, 0, 1, 81, 
+	33, -188, -67, 78, 11, -9, -46, -63, 
+	38, 53, 11, -117, 21, 31, -48, -86, 
+	-120, 80, -45, -47, -11, 96, -33, -36, 
+	-110, 49, 15, 70, -131, 33, -2, -25, 
+	83, -193, -21, -9, 18, -135, 31, -191, 
+	53, 66, 32, -5, 46, 61, 85, -14, 
+	-73, -93, 90, -120, -117, 7, -139, -4, 
+	10, -71, 96, 38, -50, -11, -33, -2, 
+	-54, -113, 65, -92, 50, -68, 14, -46, 
+	22, -11, -62, 75, -81, 10, 61, -52, 
+	-85, -190, 104, -87, 13, 84, -71, -18, 
+	-120, -30, 5, 55, -116, -31, -82, 20, 
+	24, 65, 85, -78, -46, -106, 78, -70, 
+	85, 51, -37, 66, 5, 48, 2, 66, 
+	-64, -60, 82, 5, -42, 64, -20, 68, 
+	-62, -2, 83, 55, -47, 32, 36, 11, 
+	121, -68, 33, -29, -4, 47, 36, -77, 
+	36, 50, -47, 125, 32, -83, 59, 4, 
+	-23, 116, 12, -66, -74, 26, 6, 13, 
+	-48, -16, -87, -76, -95, 64, -14, 52, 
+	71, -83, -68, 1, -4, 18, 33, 53, 
+	95, -17, 54, -81, 12, 55, 112, -49, 
+	60, -43, 29, 42, -23, 69, 42, 37, 
+	44, 59, 18, -82, -10, 126, 112, -10, 
+	187, -149, -115, 79, 96, -30, 18, -22, 
+	92, -11, 65, 11, -1, 49, 141, 64, 
+	79, -151, 106, 17, 67, 22, 137, 33, 
+	-63, -5, 45, 32, 37, 195, 150, 59, 
+	144, -121, -13, 193, 128, 103, -122, -115, 
+	64, -32, -45, -82, -13, 3, 6, -61, 
+	35, -135, 4, -45, -21, -107, -61, -18, 
+	-49, -74, -72, -80, 2, -5, 61, -22, 
+	26, -99, 2, -24, 41, 14, 20, -31, 
+	-20, 58, -4, -25, 9, 43, 51, -112, 
+	-27, -120, 75, -21, -20, -95, 21, -35, 
+	-53, -2, 2, -127, -42, 7, 76, -31, 
+	68, -118, -147, -11, -44, 89, -38, -47, 
+	-11, -25, 56, 11, 45, 19, 15, -13, 
+	-29, -67, 7, -76, -78, -116, 60, 16, 
+	-10, 69, -51, -66, -13, -72, -51, -43, 
+	83, -103, -92, 61, -65, 24, -13, -134, 
+	-52, 6, -60, 96, -33, -72, -91, -22, 
+	21, 165, -111, 0, -116, -194, 167, 43, 
+	-34, 14, -43, -113, 33, -131, -14, 10, 
+	35, 70, 77, -45, -46, 5, 7, -48, 
+	-92, -66, -70, 51, -30, -20, -166, -52, 
+	-23, 194, -8, 39, -139, -205, -42, 104, 
+	38, -60, -29, -24, 8, -142, 48, 22, 
+	26, 14, -7, -216, -48, -93, -34, -58, 
+	-59, 31, -30, 57, 0, 14, -11, 33, 
+	10, 1, -70, 53, -117, -45, -39, 66, 
+	27, 14, -36, -134, -9, -171, 134, -4, 
+	116, -38, 41, -175, 3, 59, -11, -77, 
+	16, 16, -37, 141, -3, -17, 86, -29, 
+	19, 146, 85, -60, 21, 2, 66, -39, 
+	-10, -11, -7, -1, -20, -22, -44, -4, 
+	-1, 61, -49, -103, -45, 179, -22, -8, 
+	27, -28, -37, 53, -23, 32, 76, 29, 
+	77, 182, 11, -57, -100, -29, -50, -27, 
+	79, -13, 60, 51, 60, -28, 45, 40, 
+	3, 38, -41, -95, 56, -58, 6, 111, 
+	-25, 30, -21, 13, -21, -20, -187, 33, 
+	38, 163, -51, 34, -116, 8, -103, -51, 
+	109, 17, 30, 124, 112, 68, 37, 42, 
+	20, 44, 9, -15, 13, -116, 94, 146, 
+	-5, 9, 43, -15, 86, 8, -212, 2, 
+	-81, -39, -105, 14, -74, -35, -166, -40, 
+	-8, -16, -57, 26, -37, -7, 63, -41, 
+	16, 100, 30, -22, -37, -160, 13, 95, 
+	-43, -65, -49, -55, -65, -88, -35, 100, 
+	-105, -101, -70, -28, -147, -14, -149, -1, 
+	-41, -39, 0, -8, -106, 24, -142, -45, 
+	-148, 21, 60, -118, -1, -171, 26, 47, 
+	48, 11, 61, 28, -46, 46, 29, -29, 
+	-30, 57, 88, 21, 53, -8, -64, -15, 
+	-21, -58, 45, -5, -31, 58, 52, -35, 
+	-30, 47, 9, 0, 2, -115, 7, 67, 
+	28, 1, 83, -109, 49, 70, -60, -37, 
+	58, 92, 136, 62, 14, 73, 47, 28, 
+	21, 114, 11, 8, 54, 31, 118, -8, 
+	-26, -64, -63, 68, 52, -22, -23, 144, 
+	92, 61, 65, -123, 34, 74, -174, 5, 
+	-126, 66, -30, 80, 80, 50, 63, 39, 
+	-4, 56, -30, 126, -169, 86, -30, -60, 
+	-77, -76, 6, 51, 5, -112, 76, -12, 
+	2, 40, 43, -109, 11, 23, -219, 17, 
+	-200, -62, -111, -32, 25, 25, -17, -25, 
+	-56, 2, 19, 28, -70, 39, -99, -67, 
+	-3, 8, 62, 44, -8, -20, -63, -23, 
+	1, -5, -41, -72, -26, -87, -106, -116, 
+	-56, 55, -22, -101, 46, 89, 78, -34, 
+	-150, -58, -76, 162, -90, 5, -66, 23, 
+	-88, -86, -77, 58, 8, -51, 19, -61, 
+	28, 18, 7, -29, -1, -36, -52, -15, 
+	-121, 47, -16, -91, 86, 78, 28, -16, 
+	-70, -37, -82, 151, -92, 59, -55, -45, 
+	4, -48, 25, 91, -13, -22, 53, -55, 
+	-30, 18, -28, -38, -3, -53, -61, -43, 
+	-120, 109, -49, -82, -24, 11, 82, -18, 
+	-47, 59, -72, 28, -75, 4, -85, -19, 
+	79, -129, -53, -10, 8, -67, 6, -82, 
+	7, 14, -44, -93, -15, 26, -14, -120, 
+	-74, 134, -21, -4, -23, -35, 21, 10, 
+	-15, -19, -45, -56, -59, -87, 79, -20, 
+	92, -110, -132, 19, 55, -38, -90, 15, 
+	7, -7, -34, -91, 11, 48, 38, -39, 
+	14, -73, 50, -91, -23, -57, 57, 37, 
+	-19, -10, -26, -73, -46, 36, 136, 21, 
+	113, -205, -83, -34, 53, 91, 5, -53, 
+	-15, -49, -101, 73, -89, -98, -66, -6, 
+	-121, 92, -94, -3, 3, -100, -4, -33, 
+	-1, -59, -70, -55, -1, -114, -96, -58, 
+	22, 22, -17, -9, -66, -78, -12, -25, 
+	-14, -34, 4, -58, 5, -90, -16, -9, 
+	-107, 95, 55, -23, 18, 68, 1, -39, 
+	32, -17, -24, 66, -27, -83, -6, -108, 
+	0, 4, -121, -12, 5, -68, -49, -34, 
+	25, -23, 1, -99, -44, 3, -25, 40, 
+	63, -29, -8, 34, -40, -4, -6, -15, 
+	12, 63, -30, 34, 1, -45, -34, -65, 
+	3, -101, -28, -83, 7, -82, 65, 40, 
+	13, 10, 8, -35, 50, -22, 10, 50, 
+	73, -48, -6, 62, -63, -110, 41, 20, 
+	-54, 70, 52, -115, 0, -27, 49, -28, 
+	80, 17, 69, 16, 0, -4, 56, 83, 
+	-1, -45, 28, -8, 47, 67, 121, 26, 
+	47, 114, 100, 79, -96, -45, 8, 2, 
+	36, 26, 11, -141, 12, 43, 132, -15, 
+	87, 51, -12, 3, 54, 84, -22, 62, 
+	-7, 16, 26, -78, 11, -16, -82, 39, 
+	42, -102, -23, 31, 27, -50, -42, -23, 
+	25, -57, -79, 70, -8, -32, -52, -42, 
+	-4, -84, -85, -43, 24, -28, 23, 50, 
+	-16, 31, 60, -68, 12, 36, -5, -42, 
+	46, -137, 48, 2, 50, 54, 33, -56, 
+	56, 36, 7, -29, -35, 6, 63, -86, 
+	-106, -5, -80, 95, 49, -29, 51, 44, 
+	15, 31, 5, -278, 63, -23, 16, -97, 
+	16, -26, 16, 14, 30, 69, 75, -45, 
+	-95, 83, 19, 123, 39, 92, 18, -22, 
+	-95, -159, -95, 106, 59, -94, -67, 17, 
+	8, 50, 20, -87, 78, -28, -10, -29, 
+	-68, -92, 4, -10, 4, 70, -35, 42, 
+	43, 37, 46, -10, -35, 19, -74, -79, 
+	6, -98, -12, -48, -57, -159, 47, 9, 
+	-68, -5, -8, 121, 16, -40, -108, 53, 
+	-106, -16, -174, 6, -124, -35, -173, -49, 
+	-16, 23, -3, -7, -12, -81, -90, 10, 
+	-48, 102, 99, -146, 18, 18, 73, 110, 
+	-58, 23, -1, 73, -57, 22, -22, 35, 
+	-30, 59, -36, -7, 70, 89, 62, -25, 
+	92, 6, 5, 127, -9, 92, -19, 68, 
+	-105, 143, 41, 107, -17, 82, -62, 11, 
+	-44, -12, 17, -51, -41, -67, -50, -72, 
+	44, 11, -20, -59, 25, 117, 34, -54, 
+	-87, 5, -33, 117, -118, 86, -34, -20, 
+	-190, -75, -84, 28, -23, -2, 0, -48, 
+	-14, 19, -27, -150, -19, -36, 62, -142, 
+	-95, -9, 22, -82, 75, 105, 16, -46, 
+	-92, -29, 72, 15, 17, -28, 3, 26, 
+	-30, -123, -282, 69, -61, -99, 13, -63, 
+	70, -47, -37, -100, 41, 48, -6, 49, 
+	59, -52, 112, -59, -35, 91, -146, 6, 
+	-37, 26, 25, -30, 45, -75, -42, 13, 
+	99, -72, -38, -54, -62, -111, -22, -14, 
+	26, 23, 3, 92, 33, 29, -26, -28, 
+	-57, 39, 4, -39, -75, -73, 31, -9, 
+	14, 20, -53, -112, -20, 5, -46, 38, 
+	-52, 6, 13, 65, 57, 79, 47, -25, 
+	-79, 4, -25, 75, 9, -85, 71, 22, 
+	58, 25, 86, 29, 36, 73, 51, -45, 
+	69, -33, -73, -23, 36, 41, 14, -39, 
+	-4, 93, 46, 17, -40, 154, 58, 81, 
+	-81, -81, -53, -6, -19, -25, -35, -58, 
+	14, -7, -91, -42, -102, -12, -40, -2, 
+	-25, -32, 29, -23, 51, -60, -40, -13, 
+	-30, 9, -71, -121, -94, -67, -16, -60, 
+	-11, -16, 12, -175, -24, -16, 64, -160, 
+	4, -15, -10, -74, 19, -44, -109, 7, 
+	-63, -50, 17, -79, -71, -193, -32, -40, 
+	-58, -127, -274, -135, -63, -157, -72, -93, 
+	81, 43, 53, -122, -7, 26, 67, 12, 
+	52, -70, 100, -36, -118, -32, -241, 68, 
+	-49, 14, 5, -128, 14, -101, -5, -53, 
+	93, -170, -99, -115, -9, -54, -41, 36, 
+	35, 63, 27, 150, -74, 0, -11, 5, 
+	-74, 70, -8, -36, -109, -104, 8, 61, 
+	-11, 39, 60, -92, -43, 90, 1, -5, 
+	3, 12, -40, 37, 37, 170, 65, 51, 
+	-52, 16, -2, 27, -52, -46, 40, -23, 
+	136, -26, 88, -46, 67, 88, 102, -34, 
+	-30, -63, 1, 109, 8, 152, 29, 25, 
+	-62, -39, 50, 43, 30, 137, 28, 34, 
+	-86, -41, -21, -68, 19, -49, -18, -44, 
+	-81, -86, -127, -101, -37, -61, -110, 8, 
+	-11, -47, 33, -39, -78, -62, -82, -28, 
+	-59, -71, -2, -92, -41, -93, 83, -92, 
+	-44, -35, -54, -216, 3, 0, 94, -119, 
+	-6, -210, 52, 20, -27, 60, -240, 11, 
+	-32, 57, 82, -89, -46, -144, -56, -13, 
+	-48, -50, -172, -238, -89, -245, -24, -30, 
+	-9, 30, 13, -46, 27, -1, 81, 36, 
+	37, -16, 44, 36, -80, -45, -102, 85, 
+	-59, -5, 31, -90, -58, -67, 43, -53, 
+	24, -20, 26, -28, 32, -55, -43, -50, 
+	15, 18, 46, 109, -47, -25, -45, -20, 
+	-93, 126, -73, -52, -112, -74, -15, -10, 
+	-9, -25, 44, -147, 39, 10, -48, -17, 
+	-55, 21, 2, -18, 29, 56, 18, 75, 
+	-70, 6, 24, -15, -51, 44, -21, -127, 
+	90, 9, 40, -31, 48, 25, 135, -18, 
+	-63, 28, -7, -44, 46, 35, 60, -33, 
+	-122, -29, -32, 92, 22, 101, 31, -72, 
+	-35, 3, -62, -168, 10, -49, 7, -91, 
+	24, -47, -75, -89, -34, -76, -82, 38, 
+	-98, -64, 42, -88, -7, -110, -86, 2, 
+	-157, -141, -91, -58, -96, -153, 25, -86, 
+	6, -58, 39, -308, -27, 28, 83, -62, 
+	7, -255, 24, -24, 24, 17, -221, 14, 
+	-35, -22, 35, 25, -100, -137, -56, -14, 
+	-31, -169, -115, -159, 38, -238, -51, -42, 
+	23, -15, -38, 31, -11, 38, 71, -3, 
+	-79, -102, 67, -111, -8, -30, -95, -8, 
+	90, 22, 47, -36, -55, 12, -120, -35, 
+	42, 38, -12, -41, -5, -27, 43, -15, 
+	69, 57, 51, 86, -52, 10, 6, -61, 
+	61, 133, 39, 66, -27, -71, -4, -32, 
+	102, 41, 79, -110, 73, 87, -19, 19, 
+	-22, 89, 59, 64, -41, 54, 35, 142, 
+	-19, -66, -23, -207, -25, -114, -27, -121, 
+	-1, 68, 6, -24, 35, -26, 200, -60, 
+	-11, 34, -10, 14, -84, 104, -29, -41, 
+	-42, -93, -177, 100, -99, 21, -80, -51, 
+	-71, 0, -35, -132, 26, 34, 125, -78, 
+	-88, -16, -46, -141, -62, 17, -90, -94, 
+	-55, 44, -32, -22, -15, -64, -21, 20, 
+	-121, -99, -183, -101, -74, 27, -54, 4, 
+	81, 6, 115, -291, 47, 157, 174, -147, 
+	184, -148, 249, 81, -35, 58, -248, 83, 
+	18, 22, 200, -189, -5, -140, 119, -26, 
+	88, -210, -189, -169, 39, -31, -56, 60, 
+	60, 190, 88, -56, 25, 72, -19, 4, 
+	116, -72, -34, -33, -183, -253, 84, 104, 
+	-47, 110, 65, -337, 57, -70, 109, 49, 
+	115, -134, -129, 12, 129, 123, 110, 123, 
+	-7, 61, 97, -60, 115, 57, -12, -68, 
+	-20, -158, 53, 24, -76, -48, 62, 14, 
+	-55, 106, 53, -84, -63, 123, 68, 2, 
+	9, -146, -5, 17, 107, 70, 157, -47, 
+	-73, -59, 4, -170, -113, -125, 28, -127, 
+	-62, -17, -59, -37, -52, 10, 68, -180, 
+	-94, -9, -33, -58, -49, -121, -25, -167, 
+	-108, -101, -189, -1, -40, -44, 7, -6, 
+	70, -86, -6, -149, -11, 65, 72, -238, 
+	64, -210, 122, 0, -10, -12, -257, -56, 
+	-55, -23, 93, -100, -13, -82, 17, -56, 
+	-78, -234, -291, -207, -35, -113, -43, -76, 
+	73, -54, 20, -157, 73, 122, 189, -47, 
+	91, -290, 163, 97, 87, 163, -296, 151, 
+	-11, 55, 152, 27, 37, -39, 76, 14, 
+	82, -225, -20, -123, 0, -163, -41, -174, 
+	24, 106, -49, 190, 89, 49, -149, -1, 
+	-111, 107, -107, -9, -134, -27, -82, 135, 
+	-98, 72, -29, -49, -44, -131, -52, 172, 
+	2, 46, 80, -129, 28, -206, 51, -55, 
+	1, 65, -22, 141, 64, 31, -53, -133, 
+	-42, 224, 18, 33, -113, -27, -43, 31, 
+	-2, 13, 46, -23, -37, 9, 35, 122, 
+	87, -38, -80, -47, 129, -164, 52, -44, 
+	-82, -134, -81, 2, -49, -36, 18, -60, 
+	-71, 109, -71, -44, 34, -21, -21, -143, 
+	59, -85, -137, 62, 73, -54, 41, -27, 
+	-90, 64, -57, -90, 64, -194, -118, -3, 
+	-61, -54, 2, 46, 15, -27, 89, -109, 
+	29, -85, 81, -127, 118, 22, -107, 11, 
+	-30, 6, 13, 68, -26, 76, 48, -29, 
+	-18, -128, -116, -17, -19, -263, -127, -137, 
+	32, 23, 36, -165, -5, 82, 70, 121, 
+	-97, -149, 56, -80, 99, 166, -113, 77, 
+	-74, -35, 92, 151, -69, 106, 2, -29, 
+	38, -160, 38, 29, 37, -419, 72, -170, 
+	39, 89, -28, 27, 4, -81, -135, 104, 
+	-201, -6, 18, -103, 18, 125, -112, -14, 
+	20, -30, -11, 194, -105, 15, -204, 77, 
+	-38, 172, 207, 14, 39, -236, 208, -10, 
+	-9, 43, 27, -14, 86, 24, -88, 81, 
+	-12, 248, -9, 57, 70, -28, 59, -11, 
+	43, 141, 59, 36, -43, 54, -29, 175, 
+	21, 108, 34, 52, -95, -66, 40, 131, 
+	-90, -23, -3, 28, -86, -102, -77, 137, 
+	44, 55, -148, 90, 93, -24, 93, -57, 
+	60, 2, -157, -22, 113, 12, 4, -54, 
+	-45, 206, 96, 49, 3, -107, -9, 135, 
+	-50, -141, -22, 19, 39, -24, -13, -32, 
+	-31, 135, -60, 9, 117, 11, 185, -57, 
+	67, -13, -32, 123, -7, 8, 14, 40, 
+	-45, 162, -91, 43, 68, -117, -96, -46, 
+	61, -87, 63, -280, 28, 4, -38, -37, 
+	-22, 88, 103, 3, 101, 84, 147, -11, 
+	-57, -47, -44, 179, -87, 38, -40, -33, 
+	-45, 35, -177, 114, 66, -267, -9, -84, 
+	75, 41, 11, -211, -23, 59, -1, -112, 
+	-154, 61, 0, -86, 128, 138, 196, -19, 
+	-58, 24, -51, 145, -184, 41, -6, -60, 
+	-34, -110, -85, 123, 88, -92, 87, -77, 
+	27, 96, 81, -85, 25, 77, -104, -134, 
+	-148, 47, -33, -95, 117, 97, 138, 67, 
+	-103, 60, -19, 132, -74, 130, 32, 34, 
+	-39, -178, -35, 118, 56, 69, 12, -7, 
+	26, -11, -45, 4, -5, -101, -83, 36, 
+	-4, 46, -76, 43, 48, -106, 76, -53, 
+	-4, -2, -106, -2, 60, 122, 37, 30, 
+	-90, 25, 121, 89, 57, 18, -21, 50, 
+	-118, -105, -68, 0, 39, -118, -33, 22, 
+	5, 46, -99, 14, 58, 4, 79, -145, 
+	99, -49, -100, 20, 91, -9, 12, -40, 
+	-13, 141, 30, 24, 12, 100, -47, 124, 
+	88, -35, 25, -231, -19, 30, 36, -97, 
+	107, 161, -49, 72, 27, -83, 160, -81, 
+	38, -51, -74, 23, 84, -28, 109, 82, 
+	76, 67, -147, 100, 30, 24, -92, 83, 
+	46, 16, -18, -207, 41, 14, 36, -191, 
+	76, 197, 59, 22, -81, -40, 159, -14, 
+	48, 4, -18, -54, -12, 13, 39, 23, 
+	43, -110, -242, 79, -88, 7, 38, -32, 
+	33, -21, -75, -79, 1, 33, 78, -34, 
+	161, 124, 28, -86, -127, -62, 180, 79, 
+	-42, 131, 89, -160, 98, -15, 23, 33, 
+	11, -186, -100, 24, -124, 154, -96, 13, 
+	-18, -85, 24, -20, 19, 6, -99, -63, 
+	-46, -73, -37, -55, 47, -57, 17, -69, 
+	-20, -12, -68, -93, -43, -17, 32, -16, 
+	-24, -93, -69, 58, 13, 85, -75, -66, 
+	-17, 4, -44, 15, 12, -42, -8, 40, 
+	32, 124, -4, -26, -76, -108, 23, -80, 
+	51, -3, 2, -154, 2, 29, -79, -7, 
+	19, -23, -44, 8, -10, 50, 22, -16, 
+	44, 12, -24, -23, -64, -34, 61, 54, 
+	69, 208, 1, -33, -122, -162, -48, 15, 
+	41, 30, 22, -139, 58, -25, 75, 34, 
+	18, 41, -26, 7, 80, 24, -48, 66, 
+	-42, -12, 29, -91, -39, -19, -17, 85, 
+	81, 124, -51, 7, -123, -66, 70, -31, 
+	55, 83, -59, -92, 122, 97, 111, -44, 
+	-1, 67, -44, -17, 52, -44, 15, 52, 
+	20, -43, -20, -80, 21, -28, -53, 49, 
+	76, -2, -28, 0, -81, -56, -95, 44, 
+	-27, 72, 2, -147, 75, -87, 98, 39, 
+	33, 106, 102, -126, -46, -93, 42, 3, 
+	16, -47, -10, 22, -8, -32, 8, 1, 
+	78, 50, -27, -57, -113, -134, -58, -4, 
+	-44, 44, -1, -178, -17, -78, 16, 41, 
+	-40, 1, -55, 0, -54, 79, -50, 44, 
+	-8, 11, 2, -50, 9, 46, 42, -50, 
+	66, 68, 29, -38, -106, -66, -96, 29, 
+	41, -4, -14, -189, 34, -47, 96, -28, 
+	-7, -46, -44, -76, -2, 14, 11, 115, 
+	42, 22, 72, 26, -49, 33, -70, 15, 
+	38, -5, -48, 64, -141, -88, 1, 31, 
+	-71, 15, -42, -174, 2, 5, 144, -4, 
+	130, -37, -27, 43, 50, -5, -28, 11, 
+	60, -60, -17, -54, -3, -3, -127, -98, 
+	-77, -40, 18, 80, -23, 1, 23, 9, 
+	-21, 109, 6, -31, 5, 83, -12, 9, 
+	-80, -122, -140, 18, -14, -29, 1, -20, 
+	41, 0, -10, -98, 8, 49, -141, -52, 
+	-34, -120, 31, 32, -33, 31, -98, -14, 
+	-107, 53, 33, -1, -35, -70, 26, 16, 
+	120, -131, 44, -119, 37, -167, 36, -62, 
+	-42, -11, 6, -45, -47, 26, -35, -57, 
+	-9, -84, 17, -15, -97, -25, -181, 31, 
+	-98, 6, 37, -70, 0, -72, 27, 7, 
+	18, 15, 29, -140, 13, -171, 49, -77, 
+	20, -46, 22, -6, -9, 26, -31, 38, 
+	27, 31, -24, 80, -79, 30, -60, 59, 
+	7, -30, -23, -34, -43, -109, 4, 26, 
+	9, 32, 101, -58, -37, -167, -1, -82, 
+	-90, -27, -97, 174, 50, -64, -101, 119, 
+	-152, 201, -25, 35, -93, -87, -5, 11, 
+	56, 94, -34, -20, 0, -74, -56, 41, 
+	27, 61, 106, -48, 49, -138, 34, 74, 
+	20, -49, -53, 44, 69, -30, -68, -24, 
+	-54, 234, -33, 95, -99, -89, -92, 22, 
+	24, -18, 22, -51, 44, -81, 34, 27, 
+	159, 21, -113, -60, 117, -177, -56, 62, 
+	-41, 36, 37, -95, 21, 58, -73, 102, 
+	-46, 205, -74, -57, -72, -106, 104, 32, 
+	14, 50, -1, -84, 20, 69, 72, -50, 
+	216, -27, -38, 101, 54, 73, -43, 39, 
+	-36, 19, 34, 12, 33, -37, -11, 9, 
+	-23, -182, -9, -45, -18, -6, -134, -13, 
+	-104, -6, -6, 30, -85, -97, 4, 38, 
+	101, -99, -8, -54, -36, -223, 44, -46, 
+	-59, 30, -35, -9, -31, -76, 16, 48, 
+	-95, -76, 47, -37, 41, 21, -23, 30, 
+	-44, -17, 14, 70, -72, 27, -40, 14, 
+	19, 14, -51, -20, -42, -227, 96, 62, 
+	14, 44, -8, -111, 7, 8, -137, -24, 
+	-134, 54, -78, 47, 4, -37, 108, -42, 
+	-44, -25, -56, 38, -59, 83, -20, -9, 
+	-23, 30, 4, 128, -31, -124, 87, 112, 
+	29, 6, 52, -166, 100, -3, -107, 4, 
+	-55, 135, -43, 47, 60, -27, 124, 31, 
+	-32, 77, -73, 48, -17, 31, -15, -51, 
+	48, 23, -55, 146, -22, 80, 85, 115, 
+	45, 14, 71, -12, 89, -94, -203, -36, 
+	-69, 193, -103, 72, 83, -41, 104, -3, 
+	21, 43, -91, 12, -80, 75, 52, -8, 
+	8, -86, 34, 93, -70, 20, 9, 89, 
+	-5, 12, -70, 21, -13, -46, -89, 8, 
+	-103, -119, -40, -106, -83, -67, -71, 34, 
+	-38, 36, -39, -35, -152, -91, -65, -37, 
+	24, -105, 76, -78, -7, -122, 4, -159, 
+	-28, -5, -27, 45, 31, -36, -90, -25, 
+	-36, 29, -85, -76, -38, -12, 8, -46, 
+	-71, 17, -87, -54, -91, -34, -60, 45, 
+	21, -70, 3, 8, 18, -72, -87, -41, 
+	-24, 38, -72, 43, -4, 15, -88, -72, 
+	-74, 141, -24, -28, -22, -64, 131, -41, 
+	-89, -72, -57, -54, -62, -49, -17, 10, 
+	-54, 7, -90, 56, 10, 33, -35, 15, 
+	-28, -15, 5, -3, 17, -22, -48, -17, 
+	-55, 172, -3, -129, 21, -26, 89, -49, 
+	-71, 3, -54, 5, -43, 13, 0, -17, 
+	-112, -106, -107, 12, -80, 59, -2, 33, 
+	44, -12, -34, -27, -33, -84, -71, -12, 
+	-20, 32, -81, 3, 25, -21, -31, -30, 
+	-30, -30, -17, -27, 14, -7, -54, 9, 
+	33, -154, -26, -74, -27, -38, 1, -29, 
+	21, -59, -31, -1, -11, -8, -48, 19, 
+	70, 111, -78, -9, 118, 68, 127, -21, 
+	109, -7, 42, 56, 3, 3, 55, 1, 
+	-14, 100, -4, 93, 1, 103, 9, 134, 
+	-2, 32, 5, 30, 5, -32, -119, 42, 
+	42, 84, -178, 48, -21, -106, 87, -14, 
+	101, -5, -68, -75, 64, -20, -27, -20, 
+	29, 120, 100, -6, 5, 140, -3, 91, 
+	-54, -14, 31, -17, -23, -32, -78, 49, 
+	2, 121, -132, 64, -97, -135, -92, 22, 
+	117, -40, -41, -144, 135, -125, 87, 18, 
+	88, 83, 27, -145, -85, 83, -32, 188, 
+	7, -44, 45, 11, 15, 0, 94, 5, 
+	4, -52, 44, 95, -94, -48, -171, 42, 
+	25, -35, 43, -144, 0, -85, 111, -61, 
+	34, -8, -50, -167, 2, -85, 29, 44, 
+	10, -71, 18, 49, 41, 36, -84, 34, 
+	19, -46, -63, 16, -181, -136, -74, 16, 
+	-25, 53, 39, -159, 20, -122, 127, -77, 
+	76, -25, 47, -101, -26, 24, 14, 2, 
+	18, 4, 90, -121, 8, 28, 14, -38, 
+	120, 130, 6, 34, -35, -137, 72, 5, 
+	-28, 37, 56, -157, -58, 79, 56, -4, 
+	-6, -39, -92, 46, 10, 54, -18, 66, 
+	25, 8, 11, -177, -12, 65, -124, -61, 
+	28, -32, -149, -72, -97, -152, 49, -56, 
+	-14, 15, -14, -109, -14, 91, 98, -25, 
+	-19, -77, -121, 5, -11, 76, 65, 135, 
+	15, -69, 69, -195, 52, -9, -39, -4, 
+	-40, -72, -92, 33, -101, -122, 14, -70, 
+	-58, 48, -47, -199, -29, 52, 24, -32, 
+	15, -49, -68, 14, 27, -9, 111, 45, 
+	55, -73, 57, -36, 34, -35, 42, -55, 
+	-27, -152, 47, -74, -131, -43, -53, 32, 
+	-99, 43, -8, -106, -112, 68, 10, -67, 
+	88, -75, -43, -8, -47, 44, -2, 4, 
+	-27, -60, -16, 70, -77, -89, -125, 9, 
+	-73, -163, 43, -75, 18, 10, 32, 1, 
+	-99, 10, -70, 5, -65, 23, -91, -41, 
+	14, -154, 14, 20, -43, 89, 19, -133, 
+	37, 9, 52, -59, 26, 12, -21, -47, 
+	115, 80, 11, 24, -28, 26, 145, 13, 
+	58, 10, -1, -120, 114, -6, 117, 53, 
+	36, -11, -82, 13, -26, -13, -59, -36, 
+	35, -78, 3, -44, 50, -33, -128, -4, 
+	8, 233, -117, 18, -168, -145, 153, 20, 
+	78, 103, -27, -228, 120, -30, 6, 115, 
+	15, 27, -56, 49, -113, -145, -125, -43, 
+	-23, 8, -31, -45, 95, 65, -81, 6, 
+	-25, 200, -51, 64, -88, -129, 37, 67, 
+	97, 57, 36, -138, 58, -168, 40, 35, 
+	46, 11, -22, -33, -52, -174, -19, -23, 
+	-64, -44, -23, 127, 40, -42, -32, 21, 
+	3, 168, 11, 28, -75, -129, -20, 62, 
+	15, 53, -38, -126, 93, -182, 80, 36, 
+	143, 57, 36, -66, 49, -151, -94, -45, 
+	-61, -66, -77, 125, 3, 8, -73, 88, 
+	-17, 72, 46, -10, -97, -69, -84, -28, 
+	70, -56, -84, 22, -8, -125, -96, -40, 
+	95, 59, 99, -84, -4, -73, -76, -19, 
+	120, 54, 52, -75, 0, 71, 14, -33, 
+	70, 87, 67, -41, 21, 126, 66, 66, 
+	60, 11, 27, 192, 67, 62, 92, -25, 
+	96, -34, -12, -41, 49, -324, 116, 128, 
+	10, 5, 63, -213, 8, 43, -181, -20, 
+	35, 45, -96, 60, -50, -64, -47, 9, 
+	68, -10, -17, 5, 2, 47, 55, -2, 
+	-10, -1, -97, 27, -47, -243, 83, 187, 
+	41, 31, 40, -217, 21, -57, -202, 13, 
+	-152, -57, -96, 12, -44, -124, -131, -26, 
+	15, 19, -23, 6, -96, 63, 22, 3, 
+	-23, 19, -10, -83, 20, -169, 111, 91, 
+	55, 37, -19, -32, -37, -52, -62, 81, 
+	-163, -57, -9, -33, -31, -69, -160, -18, 
+	-44, 29, -59, -10, -143, -13, -96, -4, 
+	-30, 17, 13, -33, -57, -34, 88, 28, 
+	-2, 2, -28, 16, -37, -105, -60, 83, 
+	-55, -88, -81, 43, -51, -36, -52, 33, 
+	-27, 49, -29, -114, -2, 28, -115, 28, 
+	45, 79, 42, -4, -31, 34, -9, 95, 
+	60, 1, 81, -103, 34, 27, -6, -39, 
+	-31, 137, 81, -32, 20, 87, 75, 96, 
+	-31, 59, 77, 74, 61, 35, -10, 7, 
+	64, -66, -50, 111, 32, -260, 0, -9, 
+	96, 45, -22, -173, 2, 57, -200, -113, 
+	-161, 190, -38, -55, 43, 64, 140, 31, 
+	-108, 70, -8, 82, -86, -14, -90, -28, 
+	-149, -124, -48, 83, 25, -102, -41, -70, 
+	30, -17, -10, -166, 57, -38, -154, -51, 
+	-242, 191, -88, -113, 20, 33, 62, -51, 
+	-84, 43, -8, 66, -82, 23, -81, -17, 
+	-91, -117, -72, 55, -27, -44, -33, -145, 
+	-25, 40, -47, -65, 25, -5, 25, -94, 
+	-117, 94, -21, -110, 61, -25, 93, -57, 
+	-90, -32, -42, 3, -54, 22, -101, 44, 
+	-19, -79, 7, 43, -7, 54, -9, -42, 
+	-48, 32, -8, -12, 45, -42, -56, -98, 
+	-50, 1, 68, -53, 17, 13, -68, 16, 
+	13, -30, 16, -36, 14, -68, -26, -25, 
+	-15, -47, -61, -74, 9, 106, -20, 1, 
+	2, -5, 24, 68, 40, -87, 65, -44, 
+	-74, 5, 42, -63, 120, 89, 81, -80, 
+	-20, 32, 11, 13, -23, 85, -104, 38, 
+	-29, -79, -49, 92, 12, 99, 4, -20, 
+	-12, -19, -69, -12, -28, -42, 90, 20, 
+	73, -5, -1, -76, -1, 83, -82, 1, 
+	27, 47, 28, 101, 56, -65, -42, 14, 
+	29, -37, 13, -65, -5, 30, 98, 97, 
+	38, 11, -56, 26, 13, -11, 60, 65, 
+	3, -93, -23, 38, -70, 23, -83, 0, 
+	15, -49, -6, -58, 70, -33, 79, -103, 
+	45, 8, 75, -78, -23, 69, 88, 70, 
+	-38, -61, -67, 23, 9, -80, -12, -15, 
+	6, -212, -14, -7, -29, -78, -103, -25, 
+	-109, -63, -54, -51, -41, -85, 84, -12, 
+	74, 6, -72, -9, -85, 35, -64, 15, 
+	-41, -72, -101, -6, -73, -80, -1, -50, 
+	-115, -201, -65, -121, 17, -10, -65, -37, 
+	-79, -134, -50, -6, -22, -75, 13, -80, 
+	-42, -108, 16, 4, -42, -1, -41, -115, 
+	-28, -26, -60, -5, -26, 36, 108, -88, 
+	56, -97, 8, -69, -95, -145, -60, 11, 
+	-91, 35, -9, -288, -31, -98, 68, -4, 
+	5, -116, -61, -60, -9, 128, -93, -25, 
+	41, 23, -24, -106, -43, 5, 78, -69, 
+	92, -220, 47, -64, 61, -70, 59, 39, 
+	-99, -10, 59, -184, -96, 13, 64, -101, 
+	70, -134, -110, 10, 21, 106, -85, -83, 
+	62, -99, 11, -38, -24, -68, 27, -76, 
+	-64, -14, 68, -113, -31, -102, 41, 5, 
+	-80, 23, -24, -117, -57, -20, -17, -63, 
+	92, -62, -56, -78, -21, 31, -108, -187, 
+	-44, -20, -141, 110, -5, -29, 16, 54, 
+	-25, -17, -69, 4, -84, -19, -11, 30, 
+	-71, -23, -87, -147, 26, -45, 18, -8, 
+	42, 9, 26, -82, -39, 45, -84, -148, 
+	-106, -90, -73, 147, -78, -29, -53, 47, 
+	-26, 36, -78, 10, -21, -138, -18, -88, 
+	-16, -159, -70, -67, -31, -123, -18, -84, 
+	-47, 24, 81, -89, -62, 30, -92, -33, 
+	-37, -54, 43, 13, 78, 29, 14, -8, 
+	43, 83, 30, 4, -200, -200, 1, 98, 
+	28, 5, 6, -330, 17, -107, 74, -5, 
+	117, 23, -51, -175, -38, 88, -122, -66, 
+	-64, -38, -18, 87, 58, 2, 89, -60, 
+	47, 128, 44, 7, -159, -177, 23, -5, 
+	97, 18, 31, -311, 43, -105, -10, -48, 
+	-75, -4, -88, -49, -56, 48, -117, -3, 
+	23, -32, -87, 8, 57, 18, 29, 79, 
+	71, 126, 53, 39, -122, -200, -109, 136, 
+	63, 17, 49, -166, 156, -174, -23, -12, 
+	49, -35, -49, -266, -56, -103, -46, 16, 
+	-70, -9, -50, 24, 7, 52, 77, 68, 
+	30, 81, 35, 67, -148, -180, 44, 94, 
+	46, -7, 1, -160, 92, -206, -23, 52, 
+	66, 35, 48, -191, 10, -101, 4, 90, 
+	-91, -80, -66, 82, -28, 50, -114, 151, 
+	45, 76, -77, 57, -136, -148, -105, 17, 
+	60, -48, 48, -46, 107, -151, -8, 91, 
+	37, 105, 140, -183, -63, -154, 31, 52, 
+	-52, -1, 42, -12, 55, 66, -79, 63, 
+	48, 69, -22, 10, -182, -170, -97, 64, 
+	62, -14, -1, -111, -3, -110, 45, 100, 
+	19, 41, -28, -148, -1, -154, 49, 145, 
+	-29, 17, -2, -20, 19, 66, 34, -66, 
+	18, 112, 2, 86, -92, -105, -120, -42, 
+	2, 60, 37, -76, -23, 16, 94, 29, 
+	-39, 31, -90, -52, 64, -101, 20, 183, 
+	17, 46, 40, -167, 65, 109, -110, -7, 
+	67, 35, -18, 17, -17, -33, -55, 61, 
+	-34, 69, 9, 21, -54, 79, 50, -15, 
+	52, -106, -109, 16, 43, -140, 66, 108, 
+	123, 49, 55, -89, 27, 20, -109, 69, 
+	-95, -78, -41, 78, -38, 7, -52, -59, 
+	31, 18, 6, 78, -129, 22, -4, -28, 
+	10, 2, 117, 66, 71, -96, 91, 59, 
+	51, 40, 55, -46, 20, 51, -138, 66, 
+	-20, -68, -89, 20, -101, -27, -42, -83, 
+	-30, 1, 77, 64, 36, 23, -5, 38, 
+	-19, 45, 142, -28, -38, -98, 65, 37, 
+	61, 36, 57, -41, -5, -54, -58, -77, 
+	-85, -100, 16, 10, 2, -50, 68, 20, 
+	-115, -14, -63, 19, -112, 39, -27, 3, 
+	-37, -138, -55, 15, -51, -126, 9, -75, 
+	87, -6, -18, -63, 30, -15, -64, -42, 
+	-97, 148, 72, 90, 80, -10, 114, 7, 
+	-113, 26, -65, 103, -43, 69, 35, -70, 
+	-71, -169, -20, 187, 27, -14, -67, -33, 
+	17, 42, 17, -79, 25, -1, -146, -118, 
+	-203, 189, -35, -81, 73, 35, 161, -65, 
+	-75, 52, 10, 108, -110, 105, -20, 49, 
+	-117, -98, -57, 192, 5, -29, -47, -109, 
+	24, -19, 17, -144, 16, 78, -13, -33, 
+	-120, 114, -13, -87, 66, 110, 67, 58, 
+	-86, 59, -26, 101, -107, 32, 15, 59, 
+	49, -212, -39, 54, 35, -103, -22, -147, 
+	31, 145, -45, -51, 35, 120, -28, -23, 
+	-58, -50, 1, -21, -66, 4, -34, -44, 
+	-82, 22, 83, 4, -58, 37, -50, 11, 
+	60, -100, 14, 58, 77, -6, -57, -116, 
+	42, 5, -27, -246, 39, 164, 135, -170, 
+	165, -112, 147, -31, -211, -12, -251, 71, 
+	-55, -24, 158, -101, 40, -235, 66, -30, 
+	30, -109, -239, -195, -24, -111, -79, 0, 
+	79, 58, 20, -66, 14, 52, -103, 9, 
+	-30, -163, 2, 19, -134, -134, -336, 22, 
+	21, -41, 73, -217, -8, -159, -18, -26, 
+	15, -67, 53, -179, -63, -38, 94, -96, 
+	38, 36, 32, 11, 26, -45, -5, 63, 
+	-69, -129, -22, 72, -62, -46, -155, -33, 
+	46, -50, 29, -111, 38, -80, -104, 49, 
+	53, 27, 99, -127, 36, -19, 47, -63, 
+	54, 42, -37, 79, 97, 2, -15, -17, 
+	-12, -47, 7, 161, -199, -50, -109, -7, 
+	29, 68, 19, -107, 11, -56, 82, 53, 
+	37, -2, 94, -82, 7, 10, 18, -32, 
+	-14, 13, -2, 21, 4, -16, -3, -6, 
+	97, -22, -19, 71, -63, 19, -61, -33, 
+	59, 27, 100, -60, 56, -1, -38, 31, 
+	-130, 21, 18, -87, -62, -37, 3, -1, 
+	75, -71, -26, -67, 6, 133, 86, -47, 
+	60, -134, 128, 10, -140, 27, -353, 42, 
+	-17, 20, 159, -105, -19, -111, 57, 14, 
+	27, -87, -134, -272, 29, 30, -42, -37, 
+	74, 68, -43, 66, 51, 56, -8, -59, 
+	-12, -117, 47, -37, -107, 28, -214, 44, 
+	-18, -11, 111, -135, -1, -19, -6, 8, 
+	-18, -25, -48, -122, -19, 41, 14, -61, 
+	-22, 91, -69, 15, 49, 44, 81, 84, 
+	-30, -55, -38, -77, -35, -71, -163, 64, 
+	43, -51, -24, -124, 36, -17, -63, -7, 
+	74, -64, 45, -125, 44, 82, -30, 21, 
+	-3, 48, -28, 45, 37, 44, -1, 23, 
+	53, -47, 38, -28, 56, 60, -94, 41, 
+	-10, 2, 91, -9, -50, 9, 60, -40, 
+	50, -84, -53, -58, 29, 135, 8, 44, 
+	-43, -5, -10, 0, 46, 57, 69, -68, 
+	2, -99, 34, 28, 54, 113, -115, -1, 
+	52, -56, 141, 58, -5, 40, 26, 43, 
+	4, -89, -44, -40, 31, 48, 17, 7, 
+	-3, -23, 6, -138, 86, 17, 84, -164, 
+	-9, -307, 143, -48, 85, 170, -11, -18, 
+	-52, 60, 73, 134, -59, 121, -60, -12, 
+	-44, -146, -69, 47, 37, -32, 28, -158, 
+	83, 101, -15, 13, -8, -17, 58, -111, 
+	-32, -300, -29, -98, -11, 134, -66, -34, 
+	-87, -16, -47, 136, -84, 110, -144, 12, 
+	15, -187, -33, 84, 35, 81, -9, -98, 
+	-24, -21, -25, -1, -97, 2, -58, -48, 
+	-10, -204, -40, -142, 23, -22, -38, -77, 
+	-171, -60, -33, -18, -77, 104, -53, 20, 
+	-28, -237, -35, 28, -51, 113, -112, -90, 
+	49, 5, 52, 4, -23, 53, -51, -68, 
+	-109, -100, 3, -231, 61, 70, 102, 47, 
+	-147, 44, 54, -48, -137, 142, 6, -71, 
+	-34, -197, 43, 57, 31, 51, -13, -125, 
+	61, 35, 49, -43, -24, 14, 4, -152, 
+	-45, -42, 75, -87, 40, 57, 29, 73, 
+	-106, -14, 42, 74, -212, 72, -6, 23, 
+	-53, -156, -61, 27, -5, 40, -47, -86, 
+	41, 18, 1, -107, -89, 16, 33, -129, 
+	-49, -54, 106, -170, 181, 81, 28, -15, 
+	-105, -100, 0, 143, -184, 21, -114, -10, 
+	-4, -73, -3, 51, 40, 15, -85, -188, 
+	73, 74, 0, -4, -52, -17, -93, -12, 
+	68, -54, -18, -201, 61, 48, 130, 42, 
+	-117, -38, -74, 75, -135, 76, -70, -5, 
+	5, -89, 26, 65, -13, 33, -50, -239, 
+	-24, 58, -12, 82, -31, -70, -85, -149, 
+	-108, 59, -115, -144, 3, 24, 149, -61, 
+	-95, -43, -113, 55, -108, 74, -125, 36, 
+	-103, -115, -106, 123, -18, 176, -87, -173, 
+	-12, -55, -78, -99, -71, -54, -6, -131, 
+	32, 58, -75, -258, -75, -42, 104, 26, 
+	-92, -78, -15, -38, 57, 4, -86, -22, 
+	-53, -94, -146, -15, -42, 30, -94, -19, 
+	-17, 25, 50, -73, 40, 69, 55, -47, 
+	90, 95, 46, -36, -53, -75, -30, 9, 
+	-29, -81, -42, -86, -64, 8, 94, 19, 
+	15, -48, -111, -10, 52, 6, -81, 16, 
+	-75, 16, -76, 5, -61, 24, 123, -178, 
+	-82, 3, 12, -151, 12, -9, 4, -7, 
+	-113, -123, -59, 22, -116, -11, -53, -13, 
+	-63, -129, -147, -3, -71, 57, -106, -110, 
+	-7, 9, -4, 34, -46, -96, -52, -65, 
+	-2, 69, -119, -148, -1, -65, 92, -18, 
+	-11, -106, -70, 12, -49, -47, -16, -52, 
+	55, -83, -55, 19, -75, 124, -74, -64, 
+	-52, -85, -52, -53, 11, 21, 74, -50, 
+	125, 54, 42, -26, -136, -45, 16, -59, 
+	-54, -31, 6, -131, 69, -66, -22, -50, 
+	-139, -86, -48, -73, -26, 79, -26, 51, 
+	52, -52, 70, -134, -18, 116, 7, -27, 
+	77, 13, 45, -64, -70, -62, -95, 16, 
+	19, -38, 63, -116, 63, -119, 67, -46, 
+	82, -59, -177, -127, -7, -71, 42, 34, 
+	-43, -63, 36, -4, -42, 72, -146, 0, 
+	-7, 6, -24, 64, -98, -95, 81, -27, 
+	41, 55, 44, -108, -27, 104, 38, -40, 
+	1, 37, 0, 45, -58, 16, 23, -19, 
+	-33, -64, -73, -1, 27, -19, 49, 17, 
+	77, 143, 15, -56, 4, -7, -16, -14, 
+	74, -52, -30, -152, 7, -86, -23, 7, 
+	-43, 77, 111, -79, -111, 46, 30, 82, 
+	-4, 1, -19, -3, 34, 16, 49, -55, 
+	77, 72, 74, 11, -103, -23, -148, 27, 
+	20, -78, 12, -66, -34, -162, 50, 21, 
+	45, 102, -42, -165, -2, -128, -64, 73, 
+	-55, -50, -21, 26, -91, -29, -43, 51, 
+	-41, 3, -24, -97, -36, -69, 13, 25, 
+	39, -77, -72, -15, -52, -55, -42, -29, 
+	88, 74, -3, -6, -6, 65, -4, -101, 
+	-58, -93, -92, 18, -92, -64, 58, -83, 
+	-21, 17, 39, -35, -110, -87, 35, -37, 
+	-38, -68, -63, -39, -79, -13, 27, -63, 
+	-12, -21, -26, -59, -30, 78, -22, -18, 
+	-57, -18, -1, -21, 2, 54, -10, 41, 
+	63, 65, 40, -22, -142, -3, 26, 26, 
+	19, -33, 46, -47, 7, -24, -15, 10, 
+	63, 86, 73, -139, 1, -42, 5, -18, 
+	24, 3, -51, -47, 31, 21, -21, 10, 
+	-11, -28, 88, 104, -137, -29, -225, -46, 
+	25, -8, 49, -77, 24, -69, 2, 33, 
+	-73, 33, -19, -144, -37, -206, 7, 83, 
+	-54, 22, -39, 54, -15, 5, -112, 71, 
+	-38, -78, 53, 47, -110, -97, -39, 21, 
+	18, 76, 43, -185, 80, -107, 25, 27, 
+	-61, 52, 100, -71, -11, -38, 4, 31, 
+	4, -14, -116, 97, -10, -47, -115, 119, 
+	15, 110, -186, 50, -138, -218, 8, -26, 
+	26, -6, -71, -133, -17, -163, -154, 39, 
+	-79, 74, 112, -75, -62, -26, -25, 60, 
+	-2, -36, -59, 47, 82, 74, -55, -70, 
+	49, 235, 12, 94, -133, -170, -6, -31, 
+	50, -10, 13, -44, 34, -289, 99, 33, 
+	2, 44, -13, -162, 16, -114, -63, 146, 
+	59, 12, 43, -93, 64, 21, 19, 20, 
+	46, 120, 79, 30, -84, -133, 1, 47, 
+	81, 29, 73, -124, 46, -72, 156, 21, 
+	105, 17, -89, -107, 68, -26, 22, 143, 
+	47, 45, 36, -29, 93, -7, -50, -30, 
+	-31, -22, 1, 88, -52, -28, -193, 46, 
+	5, -9, 70, -47, -24, -89, 16, 95, 
+	-51, 3, -30, -53, 7, -143, 16, 43, 
+	-20, 5, 19, 9, 92, 3, -33, 1, 
+	5, -30, 28, -112, -133, -52, -108, 46, 
+	1, -26, -9, 30, -60, 25, -77, 38, 
+	-75, 2, 15, -142, 88, -88, 55, -4, 
+	48, 55, 20, -169, 78, 34, -90, -8, 
+	-28, 76, -113, 63, -182, -16, -225, 10, 
+	-25, 1, 1, -58, 44, 22, 83, -16, 
+	111, -26, 7, -112, 34, -222, 50, 137, 
+	-27, 16, 38, -115, 34, 29, -99, -32, 
+	17, 5, -105, 100, -154, -88, -103, 22, 
+	-36, 83, 51, -135, -39, 64, 26, 51, 
+	91, 42, 5, 14, 26, -86, -20, 48, 
+	-17, -2, 15, -37, 17, 46, -27, -62, 
+	1, 149, 60, 135, -13, 46, 37, 17, 
+	-25, 87, 44, 3, -32, 33, 46, 69, 
+	25, 46, 11, 81, -36, -44, -30, 32, 
+	48, 42, -43, 150, 22, 1, 52, -32, 
+	-100, -59, -2, -49, -75, 41, -23, 29, 
+	-52, -5, 8, -28, -109, -44, -57, 88, 
+	-92, -55, -19, -12, -31, 16, 5, -113, 
+	83, 15, 26, 13, -5, 44, 13, -157, 
+	30, -85, 76, 22, 2, -17, 0, 71, 
+	-18, -7, -21, 10, -2, -39, -82, 59, 
+	19, -65, -18, 38, 18, 22, -67, -77, 
+	33, 65, 40, -90, 46, -3, -165, -25, 
+	-31, 122, -86, -60, 37, -6, 13, 8, 
+	-79, 41, -53, 73, 25, 35, 55, 116, 
+	93, -126, -112, 67, 44, -16, 34, -71, 
+	-10, 77, 47, -36, -34, 20, -125, 2, 
+	-111, 38, -108, -122, 61, 27, 35, -41, 
+	-128, -14, -30, 92, -85, 52, -86, -20, 
+	-96, -85, 1, 94, 29, -51, 109, -36, 
+	-70, 18, 21, 61, 19, -65, -141, 69, 
+	-111, 28, -22, -41, -10, 25, 46, -17, 
+	-128, -10, -94, 146, -100, 58, -45, 41, 
+	-54, 2, 79, 16, 35, -46, 127, 47, 
+	-54, -4, -16, 127, -72, -53, 53, -17, 
+	-184, -175, 103, -95, 20, 60, -11, -54, 
+	-120, -17, -14, 145, -203, -27, -109, 19, 
+	-33, 10, 61, 26, -62, -31, 40, -206, 
+	42, 10, -59, 102, 1, 33, -3, -28, 
+	-91, -90, -21, -11, 45, 128, -80, 84, 
+	-86, -15, -12, 104, -185, -48, -69, 28, 
+	171, -76, 22, 12, -55, -18, 86, -121, 
+	-54, 39, -90, 39, -48, -11, -60, 26, 
+	-220, -25, -83, -50, -44, -14, 41, -60, 
+	-115, -56, -87, 15, -166, -48, -115, -7, 
+	112, -56, 41, 20, -10, -56, 32, -143, 
+	22, 1, -14, 5, -27, -70, -47, -92, 
+	-151, -13, -83, -73, 58, 35, 44, -79, 
+	-80, 9, -118, 28, -112, 19, -141, 17, 
+	-4, -41, -97, 5, 17, 12, -80, -74, 
+	-40, -48, 1, -125, -8, 3, -63, -21, 
+	-135, 84, -18, -98, 62, -16, 35, -54, 
+	-61, -88, -28, 35, -59, 75, -74, -50, 
+	-25, -158, -63, 98, -7, 23, -12, -98, 
+	3, -7, -60, -144, 31, -7, 6, 27, 
+	15, 71, -48, -56, -214, -54, -169, -70, 
+	11, 55, -15, -100, 36, -119, -90, 0, 
+	-43, 82, -120, -148, -81, -338, 7, -5, 
+	23, -19, -68, -154, 67, 72, -1, -64, 
+	45, -10, 68, 9, -117, -28, -153, 20, 
+	82, -29, 52, -96, 178, -49, 56, -2, 
+	-39, 47, -66, -90, 25, -95, -31, 34, 
+	47, -40, -14, -167, 55, 58, -91, 53, 
+	100, -125, -15, 52, -67, -15, -154, 15, 
+	6, 9, 92, 8, 60, -11, 79, 49, 
+	101, -3, 17, -67, 54, -134, -41, -17, 
+	-74, -19, -58, 31, 32, 6, -149, 47, 
+	-84, -43, -61, 65, 8, -9, -105, -48, 
+	65, 43, 12, 79, 81, 75, -65, 1, 
+	-121, 53, 70, -17, 16, -107, -43, -6, 
+	-58, 62, -38, 19, 33, -53, -158, 44, 
+	-86, 8, -114, 101, -178, -4, -171, -3, 
+	-21, -31, -45, 3, 14, 11, -101, -8, 
+	-56, 82, 120, -31, -100, -68, 62, 8, 
+	-7, 33, 15, -335, -37, 15, -13, -57, 
+	17, -153, -13, 36, -64, 27, -42, -62, 
+	21, 8, 62, 63, 94, 21, -50, 17, 
+	-95, -123, -181, -38, -75, -224, 4, 23, 
+	25, -3, -31, -94, 62, 76, 7, -101, 
+	155, -180, 22, 66, -76, 57, -85, 49, 
+	-31, 5, 101, 55, 43, -28, 74, 53, 
+	-46, -176, -71, 82, -1, -45, -121, -18, 
+	22, 38, 37, -62, -9, 44, -82, 26, 
+	58, -185, -119, -52, -8, -67, 88, -3, 
+	-50, -51, 18, 49, -5, 42, -37, -11, 
+	62, -188, -55, 96, 8, 117, 26, -76, 
+	-25, 57, -15, -84, -35, -69, -134, 26, 
+	-87, -93, -83, -123, 114, 53, -4, -33, 
+	-100, -69, 12, 103, -152, 106, -68, 15, 
+	-90, -44, 91, 55, -45, -40, 44, 68, 
+	-43, -29, 31, -21, -44, -29, -110, 26, 
+	-110, -197, -41, -91, -37, 107, -113, -30, 
+	-5, -23, 31, 139, -41, 29, -150, 13, 
+	-86, -25, 80, -52, -14, -84, 70, -59, 
+	-27, 23, -4, -177, 56, 39, 141, -287, 
+	13, -69, 42, -110, 60, 130, 35, -9, 
+	-127, 19, 87, 112, -61, -20, 33, 18, 
+	49, -174, -96, -14, 52, -11, -27, -105, 
+	11, 75, -26, 56, -40, 13, 41, -60, 
+	61, -106, 77, -59, -111, 80, -20, 30, 
+	-102, -22, 50, -1, 35, 9, 84, 50, 
+	152, -111, 68, 40, 36, 76, -55, -134, 
+	5, 33, -72, 18, -130, -24, -58, -96, 
+	67, -86, -145, -98, -15, -65, 90, 6, 
+	-115, -51, -104, -69, -61, 93, 36, -61, 
+	28, -74, -34, 42, 40, 149, -110, -172, 
+	-66, -5, -19, -20, -103, -73, -71, -181, 
+	-87, -30, 27, -147, 125, 48, 89, 0, 
+	-77, -11, -3, 6, -43, 7, -98, -25, 
+	-3, -176, -127, 43, -81, -13, -5, -239, 
+	5, 16, -7, 16, -10, 71, 72, -31, 
+	-8, -71, 79, -68, 42, 98, -62, 1, 
+	-54, 25, 97, 56, -99, 16, -111, -16, 
+	-42, -151, -92, -32, 3, -46, -27, -218, 
+	41, -89, 26, -28, -59, -15, 247, -32, 
+	136, -164, 169, -111, 21, 127, -76, 22, 
+	-85, -6, 109, 13, -38, -27, 71, -83, 
+	55, -198, -32, -34, 2, 56, -96, -119, 
+	1, 53, -13, -2, -22, -32, 35, 27, 
+	79, -212, 130, -64, -110, 21, -69, 55, 
+	-81, -46, -25, 66, 1, 22, -14, -43, 
+	142, -85, 17, -49, -13, 50, 41, -134, 
+	-85, -13, -155, 145, -117, -111, 61, -25, 
+	-69, -191, -72, -75, -15, -66, -114, -61, 
+	-20, -119, -117, -95, -58, -70, -66, -80, 
+	54, 33, 59, -74, -94, 94, 84, -153, 
+	-60, -106, 0, -18, 2, -72, 43, 57, 
+	-4, -41, 52, 55, -96, -27, -108, 12, 
+	-26, -48, 51, -74, 31, -83, -117, -29, 
+	-7, -36, 24, -60, -123, -47, -8, -151, 
+	41, -32, 47, 27, 56, -7, 145, -20, 
+	119, 81, 47, 124, -59, -5, -25, 62, 
+	39, -11, 31, -53, 66, -130, 43, 66, 
+	2, 5, -93, -134, 4, 44, -69, 19, 
+	-7, -55, -29, 37, -92, 64, 139, -47, 
+	91, -126, 149, -92, 135, 36, 23, 15, 
+	-207, 2, 75, 90, -117, 19, 41, -78, 
+	164, -118, 51, 77, -49, 71, 19, -218, 
+	73, -38, -7, 19, -3, -74, -75, -37, 
+	-126, -84, 72, -92, 62, 50, -9, 33, 
+	-145, -19, -2, 135, -126, 86, -12, -53, 
+	292, -144, -41, -10, -16, 120, -20, -179, 
+	-95, -23, -72, -20, -70, -109, 106, -47, 
+	-100, -121, -18, -150, -17, 12, -65, -82, 
+	-69, 38, -19, 30, -35, 9, -141, -10, 
+	-37, -60, -95, -22, -76, 175, 142, -160, 
+	32, 0, 0, -89, -15, 26, 110, 64, 
+	98, 5, 66, -70, -48, 74, -125, 44, 
+	-57, -8, 108, 3, 43, -66, -14, -52, 
+	21, -70, -32, -68, -19, -81, 104, -40, 
+	80, -12, 67, -49, 71, 1, -33, 38, 
+	89, -63, 8, 49, -1, 19, -43, 95, 
+	23, 107, 119, -101, 70, -68, 7, -8, 
+	37, 41, 18, -23, 1, -80, 92, 83, 
+	-68, 51, -14, 56, 17, -89, -104, 21, 
+	-169, -61, -45, -134, 126, 179, 7, -44, 
+	-72, -21, -110, 140, -145, 10, -106, 121, 
+	-119, 40, 67, 34, -90, -108, 23, -18, 
+	-45, 22, -41, -2, -21, -73, -95, -47, 
+	-112, 7, -32, -8, 17, 110, -17, 37, 
+	6, -56, -57, 106, -63, 36, -177, 35, 
+	-101, -22, 8, -29, -53, -242, -65, -85, 
+	-29, 8, -1, 1, -14, -26, -95, -9, 
+	-63, 71, -130, -20, 33, -84, -48, -48, 
+	6, -92, -86, -67, -73, -59, -92, 98, 
+	-55, 17, -110, -10, -1, -53, -68, -27, 
+	-7, -17, 57, -84, -1, 54, 23, -86, 
+	75, 39, -22, -36, -55, -15, 18, 17, 
+	-9, -65, 63, -87, -9, 51, 25, 32, 
+	-32, -52, -199, 24, 100, 148, -61, 30, 
+	123, 7, 78, -202, 76, 156, 179, -78, 
+	209, -19, 90, 37, 32, -30, 128, 87, 
+	42, -47, 104, -19, 56, 99, 134, -106, 
+	101, -162, -137, 180, 124, 59, -32, -11, 
+	-9, 5, -71, -104, 30, -51, -50, -32, 
+	-24, -62, -43, -34, -27, 10, -71, -114, 
+	-104, 12, -57, -65, -105, -30, -109, 10, 
+	-98, -46, -14, -128, -80, -198, -14, -72, 
+	-24, 42, -39, -62, 109, 17, -21, 14, 
+	-39, -113, -23, 13, -101, 26, -247, 30, 
+	-32, -95, 31, -70, -60, -84, -33, 30, 
+	-8, -49, 19, -235, -77, -163, 0, -4, 
+	42, 107, 53, 2, 25, 33, -8, -14, 
+	-9, -129, -46, -58, -121, -167, -162, -33, 
+	13, -97, -74, -204, -31, -84, 30, 66, 
+	76, 15, -38, -122, -30, 81, 136, 51, 
+	74, -55, 66, -58, -15, 16, 33, -126, 
+	20, -128, 58, -16, -24, -120, -36, -45, 
+	-84, -3, -13, -32, 21, 76, 20, -22, 
+	-10, -133, -229, 74, 9, 86, 46, 3, 
+	67, -22, 88, -67, -55, 60, -31, -22, 
+	-30, -10, -45, -93, 82, -44, 59, 37, 
+	-93, -18, 0, -58, -42, 84, 43, -31, 
+	22, -139, -122, 120, 32, 147, -21, 4, 
+	13, 11, 35, -181, -8, 19, -51, -104, 
+	21, -100, -40, 7, -47, -44, -46, -70, 
+	-49, -68, 65, 25, 35, -33, 122, 1, 
+	-30, -89, -96, -5, 66, -193, -11, -9, 
+	49, 3, 39, -6, -17, 29, 29, 56, 
+	-38, -92, 51, 4, -44, 115, -130, 27, 
+	-29, 1, 19, -48, -9, -12, 0, -5, 
+	-12, -30, 34, -68, -22, -66, -55, -127, 
+	-8, 36, 31, 108, -19, -72, 34, -3, 
+	35, -3, -31, 50, -25, -68, -88, -44, 
+	-33, -92, -53, -74, -7, -166, -40, 52, 
+	-18, 69, 119, -29, -53, -12, 38, -43, 
+	19, -8, -18, 98, -50, -54, -89, -24, 
+	-85, 53, -61, 33, 89, -33, 80, 5, 
+	-39, -80, -93, 42, -32, 25, 25, 31, 
+	-84, 32, -28, -18, 59, 48, -91, -130, 
+	-22, -68, -66, 39, -95, -151, 14, -72, 
+	-69, 111, 7, -100, 11, 35, 102, -14, 
+	-32, -77, -78, 134, 3, -24, -110, -92, 
+	-104, -133, -71, 79, -68, 40, -56, -146, 
+	45, -47, 17, -189, 30, -19, 14, -105, 
+	-119, -11, 19, -111, 30, 57, 30, -88, 
+	-39, 91, -16, 75, -101, 37, 0, -3, 
+	-109, -159, -103, 44, 19, 129, 38, -93, 
+	-57, 28, 5, -114, 49, -3, 67, 19, 
+	-19, -121, 21, -37, -73, 99, -78, 39, 
+	-16, -42, 7, 99, -55, 6, 8, -54, 
+	-3, -66, 5, -67, -3, 38, 115, -57, 
+	40, 7, 20, 29, -35, -5, 49, 86, 
+	43, -95, 24, 10, -153, 29, -236, -17, 
+	-6, -71, 36, 3, 105, -103, 41, 42, 
+	99, 92, 191, -248, -63, -201, 63, 10, 
+	-75, 13, -18, 212, -35, -73, -203, 99, 
+	-50, -47, -88, 50, -126, -193, -117, -112, 
+	72, -130, -130, -95, -39, -166, -57, 49, 
+	40, 200, 111, -230, -126, -31, 22, 40, 
+	-104, -119, -2, 72, -42, -79, 25, -12, 
+	-112, -19, 14, 65, -23, -80, -19, -54, 
+	53, -84, -100, -8, -24, -98, -61, -116, 
+	-153, 142, -21, -130, 1, -37, -37, -17, 
+	-54, -77, -52, -96, -39, -38, 0, -75, 
+	-17, 43, 43, 15, -43, -23, -4, -80, 
+	-41, 25, -40, -29, -35, -1, -38, -59, 
+	-93, -2, -20, -19, 8, -71, -9, -66, 
+	68, -6, 84, -54, 85, 30, 142, -50, 
+	77, -10, 100, -38, 81, 100, -61, 4, 
+	14, 19, 145, 78, 46, -41, 90, 42, 
+	31, -42, -70, -12, 108, -122, 68, -104, 
+	94, 35, 30, -56, 40, 94, 113, 50, 
+	-21, -195, 106, -54, -34, 122, -198, 142, 
+	-24, -12, 68, 128, 155, -77, 4, -44, 
+	150, -97, 138, -122, 133, -83, 82, -105, 
+	-92, 151, -63, 221, -64, -37, -174, 144, 
+	-111, -165, -142, 13, -91, -78, -90, 11, 
+	1, -129, -88, -98, -37, -2, -67, 52, 
+	12, 93, 154, -125, -67, 166, 134, 26, 
+	-50, -40, -5, 89, 69, -40, -11, 11, 
+	3, 3, 33, 36, 12, -93, -60, -21, 
+	31, -34, -13, -84, 8, -36, 29, 39, 
+	-92, 48, 34, -84, -131, -24, -55, 30, 
+	-20, -87, 27, -56, 17, -12, -136, -18, 
+	25, 7, -177, -16, 26, 33, -14, -112, 
+	-4, 4, 15, -75, 89, 128, 13, 41, 
+	-87, 13, 3, -9, -19, -43, -49, 102, 
+	30, -4, 30, -18, 67, 1, 2, 19, 
+	-5, -50, 45, 78, -14, -36, -84, -57, 
+	6, 37, 16, -196, -1, -44, 65, 10, 
+	37, -50, -81, -56, 27, -28, -81, 93, 
+	19, 18, 52, 43, -37, 12, -13, 71, 
+	81, -41, -5, -11, -158, -163, 10, -37, 
+	-8, -1, 34, -294, 9, 37, 25, 4, 
+	63, -97, -22, 1, -33, 179, -121, 100, 
+	-49, -8, -30, 10, -14, -47, 47, -84, 
+	56, -72, 17, 77, 20, -116, 7, -76, 
+	6, 39, 9, -79, -51, 63, 7, -70, 
+	-68, -49, -124, 84, -64, 75, 40, 18, 
+	136, 20, 73, -166, 26, 45, -12, -21, 
+	-14, -92, 79, 39, 47, 0, -10, 53, 
+	-107, 90, 34, 70, -96, 48, 35, -89, 
+	95, -235, -56, 47, 38, -78, 15, -113, 
+	74, -18, 1, -91, -21, -38, -76, -43, 
+	-40, -121, -89, -6, -9, 64, 49, -38, 
+	-65, 52, -19, 44, 9, 20, 2, 48, 
+	22, -45, -51, 62, 46, -54, 35, -53, 
+	22, 6, 37, 18, -23, 30, 121, 9, 
+	-41, -16, 80, 46, 53, 150, -145, 30, 
+	-31, 52, -13, 81, 38, 55, -2, -37, 
+	-11, -5, 127, -70, 23, -32, 15, -116, 
+	-61, 3, -64, 153, 71, -38, -58, 15, 
+	25, 158, -13, 67, -199, 50, -131, 31, 
+	5, 44, 9, 7, 43, -54, -5, 72, 
+	62, 114, 92, -157, -46, -31, 25, -57, 
+	1, -56, -109, 63, -9, -39, -58, -30, 
+	-18, 135, -36, 39, -131, -153, -115, -30, 
+	21, 36, -9, -136, -26, 56, -8, 154, 
+	-2, 44, -66, -99, 24, -140, -73, 40, 
+	3, -16, -58, -37, 49, -8, -12, 1, 
+	-34, 79, 51, 0, -150, -167, -41, 94, 
+	-33, -42, 29, -104, 42, -87, 39, 72, 
+	223, -25, -116, -73, 33, -22, 49, -15, 
+	-67, 1, -77, -66, -31, -106, 9, -31, 
+	-162, -152, 6, -144, 77, 26, -28, -87, 
+	-119, -101, -130, 133, -137, 17, -59, -28, 
+	12, -123, -163, -42, -22, -146, -48, -185, 
+	18, -18, -46, -105, -44, 18, 93, 107, 
+	-83, -228, 77, -112, 138, 145, -62, -40, 
+	-126, -43, -23, 137, -88, -27, -25, -32, 
+	53, -19, 90, -20, 39, -149, 129, -60, 
+	44, 67, -22, 43, -61, 18, -37, 128, 
+	-62, -34, 121, -59, 114, 115, -56, -34, 
+	77, -3, 25, 169, -36, 7, -141, 38, 
+	7, 140, 140, -4, 61, -182, 131, 94, 
+	-31, 36, 57, -64, -11, -41, -32, 48, 
+	-78, 96, -18, 55, -34, 2, -33, 17, 
+	86, 44, -23, 61, 12, 14, 19, 92, 
+	-34, 113, 66, 111, -80, -59, -7, 187, 
+	-17, -60, 104, -32, 13, -13, -113, 111, 
+	51, 99, -58, 99, 39, -19, 60, 31, 
+	-16, 57, 9, -19, 19, 52, 113, 18, 
+	26, 28, 88, 74, -51, 60, 8, 93, 
+	-78, -160, -97, 62, -123, -95, -32, -3, 
+	-200, -120, -79, -107, -4, -30, -58, -36, 
+	-102, -116, -172, -6, -189, -151, -181, -44, 
+	-103, 13, 102, -14, -54, -31, -77, -221, 
+	-8, -119, -10, -25, -129, -43, 32, -83, 
+	-24, -57, 34, -123, 124, 78, 88, 57, 
+	-144, -59, -51, 188, -137, -84, -71, 23, 
+	-52, 76, -31, 96, 50, -170, -76, -215, 
+	64, -40, 33, -91, -52, 40, 19, -125, 
+	-89, 64, 87, -209, 146, 69, 116, 83, 
+	-103, -42, -51, 223, -135, 85, -74, -64, 
+	-78, -36, -51, 86, 51, -38, 129, -126, 
+	-25, -7, 11, -200, 26, -13, -24, -99, 
+	-174, 100, -31, -84, 118, 145, 151, 33, 
+	-45, -5, -57, 171, -169, 44, -66, -32, 
+	-148, -67, -38, 158, 49, 78, 117, -59, 
+	93, 61, -1, 13, 56, -21, -148, 16, 
+	-129, -9, -42, -39, 34, 54, 46, -62, 
+	-73, 83, -76, 45, -91, -4, -43, -21, 
+	6, -12, 63, 122, 22, 65, 3, -6, 
+	-165, -111, -142, 22, -38, -157, 38, 52, 
+	37, -75, 8, 2, -89, -136, -185, -94, 
+	65, -150, -101, -123, 14, -213, -150, -98, 
+	-65, 44, -18, -191, -88, -73, -53, -10, 
+	-128, -130, -81, -94, -16, -92, -30, -15, 
+	52, 31, -14, 16, -95, -122, -54, 8, 
+	11, -44, -48, -68, 99, -159, -103, -17, 
+	-18, 126, 10, -83, -111, -112, 56, -34, 
+	-61, -56, -68, -99, 3, -64, 17, -92, 
+	21, 187, -2, -36, 15, -9, 105, -16, 
+	-12, 40, -85, 7, 35, -157, -103, -30, 
+	-13, 72, -128, -13, -115, -57, 7, -89, 
+	-9, -66, -26, -118, -7, 33, 79, -145, 
+	41, 135, 68, -42, -48, -33, 67, -13, 
+	114, 19, 2, -107, 38, -74, -47, 34, 
+	-79, -2, -142, 5, -86, -76, -38, 69, 
+	-29, -26, -6, -2, -41, 6, 4, 89, 
+	49, 78, -58, -32, -154, -108, 6, -20, 
+	49, -77, 1, -136, 48, -85, 60, -66, 
+	122, -60, -91, -42, 24, 22, -92, 60, 
+	64, -33, 19, 180, -95, 55, 0, 74, 
+	-87, -17, 12, 90, 23, 90, -186, 81, 
+	-40, -68, 14, 119, -53, -18, 32, -12, 
+	118, -2, 86, -69, 38, -106, 28, -2, 
+	10, 62, 24, -19, 80, -3, -58, -29, 
+	16, -35, 42, 62, -106, 26, 65, 58, 
+	-29, 53, 41, 42, -24, 112, 51, 38, 
+	-36, 5, -110, 14, 12, -13, 46, -50, 
+	83, 44, -16, -200, 130, 41, -34, 38, 
+	-36, -9, -44, 8, -151, 3, -100, 31, 
+	13, 129, 84, -5, -5, 6, -49, -37, 
+	42, -96, -2, -131, 40, -30, 134, -22, 
+	130, 49, 8, 41, 41, 114, 233, -43, 
+	102, -359, 132, -11, -54, -1, -204, -25, 
+	-36, -2, 71, 34, 61, 19, 66, -106, 
+	18, -101, 25, 27, 48, 60, 23, -28, 
+	45, 47, -29, 133, -100, 36, -23, -28, 
+	-83, -440, 41, -69, -30, -18, 5, 115, 
+	-176, 5, -9, -20, -76, 14, -15, -56, 
+	188, -125, 53, 111, -12, 210, -159, -269, 
+	-24, 12, -13, 59, 53, -106, 19, 114, 
+	-162, 186, 14, -3, 119, 51, 26, 54, 
+	1, 101, -29, 115, -31, 76, -125, 102, 
+	29, 17, 21, -11, 16, -86, 13, -3, 
+	-50, 84, 30, -29, -4, 18, 40, -2, 
+	54, 305, -9, 13, -22, -16, -12, -3, 
+	-14, 35, 20, -9, -27, -84, -56, 74, 
+	-14, 2, -9, 23, -18, -75, -34, 80, 
+	73, 5, 64, -52, 8, 107, 25, 2, 
+	56, -26, -15, 36, 82, -24, 9, 51, 
+	50, 80, 26, -91, 33, -28, 143, -80, 
+	36, -144, -37, 31, 116, 2, -62, 54, 
+	80, 21, 93, 54, -77, 36, 122, 10, 
+	28, -208, 109, -95, -16, -58, 49, 43, 
+	-80, 5, 10, -72, -104, 125, 58, -123, 
+	173, -131, 69, 57, 39, 220, -105, -111, 
+	-157, -41, -101, 167, -217, -105, -112, 5, 
+	-119, -173, -62, -192, -43, -103, 7, -96, 
+	-124, -84, -154, -105, -179, 39, -140, -102, 
+	112, -93, 11, -4, -143, 240, -88, -264, 
+	22, 79, 47, -11, -45, 18, -31, 62, 
+	38, 139, -49, -11, 17, 88, 60, -4, 
+	84, -12, -33, 154, 25, 84, 31, 1, 
+	48, 32, 26, 69, 39, -141, 48, 161, 
+	46, -13, 91, -77, -8, 35, 12, -92, 
+	71, -29, 16, 66, 49, 81, 117, -51, 
+	-14, 92, -27, 61, 26, 56, 115, -59, 
+	55, -92, -44, 106, 42, 63, -46, 89, 
+	82, 17, 70, 17, 48, 20, 5, -53, 
+	-40, 24, 9, -111, 38, 39, 150, 32, 
+	-163, 109, 8, -26, -15, 149, 54, -35, 
+	-43, -70, -28, 149, 58, 133, -79, -93, 
+	-24, -40, 5, 23, -61, -106, -272, -90, 
+	-125, -77, -138, -126, -27, -73, 20, -19, 
+	-138, -4, -177, -49, -179, 62, -49, -92, 
+	85, -110, 2, 51, -124, 120, -23, -117, 
+	-119, -109, -120, 28, -147, -184, 102, -77, 
+	-4, -34, -96, -138, -19, -95, -129, -127, 
+	-1, -122, -153, -152, -63, -37, -173, -96, 
+	-164, -69, -85, -130, -146, 95, -48, -74, 
+	3, -46, -4, -68, 64, -22, -1, -142, 
+	-8, 18, -15, 2, 79, 112, 190, 9, 
+	-29, 47, -53, 131, 1, 67, -88, -109, 
+	-96, -104, -143, 106, -69, 3, -3, -100, 
+	-14, 16, 17, -78, 51, -23, -45, -106, 
+	-48, 44, -59, -128, 41, 15, 96, 5, 
+	-112, 21, -21, 89, -22, -66, -149, -3, 
+	-39, -80, -59, 96, -47, -83, -75, -177, 
+	-71, 2, -123, 141, -12, -82, -85, -101, 
+	-27, 187, -101, -127, 7, -61, 33, -111, 
+	-1, -112, -69, 90, -35, -18, -124, -26, 
+	-81, 6, 3, -25, -61, 82, -19, -15, 
+	-48, -28, -61, -29, -41, -149, -12, -9, 
+	40, 59, -164, -10, -15, -88, 3, -50, 
+	31, -5, -134, -63, 17, -91, -13, 7, 
+	11, -17, -119, -54, -62, -56, -134, 27, 
+	-96, -55, -78, -33, 2, -18, 162, 19, 
+	75, 35, 34, 32, -101, -83, -96, -48, 
+	49, 5, 38, -142, 57, -154, 51, -18, 
+	-186, 70, -147, -216, -150, -74, -4, 69, 
+	-100, -72, -86, -17, -32, -19, 14, -17, 
+	-7, 117, 8, -88, 121, 41, -16, -56, 
+	-27, 0, 1, 22, -6, -122, -54, 7, 
+	-103, 87, -13, -88, -11, -112, -59, 31, 
+	-108, -92, -115, 1, -77, -10, -65, 81, 
+	-111, -18, -27, -83, -23, -90, -158, -29, 
+	-27, -22, -69, -11, -62, -255, -114, -27, 
+	-15, 70, 112, -275, -75, -206, 89, 10, 
+	-62, -49, -123, 58, -78, -85, 87, -8, 
+	-32, 3, 71, -58, -68, -6, -115, -41, 
+	42, 46, -111, -110, 19, -243, -154, 38, 
+	-114, 136, 87, -289, -72, -148, 56, 75, 
+	-25, -33, -37, -30, 42, -22, 45, 104, 
+	88, 135, -37, 64, -100, -154, -116, 30, 
+	93, -6, -26, -75, 52, -194, 111, -32, 
+	94, 132, -23, -227, -19, -153, -66, 91, 
+	-47, -72, -20, -67, 41, 51, 42, -15, 
+	116, -13, 132, 138, -143, -45, -21, 8, 
+	34, 34, 95, -108, 102, -139, 14, 61, 
+	-4, 38, -35, -141, -6, -163, -8, 11, 
+	-67, -33, -15, -87, 4, -72, -23, -99, 
+	-7, -76, -11, -88, 20, -6, 36, 9, 
+	7, 7, 6, 10, -86, -25, -52, -47, 
+	-13, -68, -79, -33, -75, 11, -26, -13, 
+	15, -80, -54, -60, -45, -5, -30, 31, 
+	-51, -43, 34, -33, -32, -22, -20, -35, 
+	-39, -37, -34, 25, -49, -57, -96, -63, 
+	-26, 6, -49, 4, -66, -68, 25, -51, 
+	-69, -56, -27, -52, -34, -74, -41, -31, 
+	36, 32, -8, 37, -51, -12, -56, -65, 
+	10, 15, 5, 28, 4, -3, -42, -40, 
+	-2, 5, 36, -44, -9, -75, -5, -8, 
+	-82, -35, -57, 27, -8, -17, -50, -16, 
+	-49, -3, -37, -19, -62, -80, 15, -3, 
+	-22, -57, 20, -20, 14, -13, 2, 4, 
+	26, 38, 27, -79, -94, -22, 27, -49, 
+	-5, -76, -45, -30, -27, -2, -27, 38, 
+	20, 65, 46, -13, -22, -48, 17, 49, 
+	-18, -39, 13, 46, 33, -54, -49, -65, 
+	-37, 18, -6, -9, -72, -72, -81, 12, 
+	-81, -40, -59, -100, 7, -36, -9, -5, 
+	-13, -44, -58, -88, -56, -75, -100, -8, 
+	26, -6, -4, -57, -33, -83, -96, 13, 
+	-6, -36, -38, -16, -99, -14, -28, -64, 
+	-26, -36, -62, -77, -35, 28, -13, -25, 
+	-52, -4, -18, -63, -68, -32, -24, -61, 
+	34, -23, -12, 10, -27, -39, 34, -31, 
+	-16, 13, -58, -29, -48, -87, 28, -18, 
+	-38, 26, -20, -74, 13, -18, 23, -20, 
+	42, -37, -1, -1, -15, 25, -12, -7, 
+	-23, -26, -11, 10, 45, -19, -44, -10, 
+	-46, -52, 8, -76, -32, -134, 4, 22, 
+	-32, 25, -3, -9, -38, -59, -6, -33, 
+	-24, -44, 4, -24, -80, 25, -103, -27, 
+	-13, 0, -30, 23, 5, -62, -6, -29, 
+	15, 25, 29, -78, 20, -82, -22, 44, 
+	5, -58, -53, -7, 7, -41, -44, 7, 
+	-17, -2, -49, 36, -44, -5, -74, -32, 
+	-14, 6, -5, -46, 35, 8, -37, 18, 
+	-46, -33, 34, -21, 29, -106, -25, 62, 
+	14, -31, 19, -81, 5, -33, 19, -49, 
+	-18, -6, 36, -9, 2, 7, -28, -70, 
+	-51, 11, -65, -50, 8, -3, -36, -88, 
+	-57, -80, -73, -79, -80, -86, -34, -47, 
+	-5, -10, 36, -60, 43, -38, 34, -19, 
+	44, -86, -41, -21, 4, -44, -64, 27, 
+	-82, -62, 6, -67, -48, -62, 6, -12, 
+	21, -77, -104, -15, 6, -110, -98, 6, 
+	37, -26, -14, -35, 3, 39, -18, -75, 
+	-53, -2, -58, -67, -5, -5, -33, 33, 
+	-54, -40, 35, -49, -28, 38, 46, -34, 
+	-12, -62, -18, 3, -55, -30, -26, -66, 
+	-35, -44, -16, -46, 22, -63, 8, -79, 
+	11, 17, -12, -35, -21, -34, -18, -36, 
+	-72, -58, -9, 32, 4, 23, -20, -50, 
+	-71, -17, -47, 40, 31, 4, 23, -39, 
+	-48, -34, -59, -75, -54, 42, -48, -90, 
+	-53, 3, -10, -73, 43, -45, -33, 73, 
+	-6, -40, 10, -30, -54, 42, -17, -47, 
+	-9, -5, -28, 58, 21, -14, 5, -83, 
+	-55, -78, 14, -49, -3, -35, 45, -51, 
+	46, -6, 11, 1, -70, -63, -44, -50, 
+	26, 4, 0, -77, 4, 5, 24, -12, 
+	27, -82, -13, -25, 1, -101, -22, -60, 
+	-31, -41, 10, -51, -32, -40, -23, -27, 
+	-27, -6, -14, -66, -84, -36, 9, 17, 
+	-55, -38, -31, -4, -44, -16, -33, 23, 
+	66, 0, -8, -41, 21, -9, -48, -60, 
+	-58, 15, -39, 11, -2, -88, -34, -57, 
+	3, -34, -61, -33, -31, -36, 52, -63, 
+	17, -45, -19, -8, -34, 18, 1, -10, 
+	-17, -55, 13, -18, 18, 13, -48, -58, 
+	-45, -46, -16, -23, -67, 11, -5, -89, 
+	49, 24, -20, -60, -9, -17, -49, -45, 
+	-34, -69, 9, -11, 0, -2, 19, -66, 
+	-36, -70, -48, -54, 3, -44, -8, 22, 
+	-48, 36, -56, -47, -7, -60, -85, -98, 
+	-81, 19, -34, -8, 4, -30, -61, -1, 
+	16, 9, 28, -12, -54, -12, 38, 28, 
+	9, -15, -62, -59, 31, -59, 22, -51, 
+	-38, -18, -2, -53, -29, 13, -42, -33, 
+	-20, 3, -36, 25, -38, 15, -42, -36, 
+	-81, -57, 27, -61, -31, -45, 30, 23, 
+	3, -41, -83, -18, -41, -28, -35, -63, 
+	-27, 4, -34, -34, -47, -5, -3, 23, 
+	-63, -86, -52, -99, -75, -24, -79, 5, 
+	-69, -15, -66, -37, -87, -26, -40, -12, 
+	42, -17, 8, -45, -42, 18, -5, -65, 
+	-43, 21, -38, 0, 16, -78, 48, -63, 
+	-57, -48, -29, -53, -74, -68, -49, -33, 
+	-4, 3, -51, -69, -10, 10, -45, -62, 
+	-44, 15, -8, -19, -13, 0, -18, -18, 
+	11, -4, 28, -19, 6, 1, -28, -82, 
+	-18, -136, -28, 1, -59, -14, -6, -49, 
+	-17, 23, -35, -73, -23, -45, 36, -50, 
+	-38, -139, -99, -26, -60, -39, -85, -44, 
+	-53, 28, -6, -22, -42, -15, -50, -71, 
+	-41, -43, -62, -91, -24, -2, 42, -65, 
+	-96, -45, -79, 13, -83, 21, -57, -3, 
+	-68, -20, -61, -25, -50, -74, -97, -61, 
+	39, -11, 38, -30, 16, -57, 82, 137, 
+	60, -79, -43, -46, 34, -46, 68, 26, 
+	-44, -99, -25, 35, 1, 0, -18, -10, 
+	94, -56, 34, 58, 22, 3, 13, 24, 
+	-22, 24, 3, 102, 21, -33, 42, 54, 
+	-70, -1, -47, 50, 5, 2, 49, -107, 
+	5, -33, -26, -34, -15, 25, -34, 92, 
+	26, 55, 84, 80, -24, 152, 31, 112, 
+	-34, -72, 70, 25, -42, -8, 83, 8, 
+	-9, -44, 29, 30, 61, 47, -14, -46, 
+	13, 87, 11, 76, -62, -27, -16, 42, 
+	-17, 19, -16, 14, -18, -58, -66, 33, 
+	82, 31, 31, -42, 78, 120, 108, -32, 
+	28, -74, 193, -8, 18, 150, -133, 122, 
+	-1, 25, 150, 20, -60, 74, 31, 1, 
+	-10, -109, -146, -60, -9, -275, -4, 2, 
+	155, 146, 28, 73, 4, 27, 68, -36, 
+	-17, -93, 97, 108, -131, 25, -132, 140, 
+	-9, 57, 34, -152, 60, -43, 23, 65, 
+	136, -97, -28, -21, 37, 17, 40, 42, 
+	-34, -6, -24, -72, -152, 31, 65, 2, 
+	25, -3, 50, -42, 91, -11, 93, 6, 
+	-42, -210, 11, 117, 70, 51, -32, -11, 
+	93, -4, -26, 92, 82, 70, -153, -26, 
+	-63, 36, -81, 82, -125, -80, -38, 6, 
+	-49, -80, -35, -98, 67, 26, 59, -82, 
+	-140, -152, -26, 73, 11, 49, -68, -72, 
+	-123, -140, 17, 18, -47, 129, -6, -73, 
+	27, 1, -6, -7, 71, -45, 35, -124, 
+	-103, -169, 26, -95, 29, 88, -22, -45, 
+	-95, -50, -37, 89, -110, -20, -46, 65, 
+	-81, -221, -11, 63, 37, -81, -32, -71, 
+	78, 44, 20, -118, 42, 103, 78, -98, 
+	-88, -400, 62, -57, 134, 104, -213, 49, 
+	-68, 69, 120, 57, -154, 61, 28, 41, 
+	47, -185, 18, -39, 52, -473, 46, -108, 
+	56, 7, 26, 49, -22, -3, 60, 39, 
+	-88, -46, 50, -31, 4, 143, -181, 150, 
+	72, 21, 122, 49, 8, 38, -46, 42, 
+	85, -22, 118, -135, 7, -213, 150, -84, 
+	-48, 49, -2, -46, -21, 48, -4, 22, 
+	-32, 70, -73, -69, 2, -1, 95, -35, 
+	-117, -52, -39, -26, -54, -2, -36, -39, 
+	34, -72, -3, 125, -32, 44, -4, -126, 
+	-155, -24, -40, -11, -110, -72, -83, -53, 
+	-153, 27, -127, -92, 46, -35, 64, -127, 
+	-104, -152, -216, 24, 34, 2, -117, -28, 
+	-154, 32, -16, 44, -28, 19, -110, -8, 
+	-49, -3, -27, -91, -107, 9, 21, -207, 
+	-127, -86, -32, -111, 93, 68, -17, -57, 
+	-121, -75, -80, 77, -106, 33, 25, -118, 
+	-183, -150, -35, -42, 77, -165, -140, -169, 
+	44, 6, 72, -299, -44, 50, 119, -27, 
+	-117, -210, 75, -231, 109, 84, -14, 44, 
+	-163, 29, 23, 132, -97, 85, -40, 17, 
+	33, -235, -30, 34, 7, -268, -25, -366, 
+	-12, 27, 2, -17, -2, 29, 67, 163, 
+	-62, -136, 159, -59, 186, 125, -13, 33, 
+	37, -34, 84, 172, -33, 113, -149, 22, 
+	27, 9, 160, 16, 96, -280, 149, -78, 
+	-56, 8, 44, -84, -61, -77, 123, -24, 
+	5, 6, -30, -63, -33, 108, 50, -11, 
+	-51, -9, 24, 117, 11, 18, 39, -115, 
+	-45, -36, -40, 81, 19, 47, 170, -65, 
+	-172, -57, -121, -42, -15, -116, -34, 72, 
+	64, 132, -251, -6, -100, -263, 116, -70, 
+	1, -87, -162, -141, 219, -50, -108, -4, 
+	-63, -16, 54, -26, -110, -11, 52, 37, 
+	-161, -99, -121, 8, -20, -66, -122, 62, 
+	-47, 145, -127, -13, -31, -131, 11, -77, 
+	-27, 39, -78, -76, 74, -119, -144, 31, 
+	-185, 34, 75, -84, -90, -174, -93, -49, 
+	-30, -55, -86, -49, -110, -31, -19, -124, 
+	-74, 5, 26, -115, 82, 18, 4, -84, 
+	13, -47, -63, 6, -146, -86, -101, 1, 
+	-96, -56, 46, 13, -36, -78, -103, -143, 
+	51, -49, -15, -144, -35, 95, 110, -84, 
+	-42, -170, 150, -133, 180, 122, 27, 52, 
+	-100, -70, 52, 186, -123, -23, -16, 2, 
+	-9, -110, -131, 105, 108, -112, 86, -267, 
+	-150, -36, -27, 29, -67, 3, 173, -43, 
+	-24, 25, 190, 71, 171, 123, 98, 58, 
+	-15, 19, -2, 202, -50, -123, -39, -167, 
+	-100, -54, -152, -28, 82, 16, 5, -33, 
+	-63, -98, -45, -154, -5, 7, -37, 7, 
+	98, 63, -48, -88, -88, 42, 4, -16, 
+	36, 2, 46, 47, 52, -133, -10, -103, 
+	-49, -10, 2, -48, 1, -181, 86, 44, 
+	-107, -99, -58, 43, 13, -43, -36, 110, 
+	50, 84, -32, 49, -151, -102, -65, -94, 
+	123, -30, 17, -160, 145, -114, -63, 12, 
+	-94, 170, 136, -121, -39, -113, 52, 16, 
+	-44, -146, -145, 107, -42, -60, -41, -1, 
+	92, 63, -33, 89, -165, -162, 23, -42, 
+	67, 25, -29, -315, 50, -148, -29, 25, 
+	-145, 99, 144, -129, -168, -22, -87, 46, 
+	19, -25, -21, 32, 16, 31, 93, -140, 
+	50, 80, 80, 89, 23, -84, 10, 67, 
+	-46, -51, 46, -75, 12, -148, 110, 55, 
+	78, 70, -101, 35, -22, -29, -162, -117, 
+	50, 32, 64, -2, -97, 16, -43, 112, 
+	-73, 45, 13, -34, -33, -10, -5, 112, 
+	-79, 1, 2, 54, -113, 28, 131, -23, 
+	62, 65, 86, 2, 14, -145, 85, -42, 
+	-17, -19, 15, 12, -55, -5, 60, -26, 
+	-86, 5, 2, -11, -93, 60, -23, 40, 
+	-24, 0, -21, 39, -51, -30, -8, -63, 
+	30, -12, -38, -73, -46, -139, 25, 21, 
+	30, 6, 26, -11, 9, 68, 13, 115, 
+	80, -114, 65, 80, -168, -25, -30, 121, 
+	11, 8, 50, -51, 28, -30, 33, -20, 
+	134, 20, 137, -139, -50, -23, 79, -2, 
+	-76, 39, -42, 128, 39, 9, -116, 66, 
+	-10, 16, -94, 57, -168, -62, 40, 33, 
+	18, 113, -9, -126, -17, -94, -54, 21, 
+	22, 132, 98, -32, -70, 28, 31, 21, 
+	-74, 11, -114, 79, 13, -41, -126, 52, 
+	-41, 102, -93, 33, -143, -215, 51, -41, 
+	74, 5, -92, -91, 0, -101, -44, 52, 
+	-82, 128, 22, -143, -54, -118, 53, 62, 
+	6, -8, -34, 85, -49, 27, -97, 34, 
+	-81, 37, -55, 58, -59, -25, 30, 19, 
+	8, 81, -105, 62, 30, 29, 12, 65, 
+	-51, 87, 114, -61, -116, -158, 32, 50, 
+	114, 5, -63, -23, -6, 9, 30, -26, 
+	14, -43, 67, 111, -158, -66, -52, 88, 
+	14, 44, 32, -38, 64, -105, 79, 21, 
+	52, -6, -70, -54, -8, -92, -80, 15, 
+	77, -3, -2, -63, -2, 35, -2, 31, 
+	31, -67, 97, 66, -190, -108, -33, 65, 
+	10, -1, 64, -158, 37, -161, 31, -37, 
+	53, -66, -52, -219, -10, 148, 42, -62, 
+	-14, 28, -20, -19, 45, -39, -16, 32, 
+	44, 29, -69, 30, -172, -244, -74, 11, 
+	29, 4, -1, -232, 97, -57, -79, -7, 
+	-28, 29, 24, -164, 10, 39, 51, 51, 
+	62, 15, 40, -5, 43, 8, -46, 108, 
+	14, 64, -144, 99, -116, -211, -206, -31, 
+	39, 3, -28, -100, 75, -41, -3, 33, 
+	7, 44, 107, -146, -17, -70, 66, 105, 
+	14, 6, -31, -25, 56, 1, -23, 83, 
+	-24, 189, -31, 68, -35, 52, -89, 50, 
+	47, 14, 48, 57, -8, -29, 27, -10, 
+	-44, 107, 85, -21, -16, -186, 51, 72, 
+	9, -18, -2, 9, 92, 23, 35, 22, 
+	-13, 182, 59, 41, -147, 63, -78, 84, 
+	94, 16, 61, 38, -4, 27, 40, 7, 
+	69, -7, -131, -98, -31, 35, -84, 146, 
+	75, 66, 23, -35, 48, 78, -9, -63, 
+	94, -1, 67, -11, -188, -75, -97, 74, 
+	11, -23, 135, -180, 109, -11, 15, 35, 
+	15, -119, -139, -65, 46, 73, -94, 15, 
+	-3, -3, 19, -113, -49, 95, -43, 18, 
+	-88, -95, -60, -83, -109, -105, -18, -12, 
+	-96, -39, 57, -130, -47, 60, 81, 76, 
+	11, -194, -15, 73, 7, 47, -28, 6, 
+	49, -57, 79, -24, 1, 0, -86, 23, 
+	-130, -52, -18, -3, 33, 14, 76, -55, 
+	-66, -16, -110, -41, -150, 43, -51, 58, 
+	-116, 25, 117, 37, -15, 27, 20, 8, 
+	62, 56, -3, 11, 37, -3, 15, 29, 
+	-82, -67, -34, 87, -8, -15, 94, 11, 
+	-87, -39, -58, 107, -13, 94, -2, -45, 
+	-54, -5, -95, 109, 50, 58, 129, -2, 
+	50, -36, -4, 46, 74, -16, -8, -100, 
+	2, 13, 60, 8, 78, 114, 69, -29, 
+	-95, 51, 10, 83, -111, 77, -63, -2, 
+	13, -158, -59, 60, -42, 49, 101, -66, 
+	15, -1, 62, 61, 43, 31, -42, -111, 
+	-113, -64, 0, -65, 23, 46, 59, 15, 
+	-51, 15, 37, 100, -75, 35, -50, 6, 
+	-73, -89, -34, 140, -60, -22, -27, -214, 
+	47, 34, 9, 53, 49, -83, -183, -76, 
+	-233, 33, -163, -153, 11, 36, 12, -70, 
+	-129, 30, -132, 111, -42, 30, -183, 75, 
+	-148, -64, 22, 131, 21, -59, -35, -155, 
+	-55, 37, -71, 56, -51, -132, -212, -94, 
+	-272, 78, -200, -115, 70, 49, 67, -81, 
+	-132, -149, -180, 180, -223, 61, -146, -49, 
+	-189, -91, -75, 147, -67, -5, 35, -15, 
+	-4, 105, -50, 173, -3, -27, 51, 64, 
+	27, 96, -23, -46, 61, 75, -29, -20, 
+	-62, 30, -59, 36, -11, 4, -21, 11, 
+	125, 40, 67, 35, -7, 61, -5, -1, 
+	-50, -22, 17, 91, 20, -39, 127, -17, 
+	-53, -9, 71, 7, 60, 72, -31, 24, 
+	-3, -37, -30, 109, -92, -53, -26, -5, 
+	43, -60, 35, 27, -74, 33, -48, -37, 
+	-16, 5, -76, 28, -25, -80, -26, 85, 
+	-157, -120, 34, -124, 48, 109, -95, -33, 
+	6, 13, -51, 99, -54, -6, -131, -10, 
+	-17, -4, 12, -44, 22, -74, -46, -37, 
+	-61, -21, -92, 48, -143, -160, -100, 19, 
+	-295, -152, -109, 15, 75, -38, -102, -16, 
+	-30, -99, -103, -15, -162, -103, -233, -20, 
+	-92, 83, 30, -79, -110, -10, 36, -52, 
+	-199, -78, -203, 81, -35, -151, -112, -91, 
+	-255, -36, -113, -44, 60, -56, -47, -35, 
+	-29, -123, -98, 71, -115, -113, -193, -59, 
+	-134, 54, -10, -112, -148, 34, -27, -150, 
+	91, 31, 5, -97, 80, 111, 219, 13, 
+	38, 183, 95, 9, 93, 90, 94, 111, 
+	-16, 4, 102, 97, 28, -10, 104, -42, 
+	210, -49, -99, 38, 96, -34, -25, -16, 
+	97, 48, 7, -69, 25, 138, 112, 12, 
+	151, -6, 124, -48, 62, 76, 27, 146, 
+	55, -7, 52, 69, 92, 70, 120, -89, 
+	196, -32, 3, -1, 120, 97, 30, 43, 
+	65, 48, 54, 11, 16, 3, 45, 82, 
+	-6, 2, -12, 9, 95, 50, 55, 70, 
+	-34, 93, 56, 50, 11, 39, 20, -14, 
+	187, 9, -1, 42, 29, 151, 40, 40, 
+	59, -49, 44, 70, 22, -32, 51, 28, 
+	-100, 122, -87, -105, 109, 78, 79, -58, 
+	-63, -22, -123, 57, -34, 50, -143, -43, 
+	9, -32, -23, 98, -18, 153, -43, -67, 
+	-88, -28, -55, 45, -48, -140, 6, -78, 
+	-104, -37, 45, -91, 22, 35, -26, -55, 
+	-41, -158, -209, -2, -135, 44, -76, -40, 
+	-41, 21, 61, -37, -31, 87, 19, -81, 
+	49, -75, 49, 3, -46, 13, 133, -42, 
+	-37, -42, 85, 40, 44, 6, 79, -28, 
+	-157, 93, 24, 14, -210, 128, 99, -84, 
+	6, -187, -163, 81, 45, 45, -18, 14, 
+	128, -39, 131, -79, 114, 2, 121, -62, 
+	86, 123, 85, -34, 125, 37, 178, 88, 
+	-180, 97, 81, 50, -23, 62, 117, -28, 
+	184, -212, -58, 161, 73, 62, 39, -185, 
+	-15, -7, 41, -39, 64, -99, 32, 137, 
+	-53, 171, -130, -129, 27, -19, 92, -61, 
+	-150, 47, -82, 56, -14, 11, -98, -13, 
+	57, -159, 107, 77, -53, 34, -8, -220, 
+	-80, -23, -139, 117, -41, -86, 113, -4, 
+	-137, 2, 27, -46, 39, -24, 25, -87, 
+	19, -98, -178, 18, -41, -86, -36, -10, 
+	-154, 25, 32, -21, -41, 138, 28, -58, 
+	-124, -83, -60, 16, -127, -145, -110, -129, 
+	-173, -105, -101, -90, -5, -119, -143, -59, 
+	-11, -122, -180, -62, 14, -183, -174, -39, 
+	-146, 0, -9, -115, -155, 9, -124, -75, 
+	-120, -80, -54, 180, -8, -122, 52, -63, 
+	-165, 178, -29, -15, 115, -77, 9, -32, 
+	18, -17, -173, 54, -141, -136, -117, 144, 
+	-222, 200, -70, -98, -121, -19, -85, 182, 
+	-47, -37, -34, -60, -43, 12, -65, -182, 
+	-211, 10, 46, -184, 121, 71, 59, -8, 
+	-70, 47, -31, 183, -165, -112, -105, -100, 
+	-64, -218, -278, 39, 64, -111, -142, -187, 
+	-37, -73, -11, -202, -72, -74, -17, -56, 
+	-313, -123, -132, -372, 25, 58, 32, -116, 
+	-339, -146, -101, 40, -177, -74, -174, -9, 
+	-131, -447, -33, -27, -30, -21, -5, -341, 
+	-141, -99, -65, -71, 19, -132, 30, 4, 
+	-145, -168, -185, -180, -108, -60, -41, -184, 
+	-203, -125, -196, -82, -184, -32, -237, 13, 
+	-252, -31, -2, -25, -203, 2, 14, -68, 
+	-151, -155, -142, -39, -87, -207, -145, -44, 
+	-133, -148, -170, -85, -250, -282, -269, -40, 
+	-133, -213, -218, -220, -42, -226, -233, -78, 
+	-184, -54, -112, -233, -111, -102, 12, -72, 
+	-136, 64, -201, 202, -12, -141, -87, 142, 
+	-231, -39, -13, 203, -293, -178, -391, -35, 
+	56, -44, -126, -261, -119, -283, -97, 150, 
+	-144, 258, 224, -331, -155, -74, 7, 156, 
+	-91, -78, -223, 73, -54, -162, -77, -36, 
+	-249, -18, 19, 129, -32, -69, -309, -125, 
+	78, -112, -248, 29, -93, -214, -101, 151, 
+	-240, 139, -21, -319, -297, -134, -196, 116, 
+	-125, -209, -167, -77, -174, -139, -87, -269, 
+	-393, -77, -109, -120, 3, -3, -105, -129, 
+	-94, -79, -135, 103, -226, -162, -144, -197, 
+	-199, -209, -301, -67, -146, -253, -109, -266, 
+	-120, -69, -68, -221, -72, -154, -65, -210, 
+	-172, -173, -36, -231, -26, -4, -97, -122, 
+	-163, -111, -144, -4, -184, -96, -187, 6, 
+	-216, -315, -221, -50, -118, -192, -76, -184, 
+	-80, -70, -32, -96, -79, -122, -174, -105, 
+	-162, -282, -136, -80, -153, -127, -154, -2, 
+	-172, -182, -204, -65, -105, -135, -40, -30, 
+	-95, -220, -79, -112, -123, -124, -111, -128, 
+	59, 166, -39, 105, 106, -25, -124, 170, 
+	-87, -197, 66, 106, -160, 114, -199, 109, 
+	31, -16, 134, 41, 38, -4, -99, 1, 
+	80, 144, 262, -173, 33, 27, 219, 88, 
+	-211, 55, -162, 219, -23, -191, -67, 79, 
+	-163, -69, -133, 157, -181, -184, -315, -12, 
+	140, -118, -170, -230, -24, -202, -178, 114, 
+	-236, 179, 154, -226, -380, 20, 1, 78, 
+	-132, -95, -251, 64, -72, -125, -33, -79, 
+	-251, 16, -242, 47, -34, -210, -227, -130, 
+	-39, -215, -218, -50, -138, -333, -176, 64, 
+	-476, 31, -59, -437, -304, -198, -109, -37, 
+	-205, -74, -78, -27, -159, -157, 11, -139, 
+	-156, -85, -68, -72, 3, -123, -130, -109, 
+	-25, -60, -173, 76, -96, -283, -80, -22, 
+	-178, -66, -179, -187, -216, -298, -124, -135, 
+	-117, -138, -64, -33, -101, -139, -86, -32, 
+	-154, 59, -110, -64, -13, -128, -2, -36, 
+	2, -7, -130, -95, 16, -52, -126, -123, 
+	-57, 72, -27, -25, -178, -116, -108, -222, 
+	39, -42, 60, -111, 2, 14, -50, -116, 
+	1, -16, 43, -24, 211, 145, 107, -36, 
+	-94, 20, -2, 135, 2, 59, 13, -27, 
+	-197, -117, -103, 137, -23, -34, 49, 22, 
+	95, -56, 27, -260, 4, 39, -5, -219, 
+	-31, -102, 15, 69, 71, 133, 45, 30, 
+	-132, 14, 47, 65, -75, 37, -5, 2, 
+	7, -221, -241, 21, -62, -204, -97, -163, 
+	99, 38, 23, -133, -4, 39, -66, -53, 
+	-1, -109, 63, -22, -170, -57, -159, 51, 
+	-35, 85, 63, -107, -30, -76, 69, 9, 
+	138, -209, -186, -42, 44, -109, -114, -82, 
+	-47, 78, 19, -29, -5, 54, 14, -159, 
+	41, -102, -74, -148, -78, -59, 66, -51, 
+	-87, -38, 21, 7, -15, 84, 29, -34, 
+	1, -99, -80, 32, 74, 34, 35, -27, 
+	-7, -27, 33, -103, 32, 60, 33, 97, 
+	-38, -122, 55, -16, -65, 176, -81, -9, 
+	37, 29, 89, 115, 79, 87, -87, -23, 
+	-8, -69, 119, 2, -39, -84, -20, -105, 
+	28, -71, -15, -43, -53, 64, 77, -79, 
+	51, 24, 113, -11, 71, 53, 31, -51, 
+	18, -17, 11, 73, -16, -60, -57, -76, 
+	-170, -28, -139, 7, -71, -28, -67, -31, 
+	48, 29, 19, -135, 16, 33, 60, -218, 
+	40, 5, 105, 2, -29, 6, -13, -9, 
+	-159, 16, 70, -75, -120, -135, 42, 7, 
+	94, -197, -251, -118, -38, -192, -93, -95, 
+	79, 8, -9, -74, -27, 26, -9, -64, 
+	-16, -152, 39, -83, -63, 7, -119, -10, 
+	-96, 42, 14, -155, -73, -23, 33, -36, 
+	112, -171, -83, -62, 33, 82, -98, -150, 
+	43, -11, 12, 144, 0, 49, -52, -62, 
+	-51, -20, -41, -23, 5, -115, 153, 40, 
+	-35, 53, 27, -107, -43, 79, 5, 12, 
+	54, -37, -30, 77, 53, 91, -28, -183, 
+	118, 94, 17, -84, -38, 11, -47, -25, 
+	-37, -98, 105, -46, 101, 150, 14, 44, 
+	-53, -47, 13, 248, 3, 123, 48, -77, 
+	51, -222, -92, 53, 139, 15, 111, -201, 
+	22, -91, 0, -37, -27, 46, 36, -75, 
+	32, 12, 98, -19, 16, -34, -64, 66, 
+	18, 25, 16, -21, 13, -50, -48, 15, 
+	-37, 13, -46, -31, -11, -93, 22, -9, 
+	-10, -12, -29, -209, 23, 91, 104, -66, 
+	9, -115, -9, -44, -21, 2, -227, 16, 
+	-93, -57, 57, -10, -77, -149, 35, 13, 
+	12, -131, -44, -106, -60, -159, -89, -146, 
+	-52, 6, -66, 13, -34, 10, 47, 119, 
+	-101, 1, 84, -29, -8, 102, -135, 37, 
+	19, -45, 39, 103, -52, -66, -47, -54, 
+	1, -10, 105, -93, 14, -59, 13, -22, 
+	-18, 33, -83, 115, -62, -44, -82, 113, 
+	-32, 119, -15, 37, -133, -26, -13, 32, 
+	25, 44, -48, -111, -23, -72, -35, 0, 
+	-59, 34, 76, -58, -16, -90, 38, 19, 
+	-9, -75, 36, 104, -16, 92, 9, -33, 
+	42, 149, 76, -15, 10, -88, 150, 10, 
+	-27, -40, -44, -58, -55, 47, 153, 90, 
+	252, 31, -127, 71, 47, -29, 30, 24, 
+	-42, -16, -48, -209, 68, 64, -8, -70, 
+	30, -95, -10, 14, -88, 21, -226, 67, 
+	0, -11, 44, -18, 20, -109, 28, -45, 
+	-26, 22, -31, -180, 25, -174, 96, -50, 
+	-61, -8, 1, -164, 20, 15, -35, -33, 
+	-74, -144, 41, -26, 22, -98, -177, -25, 
+	-51, -58, 45, -8, 23, -90, -21, 9, 
+	-11, -108, -33, -164, -62, -159, 1, -122, 
+	22, 39, -36, -21, -4, -8, 61, 111, 
+	-115, -75, 68, -130, 57, 53, -105, -5, 
+	-46, -25, 48, 98, -57, 30, -139, 12, 
+	-98, -41, 40, 48, 67, -35, -55, -23, 
+	-11, -15, 12, 18, -80, -56, -106, 91, 
+	-25, -64, 1, 65, 15, 53, 2, -64, 
+	20, -9, 8, 38, -33, 73, -70, -42, 
+	-85, 65, 143, 46, -25, 48, 106, 26, 
+	-19, 13, 40, 114, 31, -9, -91, -12, 
+	67, 34, -4, 56, -90, -122, 133, -77, 
+	-37, 77, -80, -97, -15, 15, 112, 24, 
+	102, 89, 53, 107, -73, 159, -14, 30, 
+	41, -42, 100, -286, -41, 50, 40, -176, 
+	15, -186, 83, -24, 53, 101, 8, 10, 
+	-20, -41, 81, 203, -60, 4, 66, -67, 
+	30, -131, -186, -9, 52, -185, -22, -17, 
+	-48, 15, -19, -129, 15, -9, -43, -98, 
+	-90, -130, -25, -194, -84, 10, 7, -37, 
+	-15, -16, 8, 48, -131, 52, -114, 3, 
+	-87, -156, -145, -13, 54, 44, -18, -64, 
+	4, -46, -49, -71, 10, 37, 18, -60, 
+	-52, 67, -16, -123, -20, 1, 19, -54, 
+	-4, -20, 28, -23, -33, -4, -23, -36, 
+	-147, -59, 44, 95, -117, -38, 3, -30, 
+	-41, -54, -25, 34, 20, 29, -76, -4, 
+	-26, 72, 17, -24, 37, 11, 111, -5, 
+	31, 25, 0, -48, 29, -57, 59, -38, 
+	-87, -37, 24, 62, -67, 7, -68, -15, 
+	-25, 26, -81, 88, -42, 31, -74, -21, 
+	-84, -74, -68, 24, -61, -17, -30, -10, 
+	-56, -2, -27, -9, -49, -38, 70, 8, 
+	76, -91, 45, -9, -34, 87, -76, -2, 
+	56, -60, 23, -52, -42, 64, -34, 4, 
+	-11, -84, -4, -36, 163, 88, 18, 126, 
+	-103, -82, 57, 155, -87, 75, 32, -28, 
+	93, -174, -122, 45, 77, 103, 66, -147, 
+	-51, 48, 8, -5, -41, 32, -62, -59, 
+	-99, -168, -45, -255, 67, 86, 1, -30, 
+	-153, -120, -65, 3, -104, 48, -144, 6, 
+	-2, -216, -44, 40, 22, 97, 91, -237, 
+	-5, -88, -63, 39, -140, 20, 30, -87, 
+	-77, -197, 36, -169, 48, 77, -35, -69, 
+	-184, -116, 1, 48, -136, 38, -122, 37, 
+	-126, -54, -134, 19, -3, 22, -95, -146, 
+	6, -49, -70, -91, -89, 2, 88, -69, 
+	-19, -90, 46, -218, 11, 16, 21, -26, 
+	-100, -99, -11, 64, -94, -40, -113, -21, 
+	-25, -91, -32, -20, 20, 76, -17, -78, 
+	-75, -67, -86, 103, -37, -51, 84, -8, 
+	76, -7, 37, -58, 27, 40, 32, -95, 
+	50, -85, 8, 22, 108, 73, -4, -19, 
+	-19, -21, -9, 59, 3, 183, 29, 24, 
+	-21, -47, -3, 60, 57, -30, 12, -16, 
+	27, 84, -65, 7, 19, -80, 62, 3, 
+	7, 13, -63, 38, 73, -11, -28, 131, 
+	-90, 85, -8, 14, 61, 0, 12, 56, 
+	-37, -57, -114, 75, -10, -51, -43, 17, 
+	-16, 83, -111, -53, 30, -12, 56, -29, 
+	74, -53, -62, 72, 52, -44, -49, 50, 
+	-99, 33, 22, 63, -73, -55, -35, 18, 
+	-20, -56, -144, 3, -20, -8, -40, -2, 
+	-133, 39, -35, -79, -18, 69, -104, -25, 
+	34, -66, -71, 48, -104, -53, -58, -31, 
+	-131, -34, -102, -95, -114, -95, 4, -106, 
+	28, -17, -87, -91, 12, -12, 129, -41, 
+	80, 68, 62, -92, -96, 44, -20, -32, 
+	50, 57, 16, -32, -19, -97, -24, 29, 
+	-10, 26, 18, -91, -63, 45, 22, -17, 
+	16, -1, 56, 145, 3, 42, 74, 28, 
+	44, 109, 70, 107, -74, -35, 5, -28, 
+	83, -8, 62, -130, 36, -52, 29, 46, 
+	57, 57, 24, -116, -56, 64, -52, 82, 
+	-28, 0, -23, 41, 53, -4, 16, 95, 
+	146, -33, 25, 4, -53, 23, -47, -15, 
+	38, 104, 75, -16, 180, -1, 73, -29, 
+	81, 169, 132, -105, -30, -65, 112, 81, 
+	-68, -73, -22, 55, 53, -40, -120, 41, 
+	-43, -44, -40, 92, -90, -20, -252, -21, 
+	32, -87, -11, -53, 56, -217, 2, 36, 
+	-14, 108, 114, -212, -168, -199, -26, 92, 
+	-22, -21, -116, 124, -72, -92, 27, 11, 
+	-194, -94, 29, 21, -38, 7, -247, -64, 
+	33, -88, -86, -42, -137, -209, -35, -4, 
+	-116, 60, 38, -278, -169, -115, 10, 14, 
+	32, -58, -4, 2, 39, 4, 81, -57, 
+	60, 33, 47, 59, -142, 54, -125, 34, 
+	66, 12, 72, -135, 16, -240, -96, 24, 
+	58, 39, 24, -225, -56, 9, 88, 14, 
+	115, -31, 8, 83, 25, 66, 54, -54, 
+	128, -61, 107, 55, -165, -105, -165, 25, 
+	14, 38, 61, -327, 16, -222, 110, 42, 
+	76, 44, -22, -253, 53, 56, -37, 79, 
+	28, 28, 22, 19, -37, 63, 13, 41, 
+	106, -91, 110, 40, -44, 31, -130, 88, 
+	69, 66, 97, -53, 87, -8, 21, 15, 
+	83, 67, 84, -74, 33, 57, 2, -4, 
+	31, 6, -41, 49, -25, -11, -165, 122, 
+	-40, -130, -22, 40, -222, -58, -188, 42, 
+	17, -114, 0, -124, 97, -129, -118, 14, 
+	-15, 95, 109, -249, -2, 7, 18, 18, 
+	-74, -48, -101, 138, -55, -10, 35, 71, 
+	-80, -29, -9, 32, -137, -66, -175, -76, 
+	29, -66, 9, -159, 36, -71, -101, 93, 
+	-74, 110, 35, -210, -41, 82, -1, 45, 
+	-17, -50, -61, -32, 83, 124, 149, -67, 
+	111, -3, 122, 70, -138, -7, -261, 81, 
+	25, -10, 100, -191, 47, -173, -28, -17, 
+	59, 33, -134, -360, -119, -19, 30, -57, 
+	-1, 17, 37, 30, -5, 66, 91, 3, 
+	103, -105, 33, 30, -194, -95, -236, 82, 
+	-27, 8, 102, -441, 106, -291, 111, 24, 
+	160, -117, -52, -164, 41, 13, -41, -61, 
+	119, 19, 2, 22, 55, 54, 57, -10, 
+	80, -144, 52, 80, -158, 42, -106, 102, 
+	10, 23, 132, -59, 85, -9, 61, -13, 
+	171, 61, 37, -98, 45, 67, -45, 20, 
+	47, 36, 26, 3, 25, 20, -38, 44, 
+	-47, -33, -100, -43, -70, -34, -56, 30, 
+	64, -55, 55, -51, 47, 46, -11, 69, 
+	133, 77, 115, -112, 109, 114, 46, -30, 
+	-77, -35, -19, 114, 56, 17, 15, 46, 
+	-3, -33, -82, 17, -155, -54, -37, -77, 
+	37, -32, 67, -212, 61, 22, -19, 6, 
+	-147, 99, 65, -135, -16, 136, 59, 51, 
+	-34, -58, -11, -53, 34, 88, 79, -73, 
+	56, -88, 101, 52, -88, -33, -233, 15, 
+	49, 43, 119, -158, 37, -197, 83, 110, 
+	41, 4, -59, -309, 2, -80, 24, 68, 
+	-15, 92, 25, 47, 42, 32, 25, 107, 
+	93, -112, -26, -25, -204, -71, -72, 63, 
+	82, 0, 57, -255, 31, -114, 90, 52, 
+	150, 7, 24, -161, 65, 30, 31, -72, 
+	-25, -51, -72, 51, -32, -18, -76, -7, 
+	-47, -9, -40, 8, 37, -40, 39, -30, 
+	27, -15, -30, -40, -57, -67, 69, -31, 
+	-55, 56, 33, -9, 12, 20, -47, -36, 
+	-102, -113, -50, -46, -22, -9, 56, -28, 
+	11, 153, 27, -84, -34, -76, 132, -43, 
+	-87, 20, -9, -38, -28, -6, -25, -21, 
+	-135, -33, -88, 22, -6, 101, -44, -32, 
+	-3, -29, -11, -90, -27, 49, 20, 31, 
+	59, -8, 46, 30, -59, -49, -7, 44, 
+	-49, -13, 74, 22, 79, -46, 141, 15, 
+	195, -42, 11, -46, -14, 39, -14, -58, 
+	-11, -26, 7, 47, 24, 56, -10, -6, 
+	11, -40, -2, -14, -11, -2, -13, 10, 
+	-64, 33, 33, -15, -34, 65, 60, -22, 
+	50, -69, -18, 47, 7, 120, 19, -38, 
+	-27, -25, 13, 26, 48, 10, 66, -75, 
+	-21, -24, 64, -14, 88, 40, -10, 2, 
+	-106, 11, 37, -5, -65, 17, 39, 6, 
+	-56, -106, -48, 46, -16, -62, 35, -105, 
+	-31, 2, -76, 37, -16, -49, -131, -67, 
+	-60, 80, -89, -62, -9, -41, 22, -77, 
+	-14, -9, -106, -43, -6, -2, -82, -76, 
+	-104, 55, -15, -42, -34, 42, -53, -1, 
+	15, -56, -58, -62, -15, 33, 15, -115, 
+	26, -3, -32, 18, -98, -93, -72, 23, 
+	-36, -61, 13, -89, 11, -116, 0, -47, 
+	-92, -15, -137, -135, -66, -13, 9, -10, 
+	12, -66, 16, -178, 15, 27, -20, 8, 
+	43, -4, 51, 26, -77, -104, -75, 86, 
+	-72, -38, -19, -179, -26, -83, 16, -50, 
+	153, -99, -16, -27, 32, -133, -42, -73, 
+	-71, -2, -41, 60, -31, -43, 34, 22, 
+	-25, -6, -56, -69, -18, -45, -51, -44, 
+	-97, 0, 19, -111, -92, 22, 18, -10, 
+	-8, -65, 54, -18, -59, 29, 38, -42, 
+	-50, -41, -24, -41, 4, 17, 66, -61, 
+	33, -50, 64, -55, 19, -9, -98, -8, 
+	-86, 20, 66, -20, -65, -37, 10, 11, 
+	35, -120, 12, -3, -30, -41, 25, -51, 
+	-42, -7, -95, 74, -64, 23, 54, 63, 
+	93, 127, -87, -3, -29, -162, -3, -51, 
+	105, -44, -49, -143, 15, -75, -58, 15, 
+	-32, 116, 33, -79, -24, -24, 16, 113, 
+	74, -11, -39, 24, 11, 87, 36, -58, 
+	70, 54, -24, 69, -68, -73, 8, 38, 
+	77, -31, -15, -154, 72, -95, 121, 48, 
+	90, -16, -120, -98, 31, -101, -112, 93, 
+	-57, -22, 43, -32, 54, 31, -19, 69, 
+	13, 24, -71, -8, -170, -59, -11, 25, 
+	-39, -5, 57, -125, 3, -121, 78, -30, 
+	27, 29, -50, -41, 19, -91, -12, 46, 
+	21, 17, -23, 83, -18, -11, -31, 14, 
+	-26, 111, -46, -88, -78, -120, -17, -61, 
+	-51, -9, -18, -115, -57, -93, -66, 62, 
+	-87, 65, 32, -54, -32, -6, -3, -67, 
+	13, -32, 4, -3, -28, 17, 4, 30, 
+	29, 1, 91, 20, -64, -26, -133, 56, 
+	29, -40, 36, -54, -13, -119, -29, 45, 
+	18, -54, -102, -62, -53, 17, 32, -37, 
+	2, 4, -85, 6, 44, 42, 34, -2, 
+	63, 64, -31, 114, -58, -131, -38, -36, 
+	35, 88, 17, -47, 29, -78, 28, -10, 
+	67, 31, 21, -130, -32, -48, -20, 83, 
+	33, 19, -28, 36, -43, 80, -80, 3, 
+	45, 57, -49, 78, -64, -57, -27, 50, 
+	16, 19, 49, -135, 94, -83, 43, 25, 
+	88, -18, -73, -78, 17, -4, 15, 100, 
+	-56, 33, 42, -32, 67, -33, -146, 57, 
+	-104, 42, -65, 22, -132, -92, -16, 28, 
+	4, 17, -12, -85, -16, 11, -7, -15, 
+	-5, 44, 51, -76, 26, -37, 48, -8, 
+	-69, -46, -23, 48, 27, -6, -78, -7, 
+	-12, 11, -61, -63, -163, -95, -26, -63, 
+	18, -31, -27, -107, -103, -5, 7, 20, 
+	85, 57, 60, -108, -67, 17, -16, 58, 
+	64, 26, -30, 33, 64, 42, -53, -63, 
+	-25, -1, -1, 50, -65, -141, -77, 26, 
+	0, 54, 18, -72, -104, -65, 66, 10, 
+	25, -14, 26, -28, -2, 13, -22, 21, 
+	108, 89, 45, 14, 72, 42, 47, -30, 
+	118, -41, -43, 111, -221, -38, -220, 47, 
+	-19, 43, 17, -145, 14, -143, 97, 98, 
+	120, -73, -79, -198, 12, -80, -78, 10, 
+	12, 73, 43, 15, -10, 94, -110, 49, 
+	-9, -6, -88, 91, -146, -99, -19, 38, 
+	-7, 41, -4, -169, 71, 74, 54, 11, 
+	6, -72, -38, -24, 18, 33, -18, -15, 
+	32, 33, 27, -79, 0, 47, -87, 0, 
+	-89, 91, -105, -58, -42, -9, 55, 16, 
+	-15, -23, -45, -23, -58, 158, 10, 33, 
+	-102, -6, -59, 92, 66, 15, 85, 43, 
+	-2, -8, 36, -148, -12, -54, -35, -21, 
+	-5, 49, -27, -43, -79, -38, -31, 0, 
+	-18, -15, -33, -14, 3, 87, -34, 58, 
+	85, -14, -53, 62, 56, -48, 72, 36, 
+	45, 7, 32, 26, 3, -43, -118, 25, 
+	-43, 54, -100, -13, -110, -73, 40, -24, 
+	-29, 9, -67, -91, 14, 68, 47, 54, 
+	35, -5, 14, -18, 21, -4, 31, 61, 
+	-42, 20, -59, -33, -20, 29, 79, -23, 
+	53, 89, -13, 87, -130, -7, -126, -52, 
+	51, 49, 13, -19, 55, -103, 100, 69, 
+	25, 17, -47, -194, -26, -258, 70, 28, 
+	96, 38, 63, -117, 10, 55, 84, -1, 
+	48, -128, 24, 55, -30, -75, -242, 70, 
+	29, 127, 75, -110, 78, -139, 90, 25, 
+	37, -135, -54, -149, 55, -152, 16, -17, 
+	24, -40, 82, -71, 41, -14, -2, 50, 
+	-84, -50, 4, 46, -43, -18, -1, 90, 
+	-6, 60, 27, 15, -20, -25, -73, 52, 
+	88, -31, 25, 65, -2, 32, 3, -55, 
+	35, 24, -45, 87, 28, -49, -109, -14, 
+	-13, 68, -32, -49, 122, 81, 127, -48, 
+	-70, 5, -8, -26, -77, 66, -85, 64, 
+	-37, -24, 61, 136, -47, 63, -4, 4, 
+	11, -68, 4, 13, 24, 6, -49, -28, 
+	-65, 109, -31, -24, 143, 101, 31, 6, 
+	15, 15, 52, 117, -12, 109, 44, 14, 
+	93, -68, 26, 75, 96, -4, -29, -106, 
+	108, 42, 42, -120, 42, 71, 96, -18, 
+	15, -8, -16, 43, -14, 34, -65, -13, 
+	15, 63, 11, 37, 71, -19, 129, -20, 
+	54, -80, -60, -112, 76, -127, 86, 81, 
+	58, 54, -3, 33, 105, 59, 51, 31, 
+	64, 22, -7, 59, -77, 23, -49, 42, 
+	-26, 107, 41, -1, 95, 40, -2, 71, 
+	83, -21, -15, 74, 18, 85, 40, -22, 
+	77, 12, -38, -30, 18, -12, 1, 85, 
+	-70, 76, -33, -4, -30, 30, 0, -10, 
+	18, -56, 35, -26, -44, 67, -169, 30, 
+	31, -20, 45, 50, -22, 59, 80, 40, 
+	-21, -16, 10, -19, -35, -97, -142, 34, 
+	-118, 89, -85, -16, -94, -15, -73, -69, 
+	-34, -26, -113, -12, -96, 60, -15, 40, 
+	-68, 0, 30, 24, 44, 18, 89, 145, 
+	-53, -83, 34, -9, 11, 28, -72, -28, 
+	-119, -25, 2, -82, -66, -33, 23, 19, 
+	2, 14, 5, 10, -40, 113, 42, 15, 
+	66, -31, -51, 70, 81, 64, -1, 32, 
+	17, -31, 38, 41, -13, 26, 65, 102, 
+	7, -17, 35, 35, 72, 13, 41, -14, 
+	-14, 3, 9, 32, 127, 45, -31, 83, 
+	52, 69, 88, 73, 19, 31, 1, 17, 
+	-6, -71, 31, 127, -9, 14, 117, -36, 
+	15, 42, 112, -55, 61, 33, 12, -36, 
+	55, -3, 57, 127, -92, 62, -23, 90, 
+	-35, 47, 72, 78, -29, 118, -26, 62, 
+	67, -2, -18, -41, -60, 12, -91, -142, 
+	-55, -8, -107, -41, 24, 20, -8, 30, 
+	-82, -69, -46, 54, -99, 51, -109, 11, 
+	-42, -72, -129, 85, 38, 42, -47, 37, 
+	-66, -113, 64, -100, 38, -172, -144, -20, 
+	-158, 118, -39, -88, 31, -37, 118, -134, 
+	-100, 55, -172, -38, -101, 53, -50, -17, 
+	-197, -131, -39, 44, -107, 91, -24, -57, 
+	-48, -93, -48, 19, -22, -93, -163, -124, 
+	-126, 45, -46, -46, 87, -60, 58, -20, 
+	-103, -23, -106, 30, -55, -7, -130, -71, 
+	-130, -170, -188, 17, -77, 23, 13, -122, 
+	-14, -62, -16, 90, -83, -59, -62, 37, 
+	-61, 127, 20, -158, 71, 79, 97, -61, 
+	-64, -10, -33, 165, 0, 97, -135, 70, 
+	-30, 23, 120, 82, 8, 1, 40, -177, 
+	-53, -59, -32, 41, -25, -28, 37, -22, 
+	-36, 40, 66, -45, 32, 93, 57, 14, 
+	-56, -29, -17, 75, -41, 9, -226, -21, 
+	-60, 23, 92, 19, -12, 111, 3, 11, 
+	-28, -8, -46, -46, -98, -130, -178, -126, 
+	-53, 94, -153, 39, -36, -38, 27, -92, 
+	-68, -31, -93, 22, 48, -49, -141, -26, 
+	-55, 17, -87, 46, -7, 51, -5, -6, 
+	-85, -43, -88, 11, -52, -89, -106, -125, 
+	-47, -13, -172, -67, -128, -120, -99, -74, 
+	-7, -126, -166, -91, -52, -139, -73, -85, 
+	-169, -59, -180, -109, -74, 19, -87, -80, 
+	-49, -129, -87, -171, -55, -126, 6, -102, 
+	-4, -118, -79, -107, -29, -63, -96, -12, 
+	-115, -2, -78, -166, -4, -148, -64, -72, 
+	-80, -167, -204, -136, -59, -76, -32, -105, 
+	-51, -44, -87, 89, -73, -28, 12, -40, 
+	37, 150, 47, -111, 24, 28, 55, 15, 
+	-8, -32, -21, 69, -23, -56, -172, -43, 
+	-87, 75, 7, -62, -93, 31, 72, 19, 
+	-15, 46, -95, 9, -18, -96, 101, -11, 
+	76, 83, 20, -82, -1, 3, -16, 61, 
+	14, -7, -37, 19, 125, -131, -58, 41, 
+	13, 79, -50, -87, -73, 32, 30, 79, 
+	-4, -19, -43, 72, -62, -126, -100, -15, 
+	-24, -16, -119, -41, -112, -96, -99, -6, 
+	68, -101, -45, -97, 81, -176, -3, 5, 
+	41, 22, 12, -136, -45, 47, -6, -54, 
+	-119, -21, -85, -44, 7, -108, -82, -156, 
+	-28, -81, -111, 22, -96, -126, -69, -82, 
+	44, -69, -134, -49, 29, -125, -113, -52, 
+	-113, 13, -148, -145, -93, -16, -36, -91, 
+	-111, -53, -67, -155, -81, -128, -86, -105, 
+	13, -181, -138, -58, -140, -134, -152, -54, 
+	-13, -32, -97, -107, -61, -225, -55, 23, 
+	-14, -84, -139, -265, -116, -193, -68, -99, 
+	30, -122, 19, -184, -20, 11, 178, -125, 
+	2, -77, 177, -81, 71, 98, -18, 36, 
+	-62, 39, 61, 143, -27, -56, 143, -54, 
+	-47, -166, -304, -32, 46, -176, -53, -10, 
+	10, 30, 74, -122, 75, 24, 19, -124, 
+	-4, 8, 93, -36, -125, 92, 11, 97, 
+	-44, 94, 44, 92, -4, -28, 15, -56, 
+	-18, -140, -148, -83, 33, -166, 91, -154, 
+	28, 72, -23, -198, 20, 89, -137, -42, 
+	-14, -62, -88, -2, -334, -135, -169, -21, 
+	0, 77, 12, -147, 120, -54, -54, 87, 
+	-27, -52, -46, -163, -48, -182, 50, -39, 
+	-10, 59, 77, -90, 83, -2, -145, 48, 
+	-73, -40, -141, 57, -146, -181, -14, -60, 
+	53, 66, -40, -163, 2, -70, 22, 94, 
+	17, -11, 20, -70, 55, -138, 27, 2, 
+	49, 24, -26, 109, 40, -71, -170, -8, 
+	2, 3, -144, 112, -107, -134, -20, -30, 
+	46, 61, -59, 62, 18, 58, -25, -40, 
+	67, -3, 122, -65, 59, 48, 87, -14, 
+	-13, -84, -73, -159, -11, 20, 152, 16, 
+	-3, 108, 156, 52, -16, -48, 11, -1, 
+	89, 41, 65, -25, -45, -136, -50, 36, 
+	21, 15, -80, -74, -103, -211, -29, 58, 
+	77, -35, -16, -186, -17, 77, 46, -120, 
+	41, 24, 126, 8, -14, 2, -141, 34, 
+	-16, -22, 116, 50, 5, -141, 39, 35, 
+	34, -107, -254, -156, -18, -241, -16, -12, 
+	68, 16, 51, -207, 8, -16, -87, -77, 
+	-96, -202, -92, -27, -32, 27, -179, -13, 
+	37, 40, 75, 52, 83, 16, -85, 35, 
+	-43, -166, -46, -111, -32, -184, -3, -76, 
+	18, 91, 21, 104, 18, -57, 3, 30, 
+	-26, -85, -85, 22, 1, -21, -64, -17, 
+	-30, 15, -14, -52, -10, 88, -70, 13, 
+	-128, -91, 78, 67, 31, -1, -42, -22, 
+	30, 30, -9, 137, -15, -66, -94, 17, 
+	-47, -93, -150, -18, 73, 12, -4, -54, 
+	-12, -81, -110, 120, -52, 69, -59, -59, 
+	-12, 27, 36, 32, -25, 105, 65, -23, 
+	4, -50, -42, -83, 37, 47, 10, -90, 
+	31, -53, 17, 16, 2, 59, -72, -18, 
+	47, 4, 39, 90, -2, 35, 74, 18, 
+	-132, 8, -35, 3, -14, -210, -21, 45, 
+	-41, -10, 17, -162, 3, 15, -85, -157, 
+	-11, -109, 41, -32, -10, 59, -1, 14, 
+	-43, 56, 68, 6, -19, -28, 96, -62, 
+	-13, -87, -194, 43, 20, -112, -151, -22, 
+	81, -34, 18, -202, 30, -22, 43, -13, 
+	-28, -65, -6, -160, 19, 122, 60, 19, 
+	26, 77, 35, 48, 11, 137, -176, -82, 
+	-10, -146, 22, 117, 12, -41, -82, -135, 
+	83, 60, -7, 97, -4, -19, 33, 61, 
+	73, -80, -39, -92, 31, -11, -26, -36, 
+	-43, -95, -43, 46, 56, 4, -32, -49, 
+	-2, -51, 96, 101, -51, 108, -73, 14, 
+	-43, 39, -50, 141, -93, -61, -43, 8, 
+	-155, -38, -76, 20, 139, 69, 60, -85, 
+	-18, 14, -153, 52, -185, 78, -18, -92, 
+	-27, 3, -29, 97, -9, 212, 36, -103, 
+	-73, -30, 6, -50, -40, -42, -23, -119, 
+	-12, 31, 8, 46, 69, -13, 66, -20, 
+	-44, -22, -51, 10, -3, 110, -6, -25, 
+	-107, 41, -56, 137, 48, -16, -3, 21, 
+	7, -18, -16, -79, -8, 31, -61, -116, 
+	-21, 1, -74, -79, 79, 21, 94, -11, 
+	-48, 30, 54, 109, 4, 88, -25, -6, 
+	-2, -98, -170, 125, -15, -45, -51, -58, 
+	-28, 11, 16, -126, -36, -5, 132, -115, 
+	10, -126, 59, -42, 0, 109, -42, -33, 
+	-94, -94, -36, -24, -52, 107, 2, -84, 
+	75, -220, -69, 95, 10, 53, -144, -36, 
+	53, 19, -11, 72, -117, -30, -178, 34, 
+	-171, -180, -39, -84, -13, -87, -6, 19, 
+	-141, -108, -155, -5, -149, 78, 32, -64, 
+	80, -89, 98, 22, 18, 161, -52, -192, 
+	-72, -86, -118, 137, -121, -153, 31, -53, 
+	-85, -104, -58, -72, 79, 13, 74, -122, 
+	-9, -81, -217, -8, -60, 114, -209, -49, 
+	-177, 15, 29, 70, 17, 186, 23, -134, 
+	-16, 21, -50, -54, 38, -3, -113, -38, 
+	7, 115, -131, 10, -68, -81, 26, -67, 
+	3, 8, 12, -97, 93, -71, 1, 48, 
+	-34, 72, -43, -30, -45, 33, 4, -43, 
+	-59, -12, -15, 3, 36, -41, 26, 46, 
+	54, 48, -34, 0, 2, -62, 68, -7, 
+	67, -23, 0, -99, 48, -93, -60, -4, 
+	-71, 63, 12, -6, -80, 45, -12, 28, 
+	-20, -14, 7, 29, -56, -29, 90, 43, 
+	16, 47, 94, 40, -64, -56, 17, 71, 
+	-54, -13, 55, -64, 45, -22, 32, 45, 
+	16, 17, 18, 53, -50, 3, -92, -37, 
+	-79, 20, -97, 132, -29, -70, -115, 45, 
+	-166, 34, -102, -86, -26, -170, 64, 70, 
+	74, -49, -163, -74, -70, -84, -123, 12, 
+	85, 22, 44, -11, -129, 98, 62, 23, 
+	-69, -97, -159, 39, -11, -101, 27, -58, 
+	30, 48, -23, -41, -99, -115, -88, -57, 
+	55, -23, -7, -80, 63, -142, -81, 0, 
+	-142, 84, -14, -118, -156, 50, -6, 8, 
+	-6, -6, -56, 38, 7, -49, -8, -40, 
+	-78, -32, -16, -24, 143, 123, 33, -88, 
+	-89, -10, -64, 186, -117, 11, -168, -64, 
+	-69, -58, -47, 61, 31, -133, 95, -34, 
+	-23, -27, -28, -25, -8, -17, 19, -38, 
+	-94, -38, 82, -69, 95, 96, -34, 52, 
+	-46, -39, -54, 129, 15, -42, -129, -45, 
+	-31, -60, 67, -5, 3, -95, 116, -53, 
+	15, -23, 13, 14, -4, -27, -29, 68, 
+	-37, -40, 61, -22, 54, 86, 47, -77, 
+	-75, 66, 13, 58, -102, -43, -14, -7, 
+	-16, 9, 90, 13, 6, 31, -8, 11, 
+	-15, 6, -16, 59, -8, 7, 71, -37, 
+	117, -16, 137, -73, -3, 65, 3, -44, 
+	-30, -4, 18, 101, -32, 30, -10, -14, 
+	-73, -10, 42, 27, 55, 28, -31, 73, 
+	20, -22, 26, -7, -100, 35, 91, -34, 
+	0, -181, 142, -89, 67, 79, 102, -4, 
+	-135, -73, 42, 103, -83, 108, 70, -36, 
+	-23, -203, 36, 36, 26, 47, -81, -42, 
+	-101, -70, -116, 65, 22, -31, -38, 22, 
+	-83, -11, -28, 30, 59, -55, -31, 24, 
+	-31, -120, -130, 100, 9, -127, -72, 26, 
+	-53, 140, 27, -99, 16, -102, -60, 21, 
+	-48, -47, -57, -94, 3, -78, -50, 8, 
+	-123, -56, 6, -96, 24, 33, -10, -85, 
+	-57, -107, -22, 82, -52, 6, -32, -55, 
+	-36, 5, -115, -21, 0, -104, 34, 8, 
+	-84, -37, -4, -94, 4, -93, -23, -25, 
+	-139, -66, 7, -56, 48, 25, 38, -93, 
+	-163, -49, -86, 125, -39, -44, -57, 40, 
+	-111, -59, -19, 47, -38, -81, 36, -63, 
+	-44, -41, -55, -45, -14, -38, -124, -174, 
+	-141, 17, -85, -139, 29, -3, 54, -74, 
+	-163, -67, -47, 60, -25, 101, 39, -13, 
+	-136, -37, -123, 92, -5, 30, -71, -81, 
+	-138, -29, -77, -149, -86, -87, -92, -93, 
+	-98, 98, -19, -108, 10, 53, 131, 38, 
+	-43, 69, -27, -11, -28, 84, -140, 50, 
+	-144, -52, -165, 125, -88, 107, -90, -137, 
+	-57, -45, -52, 50, 70, -36, -102, 23, 
+	-53, 52, -119, 111, 15, -68, 41, -56, 
+	-8, -18, -96, -62, 0, -17, -43, -46, 
+	-31, 94, -8, 49, -93, 36, -86, 46, 
+	-70, -126, -87, 16, 17, -96, -82, -25, 
+	-117, -33, 7, -16, 148, -36, 38, -78, 
+	-31, -95, -76, 51, -22, -27, -117, -45, 
+	-152, -24, 4, 82, -107, -108, -85, 46, 
+	-66, -38, -131, -121, -85, -64, -145, -26, 
+	-120, 59, -53, -83, 65, -72, 130, -46, 
+	-24, -5, -111, 5, -19, -17, -83, 5, 
+	-142, 18, -49, 128, -32, 35, -104, -37, 
+	-153, -42, -70, -68, -26, -112, -45, 50, 
+	34, 247, -74, -78, -100, -159, 254, -52, 
+	125, 10, -26, -146, 110, -21, -103, 57, 
+	-107, 97, -103, 114, -153, 165, -80, 33, 
+	-44, -73, -81, -212, 29, 6, 67, -10, 
+	126, 249, -32, 61, -188, -135, 58, 0, 
+	97, 18, 10, -205, 118, -238, 98, 88, 
+	-64, 98, -115, -200, -3, -140, 89, 120, 
+	8, -2, -90, 26, 58, 5, -138, -8, 
+	23, -108, -106, -35, -92, -87, -12, -67, 
+	30, -40, -102, -101, 64, -58, 28, 4, 
+	22, 79, 66, -33, -48, 78, 38, 11, 
+	-150, -66, -104, -22, -7, -85, -38, 38, 
+	9, -1, -178, -31, -35, -221, 17, -91, 
+	6, -82, -40, -206, 11, -75, -106, -12, 
+	-111, 84, -47, -99, -136, 31, -66, -1, 
+	-48, -28, -2, -71, 49, -67, 93, 105, 
+	69, 112, -52, 23, -89, -178, 65, -82, 
+	39, -6, -2, -128, 10, -68, -34, 55, 
+	-1, 88, -29, -83, 1, -5, -11, 99, 
+	-36, -10, 21, -132, 47, 32, -19, 19, 
+	85, 182, 33, 87, -16, -78, 81, -36, 
+	78, 68, 5, -28, 114, -1, 171, 87, 
+	25, 31, -162, 31, 55, -14, -21, 148, 
+	5, -35, 114, -279, 93, 81, -71, -29, 
+	77, -74, 10, 51, 57, -9, 15, 84, 
+	70, -6, 105, -41, 100, 51, 60, -2, 
+	-4, -3, -62, 33, 54, -243, 22, 93, 
+	-28, 40, 30, 79, 18, -48, 66, -64, 
+	30, -46, -27, 1, -94, -78, -29, 9, 
+	-22, -24, -82, -30, 68, 1, 4, 22, 
+	40, 14, 18, -103, -18, 172, -2, -64, 
+	4, -35, 4, 7, -60, -19, -19, -25, 
+	20, -20, -102, -53, -102, 7, -77, -58, 
+	-46, -25, -44, -16, 121, 96, -51, -21, 
+	-49, -55, -90, -118, 14, 68, 67, 0, 
+	3, -11, 39, -183, 46, 52, 64, -4, 
+	62, -84, 79, 79, -43, 95, -81, 39, 
+	56, 15, 56, -13, 71, -37, 10, 40, 
+	-52, -98, -120, -103, -20, -113, 117, 102, 
+	30, -25, 74, -160, 73, 27, 4, -26, 
+	30, -90, -7, 40, -19, -37, 89, 59, 
+	-6, 85, 63, -119, 40, 22, 94, 36, 
+	0, -14, -38, 31, 31, -67, -21, 26, 
+	70, 76, -9, -82, 75, 19, -176, -11, 
+	-68, 164, -125, 45, 74, -6, 65, 76, 
+	-3, 72, 36, -24, 63, 48, -6, 85, 
+	-2, 11, 52, 48, 6, -78, -45, -30, 
+	-42, -21, -48, -114, 38, 54, 36, -106, 
+	72, 9, 78, 28, 24, 5, -33, -54, 
+	-86, -39, 23, 18, -15, -30, 56, 35, 
+	-39, -84, -118, 32, 15, -189, -70, 34, 
+	-22, -26, 51, -179, -7, 16, -87, -121, 
+	-184, -53, -99, -147, 28, -1, 36, -75, 
+	-76, 6, 8, -39, -10, 79, -35, -42, 
+	-72, -77, -166, 6, 55, -73, -27, -71, 
+	22, 26, -33, -145, -16, -45, 1, -27, 
+	-3, -88, -54, 3, -5, 33, -36, -24, 
+	59, 10, 41, -113, 59, -17, -58, -39, 
+	-26, -15, 109, 33, -21, -121, -1, -32, 
+	36, 32, -59, 84, -33, -100, -100, 105, 
+	60, 104, -123, 54, -103, -100, 41, -33, 
+	97, -25, -56, -97, 121, -90, -62, 48, 
+	-65, 98, 84, 32, -63, -38, 25, 57, 
+	-8, -17, -63, 24, -98, -132, -278, -47, 
+	7, 50, -154, 36, 49, -104, -8, -168, 
+	-44, -81, -122, 41, 56, 37, -16, -31, 
+	-115, 7, -128, 31, -11, -85, 47, 47, 
+	23, -33, -30, -57, -117, -62, 6, -140, 
+	-68, -253, -46, -40, -76, 39, -19, -68, 
+	-155, 1, -21, 11, -196, -16, -52, -42, 
+	-87, -134, -74, 66, -36, -85, -59, -109, 
+	-41, -28, -34, -61, -40, -38, 67, -128, 
+	-165, -222, -8, -111, 36, 89, -76, -41, 
+	-73, 60, 15, 70, -219, 70, -140, 35, 
+	-208, -173, -188, -20, 21, -16, -46, -77, 
+	-28, -32, 24, -149, -12, -42, 123, 8, 
+	-27, -241, 41, -22, 40, 168, -217, -20, 
+	-35, 52, 116, 108, -25, -33, -18, 53, 
+	96, -82, 66, -225, -31, -204, 93, -26, 
+	8, 66, 3, 144, 8, -64, -40, 146, 
+	-44, -59, 35, 94, -27, -17, -163, 14, 
+	49, 4, 3, -74, 124, -168, -95, 31, 
+	16, 143, 196, -172, -24, -151, 85, 28, 
+	-80, -65, -23, 175, -35, -66, -231, 19, 
+	-171, 117, -234, 175, -71, -112, -20, -46, 
+	58, -29, -169, -19, -25, -159, -31, 123, 
+	38, 118, 11, -97, -40, -95, 16, 105, 
+	-77, -58, -51, 31, -65, -102, -154, -59, 
+	-143, -16, -105, -103, -58, 33, -37, -3, 
+	-80, -29, -167, 19, -121, -35, -235, -54, 
+	-168, 41, 91, 5, -120, -88, -34, -153, 
+	-20, -43, -84, -48, -111, -53, 56, -164, 
+	-82, -79, -27, -157, 64, 13, -122, -114, 
+	-113, -66, -25, 75, -160, -135, -87, -30, 
+	-217, -15, 20, -105, 17, -148, -18, -154, 
+	-70, -42, 9, -237, -21, 67, 114, -105, 
+	-63, -241, 78, -85, 31, 133, -196, 37, 
+	-91, 60, 120, 107, -44, -132, -102, -30, 
+	-98, -204, -72, -132, 49, -396, -13, -133, 
+	-24, 2, 41, 117, 8, 22, 25, 162, 
+	-50, -217, 166, -43, -63, 139, -373, 19, 
+	79, 32, 25, 147, 19, -150, -124, 71, 
+	8, 8, 256, -284, -36, -250, 90, -36, 
+	-79, 34, -68, 247, 59, -63, -328, 130, 
+	-79, 30, -134, 114, -180, -70, -207, -107, 
+	7, 8, -78, -70, -13, -194, -59, 132, 
+	82, 181, 188, -258, -131, -93, 40, 138, 
+	-131, -40, -136, 73, -24, 3, -146, 121, 
+	-32, 122, -239, 83, -103, -126, -82, -53, 
+	107, -8, -156, -73, 91, -168, 15, 4, 
+	-154, 162, 99, -109, -85, -123, 41, 96, 
+	-53, -51, -14, -107, 32, -20, -31, 39, 
+	-75, 9, -65, 49, -20, -100, -46, -66, 
+	41, -79, -62, 16, 3, -96, 35, 49, 
+	-232, 127, 73, -17, 36, -290, -61, 32, 
+	-38, -36, -80, -247, -13, 41, 126, -114, 
+	-47, -39, 71, -82, 53, 97, -78, -54, 
+	20, 105, 33, 75, -67, 12, 14, -10, 
+	-120, 1, -72, -39, 23, -225, -2, -62, 
+	82, -50, 37, -129, 63, 62, 170, 48, 
+	-13, -75, 168, -43, -9, 153, -162, 124, 
+	0, 82, 110, 84, -48, -7, -100, -37, 
+	-9, -115, 35, -100, -22, -207, 16, -112, 
+	7, 58, 6, 100, -40, 32, -252, 78, 
+	-217, -201, -48, -38, -126, -90, -178, -12, 
+	-17, -11, -49, -9, -25, -25, -103, 74, 
+	17, 20, 105, -103, -2, 46, 131, -34, 
+	-6, 58, 39, 56, 98, -36, -74, 161, 
+	115, 136, -146, 72, 23, -55, 63, 21, 
+	152, 101, -37, -23, 104, 44, 32, 61, 
+	-76, 156, 101, 88, -23, 17, -8, 201, 
+	-28, -12, 1, -28, 52, -41, -80, 84, 
+	53, 199, -131, 39, -27, -58, 139, -104, 
+	133, -14, -86, -51, 93, -13, -12, 24, 
+	-141, 124, -9, 15, 25, -155, 71, 126, 
+	-61, 0, 7, -233, 57, 25, 99, -18, 
+	103, 145, 71, -29, -38, 8, 27, 5, 
+	74, 43, 95, -44, -56, 12, -14, -2, 
+	-92, 60, -149, 1, -25, -96, 61, 74, 
+	42, 18, 0, -178, 101, 103, 136, -11, 
+	150, -64, 182, 21, -54, 41, -44, 60, 
+	1, 109, 153, -46, -79, -28, 30, -42, 
+	61, -125, -35, 31, 21, -63, -82, 19, 
+	42, 89, 47, 33, -4, 5, -167, 5, 
+	-56, -78, -11, -50, -50, 4, -6, -24, 
+	-2, 4, 65, -88, -1, 40, -103, -27, 
+	-93, -66, 76, 5, -43, 89, -123, -16, 
+	19, -2, 53, 120, -75, 44, -33, 55, 
+	45, 64, -17, -5, -62, -62, -52, -11, 
+	46, -24, 4, 21, -18, -19, -12, 71, 
+	-53, 135, 25, -30, 6, 30, 71, 121, 
+	-36, -77, -10, 12, 26, 87, -69, -75, 
+	14, -30, -12, 0, -75, -25, -24, 42, 
+	54, 67, 68, -52, -39, 38, 55, 37, 
+	-99, 0, -127, -135, 25, -98, 69, 5, 
+	70, 15, 30, -151, 43, 80, -20, 30, 
+	-34, -100, 57, -30, -109, 11, -253, 40, 
+	-26, -27, 88, -179, -43, -134, -11, -7, 
+	6, -100, -33, -141, -39, -143, -12, 59, 
+	64, 85, 27, -41, 47, 30, -44, 81, 
+	-9, -66, -77, 51, -245, -180, -11, 8, 
+	24, 20, 7, -199, -61, -102, -18, 98, 
+	-8, -45, 29, -34, 54, 74, -30, -14, 
+	-46, 63, 30, 109, 18, -34, -207, 71, 
+	5, 126, -149, -35, -47, -99, 160, -23, 
+	-63, 12, -107, 21, -15, 84, -25, 41, 
+	-7, 67, 28, 42, 4, 115, 60, 31, 
+	2, -12, 4, -31, -72, -86, -31, 1, 
+	-161, -4, -58, -39, 93, 66, 77, -32, 
+	-23, 19, 16, 121, -66, 146, -7, 36, 
+	-160, 22, 77, 54, 29, -48, 98, 62, 
+	52, -15, 14, -28, -1, -21, -69, -206, 
+	-103, -130, -61, -75, -92, 118, -8, -73, 
+	-24, 27, 71, 10, -40, 21, -6, 96, 
+	-97, -105, -193, -53, -68, -67, 37, -54, 
+	91, 57, 17, -151, 43, 68, -4, -32, 
+	-54, -246, -21, -17, -163, 6, -336, -15, 
+	-20, 65, 6, -135, -58, -131, 16, 1, 
+	28, -189, -204, -120, 18, -131, -72, -54, 
+	-37, 43, -44, -12, -64, 21, -108, -1, 
+	-39, -16, -69, -92, -185, -278, 54, -14, 
+	-24, -27, -42, -170, -40, 44, 18, 8, 
+	23, -82, -8, 13, -4, 108, 26, -19, 
+	-20, 31, -39, 85, -28, -132, -194, -24, 
+	-22, 138, -150, -50, -59, -46, 95, -79, 
+	-45, -69, -196, 20, -46, 69, -111, 35, 
+	-95, 56, 52, 81, 49, 147, 31, 64, 
+	-29, -55, -85, -84, 14, -53, 9, -166, 
+	16, 64, -26, 62, 69, 96, 142, -13, 
+	-96, 47, 2, 33, -102, 20, -18, 22, 
+	-20, -73, -114, 91, -88, 20, 14, -31, 
+	63, 21, -30, -185, 12, 54, 67, -283, 
+	-8, -135, 39, -46, 1, 17, -141, -44, 
+	-75, 2, 66, 4, -56, -125, 28, -28, 
+	51, -291, -294, -79, -11, -66, -76, -150, 
+	-2, 17, 85, -61, -29, -29, 98, 3, 
+	8, -174, 61, -38, -149, -75, 6, 80, 
+	-59, -80, -17, -103, -25, 36, -9, -17, 
+	101, -186, -38, 69, -24, 79, -129, -160, 
+	-58, 38, -23, 71, -38, -80, -221, 40, 
+	-163, 82, -162, -152, -50, -36, 141, 27, 
+	11, -82, -81, 8, -92, 104, -147, 30, 
+	-6, 40, 116, 59, -9, 109, 70, -56, 
+	-101, -93, -50, 60, 7, -161, -164, 111, 
+	-4, 218, -157, -29, 9, 33, 64, -113, 
+	20, 1, -163, 51, 32, 69, -7, 44, 
+	-34, 62, 105, 25, -38, 42, 19, 12, 
+	-33, -57, 7, -171, -53, 45, 1, -152, 
+	28, -70, -4, 86, -30, 45, -154, 25, 
+	-8, -51, 10, -66, -64, -94, 16, 1, 
+	67, -105, -112, -140, 27, -69, 14, -13, 
+	39, 19, 57, -26, 23, 6, 128, -25, 
+	24, -71, 32, -7, 47, -31, -30, 35, 
+	-84, -54, 69, -1, -11, -36, 43, 51, 
+	71, -127, -59, -9, 24, 28, -39, -44, 
+	-19, 23, 38, 121, -30, -49, 11, 41, 
+	-100, -61, -7, -125, -86, -17, 26, 17, 
+	-19, 23, -22, 5, 3, 57, -67, 0, 
+	67, -94, 50, 39, 23, 89, -80, 11, 
+	-86, 31, -34, 82, -116, -143, -69, -36, 
+	-217, 78, -151, 2, 58, -59, 49, -127, 
+	7, -56, -140, -1, -148, -10, -200, -13, 
+	-64, 46, 5, 53, 3, -10, 81, 57, 
+	-25, -32, 14, -63, 33, -102, -116, 63, 
+	-125, -39, -51, 13, 83, 29, -44, -83, 
+	-38, -67, -89, 106, -96, -35, 85, -17, 
+	81, 14, -1, -55, 27, -72, 77, 33, 
+	-19, -37, -2, -124, -11, -36, 88, -33, 
+	-3, -222, 36, -23, 33, 32, -107, 21, 
+	-28, 8, 63, -43, -11, -49, 43, -71, 
+	53, -185, -81, -92, -12, 5, 94, -166, 
+	-36, 39, 32, -34, -62, 18, 74, 31, 
+	-36, -205, 5, -30, 75, 64, -18, -31, 
+	-92, 40, 67, 74, -94, 70, -9, 50, 
+	57, -29, 101, 19, -5, 60, 0, -98, 
+	-19, 17, 45, 87, -54, -22, -91, 105, 
+	-220, 60, 11, -121, -9, 19, -44, -54, 
+	-3, -23, -14, 85, 29, -3, -123, -42, 
+	-19, 5, 51, 5, 28, 34, 58, -52, 
+	-29, 3, -44, 53, -24, -107, -144, 16, 
+	-49, 172, -90, 26, -20, -32, 73, -100, 
+	16, -81, -142, 9, -7, 2, -153, 20, 
+	-133, 102, 18, 119, -1, 40, -15, 79, 
+	-71, -2, -6, 7, 38, 15, -162, 59, 
+	-1, 131, -39, 44, -9, -1, 117, -17, 
+	-28, 1, -120, 20, 4, -19, 56, 38, 
+	23, -9, 53, 60, -21, 33, -86, -3, 
+	-54, -22, -99, 34, -62, -58, -45, -69, 
+	-37, -19, 11, -97, -44, 11, -26, -33, 
+	23, -27, -28, -40, -72, -70, -116, 22, 
+	1, -7, 0, -10, 2, 41, 15, -105, 
+	4, -48, -21, -60, -115, -11, -44, -93, 
+	31, -97, 63, -108, 79, 66, -15, -22, 
+	-89, -112, -23, 41, 16, 5, -24, -50, 
+	-62, -88, -3, -13, 0, -44, -52, -97, 
+	22, 34, -54, -88, -125, -34, -49, -84, 
+	-187, -146, 12, -136, 17, 29, -8, -98, 
+	-60, -89, -65, 138, -89, -10, -75, -31, 
+	7, -72, 23, 24, 115, -124, -79, 19, 
+	1, -99, 10, -148, -102, 15, -131, -59, 
+	-228, -114, -17, -223, 136, 109, 121, 46, 
+	-228, 17, -106, 103, -199, 6, -60, -59, 
+	-3, -87, -44, 135, 70, -44, -73, -127, 
+	-76, 6, -31, -35, -73, -1, -19, -81, 
+	-182, -10, 89, -187, 31, 72, 68, 10, 
+	-154, 9, 23, 42, -188, 11, -118, -21, 
+	-110, -114, -20, 57, -41, -30, -92, -165, 
+	-18, -54, 6, -16, 40, -17, -30, 4, 
+	52, -92, 30, 47, -22, 16, -106, -29, 
+	1, -28, 49, -58, 48, -20, 10, -27, 
+	8, -24, 79, -62, -32, 50, -51, 49, 
+	-95, -90, -44, -44, -89, -8, -29, -26, 
+	42, -10, 7, -34, 20, -20, 34, -14, 
+	2, -113, -52, -1, -1, 79, 62, 3, 
+	43, -52, -23, -33, 23, 74, -92, -68, 
+	-74, -1, -79, -62, -9, 13, -7, -56, 
+	58, 148, -60, -131, 27, -124, 149, -92, 
+	51, 78, -70, -7, -12, 51, -91, 3, 
+	-87, 104, -119, 85, -50, 30, -55, 32, 
+	-83, -123, -83, -176, -22, -12, -38, -8, 
+	74, 295, -37, -100, -132, -91, 190, -34, 
+	50, 48, -40, -114, 143, -19, 8, 125, 
+	-123, 99, -20, 77, -51, 12, -49, 151, 
+	-121, 4, -31, -66, 1, 28, 87, 64, 
+	107, 259, 92, 10, -323, -128, -16, 64, 
+	174, 15, 34, -184, 112, -178, 4, 68, 
+	-99, 78, -14, -223, 24, -50, 44, 101, 
+	52, -32, -23, 133, -65, 25, -58, 46, 
+	28, -211, -40, 38, -14, -23, -102, 1, 
+	-38, -8, -63, -41, 31, -39, 39, -48, 
+	72, 5, 2, -10, -27, 56, -82, 67, 
+	-125, -97, -69, 71, -40, -1, 8, -40, 
+	44, -54, -48, -14, -101, -121, 63, -35, 
+	-6, -69, -33, -175, -125, -12, -35, -54, 
+	-49, -40, -25, -14, -60, 121, -80, -19, 
+	130, 43, 57, -73, 7, 55, 104, -9, 
+	125, 114, -34, 154, -140, -179, 76, -87, 
+	-9, -40, 18, -164, 79, -55, 152, -55, 
+	71, 25, -78, -74, 33, 154, -11, 173, 
+	104, 52, 76, -99, 36, 26, 3, 47, 
+	128, 96, -5, 32, -118, -162, 127, -47, 
+	55, 78, -2, -96, 132, 108, 156, -65, 
+	5, -46, -103, 63, 45, -32, 125, 97, 
+	131, -72, 163, -102, 81, 94, 11, 77, 
+	77, 61, 41, 117, 44, -4, 180, 89, 
+	34, 106, 104, -3, 60, 81, 145, 1, 
+	12, 95, 173, 79, -5, -67, 155, 20, 
+	-91, -53, -74, 82, -80, -64, -77, -80, 
+	-106, -179, 0, -58, -151, -37, -92, -29, 
+	-98, -16, -90, -134, -90, 32, 33, -130, 
+	135, -20, -64, -83, -82, 190, 8, -113, 
+	-15, -101, -33, 71, -30, -4, 80, -96, 
+	84, -2, 84, -8, -167, -28, -147, 33, 
+	-46, 5, 52, -175, -55, -123, 52, -48, 
+	38, -9, -111, -218, -77, 97, 16, -90, 
+	68, -39, 74, -72, 31, 106, 68, -40, 
+	59, 23, 87, 7, -76, -50, -136, 53, 
+	-18, -8, 92, -201, 143, -180, 123, 10, 
+	115, -29, -7, -90, -54, -51, 19, 24, 
+	54, 7, 31, 132, 35, -13, -5, -61, 
+	34, 200, 73, 13, 72, -75, 222, 27, 
+	19, 74, 14, -96, 79, -1, 93, 78, 
+	20, -20, -33, 85, -13, 155, -12, -28, 
+	86, 30, -34, -98, 57, 4, -75, -17, 
+	-85, 179, -15, 44, 105, -9, 40, 19, 
+	-64, 41, 12, 128, 12, 32, 52, 96, 
+	61, -75, 21, 70, 117, -193, 100, -17, 
+	-18, -19, -14, 145, -31, -76, -30, -125, 
+	-152, -26, -39, -53, -176, -129, -114, -84, 
+	-32, -36, -123, -188, -128, -55, -114, 9, 
+	-185, -3, -60, -125, -193, 199, -26, -99, 
+	52, -42, 25, -27, -3, 64, 51, -25, 
+	45, -230, 53, -4, -33, 76, -366, 32, 
+	-77, -29, 110, 31, -40, -204, 80, -44, 
+	11, -212, -45, -280, -24, -222, 51, -59, 
+	33, 17, 31, 224, 50, 31, 61, 93, 
+	-42, -313, 44, -90, -34, 42, -154, 51, 
+	-84, 20, -1, -17, 33, -33, 17, 18, 
+	148, -102, 46, -142, 35, 1, 92, -83, 
+	30, 90, -16, 189, 28, -12, -1, 15, 
+	-145, -83, -71, 136, -31, -11, -58, 77, 
+	-69, -59, -37, -50, -83, 41, -37, -55, 
+	61, 99, 57, -41, -48, 48, 59, 5, 
+	67, 1, 81, -19, 71, 32, -24, -42, 
+	-140, 71, -35, 117, 54, -36, -69, 46, 
+	23, 30, -27, 58, -41, 9, 26, 15, 
+	83, -48, -21, 76, 8, -169, 39, -18, 
+	48, 56, 12, 63, -69, -2, -87, -17, 
+	-199, -31, -100, -57, -28, 10, 121, 20, 
+	-73, 9, -14, -19, -119, 71, 46, 33, 
+	115, -94, 10, 95, -38, 19, -34, -57, 
+	8, 30, 31, 41, -52, -48, -6, 11, 
+	-133, -154, -31, -71, 36, 93, 27, 50, 
+	-73, -64, -39, 52, -72, 91, -94, 13, 
+	-72, -68, 33, -18, 14, 57, 6, -82, 
+	6, -11, -53, 35, -26, -19, -45, -31, 
+	-82, -33, -31, -28, 18, 21, -64, 68, 
+	-47, -10, -36, 21, -51, -110, -93, 18, 
+	-19, -75, 47, -30, -68, -86, -25, -84, 
+	3, -3, -66, 109, 10, -22, -52, -10, 
+	-18, 74, -18, 20, -87, -18, -118, 67, 
+	14, 66, 28, -85, 14, -39, -20, 24, 
+	67, 16, 0, -123, -19, -125, -63, 46, 
+	-55, 6, 44, 33, -23, -27, -12, 59, 
+	17, 124, -20, 44, -193, -19, -157, 31, 
+	16, 57, 4, -108, 32, -17, 52, 10, 
+	114, -3, -4, -142, 32, -64, 38, 54, 
+	17, 18, -51, -12, -49, -123, -144, -79, 
+	-219, -102, -67, -116, 48, 23, 54, -96, 
+	-91, 27, -128, -2, -129, 78, -71, -36, 
+	-94, -132, 54, 73, -22, 127, -12, -89, 
+	-1, -6, -42, -36, -25, -28, 66, -82, 
+	-108, -84, 73, -96, -10, 34, -119, -20, 
+	-105, 22, -28, 32, -43, -22, -43, -2, 
+	-49, -101, -54, -117, -34, -33, -49, -60, 
+	-3, 57, -16, -25, -2, -49, -22, 28, 
+	-34, -142, 14, -89, -80, 18, -117, 12, 
+	-50, 14, 33, 28, -77, -39, -101, -59, 
+	-39, -102, -26, -51, -15, -190, 45, 4, 
+	-6, 46, 29, -102, -36, -10, -18, 20, 
+	-16, -69, 52, 19, 6, 2, -101, 5, 
+	-30, -36, 20, 26, 40, -47, 35, -27, 
+	-23, -61, -2, 48, 67, -44, -94, 98, 
+	-33, -5, 77, -68, 56, 83, -66, -5, 
+	53, -99, 54, 35, 37, 28, -15, -8, 
+	-40, 61, 41, 78, 37, 98, 47, -24, 
+	-11, -108, -64, 104, 65, 53, 60, 78, 
+	-64, 10, -35, -26, -31, -50, -14, -106, 
+	-108, -53, -62, -219, -8, 10, 71, -100, 
+	-162, -88, -189, 6, -142, -50, -160, -72, 
+	-116, -119, 21, 20, -4, 30, -49, -175, 
+	3, -32, -27, -113, -14, 16, 45, -73, 
+	-71, -37, 28, -144, 11, 59, -13, -56, 
+	-146, 27, 21, 88, -38, -21, -13, 19, 
+	7, -89, -128, 53, 20, -207, -56, -77, 
+	22, -32, 31, -80, 4, 28, 17, -103, 
+	-51, 71, 28, -134, 53, 25, 72, 19, 
+	-48, -27, -21, 82, -67, 11, -2, -50, 
+	12, -127, -72, 75, -10, -62, -71, -45, 
+	-16, 37, -3, -102, 6, -10, 1, -64, 
+	-56, 130, 6, -121, 26, -7, 81, 1, 
+	-73, 76, -49, 65, -115, 142, 80, 5, 
+	-3, -100, -104, 158, 45, 90, -2, -10, 
+	-6, -58, -31, -44, -42, 43, -5, -183, 
+	-89, 102, -2, -199, 4, -5, 106, -59, 
+	-124, 116, -57, 16, -109, 75, -55, -32, 
+	-87, -161, -148, 146, -108, 126, -117, -77, 
+	-125, -93, -119, -42, -46, -112, -37, 67, 
+	-65, 42, -43, -103, -33, -82, -109, -114, 
+	25, -77, -119, -64, -52, -213, -46, 12, 
+	-41, 8, -27, -135, -63, -90, -54, 67, 
+	-44, -108, -11, -107, -20, -69, -1, 7, 
+	-65, -51, 53, -52, -38, -115, 79, 17, 
+	-20, -63, -7, -46, -48, -36, -27, -50, 
+	-14, 53, -21, -44, -41, -98, -68, 18, 
+	7, -37, 40, -118, -35, 2, -77, -16, 
+	-5, 97, -1, 24, 12, -15, 126, 28, 
+	7, 13, -79, -6, -48, 44, 63, 24, 
+	-2, -10, -43, 109, 3, -10, -67, 14, 
+	-9, -18, 32, -86, 5, -69, -46, -12, 
+	13, 85, -86, -97, -159, -90, 143, -25, 
+	65, 29, -95, -9, 29, -11, 19, 16, 
+	31, 20, -88, -3, -53, 55, 65, 95, 
+	-43, -6, 38, -85, 30, 25, 42, -91, 
+	91, 42, 30, 21, -209, -119, -75, -59, 
+	-21, 2, 14, -173, 35, -117, 104, 56, 
+	18, -28, -135, -54, -35, 48, -19, 28, 
+	-49, -42, -25, 88, -29, -83, 40, 29, 
+	-72, -128, -36, 50, -62, -15, -12, -47, 
+	-34, -41, -69, -46, -95, -116, -91, -113, 
+	-22, 22, -41, -62, -109, 39, -38, -8, 
+	-16, -23, 4, -62, -41, -42, 8, -45, 
+	114, 23, -55, 9, -123, -68, -10, -11, 
+	-41, -55, -69, -68, 58, -75, -40, -34, 
+	74, -48, -13, -10, -68, -12, -11, 28, 
+	6, -10, -10, -67, -46, 16, -60, -10, 
+	59, 147, -89, 40, -137, -75, 62, -52, 
+	13, -1, -86, -73, 102, -94, 123, -7, 
+	101, 35, -10, -5, 74, 38, -18, 57, 
+	-22, -31, -6, -25, 7, -27, -56, -35, 
+	83, -27, 52, 65, 8, -20, 136, -40, 
+	16, 38, 22, 52, 34, 61, 93, -19, 
+	-75, 10, -59, 29, -32, 41, -4, 28, 
+	-9, -66, 95, -85, 35, -28, 54, 45, 
+	17, -144, 48, 22, 121, 68, -11, -28, 
+	-66, 30, -38, 133, -5, 6, 40, 12, 
+	4, -85, -23, 31, 28, -32, 55, -19, 
+	29, 51, 12, -220, 83, 42, 188, 95, 
+	129, -40, -1, -11, -27, 10, -100, 50, 
+	34, -28, 65, -67, 146, -129, 8, 6, 
+	171, -90, 82, -36, 62, -82, 75, 44, 
+	12, 112, -6, 57, -35, 118, 8, 68, 
+	72, -242, 25, 107, -52, -65, -48, 26, 
+	70, 0, 11, -94, 90, -34, 94, -30, 
+	85, 76, 98, 10, 2, 91, -15, 9, 
+	27, 2, -48, 89, -79, 45, 56, -75, 
+	-24, -183, -11, -51, 79, -5, 43, -12, 
+	-100, -114, -8, 1, -42, 86, -48, 36, 
+	-121, -1, 23, 47, -59, 105, -100, -179, 
+	26, -51, -46, -19, -111, 29, 48, -164, 
+	-29, -19, 93, -84, 191, 165, 84, 90, 
+	-119, -35, 106, 118, -10, 93, 52, -3, 
+	32, -193, -153, 92, -5, -35, -103, -228, 
+	12, 76, 7, -36, -19, 16, 69, -3, 
+	-34, -35, 61, -97, 75, 136, 7, 82, 
+	-117, -38, 37, 99, -93, -2, 28, -47, 
+	94, -190, 6, -36, 32, -32, -32, -160, 
+	88, 37, 84, -216, 96, 131, 214, 128, 
+	266, -353, 239, 10, -89, -46, -123, 132, 
+	0, 23, 123, -76, 147, -4, 159, -19, 
+	185, -177, 53, -15, 173, 89, 14, -25, 
+	35, 74, -12, 150, -7, 39, -32, 117, 
+	-18, -302, 20, -17, -74, -19, 26, 29, 
+	-114, -25, -11, -92, -30, 147, 16, -3, 
+	159, -10, 133, 96, 11, 265, -22, -169, 
+	-100, -6, -92, 174, -163, -112, -28, -31, 
+	78, -148, -27, -118, -114, -77, -32, -13, 
+	-181, -57, -10, -105, -248, 37, -205, -29, 
+	-76, -87, 59, -6, -83, 162, 102, -134, 
+	-44, -11, 3, -67, 3, 70, 76, -120, 
+	6, -144, 60, -87, -3, 31, -160, 62, 
+	-88, -26, 55, -34, -41, -114, 78, -109, 
+	106, -279, -251, -93, -59, -43, -1, -217, 
+	62, 24, 43, -79, 73, 53, 138, 49, 
+	-46, -296, 66, -5, 81, 14, -152, 74, 
+	-63, 13, 40, -23, -66, 10, 53, -72, 
+	106, -156, 68, -53, 7, -111, -69, -206, 
+	97, -12, 57, -4, 60, 142, 28, 40, 
+	19, -74, 58, -121, 11, 103, 175, 108, 
+	-100, 139, 90, 4, -65, 139, 124, -103, 
+	184, -167, 34, 92, 94, 98, -18, -206, 
+	-61, 81, -50, 144, -217, -100, -173, -61, 
+	-131, 37, -144, -217, -50, -9, 120, -11, 
+	-167, -116, -75, -1, -108, 77, -87, -25, 
+	-12, -118, 32, 121, -74, 137, -9, -206, 
+	-82, -51, -89, 36, -141, 6, 16, -221, 
+	-15, -84, -3, -83, -21, -29, -141, -5, 
+	-46, -115, 11, -73, 28, -128, 8, -40, 
+	-84, -206, -102, -38, -81, 33, 26, -110, 
+	19, -92, -16, -161, -9, 36, 80, -102, 
+	26, -42, 32, -50, -37, -69, -41, 58, 
+	-62, 15, 75, -117, -32, -39, 43, -46, 
+	19, -190, -174, -102, -30, -264, -93, -126, 
+	-34, 36, 50, 47, -39, 55, 89, -17, 
+	2, -60, 53, -72, 123, 91, -21, 21, 
+	-31, 68, 76, 34, 3, 14, -46, -18, 
+	89, -43, -18, -5, 23, 3, -23, -126, 
+	-121, 5, -52, 60, 27, -38, -81, 22, 
+	31, 97, -51, -119, 46, 16, 130, -56, 
+	-89, -5, -53, 80, -126, 81, -38, -18, 
+	-15, -17, -3, 67, -43, 94, 8, 56, 
+	-17, -60, -90, 7, -50, -27, -11, -73, 
+	12, 9, -101, -34, -87, -135, -60, 22, 
+	-22, -3, -59, -119, 32, -83, -76, -1, 
+	-8, -34, -23, -92, -37, 43, -8, -3, 
+	-26, -34, -30, -45, 32, -17, 20, 19, 
+	75, 2, -5, -14, -84, -56, -142, -19, 
+	-16, -26, -29, -88, -11, -122, -35, -99, 
+	-19, -5, -144, -111, -32, -101, -77, 4, 
+	-26, -84, -1, -86, 38, -27, -21, -37, 
+	62, 20, -23, -67, -74, 15, -108, 14, 
+	19, 7, 63, -52, 61, -132, -37, -20, 
+	41, -34, -111, -59, -89, -175, 86, -79, 
+	-77, -9, 49, 2, -7, 59, 29, 67, 
+	53, 84, -17, -24, 12, 39, 4, -36, 
+	54, -17, -9, 7, 36, 13, 29, 63, 
+	18, 90, 115, -6, -70, -59, -57, 12, 
+	-153, -8, 3, -38, 40, -57, 53, -5, 
+	40, 210, -35, -44, -119, -35, 20, -29, 
+	57, 2, 2, -34, 21, -109, 7, -10, 
+	-46, 46, -50, -34, -65, -59, -79, 116, 
+	-39, -38, 78, -41, 32, -2, 28, -15, 
+	90, 106, -67, -2, -178, -135, -27, 65, 
+	137, 87, 17, -226, 131, -87, 37, 22, 
+	111, -19, -14, -151, 19, -80, -89, 169, 
+	36, -4, -38, -52, 20, -2, 3, 25, 
+	21, 59, 6, 51, -168, -97, -81, 6, 
+	43, 50, 44, -106, 147, -58, 23, -22, 
+	22, 11, -4, -100, -65, -64, 44, 129, 
+	-32, 14, -26, -45, 26, 52, 23, -56, 
+	32, -53, 20, 13, -112, -55, -120, 56, 
+	-24, -14, 56, -54, -4, -103, -3, -14, 
+	-114, 24, -39, -160, -78, -57, 29, 72, 
+	-23, 35, -12, 9, 22, 70, 49, 91, 
+	-11, -4, 63, 81, -74, -34, -38, -20, 
+	3, 58, 64, -108, 72, -92, -21, -15, 
+	-66, 80, 91, -59, -81, -38, 11, 84, 
+	-32, 2, -91, -135, -40, -141, -68, -55, 
+	-12, 84, -146, -98, -109, -92, 111, -122, 
+	11, 79, -69, -53, -11, -4, -78, 22, 
+	-161, -39, -60, -20, -114, -53, 73, -31, 
+	39, 11, -50, -207, -8, 71, 152, 62, 
+	162, -86, 95, 31, -109, -59, -225, 16, 
+	25, -3, 36, -236, 53, -172, 113, -71, 
+	97, -26, -32, -207, -4, -30, 6, 41, 
+	25, 42, -6, 10, 3, 52, 235, -9, 
+	150, -332, 192, 19, -96, -93, -87, 73, 
+	-13, -45, 13, -164, 10, 36, 105, -46, 
+	81, -91, -19, -100, -2, 140, -85, -44, 
+	-5, 7, 39, 88, -66, -21, 106, 17, 
+	44, -380, 227, -94, 14, -46, 0, 76, 
+	-164, 52, 13, -38, -101, 47, 51, -91, 
+	84, -76, 63, 5, 2, 148, -57, -136, 
+	5, -41, -38, 74, -79, -35, 53, -95, 
+	-37, -60, 106, -120, 28, 121, 69, 2, 
+	-102, -5, -8, 64, -28, 42, -16, -42, 
+	-26, -68, -32, -23, -40, 68, -31, -137, 
+	66, 3, -21, -81, -14, 41, 18, 57, 
+	94, 184, -20, 117, -57, -99, -60, -54, 
+	95, 27, -37, -21, 110, -172, 103, 20, 
+	57, -2, -15, -117, 86, -123, 13, 140, 
+	1, -46, 78, -87, 11, 8, 81, 91, 
+	138, -180, 120, 77, -94, -96, -41, 22, 
+	26, 11, 64, -94, 83, 32, 200, -31, 
+	123, -30, -109, 19, 79, 83, -87, 48, 
+	10, -9, 3, 76, 10, 36, 4, -81, 
+	-105, -193, 32, -39, -140, -36, 48, -9, 
+	-152, 53, -22, -108, -84, 67, 102, -83, 
+	92, -66, -23, 7, -34, 168, -50, -300, 
+	29, -49, -116, 51, -63, -76, 76, -91, 
+	94, -56, -12, -291, -82, -144, 27, -80, 
+	-78, 4, -54, -112, 13, -7, -107, -51, 
+	85, -96, -64, 31, -33, 167, -157, -280, 
+	-87, -21, -31, -58, -16, 57, 52, 18, 
+	164, -16, 47, -16, -33, -31, 1, -12, 
+	40, 0, 54, -23, 56, 9, 17, -1, 
+	40, -24, -100, -84, -45, 51, -100, -3, 
+	48, 54, 28, -70, 46, 96, -9, 80, 
+	122, -88, 10, 142, -24, -31, 55, -31, 
+	8, 109, 58, -29, 95, 43, 227, 8, 
+	63, -33, -55, 41, 27, 39, 15, 23, 
+	-59, -51, 8, 79, 53, -31, -89, 10, 
+	-156, -17, -60, -52, -62, -50, 48, -71, 
+	-59, 121, 21, -85, -86, 66, 64, -128, 
+	-3, 16, 47, 67, -31, 145, -58, -60, 
+	-38, -84, -99, 27, -42, -89, 7, -91, 
+	103, 46, 23, -117, -128, -108, 13, -64, 
+	25, -16, -83, -110, -33, 46, 46, -81, 
+	-111, -73, -17, 4, -87, 136, -46, -3, 
+	-59, -15, -74, -107, -72, 14, -4, -47, 
+	83, 16, -39, -16, -158, -151, 6, -16, 
+	49, -21, -64, -228, 30, -176, 72, -101, 
+	20, -41, -150, -114, -23, -25, -24, 25, 
+	41, -76, 72, -118, 2, 77, 58, -15, 
+	94, 93, 1, 66, -150, -123, -6, 30, 
+	-14, -18, 16, -128, 36, -36, 149, -34, 
+	-13, 4, -184, -88, 93, -2, -25, 45, 
+	7, -7, 0, 134, 59, -35, -132, 41, 
+	8, 128, -104, -67, 26, -48, 45, 28, 
+	-49, 106, -33, -100, -14, 35, 9, -22, 
+	92, 32, 80, 83, -15, 87, -75, -55, 
+	-105, 8, -42, 38, 4, -29, -77, -43, 
+	-39, 17, -109, -45, -72, -19, 23, -33, 
+	-6, 7, -53, -30, -6, -25, -58, -100, 
+	-21, 79, -16, -101, -61, 49, -100, -22, 
+	-69, -69, -86, -103, 50, -10, 32, -9, 
+	114, 107, 34, 4, -175, -225, -37, -40, 
+	26, -26, 52, -235, 20, -189, 116, -41, 
+	104, 13, -74, -211, -20, -41, -109, 108, 
+	-41, -48, 25, -123, 58, 76, 28, 65, 
+	139, 92, -5, 47, -333, -208, 89, -26, 
+	45, 10, 41, -282, 71, -11, 96, -15, 
+	7, 25, -108, -83, 39, 60, 33, 71, 
+	49, 6, 52, -115, 40, 10, -79, -23, 
+	61, 40, -2, 38, -70, -159, 170, 70, 
+	61, -6, -2, -157, 52, 29, 126, 75, 
+	9, -78, -51, 93, 5, 18, 48, 80, 
+	-28, 113, -59, 160, 21, 21, -78, 40, 
+	-6, 37, -83, 23, -198, -147, -157, -26, 
+	48, -73, -18, -120, -18, -211, -51, -9, 
+	79, 79, 86, -202, -77, -37, -53, 38, 
+	52, -15, 7, 40, 56, -16, 47, -50, 
+	16, 49, 2, 64, -270, -135, -140, 9, 
+	84, -44, 66, -240, 46, -146, 19, -47, 
+	-15, 69, -120, -155, -93, -51, -57, 63, 
+	101, 32, 82, -65, 14, 82, 79, -17, 
+	164, -51, 91, 82, -192, -109, -53, 92, 
+	32, 76, 125, -223, 41, -107, 112, 30, 
+	93, -4, -46, -90, 7, -68, -45, 120, 
+	16, 82, 4, -55, 0, 76, -97, -30, 
+	123, -8, 42, 94, -185, -93, 96, 39, 
+	36, 61, 56, -145, 11, -35, 115, -40, 
+	39, -93, -76, 8, 57, 70, 29, 33, 
+	17, 43, -14, -19, -6, 8, -137, 16, 
+	-176, 36, -129, -10, -141, -109, 68, -15, 
+	-30, -43, -53, -33, -111, 56, 69, -17, 
+	3, -37, 23, 78, -25, 87, 76, -36, 
+	11, 9, -42, 40, -46, -28, -29, 32, 
+	57, 1, -28, 59, 105, 59, 67, -5, 
+	59, -48, -6, 110, 33, 34, 15, 53, 
+	-45, 90, 7, 30, 62, 17, 82, 30, 
+	-20, -62, -28, -47, 37, 39, -94, 16, 
+	-15, 80, 32, 60, 67, 55, 84, -52, 
+	-13, 4, -28, 93, 1, 32, -40, 31, 
+	-174, 104, -1, 82, -1, -145, -40, 14, 
+	-62, -65, -37, -109, 3, -54, -88, 68, 
+	-106, 117, -58, -38, 68, 97, 97, -12, 
+	-23, -7, 4, 151, -80, 37, -16, 18, 
+	-103, -9, 2, 51, 76, -268, 15, -3, 
+	24, -18, -34, -113, -5, 78, -36, -73, 
+	-41, 61, 31, -101, 42, 132, -19, 57, 
+	5, 27, -5, 135, -102, -104, -70, 51, 
+	-43, 12, -25, -90, -48, -310, 39, -56, 
+	6, 42, -81, -60, 95, 86, 28, 164, 
+	-86, 48, -45, -79, -243, -98, -136, 51, 
+	43, 35, 30, -40, -32, -140, -75, 66, 
+	57, 22, 108, -250, 41, -62, 32, 40, 
+	-45, -63, -12, -66, -14, -84, -116, -75, 
+	-86, -15, -33, -157, 43, 25, 12, -119, 
+	-18, 49, -71, 12, -118, 35, -49, -54, 
+	-211, -109, -25, 42, -1, 17, 28, 52, 
+	-80, -54, -52, -157, -79, -43, -107, -15, 
+	-35, -34, -113, -39, 46, -57, 33, 20, 
+	-5, 8, -56, -40, -10, -57, -14, -61, 
+	-139, -17, -24, 82, -26, -103, 11, 11, 
+	-10, -24, -41, -169, -23, -19, 47, 38, 
+	23, 120, -42, 57, -98, -76, 142, -12, 
+	66, 108, 0, -133, 48, -167, -15, 53, 
+	-80, 17, -43, -96, -25, -164, 32, 14, 
+	32, -29, -8, -143, 0, 71, 27, -76, 
+	155, 138, 46, 60, -340, -124, -49, -4, 
+	6, 26, 94, -257, 66, -159, 47, -1, 
+	-59, -4, -227, -223, -38, -144, -88, 78, 
+	37, 47, 63, -208, 15, 56, -107, -7, 
+	40, -26, 32, 17, -235, -208, -52, 79, 
+	-17, -29, 38, -124, -17, 94, 84, 16, 
+	-15, -97, 41, -26, 59, -78, 28, -25, 
+	11, -121, -75, -5, 70, -47, 36, -2, 
+	9, 161, -79, 35, 8, -27, 165, 0, 
+	31, 15, -68, -1, 84, 53, -21, 97, 
+	-241, 80, -72, 91, -127, 26, -23, 12, 
+	48, -89, 12, -147, 49, 28, 38, -101, 
+	142, 200, 12, 54, -179, -96, -35, 26, 
+	5, 31, 63, -171, 66, -98, 96, -3, 
+	-29, -30, -154, -150, 13, -126, -55, 34, 
+	61, 100, 8, -298, 30, 126, 97, -33, 
+	79, 110, 77, 39, -82, -45, -124, -16, 
+	30, -44, 69, -151, 29, -7, 123, -17, 
+	32, -68, -136, -17, 51, -77, -46, 59, 
+	94, 6, 33, -173, 38, 26, -28, -90, 
+	52, -37, -15, 44, -181, -72, 89, 36, 
+	0, 40, 86, -117, 4, 97, 72, -44, 
+	39, -117, -102, 140, 74, 52, 12, 51, 
+	32, 56, -19, -27, 58, 14, -199, 88, 
+	-108, 80, -148, -2, -145, 3, -8, -52, 
+	-81, 20, 2, -27, -69, 113, -105, 27, 
+	-14, -95, 100, 121, -24, -46, -31, -137, 
+	74, -42, -6, -230, 51, 105, -18, -9, 
+	142, -49, -4, 110, -30, -26, -63, -5, 
+	57, 36, 97, -130, 73, -28, 155, -37, 
+	45, -96, -102, -43, 71, -113, 16, 131, 
+	32, 23, 100, -270, 41, 47, -93, -80, 
+	16, -174, 28, 13, -21, 18, -13, 17, 
+	-62, 112, 18, 11, 19, -17, 83, -40, 
+	-14, -98, -184, 2, 34, -55, -52, 72, 
+	78, 19, -34, -145, -5, 66, -93, 12, 
+	-85, 0, 30, 31, 34, 26, 19, 69, 
+	-67, 97, -2, -104, -18, 56, 45, -17, 
+	-6, -187, -34, 138, -19, -83, 6, 40, 
+	0, 15, 10, 29, -13, 8, -191, 55, 
+	-139, 185, -96, 13, -61, -42, 68, 30, 
+	-87, -41, -30, -21, -139, 111, -76, 56, 
+	35, -124, 72, 154, -3, -86, -15, 30, 
+	37, 69, 5, 84, -31, -86, -117, 89, 
+	-172, 52, -77, 57, 5, 118, -3, -119, 
+	-91, -122, -107, 134, -93, 59, 114, -49, 
+	169, -30, 145, 23, 22, -53, 35, -70, 
+	-21, -66, 20, -97, -27, -7, 35, -56, 
+	-32, -70, -39, -11, -43, -49, -37, 1, 
+	-130, 68, 21, -70, -82, 54, -25, 40, 
+	-10, -186, -149, 17, -61, -84, -60, -95, 
+	-25, -45, 20, -5, -25, 13, -12, 26, 
+	-153, 49, 21, -124, 91, 46, 82, 75, 
+	-107, 3, -48, 48, -134, -45, -36, -13, 
+	-30, -43, -37, 90, -72, -112, -30, -212, 
+	-90, 50, -30, 10, 2, -44, -31, 45, 
+	-147, 160, -38, -132, 70, 30, 11, 32, 
+	58, -60, -56, 144, 60, -21, -135, 15, 
+	21, 31, 41, -25, -57, -182, 1, 64, 
+	-82, 41, -28, 86, -7, -36, -227, 63, 
+	-87, 125, -94, 86, -19, -3, -87, 39, 
+	41, 11, -40, 12, 83, -7, -38, 90, 
+	95, 111, 57, -10, -50, -126, 52, -4, 
+	22, -84, 17, 93, -31, -66, -77, 62, 
+	-96, 178, 26, 52, 3, 22, 45, -38, 
+	40, 65, -84, 45, -85, 32, -7, 50, 
+	101, 150, 99, 95, -8, 6, 22, -14, 
+	-7, -9, -48, 8, -14, 4, 7, 110, 
+	-11, 68, -20, -104, 50, -13, 89, 13, 
+	44, 27, -21, -23, -18, 20, 33, 8, 
+	36, 52, 20, 20, -35, -77, -104, -59, 
+	-8, 70, -31, 96, 27, -2, 20, 121, 
+	22, 56, -71, -42, -78, 13, 52, -13, 
+	38, -65, 25, 5, -24, -81, -65, 4, 
+	11, 67, 10, -82, -32, -41, -22, -8, 
+	-17, 11, -41, 37, 32, -37, 62, 71, 
+	6, 46, 6, 22, -78, -24, -117, -36, 
+	119, -17, 6, 32, 12, -59, 52, -9, 
+	-62, 45, 49, -140, -86, -11, 48, 63, 
+	100, -65, 78, -44, 70, 15, 44, -30, 
+	54, -84, 101, 11, -123, -21, -253, 11, 
+	68, 66, 131, -95, 37, -72, 23, 25, 
+	9, -12, 33, -185, -36, -37, 23, 58, 
+	90, 62, 102, 23, 88, 50, 41, 77, 
+	-3, -85, -70, 24, -197, -93, -160, 87, 
+	73, 67, -22, -275, 61, -172, 9, 27, 
+	-21, 77, -5, -135, 27, -16, 59, 51, 
+	-67, -39, 4, 27, -14, 66, -27, 123, 
+	28, -63, -11, 48, -125, -102, -31, 7, 
+	28, -67, -5, -110, 3, -105, 83, -26, 
+	78, 32, 42, -38, -4, 29, -109, 52, 
+	-1, 6, -12, 3, 20, -15, 7, 32, 
+	-32, -31, -3, -11, -85, -126, -27, 12, 
+	30, -41, 47, -176, -5, -82, 16, 85, 
+	-80, 76, -33, -65, -42, 9, -14, 65, 
+	23, -64, -43, -76, 24, 74, 35, -14, 
+	14, -89, -19, 73, -82, -38, -146, -4, 
+	1, 80, 78, -46, 10, -153, 74, 60, 
+	-132, -66, -11, -148, -39, 57, 22, -15, 
+	72, -59, 41, -43, 16, 71, 13, -50, 
+	-16, -145, 60, 34, 42, -65, -190, 38, 
+	-7, 47, 108, -65, -16, -164, -1, -23, 
+	-64, -132, 23, -108, -63, -150, -44, -72, 
+	57, 73, 17, 73, 52, 43, 47, 13, 
+	-65, -64, -12, 25, -100, -68, -35, 71, 
+	-50, 28, -29, -181, 16, -89, -21, 77, 
+	38, 26, 51, -12, 31, 53, -29, -11, 
+	4, -25, 4, -58, -81, -24, -58, 24, 
+	1, -105, -9, 11, -8, -86, 45, 33, 
+	-1, 49, 45, 2, 39, 76, -52, -1, 
+	7, 17, 15, 61, -24, 72, -10, -13, 
+	-48, 41, -33, -5, 1, 26, 107, -86, 
+	37, 23, -70, 12, -8, 41, 22, -40, 
+	2, 13, 81, -84, -6, 57, 2, 34, 
+	-119, -33, -90, -57, -59, -17, 17, 65, 
+	25, -36, -3, -109, 51, 61, 28, -209, 
+	-26, -178, 25, -11, 1, -35, -197, -8, 
+	-95, 10, 55, -35, -21, -89, 66, 29, 
+	-43, -183, -134, -134, 47, -36, -18, -47, 
+	37, -59, 78, -120, 76, -26, 28, 22, 
+	22, -342, 3, 0, -68, 51, -146, 44, 
+	16, -37, 103, -103, -26, 87, 34, 20, 
+	7, -180, 71, -27, 46, -86, 5, -55, 
+	13, 68, -9, 52, -33, 12, -45, 60, 
+	-97, -105, -30, -18, -152, -56, -105, 17, 
+	-3, -17, 20, -64, -50, 9, -129, 75, 
+	59, 10, 75, -60, -48, 40, -34, 10, 
+	78, -28, 26, 42, -8, 51, 64, 5, 
+	57, 97, 24, 11, 14, 29, 89, -49, 
+	26, -3, -3, 40, 64, 58, 4, 63, 
+	-45, -28, -115, 79, 33, 140, 0, 79, 
+	-14, 22, -16, -153, -4, 51, 31, -167, 
+	64, -89, 38, 73, -13, 78, 36, -9, 
+	-32, 0, 98, 11, 31, 27, 128, -11, 
+	53, -116, -133, 94, 28, 18, 44, -19, 
+	59, -32, 63, -133, -9, -28, 71, -200, 
+	-50, -203, 31, -37, -6, -11, 16, -33, 
+	-147, 59, -3, 2, -42, -7, 27, 8, 
+	30, -266, -195, -25, 9, 41, -25, -186, 
+	-12, 7, 12, -131, 27, -11, 152, -1, 
+	23, -246, 89, -123, 6, 35, -69, 44, 
+	-108, 61, 106, -3, -127, -10, -71, 23, 
+	-50, -270, 6, -15, -70, -36, -47, -176, 
+	0, 12, 26, 69, -51, 2, -171, -10, 
+	-203, -135, -95, -63, -82, -56, -87, -21, 
+	-35, -33, -14, -129, -104, -18, -224, 81, 
+	-14, -58, 29, -16, -48, 54, -39, 11, 
+	40, -46, 39, -29, -56, 48, 58, -1, 
+	125, 59, 17, 55, 42, -25, 64, 53, 
+	50, 4, 59, 11, 90, 88, 130, 17, 
+	94, -12, -159, 86, 35, 78, -57, 107, 
+	-27, -56, 20, -49, 38, 55, 26, -143, 
+	18, 35, -1, -65, 60, -23, 31, 54, 
+	-96, 20, 25, -41, 1, 27, 18, -60, 
+	-5, -118, -202, 22, -6, 80, -27, -43, 
+	23, -65, -68, -47, -56, -33, 34, -252, 
+	-69, -176, -69, -141, 37, 44, -34, -86, 
+	-107, -16, 4, -10, -90, -26, -5, -51, 
+	-105, -275, -169, -62, -15, 21, -37, -211, 
+	18, -49, 48, -100, -19, 12, 131, -116, 
+	-99, -321, 79, -218, 155, 81, -126, 3, 
+	-167, -52, 64, 27, -169, 1, -43, -78, 
+	-99, -242, -70, 54, 85, 45, -67, -152, 
+	-30, -6, -37, -24, -100, -63, -182, 38, 
+	-300, -369, -89, -114, -102, 44, -49, -1, 
+	-143, -74, 22, 62, -130, -20, -247, 10, 
+	15, -158, 91, -41, 53, -3, 75, -103, 
+	-1, 28, -40, -40, 32, 19, 100, -27, 
+	106, 27, -66, -17, -112, -100, -21, -34, 
+	21, -15, -21, -164, 23, -123, -38, 3, 
+	16, 6, 14, -36, 15, 116, -79, 0, 
+	58, 6, 35, -80, 45, 57, 46, 8, 
+	86, 30, 6, 40, -143, -120, -110, 33, 
+	90, -5, 58, -48, 56, -93, 115, 3, 
+	55, 39, -120, -53, -1, 40, -59, 83, 
+	79, -45, 16, -39, -21, -8, -64, -10, 
+	44, 20, -1, 14, -91, -95, 2, -32, 
+	0, 22, -39, -23, 23, 55, 107, -23, 
+	92, 2, 49, -14, 36, -11, 73, 38, 
+	11, -16, 49, 28, 41, 22, -97, -6, 
+	-108, -45, -53, 43, -54, 22, 72, 25, 
+	29, 53, -31, 48, -16, 36, -30, -19, 
+	-108, 69, 66, 25, -42, -45, 72, 18, 
+	8, 3, -34, 100, -73, -82, -152, 46, 
+	-170, 53, -110, 52, 63, 53, -60, -44, 
+	-27, -2, -53, 23, 10, -65, -68, -9, 
+	47, 126, 169, 32, -26, -89, -34, 30, 
+	4, -43, -47, -86, 21, 46, 72, 13, 
+	18, 60, 67, 17, -22, -18, -16, -29, 
+	-32, 5, 27, 75, 77, -43, 36, -28, 
+	12, -93, -93, 32, -16, 54, 34, 4, 
+	42, 44, 60, -4, -37, 4, -89, 0, 
+	25, 155, 38, 40, -32, -21, 91, 49, 
+	-14, 36, 36, 91, -36, -23, 94, 76, 
+	-6, 23, -39, 65, -40, -64, 18, 35, 
+	-42, -10, 28, -6, -72, -22, -199, 43, 
+	-143, 219, -154, 7, 10, -1, 116, 17, 
+	42, -43, -76, 130, -44, 94, -44, 20, 
+	-38, 49, 62, 98, 11, -138, 60, -3, 
+	-60, 4, 9, 10, 2, -29, -103, 4, 
+	-107, 97, -21, 19, 7, 78, 70, -21, 
+	73, 88, -13, 135, -54, 32, 9, 57, 
+	-2, 70, 48, 36, -33, -47, 148, -28, 
+	-42, -53, -67, -41, 10, -29, -12, 95, 
+	-121, 41, -22, -74, -54, -34, -70, -38, 
+	-12, 48, 21, -18, -13, -59, -61, 67, 
+	68, 20, 157, -87, 26, -133, -3, 47, 
+	27, -1, -4, -98, -71, -28, 14, 67, 
+	24, 144, -28, -4, 14, -31, -17, -14, 
+	-38, 15, -55, 42, -76, -16, 64, 31, 
+	3, 29, 13, 0, 29, -158, -6, 24, 
+	-60, 31, 43, -28, -64, -74, -185, 92, 
+	-81, 105, -126, -51, -21, -34, 62, -51, 
+	-22, -12, -61, 76, -13, -4, 40, -14, 
+	7, -6, 64, 14, 21, -232, 115, 76, 
+	-54, -3, 37, -78, 37, -11, -193, 57, 
+	-149, 97, -143, -35, -94, -52, 120, -27, 
+	54, 74, -33, -6, -5, -21, -47, 57, 
+	-66, 122, 26, 1, -65, -195, -6, 103, 
+	14, -56, -22, -58, 36, 63, 9, -59, 
+	-37, 115, 9, 51, -32, -9, 25, 31, 
+	40, 25, -18, 27, -33, -39, 14, 92, 
+	18, 50, -31, -32, -41, -171, 44, 116, 
+	76, 16, 9, -120, 58, 137, 15, -12, 
+	-21, -118, 22, 1, -176, -147, -204, 0, 
+	-5, 23, 80, -22, -95, -98, 112, 31, 
+	153, -120, 2, -255, 101, -71, 50, -20, 
+	-7, -2, -29, -34, -60, -15, -133, -32, 
+	-92, 70, -3, 19, 19, 44, -2, -15, 
+	13, 51, -17, 38, 20, 41, -87, 48, 
+	-52, -9, 1, 9, 2, -150, 41, -3, 
+	-18, 3, -33, -123, 40, -21, -142, -44, 
+	-16, 195, -95, 34, -94, -81, 56, 56, 
+	73, 36, 14, -49, 11, 10, 37, 87, 
+	-86, 65, -9, 50, 8, -219, -14, 65, 
+	55, -18, 7, -162, 92, 51, -140, 14, 
+	-22, 231, -126, 90, -223, -111, 15, 40, 
+	32, 68, 48, -156, 113, -68, 31, 38, 
+	62, -30, -23, -31, 36, -106, 11, 91, 
+	77, 95, -49, -110, 17, 69, -72, 20, 
+	28, -137, -74, 47, -169, -167, -149, 91, 
+	-41, 22, 52, -175, 28, -95, 66, -5, 
+	44, -104, 29, -3, 98, 15, -106, 32, 
+	2, 53, -21, -11, -52, 62, -155, -81, 
+	-92, -173, -52, 13, -242, -166, 81, -10, 
+	-120, 73, -20, -156, -79, 45, 46, -15, 
+	98, -101, -19, 35, 77, 106, -108, -161, 
+	-53, -46, -33, -67, -5, 55, -116, 20, 
+	28, 198, -3, 27, -53, -28, 61, 63, 
+	133, 39, 27, -11, 164, -82, 81, 109, 
+	-14, 54, -55, -68, 23, -149, -55, 155, 
+	67, 45, 0, -182, 97, 19, -163, 50, 
+	22, 246, -83, 116, -94, -28, -46, 42, 
+	39, 34, 89, -13, 86, -114, 49, 93, 
+	67, 61, -79, -43, 67, -280, 17, 177, 
+	51, 26, 86, -150, 36, 46, -156, -54, 
+	14, 54, -84, 93, -100, -34, 35, 13, 
+	5, 40, 30, -4, 20, 96, 131, 70, 
+	54, -96, -132, 13, 108, -30, -79, 126, 
+	57, 5, 73, -48, -47, 30, -217, 50, 
+	-62, -107, -103, -65, -54, -34, 101, 3, 
+	-28, 1, 6, -35, -65, 81, 96, -46, 
+	19, -117, -14, 77, 98, 62, -99, -84, 
+	-33, 16, -103, 68, -81, -125, -110, 16, 
+	-165, -112, -78, -220, -125, 10, -7, -155, 
+	-86, -104, -86, -43, -116, 141, -112, -45, 
+	-83, -102, 47, 50, -112, 154, -58, -51, 
+	87, 15, -11, -50, 65, 92, 22, 71, 
+	30, 48, 32, 20, -19, -12, 55, 10, 
+	-36, 43, 40, -15, 19, 56, 30, 46, 
+	85, 52, 38, 6, 105, 21, 26, -1, 
+	66, -6, -2, 7, 65, 16, 104, -26, 
+	11, -17, 88, 74, 85, 73, 45, 58, 
+	-9, 41, 48, -6, -62, 88, 74, 81, 
+	41, -62, 35, -32, 39, 103, 17, -28, 
+	144, 73, 62, -13, 104, 26, 101, 35, 
+	8, 55, 77, 37, 97, 32, 51, 21, 
+	-41, 47, 70, -23, -30, 94, 126, -10, 
+	158, -118, -38, 37, 88, 52, -1, -46, 
+	45, 22, 103, 72, 16, -7, 48, 56, 
+	1, 5, 19, -15, 43, 93, 54, -28, 
+	-90, 22, 9, 13, -60, 136, 53, -46, 
+	135, -23, 69, 80, 16, 153, 66, 15, 
+	105, -45, 114, 100, 26, 63, 50, 0, 
+	-15, -49, 87, 19, 62, 32, 38, -51, 
+	29, 68, 26, 16, -44, 75, 111, 3, 
+	21, 1, 53, 92, 28, 270, -33, 62, 
+	7, 53, 18, -2, 34, -34, -33, -19, 
+	-41, -88, -42, -129, -23, 75, 78, -34, 
+	-80, 65, -55, 152, 17, 118, -13, -34, 
+	-42, -89, 8, 108, 4, 63, 75, -28, 
+	-27, -29, 73, 22, 71, 1, 22, -68, 
+	15, 69, -54, -58, 62, 84, 21, -76, 
+	-86, 85, -101, 134, -31, 113, -93, -55, 
+	-135, -46, -20, 31, -6, 107, 7, -21, 
+	44, -50, 61, -48, 59, 41, -97, -107, 
+	-70, 23, 49, -125, 116, 78, 73, 3, 
+	-190, 81, -2, 34, -160, 85, 41, -56, 
+	-2, -161, -36, 64, 21, 24, -38, -15, 
+	7, 15, 70, -7, 0, -32, 0, -82, 
+	-27, 46, -27, -150, 60, 59, 65, -33, 
+	-135, 20, -63, 21, -211, 118, -118, -111, 
+	-21, -150, 41, 91, 6, 60, -68, -90, 
+	-15, 35, 30, 63, -68, -56, 52, -143, 
+	20, -194, -50, -123, 16, -17, -41, -61, 
+	-111, -19, -35, -26, -127, -31, -26, -91, 
+	33, -239, -91, -4, 9, 151, -44, -53, 
+	-112, -63, -66, -10, -1, -25, -73, -37, 
+	-117, 173, -94, -100, 83, -15, 41, 44, 
+	32, -93, -150, 112, 7, -54, -156, 10, 
+	-162, -23, -86, 63, -41, -122, -87, -58, 
+	-156, -37, -62, -104, -23, -67, -112, -243, 
+	-220, 135, -141, -157, 52, -78, 73, -21, 
+	-39, -46, -181, 86, -75, -32, -61, -19, 
+	-195, -91, -219, 80, -28, -94, -82, -18, 
+	-136, -112, -85, -230, -62, -93, -71, -62, 
+	-108, 17, -162, -210, 38, 7, 124, -100, 
+	-44, -59, -195, 24, -64, -37, -157, -9, 
+	-119, -123, -190, 61, -8, -20, -36, -128, 
+	-50, -88, -60, -146, -56, -83, -74, -91, 
+	-12, 44, -91, -10, -2, 14, 56, -10, 
+	-51, -72, -142, 17, -4, -37, 26, -37, 
+	-22, -55, -102, 11, -16, -70, -136, -96, 
+	-30, -79, -57, -75, -34, -91, -67, -124, 
+	-23, -53, -72, -58, -41, -34, -59, -44, 
+	-78, -81, -147, 13, -8, -56, -14, -58, 
+	13, -127, -229, -54, -43, 39, -100, -103, 
+	-140, -16, -50, -56, -5, -51, -76, 22, 
+	-30, -28, -218, 68, -201, -265, -177, -70, 
+	41, -66, -66, -313, 39, -290, -75, 31, 
+	-137, 28, 24, -282, -70, -137, -26, 123, 
+	-109, -23, -70, -31, -26, -61, -93, 13, 
+	-56, 128, -170, 36, -165, -271, -35, -36, 
+	33, 41, -144, -324, 89, -225, -44, 68, 
+	-250, 62, -22, -241, -65, -164, -57, 5, 
+	-123, -72, -46, -12, -28, -46, -19, 19, 
+	49, 60, -56, 45, -278, -199, -30, -47, 
+	49, 49, -14, -221, 97, -289, 3, -8, 
+	-119, 42, -54, -220, -2, -126, -22, 46, 
+	-11, -70, -37, -16, 9, 12, -13, 114, 
+	10, 117, -46, 58, -139, -222, 6, 45, 
+	18, -43, -30, -224, 109, -156, 63, 1, 
+	107, 70, 80, -52, -8, -135, -6, 71, 
+	-104, -88, -84, 115, 19, -74, -64, 26, 
+	-58, 57, -117, 66, -75, -131, 74, 2, 
+	10, -58, -107, -28, 6, -61, -54, 51, 
+	44, 168, 38, -63, -30, 33, -3, 22, 
+	28, -1, 0, 11, 64, 12, 43, 22, 
+	-47, -27, 10, -22, -24, -94, -60, -43, 
+	88, 73, 16, 8, 56, 51, 2, 17, 
+	-76, 65, 60, -30, -12, 39, 45, -6, 
+	20, 24, -1, 8, 83, -31, 13, 25, 
+	88, -37, 53, -12, -102, -41, -79, 40, 
+	9, 7, 62, -68, 143, 22, 12, 73, 
+	-71, 52, 67, -118, -50, 57, 57, 70, 
+	36, 28, 12, -12, 19, -4, 0, 71, 
+	46, 59, -10, 133, -16, -45, -69, 19, 
+	30, -47, 71, -31, 53, -68, 90, 75, 
+	33, 68, 94, -120, -5, -142, 88, 90, 
+	37, -19, 64, 28, 61, -14, -86, 160, 
+	-3, -9, -29, 24, 3, -64, -10, 118, 
+	63, -65, -3, 17, -54, 12, -24, 25, 
+	68, 145, 75, -29, -4, -1, 64, 44, 
+	-55, 40, -11, 118, 42, -60, -97, 71, 
+	-55, -18, -64, 28, 11, 54, 8, -89, 
+	85, -54, -20, 89, -18, -12, -81, 76, 
+	-159, 232, 175, -103, -6, -17, 137, 128, 
+	-42, 45, 19, -7, 54, -42, 43, 14, 
+	-45, 20, -19, -48, -20, -55, -41, -9, 
+	-31, 37, -76, -9, -66, 25, 16, -15, 
+	17, -11, -22, -30, 13, -7, -28, -86, 
+	-56, -6, -60, -76, -76, -7, -37, -4, 
+	-34, -43, 9, -81, 23, -83, 17, 2, 
+	-63, -106, -22, -6, -50, -24, -57, -74, 
+	-33, -87, 14, -64, -10, 2, -71, 9, 
+	16, -3, -67, -56, -68, -43, -6, -5, 
+	-85, -95, -75, -30, -1, -84, -89, -35, 
+	-54, -60, -56, -121, -15, -62, -28, -53, 
+	7, 12, -95, -65, -53, -19, -15, -48, 
+	-46, -28, -12, -107, -38, -46, -75, -109, 
+	-14, -14, -29, -13, -64, -57, -4, -18, 
+	-13, -39, -46, 14, -18, -53, -49, 18, 
+	-45, -33, -116, -27, -61, -33, -37, -20, 
+	-14, -66, -31, -105, -47, -51, -6, -23, 
+	-2, 29, 14, 18, -32, -99, -47, -42, 
+	41, -46, 4, -26, 32, 1, 1, -8, 
+	3, -73, -103, -85, 7, -1, -75, -75, 
+	-71, -38, -17, 69, -61, -3, -46, -59, 
+	-14, 10, -30, 37, -129, -60, 4, 5, 
+	-40, -37, -85, -44, -29, -21, 10, -69, 
+	-49, 24, -48, -36, 41, -24, -7, -1, 
+	-24, 1, 14, -30, -43, -12, -12, -71, 
+	-6, -30, -23, -45, -27, -31, -81, -41, 
+	-2, 1, -58, -75, -21, -72, -33, -35, 
+	-35, -16, 1, -74, -1, -49, 2, -14, 
+	-58, -61, -38, -109, -29, -64, -6, -48, 
+	34, -102, -61, -66, -105, -31, -91, -45, 
+	-71, -6, -79, -25, -72, -40, -93, -45, 
+	-2, -36, -51, -32, -24, -48, -54, -28, 
+	16, -73, 26, -86, 30, 29, 11, -68, 
+	-41, -12, -31, 8, -56, -52, -10, -12, 
+	-88, -21, -36, -59, -23, -49, -59, -30, 
+	19, 6, -5, -37, 41, -38, -56, 10, 
+	30, -5, -55, -66, 27, 22, -93, -45, 
+	-76, -21, -70, -11, -6, -1, -34, -19, 
+	-37, 29, -43, -1, -11, -43, 2, -36, 
+	-69, -56, 1, -81, 4, 5, -3, 16, 
+	-3, 0, -37, 45, -14, -53, -78, -16, 
+	-82, -67, -30, -34, 27, 9, 15, -72, 
+	-53, 38, -74, 47, -22, 35, -65, -41, 
+	-36, -55, 2, 100, 24, 62, -43, -65, 
+	-75, 13, -46, -77, -13, -3, 21, -3, 
+	-41, -66, -16, -85, -77, -71, -21, -58, 
+	-7, -21, 0, -102, -53, -65, -21, -56, 
+	-55, -10, -36, -59, -41, -4, -54, -107, 
+	-41, -90, 10, -52, -55, -4, -47, 6, 
+	-56, -28, 37, -68, -59, -63, 12, -19, 
+	-83, -65, -44, -27, -7, -36, 9, -46, 
+	-38, -84, 15, -38, -22, -51, -42, -43, 
+	-54, 2, 1, -83, -59, 13, -87, 50, 
+	-51, -21, 4, -42, -20, -80, 13, -42, 
+	13, -38, -49, -83, 22, -96, 10, -23, 
+	52, 20, -54, -107, 32, 26, -25, 24, 
+	-23, 33, 30, -74, 18, 5, -25, -37, 
+	-42, 30, -49, 17, -61, -4, -7, -53, 
+	11, 13, -32, -52, 68, -44, -85, -52, 
+	-101, 17, -22, 9, 30, -52, -27, 31, 
+	-67, 14, 5, 2, -59, -65, 6, -67, 
+	-74, -57, -76, 33, 40, 9, -2, -56, 
+	-36, -47, -32, -49, -62, -52, -22, -28, 
+	-94, -23, -34, -6, 23, 12, 6, 10, 
+	-34, -72, 10, -82, -79, -71, 28, -29, 
+	-5, -53, -6, -40, -91, -35, -6, -73, 
+	13, -7, -61, -4, -15, -76, -16, -15, 
+	-57, -81, -48, -99, -68, -24, 22, -54, 
+	-69, -53, -43, -3, 2, 16, -14, -73, 
+	-2, -47, 1, -14, -24, -36, -26, 19, 
+	-33, -47, 22, -60, 4, -29, 19, -77, 
+	43, -53, -106, -23, -45, 7, -51, -37, 
+	9, -4, 43, -35, 26, -41, 19, 33, 
+	30, -10, -58, -37, -46, -46, -114, 3, 
+	-18, -6, -85, -100, -9, -21, -73, -17, 
+	-31, -65, -63, -67, 14, -59, -49, 3, 
+	-43, -61, -45, -32, -52, -19, 13, 45, 
+	10, -24, -20, -9, 18, -52, -34, -59, 
+	-3, -44, 25, -39, 77, -73, -54, 5, 
+	9, 2, 2, -12, 20, -22, -33, 36, 
+	-71, -35, 1, 4, -33, -33, -54, -15, 
+	-83, -130, -48, -11, -16, -46, -88, -74, 
+	-60, -40, -53, -4, -82, -95, -102, -88, 
+	-134, -17, -38, -110, -37, -88, 61, -29, 
+	0, -50, 11, -116, -53, -17, 34, 6, 
+	-17, -70, 10, -15, -100, -88, -67, -31, 
+	-83, -3, -56, -70, -4, -57, -23, -14, 
+	-71, -59, -23, -7, 6, -123, -59, 23, 
+	27, -45, 12, 8, -25, -33, -21, -34, 
+	-14, -64, 63, -10, -77, -66, -45, -29, 
+	13, 5, -18, -53, -36, -29, -52, -5, 
+	41, -61, -32, 6, -7, 3, -66, 2, 
+	5, 16, -45, -1, -41, -32, -46, -48, 
+	-2, -40, -41, 6, 14, -43, -33, -48, 
+	-68, -16, 14, 22, -52, -59, -30, -73, 
+	31, -96, -59, -10, 25, -49, 29, -84, 
+	-60, -41, 42, -61, 14, -41, -30, -18, 
+	-83, -79, -51, -55, 29, -45, -82, -40, 
+	-60, -21, -52, -13, -27, -16, -28, -40, 
+	-13, -21, -1, -3, 7, 40, -31, 3, 
+	24, 59, -15, 23, 2, 19, 24, 0, 
+	-88, -22, -56, -119, -26, 31, -147, 10, 
+	20, -42, -12, -88, -30, -91, -119, -34, 
+	-104, -70, 3, -116, 9, 15, -98, -6, 
+	-7, -23, 72, -27, -15, -18, 116, -97, 
+	52, -65, 66, -35, -93, -3, -123, 24, 
+	-21, 1, 34, -152, 14, -122, -12, -34, 
+	-15, -82, 13, -33, 49, 154, -119, 54, 
+	-38, 70, 17, 81, -66, 2, -72, -39, 
+	75, -111, 55, 14, -32, -146, 105, -26, 
+	-84, -46, -40, -152, 10, 27, 122, -62, 
+	103, -123, -2, 63, 23, 154, 39, 62, 
+	-33, -71, 16, 4, -40, 20, -138, -65, 
+	-23, -23, -62, 60, -79, -100, 155, -14, 
+	7, -52, -68, 62, -8, 93, -48, -94, 
+	-97, -82, -17, 84, -31, 39, -4, -68, 
+	-14, 6, -9, -78, -19, 15, -134, -91, 
+	-64, 46, -77, 0, 28, 73, 175, 29, 
+	-10, -23, -47, 175, 21, 35, -56, -46, 
+	16, -136, -36, 122, 5, -77, 9, -132, 
+	5, -31, 0, -49, 12, 66, 61, 27, 
+	-42, -89, 53, 13, -115, -14, -166, -22, 
+	-15, -11, 63, -96, 4, -154, 10, 25, 
+	-38, -70, -56, -245, -34, -165, -59, 5, 
+	2, -94, 40, 10, 62, 52, 12, 105, 
+	-8, 28, 7, 8, -42, -68, -72, 84, 
+	-24, 12, 29, -111, 73, -150, 2, 71, 
+	-42, 82, 39, -124, -33, -82, 7, -55, 
+	-24, -46, -63, 139, 70, 23, -173, 50, 
+	3, 188, -29, 48, -258, -43, 0, 17, 
+	93, -9, 14, -81, -12, -118, -40, 92, 
+	-90, 148, 97, -114, 23, -180, -35, 119, 
+	-38, -65, 8, 31, 38, 8, -118, 26, 
+	4, 255, -111, 61, -93, -128, -26, -43, 
+	124, -73, -61, 24, 22, -76, 81, 100, 
+	75, 57, -77, -41, 67, -206, 29, 104, 
+	-32, -20, -48, -22, 34, -3, -138, -41, 
+	21, 75, -94, 6, -155, -125, -24, 9, 
+	-6, -22, 21, -114, -11, -95, 24, -50, 
+	64, 68, -1, -134, 12, 6, 15, 109, 
+	-4, -7, -18, -177, -9, 48, -17, -120, 
+	59, -4, 13, -73, -129, -67, -80, 43, 
+	-27, -41, 53, -24, -14, -43, 46, -48, 
+	11, -94, -123, -104, -78, -49, -32, 3, 
+	-24, 95, -27, -124, 47, 78, 17, 15, 
+	-26, -31, 31, -88, -29, -57, -102, -35, 
+	-25, 21, 11, 21, -16, 51, 30, 20, 
+	-78, -99, 29, -35, 75, -149, 91, 67, 
+	33, 64, 97, -110, 50, -36, -140, 24, 
+	-7, -93, -16, -55, -83, -43, -121, -81, 
+	-55, 51, -79, 77, 16, 59, 27, 7, 
+	-30, -46, 120, 71, 39, -201, 125, 138, 
+	65, -9, 74, -95, 102, -88, -191, 9, 
+	-123, 122, -121, 51, -47, 41, 49, -2, 
+	-69, 20, -72, -47, -88, 119, -4, 36, 
+	-64, 67, 51, 57, 3, -121, -98, 101, 
+	21, 17, 43, -16, 19, 43, -203, -43, 
+	-120, -94, -25, 46, -11, -43, -34, -13, 
+	-37, 0, -51, 14, -102, -5, -18, -54, 
+	-39, -98, 8, -1, -53, 7, 2, -86, 
+	94, 9, 66, -30, 16, 59, -38, 13, 
+	69, -32, -1, 27, -137, -12, -74, 82, 
+	-16, 22, 102, -2, 38, -2, 97, 15, 
+	101, -80, 49, -8, 15, 6, -110, -20, 
+	87, 70, 6, 40, -5, -35, -96, -77, 
+	12, 80, 7, -31, -44, -85, 32, 46, 
+	-24, -52, -62, 9, 9, -26, -9, 42, 
+	-56, 11, -11, 97, -18, -56, -101, -130, 
+	-17, 55, -17, -71, -21, -61, -111, -22, 
+	-134, 206, -61, -198, 37, 60, 211, 3, 
+	-43, -65, -104, 145, -82, 86, -132, 68, 
+	-8, -112, -43, 74, -38, -96, 55, -134, 
+	-54, -34, -60, -81, 15, 20, -97, 42, 
+	-174, 83, -97, -80, 68, 51, 26, -66, 
+	-48, -44, -42, 112, -27, 44, -4, -18, 
+	18, -27, 62, 69, -58, -73, 42, 10, 
+	2, -50, -5, 20, 6, 23, -93, -135, 
+	-109, -47, 8, -29, -10, -45, 1, -27, 
+	-115, -45, -17, 20, -64, 20, -53, 5, 
+	-3, 25, -61, -71, 22, 4, -8, -102, 
+	56, 47, 49, 85, 4, -34, 51, 129, 
+	-23, -44, 76, -121, 28, 147, -4, 113, 
+	22, 1, -27, 96, 69, -6, 16, -60, 
+	227, -57, 59, -93, 25, 15, 17, -59, 
+	13, 3, -54, 73, -63, -61, -70, 89, 
+	-142, 3, -60, -22, -89, 17, 5, 17, 
+	19, -99, -101, -52, -19, 45, -91, 20, 
+	148, 96, 155, -32, -24, 77, 58, 4, 
+	-61, -22, 0, 52, -26, -4, -29, -9, 
+	-89, 98, -48, 46, -78, -50, 14, -80, 
+	11, 1, -44, -84, -58, -51, 43, -74, 
+	0, 75, -114, -41, -3, -40, -4, 29, 
+	56, -64, 35, -171, -32, -25, -36, 37, 
+	7, -42, 1, 12, -35, -106, -30, 31, 
+	-13, -57, -20, -54, 13, -82, 36, -36, 
+	56, -92, -10, 4, -44, -54, -60, -17, 
+	-18, -39, -81, 10, -79, -7, -46, -30, 
+	-98, -111, -41, -142, -101, -116, 39, -57, 
+	-57, -32, -37, -107, -16, 14, -36, -67, 
+	-18, -86, -43, -8, -23, 106, -33, -33, 
+	-79, -10, -90, 38, 29, 22, 8, 21, 
+	-8, 74, 31, 35, -70, -58, -113, 96, 
+	-2, -15, 1, -70, 54, -57, -115, 44, 
+	59, -1, 57, -149, -119, 2, -46, 0, 
+	-85, 4, -37, 120, 86, 23, 62, -12, 
+	59, 98, 19, 20, -152, -66, -208, 15, 
+	97, 44, -1, -163, 30, -221, -60, 61, 
+	-94, -8, -27, -309, -61, 21, -69, 9, 
+	20, 17, -79, -42, 39, 63, -6, 63, 
+	114, 138, -70, 69, -235, -198, -99, 69, 
+	89, 4, 34, -204, 99, -155, -15, 33, 
+	20, 8, -36, -227, -15, 6, 68, 89, 
+	-36, -15, -16, -54, 9, 26, -84, -11, 
+	159, 5, 25, 125, -164, -204, -99, 20, 
+	47, -30, 22, -215, 103, -33, 97, -19, 
+	58, 23, 14, -14, 12, 47, 51, 55, 
+	-49, -54, 11, 3, 26, -12, -179, 13, 
+	-12, -69, -35, 44, -163, -72, 49, -24, 
+	-69, 26, -20, -79, -73, 126, 38, -52, 
+	-62, -50, 41, 37, 10, 111, 0, -20, 
+	13, 56, 49, -65, 6, -29, 84, 118, 
+	5, 10, 67, -44, -105, -58, -244, 4, 
+	78, 7, 4, -25, -19, -33, -38, 51, 
+	62, 80, 82, -120, 7, -110, 42, 102, 
+	45, 74, -12, -65, -18, 48, -50, 0, 
+	19, -4, 71, 2, -90, 44, -108, -12, 
+	74, 35, 112, 38, 6, 41, -3, 78, 
+	-35, 136, 4, -32, -14, -43, 36, 114, 
+	34, 17, 45, -111, 14, -12, -69, 66, 
+	68, 54, -22, 81, 40, 29, 46, -26, 
+	25, 5, 28, -18, -25, 70, 41, -2, 
+	-85, 36, -41, 60, 94, -4, 11, 102, 
+	75, -8, 15, 1, 63, 6, -154, 54, 
+	-129, 94, -125, 44, 49, -1, 29, -80, 
+	-20, -5, -64, -1, -94, 125, 10, 75, 
+	-121, -26, 87, 92, -17, 55, 62, 31, 
+	-38, -32, -15, 10, -24, -79, -185, 31, 
+	-124, -37, -213, -33, -87, -49, -4, -81, 
+	3, -57, -172, -58, -38, 11, -169, 57, 
+	-169, -19, 31, 18, -80, 98, 72, 24, 
+	77, 2, -7, 18, 12, 0, -25, -118, 
+	-14, -46, 11, -108, 109, 96, 54, -37, 
+	-126, 7, -33, 187, -63, 17, -71, 36, 
+	-32, -214, -59, 129, 50, 18, 1, -174, 
+	4, 32, 17, -127, 16, 7, -114, -168, 
+	-98, 155, 10, -129, 129, 146, 126, 39, 
+	-191, -44, -48, 149, -99, 107, -106, 52, 
+	-99, -115, 40, 183, 25, -66, -12, -114, 
+	-17, 52, 50, -107, -46, -47, -210, -62, 
+	-197, 183, -125, -122, 12, 75, 127, -6, 
+	-147, -4, -23, 114, -76, 103, -108, 31, 
+	-120, -63, -23, 115, 24, -23, 45, -23, 
+	-27, 22, -96, 22, -53, -86, -103, -41, 
+	-112, 100, -105, -70, 64, 11, 74, -148, 
+	-77, -21, -145, 41, -9, 84, -205, -59, 
+	-125, -58, -32, 26, -54, 113, 1, -72, 
+	-67, -78, -88, -4, -55, -64, -62, -83, 
+	-134, -162, -114, -41, -51, -53, -64, -93, 
+	-16, -86, -77, -13, -14, 33, -154, -26, 
+	-86, -119, -50, -41, -114, -22, -22, -56, 
+	-12, -25, -52, 65, -74, -78, -79, 0, 
+	-157, 94, -13, -86, 72, -43, -17, 14, 
+	61, -56, -21, 83, -46, -71, -122, 84, 
+	-1, 86, -16, -49, -41, 11, -70, 10, 
+	-147, -68, -125, 20, -82, -103, 44, -94, 
+	-109, 89, -84, -137, 121, -25, 53, -58, 
+	39, -74, -143, 96, 3, -17, -170, 28, 
+	-143, 37, -72, 16, -99, -39, -57, -49, 
+	-136, -48, -79, -63, -18, -71, -104, -30, 
+	-1, 103, -145, -1, -30, -100, 40, -5, 
+	53, -60, -118, 17, 70, -139, -70, 7, 
+	-6, -6, -125, -40, -55, -78, 68, 73, 
+	-28, -25, -33, -91, -74, -81, -59, 4, 
+	-34, 55, -82, -30, -34, -92, 21, -6, 
+	46, -96, -52, -39, 124, -135, -21, -52, 
+	-20, 46, -81, -18, -129, -58, 51, 18, 
+	-32, -84, -34, -59, -6, -33, -24, 23, 
+	-70, -55, -15, -79, -46, -155, -63, -31, 
+	58, -77, -31, -73, -4, -80, -19, 46, 
+	-40, -44, -1, -68, -63, -48, -54, -53, 
+	-72, 22, -7, 139, -30, -77, 111, 49, 
+	61, 57, -1, 90, -94, -130, -42, -84, 
+	27, 55, -93, -206, 16, 0, -90, -28, 
+	18, 88, 121, -34, -83, 208, -32, 17, 
+	-1, -13, -74, 19, 27, 76, 134, -29, 
+	150, 144, 105, 122, -122, -134, -11, -25, 
+	37, 7, 32, -204, 132, -194, 8, -46, 
+	-17, 35, -59, -64, -44, 25, -62, 1, 
+	-29, 78, -9, -25, -9, 19, 20, 102, 
+	61, 31, -11, 107, -42, -28, -32, 32, 
+	102, -46, 35, -86, 145, -161, 74, 8, 
+	85, 5, 46, -124, 13, -156, 30, 7, 
+	60, 26, -60, 66, 19, -41, -51, 43, 
+	1, -6, -28, 63, 31, -5, -46, -24, 
+	-1, -24, 42, -75, -25, -69, 13, 38, 
+	-50, 53, 77, -102, -79, 26, 107, 42, 
+	-9, -67, -61, 12, 22, -74, 35, 78, 
+	-23, -26, -81, 11, -5, -9, -138, 34, 
+	91, 47, -51, -75, -32, -12, -50, -15, 
+	-32, 88, 80, -95, -77, -58, 82, 30, 
+	4, -46, 45, -31, -32, -23, -79, 34, 
+	17, -57, -129, 89, -10, -66, -31, -2, 
+	36, -28, -24, -89, -36, 26, -3, 5, 
+	-36, 60, 29, -26, 60, 61, -15, 75, 
+	-75, -62, -54, 64, -10, -31, 45, -1, 
+	114, 10, 26, 15, -16, 42, -74, -55, 
+	-38, -23, 2, 18, 13, 40, -52, -52, 
+	-58, 19, 30, -40, -6, 91, 56, 118, 
+	-41, -102, -31, -136, 73, -12, 79, 27, 
+	16, 1, 7, 1, -1, 29, 2, 9, 
+	36, 21, 52, -46, -22, -38, -28, -61, 
+	-38, 23, -80, -5, -116, -47, 17, 73, 
+	14, -14, -40, -115, 17, 58, 87, 42, 
+	67, -79, 48, -47, -72, -5, -113, 0, 
+	-43, 33, 51, -67, -13, -201, -89, 74, 
+	44, -34, -83, -151, -3, -64, -93, -12, 
+	-18, 35, -53, 8, -67, 47, -206, 33, 
+	-120, 35, -160, -52, -192, -176, -55, -9, 
+	-10, -42, -11, -124, -103, -84, -18, 56, 
+	-13, 2, 103, -75, 20, -41, -69, 42, 
+	32, -37, -3, 61, -5, -40, -25, 82, 
+	-23, 86, -16, 8, 22, 82, 22, -57, 
+	18, 10, -91, 23, -54, 140, 12, -5, 
+	-30, -18, 91, 83, 21, 78, 86, 26, 
+	-19, -64, -31, 111, -3, -83, -76, -77, 
+	-95, -12, -43, -95, 6, 37, 63, 14, 
+	-68, -10, -5, 30, -62, 11, -35, 21, 
+	-103, 54, -13, 0, -59, -26, -18, -52, 
+	58, -21, -51, -100, 32, 4, 32, -40, 
+	12, 60, 63, 49, -113, 99, -3, 29, 
+	-37, -15, 41, -35, -52, -19, 42, -16, 
+	-30, -14, -134, -11, -11, -117, 11, 46, 
+	43, 84, 24, -140, 75, 75, 22, -49, 
+	6, 32, 10, 6, -188, -116, -42, 47, 
+	68, -38, 64, -12, -5, -87, 51, 62, 
+	62, -61, -148, 76, 152, 32, -47, 25, 
+	-40, 29, -7, 9, 58, 13, -232, 67, 
+	31, 95, -114, 11, -136, 6, 230, -24, 
+	36, -30, -36, 71, 47, 166, -2, -41, 
+	-50, 5, 75, 137, 28, 92, 69, 32, 
+	31, -61, -29, 22, -60, -69, -58, 19, 
+	-31, 26, -8, 10, -6, 9, 71, -24, 
+	49, 5, -47, 28, -12, 26, 6, -26, 
+	-3, 72, 20, 117, -1, 44, 91, -2, 
+	-61, -45, -55, -64, 51, -57, 38, -12, 
+	-15, 78, -29, 26, -77, -86, -7, -8, 
+	-9, -5, 42, -124, 14, -122, -40, 0, 
+	-27, 58, -35, -85, -84, -25, -105, 38, 
+	75, 3, -23, -302, -14, 41, 101, 12, 
+	101, -29, 71, 45, -67, -14, -205, 83, 
+	-28, 12, 103, -120, -44, -122, 47, -5, 
+	113, -116, -185, -89, 25, -158, -39, 104, 
+	10, 48, 10, -20, 26, 1, -222, 37, 
+	95, 35, -109, -41, -82, -171, 234, -15, 
+	57, 35, -20, -60, -12, 81, 44, -13, 
+	40, -44, -93, 175, 50, 97, 4, 96, 
+	-89, -9, -51, 45, -72, -74, -221, 40, 
+	-46, 113, -89, 13, 79, 45, 98, -112, 
+	48, -48, -98, 132, -37, 130, 5, -20, 
+	-177, -20, 31, 162, -22, 51, 7, 110, 
+	-43, -63, -60, 61, 65, -36, -20, -6, 
+	-23, 41, 73, 21, -36, 46, -25, -34, 
+	39, 33, 71, 29, -17, -132, -77, 3, 
+	-59, 84, -3, -122, -79, 35, 88, 15, 
+	53, 37, -11, -73, 12, -5, 93, -67, 
+	-4, -47, -16, 97, -116, -23, -302, -10, 
+	11, -12, -1, -119, 54, -239, 50, 18, 
+	-23, -26, -178, -221, -33, -218, -106, -4, 
+	26, -26, -12, -147, 21, 22, 50, 70, 
+	56, -144, 10, 24, -132, -117, -68, 96, 
+	-63, -37, 89, -141, -74, -40, 113, -50, 
+	47, -244, -32, -64, -34, 12, -14, -80, 
+	-51, 15, -79, 103, 12, -106, -264, 68, 
+	-249, 164, -160, -159, -194, -189, 59, -17, 
+	-122, 16, -129, -141, -225, 11, -104, -7, 
+	-95, 46, 98, 61, -30, -13, 18, -7, 
+	-62, -18, -17, 72, -19, 5, 40, -36, 
+	-117, 58, -9, -92, -23, -67, 32, -53, 
+	-85, -33, -87, 39, -78, -25, 72, -16, 
+	26, 9, 2, 37, 56, -59, 36, 36, 
+	4, 18, 61, -37, -56, 75, 31, -29, 
+	18, -309, 40, -35, 6, 98, -152, -27, 
+	1, -28, 97, 65, 14, 13, 37, -9, 
+	-28, -35, 72, -144, 39, -77, 103, -66, 
+	25, 25, 21, -27, 11, -2, -32, -18, 
+	10, -363, -1, 102, 23, 69, -142, 56, 
+	-64, -30, 16, 64, -19, -21, 44, 17, 
+	-21, -67, 51, -46, -12, -87, 1, -90, 
+	-7, 29, -60, 17, -33, -5, 21, 35, 
+	-156, -39, -101, -103, -86, 57, -68, 15, 
+	-64, -83, 23, 25, -107, 49, -174, 46, 
+	28, 21, 97, 1, -8, -101, 45, -19, 
+	-51, 69, -31, 115, -72, -66, -196, 48, 
+	-204, 1, -34, -15, -57, -16, -9, -147, 
+	-43, 25, -80, 132, -87, 95, -134, 25, 
+	-107, 78, 89, 55, -15, -55, 41, 39, 
+	-82, -110, -32, 33, 35, -59, -164, -26, 
+	-150, -3, -98, 0, 121, -54, 81, -90, 
+	-20, 17, -158, 109, -129, 51, -47, -58, 
+	40, 84, 27, 73, -30, -105, -15, 13, 
+	14, 46, -48, -191, 38, 93, 46, -16, 
+	170, -25, 123, -4, -2, -17, -22, 108, 
+	-29, -77, 76, -111, 76, -127, 65, -61, 
+	14, -118, -71, -122, 108, -84, -41, -13, 
+	33, 114, -38, 58, -72, -15, -9, 94, 
+	34, -86, 20, -71, -34, -41, -82, 56, 
+	27, -18, 1, -85, 70, 25, 2, 30, 
+	87, 7, 91, -127, 14, 132, -38, -108, 
+	-86, 39, -73, 103, -20, -96, 27, -7, 
+	-14, -111, -48, 31, 5, -58, -109, -18, 
+	8, -12, -51, -16, -15, -68, -137, 55, 
+	14, 44, 83, -148, -69, 73, -41, 18, 
+	-77, -30, -103, -69, -140, -72, -54, -128, 
+	-160, -97, -96, -88, -101, -69, -102, -119, 
+	-105, -109, -134, -76, -138, -93, -142, 30, 
+	-116, -60, -116, -108, -58, -41, -109, -107, 
+	32, -45, -43, -172, -68, -82, 76, -120, 
+	57, -64, 1, -24, -96, -31, -157, -81, 
+	-22, -30, -58, -132, -59, -101, 41, -93, 
+	90, -108, -162, -83, -60, -154, -49, -81, 
+	8, 5, 61, -94, 42, 105, 61, -31, 
+	53, -28, 93, 57, -31, 23, 37, 73, 
+	53, 71, 40, -41, 88, 15, 164, -34, 
+	89, -44, 50, -6, 75, 152, -57, -45, 
+	34, 59, -33, 65, -62, 58, 120, 45, 
+	60, -50, 54, 69, -8, 27, -29, 57, 
+	16, 54, 19, -113, 114, 118, -10, -37, 
+	-14, 34, 77, -23, -20, 46, -86, -51, 
+	-75, 60, -31, 108, -49, -100, 3, -12, 
+	81, -52, -15, 69, -106, -20, -86, -73, 
+	23, -68, -52, -29, -39, -58, -34, 8, 
+	39, 87, 49, -20, -47, 60, 17, -63, 
+	-67, -41, -87, -27, 4, -126, 51, -88, 
+	-77, -46, 64, -41, -64, -38, -28, -83, 
+	-33, 7, -51, -63, -124, -35, -113, -37, 
+	-128, -49, -26, -83, -21, 2, -69, -141, 
+	-34, -64, -9, -92, -56, -24, 41, 15, 
+	9, -47, 33, 82, -122, -43, -7, 0, 
+	21, -37, 4, -91, 8, -122, 0, -80, 
+	143, -7, -36, -67, 42, -54, -64, -39, 
+	58, 19, 37, 20, 12, 37, -5, -59, 
+	-1, -44, -32, -56, 37, -5, 80, -3, 
+	22, 24, 66, 55, 55, 95, 100, 4, 
+	-5, -39, -62, 54, 42, 117, -16, 63, 
+	48, 15, -17, -58, -2, 32, 109, 31, 
+	50, -83, 75, -55, -10, 67, -38, -30, 
+	-15, -9, -24, -48, -41, -41, -11, -46, 
+	-85, -42, 20, -59, 42, 34, -5, -1, 
+	-27, 46, 17, 38, -29, -54, -25, 70, 
+	26, -43, -75, 17, -59, -62, -111, 5, 
+	-43, -42, -38, -125, -49, -78, 64, 9, 
+	63, 54, 108, -112, -66, 11, 6, -3, 
+	-93, -37, -33, 54, -60, -67, 120, -64, 
+	7, -66, 120, 6, -56, 32, -152, -99, 
+	-49, -23, -30, -122, -53, -163, 3, -49, 
+	-58, 1, -161, -137, -87, -24, 47, -22, 
+	-24, -76, -47, -185, -42, 32, 52, -14, 
+	45, -117, 44, 70, -174, -32, -70, -3, 
+	42, 12, -29, -124, 35, -214, 9, 9, 
+	150, -4, -21, -166, -65, -13, 50, 4, 
+	8, 43, -31, -54, 56, 20, 62, -46, 
+	-65, -30, -20, -49, 5, -5, -19, -48, 
+	-41, 51, 31, 14, -60, 40, 27, -35, 
+	-121, -139, -109, -19, -66, 33, 24, -75, 
+	61, -42, 74, -169, 32, -28, 90, -98, 
+	12, -221, 97, -22, -26, -62, -166, 4, 
+	-144, -38, 62, -82, -31, -41, 53, -65, 
+	-3, -200, -9, -107, 2, -46, -92, -27, 
+	-72, 11, -46, 69, -71, -39, -65, -30, 
+	-145, -157, -122, -91, -45, -89, -139, 31, 
+	-72, -38, -35, -109, -98, -69, -77, 23, 
+	55, -18, 68, -198, -88, 3, -31, -146, 
+	29, 8, -24, 45, -34, -25, 51, -45, 
+	-23, -53, 68, -7, -127, -25, -102, 4, 
+	8, 6, 67, -179, -57, -13, -39, -56, 
+	-24, -16, 7, -120, -19, 32, 27, -101, 
+	-13, -8, 24, -110, -19, -27, 124, 115, 
+	71, 41, 90, -49, -144, 6, -66, 56, 
+	18, 48, 53, -173, 49, -153, -42, -28, 
+	91, -69, -6, -248, -36, 1, 19, 1, 
+	-49, -5, -74, -29, -29, 7, 70, -122, 
+	26, -30, -11, -61, -65, -22, -82, 23, 
+	-41, 3, 42, -40, -45, -48, -15, 65, 
+	-74, -117, -116, -46, -24, -44, -105, -64, 
+	-6, -39, 19, -75, -2, -2, -50, -36, 
+	5, 39, 37, -93, -46, -13, -86, 58, 
+	-46, 26, 10, -42, 12, -106, 7, -8, 
+	31, 22, -8, -115, 30, -63, -25, -118, 
+	-114, 9, -61, 109, 20, -22, 43, 137, 
+	-14, 185, 3, -75, -98, -11, 105, 19, 
+	131, 32, -10, -138, 75, -13, -153, 75, 
+	-71, 67, 108, -81, -39, 1, 43, 5, 
+	-39, -53, 10, 108, 54, 53, 83, 34, 
+	58, 180, 79, 96, -108, 37, -122, -44, 
+	131, -31, 65, -68, 132, -138, 12, 96, 
+	29, 123, 34, -273, -44, -66, 31, 137, 
+	-29, 47, 41, 21, 43, 96, 42, 48, 
+	133, 72, 92, 105, -96, -43, -171, 16, 
+	138, -41, 119, -153, 143, -12, 80, 18, 
+	30, 4, -3, -112, -16, -19, -32, 121, 
+	
+};
+
+const static dl_matrix3dq_t conv2d_1_kernel_q = {
+	.w = 5,
+	.h = 5,
+	.c = 32,
+	.n = 64,
+	.stride = 160,
+	.exponent = -10,
+	.item = (qtp_t *)(&conv2d_1_kernel_q_item_array[0])
+};
+
+const static qtp_t conv2d_1_bias_q_item_array[] = {
+	-27861, 4679, -14441, -880, -16296, -21540, -17615, -14036, 
+	1580, 4254, -9632, -20773, -1687, -20980, -4226, -14165, 
+	-10624, 32526, -16222, -4253, -6656, -3913, -13589, -14848, 
+	-21864, -9731, -7168, -1188, -8127, -5101, -7966, -13018, 
+	-3731, 444, -6531, -16214, -8202, 66, 4587, -14670, 
+	-8924, -1852, 6492, -14689, -3856, -14160, -5317, -12697, 
+	-9878, -3207, -15314, -14591, -21508, -19582, -18197, -20162, 
+	2328, -16578, -11905, -8893, -7367, 9554, -18985, -5439, 
+	
+};
+
+const static dl_matrix3dq_t conv2d_1_bias_q = {
+	.w = 1,
+	.h = 1,
+	.c = 64,
+	.n = 1,
+	.stride = 64,
+	.exponent = -18,
+	.item = (qtp_t *)(&conv2d_1_bias_q_item_array[0])
+};
+
+const static qtp_t conv2d_2_kernel_q_item_array[] = {
+	88, -119, -94, -14, 4, -31, -60, -151, 
+	4, 48, -47, 56, -18, -46, -68, 46, 
+	-24, -124, 50, -97, 69, -86, 11, 27, 
+	-73, 5, -57, -9, 5, 15, -24, -109, 
+	10, 37, -75, 23, 108, -62, -35, 40, 
+	28, 43, 115, -24, 97, 104, -71, -6, 
+	-68, 72, 48, 46, -44, -1, -123, 50, 
+	-20, -42, -11, -71, -26, -32, 33, -102, 
+	-94, 88, -12, 48, -14, -48, -118, -56, 
+	-25, 45, 56, -74, -26, 33, -87, -104, 
+	-30, -54, -57, -46, 13, 52, -28, -43, 
+	60, 9, -110, 39, 34, -58, -11, 14, 
+	-19, 56, 4, -42, -147, -99, -66, 88, 
+	-147, 193, -25, -58, 90, -101, 117, 97, 
+	101, -90, -59, 70, 67, -7, -10, 13, 
+	4, -70, -25, -61, -58, 60, -28, 25, 
+	-82, -7, 58, 30, 152, -98, -95, -110, 
+	74, 10, -8, -40, -66, 116, -26, 21, 
+	-2, -32, -25, 37, 7, 13, -16, -108, 
+	45, -34, -105, 15, 81, -198, -7, 101, 
+	41, 36, 2, -31, 63, -230, -21, 34, 
+	-74, -75, -207, 11, 12, -52, 105, -2, 
+	61, -22, 36, 211, -27, -60, -64, 110, 
+	-108, 2, 136, -15, 23, -8, -5, -64, 
+	44, -78, -26, -70, -114, 46, 135, 71, 
+	-10, -137, 51, -61, -6, -71, 82, 43, 
+	-48, -35, -166, 55, 21, -47, -15, -79, 
+	-45, -136, -6, 56, -2, 89, -9, -37, 
+	-23, 100, 53, -34, 34, 91, -31, 69, 
+	28, -60, 149, 44, 118, 20, -12, -119, 
+	-162, -12, 8, -75, 22, 19, 1, -130, 
+	-107, -35, -70, 8, -37, 30, 37, 22, 
+	-178, 42, -57, -21, -80, -103, 38, -111, 
+	20, 8, 115, -27, 22, 2, 108, 32, 
+	6, 37, -66, 44, -52, 111, -152, 51, 
+	4, -9, 19, 36, 62, -70, -72, -104, 
+	-90, -10, 29, -91, -14, 89, -37, 16, 
+	25, 22, -91, -19, 144, -90, -80, 110, 
+	55, 85, -57, -33, -106, -77, 29, -47, 
+	-9, 86, -131, -75, -34, -63, -91, 94, 
+	-18, 173, 2, -95, 57, -142, 31, 2, 
+	160, -77, 92, -38, -51, -35, 149, -33, 
+	88, 77, 11, -97, 82, 30, -46, 34, 
+	-9, -50, -65, -27, 86, -29, 196, -103, 
+	-58, -34, -33, 59, 2, 31, -141, 49, 
+	-77, 119, -133, -34, 44, 57, 50, 24, 
+	-56, -41, 104, 52, -35, -20, -126, -72, 
+	32, -41, -130, -81, 93, -1, -21, 14, 
+	34, -116, -20, 42, 2, 105, 74, 11, 
+	-138, 19, 32, -198, -132, 142, 72, 65, 
+	-69, -22, -5, 213, -125, -61, 76, 2, 
+	-25, 22, 78, 12, -38, -41, 39, -31, 
+	-40, -24, -50, -14, -83, 103, -155, 46, 
+	-250, -119, -119, -113, 71, 34, -158, -157, 
+	-26, -244, -145, 53, 27, -30, 69, -132, 
+	-13, 104, -37, -111, 47, 1, -46, -15, 
+	-100, 63, -177, 4, -18, 84, 53, -69, 
+	86, -41, 122, -124, 23, 29, 97, -58, 
+	114, -18, 56, 56, 63, 104, 67, 35, 
+	-89, -61, 62, -28, 27, -259, -11, 7, 
+	116, -144, 10, -35, -106, -86, 13, -34, 
+	-5, -42, -129, -174, 29, -39, -47, -105, 
+	-162, -53, 25, -114, -40, -41, -52, 45, 
+	76, 88, -94, -118, -136, -135, 173, -132, 
+	80, -2, 53, -181, 50, -144, -43, 117, 
+	68, -169, 87, -129, 58, 58, -7, -36, 
+	-53, -17, 58, -76, -26, 23, 14, -34, 
+	-26, 14, -31, -24, 36, 72, 9, 38, 
+	11, -2, -50, 8, -95, -56, 124, -40, 
+	-72, 98, -17, 14, -18, 10, 124, 37, 
+	-80, 53, 74, -142, -11, 65, -66, -44, 
+	113, -121, -31, -100, 42, 59, 112, 114, 
+	109, -23, -206, -125, 1, -109, 31, 100, 
+	41, -114, 46, -92, -76, 49, -95, -62, 
+	12, -64, -24, 31, 39, 5, -85, -60, 
+	1, 7, 3, -144, 20, 22, -55, -67, 
+	37, -44, -79, 70, 43, -80, 22, 10, 
+	-66, 146, -56, -4, 38, 54, 4, -62, 
+	-80, -91, 77, -47, -23, -32, -51, -73, 
+	49, -24, -76, -3, 30, -186, -27, 110, 
+	-1, 47, -29, 21, 27, 173, -33, 27, 
+	69, 24, -101, -66, -44, 37, -18, 27, 
+	-45, 107, -122, -14, -43, -19, -2, -166, 
+	40, 23, 7, -166, 1, -231, 80, 24, 
+	59, 0, 25, 107, -52, -59, 9, 6, 
+	-124, -36, 128, 38, -5, -6, -51, -171, 
+	-6, -44, 30, 25, 44, -9, -17, 4, 
+	-142, -80, 92, 105, -1, -140, -101, 1, 
+	-110, -63, -58, 17, 34, 100, -11, 1, 
+	-37, 15, -110, 32, 6, -160, -75, -8, 
+	-107, -44, -41, -92, -98, 22, 9, -29, 
+	-72, -71, 8, -148, 23, -28, -80, -43, 
+	25, -77, -134, 83, -64, -104, -144, -45, 
+	96, -181, -17, -78, -52, 51, -270, -168, 
+	34, 151, -156, -40, 9, -22, -24, 5, 
+	-158, 35, -64, -1, -126, -97, -86, -135, 
+	42, -68, -165, -112, -132, -101, 23, 58, 
+	-80, 233, 33, 128, 41, -70, -101, -106, 
+	-50, -138, -71, -89, 29, -63, -152, -9, 
+	-11, -30, -57, -120, 23, 4, -37, -51, 
+	40, -37, -1, 10, 120, 48, -84, -59, 
+	75, 84, -152, 19, -96, -77, 8, 81, 
+	-26, 126, -64, -72, -27, 33, -52, -81, 
+	65, -38, -249, -24, -87, -27, -11, -27, 
+	50, -27, -50, -9, 40, -7, 88, -18, 
+	-10, 20, -37, -50, 23, 70, 9, 20, 
+	15, 57, 68, 132, 35, -64, -69, -10, 
+	95, -74, 39, 92, 65, 9, 49, 19, 
+	-60, -41, -4, -30, -15, -56, 14, -7, 
+	91, 102, 74, 2, 87, -47, 10, -40, 
+	43, 56, -43, 59, -56, -43, -45, -5, 
+	-68, -1, 49, 98, -109, -11, -68, 62, 
+	-68, -39, 79, 46, 36, 56, 5, 93, 
+	-84, 8, -55, -133, 84, -20, -32, -92, 
+	30, -21, -9, -10, 55, -48, 143, -13, 
+	-108, -180, -118, -24, 20, -57, 77, 170, 
+	-88, -100, 58, -57, 56, -14, -238, 41, 
+	77, -65, 49, 71, -108, 36, -193, -7, 
+	23, 99, -56, 54, -3, 19, 48, -66, 
+	0, -6, 8, 61, 19, -64, -15, 31, 
+	-106, -103, 87, -33, -54, 17, -122, -117, 
+	-32, 139, -23, 47, 18, -111, -73, 51, 
+	-168, -142, 3, -120, 10, -107, -15, -52, 
+	-162, -132, -28, -37, -15, 66, -161, -96, 
+	-90, -106, -136, -108, -45, 3, -120, -121, 
+	96, -106, 41, 33, -169, -50, -73, -52, 
+	-208, 48, -117, -52, -46, 2, -71, -103, 
+	3, -38, 16, 82, -61, -30, -50, -121, 
+	53, -182, 289, 46, -46, -75, 102, 34, 
+	-75, 103, -64, 52, 46, -25, -47, -64, 
+	-82, -123, 39, 129, -43, -167, 61, -26, 
+	-116, 99, -22, 19, -177, 197, 26, -79, 
+	-46, 54, -41, 2, -29, 210, -11, -73, 
+	48, -140, 23, -43, -32, -117, -28, -76, 
+	4, 9, -120, -82, 69, -186, -82, 33, 
+	-29, -99, 39, 72, 40, 20, -126, -36, 
+	-93, 44, 177, -43, -171, -67, 5, 76, 
+	-85, 7, 61, -77, 148, -160, 36, 2, 
+	96, -15, 102, 43, -25, 33, -39, 45, 
+	-99, 113, 35, 53, -52, 24, -31, 27, 
+	38, 130, -31, -38, 44, 86, 75, -51, 
+	27, 71, 50, -99, 57, -26, 34, 114, 
+	-53, 141, 42, -107, 85, -319, -182, -8, 
+	18, 61, 105, 73, 70, 112, -52, -53, 
+	-84, 200, -6, 1, 2, 95, -36, 12, 
+	-58, -39, 112, -50, 119, 11, 50, -8, 
+	42, -126, 158, -11, 15, 97, 68, 76, 
+	-11, 12, -29, 14, 134, -92, -45, 141, 
+	11, -49, -49, 4, 97, 71, -104, 43, 
+	-115, 0, -107, 99, 137, 71, -168, 65, 
+	6, 32, 116, -1, 2, 0, -203, 21, 
+	88, -15, -47, 93, -86, 66, 120, -46, 
+	47, -161, -90, -58, -114, 67, 40, 14, 
+	6, 60, -1, 36, -18, 21, 82, -59, 
+	-69, 126, -81, -112, 40, -55, 60, -82, 
+	72, -5, 166, -24, -111, 47, 69, 0, 
+	-35, 117, 75, 125, 24, 131, 59, -60, 
+	-20, 59, -130, 133, -41, -95, 150, 199, 
+	-77, -30, 154, 86, 20, -11, -18, 35, 
+	-54, 43, -5, 81, 74, 38, 18, -78, 
+	54, -22, -3, -97, -122, 32, 90, 23, 
+	-49, 105, -133, 104, 21, -41, 61, 78, 
+	-56, 50, 44, 110, -92, -84, -149, -92, 
+	-66, 75, 86, 74, -31, -69, -118, -35, 
+	22, 6, 25, -41, -113, 81, -129, -39, 
+	146, -2, -184, -39, -115, -90, 41, -67, 
+	-92, 161, -154, -134, -87, 26, 11, -90, 
+	40, -121, 18, 20, 8, 74, -131, 33, 
+	55, -1, -88, -114, -49, -126, 18, 41, 
+	4, -45, 55, 52, -25, -98, -19, -129, 
+	37, 157, 73, -233, 132, 57, -145, -3, 
+	75, -36, -61, -37, 82, 111, -22, -17, 
+	-174, -89, -88, 100, 72, -34, 19, 19, 
+	-19, -83, -74, 146, -117, -41, 73, 151, 
+	-161, 21, 143, -62, -15, 5, 112, 23, 
+	-9, -136, -133, 77, -68, -48, 15, 88, 
+	85, 31, -255, -92, 106, -96, -131, 23, 
+	96, -113, -39, -110, 9, 19, -107, -20, 
+	-198, 80, -190, -129, -81, 31, 90, -3, 
+	5, -105, -99, -97, 24, -80, -39, 29, 
+	-35, 73, -164, 102, -5, -95, 33, -34, 
+	-40, -181, -20, 62, -50, -4, 15, -18, 
+	-2, 43, 44, -19, -113, 140, -21, -171, 
+	-204, -42, -29, 99, -31, -91, -84, 1, 
+	-41, -10, -102, 44, 127, 162, 14, -15, 
+	-67, 64, -124, 40, -16, 55, -4, 119, 
+	-173, 16, 18, 26, 88, -44, -9, 11, 
+	-163, 98, -109, -88, 34, 102, 63, -3, 
+	45, -118, -189, 83, -62, -163, -40, 17, 
+	183, -169, 44, -84, 66, 27, -176, -96, 
+	39, 35, -55, -51, -48, -15, -6, -31, 
+	-9, -111, -92, 21, -91, -96, -3, -102, 
+	-75, 4, 85, -13, -26, -224, -150, -96, 
+	-36, 110, 121, -39, 140, -161, -294, -51, 
+	-124, 57, 63, -88, -18, 67, 20, 49, 
+	87, -130, -218, 44, 49, 181, -9, -147, 
+	-302, 90, -267, 40, -55, 146, -26, 57, 
+	152, -57, 195, -36, -48, -133, 124, 71, 
+	93, 110, 32, -10, -64, 119, 137, -153, 
+	-21, 50, 117, 56, -127, 28, -44, 127, 
+	-108, 15, -172, -82, 135, -129, -157, -148, 
+	-50, -49, 16, -139, -112, -39, -135, 18, 
+	-173, -170, 37, -46, 16, -32, -196, 37, 
+	59, -123, -197, -148, -52, -57, -131, -147, 
+	-125, 94, -122, -118, -91, -10, -44, 43, 
+	-70, -59, 77, -164, -37, -31, -64, -128, 
+	-61, -168, -1, 47, -82, 116, -22, 131, 
+	-67, 1, -36, 28, -74, 25, 19, -1, 
+	-134, -40, -111, 57, 1, -71, -125, -1, 
+	-111, -163, 93, 44, 13, -85, -82, -120, 
+	-101, -108, 63, 16, 79, 26, -104, 23, 
+	-98, -1, 120, -23, 22, -103, 35, -54, 
+	-14, -119, -26, -173, -31, -267, -169, 78, 
+	147, -122, -158, 19, 50, 106, -87, -47, 
+	7, -30, -2, 1, -48, -34, 20, -29, 
+	57, -22, -151, -57, -49, -235, 17, 37, 
+	-79, 51, -37, -57, 84, -120, -45, -123, 
+	-20, -29, 101, 33, -46, -42, -117, -40, 
+	-79, 293, -23, -61, 57, 13, 75, 13, 
+	-149, 6, -148, -48, 34, 42, -9, -151, 
+	-125, -47, -64, 13, 115, -15, -97, 17, 
+	58, -100, 162, 15, -65, -52, -44, -28, 
+	18, 149, -90, 10, 3, -110, -75, -108, 
+	-146, 19, 106, 61, -90, -87, -40, 134, 
+	-79, 29, 94, -93, 11, -82, -86, -110, 
+	-18, 91, -162, -3, 14, -29, -76, -27, 
+	-177, 54, -39, -76, 51, -61, -10, -3, 
+	-129, 50, 44, -51, 7, 91, 40, -100, 
+	-80, -18, 7, 24, 18, 48, -232, -39, 
+	4, -159, -107, -12, 31, 55, -135, -101, 
+	-80, 121, 59, -56, 32, -1, -131, -54, 
+	68, -34, 35, 12, -65, -75, -140, 34, 
+	-1, 40, -72, -54, 3, -71, 118, 57, 
+	-151, 88, -48, 10, 53, 63, -51, -120, 
+	6, -133, -21, 60, 40, -29, -195, 28, 
+	6, 0, 35, -11, 86, 138, 18, 21, 
+	-64, -166, 28, 28, 20, 77, -111, -17, 
+	39, -77, -66, 46, 8, -8, -154, -41, 
+	-8, 214, -34, 18, -8, -124, -7, 17, 
+	15, 97, -39, -57, 31, -138, 113, -100, 
+	-109, 48, -111, 35, 98, 72, -93, 24, 
+	-66, -74, 16, 20, 31, 46, -19, -4, 
+	83, -40, 118, 10, 88, 46, -22, 13, 
+	-50, -43, -9, 57, 80, -34, -22, -35, 
+	-12, 58, 27, 2, -108, -96, -83, 11, 
+	-24, -25, -12, 18, 93, 121, -17, 44, 
+	35, 0, 36, -61, 47, -110, 21, -59, 
+	-19, 52, -7, 43, -78, -153, 109, -7, 
+	6, 40, -35, 110, 18, 40, -120, 3, 
+	-33, -105, -86, -56, 18, -60, 62, -41, 
+	67, -115, -82, 50, -27, -16, 19, 45, 
+	-37, -95, -38, -108, 57, 1, -74, -2, 
+	47, 27, 72, -89, -103, -151, -139, -15, 
+	-19, -84, -70, -23, -93, -1, -97, -61, 
+	87, 35, -77, 31, 67, -9, -3, -26, 
+	-9, 41, -111, -49, 84, -106, -19, -32, 
+	-107, 63, -62, -105, -12, -16, -79, -33, 
+	-18, -7, 38, 79, 130, -94, 54, 15, 
+	14, -235, -6, -138, 21, 49, -93, 15, 
+	-17, 60, -82, 36, -55, -110, -103, -70, 
+	42, -62, 66, 8, -86, -58, -114, 25, 
+	-172, 67, -79, -45, -134, -9, -27, -19, 
+	-118, 65, 23, 15, 39, 16, -70, 145, 
+	-11, -93, -217, 88, -7, -51, -59, -149, 
+	31, -72, -40, -25, -88, -94, 76, 88, 
+	-30, -5, 47, -69, -61, 52, 5, 70, 
+	-3, -144, 56, 103, -26, 14, -118, -15, 
+	13, -52, 70, -27, -28, -83, 90, 58, 
+	2, 109, 100, 91, -24, -31, -42, -18, 
+	-72, 33, 53, -6, -10, 66, 28, 12, 
+	-29, -191, 137, 55, -48, -60, -30, 28, 
+	63, 52, -129, -12, 86, -9, 43, -50, 
+	-87, -72, -136, -135, -170, 62, 72, 15, 
+	27, -59, -112, 61, -23, 40, -41, -9, 
+	-49, -22, -10, -10, -140, -56, -12, -61, 
+	-51, -95, 39, -26, 6, 70, 14, 129, 
+	124, 36, -18, -26, 13, 25, -26, 30, 
+	25, -25, -124, 47, -69, 77, 4, 7, 
+	-134, -113, -76, -28, 16, 67, -41, 85, 
+	86, -3, 3, 125, 68, 22, 26, -87, 
+	-159, -38, -43, -30, -12, 0, 88, 39, 
+	-96, 32, -30, 47, 94, 92, -66, 9, 
+	35, -16, 18, -112, -228, -2, 32, -30, 
+	-80, 23, -72, -78, 20, 52, 163, 95, 
+	6, 42, -85, -29, -179, 77, 6, 15, 
+	-38, 19, -202, 32, -86, -106, -27, 39, 
+	-138, 44, -111, -99, -100, -62, 17, -96, 
+	30, -38, -111, -95, -51, -6, -139, 21, 
+	-133, 54, -114, -103, 129, -165, 47, 29, 
+	-198, 85, -115, 62, 71, 30, 20, -71, 
+	-53, -75, -83, -87, 79, 26, -123, 24, 
+	-10, 26, 1, 106, -98, 135, -44, 13, 
+	-65, -90, 19, 0, 166, 50, -107, -30, 
+	-29, -82, 13, 65, -33, -14, -176, -62, 
+	-45, 94, -71, 14, 50, -106, 15, 28, 
+	-4, 66, -202, -34, 6, -53, -15, 68, 
+	19, -130, 67, -118, -61, -133, 97, 77, 
+	-68, 17, -54, 87, 67, 15, -139, 15, 
+	-99, -70, -42, 17, 5, 15, -1, -83, 
+	-28, 75, 10, 23, -39, -46, 14, 128, 
+	-183, -77, 31, -14, 211, -126, 62, -18, 
+	51, -56, 76, -15, -56, 98, -23, -30, 
+	-103, -46, 26, 65, -47, -50, -16, 21, 
+	-49, 77, -53, -56, -83, -49, -22, -83, 
+	-4, -65, -38, 20, -69, -122, -169, -85, 
+	-91, 6, -93, 18, 107, -14, -132, 123, 
+	-56, -60, -30, -92, 26, -84, 99, 8, 
+	1, 17, -11, 86, 90, -55, 0, -136, 
+	-124, 4, 38, 33, -163, -16, 34, -9, 
+	29, 74, 213, -50, -21, -129, 158, 82, 
+	56, 163, 11, -13, 72, -25, 140, -12, 
+	-14, 44, 174, -51, 5, 156, 12, -3, 
+	-90, 9, -33, 51, -16, -93, 53, -123, 
+	-54, -50, -7, 6, 132, 63, 47, -55, 
+	43, -189, 60, 131, -57, 34, -40, 0, 
+	20, 105, -130, -70, -30, 19, 77, 91, 
+	52, 28, 25, -30, -262, -69, 79, 27, 
+	-97, 15, 31, -69, -15, -74, 17, 41, 
+	116, 112, -17, -34, -102, -52, 31, 5, 
+	69, 103, -71, 80, 13, -62, -107, 68, 
+	38, -6, -118, -75, 65, -115, -133, -90, 
+	59, -15, 113, -24, 49, -51, 73, 25, 
+	-15, -116, 43, -25, 103, 36, -101, 48, 
+	-24, 30, 19, -111, -50, -18, -51, -86, 
+	4, -25, -130, -86, -139, -46, -75, 90, 
+	10, 9, -86, -10, 14, 79, 38, 52, 
+	-45, 10, 33, 113, -97, 15, -12, -13, 
+	-4, 66, -124, -15, -1, -109, -84, 50, 
+	1, 26, 30, -55, -146, -102, -236, -44, 
+	-31, 1, -58, 144, -8, -75, -247, 117, 
+	-59, -143, -51, -26, -83, -2, -28, 23, 
+	-26, 21, -91, -99, 88, 33, 3, -175, 
+	-156, 104, 30, -142, -169, 12, -110, 66, 
+	121, -16, -206, -29, -82, 69, -49, -82, 
+	14, -40, -90, -17, -3, 62, -5, -105, 
+	-18, -51, -55, 56, -85, -150, 3, -154, 
+	-139, 47, -69, -30, -49, -88, -50, -98, 
+	98, 68, 2, -35, -35, 7, 6, 59, 
+	10, -167, 14, 86, -107, 115, 73, 0, 
+	-40, 120, 101, 114, 21, -313, -93, 14, 
+	11, -9, 9, 58, -116, -22, 207, 118, 
+	-234, 5, 92, -88, 19, -24, 2, 93, 
+	53, -82, 73, -11, -62, -74, 6, 165, 
+	92, 18, 102, 18, -5, 38, -49, 13, 
+	-64, -47, -183, -14, 122, -50, -101, 26, 
+	152, -89, -38, -133, -95, 105, 9, 28, 
+	67, 67, 82, -133, -112, 6, -83, 53, 
+	158, 7, -14, -3, -103, -212, 7, 10, 
+	-54, 37, -1, 148, 65, -102, -5, 3, 
+	-57, 2, -83, -31, -18, -61, 113, 138, 
+	-39, -12, 11, -129, -54, 57, 63, 48, 
+	13, -99, 36, -42, -18, 49, -40, 182, 
+	-24, 161, 81, -15, -3, 82, -39, -6, 
+	17, -59, -89, -119, -131, 20, -99, -67, 
+	-77, -7, -41, -101, -25, 34, 26, 65, 
+	-17, -135, -33, -182, -4, -153, -19, 6, 
+	72, 89, -46, 11, 115, -165, -109, -61, 
+	-14, -137, -100, 41, -83, 44, -1, -7, 
+	24, -110, -16, 10, 34, 92, 29, -2, 
+	-71, -89, 24, -76, -29, -174, 105, 80, 
+	-72, 107, -29, 69, 5, 112, -89, -70, 
+	-142, -61, 41, 4, 46, 56, 73, 24, 
+	37, 10, 95, -39, 49, 31, -53, 118, 
+	-131, -138, 18, -26, 113, -65, -102, -23, 
+	-9, -113, -80, -85, -17, -28, -133, -26, 
+	-29, 19, -56, 128, -57, 71, -28, -46, 
+	4, 39, -57, 123, -45, 43, -22, -100, 
+	5, 43, 66, 42, -58, 43, 49, -21, 
+	87, -128, 43, -34, 70, -70, 6, 129, 
+	-12, 166, 37, 58, 24, -40, 11, -22, 
+	59, -95, 9, 41, 63, -106, -38, 37, 
+	-46, 90, 20, 90, -79, 15, -31, 2, 
+	47, -78, 34, 14, 75, -50, -199, -12, 
+	87, -33, -6, -10, 120, 67, -71, 153, 
+	2, 110, -55, -12, -102, -105, -105, 10, 
+	-91, 56, -93, -94, -69, -13, -3, -79, 
+	4, -31, 82, -88, 2, -143, 6, 103, 
+	-28, 116, -80, 76, 105, 10, 76, 45, 
+	55, -44, 94, 11, -18, -106, 76, 129, 
+	-179, 116, 55, -67, -22, 142, -27, -71, 
+	-48, 60, 80, 18, -61, 86, -236, 6, 
+	-55, 48, 15, -85, 34, -52, -17, -49, 
+	48, 12, -71, -15, 26, -170, -162, -10, 
+	-41, -82, -200, -68, 15, -17, -137, -1, 
+	-24, 53, 50, -35, -186, 85, 62, -22, 
+	-11, -7, -67, 21, 58, 76, 9, -58, 
+	39, -115, -116, -27, -48, -58, -19, -73, 
+	62, -15, 12, 58, -85, 13, 76, -10, 
+	6, 61, 105, 37, -61, 86, 39, 37, 
+	-103, 110, -71, 11, -240, -30, 92, 154, 
+	56, 9, -28, -6, -22, -56, -50, 40, 
+	97, -61, -20, 59, 77, 49, -43, -48, 
+	43, 38, -136, -36, 30, -53, 63, -36, 
+	-1, -118, 41, -10, 35, 97, -57, 63, 
+	-1, -92, -113, -113, -84, -101, 49, -186, 
+	140, -3, 21, 28, 34, 33, 19, -54, 
+	13, 4, 53, 47, -25, -11, 38, 44, 
+	-59, 50, -163, -22, -102, -59, 81, -54, 
+	67, -196, -54, -192, -32, 155, -68, 59, 
+	8, 51, 53, 5, -22, -49, -34, 12, 
+	-98, 42, 29, 48, -68, -89, -116, -128, 
+	41, 14, -57, -55, -12, -8, -126, 85, 
+	-148, -198, 31, 1, -131, -11, 63, -59, 
+	-51, 60, -126, -106, 50, -17, -69, -64, 
+	0, 56, -31, 23, -168, -128, -63, -43, 
+	66, -37, -130, 36, 17, -103, 49, 46, 
+	127, -9, -38, -28, 136, 195, 22, -16, 
+	-6, 9, -33, -63, -89, -92, -8, 34, 
+	-86, -26, -21, 20, -30, 39, -107, -77, 
+	-18, -13, -96, 29, 46, 124, -54, 52, 
+	3, 78, -16, -23, -185, -110, 45, -111, 
+	50, -8, 129, 67, -94, -100, 65, -40, 
+	22, 45, -89, -116, -34, 49, 57, -1, 
+	-97, -67, 1, -90, 24, -100, 0, -29, 
+	-5, -15, -114, 53, -44, -125, 39, -51, 
+	-61, 82, 121, 21, -12, 91, -47, -34, 
+	-73, -161, 1, 97, 47, -57, 42, 26, 
+	7, -99, -39, -170, -24, 58, 28, 39, 
+	-33, -45, -17, 62, -66, -158, -136, -29, 
+	42, -21, -52, -44, -8, -92, -14, 56, 
+	56, -12, -95, 34, -11, -89, 54, -99, 
+	-49, -80, 52, -168, 58, -105, -23, -128, 
+	63, -38, -163, -45, -18, -154, 30, 11, 
+	-85, -3, 45, -87, -12, 42, -140, 28, 
+	-47, -65, -97, -2, 64, 83, 27, -108, 
+	7, -106, -70, 6, -147, -19, 76, -76, 
+	-46, -97, -70, 30, -36, 43, 70, -126, 
+	-60, -29, -30, -109, -22, -69, -60, 58, 
+	-64, -149, -21, -35, 56, 15, -159, -34, 
+	-57, 11, 6, -61, 113, 78, -108, 39, 
+	14, -108, -4, -6, -54, -37, 4, 51, 
+	-11, 79, 55, -16, 23, -102, 119, -102, 
+	-106, -73, -89, -48, -116, -80, 90, 57, 
+	-95, 94, 165, -48, -54, -26, 78, -59, 
+	64, -43, 111, 15, -51, -39, -73, 63, 
+	-58, 62, 37, 29, 132, 54, -15, 48, 
+	-34, -25, -46, -3, -67, 15, 57, -15, 
+	44, 60, -70, 60, -62, -70, -66, 5, 
+	-53, 34, 120, 93, -8, -196, -61, 38, 
+	141, -29, -150, -2, 41, -10, 35, -42, 
+	-2, -155, -89, -128, -56, -102, 90, 39, 
+	-51, 10, 15, -51, 63, 79, -109, -20, 
+	46, -5, 37, -56, 35, -69, -53, -28, 
+	-23, 20, -65, 47, -23, -49, 80, 46, 
+	30, -136, 104, -136, 186, 16, 1, 40, 
+	-50, -22, 140, 42, -47, -28, 20, -1, 
+	-168, -71, -45, -26, -17, -68, -49, 90, 
+	-16, -17, 6, 43, 51, -13, 174, 1, 
+	81, -46, 87, -20, -41, -35, 9, 125, 
+	26, -121, -136, 66, 31, 60, -70, 36, 
+	-45, -155, -48, -46, 7, -125, 71, -21, 
+	65, 52, -36, 72, -126, 91, 27, 42, 
+	-123, -70, -11, -14, 147, -52, 168, 75, 
+	96, -87, 151, 46, 73, -47, 96, -17, 
+	-187, -173, -48, 27, 28, 83, 62, 5, 
+	-64, -136, 8, 29, -31, 2, 104, -81, 
+	-175, 54, 49, 20, 51, -13, 26, -131, 
+	-40, -35, -46, -57, 2, 95, -20, 11, 
+	-207, -51, -70, -9, -72, -21, -100, -51, 
+	31, 15, -101, 45, -95, 70, 11, 6, 
+	-140, 4, -101, 129, -114, 99, 16, 106, 
+	-192, -233, -67, -39, -159, 47, -4, -70, 
+	101, 114, 79, 1, 67, 128, 54, 27, 
+	-138, 8, -97, 12, 30, 35, -160, -123, 
+	-69, 72, -105, -224, 26, -209, 102, 80, 
+	-32, 87, -1, -10, 119, 49, 49, -22, 
+	-8, -53, 34, 68, -19, 27, -172, 47, 
+	-95, -31, -16, -43, -55, -7, -29, 54, 
+	26, -116, -166, -133, 11, 17, -86, 55, 
+	-165, -69, -245, -92, 63, -1, 70, 36, 
+	-172, 146, -33, -42, -144, -189, -55, 20, 
+	54, 60, -22, -38, 61, 7, -130, 37, 
+	67, -68, 86, 4, 39, -67, -33, -48, 
+	-48, 89, -50, 65, -20, -16, -30, -90, 
+	-120, -38, -31, -6, 102, -4, 22, 14, 
+	-80, 0, -41, -73, 74, -171, -80, -73, 
+	-151, -129, -88, -108, 17, -136, -145, -66, 
+	-28, -71, -6, -47, 139, 52, -6, -36, 
+	116, -7, -75, -82, -27, -52, -105, -186, 
+	-174, 62, -6, 106, -115, -204, -173, 40, 
+	-140, -18, 28, -36, -33, 5, -17, -29, 
+	-85, -37, -26, 98, -21, 34, -32, -29, 
+	100, -65, 53, -3, -7, -58, 37, 20, 
+	-7, -7, -88, 27, -69, 81, 66, -10, 
+	-35, -37, -37, -37, -11, 7, 16, 30, 
+	-41, 15, -60, 141, -142, -22, -62, 71, 
+	-35, 86, -42, 116, 34, -84, 63, 87, 
+	12, 59, 25, 8, -64, -77, 21, 90, 
+	-97, -26, 6, -14, -158, -112, -92, 19, 
+	26, -51, 148, 32, 1, 83, -81, 55, 
+	52, -204, 32, 1, -75, 92, -91, -5, 
+	-18, -20, 54, -96, -19, -92, 60, 59, 
+	-59, 1, -134, -56, -168, -111, 160, 17, 
+	-87, 106, 36, -201, -34, 91, -25, 47, 
+	13, 40, 11, -80, -196, 23, 148, -64, 
+	8, 27, -22, -42, -105, -31, 61, -57, 
+	23, 121, -17, 39, 32, -51, -125, 11, 
+	21, -48, 93, -62, -43, 55, -53, 2, 
+	102, 7, 96, -4, -84, 13, -103, -31, 
+	103, -107, -48, -2, -52, 10, -53, 55, 
+	15, 167, -38, 64, -97, -113, 47, 42, 
+	136, 101, -95, -24, -88, -19, 43, -69, 
+	54, -67, 31, 71, -113, 196, 126, 17, 
+	97, -13, -5, -31, -70, -142, 44, 115, 
+	-168, 45, 16, -61, 13, -43, 7, 12, 
+	-20, -97, 7, -44, -68, 64, 77, 12, 
+	5, 13, -77, -57, -45, 60, -145, -43, 
+	6, -64, 110, 84, -5, 15, 14, 136, 
+	-18, -38, 116, -64, -33, -140, -96, 20, 
+	8, -3, -246, 2, -45, -14, -136, -79, 
+	25, -82, 106, 101, -82, -100, 47, 35, 
+	47, -1, -157, -25, -28, -147, 120, 8, 
+	35, -69, 4, -10, 84, -8, 206, 56, 
+	-147, 113, -123, -144, 23, 51, -63, 16, 
+	-189, 76, -106, 111, 48, -92, 36, 10, 
+	-65, -63, -2, -142, 49, -86, 40, 75, 
+	7, 10, 53, -3, -95, 105, -17, -24, 
+	-61, -98, -63, 91, -33, -12, 10, 27, 
+	18, -9, -80, -92, 105, 44, 44, -63, 
+	9, 101, 78, -127, 93, 72, -130, 30, 
+	20, -65, 22, 58, 49, 119, 98, 58, 
+	-2, 68, 49, -99, -61, 37, -7, 8, 
+	57, -78, 15, 46, -38, -123, -63, -45, 
+	-77, -46, 22, -20, -116, -40, 45, 112, 
+	108, -70, 16, -29, -150, 2, -101, -28, 
+	11, 11, -8, -27, 120, 45, -47, 5, 
+	83, -28, -31, -107, -26, -102, 9, -69, 
+	-98, 40, 55, -99, -126, -24, 78, -33, 
+	-144, -71, 18, 86, 94, -30, 57, -49, 
+	62, 2, 1, -200, 22, 57, -17, -75, 
+	-48, -14, 100, 20, -145, -34, -70, 88, 
+	-79, -22, 17, -105, -52, 122, 45, 32, 
+	85, -2, -47, 10, -122, -7, -61, -16, 
+	-90, 14, -73, 137, -30, 35, 153, 13, 
+	130, -85, -18, 6, -131, -182, 41, -116, 
+	-25, 27, 32, -7, -45, -8, -12, 66, 
+	-14, -62, -11, 37, 49, 100, 8, 109, 
+	-116, 125, 27, -56, 5, -22, 51, -16, 
+	52, -48, 43, 10, -19, -59, -54, -47, 
+	17, 102, 85, 36, -21, -133, 112, 57, 
+	106, 17, 43, -22, 21, -21, -27, -118, 
+	-53, -41, -29, -32, -99, -66, -91, -130, 
+	102, -76, -83, 37, 18, 24, -73, 19, 
+	-14, 41, -2, -4, 11, -104, 134, -102, 
+	35, -74, -98, -84, -77, 71, -36, 101, 
+	49, 61, -119, 26, 6, -74, -44, 28, 
+	0, -124, -142, 66, -20, -44, 25, 44, 
+	-141, 122, -17, 96, -18, -112, -63, 78, 
+	-43, -127, 10, 39, 119, -34, -95, 43, 
+	90, -11, 6, 0, -3, -15, -35, 26, 
+	-239, 4, -62, -185, -24, -116, -99, 104, 
+	-82, 16, -182, -168, 164, 15, -16, 84, 
+	39, -2, 82, -49, -37, -144, -105, -144, 
+	82, -75, 39, -20, 66, 40, -59, 16, 
+	33, -73, 22, -99, -91, -46, -24, -120, 
+	-128, 143, -70, -5, 2, -92, -82, -173, 
+	-114, 113, -19, 40, -61, -67, 73, 48, 
+	-105, -76, -36, -80, -91, -40, 43, 17, 
+	-33, -82, 50, 151, 158, -111, -121, 80, 
+	-40, -68, 2, 36, -27, -2, -87, -123, 
+	-75, -79, 40, 41, 42, -31, -18, -53, 
+	-69, -24, 51, -37, 43, 17, -38, -57, 
+	-48, -75, 55, 51, -24, -31, 53, 70, 
+	38, 95, -110, 93, 83, 14, 75, -95, 
+	16, 16, -64, 29, -64, -100, 40, -5, 
+	-112, -47, -32, -69, 7, 34, 41, -86, 
+	20, 50, 31, -8, 100, 124, 141, -115, 
+	-21, 113, -92, 17, -76, 88, -144, -90, 
+	28, 33, 16, -138, 33, -74, -78, -29, 
+	-5, 39, 88, -63, 31, 32, 47, -4, 
+	-18, 37, 40, 26, 165, 81, -62, 59, 
+	-1, -82, -45, -87, 77, 25, 69, 118, 
+	20, -154, -58, -71, -97, 47, -61, 44, 
+	7, -154, -47, 69, 86, 108, 65, -109, 
+	-54, 54, -27, -110, -21, 37, -90, 78, 
+	-82, 149, 28, -172, -12, -43, 77, -13, 
+	19, 32, 28, 5, 25, 7, -23, 20, 
+	-21, -58, -44, -14, 42, -47, -30, 34, 
+	40, -151, -97, -43, 7, 16, 17, -5, 
+	35, -60, -34, 18, -41, -44, -119, -153, 
+	33, -28, -15, 97, -96, -78, 14, -72, 
+	152, 39, 15, 31, 7, 35, 57, 29, 
+	107, 30, -87, 108, -29, 156, 139, 8, 
+	8, 72, 47, 20, -105, -87, -140, -7, 
+	-127, 125, 44, 72, -86, -230, -144, 11, 
+	-59, 71, 113, -8, 86, -83, 66, -72, 
+	41, 54, 24, 14, 172, 78, -143, -9, 
+	20, 33, -88, 29, 201, 15, -98, -34, 
+	5, 86, -130, -65, 28, 3, -52, -58, 
+	54, -28, 76, -20, -20, -17, 4, 177, 
+	-29, 45, -8, 67, 41, 34, 59, 131, 
+	58, 80, 18, -24, -3, -82, -32, 99, 
+	17, 121, -36, 24, 85, -83, -104, -5, 
+	96, -57, 71, -30, -1, -69, 109, -98, 
+	41, 2, -20, -11, 76, -11, -94, -18, 
+	35, 168, -23, 88, -48, -3, -71, -97, 
+	90, 59, 0, 107, 54, 120, -58, -79, 
+	-46, -13, -67, 65, 11, -88, -86, -24, 
+	43, 13, 105, 178, -58, 50, -36, 15, 
+	3, -83, -339, -103, 4, -98, 101, 113, 
+	-72, 1, 59, -36, 94, 39, -31, 24, 
+	-30, -189, -75, -106, -160, -22, 25, 29, 
+	-51, -47, 32, -75, -115, -2, 129, 38, 
+	-116, -16, -90, -24, -110, -33, -64, 32, 
+	21, 10, 57, -89, 33, -31, 120, -6, 
+	-24, -4, -331, -40, -45, 15, -11, -43, 
+	82, -158, -81, 25, 46, 51, 85, 62, 
+	13, -46, 58, 77, -96, 67, -89, -31, 
+	-8, 37, 240, -51, -17, 38, -80, -91, 
+	37, -124, 106, -41, -189, 26, 41, 24, 
+	-75, -22, -26, -118, -88, 20, 29, -102, 
+	47, -4, -88, 20, -7, 34, -25, 6, 
+	68, -22, -31, -9, -95, -27, 84, -76, 
+	6, 14, 54, -77, -114, 15, -3, -56, 
+	41, -185, 5, 58, 103, 75, -3, 33, 
+	-5, -34, 35, 49, -41, 4, -67, 16, 
+	-121, 72, 137, -37, -21, 227, -54, -123, 
+	74, -161, -141, 23, -137, 60, -27, 90, 
+	-70, 92, -95, 12, -89, -47, 20, 4, 
+	40, -57, -178, 9, -77, -153, -7, 81, 
+	35, 76, -52, -75, -16, -141, -145, -62, 
+	-52, -232, -197, 11, -116, -22, -35, -95, 
+	-59, -71, -28, -63, 103, 197, 83, -9, 
+	-35, -39, 39, -9, -56, 44, 9, 57, 
+	-31, 120, -95, 166, 0, -97, -88, -83, 
+	64, -78, -14, -70, -147, 49, -133, -52, 
+	-1, -4, -97, -139, -11, -60, 3, 59, 
+	-22, -53, -115, -159, -36, -224, -45, -25, 
+	-108, 5, -97, -79, 91, -118, 4, -57, 
+	-84, -99, 70, -72, 101, -55, -29, -165, 
+	66, -123, -28, 160, -74, 64, 73, 4, 
+	-121, -59, 135, 20, -66, 42, -2, -35, 
+	-46, 22, -98, 60, -5, -93, -93, 13, 
+	-42, -189, -55, 131, -130, 57, -51, -1, 
+	6, 29, 0, -5, -129, -50, 90, 34, 
+	22, -79, 85, -14, 22, -34, 147, -46, 
+	-2, -46, 63, -103, -51, -3, -34, 26, 
+	-34, 37, -73, -46, -73, 68, -95, -182, 
+	74, -358, -67, 250, 1, -132, 126, -50, 
+	-48, 37, 78, 11, -102, 14, -35, -99, 
+	-123, -22, -105, 41, 66, 25, 40, -4, 
+	-51, 13, -79, 64, -25, -24, 19, -19, 
+	-16, -90, -37, 57, -193, 89, 1, 70, 
+	-40, 36, 212, 9, -111, -11, 20, 94, 
+	-17, -88, 94, -108, -114, 40, -168, -123, 
+	-135, 1, -151, -3, 16, 95, -64, -71, 
+	-1, -205, -115, 93, -38, -59, 61, 12, 
+	67, -9, -18, -51, 158, -24, 24, -83, 
+	-41, 47, -68, -48, -31, 1, -53, 62, 
+	147, -48, 39, -71, 60, 32, -11, -2, 
+	-8, -86, 10, 67, 41, 87, -186, 39, 
+	156, -4, -27, 86, -43, -69, -19, -41, 
+	-40, 117, -42, 99, 22, -72, 78, -57, 
+	-193, -4, 41, 94, 96, 28, 68, 130, 
+	9, 153, 4, -56, -17, -26, -44, -49, 
+	65, 86, -37, 42, -16, 86, -54, 99, 
+	-61, 73, -214, -39, 21, -87, -86, 7, 
+	61, -105, 84, -55, -62, -13, -195, -39, 
+	-183, -17, 6, -183, 98, -20, -120, -23, 
+	31, -136, -115, -122, 60, -156, -30, -2, 
+	-167, 14, -136, -62, -83, -183, 20, 102, 
+	-116, -42, -31, -88, 94, 107, -52, 18, 
+	52, -11, 8, -36, 11, 68, -2, -112, 
+	-40, -53, -65, 69, -34, -159, -21, 92, 
+	-14, 131, -47, 55, 25, 16, -150, -31, 
+	-9, -157, -79, -90, -38, -44, -176, -74, 
+	-102, -74, -34, 86, 35, 29, -142, 88, 
+	-91, -101, -146, -62, 57, -113, -35, -146, 
+	-84, -73, -8, -23, -62, -145, -97, -38, 
+	-117, -107, -34, -27, 36, -59, -105, -39, 
+	34, -22, -68, 74, -116, 17, 123, -34, 
+	22, 19, -152, 78, -181, -202, -55, 16, 
+	169, 23, -94, -69, 56, 52, 21, -79, 
+	99, -169, 54, -45, 53, 97, 61, 25, 
+	19, 122, 71, 27, 125, 169, -58, 32, 
+	60, 52, -142, 94, -20, -105, -40, 92, 
+	102, 9, -114, -79, -89, -117, -11, 48, 
+	14, 36, -182, 45, -6, -21, -35, 6, 
+	47, 39, 59, -132, -142, 8, 9, -116, 
+	99, 110, 121, 10, -59, 46, 29, 68, 
+	19, 0, 112, 111, 56, -54, -96, -24, 
+	-60, -17, -36, -109, -28, 62, -91, -113, 
+	-40, -14, 62, -69, 90, -64, -18, -46, 
+	80, -111, -127, -164, -137, -41, 90, 18, 
+	107, -22, -117, -113, -13, -135, -63, 22, 
+	-22, -76, -240, -7, -56, 86, -64, -81, 
+	-8, 0, -18, 46, -14, 22, 93, -86, 
+	33, 45, -77, -29, -7, -218, 31, 6, 
+	-72, 38, -19, 39, -54, -67, -113, -52, 
+	-228, -138, 58, 47, -98, 27, 48, -98, 
+	69, 27, -108, 83, -8, 77, -159, 4, 
+	83, 59, -50, -58, -82, -121, 43, 12, 
+	-18, -182, -60, -119, 65, -215, 116, -67, 
+	-226, 8, -148, -71, -46, 63, -165, -49, 
+	22, -139, -30, 13, -48, 57, -8, 52, 
+	-53, -79, -188, 87, -136, -143, 64, 31, 
+	53, -114, 16, -32, -39, 46, 84, 178, 
+	6, 75, 24, 8, -49, -31, 161, -47, 
+	-1, 62, 104, 4, 101, 29, -82, 140, 
+	73, 18, 104, 56, 80, -31, 44, 58, 
+	113, -69, 77, 33, 5, 26, -82, 31, 
+	-51, 126, -133, 37, -97, -38, -58, 5, 
+	-103, -66, 114, -75, 55, 35, -26, 68, 
+	-14, -1, -20, -6, 48, -15, 12, 60, 
+	67, -15, -116, 21, -186, 104, 180, 90, 
+	-118, -80, 100, -90, 95, 54, 109, -29, 
+	60, -193, 8, -6, -77, -19, -114, 63, 
+	-61, -20, -22, 181, 1, 7, 24, 119, 
+	189, -85, 110, -55, 177, -20, 10, -53, 
+	-173, 76, -87, 16, -25, -7, -15, 108, 
+	-44, -109, 38, 39, -47, -94, -94, 15, 
+	37, -38, -88, 36, -11, 78, 120, -48, 
+	-12, -6, -114, -148, 93, -103, 39, 79, 
+	-52, -115, -10, 43, -113, 114, 76, -5, 
+	113, 97, -57, 43, -36, 58, -16, -84, 
+	-14, -118, 4, -54, 102, -131, 74, 70, 
+	29, -43, 30, -95, -78, 25, 104, 85, 
+	-224, 11, -55, -64, -6, -44, 88, -99, 
+	-93, 0, 63, 25, -49, -94, 36, -9, 
+	46, 98, -11, -9, 76, 142, 33, -86, 
+	107, 25, 16, 66, 24, 42, -114, -80, 
+	-1, 28, -94, 27, -34, -100, -83, 109, 
+	-62, 120, -52, 21, 60, 60, 122, -127, 
+	39, -101, -143, -97, -43, 5, -60, 94, 
+	14, 68, -30, 24, -12, 29, -75, 34, 
+	-6, -91, 66, 64, -32, 61, 66, 17, 
+	103, -80, -96, 56, 18, 20, -26, -13, 
+	-81, -26, 144, 96, 44, 12, -19, 97, 
+	66, 80, 17, 110, 67, 14, -152, -57, 
+	50, -41, -75, -16, 6, -109, 5, 12, 
+	-64, 66, 6, -37, -106, -29, 23, -81, 
+	1, -38, -85, 36, 39, -70, 46, 8, 
+	-41, 31, -90, 64, 174, -33, 145, 14, 
+	30, 11, 115, 70, -19, -47, -62, 6, 
+	105, 84, 75, 3, 125, -4, 1, 39, 
+	-120, -105, 86, 84, 10, 58, 68, -1, 
+	60, -68, 42, 108, 57, -28, -120, -26, 
+	131, -98, -61, -42, 110, -48, 7, -14, 
+	-95, 55, 20, 5, -38, 81, 92, -3, 
+	67, 135, -80, 147, -2, 57, -60, -218, 
+	-43, -27, -82, 122, 34, -13, 22, 112, 
+	91, 8, 163, -79, -12, 70, -23, -29, 
+	-8, 21, -73, 89, -2, 63, 30, 71, 
+	-26, -107, 132, 75, -64, 63, 11, -77, 
+	28, 74, 8, -24, -50, -23, -14, 155, 
+	76, -69, -125, -15, 69, -116, -98, -17, 
+	-143, -22, -68, 74, 127, 7, -41, 67, 
+	33, 60, 8, -85, -7, 19, -123, 32, 
+	-51, -2, -121, 68, 99, -96, -110, 0, 
+	154, -103, -142, -71, 14, 58, -18, 14, 
+	-68, 62, 12, -20, -69, -1, -11, -65, 
+	-41, -52, -170, 79, -47, -73, 61, 119, 
+	-14, 52, 65, 63, 5, -148, -25, -27, 
+	-70, -64, 0, -29, -9, 8, -44, -124, 
+	-121, 132, 3, -133, 92, 26, -48, -18, 
+	-109, 23, -118, -120, -24, -48, -82, -125, 
+	-148, -195, -148, -187, 130, -80, -45, 3, 
+	-53, -141, 116, -80, 108, 15, -89, -118, 
+	-9, 118, -143, 69, 15, -140, -70, -155, 
+	-195, -176, -49, 39, -145, -45, -72, 5, 
+	-31, -62, 10, 21, 57, -126, -45, -35, 
+	-109, -133, -48, 179, -106, -115, -154, -51, 
+	-94, -80, -116, -102, 36, 20, -116, 18, 
+	-86, -89, -56, -108, -11, 125, 17, -3, 
+	-199, -158, -41, 0, -15, -5, -165, -62, 
+	62, -80, 76, 85, 1, 68, -133, -125, 
+	34, -76, -130, 36, 71, 3, -45, -69, 
+	28, -62, -92, 93, -80, -64, -57, 0, 
+	-70, 93, -71, -63, 15, -27, 74, 50, 
+	55, 185, -66, -95, 170, 75, 64, -95, 
+	-61, 229, 11, 25, 122, 109, -164, 98, 
+	11, 30, -82, -97, 114, -65, -104, 106, 
+	57, 60, 43, 64, 86, 2, -144, 29, 
+	47, -41, 68, 69, 120, -167, -68, 43, 
+	-127, 190, 64, 46, -124, 118, 40, -100, 
+	29, -58, -18, 93, -116, -36, -31, 119, 
+	64, 38, -2, -150, 56, 53, 41, 8, 
+	-56, -85, 77, -51, 91, 141, -31, -3, 
+	-34, -33, -54, -9, 133, 96, -25, 0, 
+	50, 73, -242, -83, 17, -121, -73, -46, 
+	34, -193, -157, -136, 131, -162, -80, -72, 
+	-26, 6, -134, 64, 126, -96, -224, 142, 
+	-16, 87, -51, 62, -42, -83, -22, -65, 
+	20, -122, -163, 33, -238, -123, -72, 221, 
+	72, -13, 138, -89, 95, 150, -43, -95, 
+	-72, -82, -93, 124, 34, 35, -214, 127, 
+	-136, -100, -87, -46, -16, -70, 173, -30, 
+	-40, -124, -121, -108, -147, 112, -72, -7, 
+	-102, -7, -148, -167, 53, -78, -252, 30, 
+	24, -193, -115, 73, 112, 8, -163, 73, 
+	-87, 8, -184, -61, -78, 34, -16, -110, 
+	-109, 24, 48, 30, -3, -110, -155, 47, 
+	-100, 11, -11, 38, -8, 53, -18, 27, 
+	-27, -151, -17, -48, -31, -53, -36, 8, 
+	-31, -22, 22, -48, -102, 32, -90, -10, 
+	54, -81, 16, -83, -5, -63, -25, 22, 
+	-13, -39, -8, -39, -159, -143, 19, 37, 
+	-128, 108, -220, -81, -27, 112, 24, 53, 
+	65, -64, -17, 17, -64, 60, 46, 106, 
+	16, -57, -34, 5, 7, 86, -25, -26, 
+	2, 34, 10, -24, -96, 84, 2, -12, 
+	46, -81, 85, -159, -106, 15, 57, -121, 
+	54, 116, 16, 14, 99, -19, -61, -89, 
+	54, -86, -63, 55, -17, 73, 45, 91, 
+	13, 61, 66, -101, -32, 1, 21, -12, 
+	-46, 15, -67, 80, -24, 20, -46, -26, 
+	-121, -53, -77, -50, -85, 99, 20, -39, 
+	-165, -72, 42, 92, -47, -126, -70, -87, 
+	-41, -126, 94, 42, -35, 91, 53, -17, 
+	23, -16, -42, 40, -4, 75, 6, 64, 
+	82, -196, -142, 32, -49, -148, 37, -181, 
+	25, 32, -74, 122, -162, -44, 4, 74, 
+	105, -25, 9, -121, 42, 78, -82, 29, 
+	103, 42, -120, -31, 24, -57, -75, -99, 
+	23, -192, -74, -136, 83, -5, -36, -16, 
+	-124, -27, -15, -36, -13, -137, -42, -17, 
+	-39, -107, 1, -90, -30, -82, 127, 25, 
+	75, -160, -78, -94, -52, 58, 62, 45, 
+	65, 62, -18, -65, 13, -28, 49, 19, 
+	-32, 31, -4, 7, -107, -105, 59, 94, 
+	88, -5, 81, -111, 49, -77, -30, 7, 
+	-56, -17, -64, -49, -51, -12, -38, -36, 
+	-171, -114, -44, 63, -77, -59, -1, 39, 
+	28, 3, 26, -43, 3, -145, -43, 14, 
+	46, -140, -11, -100, -120, -9, 50, 1, 
+	-77, 26, 17, -34, -120, 87, 138, 2, 
+	58, 33, -98, 41, -8, -139, 74, -59, 
+	-155, 104, 64, -7, -179, 50, -9, 39, 
+	52, -44, 39, 52, -114, 43, -6, -73, 
+	-194, -4, 3, -35, 5, -57, 1, -86, 
+	-20, 31, -19, -2, -23, -83, -114, -102, 
+	-54, 21, 49, 4, 66, 33, -22, -67, 
+	-49, -92, -74, -75, -43, -83, -54, 1, 
+	53, -38, -146, -97, -29, -36, 16, 85, 
+	17, -147, -126, -42, -39, -245, 114, -33, 
+	-63, -13, -22, -59, -119, -117, -52, -15, 
+	-81, -28, -39, -29, -47, -31, -14, -48, 
+	-171, -4, 30, -36, -126, 25, 59, -84, 
+	-29, -48, -202, -129, 21, -41, -49, -55, 
+	-26, 11, 91, 74, 12, 67, -58, -74, 
+	-30, -87, -116, -89, -55, -70, 23, 115, 
+	31, 96, 37, -248, -35, 9, -63, -29, 
+	58, 73, 52, -40, 85, 19, 8, 65, 
+	-136, -15, -36, 22, -79, -81, -6, -25, 
+	4, 48, -55, 47, -31, -36, 6, -83, 
+	-149, -46, 0, -49, 8, -33, -24, -77, 
+	-97, -16, 139, -92, -30, -241, -174, -56, 
+	86, 37, -92, -28, 18, 54, 39, -59, 
+	53, -144, -84, -62, -13, -121, -95, -88, 
+	29, -5, -83, -75, -45, 33, -18, 35, 
+	67, 46, -64, -35, -150, -170, 34, -113, 
+	-144, -27, -99, -2, 36, 3, -151, 46, 
+	59, -70, -11, 77, -134, -139, -40, -90, 
+	-39, -18, 59, -146, -68, -119, 54, -78, 
+	-34, -131, -108, -81, -80, -107, -91, -32, 
+	2, -22, 16, 10, -27, 37, -61, -58, 
+	10, -160, 13, -49, -104, -24, -63, -2, 
+	112, 42, -142, 105, -85, -30, -97, 17, 
+	-164, 76, -90, -56, -70, -82, 6, -88, 
+	-103, -19, -91, -53, -2, -26, -64, 19, 
+	-68, -18, -94, -120, -53, 56, -31, -58, 
+	1, -134, 102, -113, 31, -152, 78, -120, 
+	-52, -69, -201, -139, -70, -76, -211, -96, 
+	-74, -61, 22, 76, -71, 4, -27, -64, 
+	87, -69, 79, -39, 69, 90, 87, 83, 
+	-59, 6, -59, 15, -30, -17, 17, -2, 
+	2, 48, 9, 95, 27, -24, 41, 35, 
+	-43, -86, -4, -39, -76, -12, 53, 109, 
+	92, 35, 138, -148, -18, 103, -85, 16, 
+	8, -56, -173, -92, -47, 89, 17, -85, 
+	-88, -43, -99, -59, 38, -95, -16, -130, 
+	-49, 43, -2, -24, 11, -88, 53, -34, 
+	56, -41, 77, -103, -30, 58, 27, 43, 
+	-31, -94, -60, 71, -211, 78, 63, -76, 
+	-71, 13, -106, 58, -108, -49, -97, -55, 
+	-50, -124, 70, -107, -90, -17, -4, 54, 
+	-76, -61, 56, 30, -17, 70, -71, 51, 
+	-44, -45, -185, -30, -21, -16, -3, -106, 
+	23, -68, 58, -25, -87, 12, 77, 1, 
+	52, -27, -81, -11, -23, -67, 50, -34, 
+	61, -3, 23, -7, 85, 58, 45, -17, 
+	18, -124, -4, -35, 14, 74, 67, -59, 
+	80, -48, -93, 18, -26, 80, -49, -62, 
+	78, 27, -12, 50, 96, -76, 40, 35, 
+	94, -17, -54, -62, 46, 24, -56, 67, 
+	-6, -95, -111, 54, -29, 74, -69, -9, 
+	-74, 5, 53, 63, -31, 43, 57, 48, 
+	-112, -61, 14, -25, -169, -104, 134, 19, 
+	-25, -12, 6, -12, 35, 43, 22, -11, 
+	-72, 113, -68, -34, -18, -65, -53, -28, 
+	-53, -27, -117, -1, -142, -20, -62, -63, 
+	-65, -6, -72, -20, 67, -65, 34, -34, 
+	17, 45, 24, 79, -135, -26, -20, -27, 
+	7, 30, 149, 89, -91, -85, 175, -55, 
+	-40, 0, 14, -38, 28, -43, -71, -101, 
+	-110, -84, -74, 94, 86, 12, -35, -61, 
+	-119, -138, 6, -9, 10, 24, -43, -6, 
+	48, 95, -43, 37, 12, 7, -71, 21, 
+	-29, -48, -78, 42, -88, -78, -32, 36, 
+	-88, -9, 0, -9, -30, -70, -7, -13, 
+	-54, -112, -41, 12, -134, 38, 51, -41, 
+	124, 17, -22, -26, -135, 28, 0, -76, 
+	-38, -1, 5, -133, 101, -49, -7, -67, 
+	41, 64, 11, -14, -10, -18, 26, -64, 
+	-126, -10, -2, -97, -13, 101, -48, -49, 
+	-9, 131, -46, 13, 30, 15, 96, -8, 
+	0, -56, -74, -70, -7, -47, -71, 29, 
+	6, 60, -73, 52, -46, 88, 18, -74, 
+	20, -84, 30, 40, 51, 48, -95, -60, 
+	112, -3, -163, 96, -65, 13, 38, -8, 
+	-83, 141, 51, -50, -9, 8, -114, -61, 
+	-20, -11, -169, -21, 37, -85, 12, -33, 
+	70, 101, -55, 79, 2, -54, -55, -17, 
+	89, -110, -38, -122, -120, -48, -35, -81, 
+	33, -103, -21, -42, -68, -11, -41, -79, 
+	-29, 15, -42, -74, 53, -106, -16, -121, 
+	-25, -28, -68, -35, -105, -126, -55, -48, 
+	-59, 11, 142, -107, -28, -29, -46, -35, 
+	27, -137, -7, 55, -12, 89, 95, 32, 
+	-105, -24, 39, 90, -105, -7, -89, 84, 
+	57, -125, -64, 46, -33, 4, -58, -150, 
+	3, -3, -89, -58, -137, -82, -3, -26, 
+	-56, 22, -1, -102, -103, -119, -123, -125, 
+	6, -79, 77, -18, -107, -96, -38, 10, 
+	82, -66, -14, -80, -22, -8, -14, 13, 
+	-121, -46, 53, 7, -75, 30, -48, 34, 
+	-3, -191, -19, -2, 39, -13, -115, 49, 
+	-79, -26, 12, 42, -52, -74, -39, -37, 
+	-15, 12, 10, 76, -7, 18, 162, 1, 
+	3, -103, -138, -53, 35, 9, -37, 35, 
+	11, -71, 58, 33, -80, 1, 64, 74, 
+	-2, -25, -97, -19, 35, -132, 30, 66, 
+	5, -52, -81, 24, 1, -53, 20, 38, 
+	-120, 22, 53, 49, 55, -56, 4, -9, 
+	0, 75, -23, -79, -41, -64, 11, 47, 
+	-18, 15, 19, 27, -64, 67, 28, -66, 
+	-64, 39, -86, 36, 88, 142, 48, 122, 
+	-160, 46, -264, -15, -7, 52, 48, -63, 
+	-48, -11, -19, 37, -49, -7, 31, -123, 
+	-62, 80, 136, -53, -56, -72, 55, 91, 
+	99, 135, -25, -62, 38, 73, -56, 70, 
+	-8, 6, -18, -12, 1, 33, 14, -62, 
+	80, 1, -35, -18, 27, -121, 61, -63, 
+	-17, -39, 101, -47, 114, 18, -65, -96, 
+	-30, -1, 77, 32, 104, 9, 106, 38, 
+	-122, 20, -106, -51, -28, 52, 198, -117, 
+	63, -143, 5, 73, 1, 14, -1, 14, 
+	-77, 0, 56, 66, -5, -5, 67, 35, 
+	106, 26, -53, 50, 63, -52, -10, -41, 
+	-67, 113, -221, 40, -22, 5, -54, 98, 
+	37, -28, -50, -19, 15, -96, -33, -76, 
+	-11, -78, -40, 2, -14, -14, -50, 7, 
+	37, -31, -48, 97, 109, 18, -57, 114, 
+	-161, -22, -72, -171, 102, -2, 110, -116, 
+	88, -83, 73, 117, -162, 0, -66, -4, 
+	18, -50, 4, 8, 82, -22, -8, -23, 
+	44, 52, 98, -16, -26, -18, -138, 8, 
+	-153, 83, -22, 32, 0, 29, -115, 38, 
+	84, 71, -2, 78, -19, -82, 123, 75, 
+	-61, 45, -44, -14, 43, -29, -18, 18, 
+	-24, 148, -40, 26, -5, -29, -33, -111, 
+	26, 70, -26, -27, 84, -35, 19, 135, 
+	-31, 58, -92, 26, 86, 32, 50, 1, 
+	-74, 65, -26, 94, 110, -240, -14, -138, 
+	-24, 18, -40, 91, -107, -100, 15, 38, 
+	-144, -130, -17, -142, 228, -29, -42, -20, 
+	-111, -17, -41, 46, 39, 27, -64, -32, 
+	-50, -65, -20, -43, 21, 38, -54, -125, 
+	83, 33, -106, 53, -129, -84, -168, -117, 
+	-1, 55, 88, 34, -115, -127, -3, -57, 
+	29, 42, -17, -58, 123, 105, -161, -33, 
+	-99, -58, -104, 11, 102, -194, -79, 17, 
+	-197, -169, 116, 73, 102, -91, -5, -33, 
+	60, -69, 33, -16, 141, -29, -76, 25, 
+	-2, -57, 83, 138, -20, -108, -2, -8, 
+	12, -22, -72, -32, -23, 9, 89, -28, 
+	19, 116, -106, -99, -137, -42, -28, -144, 
+	7, -74, 91, 47, -24, 93, -101, 28, 
+	-8, -12, -80, -29, -30, 45, -127, 26, 
+	-106, -150, -113, 91, 17, -67, 34, -12, 
+	-51, 4, 68, 121, -97, 56, 5, 13, 
+	-33, -7, -11, 22, -55, 45, 65, 99, 
+	-42, -61, 107, 67, 52, -83, 74, 156, 
+	-58, -20, -43, 55, 81, 79, 9, -170, 
+	121, 58, -134, -106, 3, -43, 14, 35, 
+	-110, -61, -103, 93, 3, -26, 35, -18, 
+	-167, -116, -14, -10, 23, 59, 5, -43, 
+	-85, -90, 26, -57, 104, 8, -139, -26, 
+	-126, -193, -162, -121, -46, -162, 16, 28, 
+	104, -105, 17, -57, 238, 32, -95, -23, 
+	-228, 111, 8, -55, -65, 178, -95, -66, 
+	58, 0, -40, -37, -71, -83, -44, 158, 
+	-102, 35, -132, -103, 88, -16, -100, -48, 
+	-91, -39, 90, -55, -17, 73, -15, -163, 
+	-78, 22, -23, -82, 94, 28, -76, 8, 
+	88, -78, -124, -71, 76, 48, 15, -75, 
+	-27, -77, -47, 0, -97, 20, -29, 7, 
+	73, -91, -112, 190, -32, -26, -44, 1, 
+	-192, 180, 63, -17, 15, -19, -31, -166, 
+	103, -51, -86, 33, 30, -121, 26, 139, 
+	69, -27, 166, 35, 98, 159, -4, 39, 
+	-78, -146, -5, -60, -5, -23, 46, -39, 
+	61, -85, -59, 83, -107, 24, 67, -102, 
+	19, -109, 12, 15, -148, 112, 47, 49, 
+	98, 39, -8, -57, -192, 115, 52, -95, 
+	-118, -15, 83, 121, 7, 11, 35, -150, 
+	-12, -95, 71, 78, -5, 12, -18, -197, 
+	55, 26, -65, 63, -12, -131, -19, 39, 
+	-11, -22, -31, -8, -40, -22, 100, -13, 
+	-99, 95, 77, 8, -62, 43, -9, -56, 
+	76, 82, 37, 29, 53, 3, 49, 6, 
+	-2, 64, -65, 85, -54, -108, 35, 8, 
+	-3, -61, 20, -139, 28, -106, 15, -41, 
+	-9, -74, -110, -82, 43, -29, -137, -65, 
+	58, -169, 39, -82, -19, 48, 15, -5, 
+	57, -1, 151, 0, -45, 55, -5, 18, 
+	51, -70, 11, 18, 37, 37, -2, -77, 
+	-101, 14, 86, 46, -36, 14, 82, -67, 
+	2, 1, 55, -16, -32, -4, -51, -58, 
+	39, 43, -45, -111, -102, 13, -20, -12, 
+	57, -115, -31, 68, 93, -47, 137, 24, 
+	-3, -67, 56, -84, 56, -17, 40, 69, 
+	16, 43, -95, -119, -65, 71, 87, -35, 
+	-12, -4, -23, -74, -39, -31, 37, 40, 
+	-44, 30, -82, 149, 78, -3, -69, 91, 
+	82, -136, -48, -173, -68, 8, 113, -58, 
+	10, -56, -6, -48, 39, 66, -113, -68, 
+	63, -36, -59, 63, -48, -65, -18, 115, 
+	108, -95, 5, 30, 6, 7, -28, -29, 
+	-258, 77, -92, -30, 19, 6, -26, -118, 
+	-43, -59, 8, 24, -56, 128, 62, 42, 
+	-143, -53, 61, -9, -111, 36, 17, 66, 
+	-79, -53, 44, -15, -31, 140, -10, 65, 
+	-114, 71, 4, -25, 48, 41, -50, 44, 
+	17, 96, -57, -1, 7, -37, 5, 29, 
+	-136, -28, 85, -5, -109, 161, -40, 151, 
+	74, 91, 81, 22, 29, 71, -11, 29, 
+	-36, -8, 94, 13, -68, 19, -12, 51, 
+	37, 70, -31, -109, 27, -133, -197, 18, 
+	0, -36, -52, -9, 42, -25, 34, 19, 
+	5, -79, 119, -106, -115, 39, 131, 155, 
+	-37, 65, -129, 57, -128, -27, 30, -30, 
+	7, -61, 19, 96, 74, -30, -49, -27, 
+	25, 74, 56, 31, 90, -41, 27, -66, 
+	23, -7, 33, 60, -37, 68, 16, 19, 
+	23, 41, -89, -138, 21, -22, -39, 18, 
+	-10, -29, -119, -42, 16, -95, -56, 9, 
+	-81, 33, -113, 28, 33, -28, -101, 26, 
+	-42, 95, -157, -49, -96, -150, -57, -32, 
+	0, 0, 76, 10, 73, -34, 128, -18, 
+	-20, -82, 111, -4, 12, 123, 1, 84, 
+	-199, 70, -82, 101, 87, 4, -99, 58, 
+	48, 22, -69, 28, -20, -134, -102, 7, 
+	84, 111, 127, 47, -78, -64, -87, 56, 
+	-134, 9, 73, -24, -95, -52, -120, -15, 
+	48, 18, -9, -41, 50, 86, 71, -76, 
+	-13, -1, -28, 19, 30, -104, -244, -80, 
+	-29, 6, -128, -66, 0, -45, 2, 119, 
+	-79, 10, -40, -83, -135, 5, 61, -32, 
+	117, 37, -72, 0, 89, -33, -78, -39, 
+	-90, 139, -102, 98, -98, -77, -35, -9, 
+	23, -9, -123, -22, 97, -120, 17, -47, 
+	109, -36, -134, 27, 12, 85, 98, 53, 
+	-19, 23, 101, -12, 8, 102, -40, 29, 
+	-189, 33, -109, 20, 103, -101, -118, -61, 
+	-161, -28, 18, -15, -95, -36, 0, -62, 
+	22, 36, 51, -18, -60, 59, -38, -19, 
+	-58, -129, -19, 24, -100, -159, -55, -57, 
+	-73, -93, -103, -54, -78, 75, -79, -11, 
+	-57, -107, -73, -33, -70, 62, 8, -72, 
+	-20, -7, -4, 51, 40, 6, 26, 42, 
+	36, -48, -91, 21, -27, 56, 30, -55, 
+	-24, 26, -46, -69, 56, -46, -57, -39, 
+	31, -36, 29, 19, 43, -47, 48, -4, 
+	6, 46, 84, -89, -49, 59, -45, 31, 
+	-152, -66, 58, -59, 122, 69, -63, 79, 
+	-110, -18, -87, 11, -104, 41, -49, -52, 
+	168, 34, -107, 81, -69, 14, 43, 107, 
+	-148, -15, 148, -123, 83, -51, -228, 19, 
+	7, -40, -89, -44, 9, -12, 109, 5, 
+	-33, -97, -89, -22, 22, -68, -96, -99, 
+	68, -108, -7, 95, -51, -37, -18, -101, 
+	-36, 30, -11, -84, -2, 35, 26, -33, 
+	64, -52, 28, -66, -79, 28, 39, -9, 
+	-42, 83, 90, -83, -47, -21, 52, 52, 
+	-27, 10, 33, -69, -101, 82, -29, 26, 
+	-113, -119, -86, 50, 35, 72, 77, -62, 
+	-36, -5, -80, -97, -101, -147, -120, -62, 
+	-55, 172, -108, -113, 84, -153, -145, -35, 
+	54, -50, 94, 38, -83, -124, -29, -45, 
+	46, -1, 81, 4, -78, 74, -6, -66, 
+	116, -91, -49, -39, 41, 53, -6, -97, 
+	-108, -25, 24, -87, 50, 15, 189, -73, 
+	-56, 65, 179, -25, -1, -73, -12, 45, 
+	-20, 79, 23, -80, 9, 153, 66, 150, 
+	139, -43, -48, 13, -191, -9, 31, 159, 
+	-7, -17, 92, 23, 138, 43, -107, -119, 
+	61, -142, 123, -134, -95, 30, -59, 17, 
+	-80, 87, -62, -158, -23, 87, -176, -102, 
+	131, -167, -149, -110, 44, -27, 23, -32, 
+	14, 41, -83, 20, -92, -156, 24, -2, 
+	32, -20, -198, -52, -124, 28, 90, 2, 
+	51, 8, 47, 3, -66, 118, 134, 43, 
+	-62, -107, -33, -85, -145, -26, -81, 96, 
+	32, -100, -43, -168, 32, -13, -105, -76, 
+	26, -201, 2, -32, -79, -52, -55, -9, 
+	42, 39, -61, -34, -44, -38, 55, -46, 
+	-45, -67, -28, 42, -28, 21, -83, -110, 
+	-32, -21, -46, -38, -18, -160, 77, -29, 
+	137, 7, -34, -49, -24, 23, 35, -38, 
+	-97, 27, 32, 59, -8, 127, -25, -19, 
+	41, -128, -125, 86, 50, 27, -80, -13, 
+	-33, -33, -44, -8, -17, -77, -112, -51, 
+	-41, 58, -105, 54, 18, 12, -238, 15, 
+	-201, 87, -126, -62, -196, -84, -73, -37, 
+	18, 58, -39, -68, 43, 133, -61, -121, 
+	-33, -33, -44, -14, -13, -26, 58, -35, 
+	72, -103, 98, -16, 73, -8, 36, 1, 
+	46, 74, -118, -2, 35, -27, -23, -34, 
+	-34, 12, 100, 29, 1, 107, -124, 91, 
+	38, -54, -11, 0, 30, -118, -8, -102, 
+	-1, -190, -46, -86, 47, -17, -7, -68, 
+	-56, 31, 25, 29, 73, 88, -81, -55, 
+	39, -62, -93, 112, -101, -27, -72, -41, 
+	-81, 15, -57, 1, 76, 35, -38, -61, 
+	27, 149, 12, 21, -35, 31, 67, 0, 
+	-19, 101, -69, -109, 10, 71, 6, -79, 
+	-155, 14, 71, -104, -62, 6, -57, -32, 
+	-5, 166, 60, 147, -8, 16, -244, -100, 
+	122, -110, -19, -59, -50, 34, -198, 105, 
+	-182, 6, -24, -30, -138, -192, -71, -163, 
+	-39, -32, -82, -29, -43, -182, 13, -150, 
+	-58, 92, -204, -27, -203, -154, -37, -11, 
+	-1, -135, 19, -130, 34, -1, 39, -153, 
+	87, -47, -65, 111, 40, 174, 209, -198, 
+	-115, 7, 109, -145, 72, -58, -147, 112, 
+	-20, 50, 43, 191, 36, 70, -25, -78, 
+	-133, -53, 53, -13, 51, 14, -170, -62, 
+	-29, -29, 73, 63, -66, 44, -175, 101, 
+	25, 183, -7, -127, 40, -93, -3, -89, 
+	38, -45, -146, 12, -11, -163, -182, -55, 
+	31, -141, -171, -59, -36, 67, -185, -97, 
+	104, 98, -83, 171, -7, -48, 85, 19, 
+	41, 127, -24, -78, -115, -45, -63, 4, 
+	45, 102, -255, -81, 48, -45, -150, -33, 
+	-1, -78, 87, 11, 77, -54, -41, -137, 
+	-19, 16, 83, -13, 156, 107, -28, 137, 
+	-112, -104, -115, -133, 66, 33, -108, -28, 
+	-1, -92, -102, -109, 93, -106, -217, -8, 
+	-101, 43, 56, 120, 112, 87, -36, 5, 
+	-9, 139, 66, -39, -52, -90, 16, -57, 
+	82, -58, -30, -31, -74, -68, 38, 50, 
+	95, 34, -7, 157, 11, 66, -96, -4, 
+	-58, -132, 16, -48, -99, 24, -62, -56, 
+	-51, -80, -104, -13, -20, -89, 98, -88, 
+	-15, -82, -86, -51, -103, 17, 49, 30, 
+	36, -88, 4, 84, 53, 65, 57, 91, 
+	112, -119, -20, 100, 40, 102, 31, -141, 
+	123, 2, -91, 118, 128, -40, 108, -4, 
+	65, -57, -57, 46, -29, -11, 55, 13, 
+	60, 113, 81, -47, 75, 89, 97, 40, 
+	97, -11, -172, -16, 138, 0, 0, 53, 
+	-119, 157, -16, 148, 59, 50, 24, -28, 
+	44, 107, -85, 67, -55, 114, 35, 71, 
+	-52, 101, -2, 12, -95, 41, 85, -52, 
+	90, -40, 187, 144, -4, 50, 43, -4, 
+	6, 84, -37, -73, 19, 65, 121, -16, 
+	2, 10, 64, 0, 67, 119, 2, -26, 
+	101, 57, -141, -59, 57, -191, 35, 116, 
+	50, 21, 48, -90, 86, -35, 146, -115, 
+	-39, -40, 40, 60, -55, -50, -158, 96, 
+	42, 50, -70, 47, 89, 17, -15, 11, 
+	-82, -86, 27, 42, -15, 67, -95, -14, 
+	-33, -54, 126, 88, 4, 49, 21, -43, 
+	-105, 89, -4, -18, -100, 4, -12, 15, 
+	-130, 50, 16, -98, -65, -52, 114, 92, 
+	38, -8, 2, -77, -89, 53, -22, -68, 
+	88, -19, 35, 149, -4, 4, -10, -35, 
+	0, -77, -107, -123, -88, -164, 59, -26, 
+	44, 0, 75, 24, -122, 20, 87, -25, 
+	61, 33, -2, -30, -18, 84, -54, 43, 
+	-73, -69, 26, -53, -161, -12, -4, -35, 
+	31, -73, -41, 8, 108, -3, -47, 113, 
+	-127, -104, -54, -51, 16, 42, -5, -100, 
+	-145, 105, -133, -20, -105, 13, 7, 14, 
+	-93, -41, -133, 16, -12, -70, -27, -59, 
+	60, 38, -24, 48, 11, 103, -35, 76, 
+	34, 135, 99, 177, 82, -91, -21, 27, 
+	-71, -59, 1, 3, 91, 77, -182, -72, 
+	55, 48, -70, -135, -50, -61, -113, 140, 
+	-45, -87, -9, 64, 77, 1, -19, 112, 
+	64, -20, -104, -60, 35, 48, -8, -9, 
+	54, -55, -123, -62, 65, -42, -59, 58, 
+	28, -98, 74, 43, -37, 26, 14, 34, 
+	13, -43, 67, 38, 102, 92, -201, -49, 
+	18, -70, -105, -10, -67, -71, -15, -64, 
+	-249, 51, -150, 68, 105, -3, 24, -59, 
+	30, 4, 52, 15, -50, 14, -44, 115, 
+	-127, -102, 106, 40, -66, -111, -1, -4, 
+	24, 57, -59, -50, 2, -107, 63, 57, 
+	-21, -64, -84, -97, -169, -76, 3, -43, 
+	-74, -14, -102, -6, -10, -96, -93, 28, 
+	-123, 17, -47, -41, -172, -153, 67, -59, 
+	114, -78, -83, -84, -15, -54, -60, -82, 
+	-129, 32, -95, 20, -76, -54, -60, 90, 
+	57, -113, -184, 20, -208, -54, -41, -109, 
+	-127, -11, -36, 33, 31, 134, 64, -74, 
+	-59, -53, -103, 36, -68, -49, -95, -24, 
+	-26, 85, -155, -146, -28, -109, -118, -88, 
+	-137, 0, 82, 27, 4, -50, -40, -79, 
+	-148, 142, -13, -94, 58, 116, -114, 64, 
+	-114, 85, 36, -146, 55, 20, -50, -13, 
+	37, -178, -73, 58, -135, 17, -61, -60, 
+	60, -73, -233, 91, -81, 13, -125, -72, 
+	-58, 108, 128, -80, -107, -57, -198, -113, 
+	64, 108, -129, 31, -93, -109, -26, 126, 
+	-25, -42, 77, -173, 3, -62, 33, 111, 
+	36, -53, -52, -14, -65, 184, -33, -75, 
+	96, 92, 78, 35, 175, -14, -96, -106, 
+	-11, -76, -36, -100, -16, 28, 156, -50, 
+	96, 6, 6, -151, 43, -58, 44, 23, 
+	95, -124, -6, 128, -122, 17, -25, -7, 
+	-117, 13, 82, 27, 35, -78, 14, -58, 
+	-120, 3, -163, -24, -94, -129, -25, 98, 
+	-125, 35, -193, 99, -47, -7, 23, -63, 
+	108, -70, -125, -18, 164, 28, -182, 42, 
+	-57, 86, 22, -148, -34, 73, -117, -75, 
+	27, -43, 5, -13, 32, -65, -30, -52, 
+	-52, 98, -42, 65, -55, -233, 50, -42, 
+	114, -142, 18, -43, 69, 42, 43, 0, 
+	-90, 118, 8, 46, -42, 63, -46, -56, 
+	-8, -25, 44, -15, 82, -5, -130, 112, 
+	54, 58, 17, 114, 68, -43, -80, -92, 
+	170, -4, 113, 182, -105, -87, -54, -32, 
+	-63, -65, 9, -160, 119, 85, -99, 0, 
+	90, -6, -114, -79, -71, 7, -7, -53, 
+	24, 37, -39, -124, 151, -71, 35, -28, 
+	15, -31, -194, -178, -67, -21, 26, 3, 
+	-41, 53, -45, 97, -82, 91, 12, 152, 
+	-158, -124, -163, -80, -145, -14, -1, 90, 
+	-9, 47, -4, -71, -160, -50, -114, -168, 
+	104, -31, -38, 256, -23, 59, 20, 51, 
+	73, -71, -137, -153, 31, -21, 19, -18, 
+	28, 134, -33, 148, 20, 118, -116, -101, 
+	-124, 11, -26, -48, 57, 65, 102, 14, 
+	74, 13, -167, 16, -39, 33, 82, -5, 
+	-210, 54, 5, 170, 29, 62, -3, 90, 
+	17, -105, -118, 43, 20, 81, 14, -133, 
+	-105, -67, -84, 86, 102, 89, 193, 107, 
+	-112, 59, -33, -49, 90, 35, 34, 62, 
+	-68, 136, 52, 117, 75, -5, -161, 23, 
+	-53, 61, 19, -8, 22, 16, 42, 185, 
+	81, 62, -1, -121, -107, 105, -85, 62, 
+	91, 0, 48, -6, 97, -54, -112, -111, 
+	-26, 65, -53, -134, -37, 21, -5, 30, 
+	-6, -16, 60, 12, -7, -106, -37, 50, 
+	-28, 2, 19, -63, 69, 65, 49, -17, 
+	-145, 7, -7, 67, -5, 10, 121, -61, 
+	16, -156, 83, -71, 82, -57, -97, 78, 
+	-69, 47, -10, 67, 63, 10, 73, 117, 
+	92, -102, 3, -119, -21, 14, 19, 0, 
+	-46, 30, -145, 149, -61, -1, -18, -91, 
+	-42, 92, 20, 3, 29, -1, -5, -121, 
+	-77, 10, 13, 30, 75, -89, -9, 74, 
+	82, -38, 68, -13, -8, 188, 129, 86, 
+	-114, 7, -59, -115, 137, 66, -16, 22, 
+	33, -26, 62, 100, -11, -78, -10, 35, 
+	21, -47, 78, -108, -21, 28, 8, 7, 
+	117, -58, -6, -109, -76, 15, 8, -37, 
+	-6, -33, -92, 37, -94, -9, -45, -90, 
+	-86, 160, -8, -113, 39, -37, -69, -93, 
+	-129, 126, 16, 1, 60, -9, 64, -66, 
+	-258, 111, -147, 25, 31, -96, -24, 29, 
+	-167, 109, 54, -95, 23, -166, -18, 59, 
+	71, -70, 1, 15, 21, 15, 100, 99, 
+	-79, -26, 195, 128, -8, -75, -143, -64, 
+	-95, -49, -19, 48, -75, 40, -119, -29, 
+	-56, 7, -62, -11, -28, -96, -46, 10, 
+	112, 40, 37, 153, 27, -4, -13, 61, 
+	40, -5, -44, 22, 6, 29, 18, -105, 
+	-55, -18, -93, 53, 114, -110, 23, -12, 
+	-71, 62, -32, -79, 105, 85, 31, -41, 
+	129, -67, 31, 45, -124, 12, -35, -14, 
+	-167, 171, 97, 140, 81, 2, 103, -66, 
+	-79, 104, 101, 194, -80, 22, -20, -28, 
+	-36, 124, 51, 1, -126, -20, 2, -3, 
+	57, -119, 112, 154, -25, -284, -128, 36, 
+	58, -110, -17, 23, 214, 74, 74, -112, 
+	-100, -28, -181, -107, 117, -133, -87, -44, 
+	-16, 93, -69, -67, 26, 44, 64, 2, 
+	-24, -23, 104, 118, -28, 7, -79, 53, 
+	-134, 91, 69, 67, -67, -8, 30, 4, 
+	-2, 37, 77, 80, -57, -53, 123, 69, 
+	-79, 5, -59, 1, -219, -25, -87, -106, 
+	-136, 26, -1, -5, -89, -123, -12, 137, 
+	132, 49, -205, 12, 32, 95, 6, -130, 
+	-15, 70, -70, 59, 51, -83, -10, -36, 
+	-116, -161, 15, 3, -67, -7, 96, -4, 
+	47, 42, 5, -39, -76, -11, 36, -15, 
+	-26, -61, 56, 1, -91, -96, 10, 62, 
+	18, 27, 90, -77, 132, 35, -45, 39, 
+	-96, 69, -37, -25, 153, -30, -74, 72, 
+	77, -103, -3, 117, 6, -61, 66, -73, 
+	-145, -54, -92, 4, 46, -25, 84, 37, 
+	85, -29, 35, 29, -67, 43, -24, -36, 
+	-11, -52, -14, -96, -43, -6, 58, -80, 
+	-30, 228, -77, -20, -48, -40, 55, -131, 
+	-97, 12, 8, -68, -39, -85, 17, 3, 
+	27, -87, 102, 58, -119, 49, -32, 17, 
+	-179, -130, -52, 38, 30, 28, -44, -5, 
+	194, -51, -41, 109, 79, -132, -32, -90, 
+	-192, -27, 160, 106, 5, 101, 30, 52, 
+	-30, -172, -2, 99, 50, 138, 32, 39, 
+	8, -91, -206, -56, 24, 16, 10, -9, 
+	75, 55, -160, -2, -44, -136, 133, -60, 
+	-25, -11, 68, -13, -214, -104, -78, 31, 
+	59, 2, -23, -95, 79, 122, 1, 55, 
+	-37, 15, 188, 20, 11, -53, -37, 0, 
+	92, -49, -206, -49, -43, -115, -24, -38, 
+	-133, 26, 22, 68, -56, 1, 0, -61, 
+	-109, 94, -204, 36, 84, -22, 22, 15, 
+	-58, -95, 86, -145, -46, -31, 18, -29, 
+	37, -122, 26, 93, 45, -42, -35, 102, 
+	-38, -97, -45, -23, -15, -115, 25, -64, 
+	55, 67, 61, 146, -111, -1, 17, -46, 
+	-40, -3, -135, -37, 33, -47, 61, 67, 
+	72, -144, -39, 18, -99, -89, -8, -3, 
+	13, -132, -109, -19, 6, 20, 24, 28, 
+	88, 17, 32, -7, 64, 46, -84, 40, 
+	67, 33, -48, 37, 49, -34, 46, 78, 
+	-34, 66, 29, -82, 34, -56, 110, -49, 
+	43, 78, 74, 101, 86, -47, -81, -63, 
+	51, -16, 68, 81, -155, -88, -20, 27, 
+	-42, 32, -143, 103, -111, -85, -36, -137, 
+	66, -60, -49, 69, 8, 79, -127, -15, 
+	58, -135, -104, 52, 48, -58, -135, 2, 
+	24, -27, -112, -101, 17, 6, -21, 116, 
+	37, 100, 3, 10, 165, -89, -56, -43, 
+	-146, 103, 77, -23, 177, 76, 109, 66, 
+	31, 234, 53, 16, -72, 89, -90, -23, 
+	7, -88, -30, 55, 90, 85, -212, 59, 
+	-39, -120, 116, 52, 67, 21, 11, -26, 
+	-131, 113, -98, -46, -42, -101, -192, -72, 
+	49, -18, -34, 63, 78, -102, -18, 72, 
+	1, 65, -9, 49, -89, -108, -40, -203, 
+	-3, -127, -53, -39, -79, -20, -58, 14, 
+	-44, 31, -76, -64, -57, 66, 29, -139, 
+	-4, -183, -153, -79, 20, -103, -19, -104, 
+	-163, -16, -17, -104, -8, -109, 110, 2, 
+	-254, -64, 162, -46, -133, 36, -13, 69, 
+	63, -149, 77, 106, 32, 96, -1, 38, 
+	-120, -176, 28, 26, -128, -14, 87, -133, 
+	-38, -85, -18, -12, 36, 170, -40, -123, 
+	-68, -88, -56, 2, 18, -1, -99, -23, 
+	12, 47, -20, -2, -80, -128, -57, 40, 
+	41, -36, 5, 33, 10, -43, -5, 43, 
+	66, 56, -58, -22, -83, -16, 6, -30, 
+	1, -50, 19, 23, -95, -8, 49, 1, 
+	-51, -182, 45, 22, 18, 38, -78, -4, 
+	-93, -26, 87, -25, 5, 23, -40, 86, 
+	-7, 9, -115, -66, 133, -60, 57, 71, 
+	31, 28, 109, -85, 78, -121, 131, -61, 
+	16, -38, 146, 100, 24, 71, -76, 109, 
+	-68, 94, 25, 33, 69, -51, -7, 43, 
+	115, -21, -74, -64, -69, 84, 112, 49, 
+	-46, 73, 118, 38, 46, -66, -43, 29, 
+	-54, 132, -45, -30, 75, 40, -31, 11, 
+	7, 166, -138, -2, 17, -26, 119, 67, 
+	17, -5, -26, 35, 59, 99, 52, 32, 
+	-161, -89, -40, -41, -38, 93, 98, -132, 
+	75, -152, -26, 96, -63, 17, 7, -88, 
+	90, -55, 51, 43, -94, -55, 100, 144, 
+	44, -72, -74, -118, 24, -74, -59, 20, 
+	-270, -33, -63, -6, -45, -31, -58, 38, 
+	22, -150, -33, 67, -7, -165, -46, 58, 
+	-166, 108, 109, -77, 67, 88, -19, -50, 
+	14, 47, -123, 26, -54, 9, -111, 0, 
+	-124, 51, -37, 14, -50, 30, 21, -92, 
+	82, -183, 3, -42, -19, -19, -148, -28, 
+	-7, -120, -11, -109, -47, -237, 27, 25, 
+	126, -115, -45, -138, -29, -118, 43, -102, 
+	-152, -83, -92, -128, 90, 66, -122, -54, 
+	-9, -132, 64, -73, -35, -102, -29, -22, 
+	-113, 41, -82, 62, -4, 15, -55, -49, 
+	-87, 79, -206, 154, 39, -105, 67, 56, 
+	58, -126, -11, -30, -152, -34, -30, -125, 
+	23, -239, 32, 26, -54, 95, -182, -49, 
+	223, -119, -55, 60, 68, -197, 42, -44, 
+	-58, -90, 48, -26, 17, -98, -88, -4, 
+	-152, 115, -143, -142, 123, 55, -38, -85, 
+	173, -135, 28, 113, -74, 62, 241, 175, 
+	26, 71, -102, 81, -9, -58, 121, 130, 
+	3, -48, 77, -16, -93, -64, -21, 35, 
+	-4, -36, 78, -39, 67, 161, -84, -74, 
+	54, -127, 24, 36, 100, 105, -161, 54, 
+	-33, 28, 10, -11, -1, 66, 80, 19, 
+	18, -43, -28, 8, 55, -22, 0, 76, 
+	-168, 24, -48, -38, -39, 54, -38, 68, 
+	-141, -102, 130, 7, 7, 18, -10, 109, 
+	-37, 80, -121, 81, -18, 27, 89, 62, 
+	-86, -65, -51, -174, -130, 30, 9, -1, 
+	-3, -22, -70, -40, 1, 55, 6, 15, 
+	-13, 63, -49, -16, 28, -21, 77, -16, 
+	-14, -23, 52, 2, -148, 32, -2, -1, 
+	-22, 82, 59, -78, -125, -115, -112, -16, 
+	126, 96, 59, 27, -148, 17, 47, -69, 
+	-68, -119, 89, -151, -111, 18, 52, -17, 
+	38, 66, 12, 35, -109, -91, 64, -62, 
+	-106, 32, 62, -47, -149, -60, 18, -2, 
+	-89, 108, -80, 154, -35, 14, -30, 101, 
+	-66, -147, -91, -146, -28, -89, -22, 59, 
+	-3, -67, 21, -91, 23, 123, 73, 129, 
+	60, -3, 97, -2, 46, 146, -125, -50, 
+	75, 28, 23, 127, -91, -19, -27, -95, 
+	-100, 94, 10, -64, -87, -81, -136, -23, 
+	17, -156, -64, 19, -1, 41, 44, -81, 
+	-55, 29, 119, -10, -47, -40, 9, -60, 
+	103, -24, 32, -70, 17, -45, 64, -19, 
+	-7, 56, 21, -21, -16, -85, -9, -92, 
+	24, 38, 8, 3, -90, 135, 88, 36, 
+	7, 28, 3, -47, 11, 100, 19, 45, 
+	-144, 101, 12, 27, -63, -75, 113, 95, 
+	-71, -20, 114, -4, 51, -104, -140, -2, 
+	-36, -36, -28, -23, 108, 123, 83, -29, 
+	-71, -39, 29, -55, 138, 116, -65, 23, 
+	-106, 53, -24, -52, 13, -108, -32, 49, 
+	-111, 185, -50, 45, 23, -141, 98, -108, 
+	-3, -17, -36, 57, -18, -100, -53, -50, 
+	-59, 10, -101, -23, 28, -63, 26, 89, 
+	55, -127, 24, 86, -20, -28, 110, -23, 
+	76, 16, -49, -55, -45, -4, -80, -168, 
+	-88, -34, 86, 78, 71, -4, -70, 53, 
+	40, -13, 168, 39, 108, 92, -43, 8, 
+	-99, -25, -105, -144, -3, -67, 0, 124, 
+	-76, -12, -13, 5, -96, -104, 168, 15, 
+	-153, 44, -22, 112, 103, 41, 21, -122, 
+	-119, -27, -83, 122, 110, -43, -65, -71, 
+	24, -56, 37, -27, 88, -72, -66, -26, 
+	34, -58, -47, -22, 88, -17, -40, -119, 
+	-119, -93, -38, -18, -86, -54, 76, -67, 
+	83, -81, -73, -126, 45, 14, 140, 142, 
+	-95, 169, 69, -43, 42, 45, 99, -63, 
+	12, -78, -63, 32, 55, -15, -63, 66, 
+	30, 26, 71, -31, 32, -152, 14, 88, 
+	28, -86, -37, -20, 94, 10, 52, -13, 
+	-57, 2, -144, -18, 16, 2, 47, -31, 
+	27, -182, -30, -47, -144, -110, 0, 93, 
+	46, -1, -27, -12, -39, -61, -106, 107, 
+	78, -51, 66, -38, 26, 27, 152, 105, 
+	-52, -69, -57, -77, -87, 55, 77, 54, 
+	-41, -32, -20, 131, -27, 59, -54, -32, 
+	54, -12, -42, -10, -12, -55, 32, -33, 
+	-42, -24, -73, -26, -37, -44, 33, 64, 
+	-33, -60, -66, -106, 29, 118, 12, -84, 
+	-23, -64, -43, -54, 34, 24, 82, 37, 
+	-28, -58, 44, 9, -117, -12, -26, 144, 
+	71, 58, 148, 17, 42, 54, -106, -19, 
+	99, -171, 87, -27, 54, 40, 11, 65, 
+	32, 0, -12, -116, 87, 4, -124, 40, 
+	-52, -26, -42, -23, -61, -23, -93, -65, 
+	16, 23, 36, -24, -88, -98, -173, 42, 
+	128, 49, -40, 12, 97, 49, -73, 86, 
+	-28, 105, -71, -128, -15, 120, 51, -52, 
+	-36, 101, 0, 29, 75, 10, -52, 97, 
+	-79, 38, 9, 7, 60, -3, -53, -63, 
+	-85, 203, 51, 9, -40, -36, -41, -17, 
+	-69, -12, 20, 29, -98, 30, -34, 4, 
+	66, 1, -24, -58, 50, 30, -37, 56, 
+	9, -8, 36, 127, -73, 93, -1, -24, 
+	53, -79, 48, -46, -57, -50, -85, -51, 
+	47, 33, -17, 7, 47, -18, -13, -47, 
+	115, -77, -79, -131, 91, -107, 30, -24, 
+	-13, -172, 54, 78, 6, -33, 75, -37, 
+	-73, 87, -116, -33, -33, 81, 98, -26, 
+	52, -35, 33, 69, -60, -166, 75, 64, 
+	106, -35, 59, 48, -42, -19, -26, 33, 
+	-23, -50, 126, -24, -205, 110, 64, -78, 
+	-21, 12, -28, -18, 9, 97, -23, -194, 
+	121, -131, 74, 36, 108, -65, 18, 9, 
+	-33, 31, -53, 69, 40, 72, 55, 3, 
+	37, -64, -63, -84, 21, 75, 44, 5, 
+	-114, -151, -10, -119, 82, 6, 96, -73, 
+	76, -20, 4, 88, -35, 60, -75, 47, 
+	-31, -42, -15, 45, -29, -95, -16, 113, 
+	135, -108, 30, -59, -133, -51, -17, -3, 
+	-78, 19, -130, 91, -169, -32, -82, -35, 
+	-45, -33, 31, 8, -159, -30, -35, 57, 
+	-18, 31, 30, -98, -2, 40, 38, -148, 
+	-44, 14, -81, 90, -59, -47, 61, -71, 
+	-37, -99, -88, 18, -143, -175, -201, -12, 
+	-148, -35, -109, -59, 91, -27, 4, -41, 
+	-95, -38, -66, -77, 111, 32, -21, -45, 
+	-212, -41, -4, -91, 144, -94, -133, -84, 
+	97, -76, -29, 22, 60, -107, -45, -56, 
+	-106, -41, 47, 113, 34, 85, 1, -115, 
+	-70, -4, -86, 23, -84, -62, -34, -39, 
+	26, 1, -157, 11, -10, -93, 54, -170, 
+	7, 51, -125, 73, -6, 29, -63, 68, 
+	-58, -164, 1, -135, -103, -136, -22, -14, 
+	4, 124, -20, 28, -86, -35, 29, -26, 
+	-121, 9, -42, 29, 19, 84, -3, -15, 
+	16, -123, 106, 10, -49, -25, -25, -143, 
+	76, -146, 69, 57, 21, -39, -40, -24, 
+	-136, -114, -13, 20, 25, 58, 25, -101, 
+	-201, 9, -147, -136, 85, -86, 56, -15, 
+	-7, 8, -87, -71, -27, -20, -10, -49, 
+	-103, -42, 4, 43, -14, 18, -116, 34, 
+	-54, 44, -14, 17, -1, -102, 54, -30, 
+	-37, -13, -140, -91, -50, 145, 111, 61, 
+	-170, 20, 45, 23, 34, 9, 9, -12, 
+	75, -28, -41, -56, -13, -25, 30, 22, 
+	-117, 145, -21, -98, -72, 42, -11, -124, 
+	35, 41, 47, -20, 106, 100, 15, -84, 
+	103, 62, -72, -65, 73, -66, 63, -11, 
+	-75, 75, -33, 77, -4, -68, 58, 18, 
+	-17, 54, -41, -36, -19, 31, -28, 49, 
+	97, -62, 20, -99, -42, 12, -34, -66, 
+	98, -136, -78, 7, 109, 31, 5, -116, 
+	-27, 118, 10, -134, 8, -62, 18, -88, 
+	-86, -4, -110, -69, -33, -144, -125, 36, 
+	-87, -32, 25, 88, 14, 60, 32, -14, 
+	-6, 45, 15, 18, -6, -12, -4, 20, 
+	-26, -73, 20, 124, -59, 45, 10, -61, 
+	-51, -80, -52, -52, 19, 115, 95, -94, 
+	-163, -12, 12, 77, 1, -59, -175, -24, 
+	-11, -34, -201, -152, -64, 0, -152, -11, 
+	49, 45, -66, 11, 37, 41, -4, -61, 
+	-63, 56, -62, 34, -105, -45, 40, -43, 
+	19, -41, -24, -11, -100, -110, -50, -55, 
+	42, -9, -47, -10, 116, 42, 95, -4, 
+	95, -127, 67, -75, -72, -65, -61, -41, 
+	-226, 120, 97, 85, -1, 127, 53, -20, 
+	19, 31, 60, 20, -52, -28, -54, -21, 
+	4, 113, -165, 95, 22, -27, 5, 32, 
+	-85, 102, -65, -16, 87, -157, -2, -17, 
+	-76, 15, -156, -126, 133, -58, 7, -21, 
+	-17, 10, -5, -52, -72, -92, -26, -120, 
+	12, -64, -88, 5, -33, -1, 74, 79, 
+	-79, 48, -14, -16, 30, -11, -18, -9, 
+	58, -74, 85, 77, 28, -122, -80, -94, 
+	-95, 46, -57, -132, -37, -103, -74, -27, 
+	-46, -43, 23, -69, 95, -46, -67, -72, 
+	10, -69, -81, -3, -53, 48, 52, -1, 
+	20, -56, 25, -39, 26, 134, 84, 43, 
+	-25, 36, -134, -17, -99, -93, -22, 17, 
+	139, -145, 51, -54, -67, 17, -7, 39, 
+	-6, -26, -3, -24, 119, 71, -112, 61, 
+	-7, -11, -10, -61, 65, -205, -122, 25, 
+	-48, 1, -139, 31, 60, -51, 67, 45, 
+	22, 29, -153, 52, 12, -40, -76, -73, 
+	-83, 39, 98, -8, -2, -23, -82, 62, 
+	40, -121, -93, -69, -82, 3, 18, 52, 
+	104, -50, -76, 85, -70, 24, 24, -114, 
+	26, -142, 5, -96, 39, 18, -131, -42, 
+	-43, -150, -26, -90, 11, 77, -110, -45, 
+	14, 4, -39, -50, 8, -104, -61, -120, 
+	74, -29, -111, 108, 35, -151, 117, 79, 
+	-66, -8, -56, -51, -6, -101, 98, 81, 
+	8, -82, 39, 37, 67, 48, 63, 92, 
+	-99, -44, -51, 67, 61, 15, 23, -45, 
+	-73, -16, -61, -76, 84, 25, 105, 21, 
+	-48, -62, 30, -25, -87, 17, -21, -140, 
+	-77, -14, 52, 76, -73, -26, -95, 5, 
+	-85, -92, 32, -98, -8, -68, 85, 38, 
+	18, -118, -94, -191, -80, 26, -99, 62, 
+	-118, -152, -127, -18, 18, 67, -68, -161, 
+	-79, -123, 22, -39, 25, 10, -11, 15, 
+	22, -20, 18, 24, -7, -48, 46, 54, 
+	-23, 42, -163, -73, -129, -123, 62, -15, 
+	-27, -69, -22, -2, -57, -40, 96, -13, 
+	-7, -119, -51, 15, 55, -25, 88, -43, 
+	-18, 21, 37, 37, -10, 17, 63, -32, 
+	-28, 43, 103, -84, -42, -30, -42, 10, 
+	63, 33, -125, 163, 63, 30, 49, -93, 
+	-98, -131, 50, -90, -11, 10, 62, 23, 
+	76, 36, -91, 20, 64, 18, 36, 44, 
+	65, -57, -45, -20, -94, 4, 27, 17, 
+	36, -112, -47, -60, -57, 37, 82, -22, 
+	-70, -52, -130, 43, -4, 11, 32, -62, 
+	8, -85, -11, -45, -52, 53, 15, -53, 
+	59, 32, 42, 2, 57, -70, 18, -16, 
+	-134, -46, -14, -14, -19, -35, -49, -8, 
+	-82, -147, 2, 8, -4, 39, 49, 31, 
+	-91, -33, -26, 56, 45, 87, -55, -28, 
+	-149, 53, -94, -36, -116, 48, 103, 124, 
+	-107, 69, 59, 28, -14, -21, 183, -17, 
+	42, -78, 124, -8, -65, -36, -20, 120, 
+	-38, 11, 93, 82, 65, -121, -41, -34, 
+	85, 40, 46, -18, -57, -21, -2, -6, 
+	-48, 48, 40, 20, 100, -95, 16, -46, 
+	-90, 16, 11, -69, 24, -66, -122, -34, 
+	18, 129, -78, 24, 93, -17, 13, -70, 
+	30, -17, -154, -149, -26, -43, -81, 73, 
+	-36, 31, 74, -138, -5, -121, 5, -80, 
+	17, -53, 82, -40, -64, -21, -94, -7, 
+	-189, 98, -20, 7, 98, -53, -79, -62, 
+	-52, -8, 92, 106, 71, -84, -93, -5, 
+	69, 115, -66, -33, -52, 55, 26, 0, 
+	-73, 15, 129, -114, 62, -30, -103, 86, 
+	119, -94, -126, -17, 66, 48, 123, -41, 
+	-25, -126, 86, -209, -74, -57, 43, 72, 
+	-27, 70, -72, -95, 193, -101, 66, -24, 
+	-27, 106, 95, -76, 98, 117, -57, 71, 
+	-187, 22, 32, -56, 112, -82, -30, -61, 
+	27, 42, -53, 116, -94, 136, 23, -45, 
+	30, -45, -274, -30, -256, -146, 4, -4, 
+	-61, 152, 7, -119, -56, -165, -208, -178, 
+	69, 23, -96, -16, 14, 70, -184, -32, 
+	-90, 48, -96, -73, -93, -73, -124, -112, 
+	32, 76, 68, 149, -18, 17, -122, 17, 
+	21, -4, -3, -113, 9, 19, -98, 24, 
+	-60, -44, -107, -151, 89, 23, -47, -51, 
+	-60, -61, 24, -43, -66, -71, 156, -52, 
+	24, -20, -51, 62, 23, -8, 13, 29, 
+	-27, -9, 139, -125, 50, -71, -66, 9, 
+	6, 43, -74, -78, -112, -27, 59, -94, 
+	41, 53, -28, -98, -11, -85, -111, 17, 
+	-71, -107, -76, -115, -81, -39, -119, -16, 
+	-78, -58, -58, -168, -33, -54, -146, -93, 
+	60, -36, -21, -161, 22, 35, 36, -6, 
+	-101, -85, -86, 29, -18, 35, 59, -48, 
+	-30, -73, 52, 86, -167, -9, -12, -15, 
+	-25, -8, -66, -65, -79, 182, 20, 3, 
+	-40, -102, -32, -51, -71, 34, -95, 3, 
+	-62, -40, -140, -73, 53, -68, 28, -15, 
+	16, 100, -20, 19, 7, 93, -40, 82, 
+	30, 20, -23, -22, -10, 9, -55, -20, 
+	-51, -54, -112, 33, 120, -90, 66, 47, 
+	87, -12, -163, 5, -72, -17, -64, -60, 
+	-5, -75, -113, -39, 69, -96, -26, 11, 
+	12, 125, 26, 76, -15, 44, -136, -8, 
+	-27, -13, 12, -80, -88, -78, 7, 67, 
+	51, -11, -50, -100, -42, -53, -51, -6, 
+	-44, -138, 20, -6, 59, -9, -42, -81, 
+	-77, -13, -74, -85, -41, -54, -74, -34, 
+	3, -31, -158, -71, 45, -26, 18, -143, 
+	-17, -22, -42, 14, -64, -154, 6, -51, 
+	77, -108, 67, 29, 29, -55, -58, -31, 
+	-44, -18, 49, 97, -16, 92, 56, -113, 
+	20, -62, 11, -80, -4, -125, -20, 29, 
+	16, -84, 1, -23, 26, 13, -32, -158, 
+	-148, -66, 31, -107, 34, 4, -87, 44, 
+	-141, -62, -28, -40, -51, -46, -111, -59, 
+	23, 78, 50, -89, -10, 43, -59, 11, 
+	-8, -84, -85, -43, 47, -35, 46, 32, 
+	44, -223, 114, -79, -70, 38, 36, -42, 
+	-22, -45, -5, -29, -20, 33, 31, -13, 
+	15, -106, 33, -36, 52, -4, 51, -42, 
+	0, 50, 53, 74, 41, 42, 106, -72, 
+	70, -120, 34, 45, 88, 19, 19, 16, 
+	-145, -71, 142, 127, -91, 21, 96, 105, 
+	-52, 100, 48, 64, 45, 28, -35, -31, 
+	-160, -42, -153, -97, -17, -48, -25, -78, 
+	-5, -7, -94, -36, 23, -56, -63, 113, 
+	34, 32, -46, -34, 53, 82, 54, 5, 
+	31, 88, 51, -4, -53, -107, -6, -42, 
+	-12, -229, 12, -183, -39, -57, 59, -93, 
+	-14, -97, -40, 62, -109, -1, 86, -44, 
+	11, -171, -106, -103, -94, -129, 56, 0, 
+	36, -64, 117, 29, -235, 91, -126, 9, 
+	-67, -27, 145, 62, -102, -70, -32, -126, 
+	41, -23, 29, -20, 64, -9, -65, 0, 
+	-180, 13, -43, -29, -155, 37, -76, -48, 
+	-64, -53, -75, 10, 90, -32, -23, 30, 
+	-23, -20, -23, -187, -19, 36, 65, 85, 
+	-122, 72, -5, 29, -19, 39, -37, 37, 
+	-45, 91, -22, 159, -69, -4, -87, 146, 
+	-30, 70, 104, 33, -66, 76, 42, 62, 
+	-14, -32, 127, -70, 17, 113, -63, -26, 
+	7, -97, -186, -105, 7, -29, 1, 21, 
+	-67, -70, -187, -135, -17, -7, -18, -237, 
+	4, 21, -19, 57, 55, 1, -83, 6, 
+	-68, 75, -29, -62, 73, -112, 15, 25, 
+	92, 29, 28, 9, -50, -75, 98, -143, 
+	-10, -21, 96, 10, 81, 148, -57, -37, 
+	-40, 72, -80, 14, 48, 83, -73, -26, 
+	46, 0, -76, 110, -52, -59, 24, -56, 
+	16, -18, 38, -2, 58, 16, -9, 22, 
+	-74, 135, 72, -19, -94, 11, -129, -22, 
+	106, -48, -38, 52, -144, 97, 88, 79, 
+	-153, -24, 28, -18, -49, 77, -6, -3, 
+	-149, -40, -105, -128, -62, 60, -79, -105, 
+	89, -113, -8, 23, -100, -93, -32, 60, 
+	-47, -82, -20, -106, -160, -47, 93, -22, 
+	13, -99, 12, -151, 1, -87, -13, -1, 
+	-108, 28, -193, -16, -83, -18, -8, -73, 
+	-23, 35, -73, 85, -47, 10, -17, -160, 
+	-44, -27, -103, 109, -63, -92, -59, -121, 
+	-100, -68, 201, 7, -120, -43, -10, -26, 
+	-17, -36, 45, -31, -10, -23, 11, 29, 
+	149, -39, 12, -46, 26, -47, 5, 102, 
+	-27, -73, 29, 126, -34, -38, -112, 53, 
+	92, -64, 77, -36, -58, -68, 16, 46, 
+	-19, 89, -121, -188, -51, -59, -10, -108, 
+	50, 22, 109, -23, 15, 41, -34, 83, 
+	-60, 62, 2, 56, -31, -118, 91, -78, 
+	-98, -33, -131, -57, -15, -159, -18, -82, 
+	9, -67, 38, -27, 60, -143, 70, 8, 
+	129, -138, 52, -90, -88, -109, -52, -12, 
+	32, 37, 4, -13, 119, 151, -178, -13, 
+	62, -56, 61, -62, -197, -126, 133, -42, 
+	17, 71, -18, -168, -80, -85, 36, 62, 
+	-147, -22, 15, -70, 9, 95, -94, 147, 
+	-15, -69, -71, -43, -35, 25, -163, -58, 
+	13, 26, 49, -67, -3, -25, -139, -66, 
+	94, -62, -51, 53, -5, 14, -13, -25, 
+	-36, 54, -56, -58, 5, -47, 61, -50, 
+	45, -106, 74, -26, 50, -97, -49, -63, 
+	-38, 66, 107, 161, 71, 33, -72, 58, 
+	32, 40, -85, 158, -46, -104, -16, -6, 
+	63, 0, 104, 10, -98, -91, -43, -137, 
+	48, -100, 16, -3, 97, 114, -82, 56, 
+	137, -85, 89, -22, 12, 7, 36, 0, 
+	44, 35, -40, -90, -120, 89, -36, -56, 
+	-174, -55, -148, -109, -16, -47, 35, -118, 
+	32, -37, -70, -7, -145, -63, 55, -3, 
+	-50, -63, -72, -46, 108, 67, 33, 2, 
+	-114, 15, 208, 101, -86, 6, 24, 65, 
+	150, -10, -6, 154, 58, 69, 107, -38, 
+	-139, -113, 84, 92, -110, 3, 9, -37, 
+	135, 129, -46, -32, 111, 157, 121, -92, 
+	-25, -41, -42, -26, 30, 59, 88, 106, 
+	-106, 54, -42, 62, 42, 105, 7, -1, 
+	36, -37, -167, 12, 75, -14, -41, 127, 
+	-36, -147, -167, 1, 40, -140, 81, -110, 
+	-23, -163, 83, -82, 99, 49, 25, 35, 
+	-88, 9, 33, -190, 27, 86, -32, 48, 
+	-10, 100, 126, -2, -193, 125, 53, -120, 
+	-119, 41, -83, -38, -68, -132, 114, -1, 
+	9, -90, -10, 11, 22, -19, 129, -116, 
+	14, -129, 131, 45, 21, 94, -61, 52, 
+	43, -78, -39, -8, 44, 43, 52, 66, 
+	110, -59, 49, 82, -67, -53, 35, -29, 
+	-176, 163, -111, 42, 65, 17, -110, 66, 
+	-84, 39, 17, -72, -120, 7, -71, 66, 
+	-23, 109, -34, -40, 54, -55, 43, -76, 
+	-106, 20, -106, -48, -104, -190, -19, 41, 
+	57, -18, 55, 112, -97, -3, 2, -37, 
+	113, -134, -21, 22, -49, 67, -62, 57, 
+	33, -86, 90, 53, -53, -18, 129, -3, 
+	70, 39, 85, 45, -32, -23, -69, -84, 
+	-43, 157, -358, 13, -180, 72, -43, -20, 
+	-81, -150, 58, 111, 4, -32, -67, 25, 
+	-18, -13, -118, -63, 59, -42, 79, -50, 
+	-20, -56, -34, -160, -81, -91, 96, 25, 
+	-18, 34, -68, 38, -25, 176, 9, 185, 
+	74, -207, -6, 131, -152, -127, 26, 10, 
+	-115, -64, 120, 16, -85, -64, 50, 49, 
+	-54, -21, 37, -83, -10, -29, -19, -8, 
+	-59, 94, -133, 41, -170, -76, -51, -57, 
+	-174, -64, -15, -48, -49, -92, -36, 43, 
+	7, -41, -15, 59, 147, 78, 75, 3, 
+	-85, 47, -180, -145, -32, 48, -7, 58, 
+	-64, -48, 8, -18, 94, -3, 94, 43, 
+	-34, 29, -38, -73, -76, 123, -112, 39, 
+	-58, -59, -113, -5, 109, -103, -41, 60, 
+	-135, -25, -123, 94, 65, -119, 54, 67, 
+	118, 82, -160, 69, 10, -32, -17, 136, 
+	-127, 35, 41, -92, -58, 10, -59, -84, 
+	54, -139, -116, -72, -66, -68, 13, -72, 
+	109, -105, 29, -228, -21, 25, -65, 47, 
+	4, -90, -2, -72, 21, -42, -25, -62, 
+	-92, -114, -11, -61, 77, 26, -44, -141, 
+	114, 44, -26, -69, -184, 126, 45, -46, 
+	-108, -11, 20, 73, 52, -25, 10, -44, 
+	-8, -80, -124, 151, -63, 50, -80, 56, 
+	-70, -48, 120, -14, 1, 1, 64, -56, 
+	-125, -51, -63, -95, 50, 17, 42, -22, 
+	-62, 33, 45, -39, -41, 64, 189, 31, 
+	-173, 35, -23, 11, -4, 8, -2, 39, 
+	9, -104, -62, 41, -94, -132, 127, -24, 
+	-110, -66, 28, -21, 50, -46, 98, -62, 
+	-58, -69, -56, -19, -168, 61, 36, -66, 
+	-2, 13, 133, 17, 1, -36, 18, -47, 
+	-16, -2, -122, -2, 84, -68, 61, -30, 
+	-103, -77, 142, 89, 84, 138, -112, 39, 
+	-125, 40, -81, -131, 3, -86, 2, -28, 
+	2, -7, 40, 34, 14, 23, 145, 15, 
+	-46, 56, -71, -102, 139, 124, -61, -107, 
+	-93, -30, -55, -21, 130, 29, -38, 42, 
+	-11, 62, -38, -13, 44, 20, 62, 3, 
+	41, -26, -51, 108, 33, 28, 89, 77, 
+	-186, 133, 29, -183, 63, 65, -16, -145, 
+	-39, 41, -68, 82, -125, 6, -62, 87, 
+	-31, 35, 22, -174, 101, 13, -129, -90, 
+	-63, 33, -19, -7, 103, 11, -12, 31, 
+	56, -56, -74, -118, -44, 4, -6, -49, 
+	25, 13, 73, 28, -43, 37, 80, -14, 
+	86, 40, 98, -64, -118, 89, 13, 23, 
+	49, -95, -33, 84, -42, -121, -69, -86, 
+	-100, -62, -78, -22, 42, -59, 11, -198, 
+	-5, -58, -102, -77, 56, -12, -42, 54, 
+	-39, 2, -73, 71, 36, 84, -65, 31, 
+	-81, -47, 91, -70, -9, 33, 32, -15, 
+	22, -25, -32, 5, 42, 59, -53, 2, 
+	-141, 2, 83, 51, -20, -183, -34, 91, 
+	117, -64, -49, -106, -76, -66, -10, -4, 
+	-176, 74, 51, -96, -107, -66, -70, -107, 
+	-39, 21, -47, -44, -17, -96, -34, -83, 
+	-50, -72, -17, -3, -32, 6, -58, -55, 
+	-64, -147, 115, -84, -127, 192, 86, 98, 
+	-64, 42, -99, 48, -63, -14, 72, -117, 
+	101, 28, -142, 2, 11, 27, -59, -17, 
+	-184, -73, 9, 51, -132, -30, 90, 138, 
+	108, 52, 148, -92, -83, -9, -59, 7, 
+	74, 84, -78, -13, -111, 44, -34, 39, 
+	-23, -30, -43, -143, -67, -108, -31, 39, 
+	-56, -75, -90, -15, 68, -94, 87, -82, 
+	111, -6, 145, -76, -141, -42, 100, 15, 
+	-63, -141, -41, -5, -90, 41, 4, 19, 
+	134, -124, -84, 103, -204, -161, 2, -35, 
+	14, 48, -83, 1, -38, 66, 58, 62, 
+	23, 92, 19, 22, -59, 91, 68, 93, 
+	14, 32, -189, -16, 132, 10, 2, 19, 
+	54, 12, -97, -78, 15, 48, 38, 118, 
+	2, -47, -109, 103, 36, -71, -93, -66, 
+	-50, 96, 48, -44, -16, -40, -54, -41, 
+	-41, -103, 81, 65, 52, 50, 97, 126, 
+	67, 12, 85, -74, -50, 70, -21, -29, 
+	22, -36, -67, 66, 43, 87, -27, 25, 
+	147, 148, 20, 12, -87, 42, 73, 65, 
+	-54, 125, 19, -5, -8, -69, 156, 30, 
+	12, 76, 76, -70, 63, 113, 97, 114, 
+	135, -27, 93, -15, -55, -21, 9, -171, 
+	-35, -123, -60, 43, -27, -3, -14, 31, 
+	52, 72, -148, -72, 14, -11, -6, -66, 
+	-62, -207, -109, 34, -51, -120, 48, -64, 
+	-147, -100, 62, -80, -51, -85, -125, 33, 
+	-64, 68, -15, -1, -31, -128, -97, 104, 
+	-44, 94, 190, -104, -182, -95, -37, -26, 
+	19, -97, -165, -96, -20, -106, -125, -85, 
+	-66, -32, 33, 112, 91, 114, -76, -93, 
+	31, -150, 85, -113, 70, 44, 7, 65, 
+	-38, 17, -277, -9, -164, 158, 29, 64, 
+	-60, -73, -173, -38, -99, -153, 158, -74, 
+	79, -149, 99, 62, -59, -56, -31, -17, 
+	10, -1, 98, -92, -125, 51, 111, 110, 
+	-29, -78, 79, 61, -112, -90, -17, -59, 
+	91, -213, -283, -11, 97, -95, -80, -124, 
+	-76, -78, 55, -14, 59, 89, -51, -28, 
+	-62, -16, 38, 37, -69, 125, 97, -66, 
+	44, -41, 0, 43, -16, 16, 81, 43, 
+	30, 185, 34, 33, -89, -89, 177, -31, 
+	6, -17, 64, 28, 8, -67, -5, -22, 
+	-12, -111, 0, 17, 104, -33, 109, 120, 
+	24, -12, 118, 54, -149, -89, -52, -31, 
+	40, -96, -31, -3, 144, -82, -44, 34, 
+	-41, -90, 40, 5, 17, 79, 101, -198, 
+	21, 0, -84, -20, -30, -9, 150, 75, 
+	17, 62, 97, -120, 66, 72, -41, -24, 
+	-59, 124, 19, 70, 37, -7, -28, -46, 
+	-248, 26, -16, -18, 31, -122, -60, -73, 
+	-105, 24, -119, -104, 39, -74, -206, 45, 
+	-22, -137, 128, -142, 19, -119, -95, -92, 
+	-82, 58, -184, 46, -52, -158, -138, -35, 
+	-154, -25, 32, 91, 47, -71, -45, -40, 
+	-49, -85, -55, 156, 83, 27, 18, -84, 
+	-21, -21, -95, 60, -51, -57, -165, -128, 
+	-127, -105, -161, -92, -4, -118, -38, -91, 
+	-105, 51, 16, -13, -200, -81, -84, 73, 
+	-59, -184, 36, 54, 67, 45, -102, 75, 
+	-69, -146, 29, 18, -7, -3, -124, -84, 
+	130, -51, -77, 73, 12, -177, -91, -63, 
+	-118, -95, -65, -28, -27, -51, -86, -112, 
+	-45, 3, 28, 119, 12, -23, 30, 1, 
+	-118, -101, -102, -33, 49, -123, -37, -34, 
+	-80, 96, 13, 49, 8, -31, -45, -100, 
+	-101, 12, -25, 31, 23, -143, -182, -8, 
+	5, -200, -121, -98, 64, 54, -90, -11, 
+	-150, -22, -59, -102, -6, -28, -29, -150, 
+	60, 40, -161, 69, -100, -218, -165, -25, 
+	-101, 11, 20, -27, 11, -64, -120, -6, 
+	-78, 105, -64, -13, 11, 0, 37, 130, 
+	-155, -136, 66, -10, 42, 10, 142, -5, 
+	-57, 9, -43, -27, 62, 63, 66, -96, 
+	-56, -50, -68, 53, 33, 210, 136, -28, 
+	104, 40, 33, 96, 24, 52, 51, -30, 
+	-47, -53, -2, 155, -29, 7, 54, -42, 
+	-125, 40, 95, -48, -32, 54, -23, -16, 
+	-19, -30, -110, 26, -5, -34, 99, 34, 
+	127, -31, 5, 3, 32, 121, 127, 40, 
+	22, 35, -23, 89, -23, -39, 60, 14, 
+	8, 77, -33, -30, -62, -103, 99, -29, 
+	27, -43, 27, -16, -6, 23, 63, -13, 
+	78, 65, -49, 33, 21, -45, 34, 87, 
+	30, -211, 168, 110, -38, -58, 13, 70, 
+	-43, -19, -56, -43, -87, 136, 59, 44, 
+	-35, -76, 69, 12, -74, 29, 13, -79, 
+	29, -70, -43, -57, 59, 10, 114, -24, 
+	41, -56, -53, 43, -92, -6, 11, 17, 
+	-20, 89, -127, -53, 26, -133, 157, -38, 
+	-76, -86, -74, -73, -62, -64, -93, -80, 
+	-54, -32, -5, 22, 82, 43, 1, -48, 
+	18, 16, 253, 34, 62, -69, 116, 68, 
+	-13, 1, -91, -94, -57, -19, 8, -92, 
+	-161, -64, 123, -6, -86, 66, 51, -23, 
+	-145, -84, -14, 18, -74, -53, -43, -76, 
+	-55, -95, -36, -4, 65, -8, 11, -116, 
+	4, -46, -7, 52, -92, -19, -62, -102, 
+	129, -84, 20, 40, -58, 16, -79, -105, 
+	-57, -78, 45, 39, -96, -68, 67, 31, 
+	-214, -28, -195, -98, 32, -33, -148, -46, 
+	15, -40, 65, 90, 7, -64, 63, 6, 
+	-99, 5, 8, 18, -48, 4, 92, -91, 
+	-93, 73, -71, 10, 29, -19, 117, 28, 
+	-3, 24, -52, -154, 62, 130, 30, -64, 
+	-15, -106, -39, 17, -20, -9, 4, 48, 
+	92, 37, 23, -42, 9, -126, 44, -29, 
+	22, -65, -50, -11, -61, -50, -135, 20, 
+	-141, -117, -107, -78, -105, 90, -67, -229, 
+	-36, -150, -28, 75, -51, 117, 86, 48, 
+	-12, -1, -80, -41, -11, -68, 86, -79, 
+	49, -159, 36, -41, 21, -84, 104, 60, 
+	-3, 48, 17, -50, 125, -92, -72, -64, 
+	33, -147, -3, 27, 56, 16, 32, 95, 
+	-122, 92, -8, 21, -112, 10, 21, 14, 
+	-2, -81, -29, 13, 7, -96, -218, -58, 
+	-108, -60, 57, -59, 146, 53, 45, -95, 
+	-27, -155, 16, 17, -103, -143, -107, -23, 
+	-31, 4, -1, 21, 36, -101, -83, -29, 
+	-87, -20, 71, -78, -187, -93, 55, -34, 
+	20, 50, -96, 130, -20, 31, -20, -69, 
+	9, -32, 47, 67, -107, -45, 87, 7, 
+	-18, -24, 5, -4, 49, 99, 94, -42, 
+	-191, -6, 55, -40, 13, -26, -40, -58, 
+	-21, -24, -115, 134, -39, -29, -86, -27, 
+	-95, -54, -94, 86, 16, -167, -62, -61, 
+	22, -94, -153, 6, 51, -50, 10, -60, 
+	-198, -37, 13, -78, -38, -159, -30, -22, 
+	-126, -69, -57, 126, -55, 139, 31, 56, 
+	9, -6, 59, 92, -41, 2, -145, 34, 
+	-8, 135, 46, 130, 1, 15, 170, 20, 
+	66, 50, -13, 110, -151, 110, -101, 5, 
+	-61, -32, 18, -43, -159, -20, -102, 65, 
+	-3, -68, -97, -111, 30, 20, 84, 6, 
+	103, 151, -39, -12, 81, -1, -90, -18, 
+	-9, -87, -28, -166, -22, -117, -121, 30, 
+	-22, 8, 118, -71, -9, -74, 26, 11, 
+	86, -103, 37, -39, 29, 60, -152, 14, 
+	-13, 92, 13, -64, -22, -8, 41, 43, 
+	115, 79, -71, -12, 10, -71, -3, 52, 
+	-95, 12, -102, -23, -55, 38, -44, -30, 
+	-140, -110, 71, 6, -15, 52, -41, -9, 
+	92, 163, -65, -10, -79, 22, 33, 3, 
+	80, -23, -157, 15, 97, -140, -41, 10, 
+	116, 89, 129, 13, -8, 19, -87, 23, 
+	69, -188, 93, -76, -7, -27, -72, 58, 
+	-50, -10, -18, -130, -14, -64, -134, 109, 
+	34, -83, -26, 86, 124, -47, -31, -116, 
+	-9, 81, 1, 5, -90, -38, -133, 10, 
+	-46, -27, 62, 94, 54, -83, -26, 83, 
+	14, -71, -189, 122, -11, -101, -23, 41, 
+	9, -132, -98, 76, 29, 18, -64, -36, 
+	-36, -2, -40, -52, 50, 5, -15, 55, 
+	-20, -145, -79, -8, -124, -107, -23, 6, 
+	-6, -89, 22, 84, -34, -182, 8, -46, 
+	64, -69, 60, 8, -40, -124, 41, 11, 
+	-104, -49, -5, -45, 26, 108, -10, -85, 
+	-75, -75, 20, 17, -64, -9, 52, 5, 
+	35, -70, -179, -17, -52, -32, -29, 6, 
+	-18, -76, 1, 82, 24, -112, 22, -4, 
+	-58, -100, 36, -64, -77, 67, 94, -12, 
+	123, -42, -60, 10, 3, -130, -52, 92, 
+	-13, -121, 105, 59, -50, -109, -25, 0, 
+	-92, -166, 92, -38, 14, -76, -122, -10, 
+	-23, 56, 50, -31, -21, -62, -65, -91, 
+	-19, -45, -96, 77, -69, -155, 13, 23, 
+	0, -7, -176, 26, 108, -74, -38, -68, 
+	-139, -36, -31, -144, -85, 32, 71, 14, 
+	-83, 109, 31, 114, 42, -3, -50, 59, 
+	36, -26, 75, -129, 10, -50, -116, 65, 
+	-62, -31, 11, -45, -32, 77, -31, 11, 
+	140, 120, 33, -10, 13, 78, -41, -55, 
+	73, -17, 79, 112, -85, -89, 15, 85, 
+	-245, 15, -86, -43, 40, 44, -164, 6, 
+	-17, -95, -78, 2, 56, -2, -37, 59, 
+	-35, -160, 102, -127, -17, -99, 153, 69, 
+	-157, 146, -105, 126, -24, 104, 17, 45, 
+	-83, -125, 20, 61, -97, -141, 2, 8, 
+	-45, 83, -39, -37, 43, 91, 129, 89, 
+	47, 49, 42, 70, -121, 96, -7, -36, 
+	189, 6, -71, 27, -64, -10, -25, -76, 
+	-97, 20, -124, -143, -60, -75, -60, -71, 
+	59, 104, 16, -30, 36, 9, -43, -74, 
+	-132, -84, 39, -5, -57, -18, 80, -38, 
+	-75, 96, 6, -29, 44, 66, -47, -86, 
+	90, -158, -16, 37, -72, -132, 19, -7, 
+	-203, -49, 49, -8, -11, 205, 139, 183, 
+	-20, 61, -15, -120, -114, 85, 91, -6, 
+	-77, -35, 5, -22, -170, -5, 70, -24, 
+	1, 72, -138, -11, -40, -171, -140, -91, 
+	-5, 121, 59, 47, 22, 20, -104, -186, 
+	-33, -120, 23, 28, -80, -57, 43, 86, 
+	-73, 1, -125, -129, 77, -57, -60, -16, 
+	-38, 34, 11, 86, -58, -91, 140, -141, 
+	45, -48, -12, 30, -23, 113, -113, -130, 
+	-27, 17, -35, 35, -67, 124, -120, 15, 
+	51, -104, 141, -18, 79, -138, -15, -24, 
+	-33, -34, -68, -90, -1, -27, -70, -178, 
+	-81, 58, 102, 45, -52, 55, 24, -129, 
+	-114, -20, 155, -23, 4, -12, 10, 0, 
+	-42, -3, -64, -69, 13, -56, 170, 55, 
+	-51, 88, -80, 50, -68, -76, 197, -97, 
+	-42, -114, 8, 60, -35, -72, 6, -123, 
+	-95, 129, -26, 33, -110, 67, 1, -117, 
+	-45, 19, 60, 81, 30, -120, 89, -21, 
+	11, -22, 10, -7, 157, -29, -60, -109, 
+	-44, 32, 112, 53, 50, 32, -85, -85, 
+	32, 175, 253, -135, -129, -32, -131, -49, 
+	14, -10, 81, -200, -4, -72, -50, 112, 
+	62, 210, -9, -48, 70, 116, 199, -17, 
+	-99, 71, -117, 114, 52, -141, -111, -127, 
+	-78, -11, -31, -3, 40, -6, 138, 74, 
+	-52, -43, 32, -58, -158, -85, 8, 168, 
+	67, -68, -39, -123, 69, -132, -96, 54, 
+	-152, 64, 171, 57, -29, 56, 31, -77, 
+	-90, -100, -27, -90, 73, -51, 143, 35, 
+	-174, -40, -84, -72, 115, -1, 31, 44, 
+	-93, -31, -169, -5, -103, -167, 64, 2, 
+	45, 69, -24, 124, -164, 178, 110, 0, 
+	-23, 101, 33, -2, -8, 54, -39, -89, 
+	45, -48, -82, -20, -43, -29, 39, -73, 
+	-87, 40, -88, -97, 55, -206, 19, -103, 
+	-277, 101, -29, 26, 101, 154, -51, -30, 
+	-44, 36, -86, -158, -21, -82, -42, 60, 
+	-119, 43, 82, -39, 105, -41, 39, 61, 
+	-14, -13, 35, 34, 98, -9, 30, 70, 
+	-104, -22, 61, 71, 85, -60, 11, -20, 
+	-124, -59, -89, -87, -101, -64, -84, -121, 
+	-5, -33, -15, -40, -7, 70, -100, 107, 
+	-29, 135, -68, -55, 43, -61, -19, -4, 
+	-61, 100, 8, 45, 49, 18, 9, 46, 
+	-21, -3, 2, -1, -124, -124, -88, 66, 
+	93, -36, 43, -107, -174, -49, -29, -78, 
+	-104, 31, -25, -95, 59, 66, 132, 0, 
+	107, -146, -74, -122, -29, 50, 23, -53, 
+	-51, 55, -84, -49, -63, -149, 26, -4, 
+	-88, 53, -31, -24, 105, -102, -25, -24, 
+	81, -56, -22, -100, 68, -44, 58, -46, 
+	23, -183, 68, 8, -28, 47, -2, -12, 
+	-162, 96, -128, 75, 10, 2, -22, 5, 
+	-63, -4, 125, -57, 55, -77, 28, -81, 
+	156, -62, 8, 80, 23, 34, -186, 29, 
+	-55, 37, -16, 1, 19, -120, 79, 3, 
+	-29, -105, 37, -102, 13, -35, -79, -70, 
+	-213, 97, -273, -94, -91, -48, -14, -66, 
+	37, -39, -163, 25, -90, 37, 18, 89, 
+	-62, 99, -25, -53, -19, 19, -4, -82, 
+	-1, 46, -146, 6, -61, -103, -68, 0, 
+	1, -65, 127, -75, -53, 25, -31, -39, 
+	112, 19, 44, -10, 62, 72, -112, -32, 
+	33, 48, 14, -12, 13, -35, -44, 6, 
+	-36, 13, 11, -15, -22, -112, 118, -91, 
+	-117, 66, -9, 16, 16, -83, 25, -48, 
+	90, -15, -21, 84, -86, 96, 184, 70, 
+	35, -40, -24, -76, -112, -38, 97, -101, 
+	-66, -18, -122, 37, -49, 21, -81, -94, 
+	-37, -72, -49, -52, 3, -52, -93, 8, 
+	42, -50, -31, 1, -108, -99, -124, -90, 
+	7, 77, 52, -54, -62, 45, -112, -15, 
+	42, 36, 99, 25, -65, 22, -86, -60, 
+	-70, 33, 32, -50, -80, -102, 61, -97, 
+	10, -40, -71, 81, -121, 62, 117, -29, 
+	-65, -79, -159, -5, 43, 23, -124, -27, 
+	10, -1, 47, -277, -90, 81, -7, -101, 
+	-9, 75, 6, -9, -82, 2, 36, 66, 
+	-122, -169, -35, -15, -7, -21, 48, 42, 
+	71, -65, 27, -64, 39, -237, -106, 18, 
+	20, 32, -19, 20, 77, 14, 169, 46, 
+	-117, -18, 113, -21, -131, -64, -73, 18, 
+	1, -114, 15, -235, 79, -177, 35, 50, 
+	42, -98, 30, 44, 1, 122, -15, -29, 
+	108, -67, 141, -32, 93, 88, 103, 55, 
+	164, -56, -13, 55, -141, -5, -34, -35, 
+	-109, -93, -88, -50, 20, 26, 44, -114, 
+	61, -113, -67, 11, 20, 66, -126, -72, 
+	-67, -55, -37, 95, 53, -96, -5, -70, 
+	8, -2, 6, 72, 35, -73, 17, 14, 
+	-35, 19, 58, -17, -66, 148, 191, -15, 
+	-32, -39, 72, -78, -114, 64, -13, 79, 
+	-2, 127, -4, 42, 11, 117, 31, -14, 
+	6, 7, -108, -24, 19, -38, 40, -8, 
+	-52, -24, -77, 2, -51, -29, 32, 9, 
+	-10, 154, -71, 47, -26, -30, -34, -61, 
+	79, -21, -83, 98, -11, -102, -51, -43, 
+	70, -97, -6, -33, -45, 44, -54, -124, 
+	-23, 14, -56, -21, 53, 69, -46, -15, 
+	-67, 45, 49, 127, 16, 26, 19, -66, 
+	-23, -79, -4, -117, 22, -123, -122, -78, 
+	153, 120, -112, -83, 80, 70, -90, 62, 
+	-80, 99, 38, -105, -23, 14, -37, -40, 
+	57, 31, -75, -48, -121, -80, 30, -20, 
+	-147, 91, 20, 57, 58, 45, -46, 58, 
+	27, -10, 19, -59, -64, -78, 55, -27, 
+	-104, 46, -54, -110, 85, 25, -40, -113, 
+	-16, -86, 54, 45, 62, 93, -37, 132, 
+	87, -120, -51, -65, -2, -7, -70, 6, 
+	-24, 93, 18, -13, 35, 8, -51, -15, 
+	-32, 11, -129, 54, -80, -74, 62, -137, 
+	-96, 49, -58, 20, -96, -89, -52, -99, 
+	-87, 3, 40, -10, 20, 66, 143, -9, 
+	-84, 108, -31, 20, 69, -91, 38, 30, 
+	-20, -47, -80, -78, 43, -63, -45, -82, 
+	-12, -12, 13, -46, 64, 127, -82, -93, 
+	0, 56, -104, -20, 0, -121, -43, -122, 
+	57, -58, -24, -134, -76, -24, 55, 82, 
+	-75, 43, 14, 18, -30, 10, 96, -72, 
+	140, -64, -62, -15, 1, -202, 61, -101, 
+	45, 52, -34, 93, -87, -4, 107, -56, 
+	-70, -92, 38, -22, 42, 4, -50, -109, 
+	69, 27, -13, -21, 20, -8, 104, 4, 
+	-145, 78, 65, -11, -117, 5, 3, 112, 
+	-44, 75, 27, -40, 2, 3, -18, -137, 
+	17, 11, -43, -32, -30, -99, 20, 48, 
+	-70, 113, 55, -2, -69, 28, -41, -39, 
+	-66, -40, -150, 31, 74, -18, -105, 22, 
+	-62, 23, 41, -68, 36, -3, -121, 17, 
+	-11, 35, 42, -89, -24, 43, 31, 117, 
+	-22, 75, -35, 61, -96, 97, 20, -136, 
+	-66, -48, 59, -7, 72, -152, -19, -30, 
+	-16, -18, -70, -50, -1, 18, -17, -67, 
+	11, -156, 28, -61, -66, 1, 25, -79, 
+	-104, -13, -147, -60, -108, -71, -30, -8, 
+	-70, 32, -36, -71, -19, -132, -16, -63, 
+	-98, -116, -58, -15, 67, -66, -21, -45, 
+	-255, 1, -18, -30, 54, 59, -75, 8, 
+	53, -125, -29, 81, -25, -158, -62, -129, 
+	-92, -34, -12, -20, 38, -3, -82, 17, 
+	-78, 46, 34, 94, -15, -30, -127, 27, 
+	-112, -163, -22, -38, 27, -83, -10, -69, 
+	-23, 16, 83, 25, 44, 17, -83, 107, 
+	59, -45, -19, -104, -13, -123, -41, 10, 
+	-152, -84, -35, 46, 14, -67, -113, -78, 
+	-174, 5, -37, -24, 138, -25, -118, -108, 
+	160, -134, -50, 34, -41, -136, 135, -4, 
+	-12, 90, -54, -60, -46, 60, -16, 8, 
+	34, 6, 9, -7, 101, -129, 38, -3, 
+	69, -97, -48, -174, -89, 93, 23, 11, 
+	-90, 222, -27, 99, 113, 16, -37, -8, 
+	52, -4, -128, 99, 109, -157, 48, 13, 
+	24, -32, -20, -76, -14, -147, 23, -20, 
+	-74, -60, 68, 6, -15, 17, -80, 54, 
+	-36, 20, 52, -2, 9, -95, 41, -66, 
+	-92, 0, 170, -19, -66, -138, 33, 102, 
+	-74, 65, -109, 26, -39, -78, -158, -20, 
+	53, -92, 23, -9, -96, -85, -61, -144, 
+	-87, -155, -106, 1, -19, 38, -172, 58, 
+	62, -19, 38, -70, -58, -108, -83, -25, 
+	-34, -69, -23, 59, -136, -128, -115, -6, 
+	-86, -44, -74, -107, 119, 5, -150, -116, 
+	72, -168, -26, 28, -25, -94, 110, -40, 
+	2, 135, -30, 45, -82, -139, -7, -2, 
+	16, 150, -183, 111, 28, 29, -38, -53, 
+	-26, -101, 74, -29, -22, 11, -91, -110, 
+	53, -67, -38, -19, 160, 104, -164, 103, 
+	-50, -65, -66, -118, 93, -34, -71, 23, 
+	-98, -120, -55, -8, 64, -63, 14, -52, 
+	-195, 75, -59, 50, 13, 63, -61, -54, 
+	-4, -54, -17, -17, -33, -21, -59, 121, 
+	130, 35, -92, -7, -145, -25, 100, 7, 
+	9, -11, -47, -161, -81, -70, 144, 79, 
+	29, 67, -23, -129, 11, 16, -6, -63, 
+	-3, -84, -61, -9, 72, -62, -120, 57, 
+	85, 50, -22, -56, 10, 84, 21, 83, 
+	-124, -104, 140, 61, 166, 107, 150, -63, 
+	-70, 79, 24, -44, 5, -38, -4, -42, 
+	-14, -110, -101, -42, 10, -90, -85, -75, 
+	4, 51, -163, -9, 43, 36, 31, 84, 
+	85, 32, -208, -121, -50, 6, 53, 39, 
+	6, -98, 65, -122, -16, 28, -105, -81, 
+	-114, 101, -47, 6, 80, 30, -250, 67, 
+	10, -10, 10, -80, 150, -27, 34, -15, 
+	-145, -223, -107, 47, -3, -15, -42, 47, 
+	-155, -129, 166, -87, 94, -14, 62, -35, 
+	-43, 0, 45, -130, -45, 108, 185, 67, 
+	49, -6, 58, -114, -85, -123, 15, -16, 
+	2, 166, -178, -34, -69, 26, -62, -95, 
+	33, -244, 7, -139, -4, -41, -29, -25, 
+	-89, -82, -53, -45, 43, 142, -254, 61, 
+	-175, -18, -246, -134, 46, -78, -14, -61, 
+	-184, -108, -159, 9, 41, -309, -82, -13, 
+	-32, -93, 254, 138, 71, 61, 0, 58, 
+	-124, -65, -8, -21, -55, 175, 59, 2, 
+	44, 0, 19, -39, -125, -291, 14, 14, 
+	-19, 70, -96, -113, 18, -126, -210, -233, 
+	-179, 77, 85, 25, -48, -11, -54, -38, 
+	-3, 18, 16, 41, 21, 78, -157, 21, 
+	-36, 97, -41, 23, 52, -81, -70, -20, 
+	-26, -104, -211, 3, -208, -182, 137, 25, 
+	-76, 5, -189, -137, 33, -28, -2, 14, 
+	27, 16, 63, -95, -73, 4, -84, 107, 
+	115, 11, 62, -52, -50, -43, -63, 98, 
+	5, 68, 3, -30, 49, -147, -127, -30, 
+	-43, 7, -10, 24, 14, 47, -22, -80, 
+	-55, 71, 37, 32, 87, 92, -168, 79, 
+	22, 13, -68, -74, -27, 17, -109, -13, 
+	-12, -59, -151, -51, -57, -55, -143, 39, 
+	-35, -111, -220, -95, 91, 18, -48, -89, 
+	6, 58, 79, -66, -121, 77, -61, -5, 
+	41, -35, -142, 26, -12, -116, 20, 51, 
+	-11, -67, 72, -87, 84, -75, -32, -8, 
+	-90, 53, -89, -29, 26, 44, -202, -150, 
+	-109, 13, 27, -79, -27, 37, -139, -38, 
+	57, -138, 0, -62, 77, 28, -77, -84, 
+	-59, -76, 39, -57, 31, -163, 45, -41, 
+	-7, -132, -10, 82, 193, 26, -123, 6, 
+	19, -99, -1, 39, -154, 1, 38, -103, 
+	35, -40, -137, -24, -123, -132, -21, 15, 
+	-186, -66, 79, -98, -240, 101, 2, -113, 
+	76, -16, -88, 144, -46, -45, 41, 109, 
+	57, -23, 33, -21, -86, -7, -125, 73, 
+	20, -59, 88, 14, 4, 35, 94, -30, 
+	-20, 102, 72, -43, -175, 64, 115, -4, 
+	74, -28, 13, 27, -117, -54, -18, 101, 
+	-113, -23, -106, -80, -83, -18, -64, 47, 
+	98, -42, -41, -66, 89, 110, -202, -112, 
+	-23, 27, 57, -82, 19, 30, -37, -2, 
+	160, 61, 152, 135, 18, -10, 114, 62, 
+	34, 71, 101, 66, 93, 26, -171, 107, 
+	-13, 52, -2, 37, -63, 170, 18, 111, 
+	29, 89, -90, 73, -10, 17, 2, -72, 
+	101, 65, -141, -71, -127, -26, 9, 28, 
+	-81, 136, -15, -7, 31, -15, -18, 59, 
+	28, -125, -38, 23, -101, 44, -32, 135, 
+	70, -81, -1, -16, -57, 12, -2, 49, 
+	-10, -66, -106, -46, -59, -11, 95, -68, 
+	107, -49, -26, -43, -67, 85, -54, -5, 
+	80, -22, -25, -24, -62, 75, 57, -42, 
+	85, 181, 116, -115, -38, -2, 60, -52, 
+	-48, 22, -217, 63, -145, 14, 20, 120, 
+	20, 37, 3, 3, -11, -25, -17, -92, 
+	28, 105, -148, 90, 6, -22, -130, -85, 
+	81, 4, 97, -32, -59, -125, 132, 52, 
+	-76, -134, -20, 80, -56, 10, -147, 84, 
+	-90, -119, -64, 30, -75, -37, 161, -76, 
+	51, -113, -25, 124, 24, -42, 35, 58, 
+	-134, -87, -13, -126, -12, -70, 58, -1, 
+	91, -81, -152, 29, 136, 31, 43, 130, 
+	-125, -6, 33, 31, -48, -104, 80, 11, 
+	-52, 68, 121, -12, 23, -38, -40, 66, 
+	-85, 57, 194, 18, 17, -30, 55, -54, 
+	36, 21, 44, 109, -72, -33, -29, -44, 
+	2, -121, -102, 109, -45, -60, 64, -37, 
+	-20, -2, 17, 90, -61, -102, -35, -28, 
+	-101, -121, 25, 47, 73, 26, -51, 71, 
+	12, -97, -216, -190, -69, -101, -82, -31, 
+	-75, -113, -80, 15, 77, -3, 84, 13, 
+	-74, 121, 12, -41, -32, 59, 15, 55, 
+	-2, -52, -18, -88, -34, -94, -54, -34, 
+	55, 58, 22, 96, -9, -95, 48, -27, 
+	-36, 69, 18, -4, 33, -61, -145, -41, 
+	-105, -71, 34, -81, 9, -72, -21, -120, 
+	-73, 35, -80, -27, -118, 113, 229, -15, 
+	18, 19, 3, -69, 26, 33, 50, 11, 
+	20, -5, 100, 58, -17, 37, -16, 96, 
+	67, -126, -42, -103, 45, -58, 29, -63, 
+	34, 2, 55, -13, 139, 136, -11, 117, 
+	-86, -123, -44, -151, -57, 25, -34, -12, 
+	59, -12, -67, 154, -75, 69, -109, 51, 
+	-19, -98, 55, -81, 58, -218, 142, 38, 
+	-14, -46, 32, -48, -111, -23, 23, 67, 
+	-187, -69, -230, 14, 67, 4, -37, -10, 
+	-27, -159, -14, 117, -176, -51, 83, -1, 
+	-94, 58, 114, -53, 2, -144, 87, -106, 
+	-5, -112, 17, 32, 54, 111, 32, 1, 
+	-35, -100, 89, -97, -91, 51, 104, -76, 
+	30, -109, -39, 48, 15, -66, -68, 10, 
+	63, -68, 65, -92, -60, -92, 7, 50, 
+	78, -145, -26, -42, -110, -19, 89, 66, 
+	-73, 11, -148, 112, -76, 67, -43, -56, 
+	18, -129, 44, -53, -35, -14, -4, -54, 
+	-20, 8, 150, 5, 14, -27, 47, 80, 
+	59, 42, -122, 96, -17, 203, 30, -21, 
+	5, -68, -45, -38, 6, 66, 62, 76, 
+	-49, 110, -46, -26, -87, -64, -13, -21, 
+	57, -62, -56, -26, 100, 18, -76, -11, 
+	109, -64, -32, -146, -110, -85, 86, 100, 
+	12, 32, 108, 38, -40, 6, 11, -9, 
+	-41, -7, -63, -94, -30, 143, 128, -102, 
+	-33, 22, 119, -18, 7, 0, -127, 4, 
+	19, 41, -366, -113, -148, -135, 80, 31, 
+	79, 25, -85, -169, -75, 125, 74, -200, 
+	95, -57, -54, 63, 64, 61, -142, 84, 
+	-151, -123, 113, -53, -74, -180, -16, 117, 
+	39, 72, 70, 60, 205, -22, -50, -27, 
+	-124, 121, 20, 144, -176, -15, 9, -23, 
+	-55, -43, 93, 103, -92, -149, -154, -38, 
+	-54, -69, -104, 16, 68, -1, 36, -148, 
+	-47, -160, -96, -51, 54, -86, 14, -12, 
+	-73, -77, -87, -29, -52, 20, -26, -9, 
+	132, -17, -72, -118, -136, -154, -64, 20, 
+	-3, -21, -11, 56, -38, -30, 66, 6, 
+	-12, 15, 110, -24, 18, -97, -123, 79, 
+	-38, 131, 56, -67, -147, -71, -38, -203, 
+	-177, -49, 23, 100, -55, -36, 37, 62, 
+	-61, -32, 8, -1, 65, 21, -118, -146, 
+	-65, -111, 37, -179, 0, -105, -25, -3, 
+	-84, -4, -102, -15, -51, 65, -48, 19, 
+	19, 43, -53, 67, 8, -169, 69, 4, 
+	-201, 37, 16, 20, 32, 49, 63, -54, 
+	-74, -107, -15, -65, 16, -2, -62, 84, 
+	-101, 2, 99, 34, -95, 55, 68, -48, 
+	-112, -15, -118, -47, -60, -61, -74, -86, 
+	-29, -14, 24, 45, 65, 55, -89, -141, 
+	2, 18, 28, 48, -108, -59, -8, 67, 
+	-18, 82, -242, 109, 85, -124, -154, 32, 
+	-160, -33, -69, -69, 15, -93, 80, 7, 
+	-85, 53, -30, 4, 9, -97, -83, -189, 
+	-22, 113, -14, 32, -109, 21, -254, -24, 
+	119, -141, 117, -123, 19, -103, 66, -50, 
+	1, 28, -91, -64, 23, 14, -67, -211, 
+	-57, -95, 92, -95, -45, -22, -173, -125, 
+	-131, 33, 20, -30, 4, -93, -12, -38, 
+	-47, 200, 28, 15, -14, -78, -169, -35, 
+	6, 118, -8, -114, 18, -4, -27, -12, 
+	-101, 105, 65, 65, 104, 139, 51, -178, 
+	-115, -124, 22, -83, 20, -48, -78, -36, 
+	128, -77, -265, 45, -30, -117, -153, 67, 
+	-27, 194, 50, -39, 131, -319, -79, -42, 
+	27, -125, 37, -146, -31, 66, 104, -114, 
+	6, -70, -81, 43, 29, -122, 42, 78, 
+	124, -44, -44, -77, 94, 37, -151, -53, 
+	58, -129, 28, -46, 24, -10, -2, -47, 
+	-98, -70, -128, 85, -13, 42, 75, -105, 
+	-140, 8, -48, 109, 113, -32, -9, -16, 
+	-96, -16, 56, 7, 5, 11, -43, -18, 
+	-93, 39, 107, 33, 14, -210, 43, -90, 
+	-111, 93, -53, -60, 91, 75, -36, -99, 
+	-50, 15, 41, 18, 167, 11, -60, -151, 
+	-196, -141, -173, -124, -28, -25, -120, 98, 
+	-263, -84, -147, 67, -67, 6, -92, -111, 
+	41, -148, -82, -102, 136, -130, -62, -143, 
+	-113, 28, -120, -8, -166, -137, -161, 38, 
+	38, -153, 14, -2, 196, 167, -31, -52, 
+	95, -69, -155, 44, 104, 37, 89, -49, 
+	-66, 5, 14, 71, -138, -46, -41, 7, 
+	58, 8, 2, 17, -8, -18, -42, -120, 
+	130, -23, -9, 10, 21, -90, -50, -68, 
+	42, -67, 107, 103, 32, 29, -132, 0, 
+	-58, 70, -42, -17, 42, -13, -13, -222, 
+	-79, -19, -50, 65, -23, -151, -115, 17, 
+	62, -81, -86, -97, 62, -42, 4, -34, 
+	44, 107, 45, 34, -18, 27, -18, 8, 
+	-61, 43, -78, 16, -82, -29, 12, -97, 
+	93, 89, -265, -154, -172, 92, -56, 32, 
+	45, 75, 85, -145, -9, -39, 9, -26, 
+	19, -108, 108, -119, 31, -41, -100, 49, 
+	-33, -15, -51, -22, -26, 58, -91, -176, 
+	2, 16, -46, -7, 98, -91, -77, -27, 
+	-35, -45, 10, 61, -108, 22, 37, 37, 
+	-157, 83, 85, -31, -27, -49, -47, 45, 
+	49, -68, -116, -86, 144, -107, 22, -87, 
+	-110, 56, -164, 114, 21, -52, 43, 26, 
+	-191, -4, -110, -128, -62, 34, -30, -17, 
+	60, -123, 76, 106, -23, 14, -191, 56, 
+	32, -149, -10, 53, -13, -99, 72, -13, 
+	10, -17, 102, -84, -26, -29, 16, 22, 
+	68, -13, -111, -70, 9, 105, -48, 34, 
+	3, 33, -35, 12, -56, 183, 79, 75, 
+	-26, 103, 50, -34, -83, -47, 35, -6, 
+	43, 97, -233, -178, -6, -151, 24, -92, 
+	75, -178, 100, -135, -57, 103, 30, -84, 
+	61, 175, -10, 28, 25, 54, -179, -46, 
+	-79, 37, -95, 16, 18, -150, -62, -44, 
+	-4, -2, -6, 89, -37, -150, -20, 29, 
+	-142, 85, -122, 94, 6, 137, 68, -65, 
+	-231, -59, -14, -41, -104, 32, 35, 47, 
+	13, -27, -65, 13, -9, -131, 81, -42, 
+	88, -60, -74, -162, -130, -111, -191, -128, 
+	95, -15, 95, -58, 41, -102, -65, -30, 
+	-44, -108, -45, 1, -46, -57, -100, -25, 
+	-50, -15, -81, -68, 17, 64, -48, -101, 
+	51, 18, -15, 18, -27, -47, -3, -31, 
+	64, -42, -218, 100, -215, -21, 2, -7, 
+	-183, 29, 5, -64, -84, 176, -16, -76, 
+	21, -30, -122, 61, 36, -50, -131, 77, 
+	108, -223, -55, 69, -8, 104, -69, 5, 
+	83, 67, -118, -115, 75, 78, 151, 5, 
+	45, -119, -23, 33, -51, -230, 108, -87, 
+	-65, 47, 32, 44, -102, 69, -98, -54, 
+	81, 49, -14, -40, -122, 88, -17, -15, 
+	39, 100, -169, 7, -66, -70, -1, -9, 
+	43, -44, -136, 71, -37, 116, -69, -71, 
+	-90, -101, 69, 67, -21, -16, -223, -48, 
+	-33, -244, 75, -7, -105, 15, -20, 8, 
+	-149, 5, -56, -38, -28, 6, 210, -17, 
+	16, -70, 44, 65, -132, -77, -5, -39, 
+	-161, 39, -40, 44, -145, 114, 46, 4, 
+	11, 71, 98, 85, -101, 108, -94, -6, 
+	156, 18, -140, 106, -88, 33, -132, 61, 
+	63, 22, -165, -72, -68, 74, -87, 89, 
+	-50, -95, -10, 20, -12, -108, -55, -201, 
+	-149, 2, 107, -124, 17, -18, 79, 113, 
+	16, -44, -11, -20, 178, 137, 145, 79, 
+	20, -25, 97, 65, -111, -93, 19, -43, 
+	-69, 135, 88, 147, 1, 172, 63, 41, 
+	138, 25, 34, -18, -173, 19, -17, -101, 
+	105, -31, -3, 57, -84, 70, -127, 109, 
+	-81, 219, -55, -68, 46, 31, -96, 34, 
+	-87, 44, -48, 53, 53, 66, -151, -32, 
+	-98, -109, -59, 85, -159, 55, 20, -138, 
+	76, -75, -29, 104, -75, -62, 166, -2, 
+	0, 29, -64, -107, -91, -69, 110, -88, 
+	-72, 92, -68, 122, -51, 6, 39, 46, 
+	89, -42, 12, -5, -78, -35, 37, -47, 
+	-42, 91, 71, -94, -233, 2, -97, -162, 
+	23, -32, -209, -56, 50, 17, -153, -2, 
+	-88, -152, 34, 75, 13, -43, -9, -236, 
+	-4, -184, -2, 134, -90, 100, -52, -90, 
+	-40, -109, -66, -10, -124, 24, 9, 3, 
+	-41, -122, -91, -5, -173, -160, 115, -34, 
+	-48, -84, -28, 9, -5, -13, 87, 53, 
+	74, 15, -40, -35, -3, 85, -52, -33, 
+	-82, -87, -120, 27, -94, -51, -139, -174, 
+	90, -122, -142, 39, 91, -6, -97, -27, 
+	-116, 11, -102, 64, 102, -31, -236, 20, 
+	-209, -30, -163, 61, 32, 26, -14, -18, 
+	-39, -170, 7, -63, -81, 26, -113, -29, 
+	175, -23, 89, 12, -135, 8, 43, 21, 
+	2, -144, -94, 23, 30, -224, -89, 23, 
+	-47, -140, -38, -103, -10, -77, 78, -106, 
+	-164, 58, 90, -19, -91, -97, -38, 17, 
+	82, -146, 39, 127, 39, -37, -42, 177, 
+	24, 17, -98, 88, -35, 12, 197, 12, 
+	60, -309, 63, 54, -80, 103, 157, -8, 
+	-68, -52, -150, 72, -62, -5, -100, 109, 
+	-132, -103, -122, -84, 23, -265, 178, -162, 
+	-50, -73, -166, -47, -87, 45, -191, 3, 
+	-190, -149, -156, -138, 1, -156, -59, 84, 
+	9, -164, 159, -85, -78, -39, -152, -191, 
+	-60, -46, -99, 13, -62, -88, -127, -137, 
+	-188, -116, 49, 116, -119, 46, -129, -146, 
+	70, -33, 179, -82, -28, 10, -35, -69, 
+	44, 61, -86, 216, 0, 4, -83, 125, 
+	-77, -102, -45, -162, -134, -106, 53, -45, 
+	-21, 88, -24, 30, -23, -50, -164, -55, 
+	-80, -11, -39, -123, -40, 141, -117, 6, 
+	117, -183, -39, 30, 20, 11, -131, -55, 
+	-91, 107, -83, 126, 25, -52, -103, 9, 
+	-51, -84, 3, -19, 70, 56, -42, -20, 
+	-28, -173, 107, -106, -96, -201, 63, 41, 
+	-77, 90, -113, 116, -23, 63, -72, -15, 
+	-98, -9, -172, -54, -14, -11, 54, 13, 
+	87, 18, -14, 33, -20, 126, 100, 47, 
+	-51, -122, 24, -61, 160, 36, -25, -99, 
+	79, 52, 19, 66, 86, -21, -100, 107, 
+	-91, 150, -37, -68, -29, -218, -31, -5, 
+	-111, 1, -79, 49, 24, 14, -131, -10, 
+	0, -17, -35, -42, 63, -1, 39, -46, 
+	47, 104, -103, -28, 50, -132, -6, -70, 
+	-50, -27, -73, -14, -68, -57, 2, 21, 
+	-122, -124, 113, 33, -35, -78, -28, -34, 
+	11, -68, 19, -63, 32, 105, -157, -3, 
+	-19, 25, 34, -55, 94, -3, 29, -105, 
+	-12, -35, -108, 29, 19, -36, -145, -48, 
+	-20, -111, 18, -104, 67, -1, -78, -56, 
+	6, -133, 28, -43, 62, -83, 116, 81, 
+	-166, 25, -133, -94, -19, -41, 108, 14, 
+	35, 9, -52, -15, -77, -98, 148, 19, 
+	-120, -88, 87, 48, -65, 12, 66, 59, 
+	32, 50, 46, 57, -175, 115, -38, 83, 
+	-14, 152, -93, -57, 6, 33, 136, 31, 
+	46, -69, -22, -227, 112, -189, -184, -55, 
+	92, -102, 70, -11, 123, 112, -257, -54, 
+	5, -31, 21, -72, 8, 15, 105, 113, 
+	-81, 41, -120, -71, 64, -55, -10, -54, 
+	-9, -144, 64, 109, -130, 4, -125, -31, 
+	-107, 123, 68, 23, -15, 33, 18, 74, 
+	-65, 7, 15, -58, -98, -48, 19, -48, 
+	74, 81, 3, -9, 60, 1, -28, -56, 
+	114, 148, -103, -109, 36, -167, -148, -96, 
+	-18, 163, 9, 3, -77, 11, -135, 47, 
+	-44, -49, -123, -113, -82, 42, -98, -32, 
+	-40, -27, 72, -88, 61, -113, -202, -69, 
+	-120, -54, -19, -30, 70, -44, -37, -74, 
+	-99, 30, -141, -11, -55, -52, -86, -44, 
+	-71, 46, -143, -1, 45, -18, -118, -23, 
+	-62, -84, -180, -10, 152, 21, 8, 33, 
+	21, 56, 81, 73, 38, -124, -90, -12, 
+	15, -50, -146, -43, -6, -171, -37, 84, 
+	-44, 140, -83, 146, 44, -67, -170, -8, 
+	54, -10, -15, -45, -49, -60, -53, 8, 
+	-95, -78, -12, 1, -96, 22, -85, 73, 
+	-97, -41, -194, 6, 35, -110, -109, -130, 
+	-136, -84, -141, 59, -102, -79, 60, -59, 
+	-191, -169, 6, -176, 180, -96, 73, -57, 
+	231, -214, -89, 198, -25, -57, 98, -52, 
+	-97, 77, -36, 65, -83, 66, -28, -15, 
+	-65, 1, -68, 140, -45, -81, -188, -82, 
+	102, 57, 54, -55, -41, 18, -53, 16, 
+	-13, -10, 7, -56, 30, 139, -83, -71, 
+	-43, -29, 9, -116, 55, -110, -10, -28, 
+	45, -98, -39, 47, -93, -245, 71, 47, 
+	-52, -25, 94, -17, 11, 49, 26, 76, 
+	31, -72, -14, 72, -48, 17, 43, 178, 
+	-55, -67, 40, -84, -125, -8, 164, -120, 
+	-5, 12, -79, -15, 107, 27, -36, -53, 
+	38, -89, 4, -37, 12, 102, -155, -12, 
+	-65, -67, -44, 61, -19, -72, -39, -27, 
+	109, -135, -71, 13, -106, 34, -3, 3, 
+	3, -46, -53, 3, -91, -26, -31, 3, 
+	-110, -22, 103, -58, 65, 59, 27, -1, 
+	-44, -63, -56, 44, -76, 74, 56, -140, 
+	-89, 103, -58, -87, 46, -79, -158, 85, 
+	20, 129, -116, -9, 57, -148, -97, -82, 
+	-81, -31, 89, 72, -256, 30, 26, -123, 
+	85, 42, 37, -19, 0, 28, -136, 86, 
+	-19, -103, -65, 9, 57, -7, -100, 52, 
+	-82, -62, -13, -130, -11, -113, -78, 67, 
+	74, 2, -60, -91, -51, 32, -149, -59, 
+	-111, 20, -17, 63, -34, 77, 14, 113, 
+	24, 16, -113, 32, -77, -291, 111, 147, 
+	132, -21, -11, -106, -4, 6, 102, 28, 
+	60, -83, 73, -44, -108, 101, 18, -20, 
+	-24, -46, -71, 12, -5, 7, -39, -118, 
+	126, 45, -81, 20, -103, 124, 50, -21, 
+	-79, -15, -52, 13, 46, -53, -34, -1, 
+	39, 19, 19, 164, -67, 97, 148, 69, 
+	-78, -92, 48, -95, -76, 36, 92, 49, 
+	-137, -63, -80, -17, 12, 41, -31, 34, 
+	-151, -49, 138, -105, -120, -36, 136, 25, 
+	52, 58, -50, 90, 37, -35, 148, 49, 
+	27, 51, -22, 90, 25, -36, 67, 59, 
+	-152, -99, 41, 58, -32, 55, 103, -9, 
+	-48, 205, 83, 7, 149, 136, 130, -116, 
+	38, 64, -182, -14, -257, -79, 160, 126, 
+	-67, 87, 137, -70, 126, 67, -122, 96, 
+	115, -147, -94, 26, 101, 74, -34, -154, 
+	-87, 10, 95, -45, -111, -117, -19, 30, 
+	9, 59, -93, -78, -107, 90, 111, 52, 
+	44, 27, -210, -75, -144, -162, 33, -47, 
+	-2, 34, -41, 167, -99, -48, 57, -59, 
+	-16, 60, 120, 37, 21, 97, 99, -48, 
+	-115, -23, -30, -4, -150, -99, 178, -18, 
+	-11, 29, -129, -70, 170, 66, -18, 9, 
+	58, 19, 46, 115, 9, 188, -168, -109, 
+	-48, -180, 21, -110, 1, -20, 38, -37, 
+	96, 17, -109, -85, -154, 103, -9, 84, 
+	42, 118, -107, -44, -108, -129, 74, -142, 
+	272, -24, -41, 72, -24, -14, 16, -40, 
+	-80, -19, 73, 33, 10, 86, 165, 32, 
+	9, 36, 115, -132, -112, -194, 103, 70, 
+	70, -32, -62, 68, 47, 149, 66, 206, 
+	-96, -22, -19, 54, 29, 93, 33, -39, 
+	17, -144, 123, 70, -8, -73, -63, 5, 
+	84, -38, -147, 53, 19, -61, -12, -15, 
+	-171, 123, -92, -99, 18, -50, 185, -80, 
+	-37, 96, -113, -21, -125, 114, -75, 58, 
+	28, 48, -169, 121, -142, -89, 15, 7, 
+	75, -202, 179, -33, -27, 35, 21, 115, 
+	36, -118, -27, -108, 73, -56, 35, -114, 
+	-36, -55, 87, 59, -198, 112, 2, 39, 
+	78, -85, 71, -21, -26, -17, -49, -105, 
+	72, -65, -228, -56, 38, -24, 48, 36, 
+	-272, 82, -56, -90, 34, -153, 78, -54, 
+	-63, -93, 27, -76, -160, -65, -88, -8, 
+	27, 35, -170, 65, 49, -12, 34, 9, 
+	46, -153, 125, -153, -16, -9, 62, -9, 
+	-49, -52, -67, -60, 26, -47, -122, -108, 
+	-91, -53, 101, 133, -71, 2, -132, 107, 
+	42, -91, 24, 129, 40, 3, -66, -132, 
+	22, 53, -158, 65, -72, 40, 72, 50, 
+	-173, 120, -142, -73, -66, -132, 6, -33, 
+	77, -106, -185, 12, 56, 5, -124, -53, 
+	-85, -61, -84, -99, 50, 28, -24, 25, 
+	8, -27, 146, -100, -8, -50, 4, -98, 
+	109, -16, -202, -54, -115, -119, 1, -230, 
+	-193, 20, 95, -80, -20, 24, 2, 30, 
+	-28, -78, -15, 93, 74, 100, 26, 33, 
+	-136, 47, -11, 103, -48, -21, 50, -201, 
+	-101, 22, 9, 28, -9, 144, 72, 76, 
+	32, -10, 110, -16, 36, -85, 5, 109, 
+	-61, -216, -43, 14, -68, -107, -191, -28, 
+	85, -28, -81, 45, 90, 3, -255, -57, 
+	30, -24, -83, 83, -182, -164, 29, -63, 
+	-15, 46, 9, 8, -5, 42, -40, -60, 
+	8, -54, -40, -10, 181, 176, 89, 6, 
+	-67, 0, -154, -71, 72, 74, -32, -229, 
+	-12, 163, 42, -7, 40, -9, -71, 14, 
+	-3, 21, 112, -155, 68, 99, 23, 74, 
+	28, -168, -26, 23, 131, 67, -56, 0, 
+	-151, -167, 75, 109, 128, 7, -113, -221, 
+	20, 121, -37, 52, -109, -35, -59, -9, 
+	-112, 44, -44, -32, -103, -43, -19, 101, 
+	13, -121, 43, -23, 22, 20, 139, 98, 
+	-165, -109, -37, 77, -64, 79, 103, -124, 
+	12, 40, -123, 52, -9, -89, 62, -21, 
+	-62, -26, -99, -83, -103, -11, 44, 64, 
+	-12, -108, 0, -133, 11, -68, -214, 20, 
+	13, 18, 33, -62, 23, -11, -275, -123, 
+	-90, -33, -95, -99, -86, -254, -135, -127, 
+	-63, -50, 7, 20, -109, -258, 44, -38, 
+	-127, 41, -177, -141, -72, -189, -135, -92, 
+	34, 25, -24, -33, 64, -105, -39, -151, 
+	-157, 71, 44, -67, 63, -18, -182, -56, 
+	-210, 104, -26, -34, 78, -23, -127, -86, 
+	-150, -110, -219, 106, -116, -193, -134, 6, 
+	-26, -3, -53, -158, -137, -58, -25, -62, 
+	-138, 8, 10, -70, -38, -13, -153, 17, 
+	-1, -92, -285, -35, -129, -177, -6, -23, 
+	-140, -16, 8, -131, 103, -214, -146, -89, 
+	-92, 48, 7, -300, -2, -156, -79, -121, 
+	-95, 41, 158, -4, 64, 35, -310, -24, 
+	61, -92, -9, -53, -44, -118, -108, -74, 
+	-110, 6, -81, 5, -52, -125, -35, -14, 
+	-21, 27, -75, -36, -71, -129, -83, 115, 
+	-23, 75, 26, -120, 59, 83, 71, -116, 
+	43, 2, -259, -80, -114, -90, 19, -2, 
+	-88, 40, 70, -48, 62, 31, -241, -109, 
+	22, -58, 38, -89, -68, 82, 60, -137, 
+	-67, 7, -161, 37, 15, -76, -47, 15, 
+	124, -168, -127, 59, 79, -135, -106, 3, 
+	16, 65, -120, -74, 56, -6, 19, 29, 
+	-10, -57, -65, -57, -43, 56, -67, -62, 
+	-34, -118, 9, -22, -64, -19, 42, -44, 
+	-201, -42, 0, -1, -92, -46, -13, -21, 
+	-94, 11, -15, -51, -91, -4, -22, -212, 
+	45, -113, -166, -119, -131, -54, -85, -70, 
+	-95, 30, -139, -122, -140, 51, -84, -110, 
+	-94, -56, 5, -171, 180, 97, -127, -99, 
+	-29, -23, -46, 56, -129, 16, -18, 63, 
+	66, -182, 26, -9, -142, -144, 76, -205, 
+	-52, -136, -43, 69, -106, -74, -30, -88, 
+	39, -343, -158, -7, -155, -86, -165, -108, 
+	-74, -151, -40, -116, -199, -175, -122, -37, 
+	93, -155, -88, 10, -98, -22, -1, -58, 
+	54, -47, 143, -75, -51, -55, -181, -35, 
+	-52, 19, -60, -27, -58, -13, 54, 46, 
+	99, -41, -69, -26, -138, 8, -49, 74, 
+	61, -23, -88, 129, -176, -153, -5, -25, 
+	-58, 15, -42, -87, 32, -39, -159, 67, 
+	-109, 32, 3, 50, -3, -142, -153, 78, 
+	-23, -65, -72, -184, -216, -97, -67, -67, 
+	40, -136, 21, -150, 45, -56, 111, -141, 
+	15, -164, -77, -52, -147, -65, -220, -87, 
+	-88, 2, 69, 72, -88, 2, -7, 7, 
+	61, -29, 13, -97, -154, 1, 29, 66, 
+	-18, 133, 38, 16, -200, -91, -11, -42, 
+	-150, -122, -31, -224, -137, 5, -107, -14, 
+	-155, -31, -97, 34, 59, -93, 1, -83, 
+	76, 62, 329, 60, 175, 20, -144, -165, 
+	-30, -148, -234, 136, 7, 79, -107, 151, 
+	-53, 173, 61, -93, 70, -89, 160, -42, 
+	1, 30, -199, 177, 14, -53, -47, -83, 
+	13, 71, -133, -65, 22, -108, 10, 43, 
+	155, 26, -162, 62, -37, 116, 22, 29, 
+	85, 115, -157, 66, 168, 110, 54, -33, 
+	-29, -49, 177, 26, -33, 167, 6, 93, 
+	177, -66, 363, 155, 70, 89, 33, -138, 
+	-46, -138, -10, 129, -75, -11, -136, 176, 
+	-29, -14, 14, 35, 11, -121, 57, -58, 
+	83, -35, -203, 137, -97, -19, -138, 29, 
+	52, 217, -200, -42, 183, -7, 142, -2, 
+	103, -148, -153, -10, -34, 110, 23, 232, 
+	1, -18, 121, -74, 152, 149, 80, -44, 
+	-128, 111, 214, -23, 29, 234, -32, 100, 
+	42, -67, 60, 67, -88, -72, -100, -248, 
+	-18, -197, -142, 138, -192, -16, -181, 93, 
+	-70, -284, 10, -123, -46, -73, 142, -219, 
+	35, -81, -151, 127, -28, 23, -111, -83, 
+	38, -15, -116, -3, -53, -133, 12, 59, 
+	29, 78, 119, -65, 42, 60, 131, 135, 
+	-144, 17, -101, -14, -133, 168, -47, -95, 
+	-170, 14, 69, -45, -31, 136, 92, -126, 
+	32, -84, -229, -25, -28, -187, -110, -25, 
+	59, 58, -36, -83, 152, -4, 14, 44, 
+	-5, -32, -6, -17, -10, -166, -77, 50, 
+	-4, 83, 67, 30, -83, 23, 79, -80, 
+	-23, 86, -91, 104, -70, 8, 1, -21, 
+	11, -48, 38, -9, -31, -68, 22, -151, 
+	-136, 97, -28, -83, -68, -86, 1, -2, 
+	-163, 98, -57, -21, 81, -56, 52, 18, 
+	-78, -25, -148, -132, -46, -192, -107, 106, 
+	5, 113, 10, -33, -37, 13, -42, -89, 
+	4, -38, 55, 92, -18, 57, -226, 59, 
+	6, 8, 103, -88, -15, -204, 96, -108, 
+	-115, -79, 107, 20, -24, 3, -26, -9, 
+	-150, -101, -165, -206, 135, 61, 46, -9, 
+	2, 82, -53, 18, -47, -124, 59, -61, 
+	124, -57, -174, 11, -2, -2, -39, 223, 
+	14, 24, -185, -49, 28, -233, -119, -116, 
+	116, -62, -57, -170, -103, 34, -2, -67, 
+	-2, -214, -39, 29, 21, 55, -349, 16, 
+	-29, 61, -165, 52, -56, -64, 23, -66, 
+	-40, -54, 63, -10, 63, -164, 129, -74, 
+	-427, 106, -11, 7, 32, -62, -52, 65, 
+	14, -112, 131, 43, -116, -145, -30, -16, 
+	59, -96, -264, -27, -91, -239, 29, -18, 
+	63, 57, -88, -17, -7, -5, 42, 6, 
+	5, 19, -74, -88, -19, -57, 0, -90, 
+	-78, -77, -67, -43, -80, 22, -65, 0, 
+	82, -61, -36, -17, 32, -48, 36, 19, 
+	-65, 25, -56, 25, -101, 37, 29, -52, 
+	-92, 77, -114, -22, 197, 95, 10, -129, 
+	44, 6, -22, -37, 28, 92, 103, -193, 
+	-6, 30, -165, -70, 26, -36, -44, -23, 
+	-1, 84, -86, -146, -25, -140, -22, -48, 
+	50, -26, 131, 29, -10, -1, 40, -66, 
+	-39, 8, 42, -45, 100, 67, -260, 59, 
+	-2, -65, 24, -65, -2, 26, -73, 14, 
+	-29, 65, -66, -15, -12, -136, -81, 44, 
+	7, -58, -92, 14, 92, 24, 40, 22, 
+	-67, -16, 98, -11, -35, 49, -78, 37, 
+	87, -111, -61, 2, -35, -37, 159, -69, 
+	44, -71, -33, -123, 17, -56, 2, -115, 
+	65, -55, -126, 61, -27, 61, 71, -33, 
+	-93, -47, -33, -44, 16, -97, -125, -47, 
+	21, -28, -19, 11, -22, 88, 55, 83, 
+	128, -48, 32, -50, -13, 1, 13, 114, 
+	56, -178, -143, 38, -93, 98, -129, -150, 
+	-139, 9, 77, -18, -40, 17, 62, -64, 
+	-12, 37, -61, -207, 19, -106, -108, -21, 
+	-7, 68, 228, 101, 118, 60, -85, -48, 
+	-15, -30, 47, -50, -95, -8, -34, -72, 
+	53, -65, 21, 92, -44, 124, 6, 70, 
+	35, -105, 25, -35, -1, -106, 53, 50, 
+	-39, 16, 16, -60, -156, -24, 27, -104, 
+	-51, 61, 3, 19, 33, 114, -38, 51, 
+	-55, -17, 31, -45, -1, 68, 87, -9, 
+	40, 56, 85, 24, -25, -108, 43, 40, 
+	-68, -22, 51, 13, -80, -29, -82, 13, 
+	49, -9, 219, 64, -22, -54, 27, 91, 
+	102, -90, 73, -92, -13, -47, 25, -37, 
+	-62, 31, -9, 78, -43, 172, 75, -22, 
+	3, 128, 73, 56, -115, 29, 17, -54, 
+	120, 55, -212, 72, -194, 66, 109, 25, 
+	-77, -36, 109, -192, 99, 134, -134, 13, 
+	-46, 22, -1, 67, 118, 68, -57, -19, 
+	-34, -97, 197, -78, -141, 9, -86, 36, 
+	-52, 14, -150, 57, -63, 79, 55, 99, 
+	87, -173, 32, 10, -163, -62, 255, -154, 
+	-13, 63, 107, 193, 31, 140, 72, -51, 
+	49, 76, 21, 122, -196, 105, -74, 4, 
+	68, -39, -333, -14, -92, -32, 0, -68, 
+	-78, -46, -158, -81, 130, 93, 2, -111, 
+	-88, 21, -37, -116, -20, 41, -126, -95, 
+	-147, -63, 23, -99, 126, -42, 91, 42, 
+	-70, 32, -38, 108, -6, -110, 64, -13, 
+	35, 87, 2, -51, 49, -66, -7, 7, 
+	76, 16, 88, 185, -49, 217, 32, 10, 
+	60, -33, 7, 22, 106, 119, -123, -13, 
+	12, -150, 168, -55, -4, -95, -49, -42, 
+	-76, -1, 44, 12, -32, -181, -115, 86, 
+	-80, 94, -91, -20, 81, 17, -19, -19, 
+	50, -103, 96, -16, 68, -2, 205, 141, 
+	-198, 55, -145, 37, 113, -35, -36, -13, 
+	-141, 24, -30, 98, -10, -1, -62, 112, 
+	42, 62, 55, -44, -123, -50, 13, 1, 
+	-100, -110, -14, 3, 83, -148, -78, -100, 
+	-27, -137, -7, -94, 170, -11, 8, 78, 
+	28, -5, -25, -31, 1, -91, 52, -106, 
+	-147, 33, -87, -37, 106, 10, -39, 109, 
+	42, -76, 6, 17, -48, -120, -52, 59, 
+	95, -82, -103, -53, -1, -30, -21, -128, 
+	-78, 51, -40, -21, 65, -12, 21, -69, 
+	-102, -27, -17, 14, 42, -112, -121, -101, 
+	-209, 2, -21, 166, -31, -292, -152, -5, 
+	-108, -43, 298, -67, 125, 66, -4, 106, 
+	-41, -63, 23, 3, -29, -144, 7, -25, 
+	90, 92, -21, -122, -114, -209, 55, 15, 
+	-173, -175, -235, -47, 54, 78, 68, -76, 
+	-7, 3, 5, -57, 36, 93, -7, -14, 
+	53, -86, -21, 32, -144, -85, -178, -67, 
+	1, 39, -35, -41, -86, 10, 119, -23, 
+	-33, 41, -87, 54, -169, -14, 96, -119, 
+	-25, -46, -134, -39, -70, 64, 35, -103, 
+	32, -40, -140, -38, -111, 117, 19, -6, 
+	-89, 108, -28, 30, -74, -100, -66, -44, 
+	-21, -14, 4, -104, -5, -124, -32, 40, 
+	-52, 136, 177, -15, 16, 72, 77, -80, 
+	40, 118, -57, 90, 118, 48, -40, 109, 
+	-37, -37, 36, -17, 108, -62, -31, 31, 
+	73, -104, 33, -165, -143, -122, 4, -75, 
+	-60, 104, -274, -67, 10, 29, -59, -32, 
+	12, 17, -96, 49, 38, -48, -8, -55, 
+	-19, 112, 22, 11, -99, -172, -74, 73, 
+	-63, 61, -137, -101, -11, -130, 5, -32, 
+	62, -52, -1, -41, -42, 121, -80, -71, 
+	1, -80, -35, -32, 108, -35, -136, 15, 
+	-16, -77, -149, -155, 38, 117, 59, 69, 
+	6, -30, 46, -150, 50, -170, 3, 42, 
+	8, -65, -98, 23, 31, 12, -84, -74, 
+	-76, -38, 90, 63, -63, 68, 56, 52, 
+	-84, -50, -165, -53, 25, -246, 122, 84, 
+	-116, -53, 73, -45, -70, -37, -116, 3, 
+	-42, 80, 29, -62, -15, -4, -64, 26, 
+	55, -50, -20, 42, -16, -93, 98, -43, 
+	91, 150, 84, 56, -117, -84, -58, -31, 
+	61, 82, 51, -66, -15, 22, 66, -22, 
+	-149, 77, 60, -100, 16, 58, 74, -43, 
+	-21, -48, -25, 61, 134, -132, 100, -13, 
+	-7, 38, 107, 15, 78, -15, 16, -27, 
+	4, -128, 119, -21, -34, -38, 10, 25, 
+	30, -31, 173, 70, -6, -69, -51, 52, 
+	58, -84, 57, 55, 14, 85, -81, 104, 
+	11, 61, 62, 28, -48, -20, 32, -63, 
+	-41, -30, 34, 37, -73, -30, 101, 37, 
+	95, 66, 161, -141, -182, 76, 68, -44, 
+	0, -116, 91, -75, 18, 164, 131, 64, 
+	60, -19, 104, -55, -47, 123, 12, -16, 
+	26, 22, 103, -43, -75, 10, -11, 106, 
+	76, 58, -75, 59, 53, -61, 57, 82, 
+	43, -156, 181, -80, -106, -2, 29, 32, 
+	-50, 80, 110, 86, -99, 214, 16, 22, 
+	34, 134, 119, 36, -99, 27, -49, -9, 
+	-46, 3, -50, -64, -188, -55, 137, 128, 
+	-206, 8, -27, -149, 35, 166, 47, 51, 
+	-20, -5, -16, -98, 116, -66, -53, 40, 
+	-55, 37, 31, -12, 58, -96, 47, -2, 
+	-120, 16, 53, -74, -10, 27, 64, -46, 
+	139, -53, 82, 69, -103, 56, -140, 73, 
+	133, -15, -55, 18, -7, -93, 84, -50, 
+	-39, 113, 51, 95, 11, -90, -194, 57, 
+	-23, 61, -152, -38, 62, 13, -126, -30, 
+	87, -184, 111, 50, -108, 25, 10, 148, 
+	-34, -24, -104, 85, 70, -106, 162, -16, 
+	-133, -58, 41, -13, -8, -67, 66, 104, 
+	-48, 74, 23, 25, 33, 51, 57, -101, 
+	-56, 30, 60, 86, -48, -41, 25, 16, 
+	-16, 47, 102, 84, -90, -77, -77, 42, 
+	84, 36, 34, 2, -79, -22, -33, 52, 
+	-131, 19, -128, 23, -76, -73, -15, 73, 
+	-29, 57, 62, -8, 50, -178, -100, -68, 
+	21, 31, 31, -140, 99, 56, -6, -76, 
+	-57, -116, -8, 5, -38, -15, 44, 75, 
+	-6, 75, -42, -51, -2, -80, -75, 23, 
+	-10, -102, -9, 30, 44, -33, -56, 3, 
+	-174, -56, 34, -8, -41, -53, -80, -44, 
+	-26, -15, 37, -174, 53, -57, 55, -35, 
+	22, 36, 63, -156, 80, 45, -10, -133, 
+	-157, -10, -1, -32, -107, -30, -234, 107, 
+	108, -54, 48, -21, 49, -4, 33, 30, 
+	90, 113, -70, 11, 16, -91, 73, -28, 
+	28, 95, -51, -94, -73, 57, -30, 51, 
+	-25, -33, -42, -60, -61, 101, -43, 47, 
+	-26, -9, 19, -108, 63, -126, -59, -46, 
+	-45, 60, -72, 67, 35, -40, -114, 12, 
+	53, -119, -103, 131, -59, 27, -43, 40, 
+	-80, -69, -16, 63, -13, -109, -41, 23, 
+	-5, -3, -4, 72, -49, -112, 30, -27, 
+	20, -78, -131, 46, 74, -113, -27, 41, 
+	3, 27, -191, 38, 101, -18, 61, -53, 
+	-101, -124, -6, 6, -142, -66, 13, -35, 
+	-136, 57, -54, 40, -137, -7, 38, 57, 
+	-17, 40, -19, 124, -95, 14, -123, 37, 
+	-62, -6, 193, 6, -145, -32, 13, -17, 
+	-31, -95, 43, 45, -63, 46, -41, 37, 
+	-108, -39, -26, -98, -28, -136, -113, -139, 
+	-43, -73, -108, -131, 24, -59, 38, 64, 
+	50, 169, -38, -15, 136, -81, -105, 72, 
+	-22, -113, 71, -9, 60, -75, -27, -30, 
+	-138, 107, 30, -45, -32, 143, 42, 76, 
+	24, -92, 20, 43, -43, 82, -112, -32, 
+	171, -224, -30, -129, 35, 33, -81, 15, 
+	-111, 135, -89, -101, -72, -157, -143, -36, 
+	34, 64, -131, -20, -21, 34, -111, -26, 
+	42, 48, 1, -40, -36, -85, 91, -1, 
+	-133, 39, -54, -46, 102, 94, -9, 9, 
+	-15, 23, 74, -54, 30, 38, 29, 49, 
+	43, -40, -96, -98, 58, 95, -2, 62, 
+	-130, 9, -58, -125, 82, 24, -6, 58, 
+	-49, -65, -38, 185, -110, 83, 46, 92, 
+	-132, 76, 89, -82, 69, -71, -27, -110, 
+	-12, -6, -150, 52, 6, -67, 25, -8, 
+	-101, -15, 78, -58, -29, -13, -42, 17, 
+	-7, -51, 40, 27, -4, 20, -43, 15, 
+	72, -195, 55, 62, -64, -16, -69, 43, 
+	-53, -69, -76, 87, -89, -83, 3, 27, 
+	-26, 2, -85, 25, -72, 46, -18, -5, 
+	-45, 24, -9, 82, -47, 66, -1, 7, 
+	69, 53, -40, -84, -27, 105, 65, 24, 
+	-110, 90, -76, -126, -53, -47, 44, -24, 
+	-130, 124, -98, -89, 161, -141, -177, -149, 
+	59, -38, 7, -3, 30, -83, -88, -23, 
+	62, -47, 102, -4, 68, 4, 21, 15, 
+	-85, -62, 2, -7, 101, -113, 21, -32, 
+	10, -32, -115, 90, -90, -114, -10, -20, 
+	-113, 28, -71, -19, -94, -24, -53, 70, 
+	-30, -27, 0, 56, 8, 106, 69, 15, 
+	35, -5, -86, 7, 26, -61, 59, 5, 
+	-28, 1, 85, -61, -106, -66, 74, 39, 
+	10, 27, -14, 55, -46, 0, 64, 64, 
+	13, 16, -107, -82, -69, -22, 25, -84, 
+	-56, 40, 52, 53, 29, -16, 85, -23, 
+	-80, 38, 42, -30, -16, -39, -109, -53, 
+	-36, 56, -36, -19, -87, -41, -24, -79, 
+	24, -158, 11, -34, 111, -96, -114, -41, 
+	-110, -54, 70, -35, -15, -67, 105, 53, 
+	17, -83, -24, -3, 97, 68, -62, -28, 
+	-48, 11, -82, 10, -27, 53, 35, 52, 
+	-39, 48, -8, -18, -117, -114, -47, 47, 
+	8, -101, 40, -51, -13, -13, -4, -143, 
+	-71, -1, 19, 5, -6, 53, 11, -101, 
+	47, 20, -101, -39, -71, 63, -34, -66, 
+	10, 42, 42, 81, 34, -125, 71, -135, 
+	-28, -90, 92, -19, -18, 58, -84, 121, 
+	-44, -22, 90, 95, 16, 79, 32, 75, 
+	-42, 39, -9, -149, -82, 82, 150, 50, 
+	110, 16, -7, 67, -14, 56, -21, 23, 
+	-46, -82, 55, -15, 13, -3, -37, 46, 
+	89, 2, 11, 20, -34, 134, 58, -53, 
+	-238, -47, 17, -15, 15, 21, 113, -31, 
+	68, -24, 75, 62, -41, 62, 75, 3, 
+	-40, 30, 99, -10, 7, -36, 91, -40, 
+	-61, 56, -23, 46, 75, -120, 9, -6, 
+	-25, 8, -50, -38, -99, -63, 61, -77, 
+	-14, 67, -66, -44, 14, -35, -59, -23, 
+	33, -92, -26, -57, 38, -48, 71, -98, 
+	-13, -29, 32, 60, -87, 40, 8, -36, 
+	-19, -6, 12, -78, 51, 33, -3, -27, 
+	51, -109, 0, 36, -94, -66, 39, 16, 
+	30, -67, 108, -52, -9, -78, 40, -88, 
+	-61, -27, 33, 40, -30, 30, -108, -122, 
+	45, 0, -50, -9, -23, -14, -1, -43, 
+	-57, 31, 16, -82, 1, -57, 121, -95, 
+	-86, 13, -90, -39, -52, -77, -41, 23, 
+	-40, -35, 12, 68, -68, 34, -126, 24, 
+	65, -45, -77, -2, -9, 37, -75, -96, 
+	16, -67, -63, 61, 74, -32, -8, 19, 
+	-75, -71, -36, -40, 94, -57, -31, -76, 
+	-55, -25, -23, 2, -22, -23, -9, -130, 
+	62, 40, 10, -33, -38, 70, -5, 4, 
+	-5, -104, -69, -9, -113, -21, 147, -59, 
+	-97, 51, -111, 126, -71, 23, 108, -18, 
+	-91, -20, 8, -10, -128, -46, 123, -48, 
+	-92, 20, -18, 52, -20, 15, 50, -2, 
+	132, -44, -32, 78, 33, -179, 12, 68, 
+	-65, -2, -76, 9, 57, 23, -32, -128, 
+	109, 26, 70, -9, -56, 31, -49, 0, 
+	63, -59, -43, 68, -94, 63, 21, -25, 
+	-15, -13, -18, -34, 17, 25, -5, 4, 
+	-67, -42, -21, -68, -60, -59, 6, 64, 
+	38, -97, -51, -101, 97, -135, 17, -43, 
+	-93, 18, 107, -68, -18, -12, -94, 45, 
+	-12, -85, -22, -53, 24, -5, -89, -76, 
+	-98, -82, 59, -4, -1, -92, -63, 36, 
+	58, -63, 11, 80, -17, 59, -38, -85, 
+	-41, 0, -70, -6, -108, 52, 34, 48, 
+	-76, -38, -66, -133, 31, -121, 24, -118, 
+	-47, -65, -60, -73, -39, 52, 53, 45, 
+	-13, -31, -68, -61, -2, -42, -96, 13, 
+	-2, 16, -76, -96, -15, -6, -22, -157, 
+	62, 30, -44, 56, 26, 3, -125, -16, 
+	-80, 14, -74, -47, 51, -58, -91, -30, 
+	-68, -38, 60, 14, -58, -13, -59, -39, 
+	-20, -30, -163, -2, 40, 19, -78, 57, 
+	-55, -64, -83, 28, -31, -62, 5, 38, 
+	-9, 116, 59, 69, -18, 17, -62, 55, 
+	-78, -17, 49, -12, -45, -1, -77, 8, 
+	-242, 29, 22, -89, -88, -52, -72, -64, 
+	58, 12, -100, 102, 48, -39, -82, 49, 
+	-72, -32, -79, 1, 98, 37, -129, -88, 
+	20, -54, -65, -73, -143, -40, -43, -9, 
+	44, -21, -26, 42, -122, 10, 2, -17, 
+	-22, -122, 36, -121, -61, -25, 41, 46, 
+	-169, 40, -15, 40, -36, 70, 4, 47, 
+	16, 73, -82, 3, -33, -9, -10, 25, 
+	69, -83, 124, 4, -95, -17, 29, -30, 
+	-83, -66, -85, -86, 104, 22, -98, 83, 
+	-7, -54, 80, -95, 3, -9, -85, -75, 
+	-185, 131, -87, -162, -18, -127, -59, -63, 
+	-72, 40, -65, 14, -43, -147, -21, 65, 
+	28, -33, 91, -29, -78, 81, 37, 3, 
+	5, 68, -42, -18, 156, -91, -16, -64, 
+	-46, -39, -55, -29, -150, 17, 49, 23, 
+	-38, -56, -38, -43, 116, -59, 22, -50, 
+	-39, -2, 34, -38, -32, 10, 1, -79, 
+	238, 71, -76, 30, 32, 22, -107, 135, 
+	0, 50, -50, 140, 117, -20, -30, -98, 
+	-21, 17, 11, -106, -15, 68, 87, 36, 
+	34, -32, 28, -42, -24, 114, -166, 25, 
+	87, -77, -151, 9, -81, -36, -96, -104, 
+	-30, -137, -47, 129, 85, -45, 123, -15, 
+	-244, 163, -156, -49, -74, -1, 5, 48, 
+	86, -66, 72, 57, -27, -188, 21, -8, 
+	86, -85, 52, -67, -61, 62, 11, 55, 
+	-72, -102, 28, -41, -108, 1, -131, -114, 
+	-84, -69, -59, -119, -57, 45, 42, -27, 
+	10, 127, -17, -144, -89, 5, -12, -35, 
+	-127, -44, 8, 57, 24, -76, -115, -37, 
+	-46, 8, -80, -165, -8, 11, -28, 70, 
+	-135, -11, 29, -145, -77, 65, -76, -20, 
+	-43, -130, -63, -92, 7, -105, -157, 27, 
+	-89, -63, 14, 34, 10, 105, -53, -36, 
+	-133, -139, -160, -128, -33, -52, -80, -181, 
+	-62, 65, -54, 57, -106, -33, -49, 50, 
+	-164, -82, -137, -62, -26, -65, -146, -23, 
+	-10, 13, 136, -114, -31, 31, -101, -48, 
+	-11, 35, 27, -74, -113, -34, -27, -64, 
+	193, -218, -109, -202, 153, 58, -4, -173, 
+	-66, -19, 37, -86, -27, 113, -39, -54, 
+	42, -96, -123, -75, -110, -44, 19, -36, 
+	84, 25, 10, -108, 1, -197, 79, -58, 
+	-50, 120, -15, 60, 59, 101, -55, 25, 
+	-91, 141, 87, -77, 59, 83, -153, 143, 
+	-25, 104, -51, 8, 58, 36, -3, -39, 
+	-52, -20, -80, -66, 40, 65, -18, 8, 
+	21, 54, -90, 88, 125, -25, 85, 44, 
+	-114, 241, 21, 37, -61, -19, -155, 16, 
+	96, -26, -73, -135, -87, -152, -23, 115, 
+	-45, -86, 38, -29, -97, 15, -21, -7, 
+	17, -75, 22, -99, -94, 52, -134, -38, 
+	40, 217, -57, 11, 79, 16, -138, -137, 
+	-193, -35, -112, -123, -2, -207, -2, -24, 
+	-11, -61, -193, -104, -40, -99, -50, -20, 
+	-125, 8, 81, 10, -108, -159, 12, -116, 
+	44, -14, -26, 28, -132, -47, -62, -5, 
+	-114, -45, 25, 17, 34, 4, -3, 57, 
+	27, -104, -110, -92, 148, 96, 87, 65, 
+	-22, -97, -185, 52, 77, 10, -62, 43, 
+	-118, -111, -138, 163, -105, -32, -82, -113, 
+	44, 70, 37, 40, -72, -129, -82, -144, 
+	-74, 12, -48, 123, 66, -164, 10, 47, 
+	126, -45, 38, -72, 157, 23, 18, -135, 
+	-28, -34, -116, -180, 80, 54, -55, 3, 
+	-59, 72, -76, -5, -182, 43, -77, 95, 
+	-29, 97, 44, -142, 181, -111, -208, -42, 
+	-58, 138, 156, 59, 187, -96, 115, 56, 
+	-3, -45, 151, 21, -5, 123, 53, 84, 
+	-156, 86, 1, 77, 144, 211, -15, 25, 
+	126, 51, -135, -20, -174, 31, -11, -70, 
+	135, 64, 178, 30, 74, 21, 154, -34, 
+	-70, 165, 60, -54, -5, 102, -116, -149, 
+	113, 16, -22, 82, -67, 58, 64, -45, 
+	-83, -46, 164, 59, -37, -144, -97, 48, 
+	-95, 76, -21, 34, -23, -5, 5, 55, 
+	-66, -29, -54, -19, -88, -79, 214, 20, 
+	-24, 107, 47, 203, -30, 125, -32, -120, 
+	11, 1, -39, 60, -30, 23, 29, -19, 
+	135, -88, -11, -19, -110, -4, -72, 117, 
+	65, 35, 32, 68, 161, -32, -81, -44, 
+	-38, 38, 57, -24, 1, 86, -28, -125, 
+	-46, -24, 108, -53, -86, -55, -54, -59, 
+	84, 98, 179, -51, -53, 43, -65, 69, 
+	56, -22, 121, -112, 70, -36, 31, -88, 
+	82, -71, -62, 72, 98, 67, 24, -85, 
+	53, -54, -38, 112, 96, 142, 85, 30, 
+	66, -105, -62, 61, -86, -65, 58, 49, 
+	53, 26, 122, 55, 47, -53, 80, 39, 
+	40, 11, 42, 38, -10, 55, -32, -7, 
+	18, 93, -49, 93, -142, 51, -17, 24, 
+	25, 77, -77, 66, -89, -28, 9, 48, 
+	2, -211, -22, -75, 6, -82, 8, -147, 
+	-52, 66, -63, 15, -42, -90, -41, -157, 
+	2, -58, 16, -10, -6, 78, 30, -27, 
+	158, -47, -89, 21, 63, -153, 110, 10, 
+	65, 28, -74, 190, -10, 146, 127, 62, 
+	-13, -125, -141, 27, 59, 10, -58, -133, 
+	-19, 45, -150, 83, 38, -70, 22, -161, 
+	27, -266, 143, -85, -99, -14, -156, -16, 
+	39, 30, -30, 19, 22, 43, -91, -11, 
+	-103, -125, -117, -227, 76, -95, -73, -56, 
+	-158, -184, -23, 41, 38, -219, -33, -16, 
+	-38, -207, -37, 95, 1, 3, -120, -50, 
+	111, -22, 19, -21, -91, -25, 16, 20, 
+	-29, 72, -38, 61, -161, -43, 192, 75, 
+	102, -86, 163, -9, -13, 100, 28, 13, 
+	103, -155, 73, 13, -115, 51, -148, -124, 
+	-51, 118, -97, -87, -73, -94, 3, -115, 
+	-10, -51, 32, -95, -82, -7, 68, 54, 
+	77, -44, -96, 34, -84, -123, 78, -38, 
+	22, -89, -79, -40, -130, 80, 85, -109, 
+	76, -79, 33, 31, 96, 136, 54, -53, 
+	-147, -61, 135, -47, -8, 4, -106, -44, 
+	-15, -32, 21, -67, 5, 164, 111, -62, 
+	13, -55, -102, 54, -123, 81, -60, 19, 
+	-71, 25, -247, -37, 1, -69, -33, -136, 
+	-44, -90, -131, -125, 1, -184, -1, 34, 
+	36, -28, -124, -146, -116, -125, -41, -31, 
+	24, -101, 54, -32, -65, 90, 50, -129, 
+	-92, -19, -203, -141, 32, 182, 69, -158, 
+	-158, 3, 97, -40, -9, -15, -34, 19, 
+	-43, 10, -351, -38, -34, -85, -91, -52, 
+	-76, -106, -103, -183, 11, -6, -53, -111, 
+	-14, -159, -25, -2, -4, 55, -63, 72, 
+	-23, -72, -30, -112, -2, -195, 17, 36, 
+	-7, -74, -48, -70, -8, -123, 9, -39, 
+	-74, -30, 3, -34, 120, -73, 44, -1, 
+	-79, -135, 66, 14, -241, 47, 129, 51, 
+	-63, -11, -53, -27, -32, -92, 47, -27, 
+	72, -62, -21, 144, -46, 89, 2, -33, 
+	-64, -92, -21, -83, -89, 65, 101, 20, 
+	23, -158, -13, -13, -126, -193, 4, -10, 
+	45, 19, -25, 56, -84, 53, 68, -47, 
+	67, 30, 85, -71, 42, -19, -73, 44, 
+	-28, -18, 20, 26, 28, -1, 26, -143, 
+	-16, -285, -39, 267, 9, 54, 91, 15, 
+	-173, 43, 29, -69, 26, -57, 111, -15, 
+	19, -102, -2, -1, 139, 64, 32, 46, 
+	-123, -32, -132, -67, 99, 33, 71, -137, 
+	-9, -137, 56, 94, -46, -103, -65, -44, 
+	20, 149, 118, -63, -32, 97, 15, 93, 
+	140, -82, 39, -66, -158, 26, -5, -50, 
+	-175, -24, -57, 18, -39, 60, -57, -175, 
+	35, -136, -32, -36, -129, -45, 5, 87, 
+	-7, 8, 11, 26, 121, -17, -96, -182, 
+	-2, 74, -79, 115, 34, -121, -60, 20, 
+	111, -53, 75, 64, 60, 64, -16, 84, 
+	-88, -3, 62, 30, -26, 35, -48, 36, 
+	54, 2, -25, -23, 72, -130, -61, 29, 
+	7, -3, 36, 16, 27, -203, 45, 0, 
+	-24, -31, -42, -128, 38, 44, -3, 44, 
+	-57, 3, 98, 79, -83, -116, 41, 9, 
+	34, 4, 22, 26, -84, 49, 20, -21, 
+	-18, -27, 101, -17, 25, 3, -82, 44, 
+	40, 1, -4, -33, 120, -34, -32, -58, 
+	-117, 86, 3, -129, 65, 0, -54, -61, 
+	38, -132, -90, -117, -44, -93, 33, 66, 
+	92, -116, -37, -55, -117, -17, 121, 71, 
+	96, -158, -188, -14, -82, 23, 66, 120, 
+	-56, 26, 0, 16, -30, 94, 60, -88, 
+	-111, -92, 21, -2, 24, 30, -161, 58, 
+	26, 122, 112, 55, -8, -63, 6, -135, 
+	18, -167, -36, 177, -38, -104, -87, 70, 
+	-114, -11, -56, -107, 72, -40, 86, -44, 
+	-75, -88, -161, -11, 50, 87, 52, 22, 
+	-138, -28, -5, -51, 49, 34, -76, 41, 
+	28, 18, -113, -92, 49, -61, -49, -84, 
+	-95, -20, -50, -28, 56, 165, -129, -67, 
+	-113, -51, -27, -21, 23, -145, -74, 185, 
+	-31, -2, -145, -112, -11, 33, 37, 66, 
+	-100, -73, -163, 121, -5, 72, -43, 28, 
+	-74, 48, -38, -21, 21, 3, -66, 10, 
+	-32, -25, 122, -33, -14, 62, 118, 16, 
+	79, 55, 98, -74, 3, 69, 25, 59, 
+	58, -167, -214, 34, 47, 0, 6, -62, 
+	-95, -24, -9, 20, -70, -106, 78, -65, 
+	88, -2, -49, 76, -18, -79, -84, 32, 
+	-13, -134, -9, 3, 64, 94, 117, -54, 
+	-147, -66, -79, 61, -24, -66, 115, -71, 
+	69, 57, 24, 22, 6, -29, 74, 22, 
+	-41, 48, 100, 24, -59, 134, 125, 12, 
+	70, -31, 5, -116, -39, 79, 68, 36, 
+	-51, 81, -98, 0, 55, 77, -54, -4, 
+	27, 59, -58, 51, -41, -60, -10, 2, 
+	2, -49, -17, -31, -105, -7, -160, -36, 
+	57, -32, 65, -57, 35, 102, 46, 110, 
+	20, 14, -58, -54, -72, 2, 106, -79, 
+	93, -20, -21, 131, -91, 48, 128, 32, 
+	-43, 43, -42, -125, -119, 41, 81, 10, 
+	22, -15, 137, -17, 54, 58, -50, -16, 
+	-211, -15, 50, -22, 26, 25, -28, -29, 
+	-60, 2, 23, -54, -28, -111, -27, -92, 
+	-10, -25, -56, -98, -9, -105, 10, 80, 
+	-62, 149, -62, -218, -69, -81, 44, -24, 
+	-121, 10, -112, 45, 36, 32, -34, 71, 
+	2, -61, -27, 2, 4, -7, 69, 68, 
+	77, 19, 90, -19, 27, 32, -113, -114, 
+	-115, 31, -27, -58, 25, -41, -35, 18, 
+	169, -149, 25, -37, -29, -140, -57, -147, 
+	-150, 30, -129, -125, -24, 8, 6, -178, 
+	69, -39, -5, -17, 65, 49, -51, -182, 
+	-115, 60, 145, -141, -108, -170, -78, 47, 
+	0, 20, 123, 23, 100, 63, -14, -89, 
+	-43, 51, 52, -59, 62, 111, 53, 151, 
+	-120, 0, 37, 28, 86, -14, 25, -90, 
+	11, -103, -34, -19, -28, 48, -19, 6, 
+	57, -10, 58, 45, -140, -27, -51, 70, 
+	25, 17, -10, -12, 10, -120, -39, -73, 
+	-18, -8, -11, -8, 51, 43, 52, -121, 
+	42, -19, 96, -61, -80, -169, -172, -31, 
+	126, -38, 126, -4, -92, 26, 7, 36, 
+	12, -77, 26, 0, 57, -65, 10, -23, 
+	-11, 27, -1, 44, -74, -28, -37, -54, 
+	-34, 107, -30, 126, -72, -40, 110, 59, 
+	-83, 36, 25, 23, 16, -2, -25, 61, 
+	49, -2, 61, 1, 28, -5, 106, 118, 
+	54, -24, 19, -127, -90, 3, 35, -60, 
+	71, -182, -57, -61, 24, -37, -103, -98, 
+	34, -56, 111, -6, -111, -88, -174, -11, 
+	-164, -62, -10, -82, 97, -46, -34, -114, 
+	96, -34, -1, -120, -96, -63, 9, -80, 
+	-99, 53, -150, -66, -15, -159, 23, -29, 
+	4, -20, 35, 40, 72, -24, -90, -103, 
+	-33, 4, 7, 4, -15, -34, 4, -153, 
+	-59, -53, 40, -13, -79, -174, -56, 132, 
+	-131, 48, 143, 90, 91, -18, -166, -84, 
+	-92, -139, 51, 13, -57, -35, -30, -44, 
+	66, -34, 86, 43, -100, 34, -219, 92, 
+	38, -85, -77, -76, 61, 0, 23, -186, 
+	-17, -58, 35, -94, -31, -1, -39, 46, 
+	-34, 68, -240, -51, 31, 16, -42, -77, 
+	171, 42, 11, 156, -81, 1, 128, -123, 
+	-60, -72, 56, -74, -141, -160, -3, 67, 
+	-20, 77, 19, 90, -19, 12, -75, -44, 
+	-59, -76, -70, -48, -47, 27, 69, -50, 
+	108, -25, 23, -6, -127, 43, -139, -109, 
+	-25, 20, 99, 49, 29, 29, 3, 19, 
+	-5, 113, 74, 11, -4, -78, -187, 63, 
+	-90, 73, -133, 28, -71, 79, -101, 84, 
+	34, -127, -35, 89, -95, 32, -20, 140, 
+	-44, 19, 30, 13, 115, 16, 45, -26, 
+	3, -63, -42, 108, 19, -41, 12, 18, 
+	-58, -32, 80, -83, -94, 33, -53, 41, 
+	-136, -36, -45, 44, -43, -109, -30, 16, 
+	21, -68, -50, -176, -128, -32, -40, 36, 
+	34, -112, 9, -42, -78, -92, -87, 84, 
+	62, -143, -20, -91, 165, -33, -168, -84, 
+	-51, -86, -77, -59, -117, -28, 153, -136, 
+	-9, 83, -56, 28, 1, -180, 7, 22, 
+	-36, 85, 35, 1, -141, -46, -126, -160, 
+	28, -93, 114, 135, -119, 45, 11, -93, 
+	63, 32, -83, 34, -62, 44, -114, 73, 
+	3, -39, -62, -47, 42, 29, 72, 87, 
+	-9, 0, 2, -82, -83, -56, -185, 13, 
+	9, -36, -396, -36, -33, 99, -17, 31, 
+	-72, -27, 46, 55, 59, -39, 48, 20, 
+	28, 30, -68, -42, -101, -28, 22, -25, 
+	-65, 120, -137, -46, -167, 35, 32, -26, 
+	154, -51, 5, -61, 49, -30, -37, -11, 
+	47, -56, -50, -49, -87, -122, 128, -81, 
+	-145, -31, 28, 60, 35, 19, 123, 48, 
+	36, 141, 17, 126, 55, -23, -76, -7, 
+	65, 47, 81, 61, -184, -13, 123, 81, 
+	-160, -109, -14, 24, -50, 40, -136, -41, 
+	68, -88, 79, -83, 92, 47, 18, -64, 
+	-83, 60, 44, -109, -96, 45, 69, 88, 
+	-140, 47, 46, -95, 6, 64, 136, -71, 
+	52, -83, -66, 44, -1, 12, 15, 29, 
+	17, -45, 18, 38, -13, -4, 79, 61, 
+	28, 150, 59, 41, -18, 145, -12, -36, 
+	29, 2, -25, 73, 35, -23, -45, 69, 
+	-151, -133, 75, -105, 48, -60, 25, -64, 
+	60, 4, -10, -44, 119, -5, -28, -57, 
+	-42, -107, 81, -145, -57, -64, 53, 22, 
+	-54, -71, 36, 68, -38, -107, 128, -46, 
+	49, -29, -86, -39, -52, -75, 45, -77, 
+	59, -59, -9, 105, -108, 128, 61, 7, 
+	-19, 4, 15, -34, -147, 26, 105, 47, 
+	12, 72, -94, -16, -141, 88, 173, 28, 
+	-64, -82, 60, -224, -27, 64, -39, -22, 
+	39, -83, -106, -91, -20, 52, 34, -19, 
+	-166, -43, 38, -84, 3, 39, -10, 65, 
+	53, -37, -178, -126, 43, -58, -51, 52, 
+	-101, 8, -87, -6, -351, -146, 59, -126, 
+	-96, 43, 77, -39, -98, 0, 43, 2, 
+	-17, 13, 94, -11, -253, 108, 55, 21, 
+	-95, -59, 127, 12, -180, -148, 157, 13, 
+	19, 10, -11, -54, -32, -8, -37, -240, 
+	57, -29, -3, 2, 99, -22, -78, -63, 
+	-89, -12, -103, -152, -56, -20, 161, 207, 
+	-97, 44, -35, -142, 113, -32, 26, -38, 
+	-49, 104, 31, 16, -32, 76, -72, 54, 
+	-97, 53, -27, 131, 84, 94, -24, -80, 
+	-20, 53, -86, -114, -95, 36, 90, -65, 
+	-112, 63, -36, -14, 68, -57, -67, 39, 
+	-52, 58, 12, -144, -90, -206, -224, 23, 
+	31, 52, 74, -6, 64, 79, -89, 29, 
+	-86, -84, -91, -13, -35, -105, -138, -12, 
+	79, 22, -61, -92, -51, -44, -175, -41, 
+	-28, 42, 5, -119, 16, -82, -95, -68, 
+	-91, -18, 23, -111, -18, -113, -64, -46, 
+	-148, 44, -72, -2, -79, -148, -80, 43, 
+	16, -137, -204, -1, 33, -32, -17, 87, 
+	-77, 47, -30, 28, -69, -64, -159, -62, 
+	2, -116, -37, -47, -104, -21, -46, 80, 
+	-27, 64, -31, 174, -58, -36, -126, -38, 
+	-68, -87, -4, 64, -47, 9, -28, 5, 
+	-9, -89, -11, -136, 54, 55, -66, -58, 
+	20, -138, -100, -74, 46, -84, -73, -88, 
+	-124, -95, -32, -86, 87, -73, -27, -1, 
+	-16, 9, -147, -60, -71, -37, 38, 41, 
+	31, 101, 12, 81, -29, -54, -69, -62, 
+	21, -23, -141, -25, -40, -125, -58, -74, 
+	-71, 46, 43, 24, 41, 108, -78, 68, 
+	61, 66, 11, 66, 75, -9, 88, -57, 
+	44, 134, 54, -28, 29, 134, -165, -11, 
+	-53, -58, -64, -128, 83, 3, -123, 150, 
+	126, -51, 4, -39, 23, -33, 51, 17, 
+	-48, -55, 19, 20, 0, -17, 19, -36, 
+	69, 94, 67, 1, -52, -45, 23, 26, 
+	-50, -16, 57, -10, -102, 96, 99, 0, 
+	-4, -167, 55, 39, 6, 79, 97, 25, 
+	-14, 47, -151, 96, 94, 3, -40, 31, 
+	-25, -6, 65, -38, 80, -49, -81, -72, 
+	-98, 4, 62, 20, -113, 42, -30, 64, 
+	106, -105, -3, -12, 54, 25, -35, -25, 
+	-61, -96, 110, 27, -52, 3, -33, 106, 
+	-115, -84, 6, -18, -88, 86, 31, -119, 
+	-74, -78, 14, -94, 148, -108, -142, -76, 
+	-16, -58, 86, -60, 1, -36, 106, -1, 
+	-78, -14, 22, 113, 21, -36, 46, 64, 
+	-136, -26, -64, -54, 61, -99, 68, 29, 
+	-110, -106, -116, 67, -110, 91, -4, 31, 
+	-1, -8, -89, -46, 56, -30, -65, -48, 
+	-51, -25, 60, 10, -50, -79, -84, 31, 
+	-75, 7, -96, -37, 63, -107, -170, -111, 
+	9, -112, -27, -38, -30, -127, -88, -66, 
+	25, -73, -81, -57, -101, -40, 39, -35, 
+	-15, -96, -37, -86, -21, -29, 164, 9, 
+	70, -21, -82, -47, -22, 14, -49, -105, 
+	15, 3, 6, -17, -41, 87, -6, 85, 
+	44, -63, 110, 98, 73, 33, 56, 6, 
+	6, -9, -184, 57, -140, -134, 100, -22, 
+	6, -4, 72, 141, -48, -4, -21, 122, 
+	-15, -144, -198, -3, 48, 12, 40, -68, 
+	-33, -78, -62, -134, 104, 79, 4, -13, 
+	-158, -8, -45, -19, 44, 12, 115, -12, 
+	-19, -171, -54, 55, -1, -102, 64, 53, 
+	-6, 76, -10, 101, 68, 79, 49, 27, 
+	81, 66, 83, -72, -38, 63, -93, -25, 
+	-15, -116, -24, 89, -39, -42, 29, 22, 
+	-5, -19, -82, 18, -80, 22, -52, -100, 
+	-10, 13, -157, 49, 81, 92, -40, -118, 
+	-2, -155, 27, -34, -18, 32, 69, 88, 
+	49, -13, 67, -36, -98, -56, 74, -54, 
+	3, 32, 38, 63, 96, 19, -60, 70, 
+	-99, -8, 23, 23, 29, -39, -16, -111, 
+	20, -56, -122, -93, 25, -53, -44, -16, 
+	-158, 88, 95, 20, 44, -32, 33, -84, 
+	47, -70, -7, -120, -26, -173, -81, -114, 
+	18, -71, -28, -16, -68, -51, -60, -124, 
+	-21, -27, -228, 9, 60, -19, 123, 86, 
+	89, 7, -155, -186, 87, 16, 47, -47, 
+	-9, -57, 90, 52, -73, -32, -44, -59, 
+	-98, 83, 55, 11, 55, 69, 1, -16, 
+	-72, 153, -55, 8, -86, -71, 28, -83, 
+	-14, -53, -105, 22, 92, -3, -40, -52, 
+	26, 77, -26, -144, -117, 42, -53, -31, 
+	-43, 80, -24, -61, -8, 71, 3, -53, 
+	-239, 72, 29, 60, 59, -166, -121, 100, 
+	30, 168, 143, -189, -82, 7, 18, -93, 
+	101, -100, 34, 52, 68, 44, -268, 86, 
+	-59, 106, 98, -48, -6, -71, -18, -176, 
+	-71, -29, 23, 16, -97, -67, -123, -5, 
+	-137, 64, -87, -36, 20, 12, 12, -32, 
+	131, 35, 6, 78, -8, -64, 7, -21, 
+	-66, 114, 49, 71, 54, 53, 92, 13, 
+	-36, -100, -21, -51, -55, -45, -43, 35, 
+	-48, 32, 54, -80, 29, 64, -9, -9, 
+	78, 10, -22, 75, -97, -11, -237, -46, 
+	-85, -31, 21, -123, -57, -44, 37, -22, 
+	19, -6, 31, 22, -48, -161, 157, -103, 
+	-103, 130, -72, -76, -108, -38, 5, 50, 
+	65, -143, 55, 64, -77, 45, 63, 114, 
+	57, -24, -41, -127, 122, 86, -40, -5, 
+	180, 75, -140, 7, 15, -187, -30, 28, 
+	46, 74, -17, 71, -49, 76, -143, -38, 
+	53, -134, 5, 7, 84, 44, -290, -22, 
+	56, -21, -51, -17, 15, -48, -53, 46, 
+	12, 20, 26, -107, 97, -9, 8, 10, 
+	-134, -44, -14, -131, 109, -89, 87, 88, 
+	7, -84, 97, 70, 0, 58, 12, 140, 
+	14, 60, -7, -34, -10, -85, -15, -35, 
+	153, -53, -73, 78, -54, 22, 24, 13, 
+	-133, 30, 6, -20, 17, 110, -29, 19, 
+	-66, -36, -86, -108, 66, -39, -169, -131, 
+	46, -114, 51, -68, -2, -58, 58, 130, 
+	105, -185, -48, -88, 142, -58, 67, -41, 
+	-58, -100, -6, 135, -112, 40, -122, -78, 
+	-38, -33, -7, 53, -35, 99, -43, 35, 
+	60, -38, -5, -71, -21, -81, 100, -134, 
+	169, 3, 32, -58, -85, 8, 172, 87, 
+	-24, 6, -112, 1, 87, 43, -42, 75, 
+	-7, -113, -15, 34, 21, -73, 20, -26, 
+	-72, -99, -95, 65, -98, -64, 104, 87, 
+	35, -145, -62, -64, 64, -90, -16, 41, 
+	-29, -36, 118, 66, 19, 38, 67, 68, 
+	-120, -62, 37, -41, 69, 58, -37, 62, 
+	-57, 24, -4, -125, -52, -62, 55, 41, 
+	-112, -47, 16, -132, -106, 69, -55, 51, 
+	-143, 36, 25, 23, 68, 80, -30, -24, 
+	-14, -169, 48, -5, -64, -42, 44, -57, 
+	-83, -35, -36, 42, -9, 177, 81, 134, 
+	-81, -70, 32, 116, -17, 97, -7, -41, 
+	3, 33, -60, 83, -50, -123, 1, 66, 
+	-128, 39, -32, -184, -21, -71, -106, 31, 
+	-35, 6, 26, -40, 33, 7, -153, -10, 
+	-153, -55, 162, -139, -17, -26, 102, 107, 
+	-185, -8, -49, -41, 96, 40, -36, 7, 
+	18, -254, -17, 93, -57, -59, 20, 24, 
+	-172, -31, 30, 127, -89, 88, 79, 4, 
+	77, -33, -28, -95, -139, 120, -73, -94, 
+	79, -22, -208, 56, -116, -23, -99, -18, 
+	-95, -77, -87, -90, 5, -210, -23, -138, 
+	-41, -51, -4, -145, 54, -54, 1, -34, 
+	-107, -34, -41, -143, 8, -87, -45, 19, 
+	-52, 103, -18, -53, 46, -24, -10, 12, 
+	-31, -117, -17, -7, 110, 30, -2, 17, 
+	-66, 147, 88, -44, -15, 28, -75, -96, 
+	-44, 67, -30, -81, -111, 69, -93, 24, 
+	-80, 1, 3, -116, -3, 59, -13, -108, 
+	0, 22, -114, -115, 59, -103, -66, -39, 
+	-67, 64, 20, -51, -55, -69, -107, -84, 
+	-5, 46, 60, -6, 14, -21, -48, 9, 
+	-178, 18, 50, -86, 99, 67, -38, -120, 
+	12, -208, 6, -82, 49, 11, -18, 111, 
+	-41, -42, 86, -11, 48, -129, -72, -69, 
+	14, -250, 81, -17, -78, -68, -148, -31, 
+	-101, 119, -130, -28, 18, 90, 2, 12, 
+	-22, -29, 27, 2, -95, -61, -16, -64, 
+	-31, -98, -81, -99, 86, 88, 98, 10, 
+	-22, 48, 113, 21, 65, -72, 39, 13, 
+	67, 23, -205, -9, -74, -14, -84, -61, 
+	42, 21, -11, 69, -33, -28, -186, 65, 
+	1, -10, 101, -64, 33, -120, 3, -71, 
+	-18, -57, 28, 29, -101, -97, -6, -69, 
+	-2, -1, -163, -126, 43, 62, -143, -83, 
+	97, -108, -24, 42, -150, -14, -17, -37, 
+	23, 80, -170, -59, 42, 56, -19, 49, 
+	-39, 19, 112, 104, -10, -31, -16, -61, 
+	-41, 21, 75, -55, 4, -64, -91, -16, 
+	103, -78, -27, 83, 119, 150, -157, -4, 
+	-18, -20, -58, -85, 71, 70, 67, -18, 
+	43, -130, 37, 16, -30, 87, -18, -128, 
+	19, 40, 59, 40, 70, 120, -5, -46, 
+	-27, -39, -18, 30, -61, -110, 17, 46, 
+	62, 7, -252, 27, -38, 0, 7, -56, 
+	-131, -67, -30, -153, -143, -17, -73, -74, 
+	-33, -156, 61, 31, -55, 166, 97, -110, 
+	92, -97, -63, -34, -106, -94, -86, -48, 
+	-34, -14, -79, -6, -93, 9, 66, 138, 
+	86, 87, 61, -9, -204, -62, 6, 46, 
+	-63, 129, -175, 77, -80, 10, 72, 71, 
+	-173, -107, 38, -28, 33, 10, 13, -36, 
+	45, -95, -81, 6, -34, -60, -29, -123, 
+	-26, 112, 44, 76, -116, -92, -27, -57, 
+	98, -106, -98, 45, -53, 67, 87, -16, 
+	46, -188, -49, 37, -34, -99, 107, -63, 
+	-65, 73, -18, 70, -49, -31, 10, 67, 
+	46, 85, 98, -16, -171, -33, 8, -32, 
+	-41, 53, -57, -6, -154, -113, 23, -16, 
+	-34, -10, -83, 10, 136, 56, -54, 48, 
+	66, -90, -81, -83, 76, 28, 25, -9, 
+	-133, -2, -29, -151, -35, 28, -60, 64, 
+	-8, -145, 18, -40, 5, 50, 35, -47, 
+	-53, 17, -121, -88, -84, -38, 37, -47, 
+	61, 7, -84, 104, -13, 25, 34, -10, 
+	-86, 50, -5, 61, 72, 2, -3, 45, 
+	-143, -56, -214, -86, -9, 24, 88, 39, 
+	80, -77, 4, -83, -28, 90, -18, 59, 
+	-110, -12, -66, -95, -73, 94, -80, 13, 
+	-87, -99, 37, -66, 5, 36, 76, -5, 
+	123, 37, -81, -151, -82, -61, 94, 21, 
+	-8, 39, -8, -21, -35, -9, 149, -58, 
+	-43, -123, 69, 6, -60, -70, -45, 20, 
+	11, 66, 17, 89, -44, -56, 69, 30, 
+	-80, 0, 75, -32, -92, -64, 109, -15, 
+	-70, -59, 40, -57, 50, -75, -129, -240, 
+	-91, -14, 113, 37, 38, 110, -105, -226, 
+	-55, 69, -82, 67, -85, 53, -65, -83, 
+	7, -24, -148, 7, -7, -51, 47, 43, 
+	-134, 157, -75, 32, -71, -15, 107, -114, 
+	-38, -41, -9, -11, 79, -81, -65, -69, 
+	-95, 62, -12, -29, -31, -76, 126, 16, 
+	-90, -81, 39, -67, -20, -64, -5, -114, 
+	31, -92, -65, -18, -5, -39, -139, -71, 
+	-1, -51, 108, 30, -27, 82, 68, 42, 
+	21, -31, 25, -11, -72, -116, 48, -47, 
+	49, -17, -25, -64, -15, -81, -32, 37, 
+	-53, 219, -40, -66, -63, -31, -114, -38, 
+	-108, -15, -37, -29, 77, -84, 36, -68, 
+	-107, -32, -144, -26, 61, -56, -23, 22, 
+	-77, -143, 130, -20, -30, -73, 19, -133, 
+	-63, 52, -74, 42, -85, 28, -71, -63, 
+	-57, -54, 91, 16, -103, -24, -38, -51, 
+	-120, 102, -22, 111, -5, -68, 8, -20, 
+	-55, -90, -71, 58, -29, 30, 124, -31, 
+	-57, -42, -52, 46, -108, -2, -182, 9, 
+	44, 19, -6, 46, 14, -60, -13, -21, 
+	121, -74, 52, -130, 5, -82, -92, -12, 
+	16, 82, -7, -165, -17, 43, -51, -72, 
+	19, 2, -19, 112, -73, -14, 13, 90, 
+	-11, 78, -49, 42, -57, -58, 13, -1, 
+	-75, 24, -96, 90, -76, -52, -103, -18, 
+	15, -150, -29, 120, 36, 32, -6, -15, 
+	55, -113, 64, -29, -79, -15, -219, 18, 
+	121, -9, 13, 3, -85, -19, 0, 48, 
+	23, -28, -2, -7, -84, -92, 36, -58, 
+	78, 22, -259, 48, -53, 75, -65, 107, 
+	53, 9, 63, 111, -11, -32, 62, 29, 
+	40, 56, -133, 60, 136, -61, 44, -106, 
+	-33, -29, -174, 21, 17, -116, -104, 24, 
+	-98, -10, -26, -51, 92, 82, 16, 28, 
+	140, -69, -19, -43, -43, 83, -149, 45, 
+	-38, -25, 50, 98, -139, 31, 68, 74, 
+	-16, 0, 51, -78, 8, -54, -40, -18, 
+	-93, 105, -227, -99, -6, 31, -4, 42, 
+	-104, -53, -50, 120, 24, -63, -9, 120, 
+	-37, -29, -168, 51, 130, -133, 56, 36, 
+	-21, 64, -9, 31, -16, -44, -22, -75, 
+	-103, -63, 43, -52, -71, -64, -67, 31, 
+	-55, 137, 84, 23, 71, 50, 12, 88, 
+	-80, -41, 58, 42, -64, -106, 7, -88, 
+	-122, 48, 61, -49, 75, -41, 28, 1, 
+	23, 7, -89, -90, -69, -59, -77, -28, 
+	-80, -146, 33, 53, 59, 4, -139, -78, 
+	111, -34, -53, 12, -98, 78, 44, -37, 
+	-32, -16, 14, -106, 4, 75, -117, -88, 
+	54, -71, 33, 127, 3, -39, -150, 38, 
+	51, -31, 1, -18, -41, -39, 9, -61, 
+	9, 83, 35, -80, 12, 23, 32, -64, 
+	-138, 30, -4, 143, 31, -50, -54, 2, 
+	41, -53, -158, -21, 34, -118, 21, 90, 
+	-30, 48, 104, -40, 58, -76, -141, -20, 
+	34, -78, -157, 62, -17, 5, -115, -38, 
+	-59, -121, -102, -191, 19, -22, 38, -18, 
+	50, 46, 31, 101, 37, 16, -141, -75, 
+	-33, -103, -54, -111, 7, -75, 84, -8, 
+	80, 13, -119, 52, -140, 14, 35, -84, 
+	-60, 31, -132, 29, 144, 16, 108, 28, 
+	48, -6, -148, -44, -91, -61, 9, 118, 
+	-157, 91, 36, 1, -61, -19, -48, -103, 
+	21, -119, -135, 30, -30, 15, -17, 73, 
+	9, 81, 108, -77, 49, -55, -82, -56, 
+	-26, -189, 103, -28, -23, -61, -58, 39, 
+	-31, 80, 65, -93, 92, 65, 96, 57, 
+	-140, -133, -92, -82, 54, -148, -72, -83, 
+	-74, -123, -1, 30, 60, -50, 9, -65, 
+	-6, -109, 34, 72, 10, -52, 0, -33, 
+	-10, -11, 34, -18, -4, 83, -1, 19, 
+	3, -10, 24, -36, -47, -37, 15, -22, 
+	-84, -27, 34, -36, 13, 13, -84, -51, 
+	37, -5, -21, -93, -24, -63, -69, -17, 
+	8, 80, 6, -85, -16, 71, -65, -85, 
+	-75, -21, -28, -16, 89, -32, -60, -105, 
+	-34, -46, -157, 96, -31, -4, 61, -29, 
+	59, -43, -47, 22, -54, -33, 28, 34, 
+	15, 22, 43, -94, -1, 139, -85, -120, 
+	-12, -90, -45, -29, -111, -10, 23, -7, 
+	-68, -114, 98, -152, -64, -17, -64, -33, 
+	94, -9, -21, 5, 34, -117, -61, 5, 
+	8, 54, -18, -113, -30, 46, 59, -68, 
+	-97, 72, -14, 50, 70, 14, -43, -17, 
+	-96, -49, -6, -4, -1, 124, -38, 8, 
+	104, -6, -19, 55, -302, -17, -30, 41, 
+	-67, 37, -1, -86, 30, 29, -161, 29, 
+	-140, 6, 88, -14, 79, -114, -140, 49, 
+	10, 10, 120, 65, 13, -25, -70, -135, 
+	65, -136, 140, 113, -16, -31, -58, 146, 
+	8, -112, -95, -35, -88, -47, 4, -63, 
+	62, -92, -63, 87, -47, -7, -75, -134, 
+	-81, 189, -5, 142, -128, -62, 20, 43, 
+	25, -35, 27, -63, -42, -30, -41, 119, 
+	94, -89, 25, 60, 102, 120, 21, 49, 
+	48, -149, -2, 35, 19, 38, 49, -20, 
+	-35, -21, 78, 96, 94, 109, -51, -83, 
+	-31, 65, 52, -59, -46, -32, 58, 81, 
+	34, 35, 62, -10, 87, 4, -7, -58, 
+	74, 6, -100, -2, -31, -39, 54, 5, 
+	49, 97, -50, -6, -40, 4, 149, -13, 
+	-14, 23, 57, 42, -104, -1, 1, 143, 
+	-25, -31, -39, -69, 100, 115, 68, 77, 
+	-143, -40, 118, 0, -66, 136, -80, 41, 
+	12, -88, -26, 26, 29, 95, -48, -84, 
+	99, 12, -179, -84, 46, 90, 103, 28, 
+	-66, -210, 6, 16, -103, -84, -43, -52, 
+	208, 115, -30, 35, -61, -67, -25, -58, 
+	41, 117, -15, 59, -23, 3, -28, 34, 
+	-58, -100, 154, 1, 45, 77, 75, -100, 
+	-72, 118, -192, 34, 80, 261, 57, -27, 
+	10, -27, -64, 117, -24, 137, -123, 62, 
+	-40, -34, -26, 210, 2, 78, 32, -68, 
+	-46, -223, -156, 28, -85, -79, 57, -52, 
+	-78, -39, -33, 84, -86, -28, 117, 18, 
+	69, -161, -53, -111, -121, -232, -65, -43, 
+	-14, -69, 4, -63, 2, -161, 69, -89, 
+	-33, -52, 5, -97, 6, 19, -71, -87, 
+	33, -269, -172, 169, -3, 61, 215, 65, 
+	-86, 46, 134, 108, -65, 93, 15, -12, 
+	-36, -53, 49, 30, -79, 86, 17, 6, 
+	47, -155, -88, 20, -99, -33, -2, -70, 
+	-47, -120, -5, -104, -63, -83, 22, -127, 
+	58, 183, -13, 61, -139, 28, -185, 3, 
+	30, -48, -44, -84, 30, -55, -75, 27, 
+	3, -199, 75, -132, -47, 54, -34, -127, 
+	-34, -166, -124, 101, -66, 8, 17, -37, 
+	-142, -54, 123, -13, 76, 35, -75, -137, 
+	-48, -24, -16, -92, 23, -67, -44, 9, 
+	-48, -129, -69, 102, -90, -85, 63, 115, 
+	5, -231, -59, 58, 46, -24, -59, 31, 
+	-81, 39, 35, 13, -76, 15, -6, 71, 
+	-11, -34, -12, -153, -101, 22, -159, -68, 
+	44, -54, -6, -104, 118, 66, -5, -65, 
+	-139, -110, 52, -53, 121, -6, -148, 106, 
+	-49, 20, -94, -35, 81, 44, -33, -110, 
+	-48, 66, -175, -77, -83, -139, 32, 27, 
+	-204, 45, 14, 56, -11, 194, -99, -214, 
+	52, -112, -56, 34, -58, -44, -124, 7, 
+	-138, -51, -1, 41, 2, -61, 27, 120, 
+	51, -154, 15, -205, 4, -188, -107, 47, 
+	-92, 31, -149, -43, 57, 71, -258, -82, 
+	-38, -58, -98, 40, -59, -235, -126, 12, 
+	104, -66, -141, -1, 3, -260, 90, -28, 
+	-56, -7, 10, 77, -100, -33, 12, -10, 
+	-126, 67, -89, -56, -93, 15, -100, -53, 
+	-79, 13, 3, 8, 7, 28, 99, -55, 
+	-9, -92, -15, -66, 103, -84, 41, 44, 
+	-14, 13, -57, 47, 35, -57, -161, 69, 
+	-209, 59, -127, 40, -107, 52, -44, 12, 
+	38, -109, -21, 22, 44, 48, 109, -30, 
+	18, 180, -31, 6, -36, -108, -75, -188, 
+	24, 59, 98, -217, -162, -23, 37, 2, 
+	49, -61, 67, 97, 11, 63, -92, 7, 
+	131, 109, 69, 35, 15, 75, 123, 77, 
+	-64, 1, -55, -115, 63, -25, 1, 15, 
+	40, 9, 17, -36, -24, -93, 31, -39, 
+	42, 68, -260, 103, -171, 19, 46, -44, 
+	-50, -54, 9, -40, 61, -96, -40, 18, 
+	56, 142, 73, 57, -7, -3, 156, -95, 
+	29, 213, 94, 209, 20, 25, -40, -32, 
+	159, -158, 8, 167, -97, -1, -8, 71, 
+	-68, 204, -155, -90, -25, 59, 177, 50, 
+	128, -38, -42, 3, 96, 185, -62, -115, 
+	-100, 101, -61, -21, -98, 83, -54, 65, 
+	128, 31, 238, -184, 22, 62, 180, -24, 
+	-87, 203, -87, 184, 190, 91, 96, 19, 
+	-193, -98, 40, 29, -144, 17, 160, 22, 
+	-140, -40, -223, -82, -45, 118, 79, -73, 
+	-3, 28, -60, -54, -159, -90, 39, -74, 
+	-130, 96, -53, -85, -48, -123, -226, -161, 
+	-141, -46, 37, -62, -89, -75, -3, -7, 
+	-18, -32, -30, -108, -13, 83, -127, 4, 
+	4, -140, -22, -40, -208, 41, -166, -109, 
+	12, -29, 3, -30, -14, -63, -157, 66, 
+	-143, -142, -54, 80, -51, -114, -24, -147, 
+	-11, -43, -68, -61, 6, 52, -64, -47, 
+	-38, 39, 29, -89, -110, 0, -6, -148, 
+	-36, 97, 31, 6, -53, -96, -219, -51, 
+	-54, -117, -101, 47, -81, -34, -67, -31, 
+	-113, 74, -145, -25, -28, -27, -63, -18, 
+	-10, -55, -45, -72, 1, -56, -54, -117, 
+	50, -168, -131, -7, 40, -93, -43, -70, 
+	-93, -58, -18, -46, -51, -30, -67, -29, 
+	-180, 197, -81, 62, -34, -167, -49, 15, 
+	-181, -96, -136, 8, -65, 0, -133, -2, 
+	-31, 54, -125, -168, -57, 19, 139, 1, 
+	-61, -99, -135, 25, 30, -22, 65, -268, 
+	-82, -90, 3, -68, -34, -9, 115, -2, 
+	-27, 70, 153, -151, 118, 42, -62, 52, 
+	34, 126, -99, -148, -128, -79, 51, -155, 
+	-43, -187, -150, 105, -63, 146, 81, -204, 
+	-97, -59, -139, -108, 88, -91, -22, -152, 
+	16, 29, -127, -165, -106, -40, -102, -216, 
+	-138, 167, -87, -43, -74, -214, -177, -103, 
+	12, 11, -64, -200, -137, -237, -64, -69, 
+	-4, -84, -46, -82, -70, -115, -58, -67, 
+	-54, -201, -200, -12, -168, -179, -184, -113, 
+	-76, -221, -45, -24, -87, -199, -161, -174, 
+	-109, -89, -137, 41, -39, -108, -108, -21, 
+	-132, -53, 10, -113, -155, -137, -122, 14, 
+	-12, 60, -89, -93, -65, -71, -41, -109, 
+	-110, 71, -56, -120, -68, -46, -47, -13, 
+	-103, -84, 4, -60, -27, -9, 19, -38, 
+	-94, -19, -81, -80, -32, 106, 21, -18, 
+	-77, -171, 2, -36, -32, -66, -6, -60, 
+	-104, -96, -65, -41, -51, -13, -15, -72, 
+	-30, -86, -29, -127, -56, 7, 21, -75, 
+	90, 273, 78, 143, -180, -112, -107, -164, 
+	-77, -108, -153, 164, -126, 104, -2, 109, 
+	4, -93, -77, 51, -201, 12, 134, -102, 
+	-26, -167, -132, -61, 109, 269, 73, -76, 
+	-67, -64, 238, -101, -97, -129, 0, 11, 
+	114, 185, 384, -37, 147, 75, 77, 122, 
+	137, 432, -136, -23, -160, -66, 41, -56, 
+	-29, -125, 37, -26, 64, 126, -10, -137, 
+	-17, -62, -1, 59, 63, -93, 0, -171, 
+	-100, -150, -93, -98, -66, -1, -36, -140, 
+	-181, 104, -6, 73, -84, -153, -101, -31, 
+	-102, -81, 45, 47, -154, -10, -102, -76, 
+	-93, -17, -136, -52, -212, -41, -23, 58, 
+	-40, -21, -20, -38, -141, -128, -154, -42, 
+	24, -14, -63, 20, 49, -111, -1, -114, 
+	-60, -70, -106, -55, -112, -21, -71, 84, 
+	-34, -82, 158, -7, -3, 11, -114, -109, 
+	46, 77, 46, -98, -19, -36, -101, -8, 
+	22, 65, 35, 38, 113, -149, -94, -56, 
+	-139, -141, -114, -110, -139, -23, -66, 5, 
+	-25, -117, -60, -97, -55, -74, -149, -23, 
+	31, -35, -173, -51, -94, 0, -91, 43, 
+	-26, -174, 13, -24, 74, 42, -21, -45, 
+	4, 52, 59, 10, -99, 0, 26, -104, 
+	-51, -31, -61, -23, -29, 59, 63, 89, 
+	-34, 6, -42, 5, 68, 115, -63, 42, 
+	-77, -23, -67, 150, -13, -45, 136, 16, 
+	-26, -78, 64, 175, 97, -128, 73, 117, 
+	97, 23, -10, -121, -209, -84, 27, 25, 
+	44, -25, -97, -39, 0, -18, 15, -83, 
+	-33, 10, -79, -71, -42, 16, 69, -55, 
+	6, 180, 133, -31, 109, 125, 18, -18, 
+	-34, -21, -74, 23, 35, -134, -23, 1, 
+	-99, 36, 188, 80, -87, -138, -106, -92, 
+	50, 29, 129, 29, 156, 56, 28, 81, 
+	-98, -182, 110, -181, 61, -11, -89, -85, 
+	36, 14, 34, -119, -4, -114, -87, 61, 
+	11, 6, -9, -63, 47, -23, -151, 35, 
+	88, 69, -46, -27, 34, -39, -70, -182, 
+	51, -36, 36, -46, -28, 6, 59, -78, 
+	-43, 132, -161, 157, -47, -88, -23, -80, 
+	-119, 9, -156, 85, 12, -73, 25, -55, 
+	-8, -145, 54, -38, 12, 65, 63, -12, 
+	-13, -115, -123, 8, 17, -132, -112, -53, 
+	-76, -48, 15, -67, -27, -48, -163, 20, 
+	-110, 61, -1, 2, 36, -39, -109, -36, 
+	35, 12, -110, 182, -63, -141, -97, 174, 
+	31, -100, -128, -35, -51, -54, -42, -77, 
+	-42, 74, -134, -23, 7, -5, -113, 42, 
+	56, -97, 82, -128, -35, 72, -59, -38, 
+	83, -74, -16, 88, -114, -22, -57, -31, 
+	-56, -44, 71, 48, -94, -61, -12, 53, 
+	6, -107, 33, 24, 8, -72, 11, -48, 
+	-50, -2, -205, -30, -41, -47, -56, 65, 
+	40, -265, 80, -67, -69, -127, -53, -78, 
+	13, 68, -57, -52, -85, -54, 79, -57, 
+	-34, -53, 99, -29, 109, 36, 36, 48, 
+	-153, 62, 127, 80, -4, 64, -94, 79, 
+	60, -95, -73, 28, 0, -125, -94, 61, 
+	67, 52, 16, -39, -105, -63, 5, -79, 
+	78, 83, -8, 60, -41, -157, -4, -45, 
+	137, -11, -22, 47, -88, 16, 62, -7, 
+	-2, -134, -16, -40, 107, 103, 75, 4, 
+	75, 26, -149, 82, -27, -117, 21, 79, 
+	-38, -7, -94, -111, -32, 64, 17, -65, 
+	-38, 78, -154, 106, 122, -36, 56, 60, 
+	-126, -381, -33, -42, -85, 54, -77, 88, 
+	-186, 143, -21, -66, 57, 267, 23, -8, 
+	-13, -41, 64, 25, -123, 18, -287, -26, 
+	228, -7, 3, 104, 7, 69, -68, 7, 
+	-105, 134, 80, -169, -30, 60, 41, -81, 
+	-22, -24, -112, -68, 33, -40, 41, -32, 
+	165, 36, 13, -82, 57, 85, 6, 6, 
+	-63, -67, 19, 7, -57, 22, 36, 98, 
+	111, -183, 3, -57, 5, -33, -48, -106, 
+	-1, 32, -95, -35, 5, -63, -29, 38, 
+	5, -34, -11, -162, 90, -8, 146, 52, 
+	-135, 81, -12, 73, 82, -35, 73, 23, 
+	22, -136, 30, 46, 28, 32, 71, 62, 
+	-17, -8, -74, -12, -55, 19, 29, 58, 
+	73, 24, 1, 63, 85, 60, 9, 33, 
+	-181, 29, -99, -3, 120, -23, -99, 61, 
+	20, -9, 26, 74, 21, -112, -47, -76, 
+	87, -52, -20, 121, 79, -44, 32, -22, 
+	-20, -2, -22, -51, -34, -38, -103, 57, 
+	-72, 12, 139, -28, -1, 22, -16, -5, 
+	57, -52, -111, 14, 51, 71, 147, -47, 
+	-14, -57, -4, 90, 21, 30, -13, 51, 
+	-21, 68, 136, 38, 38, 60, 8, -37, 
+	-89, 34, 76, -100, -11, 35, 22, 57, 
+	16, -69, 2, -16, -61, 48, -20, -21, 
+	-135, -44, -2, 71, -27, -81, -33, -133, 
+	-122, 43, 19, 122, -8, -155, -171, -28, 
+	-111, 40, -8, -47, 54, -47, -105, 51, 
+	-46, -56, -22, 57, 45, 6, 28, 89, 
+	-97, 32, -21, -82, -110, -107, 114, -85, 
+	28, 137, -71, 68, -115, 0, 77, -22, 
+	54, 51, -28, -8, 35, -100, -35, -40, 
+	-51, -164, 57, 74, -30, 53, 36, 135, 
+	20, -14, 15, 40, -39, 24, -89, -51, 
+	-63, 68, -110, 76, -55, -39, -48, -47, 
+	162, -26, 10, -100, 111, -156, -18, 6, 
+	14, 89, -77, -46, -36, 97, 86, -3, 
+	100, 38, 146, 20, 16, -35, 70, 65, 
+	13, 86, 119, 60, -155, -182, -134, 17, 
+	-60, 40, 10, 130, 37, -20, -72, 22, 
+	48, 4, -21, -47, 50, 27, -28, 51, 
+	-141, -30, 64, 47, 37, 6, -29, -34, 
+	-87, 19, 154, 95, 42, 41, -48, -30, 
+	42, -21, -96, -37, -129, -51, 71, 69, 
+	106, 12, -17, 192, -25, -47, -145, 129, 
+	-23, -72, -78, -51, -56, 13, 54, -171, 
+	-72, -19, 9, -89, -72, -187, 57, -62, 
+	50, 103, 62, 90, 132, -68, 106, 18, 
+	26, -13, -31, 39, -7, 28, -71, -31, 
+	-88, 23, 100, 98, 56, 12, -57, -35, 
+	52, 36, 26, 65, 128, 44, 155, -51, 
+	48, 83, 76, 99, -198, 79, 33, 119, 
+	-53, 25, 41, 31, 6, -53, 63, -5, 
+	2, 21, -2, -36, 89, 79, 61, -101, 
+	-14, -88, 159, -20, -20, 136, 147, 68, 
+	-74, 27, -145, -22, -147, 72, 73, 79, 
+	-20, 108, -33, -8, 23, -117, 98, -63, 
+	92, -194, -36, 5, -127, 6, 134, 190, 
+	134, 142, 94, -72, -3, 42, 41, 28, 
+	-33, 22, -50, -61, -99, -22, 47, -4, 
+	24, -27, -71, -114, -20, 20, 36, -30, 
+	65, -90, 68, 58, -26, 123, -142, 13, 
+	47, -114, 89, 3, 48, 67, -3, -15, 
+	7, -30, -79, -15, -80, 132, -2, 12, 
+	-118, 40, -74, -1, -54, -64, 59, -173, 
+	-54, -43, -185, 46, -124, 125, -27, 117, 
+	-72, 27, -13, 11, 49, -53, 89, -28, 
+	-26, 27, -44, 101, 89, 4, 124, 44, 
+	-27, 9, -41, -149, 36, -7, -75, -188, 
+	-3, -43, 140, -11, -226, 82, -118, -88, 
+	16, -56, 113, 49, 49, -17, -54, 37, 
+	-44, -87, -59, -223, 72, 122, -77, 35, 
+	-110, 60, -46, -71, -19, 25, -56, 31, 
+	177, -32, -199, -116, 88, -103, -111, -38, 
+	-83, 76, -96, 3, -75, -50, 95, 24, 
+	-102, 9, 124, -102, -18, 22, 20, -43, 
+	14, 16, -68, -104, 19, 43, 79, -129, 
+	-9, 45, 56, 82, -123, 24, 8, -34, 
+	-112, -58, -99, 52, 61, 26, -48, 75, 
+	-228, 22, -96, -55, 34, -63, 30, -75, 
+	-25, 39, 32, 45, -138, -9, 92, -1, 
+	-191, 96, 120, 33, -53, -37, -26, -4, 
+	42, -174, 87, -95, -161, -53, -79, 79, 
+	-39, -103, 53, 88, 28, 60, -94, -153, 
+	134, -78, -4, 30, 16, -243, -146, 18, 
+	-75, 9, -76, 19, 135, 8, -49, -19, 
+	-137, 46, -249, -7, 91, -28, 54, 14, 
+	-75, -70, -119, -109, 52, 67, 14, -178, 
+	-4, -53, 73, -36, -136, -90, -51, -17, 
+	-58, -137, 13, -70, 64, -280, 45, -46, 
+	12, -141, 52, 60, -77, -125, -74, 0, 
+	-157, -12, -40, -90, 117, 27, -45, 33, 
+	58, -21, 3, 78, -97, -140, -32, -28, 
+	-5, 4, -85, -25, 28, -129, 40, -112, 
+	-290, -44, -268, 46, -50, -151, 44, 13, 
+	-125, -25, 36, -157, -46, 186, 41, -67, 
+	42, -53, -10, -132, -111, -7, -243, 122, 
+	-51, -31, -33, -38, 40, -310, 134, -45, 
+	-91, -67, -40, -73, -46, -312, 23, 40, 
+	-172, 83, -121, -91, 2, -6, -146, -102, 
+	132, -266, 29, 157, -146, -158, -7, 92, 
+	82, 17, -112, -37, 9, -186, 36, -6, 
+	38, -56, 26, -39, 5, -139, 3, 56, 
+	-4, 37, 17, 28, -70, 116, -119, 7, 
+	-63, -11, 11, -33, -15, -48, 29, 90, 
+	42, 148, -34, 47, 31, 92, 128, 34, 
+	-8, -14, 22, -56, -7, -10, 86, 36, 
+	-85, -31, -126, 49, -101, -16, -3, 0, 
+	50, 113, -25, 88, 12, -66, 79, 95, 
+	6, 93, -11, 98, -1, 96, 59, 9, 
+	-47, -75, 58, -88, 10, -19, 35, 108, 
+	-90, 98, -76, -71, -63, 22, 6, 29, 
+	-6, 28, 69, 59, 25, 31, 41, 91, 
+	-36, -47, 11, -11, -49, 37, 80, 107, 
+	-10, -11, 65, -94, 40, 93, -176, -95, 
+	44, -80, 9, 15, 45, -20, 44, -23, 
+	-72, -57, -19, -76, 57, -9, 93, -27, 
+	-61, 9, 88, 50, 26, 58, -20, 122, 
+	120, -173, 84, -81, -30, 73, 202, 167, 
+	-117, 102, 52, -107, -29, -46, 4, -76, 
+	-94, -48, 17, 94, -5, -91, -7, -70, 
+	96, 77, 110, -139, -32, 7, -18, 46, 
+	46, -19, -30, -113, -60, 100, 43, 123, 
+	13, -5, -41, 72, 71, 143, -81, -80, 
+	83, -29, 87, -160, -138, -126, -48, -54, 
+	-64, -67, 69, -23, 1, -29, -60, 41, 
+	14, 23, 66, 75, -25, -20, -84, -10, 
+	11, 20, -21, 9, 86, -83, -52, 76, 
+	132, -135, 26, 102, -30, -31, -81, 104, 
+	17, 67, 4, 80, -44, 85, 90, -12, 
+	-43, -5, 33, -24, -80, -62, -65, -9, 
+	-71, 30, -151, -86, 88, -32, -39, 88, 
+	123, 17, -73, 15, 118, -80, 93, 67, 
+	20, 106, -97, 3, -12, 32, -43, 47, 
+	-49, -73, -197, 52, -98, -75, -132, -47, 
+	-71, -46, -38, -215, 116, -59, -88, -57, 
+	63, -286, -58, 53, -54, -14, -121, -27, 
+	35, 99, 75, 35, 2, -37, -2, -5, 
+	-18, -6, 0, 88, -31, -151, -73, -129, 
+	26, 26, -54, -32, 0, 9, 69, 117, 
+	55, -61, 48, 78, -14, -81, 20, -3, 
+	15, 15, -23, -73, -74, -94, 85, -74, 
+	-100, -55, -95, 41, -27, 70, -20, 8, 
+	-100, 154, -172, -62, 51, 45, -82, -89, 
+	-18, -72, 58, -5, -127, 68, -36, 125, 
+	-66, -44, 70, 6, -42, -90, -7, 28, 
+	64, -97, 93, -2, 9, 20, -119, -60, 
+	67, -12, -199, -102, -70, -49, -104, -44, 
+	-2, -38, -82, 17, 92, -89, 32, -51, 
+	112, -16, -108, 71, 12, -84, 5, -53, 
+	-79, -25, 125, -55, -3, -124, -180, -177, 
+	-108, -34, 47, 52, -24, -94, 1, 94, 
+	76, -83, 1, -93, -14, -75, 15, -23, 
+	-37, -30, -33, -52, -65, -5, -4, -156, 
+	-161, 109, 26, 8, 30, -35, 177, -90, 
+	-12, 36, 149, -109, -116, -17, 45, 57, 
+	-35, -131, 21, 16, 56, -180, -26, 18, 
+	24, -99, 26, 3, -78, 82, -53, -133, 
+	-94, 57, -173, 1, -69, -170, -122, -84, 
+	-32, -158, -121, -70, 105, -38, -44, -23, 
+	-163, -68, -51, -57, -77, 10, -44, -15, 
+	159, -75, -173, 35, 97, -18, 49, -71, 
+	-189, 82, -109, 110, -7, -71, 67, 15, 
+	-8, -109, -75, -29, -94, -135, -10, 55, 
+	14, 2, -32, -21, -78, 110, 133, -60, 
+	-26, 21, -30, 69, -79, 30, -68, 26, 
+	-102, 40, -54, 45, -85, 62, -43, -100, 
+	-25, -22, -15, -52, 52, -87, -78, 100, 
+	48, -64, 48, -43, 45, 110, -24, 25, 
+	-99, -66, -94, -63, 58, -91, 1, -24, 
+	-63, -56, -47, -65, 84, -93, -107, 54, 
+	64, -75, -40, -50, -96, 2, -114, 32, 
+	-62, 59, 27, 38, 96, 36, 52, 110, 
+	-20, 13, -36, 94, -21, -8, 139, -38, 
+	-154, 84, -65, 4, 16, 35, 102, -59, 
+	12, -121, -114, 8, 62, 24, -28, -22, 
+	-72, 52, -51, -68, -75, 29, -120, -49, 
+	-35, 2, 23, -36, 87, -40, 20, 64, 
+	100, -87, 25, -56, -133, -95, -122, -54, 
+	-92, 37, 201, -32, 39, 21, 62, -47, 
+	63, 31, -138, -11, -104, 59, -44, 59, 
+	104, 34, 31, 9, -113, -53, -44, -57, 
+	-77, -102, -103, 37, 29, -5, -76, -13, 
+	35, -128, 59, -89, 43, -9, 23, -29, 
+	72, 26, -32, -29, -54, 62, -114, 71, 
+	-61, 49, -20, -61, -99, -69, -34, -35, 
+	73, -73, 36, -33, -15, 1, -55, -68, 
+	-167, 54, -143, -6, -56, -56, -1, -14, 
+	55, -54, 2, 30, 7, -139, -57, 60, 
+	59, -16, -104, 42, -24, 26, -10, -24, 
+	31, 16, -17, -31, -25, 36, -58, -62, 
+	10, -4, -97, -116, -91, 80, -33, -62, 
+	21, -27, 16, -20, -127, 117, 14, -3, 
+	-115, -57, -42, -23, 5, 44, 51, 5, 
+	-88, -17, 42, -20, 2, 126, -67, 32, 
+	-177, 35, -21, 54, -10, -10, 29, -3, 
+	96, -68, 51, 24, -53, -151, -34, 4, 
+	55, 6, -186, -130, 6, -68, -72, 51, 
+	-138, 92, -29, -12, -23, -43, -121, 30, 
+	-62, -18, 52, 140, 33, -20, 62, 57, 
+	-4, -43, 74, -50, 18, 29, 39, 71, 
+	-48, 45, -21, 47, 51, 52, -27, -61, 
+	-26, -124, 54, -26, -154, 28, 80, 11, 
+	12, 70, 6, -37, 82, 24, -120, -105, 
+	-131, 112, -128, -43, -29, -50, -79, -4, 
+	-12, -100, -53, -46, 49, -8, 71, -62, 
+	-85, 12, -65, 9, 33, -27, -52, 64, 
+	-4, -115, 23, -90, 33, -55, -52, -54, 
+	-30, 92, 65, -102, -2, -7, -54, 97, 
+	-62, -69, -12, 70, 36, 8, 52, -53, 
+	-85, -60, 18, -131, -57, -77, -66, 29, 
+	-173, -35, -85, -5, -122, -33, 104, 68, 
+	-117, 79, 24, 19, -15, -66, -77, 32, 
+	-39, -51, 28, -77, 90, -3, -38, 151, 
+	-10, -76, 27, 28, 38, -84, -103, -74, 
+	121, -78, -4, -9, -41, 12, 7, 33, 
+	55, -47, -56, -93, -36, -60, 158, -78, 
+	78, 33, 9, 38, -61, 2, -60, -1, 
+	-26, -27, 53, -109, 6, -87, 92, 7, 
+	-183, 28, -107, 44, -56, -69, -24, 98, 
+	-10, -87, -56, -81, -35, -87, -110, -25, 
+	28, 21, -24, -39, 1, -63, -34, 81, 
+	-18, 2, 42, -67, -73, 48, 71, 64, 
+	-17, -76, -6, -7, 26, 24, -10, -36, 
+	-52, 17, 25, -8, -14, 40, 33, 64, 
+	-188, -119, 2, -110, 85, 31, 26, 81, 
+	3, 9, -2, -41, -41, -2, -89, -60, 
+	72, 89, -68, -41, 120, -43, -86, 15, 
+	-30, 31, 9, -191, 14, 38, -157, 99, 
+	95, 16, 1, -29, -33, -105, 116, -127, 
+	77, -19, -33, 3, 18, -74, -18, -52, 
+	27, -108, 51, -88, 32, -25, 57, -74, 
+	59, 36, -22, 34, -47, 18, -31, -22, 
+	29, -46, -53, 10, -63, 54, -39, -51, 
+	30, 90, -63, -63, -25, 6, 95, 27, 
+	-155, -8, -5, 14, -210, -52, 121, 65, 
+	45, 63, -51, 60, -46, -36, -95, 23, 
+	-45, -81, 54, 48, -24, -45, -74, 39, 
+	63, -7, -142, -29, 39, 7, -150, -34, 
+	36, -59, -184, 37, -70, 15, -40, 46, 
+	-2, -27, -73, -101, -53, -79, -40, -74, 
+	-83, -45, -39, 7, -52, -50, -81, -60, 
+	-51, -1, 25, -21, -14, -75, -13, 121, 
+	-44, -142, -30, -48, 20, -7, 46, -71, 
+	12, -75, -162, -45, -82, 3, -61, 30, 
+	-12, -119, -42, 73, 34, 44, -35, 0, 
+	-4, -1, 20, 93, 14, 30, -57, -79, 
+	60, -54, -103, -48, 31, -13, -68, 83, 
+	43, -81, 55, -5, -40, 65, -44, -161, 
+	-4, -39, -33, -43, 33, -160, -104, 35, 
+	-64, 88, -84, 35, -21, -103, 28, -4, 
+	68, 12, -103, 3, -45, 19, 29, -20, 
+	169, -205, 20, -21, -32, 40, 54, -12, 
+	-226, 86, 142, -7, -4, -35, -44, -37, 
+	-109, 13, -54, -40, -44, -29, -5, -143, 
+	58, 31, 122, 101, 91, -141, -44, 9, 
+	-6, -72, 29, -51, -4, 116, -21, -15, 
+	-78, -104, -34, 21, 30, -7, -104, -27, 
+	-44, -101, -39, 18, -90, 30, 106, 23, 
+	145, 41, -123, 48, -207, 27, -30, 66, 
+	-42, 93, -27, -49, 19, 104, -163, 47, 
+	-42, -21, 63, 49, -31, -70, 73, -123, 
+	-35, -23, -81, -97, -80, 5, -83, -52, 
+	81, 8, 30, -125, -52, -94, -42, -12, 
+	3, -99, -79, -40, -87, 92, -98, 92, 
+	-86, -123, -51, 18, 67, 39, -54, -140, 
+	-93, 111, -103, 82, 1, -19, 146, 44, 
+	-34, 71, -11, 68, -34, -96, 121, 70, 
+	83, -7, 44, -5, 78, 138, 98, 9, 
+	69, -73, 45, 74, 55, 36, 35, -35, 
+	54, 18, -17, 37, 55, 14, 98, 31, 
+	24, -108, -19, -2, -39, 70, 44, -39, 
+	18, -70, 16, 1, 65, -25, 92, -20, 
+	111, 120, 82, 0, -113, 80, 85, 78, 
+	129, -52, -43, 34, 101, -33, -57, 47, 
+	-187, -92, -135, 35, -140, -22, -123, 24, 
+	29, -145, -82, 64, 9, -32, -36, 28, 
+	-70, 67, 43, 62, 78, 79, -8, -15, 
+	48, -162, 54, 89, 1, 69, 139, 142, 
+	-131, -35, -1, -46, -8, -32, -25, -32, 
+	-39, -64, -81, -28, 73, -80, 114, 73, 
+	43, 12, 58, -120, -114, -34, 60, 114, 
+	140, -80, -36, -131, 35, -106, -17, 78, 
+	-15, -72, 141, 124, 48, 141, -67, -25, 
+	-94, -104, 50, -113, -9, -111, 44, -51, 
+	-63, 36, 51, -20, -68, -38, 86, 15, 
+	140, 6, -90, 75, -122, -51, 100, 74, 
+	-16, -132, 5, 20, -69, -89, 81, -48, 
+	-16, 29, -3, -18, -19, -45, 42, 16, 
+	129, -99, -29, -93, -49, 12, -99, -94, 
+	-139, -99, -36, -144, -8, 13, -46, -55, 
+	-46, -50, 387, -56, 144, -62, 87, -87, 
+	24, -39, -72, -84, -81, -22, -66, -112, 
+	20, -19, 67, 19, -80, -48, -48, -6, 
+	-77, -74, -50, -10, 33, -185, -38, -98, 
+	-114, -68, 93, -2, 96, 49, 83, 34, 
+	34, -57, 109, -15, -6, 61, 21, 87, 
+	126, 128, -44, 161, -43, -32, 11, 56, 
+	90, 69, -118, 23, -32, -166, -109, -32, 
+	-146, -71, -247, 23, -242, -39, -119, 93, 
+	-35, -82, -20, 102, -61, -99, 114, -11, 
+	-11, 167, -118, 5, -109, 60, -23, -123, 
+	-129, 26, 5, -121, 37, -36, -106, -20, 
+	14, 91, -11, 154, 213, -34, -178, -81, 
+	-30, -18, 40, -66, 129, -1, -185, 133, 
+	1, 81, 27, -20, 67, -40, -148, 30, 
+	-12, -34, 68, -112, -201, -24, -236, -86, 
+	-45, -136, -92, 45, -11, 24, -134, 86, 
+	-69, 58, 25, -81, 32, -103, -81, -136, 
+	32, 79, -28, 12, -10, -14, -75, 11, 
+	-43, -9, 41, -152, 11, -208, -102, 97, 
+	43, 114, 64, -97, -78, -111, -74, -158, 
+	-15, 2, 101, 46, 134, -115, -101, 187, 
+	-115, -23, -13, -123, 73, 41, -69, -163, 
+	-205, -68, -40, -41, -26, 14, -81, 81, 
+	-135, 57, -183, -68, 132, 61, -114, -123, 
+	-172, -12, -15, 60, -29, -176, -24, 18, 
+	129, 42, -165, 49, -85, -179, 20, 52, 
+	-77, -38, -11, -2, 45, -132, -15, -14, 
+	80, 54, 150, 30, -87, -73, 90, -33, 
+	-53, 6, 10, -90, 80, -7, 63, -46, 
+	-14, -55, 6, 100, -18, 82, -18, -17, 
+	-70, -23, -1, -18, 46, -19, 121, -20, 
+	-106, 18, 204, 21, 36, 79, -80, -17, 
+	7, -48, -8, 96, -29, -88, 24, 16, 
+	-81, -109, -22, 7, 23, -85, -8, 93, 
+	-40, 126, 139, -9, 44, -80, -59, -51, 
+	0, -166, -48, -10, -34, -12, -18, -9, 
+	16, 123, -15, -3, -30, 1, -117, 68, 
+	121, -117, -68, -110, 92, -94, 88, -85, 
+	-17, 3, -101, 52, 87, -58, 125, -14, 
+	-213, -74, 75, -46, 42, -51, 0, -73, 
+	84, -127, -38, -26, 80, 69, 41, -97, 
+	47, -67, 138, 87, 27, 21, 37, 18, 
+	38, 76, 50, 32, -4, -6, -51, -31, 
+	78, -230, 29, -33, -140, -12, -49, 32, 
+	21, 92, -40, 1, 59, -15, -40, -48, 
+	-72, -123, -41, -91, 59, -128, -62, -69, 
+	-31, -118, -84, 52, 116, -109, 27, -78, 
+	-2, 53, -27, -1, -25, -26, -89, -21, 
+	70, -144, -43, 91, -11, 139, 14, 92, 
+	-39, 32, -7, 19, -126, 17, 50, 32, 
+	-86, 103, -117, -12, -11, -128, -129, -43, 
+	49, -92, 68, -71, -151, -55, -7, -47, 
+	-74, 26, 0, -12, -84, -7, -79, 5, 
+	9, -100, -23, -48, 29, -45, -65, -85, 
+	-104, -7, -149, -30, -179, -71, 124, 31, 
+	-165, 33, 163, -7, 34, 14, -54, -161, 
+	40, -147, -98, 61, -86, -36, 41, -98, 
+	-12, 9, -38, -18, -92, -108, -86, 85, 
+	-8, -32, -161, 23, -37, -42, -32, 3, 
+	-17, -51, -46, 67, -23, -25, -13, -1, 
+	-29, 3, 31, 43, 47, 17, -331, 43, 
+	30, -41, -5, -46, 31, -74, -71, 6, 
+	6, -59, -60, -28, -4, -50, 60, 34, 
+	2, -114, -7, -118, -49, -85, -118, -151, 
+	57, 18, -19, 112, -54, 171, -65, -4, 
+	85, -79, 50, 24, -64, -99, 40, -41, 
+	35, 29, -111, 44, 42, -125, 14, 28, 
+	205, -70, -30, 95, -72, -13, 57, -148, 
+	-40, -119, 23, 26, 28, 15, -108, -33, 
+	-18, -59, -40, 23, -76, -66, -40, 43, 
+	-34, -143, -14, -91, -62, -28, -54, 75, 
+	-58, -38, -82, 133, -41, 17, -57, 66, 
+	-81, 64, 46, 42, 63, 51, 32, 60, 
+	-106, 31, -45, -35, 32, -56, 62, 41, 
+	9, 114, -127, -88, 1, -134, 118, -27, 
+	-64, -151, 42, 10, -144, -38, -30, -105, 
+	-70, 3, -39, 106, 5, -57, -99, -53, 
+	-6, 61, -15, -88, 66, -180, -36, 50, 
+	-85, -135, -7, -76, 33, -184, -66, 45, 
+	-111, 38, -94, -119, 60, -31, -122, -113, 
+	-60, -82, 26, -40, -120, -60, -5, -90, 
+	59, -16, 6, 106, -26, -118, 63, 15, 
+	11, 53, -92, -220, 4, -31, -4, -39, 
+	-76, -62, 80, 41, 69, 0, -17, 34, 
+	-23, -111, -61, -77, 50, 26, -65, 82, 
+	-24, 104, 7, -72, 43, -39, -21, 11, 
+	33, 47, -89, -34, -84, -186, -120, 109, 
+	63, -39, -55, 40, -47, -73, -5, -4, 
+	-225, 17, -24, -137, -101, 144, 0, -3, 
+	11, 51, -55, 114, 9, -109, -95, -80, 
+	-16, -35, 7, -104, 8, -78, -46, 37, 
+	-17, -43, -43, 42, 65, -110, -106, -38, 
+	21, -106, 31, -34, 38, 71, -25, 78, 
+	-9, 50, 11, 41, -51, 155, 124, -61, 
+	-18, 130, -15, -49, -50, 37, -120, 3, 
+	-14, 17, -114, 91, -31, 4, 126, 123, 
+	-109, 82, 19, -83, -33, -131, -3, -149, 
+	10, 31, -6, -48, -73, 2, -23, 75, 
+	88, 98, -40, -21, -6, 79, -120, 5, 
+	-22, -63, -93, -182, 29, 50, 135, 1, 
+	29, -106, -82, -15, -113, -60, 70, -22, 
+	22, 39, 76, -15, 63, 45, -9, -33, 
+	105, 109, 128, 101, 11, 72, -95, 3, 
+	-90, -66, 132, 60, -67, -4, 72, -67, 
+	59, -83, -65, -45, -20, 39, 80, -89, 
+	10, 4, 75, 104, 91, 48, -79, 29, 
+	-34, 58, 86, 72, 94, 26, 0, 47, 
+	18, 25, 94, 118, -5, 52, 55, -20, 
+	-32, -116, 35, 44, -1, -78, 19, -24, 
+	-161, -58, 84, 159, -53, -38, -61, -59, 
+	69, -81, -8, -35, 17, -96, -41, -85, 
+	8, -37, -88, -105, 70, -25, -158, 37, 
+	133, -55, 61, -23, 95, -207, 2, 95, 
+	136, -33, 91, 135, -23, 64, 10, 70, 
+	-41, -66, 76, 71, -92, -45, -121, 1, 
+	173, -96, -23, -65, 135, -38, -26, -38, 
+	74, -139, 96, -104, -30, 3, -123, -12, 
+	-76, -30, -28, 140, 158, 4, 115, -14, 
+	17, 50, -38, 202, -66, -108, 19, 64, 
+	-166, 203, -25, -127, 65, 38, 47, 168, 
+	53, -100, 56, 43, -21, -22, -124, 115, 
+	192, 51, -70, 93, -30, -15, -60, -94, 
+	39, 116, 12, 23, 26, 15, -79, -87, 
+	-26, -82, -69, 13, -109, -86, -19, 17, 
+	-102, -101, -107, -15, 47, 89, 91, -20, 
+	106, -80, -113, 91, 20, -96, -33, -86, 
+	-78, 73, 27, 108, -117, -86, 18, -48, 
+	-149, 111, -98, -152, 146, -58, 38, -94, 
+	12, 1, 25, 92, 51, 133, 60, -31, 
+	-6, 87, 97, 76, -48, 2, -78, 115, 
+	-9, 115, -37, -8, -7, -10, -56, -53, 
+	3, -15, 148, 31, -4, 21, 17, -94, 
+	27, 69, -50, -16, 40, 36, -129, 56, 
+	-29, -44, 33, -111, 98, -185, -44, 28, 
+	44, -71, 15, -32, -7, -82, 41, 46, 
+	80, -30, -135, 15, -23, 31, -112, -96, 
+	-44, -28, 91, 59, -90, -93, 2, -32, 
+	146, -75, -10, -13, -85, -40, 25, -118, 
+	112, -90, 7, -117, -148, 33, -38, -73, 
+	63, -34, 58, 89, 12, -72, -109, -48, 
+	-31, -67, -2, -134, 16, 116, -2, -15, 
+	-87, 16, -57, -68, -5, 47, 33, 7, 
+	-86, -17, -96, 7, 8, -82, -68, -12, 
+	37, -52, -139, 60, -4, -54, 32, 127, 
+	-120, -3, 111, -90, 85, 105, -18, 100, 
+	47, -104, -98, -80, -18, -37, 50, 51, 
+	-57, 37, -24, 29, -118, 23, -88, 32, 
+	-22, -186, 47, 98, -126, -1, -36, -89, 
+	11, -3, 72, 54, -136, -23, -64, 33, 
+	-84, 51, -88, -10, -37, -154, -69, -49, 
+	-72, -122, -60, -70, -39, -156, -13, -78, 
+	-25, 5, -128, 22, 10, 63, -10, -14, 
+	-103, -194, 10, -51, -77, 75, 25, -33, 
+	79, 9, -33, -37, -111, -121, -23, 113, 
+	-52, -16, -13, -207, -80, -22, -125, -94, 
+	159, -102, 166, 71, -50, -79, 7, -53, 
+	33, 163, 6, -78, 42, -37, -35, -34, 
+	18, -136, -98, 20, 1, 96, -5, -123, 
+	-46, 77, -80, -20, 21, -51, 36, -25, 
+	10, 60, 29, 90, -144, -3, -14, 32, 
+	-195, 67, 13, -227, -24, 107, 64, 20, 
+	-43, -75, 68, -16, 8, 10, 58, 5, 
+	-65, -53, 44, -116, 48, -93, -199, -77, 
+	89, 88, -142, -113, 52, -147, -82, -85, 
+	-130, 23, -98, -134, -90, -75, 118, -174, 
+	66, 36, -39, 16, -38, 120, -100, -63, 
+	-11, 42, -79, -39, -73, 39, -102, 6, 
+	112, -95, 149, 22, -205, -233, 83, -84, 
+	-122, 77, -112, -162, -65, 167, -34, -200, 
+	7, -33, 31, -50, 81, -44, -63, 18, 
+	7, -139, 32, -55, 22, 50, 2, 102, 
+	-115, -30, -105, -56, 58, 69, 70, -26, 
+	-136, -94, -79, 48, 54, -53, 150, 119, 
+	155, 30, 118, 69, -101, -11, -28, 13, 
+	-9, 55, -38, -115, -60, -100, -124, -45, 
+	-69, -136, -35, -14, -47, 87, -40, -60, 
+	-92, -26, -31, -114, -19, 74, 144, -215, 
+	-115, 150, 13, 46, 14, 135, -125, -15, 
+	-2, 112, -14, -117, -62, 24, -54, 69, 
+	-131, 24, -11, 91, -50, -109, -129, -36, 
+	-54, -93, -25, 3, 86, 71, -34, 118, 
+	-82, -66, 23, -91, 23, 127, -7, 80, 
+	-70, -85, -39, -107, -16, -91, -202, 48, 
+	67, -81, -135, -46, 118, 46, -125, 63, 
+	-8, 89, -1, -123, -47, 102, -132, 25, 
+	43, -3, -117, -57, -117, -120, -49, 29, 
+	-45, 128, -149, -74, -89, -136, -78, -20, 
+	81, -41, 66, -75, 66, -69, -84, -165, 
+	-82, 39, 65, 8, 116, 96, -160, 46, 
+	25, -13, 35, -62, 46, 83, -16, -37, 
+	-88, 15, -26, -41, -14, -26, -116, -27, 
+	-41, 112, -37, 104, 12, -70, -44, 16, 
+	-71, 213, -20, 52, -118, -111, -178, -111, 
+	-142, -77, -129, 49, -45, -290, 80, 12, 
+	-119, -23, -19, -37, 51, -16, 0, -57, 
+	-139, 30, -12, -65, 11, 90, -73, -60, 
+	126, 4, -76, 49, -54, -27, -57, 82, 
+	45, -43, 91, 62, -83, -11, 44, 139, 
+	82, -188, 10, -148, -49, -60, -72, 90, 
+	-152, 55, -177, 2, 1, 41, -90, -45, 
+	-28, -109, 98, 124, -30, -62, -17, 78, 
+	-128, 96, -157, -98, 38, -32, 173, -19, 
+	22, -157, -138, -14, -78, 31, 80, 33, 
+	-30, 37, 12, -66, 40, 5, -34, -42, 
+	-56, -83, -35, 87, -45, -127, -150, -66, 
+	-49, -9, 19, -59, -133, 51, -93, -55, 
+	-16, -57, 2, -85, 32, -226, 154, 112, 
+	52, 72, -34, -103, -59, 11, -55, -81, 
+	-50, -109, 13, -89, -55, 43, 36, 38, 
+	24, -83, -173, -55, -84, -38, 25, -112, 
+	140, -21, -87, -115, -84, -83, 5, 32, 
+	93, -37, -87, -47, -55, 0, 73, -3, 
+	-73, -102, 45, -3, 82, 111, -128, 10, 
+	-54, -53, -43, 14, 84, -65, -62, -153, 
+	-99, -43, -42, 76, 32, -134, 36, 37, 
+	-7, 58, 81, -22, 31, 49, 95, 83, 
+	-182, 47, 30, -142, -50, 159, 29, -15, 
+	21, -171, -129, -129, -104, -29, 61, 130, 
+	46, -103, 2, -86, -56, 40, 178, 57, 
+	-117, 160, -158, -156, 52, 71, -24, 54, 
+	-31, -177, -64, -31, -72, -112, -101, -47, 
+	78, 18, 73, 44, -126, 145, 88, 117, 
+	-29, -31, 3, 48, 78, 85, 87, 68, 
+	-32, 113, 7, 91, -66, -137, -47, 148, 
+	-42, 17, 30, -158, -23, -27, -61, -94, 
+	-86, 10, 32, 0, -30, 104, -67, -25, 
+	90, -53, -96, -94, -15, -20, 132, 105, 
+	-102, 90, -72, 72, 110, -112, -116, -104, 
+	-136, -149, -40, -10, 21, -137, -191, 54, 
+	-78, -64, 9, -12, -19, -48, 23, 37, 
+	14, -57, -23, -62, -46, 68, -18, -11, 
+	84, -112, -13, -158, -32, 62, 34, -92, 
+	-86, 50, -5, -92, 41, -23, 25, -27, 
+	-10, -15, -19, -105, 13, -31, -95, 13, 
+	6, 33, -103, -52, 118, -64, 54, 11, 
+	-86, 18, 8, 14, -89, 17, 23, -57, 
+	40, -30, 110, 20, 96, 54, -124, 65, 
+	-106, -45, -63, -63, 1, 127, 25, 10, 
+	30, -130, -67, -40, 52, -43, 17, -59, 
+	36, 61, 59, 72, 132, 55, -66, 48, 
+	-183, 35, 6, -99, -60, 19, -144, -7, 
+	-71, -1, 33, -111, -139, -77, 35, -38, 
+	12, 100, 42, 4, 31, 81, 120, 133, 
+	42, 20, -112, -96, 70, -17, 56, -27, 
+	-127, -52, -62, 74, 16, 7, -87, -147, 
+	69, 123, 15, 3, 127, 98, 51, -32, 
+	-42, 116, 3, 165, 22, 175, -43, -121, 
+	-105, -46, 43, 156, -26, 18, -29, 68, 
+	41, 64, -81, 28, 28, -84, 108, 22, 
+	-73, 91, 8, -46, 31, -46, 25, -43, 
+	-63, -104, -117, -74, 109, -91, -57, 27, 
+	-37, 39, 115, -200, 3, -2, 49, -143, 
+	78, -38, 26, 98, -22, -57, -113, 6, 
+	78, -63, 35, 22, -35, -7, -10, -24, 
+	66, -93, -23, 6, -25, -109, -143, -107, 
+	-148, 68, -205, -66, -72, -48, -33, -82, 
+	-61, -5, 72, 79, -29, 27, 33, -19, 
+	-40, -41, 37, 10, 4, -54, 60, -18, 
+	-41, -31, -150, 74, -75, -9, 33, 70, 
+	-155, -73, 55, -150, -158, 127, -51, -89, 
+	24, -150, 41, -43, -15, 68, -107, 11, 
+	1, -98, -25, 7, -53, 4, -7, 4, 
+	29, -134, 102, -103, 158, -50, -6, -40, 
+	-183, -184, -68, -50, 2, 59, -3, -21, 
+	146, -186, 122, 1, -152, -194, 58, -4, 
+	22, 4, 9, -19, 27, 34, 81, -73, 
+	-185, 61, -198, -45, -131, -187, -138, 47, 
+	-62, 189, -104, 67, 130, 111, -54, -71, 
+	2, -2, 74, -74, 26, 38, -182, 120, 
+	-28, 6, 10, 59, 154, -32, -41, 32, 
+	-14, -94, 37, -30, -68, 33, -72, -47, 
+	11, -67, 78, -92, 18, 25, -97, -101, 
+	-146, 61, 30, 116, -56, 72, -29, -17, 
+	109, -106, -69, 33, -2, -8, 61, -31, 
+	-10, -50, -110, -28, -94, -96, 0, 51, 
+	-150, -88, 41, -96, 53, 111, 4, 21, 
+	-73, 23, 79, 23, -35, 27, -171, -15, 
+	-19, 5, -10, 97, -25, -24, 50, 80, 
+	68, -121, -31, 65, 56, 45, -184, 19, 
+	-86, 45, -123, 12, 14, 25, -190, -11, 
+	-90, -33, 35, 22, 0, -39, 81, -50, 
+	41, 48, -148, -62, -107, -46, -27, 52, 
+	-28, 65, -134, -192, -114, -29, -90, -17, 
+	42, 64, 3, -85, 27, 24, -59, 4, 
+	-1, 12, -81, 35, 13, 37, 2, 47, 
+	-106, -101, -97, -32, -86, -132, 18, 11, 
+	16, -93, -33, -233, -57, -19, 39, 43, 
+	-209, 11, -73, -5, -119, 22, -9, 65, 
+	-80, -37, -62, -47, 12, -122, 95, 70, 
+	-17, -53, -95, -101, -54, -181, 12, -1, 
+	-63, -69, 4, -36, -139, 1, 106, 0, 
+	-137, 59, -124, 91, 33, -82, 179, 35, 
+	19, -175, 31, -75, -210, -120, -67, 90, 
+	-48, -68, -57, -26, 87, 110, 46, -43, 
+	11, 19, -64, 52, -150, 87, -205, -92, 
+	114, -27, -69, -54, -100, -100, 60, -8, 
+	-195, 91, 11, -215, 28, 56, -59, 33, 
+	133, -34, -126, -30, -124, -23, -110, 24, 
+	-208, -12, -49, -66, -128, -68, -30, -14, 
+	-129, -39, -19, 79, -75, 35, -20, -79, 
+	-28, -82, 140, -100, -73, 64, -60, 69, 
+	-84, -51, -28, -39, -72, 182, 88, 44, 
+	-37, 78, -24, -159, -105, 135, 118, -33, 
+	-129, 27, -269, 141, -38, -106, 4, 137, 
+	-68, 39, 82, -133, 77, -127, -208, -53, 
+	101, 3, -39, -113, 114, -18, -23, -18, 
+	-66, -119, -57, -149, -93, -35, 27, -44, 
+	81, 16, 33, -163, 141, -25, -14, 16, 
+	18, -53, -61, -2, 101, 92, -40, -67, 
+	9, -56, -13, 81, -116, -231, -67, 68, 
+	62, 81, -159, -34, -31, -177, 74, -79, 
+	-96, 47, -86, -64, -159, -97, 35, -8, 
+	58, -57, 79, -104, -107, -115, 44, -65, 
+	-12, 42, -123, -2, -56, -1, -28, -91, 
+	21, -89, -102, 4, -11, -33, -32, 167, 
+	54, 64, -1, -107, 123, 74, -13, -67, 
+	132, 41, 37, 109, 41, 131, -30, -12, 
+	112, 16, -101, 63, -93, -33, -22, 28, 
+	-24, 34, 38, 31, 77, 46, 2, -30, 
+	-81, -22, 101, 76, 28, -86, -71, 136, 
+	97, 19, 45, 8, 29, -84, 42, -4, 
+	-15, 114, -41, -26, 88, -128, -71, 62, 
+	-90, 38, -47, 43, 52, 9, -52, -99, 
+	-79, 12, -165, -33, 11, -60, -24, 111, 
+	-42, -110, 17, -27, -38, -65, 85, -11, 
+	-14, 15, 52, 53, -17, -11, 25, -118, 
+	10, 19, 55, 103, -45, 47, -24, -35, 
+	-20, -8, 164, 71, -3, -53, 15, -2, 
+	98, 87, -146, -4, 76, -6, 0, 87, 
+	-102, 12, 62, -23, 32, 28, -126, -89, 
+	-108, 34, 9, 39, -52, -143, -41, -23, 
+	47, -25, -22, -72, 36, -44, -40, 11, 
+	33, 33, 80, 131, 83, 140, -29, 96, 
+	-16, 100, -5, 186, 109, -102, -49, -32, 
+	-177, 22, 44, 16, -20, -61, -69, -12, 
+	-47, 116, -73, -136, 70, -101, 3, 80, 
+	-52, 14, -120, 77, -8, -126, 27, 105, 
+	107, 117, -45, 8, -61, 56, -12, 52, 
+	14, -34, 56, -35, 65, -10, -17, 1, 
+	-19, 135, -1, -83, -62, 96, 12, 2, 
+	69, -241, 55, 44, -24, 80, 19, -53, 
+	87, -67, -72, 156, 21, -37, -71, -27, 
+	3, 241, -59, 86, 49, -36, 58, -48, 
+	-97, 32, -230, 14, 64, 8, 33, 67, 
+	107, -179, 51, 46, 74, -63, -63, -52, 
+	-25, -44, 48, 22, 8, -71, -64, 73, 
+	-92, 104, -105, 17, -39, -54, -48, -67, 
+	-30, -131, 52, 7, -160, -22, -43, -53, 
+	-88, -72, 31, 95, -65, 100, 49, -43, 
+	10, -6, -124, -119, 82, -109, 2, -31, 
+	-56, -7, -91, -45, -181, -189, -150, -59, 
+	-5, -125, -262, -193, 26, 48, 7, -43, 
+	10, -150, 26, 81, -60, 19, 90, 83, 
+	56, 19, -22, 14, -59, -28, 34, 78, 
+	-144, 53, -141, -81, -1, 52, -78, -97, 
+	-119, -102, -27, -60, -95, 9, 120, 6, 
+	-52, 91, 30, -28, 35, 111, -75, 11, 
+	62, -89, 48, -160, 65, 24, 70, 39, 
+	79, -26, -75, -5, 11, -109, 65, 58, 
+	44, -45, -154, 113, -119, 31, -135, -56, 
+	-61, -35, 105, -74, -64, 30, 49, 123, 
+	-1, 51, -42, 19, -59, -144, 126, -90, 
+	-32, 112, -114, 103, -35, -118, -56, -42, 
+	83, 55, -103, -25, 20, -84, -102, -76, 
+	5, 7, 62, -60, -50, 29, -46, 11, 
+	64, 35, 46, -31, -35, 59, -12, -21, 
+	26, -76, 10, 111, -1, -30, 73, 35, 
+	-138, -22, 131, 10, 24, -107, -6, -68, 
+	-4, -86, -41, 75, -95, 35, -77, 101, 
+	0, 37, 36, 8, -41, 71, -85, 140, 
+	-86, -37, -176, -101, 61, -40, 56, 49, 
+	-1, -14, 119, 52, -111, 80, 50, -67, 
+	5, -78, 35, 54, 86, 117, -129, -40, 
+	-72, -1, 20, 32, -1, -104, 21, 152, 
+	52, -103, 19, 4, 91, -27, -35, -60, 
+	-70, 89, -222, 102, 34, 60, -8, -59, 
+	-142, -197, 76, -78, -117, 110, -65, 60, 
+	47, 82, -175, -8, -37, -111, 185, 79, 
+	92, -137, -69, -212, -86, -44, 100, 56, 
+	36, -113, -57, -92, 18, 91, 12, 10, 
+	6, 32, -96, -120, 30, -113, 71, -75, 
+	35, -104, 90, -30, 4, 27, 90, 98, 
+	19, -8, 46, -48, 122, 53, -36, 32, 
+	24, 6, 40, 133, -108, -15, -32, -73, 
+	-307, 24, 9, -170, -37, 21, -68, -3, 
+	-60, -14, -67, -212, 2, 22, 69, -21, 
+	-26, -56, 4, -222, 59, -33, -60, 70, 
+	13, 96, 135, -101, 75, -30, -46, -43, 
+	-30, -19, 89, -146, 89, 84, -94, 71, 
+	109, 40, -80, -67, 5, 27, -44, -66, 
+	-73, 35, 2, 94, 1, -39, 35, 50, 
+	44, -56, -137, 98, 64, 29, 55, 114, 
+	-131, 161, 46, -64, -47, -106, -72, -61, 
+	95, 104, -67, -22, -119, -35, 105, 151, 
+	7, 122, -71, -43, 25, -213, -133, 102, 
+	-82, 0, -70, -45, -148, 62, 19, -108, 
+	31, -36, 47, 127, 65, 16, -134, 21, 
+	101, 24, -51, 10, 49, -6, 15, -53, 
+	-209, 31, 117, -90, 11, -59, -122, -28, 
+	-171, 62, -221, -143, 150, -28, -170, -23, 
+	-44, -31, 34, 99, -24, 24, 133, -25, 
+	128, 38, 13, 113, 28, -120, 135, 94, 
+	89, 34, -99, -4, -19, -110, -117, -60, 
+	41, -162, 92, -131, 56, 59, 62, -99, 
+	94, -148, -7, 28, 46, -14, -139, -45, 
+	-27, -53, 92, -50, -81, -118, 45, -25, 
+	36, -39, 57, 80, -36, -40, 17, 13, 
+	-329, 45, -43, 85, -58, 69, 1, -96, 
+	-7, -118, 95, 91, -65, -85, 41, 9, 
+	80, 41, -114, 0, 72, 54, 159, -49, 
+	-80, -105, -205, -105, -12, -219, 54, 36, 
+	82, -131, 45, 56, 99, 30, -36, -18, 
+	-122, -224, -8, -41, -39, 83, -108, 109, 
+	101, -36, -123, -154, 28, -66, -17, 91, 
+	-9, 78, -71, 92, -92, -142, -91, 6, 
+	54, -57, 43, 5, 103, 36, 92, -18, 
+	-160, 148, 21, -181, -106, 59, 0, -132, 
+	-45, -19, -82, -59, 9, -183, -35, 9, 
+	12, 72, -228, -99, 5, -160, -118, 20, 
+	30, -68, 22, -104, -45, 107, 101, -68, 
+	48, -37, -33, -105, 116, -57, -198, 22, 
+	51, -25, -36, -48, 63, -77, 37, 55, 
+	91, -67, -27, -80, 41, -17, -56, -35, 
+	110, -6, -211, 43, -139, -27, -154, -117, 
+	-108, -36, 26, 36, 59, 93, 26, 1, 
+	126, -26, -24, 84, -108, -199, -10, 26, 
+	90, -87, -145, -88, -79, 67, -53, -47, 
+	26, -97, 16, -53, 48, 81, -104, -117, 
+	-10, -74, 67, -112, -74, -68, -44, 16, 
+	115, -49, -103, -82, -16, 24, 19, 73, 
+	41, 4, -55, -64, 6, -52, -52, -12, 
+	4, -66, 27, -18, -111, 104, 66, -36, 
+	-104, -74, 4, -82, 50, 38, 69, 7, 
+	-53, -56, -157, -42, 43, -16, 44, 42, 
+	101, -64, 9, -58, -52, 59, 193, 81, 
+	-2, 99, 80, 4, -8, 22, 31, 16, 
+	76, -421, 25, 86, -99, 68, -126, 143, 
+	15, -55, 98, -38, 93, -73, 32, 77, 
+	26, 61, 72, 43, 22, -56, -43, 49, 
+	-60, 31, -132, 43, 63, -66, -44, 32, 
+	-144, -18, 56, -227, 11, -6, -193, -134, 
+	-29, 8, -114, -68, 106, -14, -26, -46, 
+	-4, 20, 39, -81, -73, -61, -5, 63, 
+	37, -19, -1, -2, -21, 86, 80, -66, 
+	44, -190, 7, -78, 9, -30, -2, 17, 
+	-146, 50, -43, 87, 33, 56, 164, -15, 
+	-20, 3, 5, -23, -9, 35, -60, -16, 
+	56, 37, -283, 20, -13, 92, 97, -69, 
+	-183, 61, 14, -108, -13, 0, -165, -89, 
+	-68, -137, -93, 95, 5, -20, -79, -30, 
+	75, -3, 136, -11, -40, -72, 93, 74, 
+	-118, -73, -103, -82, 60, 33, 167, -39, 
+	64, -76, 19, 74, -102, -22, 79, 33, 
+	-19, 136, -51, 102, 21, 52, -54, -20, 
+	83, 54, 21, 12, -81, 35, -84, 61, 
+	13, 63, -109, -33, -157, -52, 33, 79, 
+	-8, -40, -43, -197, 53, -22, -43, -138, 
+	-6, 14, -140, -117, 109, -27, -97, -102, 
+	-5, 72, 73, 19, 134, 5, -58, -29, 
+	-11, -74, -37, -90, 105, -13, -99, -54, 
+	-44, 101, -12, -72, -18, -24, -104, -31, 
+	116, -23, -100, 20, -90, -70, 4, 4, 
+	20, -107, -22, -78, 39, -77, -81, -56, 
+	1, -236, 10, 43, -30, -27, -53, -124, 
+	-4, 18, 12, 177, -13, -32, 74, 8, 
+	-175, 58, 17, 44, 8, -75, -35, -82, 
+	58, -109, -36, 139, -17, 53, 74, 2, 
+	-28, -79, -54, -2, -107, -73, 24, -34, 
+	-53, -90, -36, 42, -18, -32, 52, -53, 
+	-112, -12, -5, -140, -75, 103, 29, 89, 
+	87, -183, 3, -124, -7, 69, -109, -24, 
+	-114, 43, -75, 61, 121, 2, -70, -59, 
+	32, -81, -4, 7, 80, -32, -89, -96, 
+	-32, -55, 63, -42, 101, 32, -68, -56, 
+	-65, -71, 4, 83, 42, 66, 3, -75, 
+	48, -165, 42, -121, -62, -48, 71, -70, 
+	102, -108, -53, 25, -127, -40, 66, -133, 
+	52, 75, 20, 21, -66, 18, -55, 55, 
+	91, 58, 71, -59, -180, 82, -83, 17, 
+	-247, 70, 112, -54, 74, 61, -114, -11, 
+	61, -93, -95, 97, 66, -212, 87, 51, 
+	-18, -43, 73, 7, 27, -123, 9, 42, 
+	-16, 34, -102, 48, 24, -129, -119, -11, 
+	-183, -126, 36, -44, 58, -131, -153, -44, 
+	76, -40, -26, -22, 71, 89, -74, 31, 
+	-83, 17, -144, -34, 4, -26, 8, -36, 
+	-83, 110, 4, 62, -6, 48, -62, 19, 
+	-78, -6, -88, -65, 90, -5, 58, 68, 
+	-87, 75, -90, 105, -98, -30, 9, -60, 
+	21, 79, -139, -40, -95, -86, -73, -26, 
+	-62, -61, 6, -156, -78, -52, -50, 68, 
+	30, 26, -63, 5, 37, -71, -122, 21, 
+	22, -76, -46, 0, -14, 15, 30, -20, 
+	-97, 11, 96, 37, 1, -71, 50, 52, 
+	-53, 156, 148, 80, -104, -41, -116, -86, 
+	-136, 16, -133, 1, -46, 42, 42, -3, 
+	-65, -93, -31, 33, -38, -9, -93, -63, 
+	-3, 24, -63, -2, 33, -159, 90, -126, 
+	-40, 106, 140, -107, -61, -61, -40, -81, 
+	-108, 42, -83, 110, -53, 119, 1, 56, 
+	-65, -21, -1, 52, -35, 35, 33, 50, 
+	-13, 51, 20, 13, 40, -88, -80, -89, 
+	-85, 25, 17, 93, 98, 21, -103, -57, 
+	-163, -48, -187, 46, -83, -72, -80, -18, 
+	-33, -95, -2, -57, 84, -167, 24, 71, 
+	55, -81, -64, -152, -43, 104, -70, -32, 
+	-158, 86, 48, -141, 35, -100, -78, -1, 
+	-79, -119, 38, 48, 76, -87, -51, 44, 
+	-22, -90, -53, -132, -55, 2, -2, 74, 
+	0, 110, -126, -16, 14, 3, 15, -109, 
+	-219, 68, -133, 76, -87, -85, 43, -53, 
+	0, 57, 108, -113, -61, -96, 128, 104, 
+	78, -98, 35, 6, 112, -91, 120, 17, 
+	-15, -74, 6, -39, -132, -27, -64, 91, 
+	40, -20, -72, -77, -8, -124, -242, -31, 
+	86, -55, -69, -65, 5, -103, -37, 26, 
+	-149, -107, -30, -146, -106, -62, -117, 60, 
+	-72, -115, -22, -102, -81, -57, 24, -80, 
+	-30, 151, -20, 127, -109, -46, 36, -23, 
+	26, -59, -81, -24, -42, -80, 51, 100, 
+	-82, -86, 94, 24, -38, 56, 19, -81, 
+	-85, -43, -55, 13, -78, -69, -53, 17, 
+	-51, 55, -118, -11, -36, 66, -17, -42, 
+	-37, -29, -54, 71, -36, 51, 52, -26, 
+	38, 28, 25, 16, -32, -26, -69, 32, 
+	-124, 1, 14, -51, 96, 48, -7, 46, 
+	-1, -42, 19, -10, -215, -2, -79, 41, 
+	14, -82, -165, 43, -4, 75, 33, -97, 
+	69, 31, -86, 104, 18, -36, -64, 82, 
+	69, 25, -55, -52, 2, -160, 1, -92, 
+	53, 72, 58, 10, -40, -65, 76, 39, 
+	5, -161, 1, 70, -4, 16, -35, 39, 
+	116, -190, 16, 54, -4, -31, 116, -100, 
+	-2, -165, -7, -51, -69, -82, -17, 45, 
+	-34, -91, 10, -74, 96, 74, 48, 32, 
+	71, -43, 110, 46, -80, 16, 25, -67, 
+	-130, 9, 20, 50, -53, -58, -108, 2, 
+	-67, -15, -33, 5, 52, -16, 94, -119, 
+	81, -24, -4, 44, 49, 89, 111, -94, 
+	29, -69, 25, 140, -58, -3, 83, 122, 
+	-14, -58, -22, -50, -78, -90, 112, -173, 
+	-96, 80, -37, -14, -100, -61, -81, 51, 
+	-81, -63, -54, 46, 125, 36, 116, -13, 
+	20, 89, 142, 155, -75, 40, -19, -69, 
+	-46, 27, -23, -3, 76, 123, -32, 57, 
+	-75, -89, 44, 18, -13, 180, 101, -20, 
+	52, -89, -13, -2, -44, -5, 47, -42, 
+	93, 11, 28, -109, 147, -48, -108, 72, 
+	-20, 80, -42, -119, -49, -10, 61, -60, 
+	27, -47, -75, 15, 12, -76, 21, -94, 
+	-75, 28, -27, 63, 17, -19, 138, 10, 
+	74, -44, 227, 44, -137, -138, 81, 165, 
+	50, -48, 111, -54, 0, -12, 128, -85, 
+	-1, 79, 58, 36, -8, 112, 46, -70, 
+	48, -209, 109, -33, 66, -19, 145, 40, 
+	-63, 1, -33, -59, 68, 109, 94, -88, 
+	-101, -226, -68, 41, -16, -101, 110, 29, 
+	-67, 53, -25, 11, -190, 92, -46, 101, 
+	45, -25, -141, -91, 14, -97, -105, 82, 
+	206, -57, -218, -16, -42, 12, 23, 38, 
+	-118, -100, -73, -212, -80, 1, -95, -112, 
+	-44, 71, -158, -10, -39, -11, -126, 15, 
+	52, 92, 82, -10, 69, -55, 40, 71, 
+	-91, 52, -129, -55, 3, 37, -164, -135, 
+	-43, -85, -10, 38, 24, -45, 56, -43, 
+	8, 126, -27, -156, 128, 209, -121, -55, 
+	-31, -88, -67, -46, -56, 24, -243, 39, 
+	-5, -62, 94, -19, 72, 53, -35, -28, 
+	43, 131, -129, -88, -164, -93, -8, -16, 
+	-99, 39, -14, 137, -12, -69, -143, 0, 
+	32, -12, 95, 71, 8, 13, 73, 5, 
+	-132, -60, -28, -54, -153, -91, -166, -67, 
+	-76, 111, -36, -12, -19, -136, -68, -54, 
+	29, -86, -38, -79, 31, -137, -88, -65, 
+	-95, -188, -34, -8, 68, -68, -21, -78, 
+	-40, 0, 67, -19, 9, -52, -44, -171, 
+	76, -131, -60, -39, -77, -82, 24, -49, 
+	-69, -23, 69, 61, -27, -98, -74, -28, 
+	-108, -21, -249, -88, 52, -179, -1, -13, 
+	-7, 92, 112, -125, -85, 28, 67, 23, 
+	53, -122, 81, 104, 158, 113, -27, 69, 
+	-55, -62, 30, 93, -62, -194, 3, 37, 
+	-21, 90, -24, -111, -49, -85, 37, -81, 
+	-118, 88, -22, 12, -53, -82, 56, -39, 
+	-94, -48, 27, -65, -88, -90, -25, 69, 
+	69, 111, -1, 80, -22, -9, 4, 92, 
+	-5, 113, -77, -53, -69, -56, -114, 10, 
+	8, -85, 46, -2, 69, 83, -50, 58, 
+	15, -165, 66, -41, -10, -47, -3, 38, 
+	-21, 157, 19, -83, 27, -187, -22, -40, 
+	-22, 61, 90, -25, -20, -180, -32, -61, 
+	161, 107, -78, -46, 48, 5, 74, 43, 
+	40, -80, 67, 121, -58, 95, 84, 69, 
+	9, -36, -65, 43, -95, -20, -28, 44, 
+	-160, 46, -83, -68, 86, -51, -83, -18, 
+	-70, 87, 64, 23, 0, 47, -116, -49, 
+	1, -117, 52, -117, 75, -7, -139, 78, 
+	-51, 110, -76, -74, 53, -125, -11, -125, 
+	-38, -107, -39, -96, -155, -142, 14, 43, 
+	-153, 7, -232, -5, 24, 31, -60, -1, 
+	2, 63, 2, 63, -135, -9, 22, -24, 
+	25, -19, -95, 18, -84, -37, -92, 42, 
+	
+};
+
+const static dl_matrix3dq_t conv2d_2_kernel_q = {
+	.w = 3,
+	.h = 3,
+	.c = 64,
+	.n = 64,
+	.stride = 192,
+	.exponent = -10,
+	.item = (qtp_t *)(&conv2d_2_kernel_q_item_array[0])
+};
+
+const static qtp_t conv2d_2_bias_q_item_array[] = {
+	-13891, -10676, -9146, 2463, -9172, -15977, 1021, -6311, 
+	-13491, 1091, 4575, -4105, -7741, 674, -11217, -3950, 
+	465, -3127, -7680, -3111, -2280, -11965, -10302, -16415, 
+	-1809, -13595, -8221, -7172, -13664, 6620, 2295, 945, 
+	3655, -6277, -9293, -8664, -10278, -13470, -5873, 3206, 
+	-12753, -43, -19036, -10678, -8552, -9841, -1128, 4170, 
+	1532, -9640, 25769, -5156, -9535, -9707, -6634, -17585, 
+	-10331, -11603, 3365, 5124, -5146, 9, -11501, -10905, 
+	
+};
+
+const static dl_matrix3dq_t conv2d_2_bias_q = {
+	.w = 1,
+	.h = 1,
+	.c = 64,
+	.n = 1,
+	.stride = 64,
+	.exponent = -18,
+	.item = (qtp_t *)(&conv2d_2_bias_q_item_array[0])
+};
+
+const static qtp_t dense_kernel_q_item_array[] = {
+	30, 53, -71, -15, -127, 32, 29, -54, 
+	78, -89, -70, 79, 71, 25, 80, -62, 
+	-25, 1, 127, 1, 0, 39, -21, -169, 
+	-10, 21, -75, 36, 84, 97, -74, -54, 
+	-3, 104, 73, -100, -99, 73, -11, 145, 
+	42, -8, -81, -47, 16, 39, 44, 63, 
+	-14, 53, -25, -55, 114, 43, 62, 51, 
+	3, 32, 77, -85, 44, 26, 21, 32, 
+	-6, 122, 42, -32, 77, 10, 19, 69, 
+	0, 87, 22, -44, 9, 29, 56, 74, 
+	89, 87, 1, -84, 120, 91, 93, -19, 
+	-74, -19, 122, -29, 153, -62, 20, -75, 
+	-85, 51, 24, -29, -49, -88, 75, 67, 
+	-114, 150, -41, -50, -111, 58, 49, 63, 
+	-52, -52, -98, 124, 91, 85, -101, 128, 
+	81, 9, 29, 13, 71, 3, -24, 80, 
+	7, -34, 110, 49, 177, 112, 83, -58, 
+	-58, -64, 19, -78, -3, -81, 42, 138, 
+	-48, -191, -87, 72, -198, -87, 110, -1, 
+	-112, 80, -112, 65, 147, 73, -22, -162, 
+	-4, -94, -25, 23, -1, -40, -60, -115, 
+	-66, -64, 87, -57, -6, -83, -229, -132, 
+	43, -164, 386, 42, -60, -17, -33, -103, 
+	-9, 49, -76, -47, 67, -13, 15, 26, 
+	78, -133, 69, 15, -19, 82, 63, -82, 
+	113, -47, 32, -131, 68, 104, 13, -156, 
+	-48, 25, -33, 31, 1, 141, 26, -74, 
+	12, -41, -116, 44, 90, -45, -14, 53, 
+	56, 78, 37, -45, 46, 148, 53, 77, 
+	100, 84, 183, -60, -51, 43, -78, 67, 
+	18, -11, -5, -104, 0, 37, -96, -29, 
+	80, 69, 6, -88, 73, 57, 84, -57, 
+	106, -13, 166, 38, 61, 13, 56, -86, 
+	189, -6, 3, -127, -36, 16, 53, 79, 
+	115, -42, 3, -50, 12, -68, 107, 121, 
+	30, -26, 126, -42, 147, 70, 151, -136, 
+	-37, -55, 15, -3, 19, 136, 161, -106, 
+	-28, 59, 151, 6, -113, -76, -7, 44, 
+	8, 50, -74, 25, -100, 26, 72, -151, 
+	44, 28, 52, 104, 75, 45, -8, -118, 
+	-123, 36, -82, -69, -92, 1, -168, -25, 
+	56, 199, 97, -27, -149, -52, -138, 60, 
+	-11, 121, 18, 144, 69, -28, -18, -233, 
+	88, -83, -11, 0, 64, -8, 17, 83, 
+	28, -181, -51, -61, 212, -119, -118, -142, 
+	63, -133, 117, -21, 143, 164, -4, 80, 
+	-40, 22, 153, 10, 45, 94, -72, -120, 
+	-40, -102, 35, 124, 130, -13, 27, -15, 
+	65, -28, -126, -71, -18, 15, 91, -68, 
+	83, -129, -10, 123, 20, 2, 101, -61, 
+	-111, 80, -38, 38, 9, 14, 62, 14, 
+	-69, 50, -35, 48, -39, -39, -85, 108, 
+	11, -54, -54, -30, 148, 70, -110, 22, 
+	62, -21, 64, 87, 23, -52, 106, 23, 
+	-99, 84, 149, -21, -11, 5, -12, -54, 
+	-3, -61, -114, -71, -14, -75, 72, -29, 
+	64, -102, 0, -58, -143, 115, -98, -3, 
+	90, -103, -12, 11, -1, -38, 54, 58, 
+	-23, 77, 69, -60, -11, -61, 136, 140, 
+	64, 119, -134, 30, 33, 43, 29, 162, 
+	11, 77, -157, 170, 154, -18, -43, -11, 
+	-81, 71, 121, 71, 51, 125, 17, -11, 
+	85, 43, 7, -49, 29, -109, 95, 1, 
+	-70, 36, 44, 39, -15, -81, 23, -122, 
+	-148, 62, -49, -177, -194, -26, -29, 65, 
+	-199, 131, 25, 24, 61, 109, 128, -151, 
+	-53, 262, -20, 11, -1, -23, -25, -141, 
+	65, 154, -87, 237, -186, 85, 50, -36, 
+	-61, 146, 24, 29, 45, -72, -168, -12, 
+	139, 119, -158, 166, -31, 99, 35, -22, 
+	-29, -33, -10, -12, 63, 21, 100, -63, 
+	-154, -87, -53, 141, -47, 23, -29, -209, 
+	-49, -108, -63, -31, -108, 6, 48, 102, 
+	30, -33, 47, 40, -124, -41, 121, 71, 
+	135, 30, 23, -214, -110, -72, -3, -63, 
+	-5, -31, 51, -159, -56, -42, 17, -45, 
+	41, 45, 63, -17, -38, -225, 67, 1, 
+	-132, 50, 3, -74, -116, -78, -81, -46, 
+	-10, -79, 62, -32, 84, -69, 29, -11, 
+	66, 46, 27, -124, -78, -101, -105, -43, 
+	89, -159, -32, 73, 28, 39, -28, -59, 
+	-21, -5, -47, 57, -63, 108, -96, 3, 
+	43, 11, -51, 46, 36, -43, 126, -22, 
+	88, -118, 27, -68, -110, 139, -52, -39, 
+	96, -210, -79, 7, 32, 42, -8, 14, 
+	-26, -57, 30, 5, -17, -93, 0, -80, 
+	24, -19, 77, -61, -118, 64, 56, -94, 
+	46, 23, -13, 19, 26, 98, 58, 83, 
+	-58, 49, 16, -58, 35, 85, -16, 57, 
+	-47, 23, 4, -178, -68, 119, 15, 25, 
+	-92, 51, -77, -41, -15, 92, 35, 70, 
+	44, -64, 34, 38, 9, 205, -43, -79, 
+	-74, 149, 40, -43, 112, 69, -112, 27, 
+	-17, 36, -35, 0, -4, -50, 108, 97, 
+	116, -8, 3, 1, -60, -78, -10, -59, 
+	64, 87, 43, 30, -35, 44, 56, -7, 
+	99, 59, -19, 35, -37, -142, -32, 116, 
+	-171, 201, 23, 66, -141, 140, 65, 106, 
+	83, -190, -7, -211, -6, -5, 28, -137, 
+	144, -173, 83, -60, -58, 6, 213, -3, 
+	30, -51, 34, -205, -51, 35, -13, -47, 
+	-139, 118, -249, 18, -41, 31, 29, -132, 
+	-41, 27, -39, -166, -130, -34, -81, 112, 
+	48, 188, -33, 148, 147, 102, -16, -117, 
+	-63, 168, -31, -11, 23, 66, 143, -49, 
+	-12, 72, 192, 162, -90, -42, -192, -45, 
+	22, -50, 41, 94, -82, -60, 93, -275, 
+	72, -23, 11, 6, -107, 131, 2, 92, 
+	-87, -31, 57, -24, -194, -89, 103, -44, 
+	-22, -182, 7, 62, 80, 67, 106, -40, 
+	104, -60, -2, 17, -118, 51, -71, 34, 
+	109, 95, -48, 69, 48, 71, 84, 55, 
+	34, -57, -66, -91, 158, 65, 142, 23, 
+	-41, -138, -48, -48, -75, 89, -90, -62, 
+	104, -178, -41, -104, -61, -4, -15, 10, 
+	23, 15, -2, -51, -147, -45, 17, -91, 
+	-35, 121, -23, -15, 9, 34, 13, 100, 
+	38, 42, -39, 66, 90, -123, -132, -91, 
+	-8, -10, -86, -144, 132, 4, 106, 4, 
+	150, 62, -138, 123, 124, -7, -84, 75, 
+	5, 30, 46, -9, 50, 82, -111, -42, 
+	-25, -9, -148, -54, 6, -199, -39, 53, 
+	-30, 56, -12, 68, 94, 58, -1, 5, 
+	-6, 96, -64, 12, 2, 9, 119, -55, 
+	39, -183, -73, 173, -55, 164, 35, 80, 
+	67, 70, 62, 97, -69, 85, 127, 23, 
+	-43, -110, 14, 114, 90, -32, 11, -53, 
+	-77, -112, -19, -1, -89, 32, -44, 16, 
+	-28, 184, -144, -68, -77, -61, 11, 12, 
+	125, 80, -117, -18, 16, -180, 109, -94, 
+	-202, 96, 61, -9, 92, -124, -102, 86, 
+	-210, 118, 63, 105, -102, 18, 51, 94, 
+	-3, 98, -83, 129, -10, 25, 53, -159, 
+	3, -182, -50, 63, -95, 42, -62, 35, 
+	-1, 24, 1, -65, -4, -31, -67, -12, 
+	-164, -120, 106, -113, -146, -61, -22, 72, 
+	78, -204, 96, 101, 114, 11, -52, -95, 
+	44, -6, -19, -76, 81, -63, -63, 55, 
+	33, 79, -34, 103, -35, 67, 14, -66, 
+	68, 2, -44, -71, 151, -129, -56, 48, 
+	12, 22, -75, 107, 146, 17, -116, -14, 
+	-9, -26, 52, -19, -54, -40, -101, 56, 
+	33, -32, -180, 26, 41, -3, 125, -145, 
+	40, -8, -20, 101, -33, 159, 20, -77, 
+	-82, 9, 53, 34, 65, -106, -105, -4, 
+	-116, -47, -66, 45, 6, -51, 0, -54, 
+	-15, -54, -115, -83, -95, -31, 28, -72, 
+	-51, -58, 14, -66, -76, 6, -42, -56, 
+	0, 16, -97, -65, 64, -15, -54, -77, 
+	-87, 73, -142, 27, 0, -22, -42, -41, 
+	-45, -77, -64, 21, -37, 44, 6, -37, 
+	-94, -12, 36, -75, -87, -2, -129, 42, 
+	69, 68, -65, 21, -11, 19, -57, 28, 
+	28, -140, 31, -38, -25, 50, -87, 51, 
+	-53, 22, -6, -14, -99, -58, -58, -95, 
+	85, -41, -15, -26, -49, 5, -24, 63, 
+	-102, -63, -71, -112, 48, 25, 44, -107, 
+	-74, -26, 4, -96, -32, -105, -7, 9, 
+	-67, -97, -12, 8, -128, 68, -77, -106, 
+	-69, 25, 65, 68, 74, -5, -66, -27, 
+	49, 24, 106, 25, -73, 50, -27, 43, 
+	10, 8, 31, 44, -15, -42, -126, -26, 
+	36, 47, 62, 46, 52, -58, 70, 49, 
+	42, 18, 41, -30, -36, 11, -49, 23, 
+	-41, -5, 1, -116, 101, 49, -60, 5, 
+	15, -40, 31, 6, -51, -20, 43, 85, 
+	55, -68, 63, 41, -83, -34, 65, -142, 
+	-73, 12, -123, -31, 4, -8, 39, -51, 
+	1, -41, 62, -89, 21, -84, 31, 49, 
+	10, 39, 41, -30, -64, -125, -21, 80, 
+	-48, -10, 47, 76, 27, -92, 43, -97, 
+	40, -45, 43, 2, -9, -31, 0, 2, 
+	15, -52, 40, -97, -10, 11, -53, -87, 
+	-41, -76, 25, -71, -117, -34, 46, -10, 
+	-53, 53, -24, -70, -71, -95, 21, -91, 
+	18, -2, -48, 43, -24, 15, -24, 33, 
+	-27, -120, 47, 75, 8, -79, -50, 45, 
+	82, -47, -39, 31, -134, -64, 19, 74, 
+	-47, -26, -83, -1, -13, -30, -95, 42, 
+	33, -33, -127, 19, -94, 26, 50, 89, 
+	-73, -53, -75, 91, 1, 19, -33, -40, 
+	14, 75, 104, -77, 36, -122, -122, 24, 
+	58, -94, 91, -50, -29, -77, 9, 98, 
+	-98, 47, -115, -121, 108, -27, -36, -83, 
+	14, 58, 13, -9, -32, -19, -1, -62, 
+	-33, -1, -46, -39, -126, 2, 68, 83, 
+	-21, 108, -64, 55, -131, 29, 56, -65, 
+	-68, -71, 63, 37, -62, -32, 19, -15, 
+	-53, -57, -83, -113, 32, -31, 14, -31, 
+	-11, -25, 40, -78, 16, 18, -15, 44, 
+	65, -83, 46, 7, -83, -115, -79, -43, 
+	15, -67, 27, -85, -61, -54, 96, 26, 
+	4, 37, -58, -44, -56, -21, -87, -126, 
+	-37, -96, 33, -131, -114, -4, -88, -60, 
+	67, -14, 19, 17, -62, 32, -29, -69, 
+	55, -123, 6, 8, 24, 85, -11, -31, 
+	-7, -18, -42, -99, 3, 0, 32, -96, 
+	-61, -83, 12, -22, 60, 21, -66, 92, 
+	-44, -48, 40, -90, 81, 18, -29, -73, 
+	59, -16, -49, -84, 0, -5, 8, 52, 
+	8, 86, 81, -53, 62, 58, -103, -61, 
+	-63, -84, 96, -40, 48, -15, -51, -43, 
+	68, -120, 90, 40, 27, -114, -11, -107, 
+	-53, 14, 43, 36, -30, -76, 48, 50, 
+	-79, 42, 64, -11, 44, -19, -123, -26, 
+	81, 17, 13, -36, 11, -124, -75, 25, 
+	-11, -96, -52, -40, 6, -27, 49, 60, 
+	-52, 32, 25, 24, -38, 10, -46, -45, 
+	27, -43, 22, -31, -136, -74, 20, 7, 
+	-83, 46, 55, -86, -37, 40, -27, -23, 
+	-71, -76, 30, -81, 37, 50, -24, 12, 
+	-17, -29, -124, -68, -80, -40, -14, -59, 
+	-13, -51, -12, -39, 91, -114, -89, 5, 
+	25, -80, -89, 2, 49, -11, 20, -65, 
+	-44, 87, 78, -41, 6, -79, 58, 43, 
+	-9, -77, 30, -103, -77, -58, -118, -112, 
+	-38, 120, -78, 38, -66, 92, -96, -98, 
+	-66, 135, 47, -29, 25, 121, -77, -112, 
+	-142, -33, -176, 21, 1, 0, 6, 121, 
+	-14, -74, 34, 145, 57, -3, 42, -54, 
+	-6, 91, 64, 31, 171, 149, 2, 18, 
+	102, -161, 104, -62, 28, 108, 113, 17, 
+	169, -101, -32, 73, -14, 10, -29, 10, 
+	86, 91, 35, 0, 139, 21, -86, -189, 
+	-46, 67, 90, -69, -11, -128, 12, -55, 
+	-43, 92, 22, 66, 44, -157, -22, -100, 
+	-24, -12, 116, 2, 36, 65, -1, 109, 
+	-10, -26, -107, 179, 47, 73, -20, 11, 
+	80, 16, -156, 43, 159, 78, 50, -47, 
+	-69, -57, -50, -1, 69, 101, -83, -5, 
+	31, -70, 93, 26, 55, 21, -76, -77, 
+	-147, -181, 59, 72, -54, -39, -96, -70, 
+	39, -3, -11, -26, 122, 105, 90, -51, 
+	155, -94, -235, 118, 48, -55, 113, 139, 
+	-66, 69, 45, -105, -6, -81, 5, 109, 
+	-5, 23, -93, 145, 135, 57, 78, -82, 
+	4, 86, -57, -111, 203, 97, 174, 18, 
+	-94, -24, -52, -110, -18, 27, -24, 109, 
+	-20, -156, 281, 113, -4, 54, -78, -107, 
+	-129, -72, -50, 37, -75, -197, -65, -98, 
+	-59, -36, 195, -51, -8, 85, -58, 94, 
+	18, 11, -118, 146, 27, -49, -112, -88, 
+	-128, 61, -4, -47, 73, -103, 75, -24, 
+	43, 109, 173, 169, -76, -167, -35, 201, 
+	-28, -7, -118, 178, -153, -47, -112, 52, 
+	-15, -219, 143, 68, 16, 5, 19, 167, 
+	-63, -143, 10, -201, 62, 41, 45, -15, 
+	61, -31, -82, 48, -138, -77, 65, -9, 
+	-121, 79, -64, -31, -49, -69, 48, 12, 
+	42, -28, -12, 155, -18, 17, 65, -80, 
+	-1, -9, -83, -32, 166, -3, -7, 12, 
+	-14, 253, 3, 29, -97, -21, -48, 151, 
+	-61, -6, -123, 172, -2, 0, 12, -57, 
+	114, -80, -91, 134, -48, 32, -146, 36, 
+	-127, 12, -70, -132, 105, 28, -111, 178, 
+	-144, -122, -158, -173, -63, -62, 59, 162, 
+	8, 67, 44, -103, 102, 4, 6, 20, 
+	-18, -24, -2, -36, 15, 60, 97, -18, 
+	109, 103, -28, 126, -41, -39, 37, 43, 
+	97, -179, 146, 140, 18, -90, -64, 120, 
+	-13, -65, -64, 127, -18, -134, -19, -107, 
+	-94, 11, 67, 158, -70, -5, 36, 24, 
+	2, 71, 46, 56, 166, 41, -41, 140, 
+	-74, 51, -81, -3, -44, -157, 12, 2, 
+	-180, -116, 168, -86, 112, -18, 40, 38, 
+	-134, -104, 113, -116, -130, -109, -118, -126, 
+	87, -182, 131, -90, -34, -42, 70, -19, 
+	58, 13, 9, 2, -145, 17, -82, -99, 
+	-5, -1, 72, 225, -34, -159, -93, 23, 
+	104, -69, 11, -128, -104, -175, -130, -33, 
+	-14, -12, 51, -16, 20, -37, -39, 119, 
+	15, -8, -133, -17, 75, -75, 68, 116, 
+	114, -16, 72, -16, 40, 103, -152, 19, 
+	-109, -43, 28, -170, -98, 49, -3, -26, 
+	41, -212, -34, -58, -75, -79, -4, -129, 
+	-31, -104, -121, -189, 31, 274, 12, -255, 
+	9, 20, 128, -10, 68, -4, -171, 8, 
+	-24, 152, -90, 15, 60, -224, 4, -57, 
+	11, 100, 85, -52, -118, 32, 55, 0, 
+	-64, 45, -5, 65, 17, -76, -165, -45, 
+	-59, -157, 156, 3, -22, -50, 18, 88, 
+	-47, -139, -114, -3, -77, 142, -84, 13, 
+	46, -161, 18, 135, 81, 14, 57, 57, 
+	67, 1, -50, 6, 98, -40, -49, -183, 
+	144, 53, 61, -51, 23, -20, 18, 50, 
+	-117, -58, 3, -112, -4, -138, 34, -106, 
+	29, -212, -44, 57, -55, 1, -3, -118, 
+	3, 56, 13, 34, 35, -107, 26, -63, 
+	51, -80, 66, -40, -76, 57, -54, 6, 
+	-33, -71, -36, 39, 102, 82, 65, -3, 
+	41, -23, -12, -116, -12, 61, -2, -45, 
+	-119, -13, -22, -40, -1, -55, -51, 70, 
+	105, 32, -12, -162, -157, 31, -52, 3, 
+	55, 11, 39, 9, 77, -126, -192, -71, 
+	-97, -39, 37, 32, -126, 56, 105, -90, 
+	-16, 113, -20, 30, 22, -63, -37, 40, 
+	31, -72, -27, -48, 83, -75, -24, -36, 
+	26, -103, -176, -32, -9, 101, 15, 93, 
+	-3, 16, 26, 4, -44, -1, 105, -87, 
+	19, -14, -115, 32, -88, 117, 84, -27, 
+	-14, 39, 68, -79, -109, 12, 108, -9, 
+	-23, 101, -8, -22, 30, -114, -73, -8, 
+	144, 39, -113, 4, 6, -47, -59, -136, 
+	-78, 76, -62, 75, 11, 11, 64, 37, 
+	72, 114, 42, 49, 2, 44, -60, -98, 
+	90, 1, -236, -9, 105, -62, -116, 110, 
+	-177, 5, 6, 50, 116, 103, 82, 109, 
+	57, -79, 61, 155, 35, 53, -28, 99, 
+	101, -41, 72, -53, -36, 5, 78, 11, 
+	61, -24, 103, 91, -34, -18, -37, -25, 
+	76, -66, -141, -81, -71, -5, 53, -81, 
+	94, 50, 69, -25, 18, 15, 54, -163, 
+	50, 40, -171, 108, -60, -143, -61, -43, 
+	-52, -66, -45, -174, -58, -3, -32, 139, 
+	0, -139, 24, 12, -133, -32, -6, -77, 
+	-23, -58, -45, -105, -82, -122, 15, -25, 
+	76, -79, -148, 7, -52, 5, 54, 57, 
+	10, 82, -69, 5, -62, 44, -82, -58, 
+	15, -17, -120, -13, -83, -148, -27, 13, 
+	5, -76, 23, 24, 89, 7, -80, -74, 
+	37, 51, -67, -76, -158, -49, -38, -59, 
+	-10, 79, 105, 86, -34, 40, 12, -52, 
+	-40, 69, 67, 149, 54, 83, -134, -90, 
+	93, 13, 28, 32, -129, -64, -25, -82, 
+	-11, 60, 37, 117, -33, -40, 22, 27, 
+	31, 11, 72, -136, -18, 137, 66, 73, 
+	-30, -118, -146, -31, 23, -76, 91, 61, 
+	-18, 72, 99, 103, -9, 64, 100, 4, 
+	3, -83, 61, 58, -158, 66, 25, 90, 
+	2, -31, 41, 74, 69, -52, 43, -184, 
+	-8, -11, -74, -30, 141, 23, 55, -114, 
+	93, 210, -103, 160, -159, 103, -39, -78, 
+	-49, 121, 117, 90, 27, -6, -73, 82, 
+	51, 89, -173, 91, -2, -20, 67, 85, 
+	37, 161, -40, -139, 16, -23, 47, 86, 
+	6, -42, 36, -18, -85, -93, 44, 77, 
+	-69, 134, -42, 21, 15, 27, 63, -50, 
+	23, 119, -94, -80, 63, -138, 2, -35, 
+	-29, 133, 29, -129, 33, 69, 42, 43, 
+	-18, 134, 17, -5, -46, -74, 83, 12, 
+	72, -4, -95, -56, 30, -91, -16, 23, 
+	-8, 16, -25, 20, -116, 25, 58, -40, 
+	-80, -102, -107, 99, -35, -28, -24, -6, 
+	43, -96, -51, -32, -186, 47, 43, -75, 
+	-106, -20, -75, -45, 106, 0, 59, 33, 
+	138, 68, -17, -55, 116, -113, -85, -180, 
+	-52, 74, -28, -83, 99, -37, 0, 4, 
+	-40, 36, 101, 21, 91, -93, -70, -27, 
+	80, -179, -29, -89, -146, -144, 64, 47, 
+	9, -254, 36, 20, -42, -4, -200, 104, 
+	-21, 56, -108, 92, 46, 10, 33, -28, 
+	29, -25, -30, -66, -113, -68, -62, 167, 
+	41, -117, -4, 184, 137, -47, -60, 54, 
+	38, -13, 7, -11, 48, -87, -28, 164, 
+	-46, -63, -86, -68, -34, -3, 67, -25, 
+	-57, 97, 39, -179, 144, 6, 140, 57, 
+	61, 47, 41, -37, -21, 120, 104, -132, 
+	-48, -3, 104, -118, 12, 62, -23, -7, 
+	-18, -40, 61, -31, -113, -47, 71, -92, 
+	-76, -84, 3, 46, 141, 146, 105, -18, 
+	63, -47, -1, 32, -70, -50, 39, 18, 
+	31, -46, 39, -73, 20, -15, 14, 1, 
+	-69, 75, -48, -25, 24, -18, -9, 2, 
+	31, 4, -8, -89, -4, 58, -96, 32, 
+	-79, -78, -26, -62, 51, -33, -82, 16, 
+	-45, -75, -8, 27, -82, -23, -87, -48, 
+	-86, 70, -50, -4, -95, 82, 21, -32, 
+	-10, -22, 0, 82, -88, 45, 77, 5, 
+	32, -4, -38, -91, -92, -84, 22, 43, 
+	-42, -2, 2, -91, -36, -87, 73, 22, 
+	66, -4, -56, -69, -65, 72, 15, 35, 
+	-34, -9, -40, -53, 67, 9, -59, -79, 
+	-56, 65, -50, -47, -42, -93, -1, 55, 
+	55, 57, -45, -108, -90, -41, -25, -86, 
+	-92, 30, -20, 57, 2, -21, 39, -8, 
+	-94, -37, -1, -26, 42, 66, -63, -65, 
+	66, 12, -45, 28, -55, -137, -74, 23, 
+	36, -19, 10, -13, -98, 5, 10, -59, 
+	-37, -118, 6, 75, 76, 77, -54, -2, 
+	-27, -22, 65, 48, -77, -38, 30, -86, 
+	0, -22, 57, -4, 5, -35, 39, 47, 
+	-35, -80, -109, 44, -20, -6, 34, -72, 
+	-25, 31, -29, -19, 15, 31, -19, 20, 
+	52, -106, -58, -63, 13, -42, -95, 43, 
+	2, -15, -91, -99, -63, 0, -47, -67, 
+	61, 19, 46, 6, -27, 8, 11, 16, 
+	-48, 59, -20, 46, 2, 28, -50, 77, 
+	-20, 11, -23, 9, 10, 3, -58, 64, 
+	56, -50, 41, 71, 95, -84, -16, -9, 
+	-11, -9, 51, 10, -59, -66, -107, -58, 
+	-88, -61, 40, 32, 33, 68, 12, -79, 
+	-56, -83, -31, -75, -4, -44, 54, 21, 
+	-25, -7, 85, -90, 9, 72, -50, -83, 
+	-88, 10, 58, -5, -79, -44, 18, -3, 
+	-20, -63, -58, 86, -59, 8, -45, 30, 
+	15, -42, -79, -41, -1, 42, -92, -65, 
+	51, 6, -103, 34, -20, -27, -66, 21, 
+	-41, 38, -42, 7, -64, 60, -81, -106, 
+	-68, -17, 54, -7, -88, 41, -44, -5, 
+	-88, 2, -12, -1, -54, -75, -15, -94, 
+	36, 42, 38, -20, -61, 7, -94, -8, 
+	-89, -47, -39, 63, 76, -65, 41, -39, 
+	0, -59, -3, 11, 36, 65, -92, -10, 
+	57, 23, -34, -9, 61, -2, 80, 17, 
+	-65, 72, -53, 34, -75, -51, -18, -10, 
+	-13, 8, 48, -1, -75, -56, 51, -49, 
+	30, 96, 63, -14, 43, -13, -71, -85, 
+	-24, 8, -43, 60, -49, 4, -74, -79, 
+	18, -90, 16, -25, 70, -73, -52, -106, 
+	19, 69, -88, -88, -7, 31, -19, 18, 
+	13, -51, -55, 35, 14, 77, -61, -19, 
+	82, -17, -52, 51, -59, -80, -24, -45, 
+	45, -49, -87, 34, -8, -51, -42, -23, 
+	-10, -52, -118, -95, -95, -5, -47, 0, 
+	-90, -49, 8, -22, -11, 55, -19, -46, 
+	31, -91, -21, 38, 13, 68, 55, 30, 
+	57, 75, -25, 60, -70, 67, 44, -68, 
+	10, -92, -67, -84, -39, 37, 48, 40, 
+	-56, 34, -16, -90, 20, -12, -22, 51, 
+	17, -43, 43, -70, -72, 75, -16, -37, 
+	0, -86, 23, -16, 49, 14, -12, -21, 
+	-61, -2, -47, 71, -63, -51, 36, -47, 
+	-81, -65, 14, 21, -4, -62, -37, -72, 
+	49, 28, -3, 61, -54, 64, -82, 45, 
+	-78, -87, -19, 41, -8, -59, -17, 71, 
+	-24, -70, -87, -57, -63, -43, -28, -124, 
+	19, 15, 47, -20, -55, -60, 18, -27, 
+	56, 55, 10, -59, -67, 35, -94, -50, 
+	8, -41, 18, -9, -32, -63, 100, 50, 
+	90, 58, -97, 32, 33, 50, -50, 0, 
+	43, -32, 18, -32, -15, -78, -77, -34, 
+	15, -73, -37, 3, -58, -26, 57, -3, 
+	-6, 41, 59, 21, 66, 47, 62, 88, 
+	-39, -60, 140, -32, -21, -160, -22, 109, 
+	-44, -46, 2, 60, -14, -44, 16, 21, 
+	67, -18, -73, 53, -2, -65, 115, 51, 
+	-153, 75, -63, -63, 12, 16, 41, 11, 
+	90, -4, -24, -68, -49, -22, 37, 14, 
+	52, 38, 161, -5, -82, -45, -108, 71, 
+	92, -59, -20, 92, -81, -58, 121, 79, 
+	74, 68, 46, -32, 16, 13, 127, 90, 
+	62, -23, -6, 32, -77, 124, 130, 85, 
+	112, 50, -4, -120, 43, 27, 20, 14, 
+	5, 5, 16, 104, -13, 69, 66, -55, 
+	-96, 163, 107, 24, -73, 40, -35, 90, 
+	-63, -42, -76, -1, -62, -54, 98, 9, 
+	33, -91, 89, -64, -69, -99, 67, 52, 
+	62, 31, 31, 32, -23, 3, 5, -16, 
+	31, -98, -75, 78, -11, -9, -93, 21, 
+	-15, 35, 144, -38, -77, 237, -85, -51, 
+	92, -131, -49, -32, -94, 62, 33, -36, 
+	12, -126, -88, -67, 43, 7, -12, 115, 
+	-7, 22, 118, 2, -255, -119, 29, -17, 
+	-30, -73, 64, 29, -6, -13, -114, -30, 
+	22, -55, 10, 40, -21, 102, 52, -55, 
+	61, 28, -22, 131, 12, -3, -32, 99, 
+	35, 131, -31, 74, 148, 137, 25, -76, 
+	-51, -59, 147, -71, -21, 47, -59, 5, 
+	-12, -59, -72, 51, -69, 55, 48, 23, 
+	-61, 76, 27, 107, 31, -39, 145, 57, 
+	46, -44, -30, 128, 3, 149, 50, 69, 
+	111, 88, -61, 78, 27, 120, -36, 66, 
+	32, -32, -23, 100, 71, -13, -30, -31, 
+	18, 60, -36, -46, -47, 103, -86, -19, 
+	84, 79, 22, 1, -32, 48, 76, -63, 
+	7, 26, -108, -67, 109, -55, 71, -34, 
+	14, 45, 38, 39, 64, 43, 8, 181, 
+	-46, 186, 14, 68, -42, 92, 83, 36, 
+	-3, 88, -71, -14, 4, 86, -18, -84, 
+	68, -38, 104, 70, 102, 8, 94, 31, 
+	48, 38, 62, 119, 5, -16, -34, -107, 
+	61, 118, 36, 0, -77, 42, 12, -134, 
+	-47, -66, -4, -2, 84, 64, -121, 61, 
+	-121, 157, -7, 127, -60, 73, -42, 0, 
+	-28, 2, -42, 65, 0, 14, 52, -100, 
+	111, -7, 77, -48, 20, 13, 57, -72, 
+	83, -166, 58, -63, -59, 118, -68, -81, 
+	26, -97, -79, 39, -55, -131, 21, 108, 
+	-75, -108, 58, 49, -140, -17, 139, -172, 
+	29, -144, 48, 54, 93, 167, -146, -29, 
+	114, -10, -117, -13, 103, -1, 90, 8, 
+	77, -132, 42, 87, 39, 10, 3, 142, 
+	-71, 4, 110, -3, -92, -97, -88, 49, 
+	96, 73, -57, 55, -41, -14, -144, -3, 
+	-17, 40, -71, 176, 71, -63, -69, -51, 
+	-12, -74, 84, 135, 4, -10, 32, 41, 
+	-71, 2, 27, -73, 210, -93, 75, 74, 
+	69, -95, -89, -18, -99, -55, -101, 8, 
+	119, 78, 71, 51, -15, -31, -165, 59, 
+	8, 26, -53, -147, 84, 19, 118, 157, 
+	-22, 14, 134, -41, 4, 45, -38, -29, 
+	-102, 39, 12, -140, 24, 2, -108, 129, 
+	115, 133, 21, -108, -108, -75, -8, -37, 
+	74, 170, 307, 36, -30, -41, 38, -62, 
+	20, 6, -63, -13, -135, 90, -56, 134, 
+	89, 204, 125, -42, 84, -118, 46, -27, 
+	86, 55, 21, -86, -7, -136, 25, 30, 
+	-168, 109, 15, -31, 5, 120, -6, -19, 
+	-52, 158, 91, -20, 9, 81, 125, -172, 
+	95, -167, -53, -66, 45, -89, -123, -48, 
+	-56, 38, 133, -166, 11, 18, -154, 102, 
+	113, 186, -18, 68, 35, 158, 77, -203, 
+	132, 23, -68, -109, -164, -129, -1, -61, 
+	-108, 98, -130, -76, -93, 14, 35, -53, 
+	151, 150, 17, -31, 4, 25, 9, 57, 
+	-45, 135, 129, -36, 16, 11, -4, 62, 
+	100, 41, 17, 25, 64, 63, -2, 27, 
+	75, -24, -49, 97, 3, 89, 164, 52, 
+	-70, -12, -48, 203, 87, 41, 52, -24, 
+	67, 109, -33, 128, -67, 101, 185, 155, 
+	-135, 53, 35, -91, -19, 21, 77, 135, 
+	18, -123, 97, 96, -6, 142, -19, 103, 
+	34, -21, 12, 6, 70, -116, 117, -24, 
+	-95, 16, 102, -108, -106, 78, -42, -85, 
+	-26, 75, -4, -86, -127, 19, -91, -170, 
+	37, -73, -93, 91, 10, 85, 56, 101, 
+	-52, -99, -80, 10, -201, -63, 44, 1, 
+	-54, -181, -44, -58, -14, 75, 78, 67, 
+	-6, 16, 29, -82, 13, -43, -5, 47, 
+	-23, -45, -57, 49, -41, 7, 71, 46, 
+	21, -186, -13, 8, 96, -231, -14, -4, 
+	85, 40, -41, -68, -134, 93, 57, 66, 
+	-8, 77, -48, -94, -47, 65, -134, 52, 
+	-21, -157, 36, -28, 22, 63, 57, 138, 
+	133, -126, 213, 147, -90, -30, 101, 58, 
+	-49, -38, 136, 94, 131, 30, -82, -179, 
+	-6, -43, -369, -12, 20, 28, 101, -114, 
+	-12, 35, -39, 57, 12, 80, 6, 63, 
+	25, 79, 27, 36, 61, 56, 69, 52, 
+	29, -4, -20, 61, -26, -76, -13, 12, 
+	5, 32, -3, -70, 16, 94, -15, 64, 
+	-58, 108, 85, 52, 111, -8, 99, -94, 
+	-1, 132, 70, -55, -40, 117, 117, 130, 
+	-28, 9, -57, 16, 3, -29, 5, 113, 
+	24, 153, -31, -4, -29, 124, -3, 3, 
+	44, 88, -40, 12, 68, 66, -101, -21, 
+	-46, -22, 63, 151, -49, -19, -101, -52, 
+	-85, 91, -81, 11, 68, -94, 104, -109, 
+	94, 4, -77, -4, 43, -15, 70, 17, 
+	-51, 83, 5, 42, -41, 11, 115, 138, 
+	-94, 102, 7, -20, -84, -11, -51, -6, 
+	13, -66, 5, -26, 57, 78, 89, -43, 
+	-81, 62, -62, 134, 89, 132, -43, -79, 
+	-17, 74, 153, 18, 130, 13, 48, -95, 
+	-22, -159, -91, -109, 14, 75, -77, -5, 
+	62, 168, -91, 122, 127, 45, -86, -3, 
+	-7, 222, 5, 95, 111, 170, -45, 13, 
+	8, -209, 48, 44, 99, 29, 114, 5, 
+	105, -140, -118, -202, -228, -10, -67, -24, 
+	65, 38, -22, 7, 94, 78, 162, 69, 
+	79, -35, -99, 77, 32, -208, 37, -211, 
+	-56, -33, -30, 84, -106, 279, -150, -74, 
+	-64, -182, -28, -47, 36, -33, 30, 53, 
+	-6, -193, 176, 56, -94, -81, 25, 152, 
+	60, -37, 235, -130, -35, -18, 4, -58, 
+	-27, 34, -58, -177, -14, 0, -210, -75, 
+	-35, 52, 22, 73, 95, -34, 40, 90, 
+	-2, 8, 82, -57, -66, -85, -3, -137, 
+	-85, 123, -46, 5, 101, -27, -108, -2, 
+	-157, -113, 2, -105, -57, -59, 65, 79, 
+	21, -187, 71, -99, -10, -19, -46, 61, 
+	-113, 25, 62, -165, 85, 178, 125, -29, 
+	44, 41, 48, -59, -6, 107, 85, 92, 
+	121, -42, 34, -150, -3, -47, -58, -4, 
+	-75, 84, 4, -216, -2, -34, -88, 37, 
+	68, 170, 95, -15, 13, -16, -4, -217, 
+	82, 49, -13, -25, -180, -61, -30, -84, 
+	-7, 95, -62, -9, -67, -29, 72, -90, 
+	-10, -69, 136, -87, -89, -25, -98, 101, 
+	-175, 6, 32, 139, 96, 96, -78, -58, 
+	111, -77, 24, 100, -41, -36, -34, 65, 
+	115, -19, -179, 6, -103, 45, -74, 15, 
+	-60, -230, 82, -101, -9, -110, -25, 117, 
+	-58, 33, -52, 20, -158, 104, -101, -57, 
+	45, -102, -68, -44, -147, -55, 43, 92, 
+	24, -23, -80, -31, 23, -152, 65, -21, 
+	-75, -50, -55, 7, 22, -30, -97, -75, 
+	-24, -57, -72, -13, -63, -21, -108, -91, 
+	-42, -69, 71, 68, 23, 64, -6, -81, 
+	1, -74, -94, -79, 67, 25, -119, 84, 
+	-19, -8, -35, 25, -85, -16, 47, 71, 
+	13, -58, -30, 65, 0, 16, -36, -73, 
+	2, -19, 4, 14, -94, -5, -63, -76, 
+	-123, -103, -40, -4, -115, 44, 62, -28, 
+	20, 10, -64, 19, 20, -89, 48, -105, 
+	-74, 4, -10, 58, 76, 31, 7, 49, 
+	40, 35, 86, -71, -17, -95, -10, -119, 
+	-4, 31, 21, -102, -102, -51, 55, -23, 
+	-91, -18, 51, -9, -46, -100, 49, -20, 
+	70, -19, -41, 18, -24, 39, -73, -78, 
+	50, 3, -12, 27, -41, 34, 18, 29, 
+	57, -67, -74, -124, -76, 3, -96, -83, 
+	-96, 2, 69, 49, -78, 11, -79, 58, 
+	2, -28, -98, -22, 69, 49, 73, -6, 
+	49, -85, 10, -90, -90, -23, -71, -95, 
+	-76, 75, 35, -84, -92, 76, 56, 17, 
+	-102, 36, 72, -70, 21, -76, -7, 32, 
+	-51, 53, 8, 41, 42, 23, 10, -85, 
+	83, -57, -78, -2, 45, -41, -100, -31, 
+	-51, 71, -89, -11, -69, 47, 54, -47, 
+	10, -13, -4, 83, 43, -123, 40, -76, 
+	-91, 58, 31, -85, -80, -62, -51, 74, 
+	-94, -39, -40, 41, -70, 56, -8, 18, 
+	20, -88, -73, -89, -63, -10, -51, -92, 
+	-73, -120, -4, -41, -18, 22, -87, 71, 
+	-9, -45, -25, 69, -87, -26, -36, -77, 
+	-39, 27, -55, 22, -99, -31, 27, 12, 
+	-75, -53, -43, 43, 64, -68, -88, 54, 
+	-73, 33, 49, -72, 26, -63, 33, 10, 
+	-48, -74, -24, -33, -46, -98, -29, -86, 
+	-51, -101, 19, 46, -111, 12, -12, 50, 
+	-2, -77, 40, 42, 55, 31, 3, -59, 
+	-24, 76, 56, 53, 22, -70, -6, -57, 
+	67, -13, 4, -1, 0, 46, -11, 7, 
+	63, -62, 49, -80, -99, -93, 30, 21, 
+	-10, 14, -31, -36, -1, -48, 23, -74, 
+	78, -26, 49, -51, 53, 32, 10, -43, 
+	25, -102, 44, -17, 57, 42, -70, 50, 
+	45, 34, -5, -62, -41, 47, 78, -5, 
+	29, 17, -31, -50, -64, -59, 4, 42, 
+	42, 1, -81, -31, -38, 38, -32, 38, 
+	8, -5, -21, -13, 16, -35, 11, -40, 
+	67, -40, -64, -48, -41, 43, 70, -8, 
+	72, -89, -102, -72, 45, -22, 46, -92, 
+	-55, -45, -14, 44, -24, 43, 79, -22, 
+	-65, 31, 58, -52, 54, -99, -19, -42, 
+	71, -69, -65, -90, -50, -13, -29, -42, 
+	20, -105, -69, -93, 53, 71, -105, -88, 
+	31, -6, -2, -26, 53, -71, 45, 33, 
+	13, -80, 21, 50, 42, 80, 51, 3, 
+	48, -31, -81, 21, -86, -73, 0, -44, 
+	-53, 66, -16, 24, -48, -36, -3, -7, 
+	-54, -49, 52, 11, -48, 14, 3, -31, 
+	-8, -83, -78, -70, -15, 48, -112, -105, 
+	47, 27, -93, 5, 48, -25, -4, -38, 
+	-54, -52, -68, -114, -100, -48, -43, -17, 
+	-92, -91, -45, -86, 67, -95, 78, 25, 
+	-27, 14, -115, -88, 21, 3, 31, 35, 
+	-90, 54, 15, -74, -100, -54, -17, -104, 
+	0, -99, -97, 37, 63, 40, 57, -65, 
+	-10, 26, -110, -97, 43, 20, 24, -35, 
+	53, 50, -85, 8, -93, 74, 74, 76, 
+	71, 12, -76, -46, -54, -32, -1, -10, 
+	-35, -16, -81, -77, 21, -67, -124, -57, 
+	-9, -10, 42, 13, 24, -46, 59, -51, 
+	65, 66, 23, 12, -42, 31, -42, 16, 
+	-30, -73, -38, 7, -77, -112, -25, 34, 
+	-52, -83, -64, -22, -22, 40, -84, -30, 
+	-126, -25, -157, -9, -66, -51, -11, 69, 
+	-76, -108, -10, 77, 93, -39, 36, -129, 
+	-106, 130, 34, 231, 43, -29, 35, 86, 
+	-50, 24, -26, 61, 107, -290, 142, 145, 
+	9, -101, -88, -58, 43, 92, -106, 52, 
+	76, -189, 80, 72, 46, 71, 23, 91, 
+	8, 12, 100, 134, -151, 22, -82, -106, 
+	-107, -9, -28, 21, -75, -5, 78, -186, 
+	98, 33, 43, 44, 65, 58, -19, 159, 
+	-126, 140, 76, 74, 38, -75, 103, 76, 
+	18, 10, 164, -38, 65, 41, 158, 79, 
+	50, 173, 53, 228, 1, 83, -35, -94, 
+	-62, 40, -91, -44, -135, 77, 112, -75, 
+	81, 27, -103, 6, -73, -45, -84, 87, 
+	-40, -12, -24, 49, -52, 110, -23, -120, 
+	-101, -130, -85, -59, -110, -83, 79, 43, 
+	140, 65, -166, 104, 103, -2, 99, 107, 
+	-117, -4, 9, 26, -31, 169, 3, 72, 
+	34, -14, -77, 117, -163, 47, 38, -26, 
+	95, -249, 19, -64, 160, -61, 107, -46, 
+	2, -132, 60, -22, -164, 37, 42, 62, 
+	-12, 165, -84, 75, 55, 17, 75, -189, 
+	101, -152, 10, 24, 30, 130, 36, 25, 
+	-30, 53, -54, -36, 98, -35, 51, 59, 
+	-58, -81, -206, -57, -83, 9, 38, 24, 
+	111, -130, 214, 18, -60, -109, -94, -88, 
+	-133, -73, -50, -114, -40, -57, 36, -66, 
+	-60, 196, -88, -126, -124, 36, -132, -80, 
+	-48, 24, -151, 91, -13, -259, -169, 17, 
+	111, -271, 197, -89, 35, 71, -288, 150, 
+	-72, 122, 32, -137, -81, -77, -71, 142, 
+	-100, -104, -59, 23, -228, -155, -13, 99, 
+	134, -180, -114, -122, -155, 64, -55, -4, 
+	142, 10, 52, -37, 36, 4, -28, 23, 
+	102, -116, 176, -84, 38, -27, -32, 16, 
+	-25, 138, -34, -68, 106, 49, 14, -7, 
+	-144, 206, 11, 37, 113, 88, 18, -48, 
+	103, -13, -16, 86, 20, 49, -24, -40, 
+	63, 134, 16, 17, -83, -48, 32, -37, 
+	-17, 94, -151, 4, 109, -42, 75, -12, 
+	-2, -67, 144, -95, -77, 77, -46, -99, 
+	-13, 97, -37, -120, 9, 100, 110, 111, 
+	0, 66, 93, 116, -66, 64, 12, 47, 
+	-39, -119, -44, 4, 31, -166, -53, -33, 
+	-66, -44, -99, -23, -58, -151, -65, -61, 
+	-74, -72, 53, 42, 34, 193, 176, -70, 
+	-94, -71, -52, -1, 49, 2, 57, 78, 
+	-57, 3, 122, -83, -46, -203, -47, -5, 
+	-18, 105, -84, -74, -68, -64, 94, -96, 
+	-8, -24, 2, 39, -48, 32, 23, -27, 
+	-201, 56, 34, -115, 19, -134, -140, -46, 
+	22, 72, 5, 123, 64, -36, 30, 118, 
+	23, -4, -164, -9, 31, -85, 32, -100, 
+	-30, 35, 89, 100, 88, 74, -76, 28, 
+	3, -25, -56, -28, 11, 51, -72, -69, 
+	37, 60, -18, 43, -86, -74, 53, -96, 
+	2, -135, 19, -32, 55, 35, 139, 52, 
+	20, -81, -140, 48, 102, 42, 19, -20, 
+	19, 86, -43, -37, -76, -59, 100, 33, 
+	133, -77, 2, 85, 134, -91, 0, 192, 
+	11, -35, 66, -154, -1, -125, -62, 56, 
+	8, -48, 3, -78, 0, -80, 28, 35, 
+	47, 88, -60, -62, 42, 78, 123, 19, 
+	85, 76, -45, -88, -49, -59, -142, 143, 
+	43, 34, 48, -2, -51, 67, 53, 144, 
+	59, -115, 85, 13, -1, 10, 47, -56, 
+	-21, -115, 38, 66, 101, -15, -47, 109, 
+	41, -16, 50, -65, -68, -133, 118, -9, 
+	102, 46, 80, -42, -95, 34, -33, -18, 
+	-76, -2, 18, -27, -147, -16, 9, -6, 
+	-121, 65, -139, 142, -63, 86, 17, 38, 
+	-37, 120, -48, -120, 48, 39, 55, 41, 
+	45, 1, -81, 64, 35, -19, 92, -22, 
+	-1, 36, -45, 61, 84, 62, -14, 52, 
+	-178, 70, -38, 73, -14, -37, -2, -116, 
+	71, 0, 52, -135, 50, -29, 36, 88, 
+	-2, 37, 49, 9, -39, -90, -106, 73, 
+	-25, -22, -26, 44, 110, 39, 64, 5, 
+	48, -48, 125, -44, 114, 73, -9, -95, 
+	-40, -86, -88, -59, -77, -49, 51, -46, 
+	112, 98, -110, 29, 66, -2, -27, 138, 
+	17, 8, -72, 171, 99, -33, 95, 11, 
+	89, 91, 23, -41, 44, 33, 116, 102, 
+	-87, 196, 38, 79, -38, 39, -56, 80, 
+	3, -83, 87, -18, 23, -63, -8, -43, 
+	74, 98, 51, 125, -26, -26, -74, 20, 
+	-148, 40, 90, -9, -40, -20, 48, 27, 
+	120, 7, -51, 78, 63, -66, -88, 69, 
+	126, -8, 11, -41, -73, 154, 67, -105, 
+	-37, -32, 65, 23, -13, 89, 64, -13, 
+	-9, 59, 56, 87, 45, 57, -27, 65, 
+	-41, 15, 56, -89, -57, -93, -76, 42, 
+	119, 11, -60, 69, -257, 124, 85, -19, 
+	58, 8, -90, 73, 34, 83, 67, 0, 
+	16, 56, 143, 50, 108, -65, 115, 109, 
+	13, 139, 85, 42, 80, -24, 38, 136, 
+	-146, -62, -62, 82, -6, -110, 0, 18, 
+	15, -79, 208, -21, 41, 82, -31, -37, 
+	-108, -120, 72, -11, -87, -68, 55, -55, 
+	28, 41, -85, 98, -5, -49, -43, -17, 
+	61, 37, -90, 17, 76, 70, -60, -14, 
+	-25, 67, -159, -22, -56, 12, 132, 20, 
+	87, 81, 68, 71, -81, 53, -90, 0, 
+	-44, 70, 17, 6, 9, 57, -11, -70, 
+	107, 31, -132, -97, -5, -34, 64, -30, 
+	-133, -121, 146, -17, -2, 52, 2, 5, 
+	126, -104, 12, -123, 51, -20, -134, 97, 
+	-112, 29, 13, -17, 78, 18, -54, -197, 
+	27, 236, 115, -80, 15, -39, 76, 1, 
+	6, 70, -145, 53, 26, -97, 103, 59, 
+	163, -57, 49, 107, -95, 23, 71, 19, 
+	-30, 75, 18, 110, -70, 59, 43, -74, 
+	-106, -23, 196, -49, 45, 46, -90, -87, 
+	-20, -146, -71, -9, 86, -84, -76, -95, 
+	-74, -162, 35, 138, -38, -87, 102, 64, 
+	99, 28, -24, -146, 53, -156, -93, 55, 
+	-80, -24, 6, 121, -348, -168, -76, 113, 
+	39, -56, 28, 13, -98, -40, -7, -62, 
+	-84, -101, 111, 112, 0, 137, -2, 188, 
+	38, -75, 152, 45, 8, -43, 120, -18, 
+	-152, 92, 51, 8, 23, -42, -21, 58, 
+	100, 182, -81, 9, -58, -159, -155, 47, 
+	-184, 19, 46, 25, -34, -14, -24, -97, 
+	-153, -70, -117, 112, 4, -46, -9, -30, 
+	-99, 137, 18, 43, 46, 12, -115, 68, 
+	-86, -5, 16, -6, -137, 242, -148, -90, 
+	-75, 55, -68, 8, -109, -58, -70, 33, 
+	-108, -39, -49, -121, 40, -102, 5, -7, 
+	89, -6, 89, 48, 143, -15, 176, -196, 
+	175, -128, 66, 69, -49, 0, 47, 125, 
+	5, -27, 72, -139, 14, 28, 21, 18, 
+	-122, -17, -68, -105, -53, -16, -57, -28, 
+	3, 157, 56, -71, -67, 49, 78, -15, 
+	26, -38, -49, -58, -47, 26, 36, -51, 
+	-12, 38, 27, -25, 95, -135, -36, -105, 
+	22, 15, 106, 5, 47, -40, -114, 67, 
+	-54, -59, -54, 84, 71, 48, 188, 43, 
+	-7, 53, 204, -89, -76, -48, 20, 41, 
+	143, -3, 82, 95, -59, -38, 1, -65, 
+	52, -238, 154, -92, 78, -2, 142, -101, 
+	-73, 44, -145, -152, 51, 20, 177, -13, 
+	-210, 104, 93, -2, -227, 120, 24, 92, 
+	-99, -50, 227, -55, -168, 84, 35, -38, 
+	40, 162, 12, -41, 194, 80, 70, 56, 
+	102, 11, -56, 29, 37, 95, 41, -7, 
+	15, -88, 14, -18, 42, -124, -72, 125, 
+	113, -48, 93, 37, -58, 49, 97, 4, 
+	-14, -69, -35, 82, -26, 7, 149, -79, 
+	-3, -86, -20, 109, 42, -17, 126, 54, 
+	-45, 134, -69, 16, -41, 48, 159, 95, 
+	-151, 0, 47, 25, -49, 42, -48, 112, 
+	-8, -156, 42, 187, -71, 15, -91, -44, 
+	-9, 63, -82, -89, -46, -53, 104, -50, 
+	-132, 80, 191, -168, -100, -49, 26, -33, 
+	-4, -109, -180, -5, -18, 2, -141, -139, 
+	53, 49, -47, 106, -58, 98, -4, -57, 
+	-53, -127, 9, 68, -178, 19, 101, 33, 
+	-128, -19, -9, 38, 64, 44, -73, -78, 
+	-132, -89, -51, 7, 15, -164, -33, -56, 
+	54, -43, -50, 19, -44, 24, -12, 10, 
+	174, 32, -23, -42, 159, -183, -91, -114, 
+	169, -55, -16, -103, -157, 101, 110, 153, 
+	95, 26, -102, -85, 10, -46, -66, -56, 
+	-30, -90, 62, -76, 134, 18, -20, 2, 
+	174, -87, 231, 39, 7, 8, 28, 33, 
+	-64, 55, 55, -21, 125, -72, -73, -119, 
+	132, 42, -250, -87, 5, 59, 5, -101, 
+	77, 139, -57, 95, 166, 141, 70, 59, 
+	73, -12, -23, -44, 59, 103, 83, 43, 
+	129, 26, -183, 59, 84, 10, 75, -133, 
+	-96, -6, 15, 8, 33, 54, 67, 182, 
+	-154, 126, 95, 35, -62, -41, 14, -67, 
+	-8, 32, 60, 163, -17, 10, 14, 48, 
+	28, -47, 134, 29, 111, -59, 5, 178, 
+	-42, -15, 30, -38, -96, 44, 42, -23, 
+	-39, 50, -81, 89, 1, -85, 74, -173, 
+	-9, -84, 41, -2, -55, 168, -69, -30, 
+	-61, -23, -151, 38, 130, 42, 79, 58, 
+	-42, 19, 91, 137, 5, -99, 62, -18, 
+	-9, 141, -22, -84, 74, -29, 119, 48, 
+	47, 25, -57, -53, 55, -31, -28, -46, 
+	-94, -5, 29, 84, -68, 45, -88, 18, 
+	-39, -55, 143, -24, 6, 32, 53, 5, 
+	75, -58, 157, 4, 110, -110, 73, -131, 
+	23, -34, -158, -14, -22, 37, -72, -37, 
+	23, 141, -32, 64, -59, 107, 40, -44, 
+	44, 246, 4, -45, 61, 44, 63, 101, 
+	102, -125, 59, 42, -81, -26, 85, 116, 
+	65, -43, -11, -184, -27, 25, -12, -12, 
+	27, 9, 125, -3, 13, 23, 143, 126, 
+	12, -96, 4, -8, 52, -92, 42, -31, 
+	58, -15, 74, 96, -120, 207, -101, -128, 
+	-7, -18, 80, -136, -65, -91, -3, -11, 
+	-3, -94, 189, 127, 40, 1, -108, 105, 
+	142, -24, 219, -62, 19, -110, -1, -151, 
+	31, 9, -43, -251, -16, 116, -272, 51, 
+	-73, 129, 8, 99, -27, -160, -123, 52, 
+	16, -42, -10, -98, -127, -27, -77, -37, 
+	-96, 78, -183, -71, 72, -91, -40, -11, 
+	-22, -201, 72, -41, 26, -58, 112, 21, 
+	-7, -183, 36, -1, 21, -27, -70, 95, 
+	-131, 84, 33, 34, 16, 107, -29, 64, 
+	120, 12, 99, 36, -19, -24, 19, 20, 
+	66, -18, -79, -179, 34, 43, 22, 46, 
+	133, 30, 74, -206, -67, 64, 43, -44, 
+	94, -5, -80, -88, -80, -65, 11, -184, 
+	-38, 47, 121, -10, -202, 110, -23, -44, 
+	97, 64, -89, 88, -80, 39, 38, -61, 
+	-30, -29, 11, -113, 10, 70, 110, -12, 
+	28, -143, 87, 41, -74, 68, 32, 32, 
+	-48, -14, -28, 42, -107, -116, 85, 13, 
+	3, -86, 39, 110, 3, -129, 57, -94, 
+	113, -118, 81, -87, 104, -59, -89, 66, 
+	65, 4, -15, 16, -175, -42, -27, -9, 
+	21, -16, -35, 70, -190, 58, 21, -65, 
+	-3, 24, -137, -39, -28, -56, 3, 9, 
+	33, -123, -111, 66, -81, -34, 7, 32, 
+	21, 7, -7, -78, 7, -3, -117, -72, 
+	-16, -34, -61, -39, 18, 24, -39, -22, 
+	-97, -83, -67, -104, 75, 16, -13, -30, 
+	-98, -117, 41, -14, -72, -86, -4, -29, 
+	33, 7, -4, -1, 8, -64, 13, -27, 
+	-54, 29, 57, -94, 43, 22, 81, 80, 
+	-9, -81, 20, -38, -48, -1, -114, 28, 
+	-75, -16, -29, -16, 68, -36, -25, 19, 
+	-120, -59, -70, -11, -20, -117, 2, -69, 
+	-81, -95, -96, -10, 1, -83, 55, 8, 
+	11, -6, -25, -76, -1, -27, -22, 24, 
+	-41, 34, 58, 33, -81, -31, 36, -46, 
+	45, 63, -82, -103, 61, 38, -20, 17, 
+	-40, -41, -39, -46, -83, -111, -42, 62, 
+	-97, 12, -80, -65, 36, 4, -109, -64, 
+	9, -81, -19, -48, 14, 89, 15, 20, 
+	-19, -123, -33, -94, 11, -57, 4, 88, 
+	-11, 3, 41, 2, 25, -86, 9, -73, 
+	1, 51, -68, 78, 55, 54, -27, -114, 
+	-43, -4, -88, 35, 14, -42, -22, 48, 
+	-13, -37, -44, 60, -84, -41, -32, 23, 
+	-8, -42, 17, -35, 50, -7, 30, -99, 
+	-66, 12, -6, -81, -82, -103, -30, -99, 
+	-89, 7, 33, 62, -115, 62, 60, 34, 
+	-22, -3, 64, 43, 59, -73, -55, 10, 
+	-37, -46, 75, 21, -109, -86, 28, 21, 
+	-45, -123, -35, -31, 63, -42, -57, 39, 
+	-18, 6, -16, -82, -104, -109, 64, 83, 
+	-69, -61, -39, -89, -17, 12, -91, -68, 
+	-15, 49, -88, -84, -104, 88, -30, -83, 
+	-70, -18, -3, -71, -39, 10, -22, -114, 
+	13, 21, 37, -2, -107, -3, -82, 30, 
+	72, 41, -23, 49, 35, -58, -4, -13, 
+	-121, -69, -41, 3, -3, 17, 19, -20, 
+	-47, -37, 77, -48, 41, -55, -94, -52, 
+	-26, 24, -115, -75, 36, -61, -101, -37, 
+	-116, -57, -86, -12, -94, -22, -75, -80, 
+	61, 47, -70, -91, 13, -15, 56, 10, 
+	-50, 51, 60, -28, -58, 0, -4, 49, 
+	-73, -28, -10, -41, -43, -91, -107, -5, 
+	22, -27, 30, 20, -54, -56, -108, -50, 
+	-77, -19, -114, -119, -8, -33, -33, -9, 
+	0, -45, -7, -19, 6, 62, 9, -17, 
+	-38, -3, 32, -58, 60, 34, -76, -24, 
+	-20, 33, -64, -41, 82, -26, 8, -4, 
+	-19, -33, -34, -84, -53, -58, -4, -52, 
+	-82, -105, -51, 12, -75, -87, 29, -56, 
+	-69, -13, -59, 42, -16, 10, 84, -19, 
+	35, 50, -51, -60, -24, 5, 3, -40, 
+	36, -88, -7, -23, -104, -45, 26, 11, 
+	85, 36, -50, -113, -67, 27, -16, 0, 
+	-41, -42, -85, 67, -86, 4, 35, -43, 
+	28, -14, -76, 46, -119, 51, 51, -4, 
+	42, 25, 87, -1, 84, -96, 10, -65, 
+	-57, 35, -70, 54, 75, -111, 84, -12, 
+	-40, -7, -82, -95, -69, 50, -19, 22, 
+	-121, -27, 61, 47, 50, -49, -117, -98, 
+	71, -19, 9, -81, -89, -13, -46, 63, 
+	-96, -68, -55, 58, 39, -87, -72, 25, 
+	-13, -77, 19, -38, -28, -8, -43, -114, 
+	-15, -16, -40, 41, -96, 27, 43, -59, 
+	-33, 89, 3, -62, -60, -4, -57, -50, 
+	-84, -93, -76, -26, 62, -58, 42, 54, 
+	63, 54, -62, -68, -18, -80, -18, -16, 
+	-19, -59, 16, -99, -32, -60, 72, -18, 
+	46, -117, -115, 54, -28, -43, 42, -60, 
+	53, 7, 11, -80, -14, -29, -70, -5, 
+	-40, -55, -56, 73, -69, -79, -42, -76, 
+	-32, 12, -41, -24, 10, -66, -2, -33, 
+	-51, 85, 61, 7, -5, -13, -91, 60, 
+	-3, -99, -11, 59, -58, -63, -24, 37, 
+	-82, -2, 65, 84, -57, -21, 36, -105, 
+	42, -13, 0, 154, 118, -151, -67, -108, 
+	-135, 107, -83, 114, 37, -69, 115, 67, 
+	57, -87, -49, 74, 69, -23, -68, 46, 
+	-135, 75, 26, -84, 130, -57, 10, -22, 
+	68, -235, 147, -63, -74, 38, 52, -93, 
+	69, -79, -19, 72, -6, 59, 68, -72, 
+	-10, -166, -115, 16, 6, -109, 16, -147, 
+	53, 108, -58, -24, -80, 71, -28, 191, 
+	102, 0, 33, 40, 33, -187, 79, 15, 
+	-14, 67, 183, -1, 61, 24, -24, 85, 
+	-156, 148, 206, 161, 18, 17, -54, 97, 
+	-73, 39, -15, 140, 320, 0, -24, 52, 
+	-23, -65, -43, 53, 35, 107, -34, 82, 
+	7, 129, 49, -33, -72, -2, 76, 211, 
+	84, 18, 124, -100, -13, 54, 32, -27, 
+	-135, 175, 15, -65, 24, -77, -43, 150, 
+	-95, 94, 118, -60, -145, 156, 79, -201, 
+	127, -68, 49, 35, -17, -16, -9, -101, 
+	44, -60, -3, -2, -133, -62, 14, -85, 
+	-77, 72, -18, 142, -65, -55, -2, -10, 
+	9, 128, -238, 23, -50, 96, 51, -23, 
+	-24, -33, 264, -56, -41, -37, -59, 97, 
+	-77, -170, 6, -13, 60, -19, -50, 224, 
+	-52, -132, -58, -25, 53, 16, -75, -93, 
+	-20, -24, 78, 72, -41, 131, 48, -30, 
+	65, -83, -28, 65, 55, 18, -11, -128, 
+	-41, -58, 57, 43, -5, 7, -41, -43, 
+	-64, -25, -6, 43, -63, -46, -77, -51, 
+	78, 10, 4, -14, -62, -19, 6, -54, 
+	4, -28, 77, 52, 56, 121, -58, -93, 
+	-16, 30, 55, -45, -28, -45, 90, 33, 
+	-49, 36, -76, -66, 2, 35, 154, -72, 
+	-20, -173, -33, -42, 83, 128, 91, 143, 
+	97, -129, 127, -74, 112, 6, 119, -34, 
+	-12, 183, -29, 62, 28, 51, -32, 45, 
+	58, 215, -1, 100, -35, -116, -24, -4, 
+	153, 117, -27, 32, -92, -66, 22, 17, 
+	61, 70, -10, 53, 32, -48, -81, -113, 
+	25, 5, -42, 20, 35, 74, 14, -157, 
+	-24, 37, 62, 75, 70, 30, 97, -99, 
+	48, -10, -103, -73, -26, 70, 56, 56, 
+	96, -185, -49, 67, -42, -32, -28, 24, 
+	38, -245, -53, -91, 114, -115, 200, 25, 
+	130, -128, -51, -190, -12, 76, 65, 18, 
+	-78, 105, 92, -216, -122, -87, -72, -101, 
+	-32, -202, 251, 67, -118, 48, 15, -70, 
+	-36, -7, 86, -92, 37, -75, 124, -96, 
+	111, -33, -4, -49, 54, 78, 42, -9, 
+	-51, 216, -48, 92, 6, -29, 13, 4, 
+	39, 29, -82, 19, 17, -8, -110, -22, 
+	10, -84, 28, 45, 46, -10, 87, 63, 
+	-62, -7, -21, 29, 139, 50, 57, 11, 
+	-23, 65, 66, -97, 49, -4, 84, 14, 
+	-129, -29, 66, -59, 95, -59, 26, -14, 
+	107, -113, -18, 126, -39, 81, 79, -36, 
+	6, -61, -114, 53, -26, 29, -80, 59, 
+	81, 68, -55, -29, -54, 127, 81, 254, 
+	-11, -30, -115, -14, 103, 80, -67, 146, 
+	-51, 21, 31, 30, 137, 142, 26, 135, 
+	103, 131, 44, 38, -38, -79, -1, -100, 
+	38, 26, 12, 38, 84, -47, -95, 154, 
+	-142, 9, 14, 19, 122, -134, 23, 86, 
+	48, -39, 66, -18, 59, -4, -77, 173, 
+	-44, 23, 121, -96, 82, 115, -4, -114, 
+	74, 194, -66, 102, -40, -79, -58, 19, 
+	-12, 153, -16, -32, 97, 46, -32, 33, 
+	28, -33, -19, -63, -31, 61, -74, 95, 
+	-52, 107, -60, 34, 92, -9, -49, -64, 
+	30, -43, 116, 53, 156, 108, -1, 78, 
+	-66, 55, -141, 33, 59, -9, -25, -17, 
+	193, 6, -93, 30, 0, 146, -54, -58, 
+	29, -61, -41, -35, -65, -91, -26, 81, 
+	-81, 52, -81, -29, 39, -29, -11, -28, 
+	34, -6, -61, -90, 17, -100, 12, -115, 
+	-61, -53, 42, 1, -55, -62, -34, -72, 
+	66, -86, -25, -108, 77, -45, -80, -46, 
+	-109, 52, -112, -91, -41, -35, 20, 7, 
+	37, -78, 56, 23, -64, -55, -73, -61, 
+	-120, 66, -49, -54, 62, -16, -29, -18, 
+	-6, -46, 34, -42, -52, -46, -61, -73, 
+	51, -1, -44, -59, -5, -24, -57, 46, 
+	19, -65, -69, -8, -87, 25, -88, -8, 
+	51, -69, 20, 19, -17, 15, 33, 50, 
+	14, -54, -23, -6, 64, -96, -5, -92, 
+	-82, 60, -23, 34, 12, -19, -118, 82, 
+	-29, -59, -61, -19, -51, 82, -62, -48, 
+	-32, -24, -83, 17, -31, 3, -24, -102, 
+	-76, -89, -72, -98, -60, -1, -61, 20, 
+	-115, 36, 33, -18, -13, -40, -62, -120, 
+	-74, 7, -11, 51, -60, -89, 28, 56, 
+	2, 17, -133, 67, -62, -88, -68, 62, 
+	42, -71, 66, -56, -16, 31, -17, -69, 
+	56, -18, -66, -97, 40, -67, 79, -123, 
+	-56, 25, 80, -106, -70, -56, -108, 20, 
+	27, 38, -124, -9, -2, -87, -15, 27, 
+	-6, 12, -103, -90, 61, -104, 21, 40, 
+	-66, -88, -9, 53, -55, -90, -43, 109, 
+	-44, -65, 72, -45, -68, 57, -14, -67, 
+	14, -31, -3, -37, 9, 13, 61, -109, 
+	20, 14, -113, 81, 61, 41, -87, -75, 
+	-1, -82, -71, 29, -11, 15, -33, -7, 
+	-57, -82, 27, 29, 5, -12, -97, -40, 
+	90, -6, 50, -89, 53, -25, -60, 31, 
+	-26, 35, -26, -45, -10, 6, -22, -14, 
+	-128, -31, -35, 22, -71, -45, 62, 69, 
+	-63, -55, 31, -116, -17, -12, 84, 14, 
+	43, -111, 2, -129, -60, 46, -3, -15, 
+	42, -130, 6, 26, -48, -88, -45, -104, 
+	-8, -28, -33, -10, 53, -46, 40, -27, 
+	67, -57, -43, 42, 44, -51, -24, 39, 
+	51, 70, -62, 31, -47, -69, -131, -93, 
+	32, 38, 68, 66, -11, -121, -47, -9, 
+	5, -8, 3, -122, -114, -86, 27, -43, 
+	-8, -4, -11, -80, -11, 50, -53, 19, 
+	-37, -36, -35, -97, -89, -78, -84, 52, 
+	15, -73, 56, 56, 89, 23, -25, -46, 
+	-69, -84, -68, -50, -16, -90, -113, 48, 
+	-25, 52, -46, 2, -60, 2, 72, -106, 
+	16, 34, 2, -4, -119, -17, -77, -75, 
+	-46, -59, -91, 58, 52, -106, -67, 30, 
+	-97, -50, -18, -43, -44, -45, -43, 6, 
+	69, 16, -3, 31, 30, -97, -34, 2, 
+	-68, -36, -49, -21, -31, 71, 127, -22, 
+	-39, 26, 33, -117, -39, -76, 33, 90, 
+	-85, -13, 44, -79, -3, 20, -24, 72, 
+	29, 23, -59, 14, -77, 29, -56, -11, 
+	-8, 54, 66, 10, -54, 31, -109, -80, 
+	40, 88, 76, -93, -109, -9, -64, 52, 
+	-73, 9, -66, -28, 57, 24, -89, 6, 
+	-28, 16, -11, -4, 4, -51, -16, -103, 
+	-7, -121, -77, -1, 57, -123, -38, -6, 
+	2, 48, -65, -23, -31, -29, -43, 15, 
+	-62, -109, -67, -6, 65, -75, -33, -30, 
+	30, -95, 53, 41, -98, -69, -9, -72, 
+	-116, 7, 9, -8, -63, -97, 73, 56, 
+	52, 95, -27, 41, -14, -104, -19, -102, 
+	-25, 64, 49, -77, 48, 17, 62, 16, 
+	-6, 85, -35, 46, 30, 18, -26, 86, 
+	33, -31, -1, 31, -21, -65, 31, 21, 
+	-74, -5, -42, -29, 26, -27, 69, -42, 
+	16, 15, 53, -58, -93, -71, -83, 45, 
+	-119, 52, 65, -98, -6, -55, -85, -44, 
+	-61, -88, -84, 42, 8, 83, -33, 51, 
+	74, -15, 45, 18, -51, -88, -106, 70, 
+	-14, 1, 43, -63, -48, -94, 13, -114, 
+	-24, -121, -60, 40, -10, -98, -39, 36, 
+	20, -31, 61, -53, -31, 5, -118, -104, 
+	17, -68, -26, -93, -99, 17, -46, 35, 
+	-37, -32, -42, -60, -27, 6, -2, 21, 
+	33, 7, -23, -66, 4, 29, -62, -8, 
+	57, -8, -23, -26, -36, 38, -38, -34, 
+	-62, 9, -69, -1, -46, -60, 24, 14, 
+	-119, 49, -56, -20, 50, 5, -43, -39, 
+	-61, -77, -10, 7, -94, 11, 57, 15, 
+	-78, -58, -97, -114, 4, 41, 10, 18, 
+	-61, -65, 57, 58, 59, 5, -116, -121, 
+	-64, -66, 16, -103, 13, -86, -28, 61, 
+	25, -12, 78, -80, -6, -85, -13, -1, 
+	-47, -27, -83, 49, -49, -31, -75, -97, 
+	-76, 6, 14, 67, -12, -112, -109, -92, 
+	-98, -105, -66, -93, 74, 58, 64, -46, 
+	21, -13, -21, 44, 23, 72, -42, 34, 
+	-28, -36, -100, -103, 77, 72, -4, 38, 
+	33, -69, 88, -69, -92, 26, -16, -90, 
+	-17, -21, 49, 26, 32, 60, -41, 25, 
+	11, -5, -37, -79, -80, -15, 55, -32, 
+	-41, -100, 59, -15, -59, -85, 47, -69, 
+	-20, 43, -31, -100, 73, -78, -32, 28, 
+	-62, -6, 3, -112, 31, -73, 5, -37, 
+	-77, 17, -84, -119, 1, 85, 65, 70, 
+	-108, -39, -81, -53, -88, -22, -96, -76, 
+	51, -15, -41, 77, -92, -20, 62, -28, 
+	65, 12, 9, -44, 75, -29, 29, -49, 
+	-5, -18, 88, -14, 16, -43, -39, 9, 
+	-21, -47, -16, 4, -7, 51, 20, -42, 
+	3, 43, 59, 3, -64, 64, -74, -106, 
+	30, -42, 45, -40, 20, 68, -31, 31, 
+	9, -117, 36, 86, -36, -3, -60, 64, 
+	-79, -30, -119, -16, -66, 82, 8, -66, 
+	-23, 33, 64, 6, 59, 8, 87, -93, 
+	29, -13, -103, 42, 75, -41, 68, -62, 
+	-51, -13, 78, -67, 28, -21, -2, -45, 
+	-89, -99, 6, 12, 62, -61, -45, -68, 
+	31, 25, -45, -83, -40, -92, -29, -65, 
+	-91, 48, 41, 31, -16, -70, -46, 2, 
+	-17, 29, -28, 81, -11, -2, -95, -104, 
+	-42, -23, -48, 40, -82, 33, -41, -67, 
+	12, 70, 41, -97, -24, 17, -12, -60, 
+	17, 6, -67, 49, -55, 80, 76, -2, 
+	-1, -68, 72, -22, -55, -1, 76, 18, 
+	-69, -77, 34, -93, -91, -33, -91, -80, 
+	-16, -38, -78, 28, -82, -26, -74, 14, 
+	-81, 35, -75, -20, 50, -28, -5, -50, 
+	51, -95, -65, -61, 51, 39, -6, 28, 
+	-18, -107, 17, -8, 12, 67, 61, 75, 
+	-1, 53, -91, -20, -18, -31, 1, 14, 
+	-18, -68, 45, -37, 22, -51, 60, -112, 
+	58, 60, 43, 28, -33, -82, -9, 65, 
+	-38, -118, 33, -47, -31, -26, -36, 24, 
+	-99, -13, 32, -14, -55, 45, -102, -13, 
+	-109, -38, 85, 0, -47, -109, 52, -64, 
+	14, 17, -14, -80, -109, 51, -82, -2, 
+	-33, -65, -42, 37, -70, -53, 77, 30, 
+	-10, -7, 52, 72, -52, 32, -114, -2, 
+	-80, 35, -49, 39, -69, -3, -84, 25, 
+	-51, -54, 46, -15, 16, -78, -15, -65, 
+	40, -1, -11, -57, 47, -40, 31, 25, 
+	1, 23, -94, -47, -71, -47, 14, -16, 
+	52, -22, -23, 65, -89, -19, -64, -98, 
+	-64, 1, 33, 23, -73, 15, 0, -84, 
+	-5, -16, -82, 44, -63, -108, -73, 70, 
+	68, -18, -75, 32, 8, -18, -85, -70, 
+	24, -61, -10, -80, 37, -34, 49, -28, 
+	-104, -60, 26, -92, 41, 75, -47, -13, 
+	-64, -78, -93, 57, 52, 33, -61, -77, 
+	-42, 17, 98, 83, 28, -166, -22, 73, 
+	28, -90, -59, 54, -70, -97, 80, -73, 
+	-184, -26, -11, 64, -30, -2, 132, -22, 
+	62, 61, -50, -9, 14, -58, -98, 73, 
+	-118, 131, 27, -127, -4, -28, 4, 59, 
+	-33, 116, 29, 29, 82, 65, -93, -113, 
+	75, -26, 31, -87, -40, -76, -2, -59, 
+	42, -5, -121, -85, -20, 19, 59, -89, 
+	-119, 124, -169, 116, -102, 49, -9, -58, 
+	-37, 68, -45, 134, 58, 25, -79, -126, 
+	71, 98, -2, 25, 21, -122, -105, 140, 
+	-118, -95, -40, 12, 5, -195, 13, 118, 
+	-30, 150, -106, 34, 217, -44, 61, 99, 
+	-27, -98, 93, 80, -8, 139, 123, 11, 
+	83, -45, -73, -50, 21, -43, 87, 16, 
+	-42, -104, 65, 133, -59, -47, 54, 74, 
+	-13, -72, 58, 22, 37, -51, -30, -49, 
+	-152, -43, 66, 45, 67, -83, 4, -106, 
+	-25, -57, 3, 83, 61, -52, 15, 93, 
+	-53, -16, -37, 24, 51, -117, -7, -55, 
+	-142, 3, -94, -80, 101, -44, 25, 108, 
+	-78, -49, -35, -111, -48, -70, 15, 82, 
+	-48, -22, 252, -44, -13, 95, -11, 17, 
+	-96, -164, 101, 52, -124, 8, -109, 36, 
+	27, 96, -100, -2, 42, -92, -10, -5, 
+	-80, -73, 14, 60, -23, 46, 27, -88, 
+	-27, -27, 43, 28, 69, -101, 87, 12, 
+	-71, 137, 18, 76, -25, -148, -70, 72, 
+	47, -22, 32, 21, 119, -44, -54, -13, 
+	61, 92, 38, 7, 32, 36, 118, -84, 
+	-37, 29, -73, 121, -9, -38, 90, 58, 
+	91, -58, 18, -52, -9, -26, 59, 94, 
+	45, -16, -40, -28, -38, 104, 6, 103, 
+	78, -160, 150, 170, 96, -60, -85, 33, 
+	-22, -81, 2, 45, -86, -10, 21, 32, 
+	24, 48, 78, -12, -52, 11, -28, 31, 
+	-37, -32, 7, 55, 184, -3, 87, 59, 
+	91, 91, -65, 77, -37, -38, -35, 43, 
+	23, -40, -122, 62, -56, 7, 58, 94, 
+	-130, -62, 4, 117, -78, -51, 122, 12, 
+	11, 3, 83, -10, -93, -31, 79, 53, 
+	-35, -32, 139, -16, 77, -36, 68, 85, 
+	111, -132, -63, -64, -61, -95, -66, -31, 
+	19, 62, -123, -9, 40, 147, 7, -46, 
+	-7, 117, 75, 104, 47, -18, -28, 51, 
+	103, 74, -101, -85, 50, -13, 24, -14, 
+	-25, 71, 60, -98, 64, 30, -76, -34, 
+	-51, -67, -57, 43, -2, -122, 35, -28, 
+	0, 20, -94, -136, -13, 76, -1, 18, 
+	-26, -34, -9, 20, -16, -20, -57, -7, 
+	-188, 71, 79, -67, 32, 31, -74, 12, 
+	124, 130, 40, 60, -67, -104, -7, 36, 
+	-117, -3, -148, 46, -49, -80, 65, -76, 
+	1, -83, -72, 13, -53, 89, -46, 45, 
+	-31, 16, 188, -34, 131, 48, -13, 42, 
+	67, -124, -11, -19, -176, -24, -47, -34, 
+	-51, -123, -57, -63, -82, -18, 102, 102, 
+	62, -14, -16, 95, 46, -214, -79, -81, 
+	-30, -40, 157, -51, 95, -78, 95, 82, 
+	-95, 66, 72, 89, 51, -10, 75, -17, 
+	-63, 59, -81, 329, -99, 28, 77, 29, 
+	39, -74, 81, -130, -6, 62, 59, 8, 
+	-21, -12, -111, 90, 131, 73, -4, 195, 
+	0, -132, 160, -137, 12, -36, -11, 149, 
+	124, 47, -103, 56, 86, 31, 84, 79, 
+	46, 23, 26, 30, 25, 108, 70, -78, 
+	-43, 28, 112, 8, 99, 132, -57, 21, 
+	-82, 37, 126, 48, -47, 19, 34, 58, 
+	90, 92, -28, 112, -47, 102, 25, -79, 
+	67, 14, -26, 41, 14, 32, -25, 62, 
+	-38, 94, 83, 38, 161, 9, -25, 28, 
+	31, 24, 94, -41, 2, 148, 63, 92, 
+	106, -20, -23, 102, 32, -22, -33, 0, 
+	-99, 146, 19, -9, 13, 161, 72, -28, 
+	89, -118, 56, -83, -96, 84, 36, 14, 
+	37, 28, -92, -190, -30, 52, 4, -43, 
+	236, -72, 12, -146, -68, -95, -19, -26, 
+	-31, 42, 56, 96, 1, -77, -50, -67, 
+	-24, 66, -162, -68, 17, 12, 18, -18, 
+	-102, 152, 56, 85, 149, 58, 10, 9, 
+	70, -178, 193, 22, 51, 52, 7, 45, 
+	75, 134, 152, -241, -173, 89, -140, 11, 
+	-106, -117, 56, 55, -64, 63, -25, 13, 
+	30, -52, -78, -62, 101, -59, 120, -149, 
+	25, -206, 19, 33, -62, 23, 115, -162, 
+	-107, 64, -6, -48, 106, -71, -247, -78, 
+	-153, -69, 47, 76, -42, 48, 131, -164, 
+	-7, 151, -145, -111, -74, 96, -80, -59, 
+	140, -21, 150, 51, 96, 9, -54, -82, 
+	89, 111, 7, 6, 79, -209, 113, 170, 
+	5, -20, 78, 123, -66, -23, -23, 50, 
+	26, 34, -147, 29, -22, -42, -21, -148, 
+	30, -46, -63, 85, 239, 86, -124, 55, 
+	-47, 33, 104, -64, 38, 9, 57, -51, 
+	69, 10, -32, -17, -68, -47, 67, -15, 
+	-76, -4, -4, -166, -112, -125, 101, -126, 
+	94, 63, -132, 91, -149, -199, -167, -104, 
+	16, -23, -89, -30, -82, -9, 96, 12, 
+	40, 17, -11, 38, -27, 29, 59, -50, 
+	109, -49, -124, -101, 145, -53, 27, -46, 
+	11, -38, 65, -41, -85, -36, 24, -39, 
+	49, 89, -16, 42, 22, -26, 125, 88, 
+	32, 28, 84, 68, 2, -112, 88, 40, 
+	-5, 114, 58, 128, 59, 79, -50, -108, 
+	-60, 24, 43, -106, -119, 10, -126, -139, 
+	-33, 34, 52, -3, -47, -50, 91, -74, 
+	18, -39, -146, -13, 75, 22, -156, -55, 
+	90, -172, -89, -52, -14, -25, 19, 132, 
+	-113, -131, -93, -24, -71, 81, 76, -100, 
+	-151, 14, 41, 17, 86, -78, -9, -111, 
+	-80, -67, 11, -95, -110, -130, 106, 100, 
+	86, -16, 120, -100, -16, -32, 46, -99, 
+	-51, -98, -70, -24, -93, -36, 38, 27, 
+	-73, -33, 44, -50, 75, -95, -114, -17, 
+	19, 135, 196, -37, 101, -114, 30, 80, 
+	20, 6, 176, 12, 22, -139, -120, -26, 
+	-82, 85, 7, 210, 139, -144, 31, 92, 
+	88, -5, 68, 43, -47, 66, 97, 141, 
+	52, 147, 117, 37, 201, 54, 37, 125, 
+	139, 24, -13, 21, -11, -178, 81, 62, 
+	-171, -49, 115, 196, -16, 24, 33, 48, 
+	-143, -179, 3, 53, 35, 23, -53, 62, 
+	3, -60, 29, -67, 59, -65, 78, 31, 
+	87, 36, -170, -95, -11, -100, -126, 63, 
+	84, -10, -85, -123, 20, -76, -61, -42, 
+	-34, 25, 68, 129, 0, -120, 56, -31, 
+	80, -7, 91, 32, -101, 134, 4, -104, 
+	-101, 9, 105, -90, 22, -38, 21, 27, 
+	-109, 146, -18, -21, 47, -36, 83, 8, 
+	-89, -11, 33, 178, -82, -60, 16, -125, 
+	70, 29, -97, -100, -7, -78, 0, -3, 
+	192, 126, 83, 107, -114, -235, 14, -130, 
+	85, -79, -91, 107, 79, 70, 18, -14, 
+	35, 9, -165, -109, 88, 144, -36, 38, 
+	44, -67, 59, 75, 58, 56, -70, -46, 
+	-92, -31, -39, 242, -108, 110, -53, 43, 
+	-119, -10, -150, -169, 4, 21, 227, 88, 
+	-7, -73, 89, -104, -8, -219, 2, 76, 
+	-6, 19, -49, -29, 61, -191, -152, 79, 
+	-170, 17, 106, 141, 55, -27, -7, -14, 
+	-183, 60, 66, 232, 10, -175, 90, 106, 
+	7, -104, -28, -43, -238, -119, -66, 149, 
+	-96, 109, 42, -101, 90, -20, -7, 29, 
+	60, -28, -33, 105, 4, -74, 32, 185, 
+	34, -42, 36, -6, -15, -12, -47, 0, 
+	15, 37, -69, -78, 68, -48, -2, -6, 
+	-65, -139, -6, 168, -46, -47, 98, 50, 
+	45, -30, -92, 15, -93, 0, 28, -86, 
+	-10, -93, -136, 27, -45, 36, -93, 2, 
+	61, 101, 33, 51, 44, 48, -49, -86, 
+	144, -17, 127, 49, -56, -44, 59, -31, 
+	-105, -58, 27, 92, -38, 24, 32, 1, 
+	116, 103, 2, -56, -26, 73, 11, 26, 
+	-36, 77, 63, 92, 41, 110, 27, 53, 
+	14, 140, -30, 21, -54, 0, 146, -15, 
+	-132, 115, 1, 92, -120, -21, -81, -86, 
+	73, -6, 58, 3, -120, -58, -3, 13, 
+	25, 181, -87, 95, -8, -94, 63, -18, 
+	20, -48, -151, 46, 16, -41, 68, -104, 
+	114, -12, -1, 66, 62, -25, 24, -44, 
+	105, 131, -62, 97, 106, 59, 112, 38, 
+	-72, 77, -120, -31, 96, -111, -65, 149, 
+	-102, 73, 135, 89, 72, 93, 107, 2, 
+	57, -35, 76, 134, 176, -22, 117, 30, 
+	94, 81, -40, 82, 67, 174, 68, 92, 
+	50, 139, -20, -72, 62, 101, -20, 88, 
+	16, 11, 72, 91, 75, -156, 20, -73, 
+	10, 88, 38, 52, -64, 68, -5, 47, 
+	45, -38, -234, 36, 30, -131, -35, -34, 
+	59, 128, 161, 99, -50, -9, -14, 27, 
+	-78, 31, 73, -89, 62, -20, 87, -10, 
+	-89, -68, -13, -111, -40, 62, -70, 27, 
+	-122, 129, -36, -20, -88, -175, -26, -66, 
+	65, -52, -117, 116, 46, -86, -102, -52, 
+	-89, 110, 124, -74, -23, -106, 120, 79, 
+	1, -128, 16, 31, -62, 47, 29, 27, 
+	-13, -119, -71, -39, -8, 57, -22, 43, 
+	67, -15, 8, 36, -35, 51, 40, 157, 
+	-32, -20, 91, -23, 119, 137, 62, 101, 
+	57, 52, -50, -90, 69, 140, -119, 90, 
+	111, 168, 94, -84, -94, 11, 35, 62, 
+	37, -86, -93, -150, 66, -74, -104, 130, 
+	8, 29, 14, -30, -44, 50, 33, -134, 
+	-78, -8, 54, -69, -6, -20, -59, -86, 
+	-79, 1, 115, -143, -18, 137, 18, 11, 
+	6, -98, 90, 61, -79, 10, 132, 25, 
+	-2, -163, -106, 89, -11, -27, 82, 68, 
+	95, -49, 40, 113, 14, -102, 36, 29, 
+	104, 41, 20, 83, -134, -54, -105, 110, 
+	52, 2, -84, 131, -110, 28, 52, 28, 
+	166, -137, 310, 86, -14, 151, 54, 122, 
+	-37, 35, -7, -13, 66, -253, 97, 20, 
+	-83, 125, -196, 124, -97, 6, 89, 92, 
+	-36, -19, 139, -40, 9, -12, -46, -16, 
+	-69, 97, 155, -20, -29, -29, 97, 35, 
+	-109, -70, -18, 19, 64, 66, -47, -32, 
+	44, -49, -18, -7, 71, 6, 19, -35, 
+	111, -1, 36, 12, -87, 22, -150, 37, 
+	-24, 85, -77, -24, -37, -110, 155, 21, 
+	48, -89, 43, -38, -57, -59, 181, -7, 
+	59, 40, 68, 45, 190, -34, 183, -130, 
+	57, -20, 131, -48, -45, -33, -70, 61, 
+	97, -111, -112, -128, -107, 77, 69, 54, 
+	-56, -2, -29, 29, -30, -10, 134, -28, 
+	-39, -7, 70, -55, 200, 5, 116, -98, 
+	-4, 7, -116, 41, 120, 34, 3, 152, 
+	-64, 98, 139, -108, 130, -32, 156, -14, 
+	23, 49, -124, 20, -58, 69, -48, 78, 
+	-1, -198, 149, 103, 138, 118, 43, 106, 
+	159, 9, 51, -37, -175, -87, -13, 204, 
+	109, -249, -34, 34, -239, 1, 40, 49, 
+	-79, -10, 46, -95, 107, -64, 98, -97, 
+	143, 24, -127, 65, 53, -39, 139, -124, 
+	-66, -18, 51, -138, -102, 55, -22, 49, 
+	29, 9, -3, -14, 20, 49, -89, -78, 
+	111, 146, 146, -15, 223, 148, 17, -19, 
+	107, 105, -78, -18, -110, -154, -61, -105, 
+	-21, 28, -71, 103, -27, -110, 1, 4, 
+	-80, -94, 20, -5, -7, 52, -28, -67, 
+	-9, -37, 108, 12, 91, -62, 30, 35, 
+	3, 0, -24, -118, -145, 50, -10, 26, 
+	-1, 242, 38, 66, -51, -63, 34, -3, 
+	42, 146, -108, -109, -47, -90, 35, 43, 
+	75, -93, 10, 17, 149, 74, 37, -2, 
+	-107, 32, -132, 55, 16, -116, 14, -75, 
+	18, 124, 30, 100, 82, -68, -66, -132, 
+	-76, 4, -140, 42, 76, -72, -273, 107, 
+	0, -53, -1, -22, 15, -171, 144, -44, 
+	-73, 117, -106, 17, 51, 114, 83, 33, 
+	-13, -247, -105, 73, -26, 0, 24, -17, 
+	-24, -128, -119, -63, -67, -51, -31, 76, 
+	92, 49, -50, 27, 29, 64, -109, -99, 
+	-86, -64, 8, 31, 76, 45, -104, -33, 
+	42, -78, -23, -23, 41, -129, -7, -68, 
+	70, 43, 48, 63, 34, -149, -75, 149, 
+	-30, -58, -55, 127, -55, -42, 101, 37, 
+	-108, 175, -75, -169, 57, 80, -41, 27, 
+	40, 83, -78, 13, 59, 16, -18, 86, 
+	-6, -52, 99, -30, -116, -31, -22, -74, 
+	-146, -155, 83, -20, -79, -4, 60, -69, 
+	-3, 49, -4, 127, 67, 85, 104, 18, 
+	-17, -204, 34, 11, 150, -7, -49, -54, 
+	33, -70, 88, 177, -1, 37, 0, 69, 
+	-6, 135, -42, 98, -38, -75, -154, 116, 
+	-45, 82, -32, -62, 227, -90, 25, -13, 
+	0, 66, 169, 87, 59, 56, -9, 43, 
+	-61, -7, 26, 84, 77, 32, -13, -127, 
+	-33, -99, -51, -109, 14, -9, 18, 59, 
+	-85, -84, -98, -99, -2, -63, -6, 75, 
+	-98, 18, 21, -5, 63, -54, -102, -1, 
+	-72, -20, -42, -84, -86, -75, -5, -49, 
+	-36, 77, 29, -27, 75, 60, -44, -47, 
+	-22, -50, 1, 34, 151, 102, -50, 12, 
+	-90, 90, -42, 13, -22, -31, 3, 129, 
+	163, 16, 47, -74, -31, 94, 47, 121, 
+	-71, -7, 41, -60, -105, 17, -64, 156, 
+	107, 53, -47, -93, -140, -206, -91, -62, 
+	47, 75, 88, 42, -41, 74, -13, 98, 
+	60, -14, -97, -2, -30, 0, 40, -55, 
+	-31, 120, -29, 31, -56, 121, -42, -16, 
+	93, 129, 140, 67, 114, 3, 36, 8, 
+	1, 53, 34, -71, -45, 107, 74, 0, 
+	54, -8, 16, 43, -58, -135, -164, 54, 
+	45, -49, 14, -60, 79, 22, -154, 76, 
+	71, 50, -78, -78, 37, -2, 50, -44, 
+	-12, -70, 98, 44, 1, 38, -90, -24, 
+	-14, -18, 6, 54, -30, -83, -17, -39, 
+	158, 18, 82, -28, 65, -73, -133, 163, 
+	-113, 23, -132, -60, 60, -132, -139, 45, 
+	27, -104, 4, 40, 106, 31, 163, 46, 
+	-84, 43, 64, -69, 17, -57, 29, 96, 
+	-79, -96, -57, 13, 28, -110, 3, 55, 
+	-56, 19, -39, 120, 15, 122, -44, 135, 
+	119, 183, -152, 226, -7, -174, -16, -216, 
+	-31, 69, 64, 115, -15, -104, -8, 85, 
+	-70, 33, 62, 65, 53, 115, 120, 24, 
+	-140, 99, -137, 189, 63, 56, 39, 112, 
+	122, -13, -1, -30, 26, 68, 113, -17, 
+	-88, 91, -16, -21, -32, -53, -50, -129, 
+	-107, -115, -50, 32, -43, 58, 30, -69, 
+	-18, 94, -226, -29, -27, 80, -32, 36, 
+	-106, 34, -90, 20, 11, 54, 171, -211, 
+	-167, 35, 49, -72, 7, 104, -8, 37, 
+	-144, 112, 55, -2, 2, -14, 34, -71, 
+	-34, 238, 16, 73, 9, 58, 108, 23, 
+	32, 61, -104, -1, 63, -14, 168, 82, 
+	-53, -109, -2, -85, 153, 100, 3, 57, 
+	-162, -83, 32, 130, 74, 90, -71, 34, 
+	-18, 82, -140, -103, -102, 8, -89, -26, 
+	-50, 64, -77, 28, -4, -33, 15, 38, 
+	-85, 157, 19, -73, 38, -66, -131, -81, 
+	-58, -73, 140, 78, -59, -103, 37, 146, 
+	-76, -51, -122, 105, 22, -21, 74, 80, 
+	118, -130, 61, 127, -8, -10, 170, -41, 
+	-45, -79, -144, 86, 31, -125, -20, 155, 
+	84, -143, -54, 114, -25, -28, -58, 30, 
+	-9, -115, -99, -121, -168, -47, -151, 99, 
+	1, 26, 33, 13, -43, 22, -101, -10, 
+	-69, -5, -117, -30, 1, -88, 39, -159, 
+	-20, 53, 94, 32, -40, -148, -23, -64, 
+	13, 82, -3, 115, -65, -8, 15, -51, 
+	25, -136, 27, -84, -120, 42, -25, -63, 
+	8, -75, -9, 11, 97, -45, -53, 12, 
+	-35, -204, 2, 28, -10, -50, -18, 98, 
+	-70, -24, 104, -44, -117, 25, 4, 0, 
+	-105, -120, 82, -181, 32, 33, -58, 13, 
+	76, -186, -20, -72, -87, -103, 85, -155, 
+	-94, -84, -27, 29, -55, -11, -180, 67, 
+	45, 63, -35, -17, -13, -73, -15, -45, 
+	55, 128, 25, 108, -69, -69, -4, -114, 
+	-41, -40, 21, -70, -60, -4, -59, 110, 
+	-130, -110, -140, 90, 55, -136, -44, 34, 
+	-65, -184, 92, -80, -54, 40, -42, 7, 
+	-131, -135, 43, 68, -14, -80, 80, -115, 
+	108, -84, -13, -37, 12, 3, 41, -98, 
+	-32, 31, -10, -93, -60, -89, -51, -117, 
+	1, 35, 50, 18, -61, -44, -84, 153, 
+	-28, 36, 72, 1, 19, 40, 12, 20, 
+	96, -57, -84, -79, 51, 140, -48, -89, 
+	-17, -62, 26, -58, -80, -58, -91, 69, 
+	-175, -35, 107, 66, -71, 17, 38, -109, 
+	37, -181, -84, -16, -7, -80, -100, -81, 
+	56, -139, 26, -138, -70, -38, 147, -79, 
+	-23, 44, -19, -8, -111, 62, 7, -9, 
+	117, -33, 100, -164, -37, -42, 27, 70, 
+	20, 45, -30, -157, -187, 8, -163, -18, 
+	43, -182, -59, -59, -124, -14, -216, 11, 
+	-141, -83, -35, 154, -119, -37, -86, -67, 
+	-126, -34, 50, -107, 106, -86, 87, -20, 
+	47, 3, 85, -82, -122, -126, -24, -95, 
+	16, 8, -155, -104, -103, -57, 15, 47, 
+	-60, 4, -13, -195, -114, 143, -83, -76, 
+	118, -140, -5, -118, 70, -63, 59, 4, 
+	56, 27, -17, 15, 18, -157, -127, -5, 
+	22, -115, -2, -46, 2, 3, 7, 25, 
+	-23, -136, -66, -67, -27, 50, 34, 13, 
+	-98, 67, 187, -69, 56, 14, -84, -85, 
+	-129, -67, -30, -218, -67, -97, 88, 51, 
+	85, -116, -157, -62, 16, -96, 5, 20, 
+	-55, -83, 31, -84, -3, -55, -16, -10, 
+	8, -67, 68, -78, 130, -50, 128, -63, 
+	-88, -31, -41, -76, 35, 37, 42, -167, 
+	9, -62, 8, -20, 17, -163, -3, -43, 
+	-82, 98, -24, -62, 94, 18, 5, -36, 
+	-65, 75, 59, 63, -137, -91, -64, 52, 
+	-75, 226, 117, -156, -80, 30, -27, -21, 
+	100, -55, -96, -97, -73, 68, -80, -36, 
+	-30, -119, -89, 16, -96, 104, 43, -166, 
+	131, -86, -48, -136, 109, 24, -52, -33, 
+	-101, 75, -2, 10, 47, 1, 72, 79, 
+	4, -87, 0, 71, -84, -129, 30, -138, 
+	-39, 23, 71, 87, 0, 30, -27, -114, 
+	-38, 52, -21, 26, -61, -15, -31, 19, 
+	-29, -10, -7, -132, -61, -96, -114, 18, 
+	-47, 43, 23, 20, -6, 7, 49, 9, 
+	-21, -178, -100, -53, -15, 65, -36, -30, 
+	74, -55, -94, -116, -71, -71, -63, 101, 
+	-99, -87, -58, -7, -56, -9, 59, 70, 
+	-113, -18, 19, -87, -189, 75, 16, -113, 
+	144, -96, -47, 79, 83, 130, 33, -64, 
+	30, 44, 208, 44, 90, -46, 47, 107, 
+	13, -129, -11, 22, 41, 16, 45, 87, 
+	56, 22, 174, 7, -41, -111, 135, 28, 
+	3, -35, 71, 107, -59, -124, 110, 52, 
+	-76, 26, -70, -83, -94, -41, 91, 55, 
+	-98, 273, 23, 72, -97, 54, 36, 11, 
+	187, -45, 73, -61, -30, -12, 77, 52, 
+	117, -37, -19, -45, 63, -65, 86, -55, 
+	-119, -91, -24, -92, -130, 19, -38, 70, 
+	-20, 44, 78, 120, 57, 98, 35, -167, 
+	71, 37, 21, 145, 29, -55, 42, 42, 
+	-65, -105, -60, 172, 23, -75, 123, 34, 
+	-95, 67, -9, 116, 154, -12, -36, 16, 
+	-11, -70, -104, 84, -5, 146, -61, -11, 
+	91, -128, 21, 1, 14, -2, 94, -31, 
+	-41, -6, 3, 89, -94, 54, 82, -18, 
+	0, 90, -50, 42, 96, 18, 18, -93, 
+	-65, 27, -38, 12, -35, -108, -27, 19, 
+	-69, -81, -110, 49, 38, -127, 39, 45, 
+	-10, 24, 22, 12, -14, 109, 88, -39, 
+	-76, 52, 68, -30, 227, 75, -75, 56, 
+	115, -72, 63, 11, -39, -4, 35, 98, 
+	34, -10, 138, 72, 89, -72, -63, -61, 
+	-69, -69, -39, -13, -91, -29, 37, -22, 
+	56, -44, 20, 34, 39, -14, -8, -98, 
+	129, -116, -131, 16, 79, -116, 28, -21, 
+	-6, -38, 59, 3, -34, 73, 73, 52, 
+	-76, 113, 46, -90, -55, -67, -153, 63, 
+	-89, -62, 32, 185, 140, -89, -51, 8, 
+	20, 12, 156, 14, -108, 57, -90, -62, 
+	-78, -134, 6, -91, 61, 65, 22, 42, 
+	-83, -66, 71, 28, -77, -87, -14, 92, 
+	1, -153, 116, 24, 59, 88, 66, 86, 
+	131, -69, 22, 53, -50, -113, -40, 149, 
+	79, -78, 121, 15, -37, -25, 9, -163, 
+	33, -45, 46, -128, -7, 66, -7, -53, 
+	156, -166, 129, 70, 136, -18, 6, 46, 
+	14, -15, -3, -10, -115, -40, -118, 26, 
+	68, -118, -2, 37, 66, 129, 24, -163, 
+	-85, -133, -62, -68, -17, 52, -24, 4, 
+	11, 4, 48, 81, 75, -94, -18, -54, 
+	25, -46, 52, -37, 124, 120, 77, -108, 
+	2, 38, 57, -34, -72, 127, 88, 3, 
+	-107, 29, -130, -113, 22, 33, -73, -24, 
+	-54, 49, -5, 57, 14, 70, -91, 43, 
+	69, 134, 149, -24, 76, 61, 66, 64, 
+	105, -25, 34, 98, -101, -30, -22, 50, 
+	-85, 111, -133, 38, -83, -78, -71, -15, 
+	-41, 12, -161, 3, -139, -37, 26, 16, 
+	120, -63, -6, -64, -72, 20, -63, 69, 
+	-5, -52, -23, 57, 18, -96, -76, 110, 
+	99, -84, 85, 63, 89, 17, -146, -8, 
+	-50, 96, -47, -196, -34, -129, -64, -69, 
+	82, -46, 23, -23, 121, -3, -144, 45, 
+	3, 70, 2, -66, -2, -88, 88, 15, 
+	35, -11, 25, -133, -109, -134, -52, -22, 
+	31, -66, 58, 51, -32, -29, -77, -85, 
+	54, 122, 58, -59, -27, -90, 2, 91, 
+	-6, -67, -51, 110, -58, -48, 99, -63, 
+	61, -139, 66, -128, -102, -18, -57, -31, 
+	-115, 43, -9, 64, 111, 20, 19, -16, 
+	-93, -152, -23, -70, 57, 4, 17, -115, 
+	-1, 132, 50, -41, -109, 10, -17, -19, 
+	105, 71, 87, 55, 37, 16, 49, -96, 
+	-27, -79, -118, 30, -127, -101, -112, -5, 
+	17, -69, 84, 134, -46, 36, -42, -110, 
+	59, -35, 47, -49, -31, -13, -79, -72, 
+	-52, -34, -90, 32, -33, 78, -54, 67, 
+	95, 51, -62, 110, 64, -8, -32, 27, 
+	-41, -81, 46, -22, 73, -106, 127, 23, 
+	37, 2, 279, -12, 63, -152, 37, 67, 
+	-42, 14, 65, -57, 65, -33, -52, -24, 
+	51, 91, 98, 7, -20, -70, 0, -28, 
+	-92, -87, -63, -57, -142, -39, -23, 122, 
+	-50, -17, 24, -101, 9, -55, 32, -166, 
+	41, 45, -96, 60, -41, 4, -66, 57, 
+	-106, 86, -48, -7, -102, 22, 2, -33, 
+	-93, 180, -123, -10, -82, -76, -162, 49, 
+	-100, -9, -10, -89, -54, -132, -129, -35, 
+	149, -238, -12, -54, 46, 95, -43, 41, 
+	-92, -62, -179, 29, 7, -98, -64, -167, 
+	-40, 21, -279, 147, 52, -77, -74, 87, 
+	-26, -1, -132, -36, 13, -68, -9, -97, 
+	-97, 7, 78, -18, -127, -97, 25, 16, 
+	22, 80, 5, 115, 2, -16, 75, -1, 
+	-23, -123, 38, -95, 19, -1, 58, 31, 
+	-91, 13, 21, -16, -15, -80, -98, -72, 
+	28, -12, 34, 154, 46, 94, 40, -28, 
+	-110, 27, -115, 109, -56, 119, 4, 56, 
+	60, 34, -127, -71, 21, -139, 8, 90, 
+	-153, 74, -93, -10, 65, -3, 47, 115, 
+	9, -70, -25, -14, 18, -76, -58, 114, 
+	72, -17, -183, 3, -9, -24, 108, 34, 
+	11, -60, -31, 27, 151, -40, -22, 117, 
+	-68, 120, -124, 50, -56, 22, -47, -78, 
+	-23, -44, -10, -19, -88, 59, -116, -27, 
+	-7, 57, -159, 35, 187, 82, -92, 42, 
+	-90, -100, 159, -1, 107, 5, 111, -41, 
+	-112, -57, -16, 261, -5, -149, -52, 125, 
+	-159, -41, 74, 236, 20, -83, -60, 24, 
+	76, -53, -137, -19, 50, 150, 45, 4, 
+	-38, 95, -5, 14, 109, 68, 58, -3, 
+	39, 63, 50, 170, 53, -60, 97, 43, 
+	-85, 6, 17, -110, -49, -44, -188, -82, 
+	91, 72, -132, -51, -37, 78, 16, 36, 
+	-8, -159, 9, 53, 118, 39, 70, -82, 
+	45, 33, 80, 72, -51, -83, -38, -21, 
+	-35, 153, 47, 222, 3, -127, 13, -79, 
+	-3, -146, 18, 168, 102, 11, -5, -48, 
+	-47, -5, -45, -58, 83, 34, 21, 195, 
+	-14, -44, -36, 72, -9, 158, 31, -50, 
+	54, -90, -38, 131, -236, 122, 108, 22, 
+	-27, 30, -97, -41, 3, 74, -38, 49, 
+	42, -209, -61, 98, 135, 46, 138, 14, 
+	96, 71, -77, -53, -24, -25, -17, -92, 
+	-48, 265, -79, 123, -87, 13, 8, -60, 
+	-80, 177, 137, 172, -162, 95, -134, 105, 
+	50, 93, -11, 134, 12, -184, -74, 46, 
+	190, 90, -105, -167, -75, 105, 9, 103, 
+	-52, -55, 46, 27, 65, 7, -64, 127, 
+	-75, -10, -239, -86, -19, 79, -59, 91, 
+	210, 116, 39, -69, -47, 18, 16, -66, 
+	-103, 144, 155, -94, -48, 21, 72, -142, 
+	29, -11, 40, -1, 62, 86, -89, 117, 
+	-84, 142, -24, -86, -23, -56, 14, 60, 
+	93, -253, 2, 162, -75, 25, 12, 3, 
+	-12, -78, 63, -20, -84, 22, -15, 55, 
+	-67, -68, 23, 45, -153, -186, -85, -121, 
+	155, -137, 136, -27, -14, -10, -15, 173, 
+	59, 81, 2, -6, 65, 35, -23, -83, 
+	41, -57, 129, -27, -95, 129, -84, -20, 
+	-191, -83, 31, -117, 65, -18, -154, -85, 
+	46, 108, 74, 10, -87, 16, 142, 76, 
+	-77, -158, 165, -97, -29, -25, 49, -2, 
+	-163, 59, -40, -95, 64, 39, -45, 136, 
+	21, -5, 96, -30, 118, -8, -19, 117, 
+	36, -4, 95, 132, 31, -50, -6, 50, 
+	33, -44, 146, -190, -58, 156, -104, 14, 
+	-13, -22, -64, 40, -130, 31, -15, -1, 
+	46, -155, 10, -204, 126, 13, -35, 10, 
+	50, -195, 12, -107, -125, 54, -18, -105, 
+	-131, 16, -49, 24, -108, 7, -99, -87, 
+	34, 163, 72, 89, 81, -34, 21, -13, 
+	-9, 143, 81, -70, 34, 45, 43, 5, 
+	-87, 69, -50, 35, 76, -104, -69, -96, 
+	-17, -75, 44, 31, 21, 29, -89, -206, 
+	28, -81, 36, 106, 31, -14, 18, -28, 
+	-4, -48, 119, 12, -16, -74, -63, -23, 
+	-20, -11, 11, 36, 72, -5, -74, -56, 
+	25, -32, -137, -29, -125, -122, -2, -5, 
+	-49, 13, 46, -41, -114, -94, -20, -104, 
+	-136, -60, -127, -100, -67, -83, -27, -98, 
+	-98, -59, 99, -96, -106, 62, -24, 26, 
+	-159, -133, 80, 54, -165, -47, 32, 68, 
+	-4, -185, -25, -64, -53, -140, 1, -65, 
+	-20, -9, 32, -11, 44, -21, 71, -131, 
+	-1, 115, -20, -121, 27, 28, 5, 50, 
+	-41, 11, -88, 92, -158, -120, 7, 21, 
+	-19, -35, 81, -87, 2, 19, 75, -98, 
+	88, 43, 41, 89, -149, -59, -21, 17, 
+	-112, 21, 57, -21, 24, -72, 29, -43, 
+	-73, -46, 18, -133, -2, 17, -31, 34, 
+	64, -52, -74, -46, -142, 54, -31, -35, 
+	44, 37, -32, -51, -125, 0, 113, -147, 
+	91, -66, 26, -34, -92, 42, 42, -174, 
+	15, 24, -93, -68, -39, -60, -31, -53, 
+	15, -3, 233, -14, -183, 89, 29, 13, 
+	9, 194, -140, -30, 8, 72, -31, 51, 
+	3, -127, 184, -115, 126, 9, 75, 20, 
+	82, -50, -54, 10, -74, -26, 2, 65, 
+	-67, 31, 10, -4, -117, -84, 61, -82, 
+	45, -77, -70, -75, 73, -49, -55, -2, 
+	-40, -69, -143, 73, -146, -116, -87, -11, 
+	-123, -22, 75, 26, -131, -168, -103, -14, 
+	-170, -67, 50, -28, -128, -16, -133, 58, 
+	-49, -120, -10, -11, -152, -91, -23, -15, 
+	-58, 6, -183, -38, -130, 12, -99, -7, 
+	6, -40, 155, 27, -84, -7, 32, 45, 
+	-73, 70, -114, 42, -17, -9, 55, -9, 
+	-169, 6, -181, -146, -102, 79, 39, 23, 
+	162, -23, -59, 53, 28, -60, -60, -87, 
+	-11, 119, -44, 156, -24, 121, -125, 56, 
+	-114, 37, -1, 34, 23, -37, -16, 9, 
+	-80, 21, 111, -14, -36, 14, -205, 11, 
+	-20, 75, -36, 86, -76, -133, -166, 29, 
+	-49, 52, -24, 39, -8, -28, 53, -22, 
+	-48, -1, 0, -104, 80, -47, 60, -191, 
+	-31, 104, -90, 60, -36, 94, 28, 47, 
+	74, 122, -57, -114, 108, 80, -11, 58, 
+	65, 66, 22, 33, 101, 15, 14, -15, 
+	16, 55, 275, -92, -125, 47, 58, -64, 
+	-18, -113, -152, 88, -82, 62, 94, -97, 
+	-41, 19, 8, 8, 45, -17, -130, -87, 
+	46, -38, -89, -31, -30, -1, 21, 90, 
+	-30, 15, -68, -74, -69, -31, 98, 49, 
+	101, -42, -64, -31, -16, -39, -66, 40, 
+	-58, -105, 45, 42, 23, 39, 17, -92, 
+	45, 8, 5, -74, 7, -19, -73, -10, 
+	57, -14, 33, 32, -160, -44, -51, 11, 
+	-69, 99, -38, -72, -142, 49, 94, 5, 
+	-27, -86, 19, 20, 95, -46, -2, -135, 
+	14, -18, -68, 129, -85, 7, -78, -60, 
+	-141, -3, 39, -131, -40, 14, 101, -7, 
+	54, -43, -89, 11, -8, -122, -93, -48, 
+	-3, 75, -71, 75, -40, 78, 37, -203, 
+	21, -109, -69, -131, 56, -134, -3, 74, 
+	94, -23, 60, -17, -67, 29, 55, 53, 
+	-131, 64, -12, -100, -61, -91, 156, -17, 
+	-17, 110, 47, 53, -108, 66, -58, -72, 
+	-4, 5, 15, -84, 78, 15, -41, -52, 
+	-54, 36, -23, -74, -40, -96, 41, -7, 
+	-3, -7, 25, -47, -77, -138, -24, -39, 
+	45, 70, 35, -29, -6, -114, -60, -86, 
+	6, -82, -87, -6, 27, 53, -115, 18, 
+	82, 110, -23, -150, 89, 45, -25, 27, 
+	44, -69, -80, -14, -30, -3, -57, -57, 
+	-32, -115, -34, -64, 31, -16, -103, 28, 
+	-62, 49, -94, -19, 44, -60, -104, -44, 
+	19, 10, -79, -49, 73, -11, -80, 52, 
+	60, 29, -17, 1, -84, -85, -77, -11, 
+	-97, -18, -40, 8, 35, -114, -39, 15, 
+	-59, -93, -45, -9, 21, 41, 55, 8, 
+	-90, 66, 18, 12, 24, -91, -21, 57, 
+	35, 47, -53, 42, -1, -92, 18, -67, 
+	-100, -6, -79, 16, -38, -46, -84, -2, 
+	8, 4, 54, 67, 6, 16, -38, 48, 
+	2, -19, 48, -91, -105, 16, -25, -109, 
+	-80, 29, 0, -13, -67, 62, -43, 63, 
+	31, -6, 13, -119, -53, -78, 74, 12, 
+	1, -9, -16, -84, 25, -102, -63, -3, 
+	-72, -77, 22, -76, 66, -47, 59, 44, 
+	-3, 22, -98, 44, -110, 68, -30, -36, 
+	65, -14, -104, -39, -106, 79, 45, -43, 
+	47, 11, 56, -104, -111, -60, 41, -21, 
+	-64, -105, 56, 47, 47, -11, -13, -100, 
+	-57, 70, -99, -49, 68, -77, -33, 18, 
+	62, 62, 13, -44, 67, -66, 45, -110, 
+	-88, -85, -81, -38, -1, 25, 18, 46, 
+	44, 62, -23, -82, -86, -80, 1, 53, 
+	-38, 42, 44, 40, -81, 30, -55, -17, 
+	-33, 35, -29, 3, -84, 40, -84, 52, 
+	-98, -65, -66, 32, -84, -88, 50, -126, 
+	-110, -46, -13, -66, -101, -2, -41, -76, 
+	-24, 64, -95, -10, -85, 57, 80, -88, 
+	-40, 57, -57, 39, -67, -86, -46, -20, 
+	72, 40, -22, 54, -97, -79, -19, -79, 
+	-16, 54, 33, 65, -49, -27, -94, -39, 
+	-80, -92, -105, -50, 45, 49, 25, -25, 
+	-43, 21, 29, -101, -37, -34, -73, -32, 
+	25, -112, 8, 60, -7, 34, -92, 1, 
+	-73, -81, -105, 13, -19, -12, 35, -98, 
+	-89, -44, 37, -63, 28, 11, 9, -69, 
+	17, -92, 17, -37, -70, -70, -66, -3, 
+	24, -69, 14, 0, 51, -85, -58, -101, 
+	-91, -26, -2, -9, -21, 53, -6, -43, 
+	-2, -111, 34, -15, 12, -49, 84, -80, 
+	32, 17, 12, -25, 75, -47, -110, -35, 
+	-15, -87, 12, -35, -58, 27, -63, 53, 
+	-85, 2, 58, -70, -24, -56, -105, 76, 
+	-73, -10, 70, -26, 12, -89, -83, -68, 
+	56, 59, 68, -29, 78, 64, 24, -57, 
+	-66, -64, 23, -18, -23, -42, -21, -83, 
+	20, 26, 29, -106, 52, -94, 1, -37, 
+	-83, 41, 22, -78, -93, -89, 55, 39, 
+	36, 1, -37, 46, -77, -14, -46, -93, 
+	4, -88, 33, -104, 69, -46, 28, 43, 
+	15, 1, 57, 68, 73, -16, 6, -30, 
+	-30, 4, -82, -12, -97, -24, 51, 10, 
+	-97, -40, -68, -85, 5, -110, -102, -20, 
+	30, -34, -75, 63, -9, 1, -72, 6, 
+	-15, 9, -71, -101, 52, -19, -45, -48, 
+	-17, 28, 24, -28, -80, 51, -75, -105, 
+	-97, 60, -82, 41, 54, 20, 21, 68, 
+	-13, -68, 77, -36, -5, -35, 46, -15, 
+	-127, -58, -77, -13, 28, 80, -131, -7, 
+	-97, -20, 6, 3, 25, -98, 58, 64, 
+	22, 1, -30, 76, -49, -53, -20, 64, 
+	-31, -20, 70, -71, -103, 73, -40, 28, 
+	51, 44, -73, -105, -30, -36, -15, -57, 
+	20, -84, 56, 74, 20, -24, 66, 61, 
+	-33, -82, -36, -99, -39, 47, -3, -24, 
+	-109, -32, 9, 61, 4, 55, -35, 53, 
+	14, -88, 43, 40, -44, -13, 55, -115, 
+	-103, -24, -6, -3, -93, 35, -124, 27, 
+	-32, -4, -4, 16, -43, 66, 66, -80, 
+	-109, 27, -51, 28, -19, 42, -2, -40, 
+	0, -29, 27, 26, 59, -106, -31, -83, 
+	27, -7, -113, -94, -90, -18, -55, 16, 
+	-69, -56, 66, 47, 7, -5, -41, 39, 
+	-82, -94, -99, 150, 58, -30, -123, -56, 
+	-110, -112, 17, 89, -162, -49, -55, 43, 
+	79, 57, -94, -20, -36, -68, 103, -190, 
+	-58, -210, -100, 77, 170, -130, -68, -61, 
+	-106, 62, -24, -71, -65, -68, 9, 206, 
+	122, 37, -83, -82, 71, -112, -53, 112, 
+	-36, -144, -29, 15, -81, -21, -108, -75, 
+	16, -49, -112, 31, 48, -34, 14, -188, 
+	-117, -109, -43, 39, -40, -100, -108, 118, 
+	-106, -86, -127, -2, -143, -30, 70, -161, 
+	-59, 43, 13, 60, -175, -9, -118, -159, 
+	5, 35, -38, -15, 137, -119, 19, -70, 
+	10, 58, -61, -103, -90, -24, 55, -37, 
+	-28, -135, 245, 25, 86, 16, -90, -103, 
+	81, 115, 32, -151, 25, -126, -49, 117, 
+	8, 69, 63, 165, 41, -89, -64, 66, 
+	28, 55, -61, 46, 10, -90, -87, 63, 
+	-104, 97, -96, -29, -55, 18, 93, 156, 
+	-103, 4, -25, 129, 54, 64, -51, 96, 
+	65, 113, -127, -38, 363, 3, 41, 40, 
+	-16, 49, 131, 38, 47, 54, 16, -56, 
+	60, 68, 48, -140, -25, -39, 35, -47, 
+	86, 87, -7, 35, -43, -101, -76, -125, 
+	68, 74, -79, -76, 8, -63, 48, 105, 
+	-32, 183, 12, 50, -6, 91, 66, -10, 
+	-95, -114, -68, -80, -10, -35, 85, -96, 
+	-65, -31, 150, -62, -88, 106, -15, -52, 
+	25, -242, 79, -65, 45, -97, 43, 5, 
+	30, -116, -135, 48, 17, 1, 30, -53, 
+	-70, -58, 29, -91, 48, 129, 118, 99, 
+	63, -19, -144, 111, -52, -5, -75, 96, 
+	-65, -3, 178, -58, 79, 33, 32, 166, 
+	189, 0, -21, -16, 122, -7, 39, -68, 
+	-40, -7, 23, 96, 56, 35, 32, 11, 
+	-59, 103, -56, -43, 114, 136, -69, 181, 
+	40, -187, 179, 0, 195, 32, 81, 84, 
+	-46, 8, -1, -62, 81, -26, -7, 152, 
+	-54, -60, 61, 17, 43, 44, -80, -168, 
+	-40, 6, -116, -130, 135, -47, 21, 2, 
+	69, 44, 82, -33, 7, -70, -2, 3, 
+	109, -58, -2, -65, 67, 50, 128, -123, 
+	199, -42, 45, -9, 60, -16, 31, -16, 
+	-29, 50, 58, 1, 83, -84, -135, -65, 
+	78, 130, 145, 87, 108, 24, 35, 57, 
+	-53, 86, 44, 99, -58, -49, -180, -43, 
+	193, 5, -39, 54, 5, 57, 79, 73, 
+	-45, 128, -19, -22, 63, -60, 4, 36, 
+	80, -42, -82, -144, -119, 13, 20, 61, 
+	-15, 58, 96, 50, -63, -19, 30, -27, 
+	-46, 82, 33, -86, -77, 19, -54, 23, 
+	24, 71, 107, 53, 14, 111, -89, -3, 
+	-152, -145, 28, 31, 63, 47, -42, -31, 
+	-79, 84, 33, -114, 13, 53, 5, 111, 
+	-72, 30, -73, -81, 107, -92, 102, 172, 
+	70, -84, 31, 133, -6, 7, -75, 54, 
+	17, -92, 61, -169, -103, -139, -119, 80, 
+	32, 117, 107, 5, -44, -46, -145, 151, 
+	53, -93, -61, -50, 50, -75, -113, -53, 
+	82, 6, -53, 26, -97, -5, -57, 24, 
+	-54, 218, 56, 43, 30, -3, -34, -62, 
+	-41, -67, 103, -190, 65, -136, 3, 35, 
+	-28, 45, 40, -63, -18, -159, 49, 68, 
+	167, -58, -100, -91, 165, -41, -110, 11, 
+	-36, 15, 51, 151, -13, 52, -24, -76, 
+	164, 64, -87, -148, -178, -67, -125, -73, 
+	71, -154, -81, -32, -222, 115, -115, 9, 
+	-99, -145, -63, -175, 70, -16, 1, -56, 
+	205, 1, -157, 28, -123, 28, 3, -24, 
+	-85, -77, 108, -79, -100, -20, -62, -46, 
+	73, 144, 208, -9, 85, -64, 10, 28, 
+	88, 20, -20, -9, 91, -9, -49, 7, 
+	-13, -35, 58, -47, 1, -1, 138, 10, 
+	24, 76, 28, -103, -35, -2, -11, 39, 
+	-77, -37, -96, -164, 71, 35, -52, 93, 
+	-7, -4, -115, -156, 8, 170, -8, 30, 
+	63, 150, 143, -39, 68, -26, 37, -43, 
+	60, -56, -74, -67, -19, 26, 136, -23, 
+	44, 88, -4, -138, -24, 148, -62, 37, 
+	74, 226, -65, -65, 114, 19, 18, 38, 
+	-26, -61, 68, 22, -52, 25, -45, 10, 
+	94, 75, -16, -67, 79, -73, -50, -9, 
+	-24, -46, 9, 11, 118, -39, 45, 29, 
+	12, 6, -7, -57, 11, 38, 72, 30, 
+	-20, 154, 99, -58, -21, 15, -83, 66, 
+	-29, -15, -2, -2, 109, 126, 12, 0, 
+	-4, 123, 84, 108, 48, 71, 67, -48, 
+	38, 64, 140, -3, -65, 80, -29, 27, 
+	40, 5, 175, 21, 7, 45, -67, -19, 
+	35, -68, 121, -1, -2, -180, 58, -8, 
+	54, -14, 150, 44, 97, 111, -40, -53, 
+	66, 67, 47, -13, -150, -1, 47, 56, 
+	-105, 43, -84, -18, -61, -10, -56, 23, 
+	-86, 26, 34, -39, -155, -14, -57, -32, 
+	53, 26, -33, -11, 74, 40, -36, 72, 
+	-61, 23, 94, -51, -4, -92, -74, 94, 
+	-8, -81, 279, 61, 14, 79, 100, 50, 
+	-18, 77, -227, 122, 92, 79, 10, 15, 
+	81, 190, 13, 91, 58, 13, 66, -33, 
+	131, -76, -41, -4, -25, 112, 50, 45, 
+	-11, -30, 106, -109, -14, 124, 76, 58, 
+	13, 145, 55, -91, -107, -158, 36, -104, 
+	31, -173, -90, 152, 115, 133, -21, -16, 
+	144, 78, -50, -30, 85, 85, 54, 112, 
+	-8, 25, -52, 94, 102, -155, 78, -104, 
+	37, 42, -163, 5, -79, 4, 7, 171, 
+	83, 76, -82, -38, -37, 126, 11, -11, 
+	50, -47, -74, -88, -87, -125, 13, -69, 
+	111, -162, -111, -104, 42, 4, 82, -41, 
+	42, -3, -90, -26, 103, -111, 65, -82, 
+	-99, 15, -15, -44, -22, -143, 81, -6, 
+	-11, -71, -40, -7, -20, 40, -38, 56, 
+	-60, -155, -34, 137, -14, 66, -29, 21, 
+	125, -11, -63, 67, -78, 25, -204, 101, 
+	-15, -27, 103, -25, -81, -40, -5, 131, 
+	-69, -6, 99, -142, 49, 11, -68, 69, 
+	22, -155, 52, -46, 254, -94, 126, 9, 
+	-50, -131, 77, -178, -104, 76, -74, -69, 
+	-9, 118, -211, 43, 10, 49, 34, 6, 
+	80, 63, 49, 43, -15, -105, -33, 48, 
+	114, 49, 41, 157, 3, -53, -41, -13, 
+	-48, 3, 21, -125, 124, 179, 94, -10, 
+	97, -78, -169, 190, 69, 43, 102, 64, 
+	-19, 7, -127, 74, -33, 65, 103, -53, 
+	80, -22, 122, -43, -24, 75, 92, -8, 
+	-20, 35, -261, -148, 77, -173, 146, 82, 
+	56, 37, 65, 95, -206, 67, -48, -211, 
+	135, 214, 89, -34, 162, 33, -159, -74, 
+	-68, 75, -137, -38, 79, 163, -61, 1, 
+	-101, -14, -47, 104, -108, 112, 3, -172, 
+	20, -61, -38, 71, 85, 83, 56, -65, 
+	45, -76, 60, 24, -66, 96, 1, -112, 
+	2, -120, -35, -77, -14, 74, -108, 142, 
+	-81, -96, -171, 55, 163, 130, 245, 95, 
+	36, -141, 135, -56, -69, -68, -67, -64, 
+	-29, -2, -3, 188, -31, 89, 169, -202, 
+	-83, 97, -162, -158, -81, -44, -29, 88, 
+	76, 150, -86, 54, -20, -115, 14, 44, 
+	-27, -31, -26, 13, -27, 72, -90, 106, 
+	64, -45, 96, 164, 69, 108, 44, -50, 
+	-149, -91, -165, 2, 100, 88, 123, 41, 
+	-59, 9, -136, 102, 11, 4, 112, 76, 
+	-144, -80, -41, -32, 33, 34, -132, -48, 
+	-164, -75, -84, -86, -57, -11, 39, 56, 
+	28, 65, -66, -1, 63, 42, 48, -58, 
+	-124, -9, -6, -20, -44, 20, -104, -117, 
+	-77, 19, -65, -14, -7, -99, -42, -73, 
+	-64, -97, -60, -117, 63, 12, 11, -80, 
+	-84, -54, -14, -87, 49, -57, 3, -67, 
+	-33, 10, 63, -38, 10, -62, 61, -63, 
+	-95, 57, 0, -62, 16, 65, 39, -54, 
+	-21, -34, -96, -33, 43, -17, 20, -48, 
+	28, -10, -4, 19, 37, -66, -89, -84, 
+	-40, -66, 46, 42, 61, 4, -93, -12, 
+	-31, -109, -73, -27, -64, -6, -83, -8, 
+	9, 25, -17, 68, -72, -115, -39, 52, 
+	-100, -32, 13, -60, 58, -28, -96, -49, 
+	-82, -97, 37, 8, -113, 1, 36, -43, 
+	66, -86, -40, 32, -70, -54, 19, 42, 
+	-88, 28, -38, 29, 37, 55, -63, -14, 
+	-65, 33, 65, -52, -106, -22, -72, 78, 
+	29, 0, 5, -52, -65, -73, -66, 0, 
+	-18, -128, 25, -77, 37, 37, 63, -49, 
+	-33, -10, -135, 6, -68, 23, -39, -2, 
+	-14, -52, 32, 37, -75, 37, -10, -45, 
+	-39, -53, -59, 60, -103, 4, 18, -38, 
+	-32, -2, 98, 16, 4, 82, 55, -115, 
+	-58, 13, -87, -19, -55, 51, -20, -28, 
+	25, 32, -47, -99, -85, 20, -16, -101, 
+	-112, -12, 31, -105, -84, 20, -107, -25, 
+	4, 1, -103, -117, 29, -15, -76, 45, 
+	67, 46, 47, -7, 41, -77, 13, 73, 
+	-36, 32, -8, -96, 25, -45, -54, -64, 
+	-102, -7, -43, -52, 41, 56, -11, -59, 
+	-43, 53, 76, -127, -55, 12, -42, 10, 
+	-116, 30, 10, 3, -91, 58, -111, -33, 
+	12, 26, -104, -17, -37, -14, -54, 30, 
+	-101, -41, -96, 49, 53, 45, 70, -96, 
+	40, 28, 19, 63, 24, -73, -10, 66, 
+	28, -29, 56, 7, 43, 70, -72, -32, 
+	-43, -3, -39, 29, -89, -46, 20, -86, 
+	76, 13, 63, -91, 40, 50, -55, 66, 
+	19, -7, -48, -26, 38, 27, 15, -103, 
+	-9, 8, 2, -59, 31, -28, -120, -8, 
+	11, -93, -118, 47, -125, -4, 23, -64, 
+	24, -107, -53, 77, -18, -100, 57, -7, 
+	-69, 13, -20, 53, 14, 7, -97, -62, 
+	15, 86, 49, -25, -91, 90, -103, 7, 
+	10, -50, -96, -2, 24, 5, -108, -3, 
+	52, 71, -106, -29, -112, -102, 64, -86, 
+	-53, -16, -60, 22, 62, -13, -16, -95, 
+	69, 82, -114, 55, 13, 9, -2, -10, 
+	-72, -114, -106, 56, 26, 36, -5, -17, 
+	-68, -82, -41, 78, 10, -85, 55, -34, 
+	23, -123, 35, -98, -61, 70, -61, 34, 
+	39, -32, -34, -97, 24, -115, 19, -107, 
+	-111, -36, -103, 8, 64, 51, 51, -66, 
+	18, -8, -43, -104, -30, 44, -31, -56, 
+	31, -96, -10, -83, -7, 13, 23, 15, 
+	-72, -52, -23, 16, 0, -33, -22, 56, 
+	27, -17, 14, -66, -119, -20, -74, -68, 
+	20, 0, -21, -43, -52, -70, -8, 7, 
+	-36, -81, 42, -55, 17, -57, 48, 46, 
+	-110, -47, 18, -23, -29, 11, 37, -7, 
+	58, -52, 42, 34, -18, -32, 7, 34, 
+	51, -2, 37, -11, 36, 43, 0, -72, 
+	-87, -110, 41, 4, 89, -90, 65, 9, 
+	-52, -52, -77, -52, -21, -86, -89, 51, 
+	4, -44, 44, 0, 5, -116, -13, 35, 
+	-108, -25, 20, -23, -28, -88, 17, -99, 
+	-24, -35, 50, -86, 51, 43, 53, 56, 
+	-22, 69, -72, -83, -49, -94, 56, -55, 
+	33, -10, -48, -88, -27, 23, -73, 8, 
+	-80, 45, 44, -95, 47, -45, -42, -39, 
+	-55, -110, 12, 29, -20, -73, -59, 57, 
+	54, -31, 0, -34, -64, 71, -37, -99, 
+	6, 39, 177, 18, 72, 116, -10, 41, 
+	-109, -55, -19, 14, -64, 40, -52, 45, 
+	154, -78, 35, 95, 12, 24, -89, -11, 
+	-44, -33, -43, 88, -43, -1, -104, 51, 
+	104, 25, 3, -144, 47, -24, 17, 27, 
+	-16, -130, -133, 14, -2, -113, 34, 10, 
+	153, 26, 147, 120, 122, 77, -66, 48, 
+	9, 175, 32, 20, 40, 51, -44, -7, 
+	44, 86, 132, 89, -54, 81, -56, 98, 
+	31, -172, -39, -24, 105, -9, -40, -29, 
+	89, 36, 30, -36, -75, 38, 56, 30, 
+	125, -50, 85, -12, -13, 45, 40, -8, 
+	-7, -21, 166, -119, -1, -93, -91, 78, 
+	-49, -15, -80, -61, 61, 43, 181, -68, 
+	102, -71, -39, -65, -111, 136, -4, 20, 
+	22, -4, -78, 87, 40, 63, 50, 24, 
+	-89, 35, 97, 38, -64, -50, -15, 37, 
+	-69, 42, 95, 126, 62, 56, 8, -29, 
+	28, 22, 133, -73, -62, 6, 52, 16, 
+	-55, 75, 16, 67, 3, 15, -43, -132, 
+	-135, -79, 194, 16, -76, -31, 12, 59, 
+	51, -20, 48, -106, 11, -47, -65, -5, 
+	-12, -41, 97, -145, -42, -5, 77, 122, 
+	40, 18, 61, 55, -55, 21, 19, -12, 
+	41, -57, 222, 45, -29, 4, 151, 57, 
+	-85, 75, -50, -109, -78, 70, -75, 70, 
+	3, -30, -118, 16, 52, 21, -55, -59, 
+	48, -18, 82, -27, 33, 39, 182, 103, 
+	-52, -92, -15, -175, 205, 59, 127, -101, 
+	-110, -33, -89, -13, -92, -6, -67, -85, 
+	-45, -22, 119, -156, -7, -96, 37, -58, 
+	72, 41, 98, 162, 99, -51, -21, -20, 
+	-14, 70, -44, -9, -99, -52, 156, -73, 
+	164, 28, 21, -40, -38, -95, -131, -92, 
+	-66, 106, -62, -96, -116, 59, -64, -41, 
+	-85, -21, 59, 11, 53, -12, -56, 140, 
+	3, -34, -35, 69, -94, -145, 98, 50, 
+	-9, 7, 186, 63, 112, -11, 60, 15, 
+	-20, 100, 93, -24, -25, -186, -89, 172, 
+	95, -154, 52, -23, 106, 17, -108, -63, 
+	91, -136, -37, -18, 22, -64, 22, -6, 
+	-36, 66, -93, -9, -7, -1, -15, 43, 
+	58, -47, -103, -86, -14, 42, -28, 13, 
+	5, -197, 67, -19, 56, -25, 46, -146, 
+	79, 68, -111, -30, 158, 114, 112, 60, 
+	-34, 24, 84, -5, -6, -135, 34, -119, 
+	-59, 160, -191, -45, -21, 85, 109, -124, 
+	140, -39, 36, 64, 23, 121, 89, -99, 
+	65, 28, 49, 56, 43, 48, -163, -51, 
+	-77, -117, -74, -63, 57, 42, 148, -92, 
+	-90, -66, -147, -24, 4, -33, -56, 136, 
+	56, 50, 50, 39, -57, 18, -44, -69, 
+	-12, -88, 95, -34, 24, 124, 108, 123, 
+	-20, 39, -15, 5, 75, 100, -20, 73, 
+	9, -117, -8, 21, 3, -11, -62, -156, 
+	21, 51, 17, -35, 37, 70, -193, -32, 
+	-153, -11, -18, -19, -65, 97, 45, 69, 
+	-108, -12, 59, -117, 7, -49, 14, -39, 
+	-117, 91, 102, 256, -42, -104, -66, 5, 
+	64, 38, -86, 37, -18, 56, -8, 88, 
+	-79, -145, -126, 166, -17, -18, -63, 46, 
+	-27, 113, -28, -67, 77, -73, -17, -51, 
+	120, -159, 90, 57, 28, 140, -38, 63, 
+	-64, 17, 5, 72, -165, 25, 188, 3, 
+	-88, -77, 27, -128, -36, -13, -170, 49, 
+	-65, 62, -128, -66, 63, 4, -80, -19, 
+	-50, 1, -40, -19, 192, 120, 121, -89, 
+	15, 36, -89, 81, -93, -4, -7, -3, 
+	-51, 8, -129, -104, 137, 55, 26, -40, 
+	-65, -90, -41, 131, 69, -42, 158, 53, 
+	45, -65, -108, 73, -58, 29, 16, -25, 
+	-1, -221, -32, 37, -56, 83, -10, -95, 
+	168, -158, 66, 22, 14, 24, 52, 14, 
+	-57, -92, -86, -128, 31, 147, 52, 6, 
+	193, -63, 105, -235, -146, 114, 19, -162, 
+	-89, -25, -91, -72, -121, -18, -18, -69, 
+	6, -114, 12, -44, -221, -35, -5, -83, 
+	-114, 303, -210, -74, 6, -133, -100, 63, 
+	11, -58, 147, -66, -147, -102, 47, 41, 
+	-4, 7, 143, -15, 32, 11, -35, -55, 
+	130, -51, 185, -66, 41, -17, 117, -100, 
+	50, 45, 44, 165, -114, 112, 41, 92, 
+	144, -94, -140, -23, -105, 150, 96, -81, 
+	122, 66, -118, -2, 6, 110, 45, 30, 
+	94, -80, 159, -182, -105, 65, -88, 0, 
+	-85, 198, -81, -149, 80, -105, -81, 108, 
+	-90, 22, 10, -38, -22, 60, 114, -146, 
+	-64, 41, 41, 171, 53, 159, 78, -56, 
+	52, -140, 24, 4, -28, 119, -23, 1, 
+	222, -59, -89, 47, 165, -8, -81, 270, 
+	-109, 97, 28, -6, 45, 133, 86, 80, 
+	-43, -121, -65, 65, 69, 28, 48, 98, 
+	35, -47, 142, -104, -80, 39, -22, -80, 
+	109, -128, 103, -37, 33, 126, -104, 64, 
+	218, -35, -192, -75, -129, 78, -71, -22, 
+	87, 228, 35, -45, 59, -7, 6, -74, 
+	35, 94, 8, -5, 54, -130, -9, -44, 
+	-63, 103, 35, -4, -42, -103, 60, -63, 
+	-69, 29, -121, -8, 59, -52, -20, 52, 
+	-12, -23, -58, 100, 29, -5, 117, -72, 
+	50, -3, -116, 9, 69, 161, 156, 52, 
+	-122, 10, -22, 86, -4, -12, -95, 118, 
+	4, 60, -15, 23, -67, 20, 24, 52, 
+	63, -4, 104, -53, -43, 59, -24, -112, 
+	140, 141, 8, -72, -82, 10, 75, -145, 
+	17, 222, 89, 41, -6, 90, -39, -66, 
+	22, 101, -105, -118, -64, 0, -158, 30, 
+	-6, -68, 41, 133, 3, 19, 214, 2, 
+	-100, -189, -65, 124, 128, 36, 24, 22, 
+	-1, 58, 28, 109, 98, 35, 66, 40, 
+	-83, 21, 127, -49, -43, -34, 5, 131, 
+	103, -34, 161, 87, -51, 44, -12, -13, 
+	-2, -182, 140, -58, -49, -22, -128, 86, 
+	-39, -105, 59, 111, -53, -13, -95, 27, 
+	77, -3, -66, 14, 4, 32, -105, -59, 
+	86, 243, 49, -121, -95, -49, -87, 50, 
+	-146, -26, 125, 94, 8, -184, -86, -5, 
+	137, -112, -129, 8, 130, -156, -49, 23, 
+	-13, 247, 101, 10, -52, 6, 6, 79, 
+	114, -42, -119, 140, 59, -9, 37, 101, 
+	-72, 14, -68, -4, 76, 35, -59, -66, 
+	20, -106, 32, -76, 63, 5, 56, -41, 
+	-33, -30, 36, -57, -82, -88, 108, -74, 
+	-148, 7, -4, -76, 51, 111, -93, -32, 
+	-67, -63, -64, -64, 19, 78, 28, 23, 
+	82, 79, -95, 1, 63, -87, 39, 14, 
+	13, -72, 16, 73, -79, -14, -95, -39, 
+	-2, -48, -82, -58, 71, -23, 42, -17, 
+	-3, 26, 243, -75, 113, -47, -30, -32, 
+	103, 12, -12, -116, -4, 45, 37, -138, 
+	99, 19, 12, 103, 35, 117, 49, 35, 
+	-21, -33, 30, -28, -38, -154, 20, 52, 
+	-34, -42, -88, 22, -116, 137, 44, 95, 
+	53, 0, -3, 29, -17, -14, 54, -30, 
+	0, -152, -7, 56, -129, 54, -61, 32, 
+	7, 68, 74, -106, 26, 50, -37, -2, 
+	-48, -100, 117, -105, -30, -58, -122, 93, 
+	-121, -18, 80, 53, -65, -70, 49, -69, 
+	144, 88, -44, -6, -81, -88, 91, 1, 
+	17, -54, -78, 37, -34, 14, 66, -101, 
+	-124, -114, -128, -167, 10, -126, -9, 18, 
+	22, 131, -14, -18, -105, 113, -98, -20, 
+	7, -24, 170, -48, -14, -48, 84, -102, 
+	-155, -22, 60, -10, 6, -38, -48, 39, 
+	-21, 24, 84, -13, 52, 62, -80, -61, 
+	9, -48, -103, 0, 44, -87, 40, -4, 
+	22, -81, 20, -112, 55, 51, 34, -65, 
+	-70, -65, 31, -31, 76, -76, -83, 21, 
+	-32, 19, -14, 33, -58, -21, 21, -60, 
+	-103, -23, 11, 38, -1, 78, -70, 15, 
+	-85, 22, -48, -3, -7, -83, 90, 87, 
+	-10, 94, -64, 15, -107, 65, 64, 21, 
+	78, -80, 1, 45, -22, -21, 23, 16, 
+	28, -114, 21, 72, -107, 44, -6, -85, 
+	6, 16, -33, 32, -67, -76, -96, 56, 
+	-8, -21, 36, -63, 25, -29, -84, -39, 
+	-78, 44, -84, -38, -67, -105, 71, -86, 
+	-84, -71, -95, 26, -64, -21, 46, -99, 
+	-38, -102, 13, 36, -12, 39, 27, -50, 
+	-86, 31, 69, -69, -111, -71, -81, -2, 
+	-100, -112, 85, -86, -14, -120, -80, -88, 
+	52, -92, -51, 81, -44, -94, 21, -49, 
+	42, 36, -82, 3, 68, 15, -32, -76, 
+	-32, 74, -91, -32, -52, 63, -10, 22, 
+	-2, 17, 23, 35, 45, 20, -65, -29, 
+	10, -42, 50, 8, 22, 72, 44, 35, 
+	-38, -95, 12, 17, 51, -7, -99, -27, 
+	-92, 65, 35, 4, 60, 85, -46, -96, 
+	11, -103, 6, -13, -97, -23, 12, -27, 
+	-58, 40, -100, -91, 72, -21, 46, 9, 
+	-62, 36, -76, -81, 81, 40, 13, -55, 
+	70, -83, -91, 28, -56, -43, 32, -91, 
+	-77, -2, -42, -20, 28, 3, -9, -75, 
+	-15, -5, -72, -66, 11, 64, -52, 68, 
+	44, 26, -18, -53, 50, -34, -18, 4, 
+	28, -56, -15, 44, -86, 40, 58, 41, 
+	-30, 47, 51, -7, 58, -94, 56, -47, 
+	82, -70, 86, -103, 45, -104, -103, 41, 
+	-82, 50, 25, 47, 60, 5, 3, 24, 
+	-9, 64, 36, -13, -41, -30, -30, 64, 
+	-139, -35, -70, 39, 64, 5, 8, -47, 
+	-55, -55, -24, 50, -54, -82, 51, 51, 
+	-41, -12, -10, 32, -40, -33, -75, -70, 
+	-51, -27, 14, -21, -19, 7, 60, -138, 
+	-29, -46, -39, -98, 55, -76, -64, -33, 
+	-7, 34, 26, 27, -125, -130, -23, 43, 
+	-30, -84, -27, -35, -82, 42, 31, -105, 
+	-29, 64, 19, -79, 21, -81, -90, -56, 
+	-123, 3, -78, -46, -27, -101, -39, -54, 
+	15, 41, -86, -112, -41, -70, -83, 63, 
+	-59, -93, -59, 69, -77, -105, -45, 14, 
+	-34, 50, 15, -35, -46, 8, -91, -52, 
+	-25, 1, -105, 69, 39, -99, -19, 48, 
+	-35, -48, -43, 75, -6, 8, -11, 7, 
+	-74, 46, 23, -75, 45, 61, 40, 79, 
+	-39, 36, -44, -39, -37, 9, -13, -3, 
+	62, 18, -61, 31, -47, 83, -14, 29, 
+	62, 28, -94, -91, -29, 46, 39, 80, 
+	-5, -87, 49, 38, -21, -58, -37, -17, 
+	-98, -9, -100, 78, -90, -97, -96, -91, 
+	58, 32, 10, -104, -20, 62, 69, -67, 
+	-120, 79, -28, 4, -60, 16, 83, -44, 
+	5, 40, -25, -105, -99, 51, 52, 5, 
+	39, -54, -50, 22, -40, -54, -74, 62, 
+	-77, -86, -39, 6, -70, 84, -96, -42, 
+	-62, 47, 58, -42, 43, -77, 20, -126, 
+	-62, -48, 81, 0, 39, 47, 62, -110, 
+	5, -56, -80, -52, 7, -90, -58, -117, 
+	-95, 75, -95, 65, 50, -13, -11, 38, 
+	11, -90, 26, -82, -91, -84, -3, -67, 
+	-32, -35, -67, 45, -82, -12, 49, -8, 
+	15, 53, 16, -63, 55, -48, -1, -9, 
+	-54, -75, -117, 71, -32, 21, 41, -46, 
+	23, -50, 11, -109, 7, -78, 42, -56, 
+	59, -29, -14, -65, -26, -14, 16, 6, 
+	-62, -3, -55, 83, -49, -63, -16, -43, 
+	60, 197, 53, 34, 126, -159, -82, 35, 
+	-95, 58, 8, 13, 23, 17, 72, 77, 
+	-38, 47, -26, -78, 75, 174, 3, 22, 
+	97, -63, 27, 104, -86, -77, 72, -27, 
+	66, 27, -58, 74, 42, -48, 37, 33, 
+	76, 94, 42, 32, 141, 64, 55, 40, 
+	57, 81, 8, 9, -67, -19, 0, -76, 
+	79, -4, 106, 39, 26, 107, -50, -42, 
+	8, 20, 180, -72, 77, -117, -34, -108, 
+	-29, 4, -40, -17, -17, 143, 0, -76, 
+	-2, 85, -75, 17, -1, 114, 206, 29, 
+	103, -63, 20, 119, 31, 33, 38, 67, 
+	92, -84, 11, -110, -133, 6, 86, -105, 
+	-94, 7, 106, -5, 70, -5, 45, 99, 
+	-23, -56, 143, -33, 85, 24, 121, -120, 
+	-117, 27, -46, 31, -62, 40, -14, 80, 
+	70, -34, 11, 53, -6, 203, -31, -68, 
+	136, 122, -327, 69, 83, -143, -84, 215, 
+	-228, 101, 142, 22, -3, 74, 130, 208, 
+	31, 7, -17, -15, 123, 91, -74, 132, 
+	10, 101, -146, 39, 87, 101, 113, 67, 
+	39, -39, 64, 106, -10, 82, 16, 91, 
+	54, -18, -219, 112, -68, 13, 111, -10, 
+	74, -43, 89, 12, 66, -91, -10, -67, 
+	62, 111, -102, 24, -12, 12, -29, 5, 
+	75, -50, -45, 121, -40, -13, 31, -38, 
+	-73, -43, 12, 22, 51, 29, -27, 77, 
+	71, 115, 11, 83, 39, -111, 2, -31, 
+	-73, 4, -108, 3, 13, -32, -103, -52, 
+	109, 68, 6, 152, -64, 54, -63, 77, 
+	-97, 50, -101, 71, 69, 95, 62, 12, 
+	1, -2, 30, -81, -128, 0, -86, 45, 
+	53, 59, -1, -1, 35, 0, -51, -53, 
+	33, 7, -17, -2, -44, 94, 70, -36, 
+	-29, 64, 31, 1, 110, 17, 16, -11, 
+	77, 54, 66, -44, 104, 7, 12, 63, 
+	-73, -55, 51, -74, -81, -17, 69, -101, 
+	16, 115, 33, -71, 48, -88, -34, -45, 
+	-61, -186, -69, 0, 113, 25, -34, -39, 
+	89, -13, -47, 41, 97, 120, 110, -52, 
+	-34, -173, 41, -71, -29, 41, -84, -53, 
+	20, 23, 72, 93, 81, -38, 20, -170, 
+	25, 75, -54, 102, -31, -82, -72, -113, 
+	-48, 126, 119, 5, -25, -67, -48, 126, 
+	-113, -7, -56, 283, 152, -120, -68, -7, 
+	94, 44, -45, 50, -10, 57, 150, 93, 
+	42, 270, -96, -57, 206, 60, 33, 179, 
+	-19, 104, 23, 44, -72, -138, -80, 65, 
+	-39, -33, 8, -9, -58, -16, -44, 13, 
+	48, -51, 110, -94, 50, 55, 70, 45, 
+	-3, 60, 152, -89, 79, 49, 27, -41, 
+	-24, 15, -50, -75, 60, 50, 1, -45, 
+	1, 124, -68, 63, 1, 74, 80, -22, 
+	30, -68, -45, 113, 58, 51, 59, -162, 
+	-41, 104, -2, -37, 18, -115, 29, 135, 
+	45, 6, 73, -100, -124, -61, 50, 10, 
+	115, -2, 21, -56, 175, 47, 93, -76, 
+	-72, 40, 31, -7, -105, -78, 110, 38, 
+	-29, 48, -21, 36, 22, 19, -1, -19, 
+	90, -129, 69, -36, -75, 16, -89, 59, 
+	-102, -50, 82, -133, -115, 61, -31, 10, 
+	20, 6, -49, 43, 47, -7, -58, -79, 
+	67, 51, 3, 13, 2, -59, -10, -69, 
+	-8, -32, -38, -58, 0, 98, -23, 81, 
+	-50, -19, 80, 69, 42, 67, 45, 4, 
+	132, -57, 62, -36, 0, 0, -14, 86, 
+	27, -104, 72, 0, -152, -57, 58, -47, 
+	18, -21, -7, 6, -15, -14, 28, -6, 
+	108, -132, -32, -178, -26, -15, 46, 94, 
+	-96, -7, 36, 14, -41, -29, -46, 113, 
+	-49, -208, -69, 110, -97, 31, 31, -53, 
+	-4, 117, 69, -72, 146, 11, 85, 141, 
+	57, 67, 152, 86, -67, 39, -92, -47, 
+	2, -15, 85, 14, -4, -51, -43, -48, 
+	124, -79, -13, 94, -1, -52, 56, -105, 
+	-69, 95, -3, -134, 28, -105, 56, -81, 
+	-51, 127, -7, -59, -76, 89, 99, -85, 
+	111, 262, -66, -114, 36, -65, -151, 56, 
+	14, -50, 120, -113, -46, -141, -73, 12, 
+	-69, -9, -41, 3, -42, -50, -54, 64, 
+	-26, -77, 118, -71, 102, -10, 43, -112, 
+	21, 68, 186, 90, 12, 120, 19, 7, 
+	-21, -163, -13, 24, 14, 29, 65, 29, 
+	90, 39, 48, -71, 83, 47, 106, 37, 
+	-20, 21, 66, -12, -111, -105, 20, 58, 
+	73, 350, -116, -69, -67, -15, -148, 5, 
+	-79, -52, -85, -61, 8, -37, -44, -113, 
+	63, -73, -119, 63, 167, -4, 78, 12, 
+	58, 19, 91, 40, 3, 37, 1, -155, 
+	103, 68, -35, 12, 64, 167, -16, 118, 
+	1, 46, 15, 92, -67, 31, -16, -43, 
+	49, -135, 69, -107, -46, 34, -25, 56, 
+	32, -25, 115, -95, -83, 130, 13, 62, 
+	31, -29, 118, -7, 7, 13, 70, 117, 
+	-34, 97, -230, -46, -71, 87, 61, -89, 
+	112, 98, -7, 6, 54, 24, 83, -18, 
+	-52, 68, 49, 47, 67, -32, 140, -90, 
+	20, 70, -2, -103, 116, -199, -60, 15, 
+	2, -22, 54, 195, -8, 42, 75, 109, 
+	-18, 96, -32, 73, -28, -155, 45, -19, 
+	-46, 15, -38, 66, 36, 2, 112, 108, 
+	-32, -31, 52, 72, -33, 159, 14, -42, 
+	-109, 29, 30, 149, 8, -110, -50, -19, 
+	-58, -61, 74, -133, 36, 14, 21, -43, 
+	65, 7, -191, 41, -86, -57, -77, 5, 
+	-18, 107, -102, -4, -54, -117, 16, 47, 
+	82, 124, -84, 24, -18, -16, -108, 80, 
+	-103, -84, 139, 6, -67, 34, 80, -60, 
+	38, -117, -9, -84, 8, 103, 70, -76, 
+	-63, 146, -58, -42, 71, 8, 11, 49, 
+	-75, -50, 96, -37, -102, -45, -22, 46, 
+	-22, 9, 206, 54, -114, 47, -139, -24, 
+	1, 19, -29, -82, -67, -27, 21, 86, 
+	-34, 39, -31, -26, -36, -40, -152, 69, 
+	-123, 29, 48, -69, -27, -34, 3, 77, 
+	139, 76, -88, 39, -16, 62, -107, 43, 
+	23, 24, 4, 1, -45, -47, -14, 82, 
+	66, 14, 81, 93, 157, 29, 16, 122, 
+	12, -43, 22, 105, -95, -44, -46, 36, 
+	88, -28, -2, -72, 5, -9, 8, -43, 
+	-54, 165, -210, 58, 62, 5, -120, -92, 
+	71, -142, 154, -4, 105, 125, 18, -94, 
+	26, 25, -54, 94, 30, -19, -84, 14, 
+	14, 45, -36, 179, 2, 24, -57, 41, 
+	28, 32, -77, 9, 172, -155, -18, 40, 
+	85, -4, 2, 50, 158, -5, 79, 150, 
+	108, 91, 42, -73, -21, 16, 39, -5, 
+	29, 100, -113, -53, -47, -18, 59, 7, 
+	-13, -21, 102, -5, 141, 28, 206, 49, 
+	116, -11, -94, 7, 91, -70, -87, -178, 
+	-11, 26, 140, -26, -20, 15, 143, 3, 
+	-4, 99, 143, 75, 84, -111, 54, 42, 
+	-5, -47, -27, -2, 72, -7, 54, 79, 
+	48, -49, 56, -97, -111, -1, 0, 79, 
+	92, 12, -115, 58, 4, 21, -44, -84, 
+	-31, -80, 93, -19, 22, 89, 42, -135, 
+	45, 77, -61, -21, 76, 2, 90, -26, 
+	35, -15, 32, -68, -90, 111, 106, -10, 
+	59, -104, 96, -77, 33, -12, -22, 19, 
+	-115, -58, 20, 57, -78, 11, 138, -78, 
+	-69, 15, -2, 16, -30, -88, 99, -81, 
+	-66, 227, -84, 85, -82, -83, -78, -41, 
+	-59, -159, 163, -7, 188, 88, 95, 50, 
+	-43, 21, -63, -1, 22, -73, 141, 166, 
+	-133, 64, 19, -60, -7, -15, 56, 39, 
+	76, -83, -39, 47, 121, -29, 42, -9, 
+	-112, 148, -3, 150, 108, 64, 68, 45, 
+	92, 24, 165, 192, 99, 7, 142, 122, 
+	60, -23, 15, 50, 40, 75, -4, 25, 
+	-31, -209, 36, 59, 79, 76, 112, 117, 
+	107, -22, -56, 94, 36, 10, -73, -118, 
+	2, 93, -102, 23, -125, 20, 99, -95, 
+	-42, 64, -59, -19, -2, -104, 4, 141, 
+	-20, 67, 58, -96, 35, -86, 121, -105, 
+	125, 133, 212, 72, 6, -113, -107, 50, 
+	-34, -75, 32, 158, 85, -194, 54, 61, 
+	71, 77, 23, 68, 52, -69, -17, 143, 
+	116, -88, 121, 92, -23, 23, 107, -128, 
+	-35, 100, -2, -4, 20, 219, -86, 177, 
+	-7, 34, 53, -25, -99, 16, 19, 39, 
+	19, 68, -20, -85, -8, -123, -74, -21, 
+	-180, 84, 233, 65, -140, 93, 109, -100, 
+	84, 69, 66, 100, -82, -112, -38, -94, 
+	-64, 103, -52, -28, -62, -99, 71, -41, 
+	-163, -119, -148, -57, 41, -100, 18, 104, 
+	-73, 39, -146, 111, -86, 13, 64, -26, 
+	-106, -106, 207, 0, 65, 21, -2, 79, 
+	-116, -206, 83, -44, 8, -73, -129, 75, 
+	28, -57, -14, -78, 101, 92, 69, -118, 
+	70, -100, 152, 81, 101, -36, -5, -7, 
+	-102, -62, -4, -3, -35, 28, 25, -25, 
+	-93, 103, 76, -14, -64, 54, -46, 66, 
+	-110, -20, 78, 203, 53, 32, -147, -83, 
+	129, -147, 150, 123, -35, 36, -186, 46, 
+	-44, 22, -91, -77, 128, -24, 9, 55, 
+	-77, -28, 44, -154, -68, -45, 131, 50, 
+	76, 19, 259, -68, -20, 146, 42, 107, 
+	84, -78, -154, 22, 115, 63, 66, 82, 
+	22, -49, -29, -117, 74, -34, 133, -16, 
+	-44, -52, 79, -46, -34, 36, -1, 0, 
+	21, 152, 69, -35, 126, 17, 83, -11, 
+	-4, 75, -6, -50, -128, -36, -136, -28, 
+	-124, 102, -55, 46, 178, 18, -86, -7, 
+	-92, -1, -70, 34, 68, -6, 111, -31, 
+	110, -2, -72, 12, 63, 36, 63, -35, 
+	10, 161, -123, 25, -106, 43, 40, 151, 
+	39, 122, -74, 138, 18, 142, 91, -5, 
+	-68, -149, 34, 154, 102, -93, 173, 52, 
+	43, -291, 0, 58, 35, 73, -14, -82, 
+	-19, -154, 133, -61, -34, 58, 195, 80, 
+	-110, -78, 92, 176, 80, -39, 11, -16, 
+	-82, 102, 133, 110, -67, 78, -36, -32, 
+	167, 27, 51, -18, 34, -107, -5, 69, 
+	2, -74, 77, -62, 49, -70, 4, -58, 
+	-66, 64, -6, 37, 13, -68, -157, -11, 
+	35, -42, -38, -28, -85, 74, -28, -144, 
+	-17, -74, -2, 5, -61, -56, 82, -30, 
+	-11, 93, -23, -75, -92, 44, -72, -63, 
+	38, -59, 22, 15, -47, -140, 90, 128, 
+	60, -10, -113, 47, -56, -91, 49, 140, 
+	-55, -98, -111, 75, 62, 46, 23, -54, 
+	-25, -87, -13, 67, 54, -64, -134, 181, 
+	7, -61, -65, -69, -72, 8, -59, 17, 
+	27, -105, 50, 35, -37, 64, -110, 41, 
+	-74, -15, -42, -67, -39, 13, 17, 83, 
+	74, -48, 70, -13, 111, -119, -61, 74, 
+	54, 82, -49, -22, -30, 42, 48, 70, 
+	19, 36, 56, -3, -14, 6, 26, 53, 
+	82, 115, -18, 8, 7, -72, 72, 117, 
+	70, 25, -117, 79, 10, -58, -12, 12, 
+	-107, -21, -7, 45, 34, -34, -47, 32, 
+	-24, -32, 66, -52, 24, -8, -45, -59, 
+	72, 24, 158, 59, 127, -48, 23, -35, 
+	-30, -61, 4, -28, -34, -20, -10, 52, 
+	60, -22, -42, 33, -45, -7, 30, 43, 
+	16, -41, 18, -68, -9, 90, 14, 41, 
+	-46, -54, -12, 70, 64, -62, 27, -69, 
+	-91, -70, 19, 15, -56, 24, 29, -61, 
+	47, -47, 21, 40, 32, -27, 54, -71, 
+	-83, 8, -84, -123, -42, 104, 56, -18, 
+	-8, -139, -102, -74, -118, -169, -66, -17, 
+	-106, 327, 17, -14, -30, 47, 39, -169, 
+	-99, -7, 111, -88, -36, 28, -42, 56, 
+	29, -13, 19, -53, 29, -39, 26, -38, 
+	33, 39, 59, -81, -97, 53, -11, -101, 
+	62, -41, 197, -120, 43, -58, 18, 33, 
+	43, 43, -21, -66, -77, 13, 11, -23, 
+	51, 95, -97, -101, 35, 96, -35, -64, 
+	-8, -15, -25, 28, -40, -99, 29, -34, 
+	9, 21, 28, 37, 18, -33, 22, -64, 
+	-55, 15, -56, -45, -1, -90, 44, 56, 
+	66, -14, -51, -51, 50, -61, 44, -30, 
+	97, 11, -151, -15, -2, 1, 110, -125, 
+	228, 33, -48, -80, 135, -109, 18, 112, 
+	-55, -9, -45, -15, -12, 217, -69, 6, 
+	35, -77, -28, -20, 20, 38, -45, 49, 
+	40, 48, -9, 64, -61, 33, 86, 47, 
+	79, 69, 73, 39, 112, 29, -51, -27, 
+	-34, 133, 30, 65, -16, -145, -31, -5, 
+	-34, 224, -93, -70, -26, 27, -27, -56, 
+	50, -68, -11, 54, 26, 41, -31, 80, 
+	-39, 151, -7, 23, 44, 30, 8, -48, 
+	62, -55, 23, -6, 50, 50, -10, 14, 
+	30, -183, -96, -102, -20, 97, 59, 4, 
+	105, 74, 78, -80, -25, 148, 102, 34, 
+	-67, 89, -75, -120, -100, -86, 133, -45, 
+	-74, 75, 71, 175, -53, 50, -1, -6, 
+	72, -19, 147, 115, 130, 173, -132, -20, 
+	93, 24, -155, 35, 16, -25, -73, -9, 
+	-43, -29, 52, 143, -85, 64, 37, 55, 
+	11, 54, 50, 29, 114, 62, -86, 29, 
+	78, -36, 3, 157, 44, -33, 30, 6, 
+	119, 55, 99, -175, -99, -18, 73, -80, 
+	-111, 50, -150, 34, 50, -142, 75, -33, 
+	-40, 78, 85, 82, -50, 18, -6, -99, 
+	3, 5, 88, 13, -40, 37, 13, -109, 
+	-80, -99, 106, -91, 135, 88, 56, 38, 
+	122, -219, 49, 153, -60, 11, -77, -57, 
+	-48, -150, 74, 7, 46, -69, 62, 36, 
+	75, 229, -55, 17, -38, -66, -147, -100, 
+	80, 148, 20, -62, -219, -18, 64, 108, 
+	59, -33, -133, 25, 50, -138, 66, 37, 
+	-45, 119, 179, 91, -60, 21, 63, 106, 
+	52, -97, 64, 14, -4, -125, 59, 21, 
+	20, -92, 129, 128, -94, -7, 53, 2, 
+	71, 50, -89, -25, 19, -24, -43, 34, 
+	0, 2, -117, 109, 57, 74, 95, 76, 
+	-111, -64, -35, -18, 103, 26, 64, 3, 
+	-29, 173, 78, -48, 65, 11, -126, 20, 
+	-38, -9, -12, 26, -69, 118, 36, 37, 
+	-40, 29, 51, 73, -62, 122, 97, -80, 
+	6, 16, 54, 21, -75, -35, -45, -69, 
+	-14, -37, 132, -3, 204, -109, -13, -17, 
+	20, 50, -29, -37, 0, 22, 73, -65, 
+	90, -96, -60, -101, -103, 92, 56, -13, 
+	-49, 143, 48, 1, 55, 4, 89, 34, 
+	100, 32, 27, 42, -19, -32, 29, -68, 
+	14, 77, 18, -5, 82, 74, -26, -90, 
+	-32, -7, -50, 47, 21, -112, -68, 16, 
+	-27, -64, 42, 3, -22, 59, 2, 31, 
+	93, -145, -15, -19, 120, -101, 76, -28, 
+	141, -43, 237, -68, -143, -63, -119, 135, 
+	222, -154, -79, -11, -98, 23, -99, -68, 
+	-38, -123, 15, 13, 26, 118, 148, -137, 
+	10, -88, -95, -104, 72, 30, 43, -104, 
+	-54, 83, -55, -110, -56, 22, -191, -90, 
+	-59, -7, 279, -19, -39, 51, -11, 79, 
+	104, -30, -121, -32, -47, 74, -87, 60, 
+	-53, 75, -3, 0, 25, -29, -80, -74, 
+	-81, 36, -1, -56, -62, -57, 27, -90, 
+	-9, -18, 13, -13, -59, -93, -21, 8, 
+	-96, -99, -50, -31, 7, -16, -26, -72, 
+	23, -11, 39, -77, 28, -114, 72, -7, 
+	-79, -39, 22, -78, 75, -27, 36, -54, 
+	56, 22, 69, 7, 48, -29, -77, 50, 
+	-41, -1, 26, 42, -74, 38, 73, -30, 
+	-96, -25, -74, 14, -14, 66, -52, -16, 
+	47, 31, -65, 49, 40, 56, 39, -27, 
+	43, -63, -17, 85, 4, 18, 73, -46, 
+	-29, 0, 17, -52, -32, -81, -3, 49, 
+	50, -87, -29, 18, 43, -96, -39, 82, 
+	-2, 23, -110, -82, 15, -69, 15, 25, 
+	81, 79, -66, -75, 68, -34, -106, -53, 
+	11, -30, -101, -85, 14, 19, -78, 41, 
+	48, -29, -81, -89, -71, 23, 76, 13, 
+	73, -5, -66, -107, 27, 45, -47, 70, 
+	31, -58, 44, 8, 69, 19, -3, 16, 
+	77, -23, 0, -81, -17, 61, 47, 42, 
+	-37, -42, -31, 48, 39, 37, 69, 60, 
+	-82, 78, -100, -54, 75, 74, -29, -66, 
+	-78, -12, 29, -79, 47, -3, -85, 50, 
+	59, 14, -99, -93, -36, 30, 74, -92, 
+	-94, -53, 66, 39, -63, 66, -88, -93, 
+	-76, -12, 20, -72, -50, -9, 33, 47, 
+	-37, -73, -28, 9, -85, 54, 61, -13, 
+	-91, -103, -11, -77, -13, 26, -16, 40, 
+	90, -104, -77, -68, -14, -96, 72, 28, 
+	-36, -93, -129, 45, -80, -38, 72, -5, 
+	62, 39, -67, 76, -85, 32, -85, -4, 
+	24, 56, 74, -52, -46, -62, 16, -64, 
+	79, -14, 5, -4, 33, 44, 28, -62, 
+	58, 5, -42, -36, -77, 62, 51, 52, 
+	-19, 31, -7, 50, -79, 82, -92, -13, 
+	-67, -31, 21, -10, 81, -52, 52, 22, 
+	-14, -59, -89, -11, 65, -43, -43, -43, 
+	2, -63, 0, -101, 48, 7, 57, -17, 
+	-80, 37, -69, -99, 21, -80, -54, -94, 
+	14, -84, 29, -101, -36, -95, 81, 55, 
+	-59, 46, -138, -23, -93, 79, 18, 44, 
+	-81, 83, 53, -47, 61, -34, -81, -9, 
+	-67, -37, -45, -51, -46, 64, 21, 69, 
+	-19, -47, -85, -59, -64, 32, -7, 85, 
+	30, 98, 20, -23, -74, -69, -74, -62, 
+	84, 50, -21, -67, 70, 6, -23, -55, 
+	69, -17, -5, 25, 47, -15, -107, -80, 
+	-81, -59, -25, -94, 50, -33, 21, 48, 
+	44, 52, -103, -94, 33, -15, -30, -20, 
+	8, -92, 25, -13, -39, 21, -60, 81, 
+	66, 14, -54, 57, 57, -1, 33, -75, 
+	-11, -7, 41, 47, -75, -53, -86, 77, 
+	-57, -59, 36, -86, 34, -4, 27, 9, 
+	-24, -36, -79, 70, -91, 16, -5, -10, 
+	85, -13, 39, -81, -80, 1, 30, 7, 
+	-67, 47, -86, -77, 18, -80, 61, -16, 
+	-65, -12, -27, -3, 35, -103, 9, -27, 
+	-86, 48, 35, -25, 74, -71, 28, -85, 
+	9, -60, -79, -27, 51, -12, -66, -10, 
+	-63, 24, -63, -81, -102, 26, 78, -19, 
+	-53, -7, 39, 60, -39, -58, 28, 31, 
+	-73, -17, 11, 29, 56, -76, 16, 34, 
+	38, -12, -13, -28, 59, 62, -32, -83, 
+	29, -82, 48, -62, 80, -47, -85, -82, 
+	10, -96, 14, 59, 44, 49, -86, -81, 
+	76, 16, 46, 8, 66, -63, -19, -84, 
+	-72, -53, -22, -95, -70, 44, -5, 52, 
+	-57, 3, -40, 44, -95, 48, 0, -104, 
+	1, -34, -84, -106, -37, 49, -3, -72, 
+	27, -63, -63, 24, 14, -40, 61, -49, 
+	42, -33, -69, -75, 16, -23, 55, 63, 
+	38, -4, 67, -33, -16, 51, -60, -93, 
+	71, 110, -38, -79, -102, 3, -17, 58, 
+	-89, 55, 79, 147, 73, -9, 53, -22, 
+	147, 2, 58, 48, -72, -31, 49, -52, 
+	-110, -60, 34, 62, -48, -57, 24, -9, 
+	-1, 30, -14, 35, -101, 1, -8, -29, 
+	-110, 6, 4, -52, -124, -12, 34, 103, 
+	-9, -63, -9, -15, -15, -90, -56, 20, 
+	-47, 41, 35, 34, -105, 125, -82, -31, 
+	165, 23, -94, 3, 28, 17, 9, -93, 
+	-12, -50, -28, 113, -76, 136, 40, 122, 
+	66, -82, -36, 20, -142, 90, 115, 34, 
+	-42, -6, 26, 89, -33, 178, 53, -88, 
+	75, -99, 42, -42, -36, 9, 50, -86, 
+	-88, 118, 44, -12, -7, 51, 31, 25, 
+	-15, -126, 86, -13, -2, 1, 31, -103, 
+	-71, 99, -92, -22, 68, -27, -63, 134, 
+	-86, 172, 134, 70, 215, 71, -93, 75, 
+	48, -1, -23, -97, -64, 109, 6, 101, 
+	37, -58, -58, 11, 71, 11, 82, -14, 
+	-23, 59, -64, -13, 171, 21, 2, 60, 
+	14, 141, 137, 68, 168, -4, 4, 57, 
+	90, 128, 67, -73, 3, -24, 16, 84, 
+	215, -83, -166, 24, 30, 37, -31, 0, 
+	-1, 23, 62, -19, -15, 106, -22, -81, 
+	41, 90, -56, 54, -48, -43, 117, 22, 
+	115, 62, -83, -118, -83, 61, 18, -82, 
+	30, 8, -45, -168, -22, 5, -76, 16, 
+	-92, 112, 167, -62, 32, -64, -63, 9, 
+	-42, -58, -117, 91, 43, 90, -48, -2, 
+	54, -49, 11, 165, 39, 101, -55, -43, 
+	-90, -3, 7, -127, 47, 49, 16, -11, 
+	-14, -7, -66, 42, 36, -80, -92, 31, 
+	12, -21, 196, -22, 89, 169, 101, 44, 
+	61, 64, 186, 58, 0, 6, 75, -5, 
+	-32, -130, 145, 23, 134, -47, 116, 23, 
+	82, 127, -5, -76, -29, 153, 80, 251, 
+	27, -69, 97, 220, 44, 52, 41, -17, 
+	-53, -61, 175, -37, 60, 69, 18, 102, 
+	55, -18, -49, 26, 147, -2, 6, -78, 
+	32, 15, -6, -57, 56, -45, 45, 147, 
+	75, 20, -40, 1, -5, -148, 73, 20, 
+	11, 209, 32, -74, 21, 112, 43, -37, 
+	33, 215, -78, -110, 14, 53, 101, -130, 
+	58, 100, 73, 92, -4, 154, -54, 21, 
+	-11, 192, 59, 115, -11, 158, -85, -40, 
+	82, 151, 51, 160, 121, 28, -37, 94, 
+	117, -14, 133, -128, 72, -82, 102, -73, 
+	18, 184, -120, 142, 30, 67, 6, 44, 
+	-45, -48, 22, -91, -4, -38, 60, -18, 
+	114, -9, 99, -43, -32, 36, 110, 95, 
+	147, -39, 160, -99, 7, 54, 97, 103, 
+	14, 105, -58, -74, 0, -42, 14, 0, 
+	105, 23, 96, 21, 33, -45, 76, 79, 
+	-46, 0, 32, -80, 41, -119, 51, 18, 
+	66, -37, 54, 56, 164, 18, -67, 84, 
+	35, 80, 139, 26, -51, 6, 20, 30, 
+	38, 63, 71, -31, -134, 15, -112, 19, 
+	-17, 139, -40, 46, 29, 38, 90, 55, 
+	13, -37, 50, 76, 85, 1, 24, -44, 
+	83, 5, -33, -69, 25, -101, 132, 80, 
+	-73, 9, 5, 130, 97, -51, 12, -59, 
+	40, -64, 157, 105, 51, -89, -61, 55, 
+	-150, 130, 30, 21, -152, 49, 89, 113, 
+	-26, -38, 12, -14, -6, 86, -26, 48, 
+	-21, -55, 123, 107, -102, 87, -48, 71, 
+	70, -98, -8, -19, 44, 108, -73, -20, 
+	7, 138, -92, -96, 43, -35, 123, 68, 
+	-39, 94, -35, 63, -64, -108, -112, 13, 
+	109, 33, 83, 145, 29, -11, -133, 61, 
+	104, -1, 11, 53, 120, -30, -99, -65, 
+	43, 129, -55, 67, 129, 61, 110, 7, 
+	87, -105, 132, 83, -18, 6, 58, -210, 
+	-24, 140, 37, -103, 44, -56, 13, 86, 
+	-66, 66, 223, -46, 12, -22, 4, 136, 
+	161, 35, 65, 21, -50, -11, 56, 57, 
+	69, -44, -35, 171, -74, 55, 156, 92, 
+	18, -29, -89, 76, 49, 84, 20, 1, 
+	90, 149, -75, 96, 69, -2, 96, 24, 
+	-123, 122, -59, 83, -39, -72, 11, 194, 
+	47, -61, 100, 109, -90, -16, 63, -7, 
+	92, -39, 32, -104, -44, -40, 69, -108, 
+	-8, -23, 84, 22, -92, 100, 143, -95, 
+	-14, 72, -147, 58, -45, 127, -59, 16, 
+	-33, 62, -19, 77, 65, -21, 101, -34, 
+	-14, 45, -102, -15, -56, -21, -85, -6, 
+	80, 134, -20, 50, -62, -43, -83, -4, 
+	-37, -92, 36, -62, 148, 10, -3, -56, 
+	-35, -64, -25, -68, -25, -33, 115, -21, 
+	165, -89, -24, -12, 121, -63, -63, -93, 
+	111, 85, -207, 1, 117, 171, -58, 180, 
+	44, -60, -138, -56, 15, -35, 29, 139, 
+	72, -22, 3, -17, 89, 209, 71, -53, 
+	216, 10, 101, -59, 41, 122, 136, -94, 
+	85, -80, 117, 57, 69, -19, -25, 108, 
+	21, -59, -364, 119, -46, 104, -6, -158, 
+	94, 49, -97, -86, 89, 92, 107, -43, 
+	-59, 106, -185, -32, -45, -90, 10, -14, 
+	7, 71, -4, 7, 45, -22, -40, -19, 
+	40, 94, 138, -26, 77, -1, 35, 140, 
+	-171, 120, -10, -67, 65, -18, 34, -71, 
+	-33, 22, -36, 131, 106, -23, 22, 32, 
+	107, -42, 105, 155, -52, 35, 25, 180, 
+	48, 54, -149, 54, -160, 38, 70, 91, 
+	64, -10, 118, 60, 17, -26, -7, -90, 
+	3, 56, 156, 32, 86, 30, -12, -27, 
+	-26, 67, -102, 119, -37, -10, 63, -91, 
+	35, -6, 92, 112, 10, -136, 40, 122, 
+	53, -38, -83, 47, 54, -38, 8, -26, 
+	-70, 71, 19, -17, -87, 109, -7, -99, 
+	34, 87, 29, -35, -3, 129, 72, 115, 
+	-53, 1, 52, -7, -56, 62, -44, 17, 
+	20, 82, 110, -11, -27, 25, 126, -52, 
+	-23, -157, -129, 40, -94, -19, 50, -74, 
+	18, 162, 42, 19, 34, 131, 52, -29, 
+	52, 189, 56, 98, 101, 52, 60, 106, 
+	97, 191, -62, 87, -39, -54, -57, 77, 
+	-32, -106, 18, 165, -185, 108, 38, -47, 
+	150, -43, 23, -16, 80, 106, 148, 138, 
+	107, 60, -140, 61, 88, -165, -53, 4, 
+	-42, 76, -44, 107, -102, 158, -61, -9, 
+	-17, 23, -89, -37, -60, -26, 46, 54, 
+	134, -186, 57, -112, -4, -102, -134, 156, 
+	39, 115, 244, -212, 20, 13, -86, -125, 
+	-59, 117, 91, -17, 51, -65, -156, 41, 
+	-47, 76, -45, 75, -53, -121, -51, 128, 
+	-42, -98, 6, 82, 5, 136, -43, -183, 
+	10, -7, -129, -81, -28, -33, 64, 130, 
+	-39, -45, -32, -113, -131, -55, -1, 10, 
+	103, -157, 35, 71, 150, -10, 14, 12, 
+	142, -8, 1, -100, 15, -54, -8, 76, 
+	34, 98, 38, -21, 97, 10, 54, -6, 
+	-19, -160, 87, -110, -47, -101, -68, 21, 
+	-43, 157, -5, -33, -115, -65, -44, 96, 
+	-7, -22, 63, -39, -51, -107, -43, -150, 
+	-99, 156, -43, 10, -58, 4, -12, -71, 
+	22, 55, -15, -114, -49, -34, -77, 43, 
+	-3, -14, 155, -17, 85, -47, -31, 163, 
+	110, -94, 93, -3, 8, 41, -82, 52, 
+	-45, -151, 54, -47, 4, -79, 94, 52, 
+	-43, -108, 56, -49, 144, -166, -12, 130, 
+	81, -72, 194, -87, 59, 20, 47, -53, 
+	-88, -42, 44, 7, -87, -55, -40, -46, 
+	153, -91, 113, 115, -116, 16, 93, 125, 
+	-64, 95, -49, -71, 8, -56, 75, 54, 
+	124, 38, -51, 50, 136, -158, -101, -27, 
+	-14, -1, 61, -52, 32, 83, 21, -73, 
+	113, -123, 71, 116, -30, 51, 143, 15, 
+	3, -68, -34, 130, 72, -43, 39, -63, 
+	25, -100, -72, 18, 98, -26, 38, 107, 
+	-60, 189, -7, 128, -34, -36, -116, 113, 
+	188, 63, -28, 64, -131, -46, -37, -63, 
+	126, -74, 53, 83, -73, 110, 47, 51, 
+	-72, 88, 212, -2, -61, -134, 42, -22, 
+	91, 130, -98, -41, 40, -25, -2, -45, 
+	49, -10, 19, 134, -36, 15, 204, 107, 
+	50, 26, -25, 142, 61, -93, 24, 85, 
+	48, 90, -42, -27, -84, -84, 73, -87, 
+	98, 242, 59, 54, 12, 139, -45, 51, 
+	-71, 64, 109, 55, 10, 97, -63, -4, 
+	42, -23, -73, 91, -54, 92, -22, 64, 
+	-85, 46, 9, 120, 88, 134, 115, 112, 
+	53, 109, -169, 26, 84, -35, 66, 126, 
+	-38, -21, 62, -1, 75, -5, 32, 134, 
+	75, -67, 83, 23, 117, 122, -29, 125, 
+	65, -42, -72, 33, 272, 81, 102, 23, 
+	129, -79, -9, 158, -75, -36, 24, 57, 
+	144, -85, -64, 33, -47, 32, 61, -86, 
+	-6, -36, 39, 17, -10, -17, -105, 49, 
+	-7, 137, -82, -62, 162, -12, -58, -94, 
+	138, -24, 66, 70, 75, -94, -27, 67, 
+	46, -28, 14, -45, 24, 53, 26, -46, 
+	-238, 122, 85, -4, 52, 17, 53, 50, 
+	29, -108, -9, 168, 260, 42, -13, -55, 
+	-38, -3, -68, 202, -18, 263, -179, 74, 
+	74, -86, 39, 11, -35, 1, 103, 82, 
+	13, 19, -63, 25, 2, -139, -39, 9, 
+	13, -63, 205, -160, 77, 90, -12, -5, 
+	206, 38, 39, -21, 41, 3, -82, -55, 
+	-17, 35, 81, -14, 96, 50, 23, 76, 
+	-18, 44, -6, -100, 30, 50, 39, 88, 
+	-16, 146, 81, 37, 159, -71, 7, -69, 
+	-26, 40, -25, -28, 126, 7, 27, 15, 
+	60, -52, 53, -94, 180, 114, -65, 13, 
+	-77, -46, -80, -86, -15, 26, 188, -12, 
+	64, -144, -48, -12, 14, 21, 73, 94, 
+	-18, 93, -2, 10, 145, 76, 127, -74, 
+	50, 112, 32, 126, 33, -19, -43, -127, 
+	93, 32, -46, 0, -107, 46, 30, 41, 
+	7, -50, 34, 115, 60, 3, -92, -26, 
+	99, -47, 104, 223, 4, 71, 152, 97, 
+	79, 35, -3, 15, 43, -98, -43, 125, 
+	-42, 176, 56, 12, -108, -107, -35, 18, 
+	-16, 92, -97, -7, 60, -46, 84, -23, 
+	12, -133, 10, -86, -65, -107, 76, 31, 
+	-11, 28, 144, -121, 10, -84, 98, -35, 
+	6, -26, 65, -23, 78, -25, -107, -2, 
+	33, 92, 56, 53, -103, 3, 35, 18, 
+	-99, -58, -9, 133, -107, 81, -15, -122, 
+	-63, 99, -83, 76, -63, -28, -13, 105, 
+	99, -70, -19, -99, -154, 17, 40, -61, 
+	28, -87, -16, -23, 38, -56, 80, 75, 
+	5, 8, 5, -4, 16, -137, 35, 80, 
+	60, -28, 99, 10, 42, -19, -71, 32, 
+	1, -134, -10, -90, 77, -132, -136, 49, 
+	-64, 106, 6, 30, -181, -35, 165, 19, 
+	43, -99, 55, 18, -77, -3, -20, -39, 
+	-60, 122, -86, -13, 53, -18, -51, 136, 
+	89, 16, 40, 61, 94, -31, 72, 121, 
+	-35, -95, 70, 95, 32, -70, 28, 8, 
+	46, -43, 98, 58, -49, 118, -25, 58, 
+	136, -38, -90, 54, 42, 42, -37, 6, 
+	-1, 2, 68, -57, 166, -102, -79, 69, 
+	224, -55, 57, 29, -38, 68, 0, -67, 
+	-63, 36, -21, -10, 21, -128, -81, 9, 
+	-14, 3, 98, 114, -52, 18, 5, 26, 
+	-16, 146, 71, 55, 102, -79, 95, 73, 
+	-15, -30, -58, 28, 84, -94, 19, 13, 
+	-88, -93, 0, -83, -2, 19, -90, 9, 
+	71, -8, -94, -103, 47, -82, -96, -19, 
+	64, -8, -40, -20, -20, 9, -37, -33, 
+	-75, 15, -29, 77, -87, -86, 35, -94, 
+	31, 33, -48, 78, -112, -61, -29, -54, 
+	59, -25, -83, -65, -93, 59, -12, 64, 
+	11, -67, -10, 18, -30, -66, 13, 60, 
+	-2, 72, 52, 30, 67, -86, -101, 50, 
+	-77, -99, -4, 76, -77, -68, 25, -31, 
+	-23, -39, 50, -70, 46, -41, -48, -73, 
+	59, -107, -6, -8, 41, 50, -77, -37, 
+	-41, 58, -106, -42, 11, -97, -78, 78, 
+	-20, 23, 50, -43, -73, -93, -61, -90, 
+	-79, -91, 10, 63, -31, -110, -69, 71, 
+	-92, -108, -64, -64, -93, 56, 45, -2, 
+	-50, -9, -31, -22, -39, -67, -71, 44, 
+	-90, -80, -66, 62, -84, -37, -88, -23, 
+	-14, -19, 60, -100, -114, -93, -124, 16, 
+	25, -44, -13, -98, -39, -51, 60, -59, 
+	-20, -35, -24, -13, -38, 14, 70, 53, 
+	-16, 14, -63, 45, -70, -88, -100, 41, 
+	25, -40, -74, -18, -26, -63, -97, -67, 
+	38, -23, -91, -76, -65, -50, 38, 51, 
+	-65, -144, -121, -77, -1, 21, -27, -80, 
+	-95, -85, 42, -24, 25, 3, -31, 2, 
+	2, -44, 49, 47, -39, 8, 6, -48, 
+	-66, -12, -48, 24, 10, -57, -14, -89, 
+	3, 49, -66, 43, -14, -85, -99, -32, 
+	59, -3, -52, -21, -70, -104, 2, -76, 
+	-35, 68, -48, 9, -87, -58, -56, 38, 
+	-117, -50, 34, -64, -1, -39, 78, 76, 
+	72, -134, 19, 32, -58, -34, -27, -92, 
+	3, 33, -5, -61, 18, 54, 83, -79, 
+	-74, -37, -71, 67, 51, -70, -14, -84, 
+	28, -47, -14, 47, 65, 36, -19, -35, 
+	13, 8, -90, -1, 67, -105, 77, -25, 
+	26, -55, 36, -72, 78, -34, -110, 29, 
+	59, -71, 65, -27, 73, -54, -37, 14, 
+	45, -46, 19, 44, -81, 33, 20, 78, 
+	-28, -16, 53, -45, -54, -13, 47, 6, 
+	50, 22, -95, -77, 45, 23, -53, 62, 
+	-77, 76, 81, 58, -93, -48, -20, -26, 
+	-43, -88, -57, -74, 26, -71, -46, 37, 
+	-6, 11, -26, 9, -26, -18, -70, -49, 
+	5, -80, -17, -100, -91, -27, 3, -58, 
+	-70, -49, 45, -11, -84, -102, 31, 48, 
+	46, 1, -78, -28, 11, 0, -23, -5, 
+	32, -49, -92, -89, -102, -62, -14, -28, 
+	-20, -67, 18, 55, -106, -13, 51, -18, 
+	53, 34, 4, -112, 66, 79, -12, -123, 
+	-94, 60, -24, 66, 14, -66, -26, -25, 
+	-9, 6, 50, -72, 13, 21, 55, -56, 
+	-42, -72, -33, -28, -22, -13, 3, -95, 
+	22, -4, -103, -99, 47, 38, -27, 1, 
+	-105, -52, 61, 90, -38, -58, 3, -19, 
+	-59, -53, -38, 29, 26, 47, 53, -28, 
+	-114, 41, -12, 39, 57, 15, -55, -103, 
+	-37, 35, 78, -65, 23, 63, 21, 17, 
+	-80, -101, -106, 23, 26, 32, -39, -32, 
+	-7, 9, -23, 62, -16, -79, -36, -68, 
+	-71, 14, -73, 27, -1, -55, 43, 33, 
+	55, 6, -56, -18, -103, -17, 58, -79, 
+	-27, -27, -49, -109, 15, 59, 82, -73, 
+	-21, 38, -94, -28, 52, -133, 12, 40, 
+	-91, 36, -12, 58, -100, 70, -72, 8, 
+	-89, -79, 51, -57, 38, -41, 69, 27, 
+	-71, 11, -46, -2, 35, 30, -83, -79, 
+	-5, -10, -81, 26, -3, -89, 28, -64, 
+	76, -34, -7, -56, -15, 59, 6, -43, 
+	-63, 68, -38, 74, -96, 67, -36, -98, 
+	3, 6, -60, -2, -82, -13, -88, -65, 
+	-46, 125, 41, -23, -35, -65, -83, -12, 
+	57, -8, 88, -57, 4, -154, -9, -94, 
+	-156, 160, 2, 131, 19, 56, -31, 166, 
+	94, 92, 41, 43, 11, -31, 101, -44, 
+	43, 5, 78, 98, 83, 84, -37, 40, 
+	-84, -26, 108, 38, -93, 135, 46, -35, 
+	-16, 1, 21, 81, 62, 73, 33, 30, 
+	93, 43, -47, 15, 24, -79, 6, 16, 
+	-143, -39, -311, -109, -24, -117, 0, -22, 
+	17, 7, 45, -64, 19, -45, -74, -126, 
+	-52, 31, 37, -91, -42, -43, -69, 37, 
+	16, 14, -42, -6, 22, -64, 79, 46, 
+	-49, -95, -179, 125, 42, -21, -118, 35, 
+	76, -173, -5, 10, 43, -5, 3, 28, 
+	200, 20, -120, -79, 133, -16, -78, 189, 
+	77, 78, -80, -79, -106, -33, 43, -43, 
+	49, 150, -12, 29, 22, -172, -94, 118, 
+	-22, 64, 98, 55, 18, -73, -9, -70, 
+	86, -63, -34, 36, -44, 96, -86, -104, 
+	-54, 105, -1, 72, 23, -55, -64, 25, 
+	-91, 86, -117, 37, 83, 18, -72, 109, 
+	28, 139, 51, 100, 46, 22, 0, -151, 
+	40, -23, -32, -72, -33, 17, -47, 120, 
+	-40, -56, -17, 61, 0, -84, 47, 50, 
+	71, -27, -27, 19, 22, -29, 46, -61, 
+	15, 9, -47, 55, 87, 30, -76, -1, 
+	12, 38, 121, -114, 110, 75, -3, 29, 
+	-57, 69, -122, -131, 36, 75, -19, -60, 
+	6, 15, 110, -59, -215, -63, -93, 4, 
+	119, 71, 141, 94, -71, -96, 26, -15, 
+	44, -27, -21, -16, -69, 114, -34, 48, 
+	-23, 17, -22, 17, -40, -88, 88, -18, 
+	-57, -53, 113, -13, 112, 37, -50, 9, 
+	-136, -147, -19, -24, 47, 50, 27, 144, 
+	-80, -77, -96, -40, 48, 34, 32, 76, 
+	61, -69, -75, -169, 9, -93, -204, 31, 
+	140, 90, -6, -185, -17, 34, -44, 121, 
+	-16, 60, -231, -29, -90, -15, -65, -91, 
+	-21, 10, 41, 33, 108, 56, -29, -126, 
+	-7, -13, -141, -98, 49, -106, 35, -85, 
+	94, 116, -35, 29, -10, -51, 117, -75, 
+	-19, -35, -80, 58, 20, 68, 126, 13, 
+	-102, -31, 30, 16, 55, -21, 114, 148, 
+	21, -104, -67, 136, 82, -68, 46, 43, 
+	145, 37, -65, -195, -197, 0, 134, -101, 
+	-101, 133, 22, 28, -132, 58, 60, 16, 
+	-96, -204, -113, 37, -16, 49, 87, -21, 
+	1, 13, 148, -92, -11, -5, -77, -70, 
+	-50, 56, 88, 118, -116, 6, 110, -48, 
+	-61, -35, 16, -90, 17, 114, -16, 125, 
+	195, -35, 17, 111, -89, 8, 55, 80, 
+	83, -143, -47, 78, -15, 118, -58, 51, 
+	-12, 153, 174, -129, 8, -9, 62, -89, 
+	63, 33, -166, 33, -47, -30, 39, 21, 
+	69, 51, -17, 88, 30, 24, 35, 23, 
+	-31, -85, 53, 145, 150, -82, 56, 86, 
+	-22, -5, -72, 49, 85, -84, 125, 19, 
+	-97, 87, 81, 58, -74, 131, -123, 51, 
+	104, 16, -112, -89, 140, -60, -38, -103, 
+	129, -56, -41, 72, -63, 64, -2, 21, 
+	-11, 9, -117, -161, 165, -72, -121, -69, 
+	-46, 13, -63, -79, 128, -34, 67, 9, 
+	-5, 43, 66, 93, 77, 4, 54, -158, 
+	33, -78, -101, 16, 1, 70, -32, -45, 
+	-57, 26, -60, -94, 49, 34, 113, -113, 
+	190, -128, 87, 59, -101, -80, -133, 140, 
+	104, -220, 98, 45, 5, -134, -3, 19, 
+	-36, 153, 2, -17, 116, -31, 90, 61, 
+	-55, 117, -11, 111, 126, 37, 70, 90, 
+	9, -132, 42, -26, -41, -189, 33, 125, 
+	-56, -51, -48, 34, 7, 54, 58, -28, 
+	46, -48, -15, -51, 17, -94, -64, 84, 
+	31, -99, 46, 24, 50, -79, 9, 30, 
+	50, 109, 57, -25, 13, -12, 15, 96, 
+	35, 61, -93, -39, 28, 19, 58, -60, 
+	78, -6, 22, -141, -25, 42, -159, -54, 
+	16, 34, 83, -117, 25, -16, -51, 39, 
+	66, -37, 77, 50, 30, -107, -121, -121, 
+	-27, 67, 81, 91, 89, 85, -16, -137, 
+	41, 74, 47, 16, 13, 45, -4, 102, 
+	-7, 75, -67, -52, -4, 12, -41, -48, 
+	120, -6, -53, 82, -48, -33, 38, -119, 
+	59, -46, -23, 67, -31, 2, 1, 59, 
+	18, -55, -76, -137, -18, -35, -45, 68, 
+	138, 69, -85, 68, 32, 57, 51, -20, 
+	12, 70, 131, -20, -45, -23, -49, 3, 
+	68, 144, -157, 35, 1, 10, 77, 17, 
+	68, 27, 34, -23, 79, 28, -72, -113, 
+	-19, -39, -29, 96, 15, 44, 93, -26, 
+	-19, 33, -25, 42, 14, -61, -12, -82, 
+	-71, -36, 98, 32, 37, 177, -56, 70, 
+	-46, 71, 105, 52, -53, -52, 69, 50, 
+	-100, 59, -67, -2, 44, 3, -33, 55, 
+	42, 189, 55, 26, -46, 72, -58, 145, 
+	-50, 87, -77, -3, 73, 63, 21, 63, 
+	-78, 54, -48, 4, 33, -47, -16, -74, 
+	108, 29, -134, -46, 82, -14, 26, 15, 
+	-173, 110, 72, 84, -9, -22, 98, 77, 
+	135, -71, 65, 72, 72, 45, -72, 26, 
+	125, -58, -111, -6, -115, 39, 62, -75, 
+	51, 0, 57, -125, -20, 127, -38, -25, 
+	-25, 116, -147, -74, 21, -86, 57, -93, 
+	90, -2, -5, 41, -141, -8, -90, 48, 
+	124, 91, -49, 19, 164, 122, -55, 39, 
+	19, 138, -191, 6, -56, -81, 28, -60, 
+	-96, 91, 153, 101, -72, 125, -55, -11, 
+	-4, 47, -82, 32, -78, 48, -120, -97, 
+	122, -148, -60, -13, 24, -165, -114, -111, 
+	-43, 152, -76, -85, -143, 62, -62, -5, 
+	-72, -87, -158, -42, 77, -58, 151, -62, 
+	21, -69, -46, 30, -53, 49, -19, 4, 
+	-29, -89, -87, 143, -98, 21, -44, 4, 
+	-84, -87, 114, 46, 15, 82, 55, 138, 
+	47, -89, -152, 57, -19, -155, -26, 16, 
+	3, -105, 4, -80, 69, -85, 100, 158, 
+	-91, 245, 80, 64, 112, -36, 48, -19, 
+	27, 106, 14, 188, -62, 12, 69, 82, 
+	67, 4, -119, 87, -129, -65, 73, -108, 
+	-1, 34, -176, 65, 40, -15, 17, 95, 
+	-27, -42, 27, -48, -83, -150, 26, 67, 
+	-27, -43, 137, 48, -7, 66, 15, 71, 
+	85, 115, -135, -63, -75, 15, 91, 63, 
+	-28, 157, 30, 29, -13, 171, 131, 72, 
+	2, -51, -86, 33, 21, -38, 84, 9, 
+	51, 39, -54, -147, 5, 134, 94, 43, 
+	54, 6, -109, 23, -46, 59, -30, 38, 
+	-21, -90, -114, -49, -168, 116, -9, -65, 
+	46, -11, 22, 7, -29, -15, -19, -30, 
+	25, 23, -47, -4, 88, 45, 53, -9, 
+	157, -31, 45, -84, 8, -116, -97, -121, 
+	19, 114, -54, -15, 36, 81, -54, -52, 
+	-80, 63, -31, -29, -21, -26, -84, -122, 
+	-23, -49, -12, 88, -14, -96, 30, -28, 
+	65, -133, -63, -39, 79, -71, -53, 90, 
+	110, -75, -39, 31, 158, 0, -24, -58, 
+	-86, -54, -63, -70, 24, -79, -1, -14, 
+	66, -74, -17, 32, 271, 132, 35, -55, 
+	282, 4, 97, -75, -47, -151, -146, 134, 
+	121, -93, 76, 70, -65, 10, 54, 205, 
+	-54, 1, 43, -69, 118, 112, 87, -8, 
+	-23, -6, -179, 17, -153, 163, 253, -30, 
+	-73, -55, 139, -65, 37, -112, -77, 118, 
+	-4, 55, 76, 129, -64, 42, -28, -41, 
+	40, 122, 6, -42, -33, -10, -19, 102, 
+	-68, 63, 93, -15, 78, 37, -81, -58, 
+	21, -37, -96, -72, -81, 55, -50, -103, 
+	2, 64, -84, -59, -86, -56, -40, 80, 
+	-55, -18, 40, 107, 25, -68, 42, -52, 
+	22, 56, -71, -30, 114, -105, 49, 27, 
+	-89, -21, -4, -1, 10, 14, -40, -5, 
+	-11, -72, 7, -50, 38, -38, 56, -89, 
+	-19, 43, -93, -4, -66, -61, 23, 70, 
+	67, -70, -37, 41, -21, 23, -102, -22, 
+	-22, 17, 116, 62, -11, -85, 33, 105, 
+	-102, -66, 10, 38, -2, 4, 61, 45, 
+	-55, 75, -86, -50, 15, 62, -39, -77, 
+	-101, -69, 41, -15, 89, 77, 50, -103, 
+	54, -3, -23, -16, -28, -87, 75, 23, 
+	-58, 43, -55, 61, -28, -31, -13, -88, 
+	-77, -75, 18, 1, 40, -36, 67, -50, 
+	-31, -89, 89, -64, -39, -82, -78, -92, 
+	0, 48, 10, -25, -18, 45, -86, 65, 
+	-64, 49, -51, -68, -62, -22, -6, -8, 
+	-7, -3, 38, 58, -53, -23, 37, 86, 
+	49, -11, 92, 6, 83, -90, -44, 48, 
+	-8, 39, 68, -59, 58, -90, 79, 54, 
+	-38, -16, -29, 90, 43, 81, -35, -79, 
+	-69, -49, -44, -80, -28, 29, -23, -21, 
+	55, 24, -8, 66, -42, -102, 55, -14, 
+	-49, -74, -10, 81, 8, -63, 33, -38, 
+	75, -88, 54, -77, -23, 24, -42, -97, 
+	11, 20, -66, 46, 63, -52, 18, -70, 
+	51, -98, -72, -62, 72, -42, -86, -27, 
+	-64, -90, -19, -22, 33, 0, -92, -42, 
+	35, -61, -7, 31, -96, -70, 83, 71, 
+	-49, -21, -106, -15, 68, 51, -58, 11, 
+	-101, 8, 11, 19, -5, 53, 60, -103, 
+	-45, -49, 32, 126, 5, -1, -109, 19, 
+	3, -96, -37, 25, -56, 63, 38, -56, 
+	-77, 76, 27, 39, -77, 23, 33, 71, 
+	-97, -35, 19, -42, -19, 34, 5, 12, 
+	34, -9, -78, -68, 12, 37, 47, -72, 
+	-18, -8, 81, 15, -87, 54, -48, 26, 
+	-13, -31, 36, 15, 51, 16, -83, -15, 
+	-104, -45, -46, -89, 50, -24, 48, 49, 
+	77, -99, 68, -1, -55, -79, 82, -99, 
+	13, 68, 0, 17, 79, -19, -26, 12, 
+	64, 113, 19, 26, 39, 66, 59, 80, 
+	12, -3, -10, 4, 62, -8, -56, 70, 
+	-80, -85, 0, -65, 9, -102, -97, -59, 
+	-105, 53, -43, 2, -42, -90, 51, -35, 
+	-52, 66, -100, -2, -1, -25, -100, 43, 
+	75, -103, -44, 52, -81, -87, 61, 59, 
+	-72, -106, 69, -94, -98, 12, -89, -56, 
+	-65, -67, 85, -84, -64, 26, 14, -99, 
+	-106, 22, -22, -101, 75, -12, 68, -92, 
+	-100, 10, -14, 82, 36, 11, -15, 26, 
+	3, -28, -72, 68, -54, -38, -13, 94, 
+	-34, -5, 72, 68, -68, -62, -63, 104, 
+	-39, 72, -114, -30, -34, -72, -92, 33, 
+	-7, -95, -59, -41, -89, -59, -76, -38, 
+	-69, -32, 6, 76, -85, -67, -75, -65, 
+	-76, 1, -61, 21, -52, 17, 53, 14, 
+	28, -34, 45, -56, -65, -16, 42, -35, 
+	-81, -32, -52, 52, 36, 13, 3, 4, 
+	-16, 47, 37, 47, -47, -102, 40, -97, 
+	-44, 58, -58, -55, -100, -98, -83, 40, 
+	-55, -7, -105, -91, -92, 15, -71, 65, 
+	-22, 2, -103, -114, -110, -7, 23, 38, 
+	-77, 56, 59, -16, -19, 59, -56, 26, 
+	-106, -18, -58, -33, 45, -83, 70, 51, 
+	-51, 54, -2, -26, -92, -49, -86, 44, 
+	-52, -95, 86, -64, -36, -5, -9, 2, 
+	74, -70, 57, -54, 43, -22, 0, -104, 
+	-77, 56, -47, -91, -99, -49, 0, -48, 
+	5, 5, -104, -7, -39, -59, -51, -70, 
+	-35, -32, -99, 33, -146, 33, 130, -79, 
+	43, 19, -200, 127, -79, -84, -114, 18, 
+	-119, 77, -111, -87, -35, 8, -62, -151, 
+	55, -24, 71, 135, -7, 37, -81, -55, 
+	-145, -98, 85, 14, 40, 16, -191, -36, 
+	-42, -241, 24, -8, -124, -45, 111, -7, 
+	-25, -54, 74, -117, 105, 111, -4, -46, 
+	-6, 16, -106, -41, 8, -116, -26, 42, 
+	-102, -186, -117, -69, -98, -104, -43, -39, 
+	-29, -183, -104, 88, -22, -159, -190, 53, 
+	-199, 23, -18, 13, 1, -16, -117, 15, 
+	-76, 78, -108, 14, -101, -24, -47, 1, 
+	31, -139, 17, 3, 258, -59, 39, -65, 
+	-54, -273, 28, -54, -16, -110, 38, 99, 
+	86, -23, 60, -78, 13, -21, -119, -53, 
+	-24, -53, -128, -162, -71, -24, 9, -11, 
+	-17, 98, -17, -28, -98, -61, -84, 84, 
+	-48, 33, 71, 44, -29, 38, 178, -32, 
+	83, 25, -22, 3, -63, 35, 8, -125, 
+	21, 46, 39, 90, 14, 18, 33, 47, 
+	-46, 92, 113, -35, -119, -3, 69, -64, 
+	-143, 193, -67, 26, -57, -46, -102, -35, 
+	-38, 69, 70, -121, 60, 104, -105, 27, 
+	130, 131, 31, -15, -40, -88, 15, 22, 
+	66, -84, -35, 59, -67, 62, 70, 94, 
+	-142, 181, -98, -63, -164, 134, 41, -8, 
+	141, -112, 2, -289, 65, -8, -76, -7, 
+	35, -150, 56, -281, 9, 98, 139, -79, 
+	-9, -89, 84, -153, 4, -92, -83, -94, 
+	51, -42, -12, -59, 136, 50, 3, -106, 
+	-16, -7, 83, -208, 70, 167, 148, -106, 
+	2, -31, 106, 127, 89, -13, 24, 71, 
+	-16, -102, 142, -74, 36, 108, -35, -35, 
+	107, -30, 131, 91, -35, -94, -151, -75, 
+	-141, -242, 136, 50, 45, -35, 2, -95, 
+	68, -96, -129, -196, -89, -78, -95, 105, 
+	-12, -60, -66, 73, -111, 108, -6, 48, 
+	-15, 16, 194, -17, 73, 75, 11, -146, 
+	101, 89, -73, 91, 95, -48, -37, 19, 
+	28, -41, -98, -96, 91, -123, -75, 41, 
+	186, 104, -57, -35, -44, -39, -43, -27, 
+	-54, 12, -35, -31, 29, 70, 69, 114, 
+	46, 104, 15, -165, 110, 119, -54, -87, 
+	16, 60, -54, 30, 18, 77, -45, -85, 
+	197, 30, 28, -54, -84, 96, -21, 65, 
+	-103, 68, -52, -80, -4, -24, 85, -77, 
+	-27, -109, -61, -91, 140, -150, 6, -90, 
+	-127, 128, -102, -60, 21, 78, -116, -63, 
+	-13, 0, 73, -104, -96, -85, 60, 44, 
+	-142, 7, -86, 81, -11, -46, -46, -86, 
+	-8, 116, 10, 144, -35, 81, 79, 37, 
+	31, -37, -24, 3, 125, -70, 57, -25, 
+	58, -228, -32, -29, 188, 122, 102, 34, 
+	4, 53, -136, 29, -33, -104, 77, 15, 
+	10, -97, 28, 32, -87, 103, 93, -47, 
+	12, 74, 94, 131, 121, 73, -50, -170, 
+	-59, 43, -67, -18, -9, -16, 10, -59, 
+	19, 130, -160, 27, 80, -83, 32, -175, 
+	-135, -33, -21, 104, 23, -24, -29, 97, 
+	-41, 47, 27, 34, -27, -110, 135, 77, 
+	-115, -106, -18, -14, 145, -76, 90, 61, 
+	28, -87, -191, -45, -42, -82, -51, 112, 
+	-110, -52, -59, 54, -160, 23, 64, -10, 
+	-58, -59, 56, -16, -32, -89, 20, -150, 
+	32, -13, 3, 92, -79, -30, 30, 14, 
+	-9, -95, -291, -13, -64, -6, 81, 43, 
+	136, 39, 71, 31, -59, 30, 66, 36, 
+	48, 51, -36, 27, 76, -81, -66, -35, 
+	59, 16, -51, 82, -44, -58, 51, -5, 
+	123, -8, 22, 35, 109, -68, 20, 85, 
+	57, -61, -147, 76, -115, -6, -36, -26, 
+	81, 51, 127, -62, -158, -28, -39, -79, 
+	119, -25, 23, 21, 95, 39, -58, -78, 
+	-126, 50, 75, 69, -72, 146, 110, 20, 
+	94, 37, 8, -104, -11, 23, -35, 37, 
+	-29, -35, 41, -85, 53, 50, 29, -20, 
+	-8, -137, 17, 70, -24, -118, 75, -4, 
+	20, 151, -141, -14, 60, 107, 52, -21, 
+	43, -19, 48, -11, -60, -16, 3, 10, 
+	155, 111, 43, 117, 66, -56, -125, 35, 
+	56, 46, 133, 39, 58, -76, 76, -161, 
+	-48, 7, 48, 31, -19, 168, -38, -7, 
+	-17, -51, -154, 55, -40, -51, 30, -35, 
+	-11, 20, -137, -98, -18, 35, 66, 62, 
+	-56, 76, -13, 1, 79, -52, -14, -86, 
+	-28, -22, -96, -121, 126, -28, -137, -63, 
+	22, 34, 88, -28, 63, -89, -77, 7, 
+	31, 121, 23, 119, 119, 61, 61, 47, 
+	-25, 49, 222, -27, 8, 77, -98, -2, 
+	71, -29, -62, 64, 81, 22, 69, 144, 
+	47, 32, 44, 47, 22, 49, 22, 53, 
+	0, 136, -75, 158, 36, 205, -23, 88, 
+	5, 180, 126, -9, 315, 178, 60, -14, 
+	17, 135, 142, 115, 85, -34, -24, 158, 
+	88, 104, -132, 29, -15, 181, -95, -80, 
+	-3, 72, 66, -78, 13, 51, -50, -169, 
+	92, 161, 74, 28, -51, 51, 161, 61, 
+	55, 15, -146, -62, 75, 24, 31, -33, 
+	-87, -19, 108, -40, -63, 62, 88, 117, 
+	79, 25, 33, 95, 102, -143, -136, 88, 
+	-88, -51, 47, -82, 220, -93, 134, 41, 
+	-78, 82, 34, 188, 18, 159, 41, 12, 
+	-33, -57, 2, 119, -4, -37, -3, 45, 
+	89, -40, -92, 59, 74, -21, -137, -27, 
+	-21, 81, 235, -30, 106, 101, 30, 51, 
+	-18, 136, -63, 72, 44, 1, 56, -73, 
+	18, -28, 131, 93, -98, 49, 35, 1, 
+	96, 44, -37, -52, -49, -113, -54, 57, 
+	109, -264, -56, 210, 121, 77, -53, -53, 
+	-104, 16, 110, 21, 154, 45, -100, 13, 
+	-64, -85, 135, 28, 162, 52, 13, 124, 
+	6, -14, 16, -63, 45, 92, 103, 70, 
+	90, -67, -160, -24, -28, -135, -69, -68, 
+	-42, 25, -70, 46, 145, 43, 119, -30, 
+	108, 198, 105, -109, 102, 28, 30, 81, 
+	-5, 143, -54, 18, -25, 74, -11, 95, 
+	141, 280, 178, -30, 81, 164, 29, 57, 
+	13, 175, 108, 121, 133, -64, -72, 41, 
+	221, 70, -161, -73, -18, -34, 99, -14, 
+	90, 65, -123, -90, -98, 49, -23, -68, 
+	61, -89, 99, -15, -35, 0, -23, 99, 
+	-71, -106, -8, 0, -49, 109, 125, 110, 
+	150, -71, -22, -30, -22, 10, 93, 85, 
+	93, -47, 3, -102, -34, -27, -10, 71, 
+	42, 32, 29, 97, -118, -100, 37, 79, 
+	40, 38, -15, -44, 26, -90, 125, -1, 
+	97, 63, -2, 82, 86, 82, -67, 64, 
+	78, 20, 69, 39, 22, 9, 46, 47, 
+	-97, 71, 27, 73, 6, -15, 127, 118, 
+	-76, 172, -18, 93, -90, 7, 14, 46, 
+	-52, -24, -69, -14, 136, -68, 19, -47, 
+	122, -8, 132, -16, 33, -117, 162, -31, 
+	-132, -4, -97, 21, 152, 17, 133, 20, 
+	85, -136, -110, 16, 25, 8, -17, -32, 
+	9, 93, 49, -43, -158, 141, 105, -40, 
+	32, -37, -43, 45, -59, 13, 103, -67, 
+	-43, -20, 65, 18, 70, 27, -114, -33, 
+	3, -145, 41, 34, -18, -8, -30, 15, 
+	112, -69, -21, 7, 0, -49, -52, 0, 
+	-57, 127, 55, 3, -46, 13, 59, -91, 
+	59, 30, -31, 272, -96, -30, -18, -61, 
+	88, -128, 34, -88, 96, -112, 81, 36, 
+	15, 99, 150, 106, 64, 82, -63, 22, 
+	-23, 40, 46, 106, -5, -132, -73, -63, 
+	21, 142, -121, -80, 9, -1, 20, 95, 
+	28, 49, 181, 38, 95, 30, 7, 19, 
+	204, 45, 247, 89, 22, 113, 55, -23, 
+	22, 36, 132, 78, -1, -34, 104, 63, 
+	116, 2, -35, 82, -40, -27, 65, 80, 
+	5, 397, -1, 33, -34, 124, 76, 32, 
+	-122, -22, 11, 97, -95, 37, -80, 167, 
+	-51, -36, 157, 44, -111, 11, 22, 52, 
+	50, 71, 112, 29, 70, 59, 53, -33, 
+	-119, 41, 253, 26, -64, 50, -69, -3, 
+	25, -142, -123, 63, -107, 39, -23, -117, 
+	11, 47, 5, 30, -59, 42, 89, -112, 
+	-27, 21, 95, -85, -141, -166, 109, -128, 
+	-86, 140, -56, -118, -58, -55, 3, -132, 
+	-83, -33, 45, -95, -40, -181, 46, 53, 
+	-8, -110, -97, 66, 20, -13, 45, 131, 
+	106, 78, -15, -76, 7, -126, -54, -63, 
+	188, -31, 127, -111, -74, 78, 13, 212, 
+	-98, -122, -58, -62, 21, -52, -17, 21, 
+	-56, -111, 38, -96, 11, -8, 7, -145, 
+	112, -25, 107, -62, 46, -37, -82, -13, 
+	8, -31, 135, 5, -61, -56, -87, -204, 
+	-5, -69, -106, -63, 26, 102, -87, -145, 
+	45, 46, -63, -40, -1, 38, 49, 41, 
+	-27, 95, -71, -9, -9, 101, 5, 63, 
+	153, -19, -54, 45, 57, 14, -24, -52, 
+	-54, -58, 59, -26, 66, -54, -70, 123, 
+	-112, 92, -49, 77, -52, -33, 14, 37, 
+	10, 35, -79, -135, 2, 5, 13, 53, 
+	23, -28, -88, 64, -86, -215, -107, 25, 
+	-13, 91, -3, 30, 33, 64, 103, 14, 
+	-137, 55, 50, 69, 66, -23, -36, -12, 
+	60, 103, -13, 128, -17, 19, -157, 67, 
+	2, 186, -147, -65, 87, -96, 83, 21, 
+	-7, 41, -35, -32, -31, -67, -17, 54, 
+	-46, 78, -78, 58, 86, -93, 72, 98, 
+	-89, -10, -49, -71, -50, 38, -31, -40, 
+	-99, -35, -144, 0, 58, 42, -39, -88, 
+	-4, -13, -22, 77, 56, -57, -134, 115, 
+	43, -77, 79, -5, 122, -109, -105, 2, 
+	130, 53, -57, -54, -6, 104, 43, -75, 
+	139, 51, 16, 54, 74, 32, -118, 2, 
+	-47, 152, 0, 1, -92, 92, -4, -106, 
+	-57, -213, 55, -31, 90, 1, -30, 81, 
+	-7, -62, 33, -86, -54, 34, 33, -9, 
+	-19, 153, -18, 84, 164, 5, 116, -19, 
+	98, 45, 265, -36, 80, -118, -64, 5, 
+	117, 65, -26, -79, -100, 147, -117, 44, 
+	-27, -142, 0, -22, -4, 32, -34, -68, 
+	63, -62, 147, 101, -65, -34, 7, 28, 
+	50, -127, -29, -77, 37, 60, -78, 13, 
+	-13, 60, 99, -48, 42, -24, -47, 70, 
+	-85, 76, 34, 83, -88, 78, 78, -29, 
+	-66, 7, 16, -49, 1, -45, 32, 36, 
+	-50, 50, 60, -39, 221, -60, -108, 135, 
+	49, -43, 105, -62, 19, -49, 20, 93, 
+	25, -157, 112, 20, 85, -75, 108, 55, 
+	-92, -76, 6, 34, -41, 15, -61, 9, 
+	83, -44, -79, 44, 34, -6, -16, -47, 
+	-88, 5, -135, -60, 68, -8, 2, -13, 
+	80, 123, 62, -169, 28, -54, -97, -21, 
+	7, 67, -26, 4, 89, -71, -48, -27, 
+	58, 125, 54, 127, -94, 79, -8, -63, 
+	-27, 94, -114, -17, 0, -3, -26, 37, 
+	-58, -149, 95, -2, 41, -21, -111, 10, 
+	-93, -103, 39, -74, -11, 73, -51, 43, 
+	-109, -66, -123, 71, 48, -4, 107, -33, 
+	22, -64, -144, 41, 23, -52, -56, -37, 
+	-4, -138, -25, 22, 27, 92, 4, -51, 
+	-60, 74, 1, -37, -57, -13, 48, 37, 
+	-56, -47, 102, -52, -45, 57, -40, -49, 
+	-47, -56, 71, 144, 21, 38, 59, 50, 
+	-45, -62, -95, -70, -95, -29, -44, 88, 
+	-51, -56, -89, 76, -42, 6, -9, -83, 
+	-75, -73, -93, -60, -41, 0, -57, -32, 
+	-73, -49, -36, 18, -38, 82, -28, -54, 
+	78, 38, -45, 28, 3, -10, -81, 45, 
+	0, 9, 9, -94, 57, -50, -68, 6, 
+	-56, 48, -24, -34, -47, 95, 54, 48, 
+	-38, 64, -3, -38, -90, -68, -82, 59, 
+	16, -43, 40, -62, -68, -3, 38, -68, 
+	-53, -67, -123, -81, -44, 66, 73, 11, 
+	-84, -51, 17, -59, -98, -80, 57, -93, 
+	-13, -83, -136, -42, -37, 60, -37, -10, 
+	33, 45, 79, -79, -54, 24, -30, -19, 
+	61, 63, -3, 27, -60, 32, -13, -89, 
+	-54, -26, -53, 78, -44, 23, -46, -34, 
+	-97, -100, -87, -87, -42, -85, -79, -16, 
+	69, -10, -112, -98, -25, -28, 52, -81, 
+	-72, -54, -28, -99, 5, -74, -86, -45, 
+	-79, -116, -59, 14, 31, 63, 86, 65, 
+	3, -35, -97, 45, 9, -40, 28, -39, 
+	-97, -8, 48, 11, 19, -67, -19, 43, 
+	79, -48, 21, -31, -98, -25, -31, 61, 
+	-8, 1, -8, 19, -86, 18, -89, 1, 
+	30, -25, -19, 75, -71, 24, -6, -90, 
+	5, -24, 52, -53, 60, -19, 30, 12, 
+	-92, 5, -17, 54, -87, -82, -53, 6, 
+	57, 36, -73, -51, 1, -5, -82, -108, 
+	58, 4, 44, -86, 84, 69, -56, -99, 
+	-11, -40, -52, 37, -59, 10, -7, 56, 
+	-11, -82, -81, -4, -40, -44, -104, 3, 
+	30, -69, 4, 62, 49, -22, 47, 44, 
+	-124, 33, -65, 89, -30, -85, 59, 40, 
+	-30, -3, -86, 59, -52, 8, 1, -39, 
+	-102, -40, -29, -25, -92, 57, 25, -13, 
+	-144, -38, -29, -96, -69, 69, -56, -62, 
+	55, -47, 40, 56, 50, 26, -5, -26, 
+	-67, 1, 50, -83, 44, 53, -100, -92, 
+	-49, 42, -77, -80, -85, -41, -28, 7, 
+	11, 29, -96, -93, -93, -16, -31, 58, 
+	-91, 12, -31, -115, -80, -89, -49, -48, 
+	82, -38, -67, -93, 11, -81, 70, -126, 
+	69, -19, -52, -80, 1, 39, -115, -147, 
+	-128, 10, -48, 50, -20, -90, -70, 56, 
+	-91, -63, -123, -34, 15, -4, -8, -73, 
+	76, 51, -81, -99, -33, -56, 3, 43, 
+	34, -79, -116, -11, -5, -48, 71, -16, 
+	44, -92, 64, 44, -20, -24, -42, -35, 
+	-80, 64, 27, 6, -120, 27, -17, 49, 
+	-20, -46, -74, -80, 6, -44, -64, -26, 
+	17, -8, -30, -21, 25, 21, -11, -102, 
+	-55, 86, -6, 66, -6, 63, -86, -35, 
+	-9, 51, 21, -24, -54, 19, -37, -18, 
+	-87, -102, -29, -68, -47, 27, -14, -80, 
+	-35, 35, 38, 34, 84, -12, -17, 12, 
+	-89, -105, -25, 76, -127, -46, 74, -45, 
+	-49, -87, 50, -85, -7, -27, -35, -15, 
+	30, -1, 0, -59, -24, -18, -61, -47, 
+	4, -44, -85, -40, -78, -20, -80, -47, 
+	6, 55, 41, -97, -1, -95, -27, 55, 
+	21, 37, -104, -45, 15, -42, -55, -21, 
+	1, -66, -35, -126, 22, -130, -106, 66, 
+	85, -123, -37, 32, 31, -27, -20, -15, 
+	-46, -11, -4, -4, -8, -30, -69, -93, 
+	15, -153, -12, -85, -53, -50, 43, -20, 
+	-81, 39, -70, -3, 42, 34, -90, 81, 
+	54, 41, 38, -61, -112, 12, 16, -111, 
+	-8, 2, 24, 43, 80, -51, 0, -11, 
+	-113, 7, -88, 24, -97, 51, -111, 65, 
+	-41, 8, -33, -5, 43, -70, -80, -74, 
+	-56, -44, 12, -63, -32, 24, -118, -30, 
+	-90, -86, 15, -70, 6, -54, -22, -36, 
+	-83, -17, 26, -42, 46, -88, 11, -82, 
+	55, -31, -20, 21, 11, -124, 64, -88, 
+	-13, -73, 49, -1, -47, -36, -5, 31, 
+	-37, -59, 30, 77, 130, 125, 77, -46, 
+	-26, 15, -11, -74, 50, -37, 65, -32, 
+	18, -24, -10, -28, -26, -6, -82, -70, 
+	-35, 4, 89, 57, -17, -89, 34, -70, 
+	124, 49, 225, -26, 6, -88, -12, 36, 
+	25, -52, 9, 26, -16, -21, 10, -16, 
+	82, 94, -6, -89, 71, 6, -36, 44, 
+	44, -33, 56, 20, 115, -68, 91, -24, 
+	101, 6, 183, 43, -33, -10, 147, 137, 
+	2, 43, 6, -70, 31, -46, 42, -64, 
+	11, 101, 100, -31, -63, 51, -53, 50, 
+	90, 291, 41, 58, 42, 26, 24, -46, 
+	18, 47, -31, 69, 16, -20, 98, -136, 
+	-37, -3, -41, 78, 16, 54, 68, 41, 
+	105, 73, -34, -34, 27, 207, 184, -32, 
+	-41, 82, -1, 51, 30, 110, 20, 150, 
+	-59, -5, -14, -29, -79, 108, 49, 95, 
+	63, -78, -15, -62, 128, -16, 126, -66, 
+	177, -75, 80, 31, -37, 25, 84, -64, 
+	-10, -28, -77, -47, -10, -24, 63, 35, 
+	108, -90, 129, 113, 89, -109, -13, 33, 
+	-38, 38, -67, -61, 47, -48, 126, 120, 
+	-143, 16, -186, -5, 18, -43, 17, -79, 
+	71, -47, 64, -52, 12, -131, 21, -45, 
+	-99, -16, 19, 53, -49, -146, 52, -46, 
+	51, 115, -67, 23, -104, -117, -142, 52, 
+	-86, 44, -53, 244, 57, 6, -95, -49, 
+	73, -5, 166, 73, 33, 53, -144, 0, 
+	33, 78, -41, -30, -98, -100, 44, 94, 
+	-39, 6, -100, -71, -168, -82, -48, 38, 
+	1, -119, -243, -58, -8, 72, 3, -24, 
+	96, -81, 23, -47, -7, 112, 106, 99, 
+	12, 39, -89, -72, 76, 49, -74, 87, 
+	-111, -16, 19, -46, 113, 58, -10, 91, 
+	51, 174, 96, 3, 125, 105, -78, -54, 
+	75, 102, -44, 19, 37, -83, -133, 131, 
+	33, -34, -74, -74, 28, -30, 47, 66, 
+	21, 24, 4, -2, -21, 69, 5, 20, 
+	-43, 33, 211, -67, 27, 10, -31, 32, 
+	-59, 6, -5, 66, 39, -8, -15, 133, 
+	-103, -9, -72, 143, 32, -52, -24, -35, 
+	142, 22, -68, -33, -17, -83, -76, 94, 
+	-206, -121, -190, 187, 145, -133, 9, 72, 
+	36, 15, -46, 29, 19, 207, 226, -77, 
+	52, 41, 271, 52, 172, -9, -57, 253, 
+	-78, -80, 140, 20, -38, -91, 49, -19, 
+	24, 118, 11, 49, 12, -58, 77, 16, 
+	69, -112, 141, 137, 60, -9, 30, -105, 
+	-179, 16, 142, 60, -57, 8, -77, 13, 
+	-64, -11, -39, 86, -44, -124, -102, 9, 
+	-71, -7, -56, 11, 64, -29, -96, -5, 
+	41, -27, 116, 124, 63, 131, -60, -71, 
+	-80, -16, -107, 64, -94, -121, -89, -24, 
+	-41, 26, -96, -6, -62, 2, 91, -119, 
+	89, -32, 49, 90, 142, 53, 112, -47, 
+	84, -244, -25, 150, -10, -130, -79, 26, 
+	-107, -85, 62, -120, -85, 3, 2, 107, 
+	72, 67, -55, 35, -7, -93, -117, 35, 
+	100, 43, 16, 2, -55, -16, 61, 21, 
+	76, -98, -197, -83, 33, 37, 66, 95, 
+	7, -11, -12, -22, 172, 36, -12, 88, 
+	-39, -36, 58, 80, -105, 67, -96, 107, 
+	4, 40, -86, -63, 106, 55, 244, 56, 
+	-4, 39, 90, -11, 2, -102, 0, 28, 
+	1, -168, 76, 26, -82, -57, -47, -4, 
+	-30, 24, 157, 34, 132, -92, 140, -13, 
+	21, -73, 34, -6, 66, 7, 200, 95, 
+	-137, 4, -15, -65, -144, -5, -81, -15, 
+	-104, -77, 18, 102, -51, 183, 14, 17, 
+	2, 54, -26, 35, 159, -69, 111, 62, 
+	-2, 30, 65, 35, -35, 88, -53, 63, 
+	54, 52, 64, -58, 81, 2, 28, -16, 
+	78, 14, 85, -68, -80, -102, -33, 1, 
+	64, -14, 11, -92, -101, -79, -65, 0, 
+	-17, -102, -52, 31, 40, -105, -132, 87, 
+	8, 94, -105, -15, 6, 5, -130, 45, 
+	-99, -35, 88, -1, 72, -41, 82, 49, 
+	21, -96, 56, -131, 83, -159, -5, 77, 
+	34, -157, 24, -80, -36, 3, 52, 10, 
+	-50, -78, 44, 99, 64, 50, -133, 105, 
+	-40, -142, 37, -109, -1, -113, 13, -10, 
+	-20, -91, -124, 1, 42, -39, -21, -107, 
+	-34, -91, -49, -129, -24, 6, -9, -126, 
+	70, 93, 27, 7, -69, -47, -174, -57, 
+	-6, 1, -159, 10, -55, -11, 79, -143, 
+	-24, 70, -51, -76, 14, -19, -1, -45, 
+	48, -39, 20, 24, 6, 99, -18, -43, 
+	-23, -89, -59, -10, -10, -28, 40, -76, 
+	-122, 15, -1, -136, 90, -6, 172, 67, 
+	-69, -130, -62, 67, -55, 18, 89, -34, 
+	-50, -107, -22, -106, -78, 5, 27, -7, 
+	-74, -82, -6, -92, -59, -76, -127, -16, 
+	144, 38, -71, -32, 22, -61, 72, 37, 
+	-67, 31, -153, -34, 124, 84, -2, -65, 
+	52, 3, 61, 92, -44, -130, -40, -67, 
+	-146, 9, -29, -94, 29, -18, 53, -38, 
+	22, 30, 2, -5, 25, -83, -99, -59, 
+	-55, -4, 127, -46, -80, -62, 25, 71, 
+	89, -107, -6, -172, -14, 96, -84, 84, 
+	-48, 52, -25, -25, -59, 6, 17, -106, 
+	11, -91, 84, 18, -74, -119, 35, -60, 
+	11, 93, 94, -2, 56, 111, 46, -96, 
+	-61, -91, 32, -1, 110, 6, -69, 2, 
+	21, 52, 134, 34, 23, -66, -37, -29, 
+	-40, -100, -146, -143, 50, -94, -116, -92, 
+	-62, 112, -126, 112, -50, 35, -21, 92, 
+	-60, 96, -96, -1, -36, -89, 5, -24, 
+	-31, -11, -3, -7, -74, 92, 67, 102, 
+	-68, -24, -79, -9, 13, 3, 18, 31, 
+	18, -28, 3, -117, -81, 71, -67, 56, 
+	36, 74, 35, -92, -83, -89, 15, -115, 
+	-46, -81, 84, 82, -36, -57, -66, 8, 
+	108, -132, -11, -57, -35, 42, 37, -61, 
+	-10, -12, 14, -115, -31, 43, 6, 36, 
+	-11, 5, -17, 143, -92, 24, -56, 4, 
+	27, -132, -70, -82, 36, 20, -4, -74, 
+	-22, 145, 118, -43, 20, -71, 55, -48, 
+	50, 7, -77, 23, 9, -59, -73, -52, 
+	-100, -49, 88, -9, 77, -40, 38, -35, 
+	-15, 18, 48, -9, -20, 43, -118, -80, 
+	45, -106, -86, -93, -123, 49, 116, 39, 
+	-83, -84, -56, -52, -39, 11, -23, -62, 
+	-57, 3, 11, -109, 62, 4, -128, 11, 
+	-91, -59, -17, -160, -76, -47, -108, -23, 
+	41, -44, -87, -119, 27, 57, -92, -41, 
+	-79, -120, -33, 26, 49, -118, -111, 16, 
+	-63, -39, -87, -17, -94, 1, 12, 22, 
+	48, -94, 26, 18, -124, -47, -164, -1, 
+	23, -66, -61, -8, -144, -59, -37, -96, 
+	-42, -213, -43, -133, -116, 64, -5, -86, 
+	-78, 14, 22, 11, -50, 15, -11, -84, 
+	-52, -124, -49, 45, -10, 8, -99, 9, 
+	-50, -67, 56, 11, -3, -69, 32, -82, 
+	9, 63, 7, 72, 54, 25, -13, 30, 
+	-97, 77, 35, 66, 2, 59, 0, -40, 
+	-24, 1, -93, 16, -80, 17, -85, -25, 
+	-102, 71, -15, -42, -40, 19, 2, -10, 
+	-6, -56, -38, -44, -40, -20, -35, 76, 
+	-49, -59, -78, -27, 0, 21, -20, -15, 
+	27, -103, -18, -39, 47, 121, 81, -55, 
+	32, -95, -32, 84, -176, 68, 78, -122, 
+	-28, -50, -112, 117, -82, -19, -46, -39, 
+	5, -56, -71, 35, 64, 86, -5, 40, 
+	-37, 24, -71, -65, 3, -40, 43, 18, 
+	16, -107, -53, 18, -45, 53, -26, 25, 
+	-24, -94, 62, -85, -70, -19, -1, -73, 
+	-40, 7, 32, -40, 15, -77, -66, 46, 
+	-60, -68, -45, 24, -30, 38, 13, -14, 
+	-39, -5, 44, 30, -40, 81, -78, -116, 
+	-22, -82, -4, -9, 68, -20, 77, 77, 
+	-81, -85, -25, 77, -3, 49, 21, 4, 
+	-76, 27, 41, -37, -3, 60, -91, 44, 
+	-63, 2, 60, 57, 52, -16, -88, -84, 
+	-74, -33, -77, -2, 13, -16, -71, -1, 
+	-74, 18, -101, 54, -61, -79, -36, -84, 
+	-60, 73, 0, -34, 34, -79, 79, -28, 
+	12, 16, -57, 9, -92, -27, -88, -108, 
+	50, -27, -87, 18, -100, -35, -5, -91, 
+	-57, -79, -46, -98, 3, -66, 69, -42, 
+	-95, -27, 62, 52, 24, -11, -82, 92, 
+	86, -40, 89, -52, -88, -38, 67, 23, 
+	-8, 50, -8, 89, 44, -14, -88, -35, 
+	62, 17, -47, -50, -49, -30, -51, -82, 
+	56, 45, -25, 16, -62, -79, 27, -22, 
+	-31, 31, -69, 67, -24, -22, 75, 66, 
+	77, -38, -57, -67, -47, -13, 13, -98, 
+	-99, 15, 9, -109, 27, -52, 0, 48, 
+	21, -21, -35, 80, -50, -94, -21, -52, 
+	-110, -61, -48, -87, -93, -16, 63, 6, 
+	9, -7, 28, -84, -79, -62, 1, 15, 
+	15, 2, -12, 18, -58, 75, -66, -33, 
+	-87, 71, -15, 6, 33, 81, 22, -34, 
+	64, -98, 22, 10, -61, -67, -94, -39, 
+	19, -86, -42, 35, -79, -85, -92, 21, 
+	53, -70, -42, -117, -37, 41, 15, 26, 
+	27, 10, 50, -73, -73, -84, 5, 83, 
+	-56, 65, -87, 46, -59, 59, 73, -42, 
+	73, -71, 65, -17, -16, -65, -82, 75, 
+	-61, -88, -35, 9, -34, -6, -60, -14, 
+	-71, -29, 20, 5, -25, -56, 10, -38, 
+	-21, -88, -39, -58, 68, -48, 56, -48, 
+	-84, 60, -93, -8, -3, 40, 46, -36, 
+	-89, 4, 25, -58, 64, -29, 15, 22, 
+	-48, 5, -85, -41, 20, 83, 59, -25, 
+	-98, -41, -66, -58, -7, 11, 69, -11, 
+	88, 25, -91, -9, 50, 22, -73, 69, 
+	-102, -118, -29, -34, -94, -43, -10, 42, 
+	36, 9, -12, -85, 38, 18, -3, 15, 
+	-14, -4, 98, 64, -6, -100, -55, -9, 
+	40, 21, -31, -80, -91, 29, -54, 55, 
+	54, -80, 13, 3, 19, 46, -67, -95, 
+	1, 8, 8, -11, -93, 87, -38, -31, 
+	-69, -97, -65, -72, -10, -70, 9, -96, 
+	62, -9, -1, -55, -69, 69, 53, -57, 
+	-63, 18, 32, 43, -76, 85, 74, 60, 
+	74, 34, 19, -57, 83, -9, -4, 39, 
+	-104, 35, 36, 15, 60, 51, -33, -79, 
+	-40, 32, -47, -80, -69, 23, -65, -54, 
+	8, -93, -90, -40, -16, -89, 43, 27, 
+	-47, 24, -94, -49, -19, 34, -53, -8, 
+	1, 10, 50, -71, -3, 57, 34, -98, 
+	-68, 35, -78, 31, 25, 102, -45, -41, 
+	-21, -25, -90, 39, 92, -79, -52, -3, 
+	15, -50, -22, -36, -61, 5, -14, -20, 
+	50, -67, -51, 48, -9, 13, -19, -74, 
+	-74, -109, -110, 76, 55, 35, 9, 88, 
+	-53, -33, -53, 13, 22, -98, 40, 13, 
+	44, -48, -32, -24, 45, -16, -37, -40, 
+	-18, -28, -55, 47, 51, 57, -84, -7, 
+	34, 65, -127, 32, -69, -35, -51, 38, 
+	-24, 59, -21, -95, 27, -29, 19, -9, 
+	67, -47, 16, 6, 59, -91, 72, -74, 
+	-56, 21, 1, 46, -98, -50, -8, -36, 
+	76, -61, 65, 19, -28, -81, 37, 56, 
+	48, 48, -97, 32, -4, -99, -23, -110, 
+	-81, -80, -93, 152, -76, -45, 57, -116, 
+	-34, -75, 163, 69, -105, 51, 42, -23, 
+	-67, -142, 100, 42, -127, 11, 106, 29, 
+	76, -82, 80, -53, -20, 11, -66, 64, 
+	10, 225, 9, -6, -106, 1, 42, -83, 
+	-55, -59, 124, 1, -50, -86, -100, 127, 
+	13, -16, 117, 132, 125, 38, -102, -37, 
+	134, -33, 93, 30, 29, 46, 57, -27, 
+	-54, 86, 178, -41, -108, 103, -89, 172, 
+	73, 98, -95, -51, 7, -66, 91, -1, 
+	-68, 1, 62, 75, 10, -21, -31, 3, 
+	-53, -160, 81, 42, -59, -51, 118, -114, 
+	-80, 22, -59, 52, 54, 82, -104, 86, 
+	-115, -158, 27, -24, -130, 66, -59, -19, 
+	69, 58, 28, 44, -132, 61, 41, 117, 
+	61, -124, 195, 37, 205, 79, 2, 59, 
+	127, -8, -162, -104, 46, -16, -44, 270, 
+	-126, 107, 6, -72, -61, -87, 70, 19, 
+	12, 54, -6, 0, 39, -37, 15, 23, 
+	78, 9, -79, 21, 178, 79, 107, -99, 
+	32, 12, -57, 34, -18, -24, -60, 59, 
+	113, -66, 188, 91, -5, -49, -37, 73, 
+	-3, -3, -131, -141, 70, -18, 60, 101, 
+	65, -53, 18, 87, -31, 0, 17, -74, 
+	31, -99, -122, 75, -71, -11, -51, -168, 
+	-94, 53, -45, -91, -19, 26, 54, 129, 
+	-175, 43, 62, 50, 29, -24, -151, -89, 
+	-67, -7, -56, 47, -138, -200, -180, -27, 
+	-15, -69, 144, 41, -79, 69, -104, 1, 
+	-98, 55, 69, -90, 13, 46, 16, -11, 
+	5, -17, 35, 10, -50, -17, 71, -108, 
+	21, -101, 133, 49, 25, 87, -2, 56, 
+	60, -75, -11, -126, 88, 22, 139, 126, 
+	2, -144, 3, -90, 30, 26, 198, 57, 
+	-46, -39, 13, -115, 106, 136, -96, 86, 
+	12, -16, 67, 163, 147, -57, -5, 7, 
+	-17, -20, -25, 11, -40, 7, -253, -25, 
+	146, -63, 6, -151, 115, 25, 115, -127, 
+	60, -10, 69, -31, 56, -15, 114, 145, 
+	-94, 139, 82, 81, -45, -16, -42, -125, 
+	136, 192, 43, -108, -25, -1, -64, 69, 
+	103, 78, -1, -27, 29, 86, 88, -6, 
+	101, 11, -60, -48, -42, 125, 69, 8, 
+	-13, -87, 70, 14, 139, 90, -129, -65, 
+	-50, -44, 70, 38, 2, 145, 3, -23, 
+	128, 125, 144, -59, 130, -60, 7, -78, 
+	-13, 115, -123, -61, 2, -174, -37, -61, 
+	-10, -118, 104, -61, 42, -49, 122, 17, 
+	17, 53, -29, 185, -38, 79, 41, -22, 
+	41, -191, 123, -37, 4, -17, 5, 14, 
+	50, -63, -55, -71, -21, 86, 1, 112, 
+	-39, -30, 142, 94, -114, -160, -15, -44, 
+	13, 82, 10, -146, -35, -47, -100, 63, 
+	50, 63, -34, -100, 56, -130, 15, -22, 
+	-167, 31, 5, -30, -5, -114, 171, 28, 
+	54, -48, 42, 19, 25, 73, 52, -6, 
+	-120, 17, -64, 180, -9, 32, 166, 57, 
+	23, -50, -7, 12, -44, 139, 74, 88, 
+	114, 52, 13, -136, -29, 28, 206, -22, 
+	69, -22, -20, 20, -24, 139, 73, 11, 
+	15, 26, 64, -36, 100, 16, -98, -53, 
+	-33, 45, 87, 86, -219, -14, 39, -168, 
+	52, 31, 63, 66, 101, 96, -48, 3, 
+	-162, 103, 57, -77, -94, -96, -131, 85, 
+	-121, 114, 127, 128, 97, -69, 70, 41, 
+	-42, 67, -39, 79, -48, -51, -124, -98, 
+	49, 92, -11, 27, -192, -20, 2, -25, 
+	-18, 137, 31, 41, 71, -167, -139, -1, 
+	40, -80, -129, -58, -56, 41, 20, -15, 
+	-42, -69, 117, 6, -28, -30, -17, -77, 
+	-23, -153, -19, 57, -76, 23, -42, 28, 
+	-93, 45, 43, 82, -43, 4, 22, -48, 
+	-48, 44, -54, 0, 77, -72, -62, -63, 
+	66, -31, 49, 73, -95, -73, 31, 74, 
+	46, -8, 33, 27, -56, 74, -5, 10, 
+	51, 12, -11, -50, -5, 58, 75, 11, 
+	-17, 86, 3, 7, 32, 40, -92, 75, 
+	10, 87, -44, -3, -63, 43, 12, -36, 
+	7, 2, -91, -81, 42, -69, -69, 1, 
+	16, 15, -86, 18, -70, -60, -55, 11, 
+	-98, -34, 52, -43, 13, -37, -87, 42, 
+	-80, -32, -62, -90, 62, -54, -87, 43, 
+	69, -5, -49, -29, -96, -58, -10, -12, 
+	56, 32, -3, 30, -28, -64, 16, -9, 
+	-57, 17, 16, -99, 69, -91, -25, 31, 
+	-68, -54, 5, -54, 14, -99, -82, -38, 
+	-69, -52, 80, -70, 20, -76, 69, 75, 
+	9, -23, 35, -24, -73, -87, -35, -44, 
+	20, -74, -82, 3, -42, -109, -66, 12, 
+	21, -83, -82, -110, -16, -111, -74, -87, 
+	-10, 20, -6, 27, 57, -40, 57, -55, 
+	-101, -10, -78, -70, -90, -75, 45, 45, 
+	30, -39, -78, 50, -27, -44, -7, -82, 
+	-45, -18, -17, -23, -66, 56, -51, 75, 
+	-28, 5, 46, -74, 52, -90, 73, -32, 
+	40, -113, 55, 11, 1, -20, 29, 14, 
+	-96, -2, -16, 36, -105, -41, 32, -11, 
+	-70, 11, -84, -72, 6, -21, -29, 0, 
+	-39, 11, 31, 63, 66, -8, 71, -74, 
+	-84, 69, 48, -14, 64, 19, -65, -78, 
+	43, 16, -47, -104, -18, -62, -8, -22, 
+	-93, -91, 88, -99, 59, -65, 1, -104, 
+	-31, -12, -22, -71, 56, -50, 81, -47, 
+	-44, -116, 3, -59, 9, -26, -26, 74, 
+	41, 77, -71, -75, 20, -40, -63, 55, 
+	-113, -97, 54, -99, -22, -109, -89, 46, 
+	26, -75, 18, -95, -3, 57, 52, 40, 
+	-59, -30, 17, -89, -60, -70, -26, -41, 
+	-36, -84, 60, 54, 40, -92, 37, -53, 
+	-37, -107, -65, 55, -2, -30, -60, 60, 
+	10, -38, -2, 32, -10, 16, 65, -40, 
+	84, -91, 55, 43, -86, 36, -66, -79, 
+	50, -26, -21, -110, -17, -105, 56, -56, 
+	62, -78, -15, -2, 59, -18, -48, -84, 
+	-24, -16, -80, -73, 66, -37, -54, 0, 
+	-80, 47, -66, -34, -78, -14, 44, -49, 
+	-81, -26, -66, -7, -81, 61, -45, 27, 
+	49, -25, -43, -70, 11, -81, 50, -58, 
+	56, -79, 38, -74, 24, -56, -11, 69, 
+	-51, 3, 34, -43, 58, 45, 83, -37, 
+	-38, -10, 15, 74, 9, -22, 60, -36, 
+	64, -52, -58, -103, -57, -21, 24, -114, 
+	12, -8, 11, 53, 13, -63, -48, -16, 
+	49, -18, 19, 21, -69, -88, -46, -70, 
+	-19, 44, -43, -70, 44, -65, 7, -24, 
+	-104, 49, -3, 14, -5, 59, 85, -41, 
+	-26, -2, -91, -54, -36, -93, 69, 50, 
+	-47, 22, 73, -34, 7, -33, -25, 64, 
+	-85, 65, -50, 5, -59, -20, -38, 78, 
+	50, -26, 28, 1, 64, -89, -33, -106, 
+	-46, 15, 14, -53, 12, 5, -20, 34, 
+	-5, 19, 10, 44, -71, -50, -90, 73, 
+	-17, 29, -18, -105, -72, 54, -88, -5, 
+	-52, 77, -8, -71, -76, -76, 27, -88, 
+	42, 10, 48, 4, 69, -111, 3, -43, 
+	-66, 8, -34, 8, 32, 63, -53, -61, 
+	-75, -56, -87, -32, 4, -82, 68, -26, 
+	12, 31, 35, -3, 5, -79, -46, 38, 
+	-41, -22, 55, -57, -69, -48, -63, 82, 
+	-3, -25, 39, -67, 6, 68, -77, 56, 
+	-35, -9, 35, -88, -95, 22, 12, 0, 
+	45, -13, 3, 67, -18, 40, 60, 85, 
+	52, 25, 5, 18, 16, -27, -21, -26, 
+	-8, 26, -41, 58, 44, -160, 28, -78, 
+	86, 61, 41, -31, -22, 9, 2, -94, 
+	-38, 18, -24, 52, 22, -89, 122, 73, 
+	-3, -58, 74, 37, 33, 1, 79, -82, 
+	-50, -48, -13, -50, -71, -97, -80, 61, 
+	-55, 155, 70, 142, -81, 75, -45, -79, 
+	118, -4, -51, -99, -44, 33, 25, -27, 
+	4, -10, -93, 121, 23, 57, 21, -19, 
+	23, -5, -142, 31, 94, -58, -18, 68, 
+	48, 131, 23, -35, 24, 92, 25, 64, 
+	-12, 44, 25, -24, -46, -141, 56, -47, 
+	-46, 28, -46, 68, 77, -16, 77, -45, 
+	31, -17, 37, -54, -76, 43, -47, 65, 
+	52, 133, -42, 132, -19, 98, -53, 125, 
+	24, -15, -48, -30, 135, 4, 62, 27, 
+	124, -49, 23, 26, -35, -40, -52, -69, 
+	-41, -18, 188, 98, 129, 54, 41, 119, 
+	6, 65, -179, 1, 52, -129, -28, 3, 
+	-27, 108, -72, 85, -45, 44, -50, 115, 
+	127, 44, -7, -30, 24, -111, 8, 51, 
+	20, 104, -30, -8, 4, 149, 144, 65, 
+	7, 109, -4, 29, 71, 54, 38, 100, 
+	-19, -35, 21, 13, 70, -49, 98, 42, 
+	50, 28, -45, -85, -42, 101, 33, 60, 
+	-114, 81, -37, 67, -53, -58, -61, 94, 
+	-57, -126, 106, -25, 106, -68, 56, -43, 
+	-4, 27, 88, -48, 46, 84, 13, -2, 
+	-91, -49, -146, -14, -20, -114, -83, -55, 
+	-48, 28, -106, 72, 26, -21, -30, 111, 
+	46, -36, 123, -35, 48, 44, 109, -44, 
+	-83, -67, 67, 3, 58, 9, 18, 16, 
+	-97, 33, 124, -40, -88, -25, -23, -11, 
+	-18, -41, -8, 37, 78, -26, -53, 16, 
+	-178, -139, 105, -51, -60, -7, -26, 171, 
+	-16, -61, -54, -17, -38, 10, 63, 18, 
+	66, 25, -95, -137, 43, 35, -116, -133, 
+	195, 51, -32, -52, 80, 28, -81, -58, 
+	-76, 58, -275, -76, -78, -106, -80, -39, 
+	54, -58, 127, -32, 2, 19, -53, 45, 
+	-66, -19, 66, 44, 43, 51, 45, 76, 
+	1, -76, 204, -62, -74, 66, -49, -14, 
+	-18, 10, 27, -15, 24, 63, 34, 30, 
+	-7, -59, -15, 37, -12, -41, -17, 136, 
+	34, -20, -110, 0, 28, -88, -19, -40, 
+	4, 6, 55, 132, -41, 4, -31, 35, 
+	109, 29, 102, -83, -58, 40, 126, 96, 
+	39, -129, 74, 100, 4, -21, 17, 113, 
+	-83, 98, -52, -90, -45, -148, -10, 61, 
+	67, 82, -12, 37, 33, -110, 40, -17, 
+	-26, 75, 16, -13, -53, 51, -19, -57, 
+	40, -31, 29, 100, 103, -64, -27, -26, 
+	-120, -98, 28, -81, -7, -46, -1, 38, 
+	16, 195, 71, -188, -116, -94, -61, 22, 
+	-21, -127, -111, 93, -58, 28, -125, 40, 
+	-65, 25, -107, 20, -70, 19, 52, -16, 
+	-51, -26, 138, -2, -75, -79, 39, -102, 
+	22, -57, -65, -42, 88, 12, 143, -61, 
+	27, -61, 53, -34, -78, 88, -110, 124, 
+	146, -65, -97, -104, 16, 114, 66, 44, 
+	25, -89, 99, -50, 17, 28, 74, -150, 
+	-98, -68, -18, 9, -47, 101, -17, 109, 
+	-96, -5, -72, -35, 49, 73, -75, -99, 
+	-43, 73, 16, 3, 37, -53, 34, -48, 
+	95, 45, 5, 11, -47, 115, -36, 0, 
+	-24, -53, 33, -17, 47, -42, 80, 5, 
+	125, 12, 188, -62, -163, 23, -31, 114, 
+	70, -157, -70, 116, -24, -67, -6, -110, 
+	-45, -90, -3, 45, -85, 53, 148, -123, 
+	-40, 22, -19, -165, 32, 50, 78, -50, 
+	-108, 27, -21, -47, -108, -15, -139, 70, 
+	-53, -148, 215, -31, -140, 33, -52, -52, 
+	90, 91, -117, -65, 125, 53, 3, 62, 
+	27, -149, 62, 79, 94, 55, 51, 23, 
+	147, 71, -91, -101, 31, -11, 53, -6, 
+	-108, -10, -176, 16, 65, 78, -53, 92, 
+	120, -31, 26, -140, -4, 74, -34, -11, 
+	-59, 39, 145, 56, 90, -71, -79, 38, 
+	-6, -229, 81, -81, 53, 18, 20, -78, 
+	2, -57, 13, 18, 118, 112, 38, -17, 
+	-79, 18, -64, 45, -47, -95, -12, -88, 
+	-89, 20, -185, 92, 123, -3, 47, 148, 
+	54, -50, -15, -107, 78, -121, -73, 123, 
+	0, -5, 121, -67, 97, -121, -57, 61, 
+	5, 84, 115, -54, 70, 34, -11, 46, 
+	106, 74, 98, -50, 253, -40, -35, 116, 
+	95, -116, 137, 13, -42, 109, 85, 4, 
+	120, -8, -14, 82, -59, -68, 40, 22, 
+	97, 24, 93, 51, 56, 2, 90, -105, 
+	-21, 43, -217, 32, -57, -102, -48, -15, 
+	-87, 25, 141, -35, 14, -49, 90, -301, 
+	162, 24, 71, 69, 53, -1, -104, -171, 
+	-16, -28, 105, -107, -119, -116, -104, -4, 
+	-36, 65, 28, 83, -162, -26, -33, -35, 
+	23, 85, -94, 2, -31, -45, 147, -191, 
+	-109, -64, 82, -38, 144, -103, -70, 155, 
+	51, 53, 36, 111, -30, -97, -25, 49, 
+	8, 63, -55, -70, 40, 11, -6, 70, 
+	-118, 25, -62, -22, 31, 53, 88, -20, 
+	141, 103, 82, 138, 117, 60, -66, -84, 
+	74, -106, 0, 57, 65, -4, 32, 77, 
+	22, 86, 47, -125, -105, 0, 19, -1, 
+	-32, 30, -161, -118, 23, -164, 169, -50, 
+	106, 74, -6, 162, -111, 14, 38, -72, 
+	68, -24, 111, -35, 218, 39, 121, -54, 
+	-59, 139, -127, -40, 12, -152, 108, 11, 
+	-108, 1, -75, -4, -69, -32, -20, 85, 
+	55, 47, -15, -14, -86, -17, -10, 78, 
+	-59, -22, -22, 60, -88, -129, -168, -99, 
+	-1, 66, 41, -79, -160, -125, -44, 5, 
+	29, 65, -72, -28, -50, -62, 24, -23, 
+	80, 134, 82, 79, -45, -101, 22, -83, 
+	-72, -99, -1, 118, -61, 58, -141, -156, 
+	-34, 93, 15, 91, 70, 101, 73, 104, 
+	130, -75, -50, -6, -66, -123, -44, 117, 
+	-163, -172, 2, -67, -133, 78, 94, 105, 
+	-83, -213, -7, -92, 114, -61, 97, 26, 
+	83, -73, 37, -220, -212, -99, 114, -37, 
+	-59, -33, -92, -128, -34, -103, 67, -48, 
+	-56, -135, -52, 135, -234, 5, 32, -88, 
+	-69, -64, 192, -76, 23, 0, -15, -68, 
+	63, 95, 2, 151, 78, 99, -63, 21, 
+	-72, 70, -40, 125, 79, 4, 59, 26, 
+	-8, -27, -201, 178, 104, 136, 106, -89, 
+	108, 9, -116, 106, -61, -137, 186, -98, 
+	29, -48, 51, -79, 8, 132, 64, 63, 
+	129, 78, -86, 73, 77, 109, 49, -24, 
+	-36, 3, 31, -22, 41, 94, 61, -63, 
+	100, -65, 7, 66, 136, 49, -117, -10, 
+	61, -33, 5, 120, 95, -29, 115, -30, 
+	-56, -33, 42, -55, 87, -19, -90, -21, 
+	-86, 4, 30, -8, 1, -91, -24, -76, 
+	136, 114, 72, 103, 5, 55, -82, -25, 
+	93, 39, -7, 38, 109, 1, -57, -15, 
+	-11, 74, -141, 53, -45, 92, 20, 89, 
+	134, -39, -18, 57, 60, -7, 21, -110, 
+	-20, -19, 50, -25, -57, -84, -61, 118, 
+	60, 63, -92, 68, -10, -75, 155, -93, 
+	121, 52, -74, -58, -94, 36, -36, -12, 
+	98, -50, -41, -41, 21, -21, -51, 136, 
+	-31, 11, 98, -94, -11, 95, 82, 38, 
+	-178, 67, -137, -44, -46, 153, 48, -78, 
+	-16, 73, 55, 109, 29, -55, -49, 45, 
+	42, 18, -53, -59, 61, -84, 45, -77, 
+	103, -11, -76, -63, 91, -81, -54, 105, 
+	45, 27, 88, -85, 59, 109, 10, 97, 
+	15, -69, 142, 18, 99, -15, -56, -35, 
+	79, -27, 96, 78, 40, 52, -45, 23, 
+	-53, 43, -9, -90, -33, 29, -100, 42, 
+	-39, -12, 11, 14, 16, 44, -18, -37, 
+	2, -67, -69, 71, 70, -82, -52, -10, 
+	171, 57, 92, 82, -75, 13, -17, 66, 
+	20, 69, -19, 1, 20, -88, 90, -1, 
+	-82, 36, 273, 58, 82, -45, 30, 75, 
+	-36, -133, 122, -95, 79, 119, -43, 88, 
+	99, -195, 63, -3, -35, 170, 13, -50, 
+	-25, -79, -30, -150, -16, 14, -65, -77, 
+	-44, 60, -73, -1, -229, -84, -116, 74, 
+	101, 97, -63, -21, 7, -30, -37, -89, 
+	110, -80, -97, -58, -58, -114, -39, 76, 
+	-30, 78, -87, -93, 36, -41, 18, 143, 
+	117, -52, 0, -64, -41, -46, 117, -76, 
+	-39, -56, 121, 14, 123, 25, -63, 201, 
+	-95, -176, 84, -65, -25, 61, 54, -162, 
+	80, 87, -38, -61, 92, 43, 65, -72, 
+	52, -107, 214, -101, -24, 2, 58, 74, 
+	-69, -193, -35, -57, 36, -11, 49, -134, 
+	40, -113, -23, -88, -86, 129, 61, -122, 
+	-49, 182, -90, 16, -10, -48, 17, -74, 
+	-58, 114, 137, -42, 38, 3, 131, 23, 
+	10, 15, 8, -52, 57, -39, -28, 48, 
+	26, 65, 74, 60, 26, -29, 39, -29, 
+	-90, -7, 6, 75, 65, -163, 140, -47, 
+	-108, 35, 64, -130, 239, -66, 37, -10, 
+	66, -85, -43, 80, 65, 55, 37, -23, 
+	-37, 63, -43, 25, 141, 52, -49, 101, 
+	-10, -60, 1, -60, -11, -31, 15, 13, 
+	-104, -64, 35, 180, -20, -14, -83, -29, 
+	78, 167, -156, -67, 2, -37, -33, 38, 
+	100, 151, -60, 37, 22, -80, -123, 130, 
+	-2, -120, 87, 37, -95, -17, -53, 50, 
+	14, 44, 49, -111, 22, 72, -73, -98, 
+	-105, -14, 0, 19, -10, 31, 36, -61, 
+	-86, 126, 67, 105, 82, 1, -64, 170, 
+	27, -122, 25, 45, 113, -37, 37, -21, 
+	-13, -84, -71, 126, -118, 26, -87, 12, 
+	-25, 102, -134, 37, -117, -78, -70, -92, 
+	-128, 227, 26, 0, 15, 11, -77, 36, 
+	-86, -128, 146, -89, 74, 31, 26, 100, 
+	-88, -254, -30, 8, 68, -21, -11, -54, 
+	10, -10, -51, 133, 17, 140, 102, -7, 
+	-174, 111, -219, 81, 86, -135, 32, 144, 
+	91, -51, 23, 49, -70, 94, -94, 13, 
+	63, 136, -154, 88, 86, 128, -87, -27, 
+	-30, 13, 46, -91, 64, 171, 46, 44, 
+	57, -109, -138, 148, -50, 17, -21, 1, 
+	21, 63, 54, 123, -60, -49, 25, -121, 
+	110, -51, 58, 129, -69, 111, 15, 114, 
+	63, 20, -102, -23, 125, -23, 6, 41, 
+	129, -37, -23, 36, 26, -31, -79, -25, 
+	4, 190, -26, -101, -29, -36, -121, 91, 
+	-80, -95, -74, -82, -64, 46, -36, 106, 
+	-11, -89, 53, -73, 59, -123, -11, -107, 
+	-37, -37, 29, 65, 102, -2, 35, -133, 
+	77, -88, -33, 12, -28, 12, -35, 72, 
+	60, -71, -50, -29, -176, 28, -83, -54, 
+	-32, -18, -18, -55, 113, -43, 87, -29, 
+	145, 30, -106, -6, 145, 77, 68, -83, 
+	-109, 67, -5, 117, -13, -51, 48, -91, 
+	66, -19, 70, -59, -54, -59, 47, 190, 
+	-105, -106, -49, 95, 64, 47, -120, -39, 
+	-35, -186, 56, 20, 59, -78, 110, 68, 
+	81, 28, -6, -17, 21, -72, 14, 52, 
+	-69, 18, 149, -26, -62, 50, 97, 28, 
+	67, -51, 25, -80, 72, -98, -116, 103, 
+	13, -93, -272, -11, -32, 73, -47, 93, 
+	-47, 19, 80, -21, -38, -218, 59, 71, 
+	13, -80, -5, 87, 10, 69, -22, -58, 
+	87, 11, -245, -42, -110, 129, 48, 86, 
+	3, -47, -34, -86, -64, -86, -27, 21, 
+	16, 25, -22, -22, -80, 63, -2, 36, 
+	59, -29, -42, -36, -102, -101, 27, -41, 
+	-105, -98, -2, -50, -63, -133, -153, 28, 
+	-31, -58, 86, -114, 17, -67, -19, -77, 
+	16, 127, 69, 15, -6, 65, -8, 54, 
+	4, -112, 26, 115, -52, 45, 57, 53, 
+	-57, -114, -211, 126, -29, 133, -21, 114, 
+	-96, -39, 30, 17, -68, 49, 126, -28, 
+	-49, -133, 6, -28, 71, -26, 13, 19, 
+	80, -59, 36, 68, -18, 138, -50, -64, 
+	-70, 5, 31, -30, 42, -87, -11, -39, 
+	76, -49, 27, -48, 57, -53, 68, -133, 
+	80, 85, 87, 32, 120, -76, 112, 36, 
+	-72, -2, 40, 18, -127, 83, -32, -37, 
+	54, 32, -106, -106, 29, 8, -75, -100, 
+	-88, -13, -8, 4, -28, 120, -13, 107, 
+	103, 104, 99, 156, -34, -49, 63, 117, 
+	-10, 26, -48, -7, 57, -38, -103, -61, 
+	-34, 56, 45, -16, 99, 115, -21, 55, 
+	11, 100, 72, -9, -33, 62, -78, -50, 
+	32, 73, 124, 85, 28, 55, -7, -41, 
+	90, 74, -101, 117, 33, -6, 21, 35, 
+	-143, 26, 115, -125, 89, -24, 45, 100, 
+	73, -96, -3, -12, -26, 31, 8, 35, 
+	77, 36, -18, 42, -65, 72, 76, -55, 
+	14, -38, 5, -129, 35, 153, -45, 35, 
+	61, 98, -233, -96, 74, 45, 139, 11, 
+	-30, 38, 49, 16, -24, -80, 0, 113, 
+	115, -29, 46, 64, 138, 92, -33, -52, 
+	-45, 138, -6, -122, 2, -88, 89, 44, 
+	38, 85, 193, 134, -89, 32, -175, -114, 
+	-116, -69, 85, 117, -21, 84, -78, -152, 
+	101, 92, 83, 137, -140, 5, 16, -14, 
+	-88, 17, -34, -54, 26, 5, -71, 49, 
+	-9, 73, -5, -92, 115, -61, -26, 110, 
+	-9, -26, -62, 22, -115, 10, 48, 40, 
+	132, 97, -106, 56, -121, 85, 31, 107, 
+	8, -108, 100, 2, -39, -72, 82, 19, 
+	-90, -68, 83, 52, 92, -8, 143, -5, 
+	11, -234, 67, -32, 87, -55, -59, -31, 
+	-67, 182, -69, -76, -59, 52, -5, -164, 
+	-19, 137, 142, 141, 74, 80, -9, 5, 
+	111, 68, -67, -37, -64, -136, -137, -138, 
+	112, 34, -55, -45, -93, 102, -20, -38, 
+	127, -23, 17, -19, 143, -16, 151, 68, 
+	-59, -20, 65, 5, -40, 134, 46, 61, 
+	9, 13, -139, 6, -6, -96, -19, -125, 
+	-61, 129, 158, -39, 5, -23, 101, -55, 
+	-58, 113, 15, 21, 90, -24, 1, -85, 
+	-2, -62, -29, -202, 95, 103, 49, 95, 
+	85, 41, 13, 56, -125, 66, -2, -40, 
+	0, -129, 68, -89, -72, -35, -81, -25, 
+	62, -41, 96, 46, -128, 52, -51, -122, 
+	-11, 75, -61, 0, 94, -90, -90, -5, 
+	-21, 139, 7, -99, -30, -112, 106, -58, 
+	-36, -29, 136, 81, 126, -77, -70, 41, 
+	-183, -34, -65, 99, -16, 19, 56, -27, 
+	-35, 40, 81, 199, -89, -24, 87, 24, 
+	82, -148, 116, 45, -106, -36, -193, 83, 
+	0, -36, 76, -8, 91, -35, -32, 147, 
+	-143, -8, 48, -160, 15, -141, 22, 4, 
+	118, -54, -67, 164, -18, 56, -175, -2, 
+	26, 91, 134, 48, -74, -59, -74, 52, 
+	-9, 82, -48, 0, -92, 144, 45, -22, 
+	-110, -25, -44, -106, 103, -79, 49, 3, 
+	-73, -58, 9, 61, 71, 148, 21, 8, 
+	44, -69, 120, 23, 84, 133, 41, -53, 
+	89, 66, 168, 35, 76, -58, 53, 6, 
+	-31, -9, 141, 35, -36, 105, -11, 29, 
+	25, -108, 51, -79, -72, 65, 62, -133, 
+	-39, 1, 179, 8, 0, 99, 34, 2, 
+	246, -137, 56, 13, -124, -9, 30, 3, 
+	-49, 33, 1, -196, -160, -20, -127, -44, 
+	119, -118, 15, -19, 31, -134, -21, 91, 
+	-128, 85, -163, -20, -214, -124, -119, 11, 
+	-68, -86, 89, -3, -47, 19, 94, -98, 
+	48, -8, 39, 5, 165, -105, -52, 66, 
+	6, 38, 78, -20, 156, -1, 108, -234, 
+	30, -116, 50, 68, -80, 44, -46, 32, 
+	18, -126, -45, -2, -159, 164, -31, -115, 
+	121, -5, -192, -93, 108, 145, -96, -143, 
+	59, 121, -40, 3, -74, -110, -26, -61, 
+	-151, 177, -205, 28, -38, -177, -114, -105, 
+	-77, -198, 32, -74, -57, -11, -14, -1, 
+	-10, 127, -191, 48, 28, 104, 88, 109, 
+	75, 5, 73, -1, 39, -163, -34, -151, 
+	181, -121, 33, -93, 123, 69, -217, 168, 
+	-39, -59, 16, 74, -140, 65, 108, -67, 
+	-158, -82, 123, -85, 97, 28, -119, -18, 
+	82, -45, 130, 33, 39, 32, 84, -132, 
+	-161, -184, 65, -121, 102, -130, -83, -185, 
+	48, -135, -26, 40, -113, 175, -136, -142, 
+	67, 90, -46, 45, 108, 16, 183, -168, 
+	95, -53, 28, 64, -136, -5, 53, -74, 
+	-73, -73, -24, -3, -30, 37, 127, 30, 
+	73, -32, -1, 44, -42, 73, 67, 120, 
+	21, -99, -116, -78, -2, 49, -18, 33, 
+	50, -48, -102, -183, -59, 123, -33, 118, 
+	-130, 18, -126, -34, -120, -69, 98, -63, 
+	91, 12, 99, -56, -72, -52, -17, -180, 
+	114, 71, 102, 20, 117, 10, -63, -39, 
+	-32, 61, 13, -109, 142, -85, -37, 24, 
+	-11, -6, 1, -24, -45, 119, 45, 25, 
+	35, 33, -79, -60, -30, 92, 60, -62, 
+	131, -54, 32, 56, 106, 174, 150, -42, 
+	31, -86, 75, -228, 31, -18, 78, -195, 
+	39, 69, -20, 67, -91, 29, 51, 69, 
+	-16, -109, 155, 69, -7, -103, 46, -42, 
+	121, -10, -10, -42, 4, -78, 36, -69, 
+	51, 50, 119, 24, -4, -7, -34, 18, 
+	47, -158, -108, -10, 52, 36, -33, 82, 
+	63, 22, 117, -126, 97, 62, 120, -14, 
+	77, -61, 31, 31, -72, -7, -153, -56, 
+	-45, 20, -82, -83, 31, -43, -16, 8, 
+	-86, 55, 103, -155, 199, -21, -194, 231, 
+	89, -11, 243, 80, -129, 102, 12, -262, 
+	112, 77, -25, -22, 18, 31, 96, -151, 
+	49, -136, -69, 49, -3, -30, -61, 19, 
+	110, 70, 65, 34, 2, -32, 40, 67, 
+	67, -189, -114, 53, -54, 82, 113, 30, 
+	-40, -44, 8, -7, 38, 62, 35, -15, 
+	-77, -6, 48, 24, 143, -105, -84, -23, 
+	-122, 66, -79, -128, -5, -116, -115, 82, 
+	13, 35, 325, 79, 26, -53, 60, -8, 
+	71, -28, 77, -45, 164, -28, -30, 50, 
+	1, -9, -29, -57, 8, -96, -20, -80, 
+	59, -59, -56, -104, -59, -8, -82, -37, 
+	108, 51, 144, -31, -118, -1, 88, 39, 
+	30, -9, -161, -117, 42, -49, -36, -1, 
+	22, -133, -3, 49, 173, -79, -63, -79, 
+	-62, 36, 168, -26, -20, 58, 99, 12, 
+	6, -78, 54, -82, -88, 7, 62, 47, 
+	-38, 123, -40, -17, 115, 142, -35, 7, 
+	-11, 107, 28, -43, -27, 28, -181, -194, 
+	63, -3, -39, -18, -119, -99, -58, 73, 
+	102, -197, -107, -149, -3, -116, 88, -205, 
+	13, -109, -259, -18, -135, 97, -122, 17, 
+	-74, -3, -14, 16, 26, -135, -122, 78, 
+	-144, -7, 92, 11, -16, -79, -8, -51, 
+	117, -41, 186, -147, 79, -12, 36, -23, 
+	127, 83, -60, -105, -141, 12, -29, -89, 
+	-41, -15, -52, 36, 75, 78, -52, 4, 
+	18, -62, -3, -82, 75, 39, 71, 76, 
+	81, -59, 49, -70, -95, 77, 1, 69, 
+	-26, -41, 24, 63, -56, -85, -83, -86, 
+	-12, -68, -83, -86, -10, -12, -56, -16, 
+	-53, 24, -64, -90, -12, 2, 4, 17, 
+	70, -55, 83, -97, 4, 70, 32, 43, 
+	0, 71, 4, -30, -36, -43, 8, -10, 
+	-94, 5, 23, 65, -48, 80, -13, 46, 
+	-37, -21, 18, 29, -64, -96, -27, 20, 
+	-67, -74, -57, 12, -61, -62, 74, 75, 
+	-45, 65, -90, -18, 37, -15, -48, 44, 
+	-77, 49, 80, -31, 22, 36, -28, 43, 
+	66, 58, -91, 9, -12, -102, -30, 17, 
+	-54, -44, 58, 74, 67, -32, -94, 30, 
+	-28, 65, 30, -91, -32, 12, -47, 11, 
+	23, 43, -113, -6, -86, -95, 12, -56, 
+	-37, -43, -127, 83, 55, -96, 56, -12, 
+	38, -103, 38, -47, -89, -54, -68, -93, 
+	44, 63, -83, 26, -89, -52, -8, 55, 
+	-30, -44, -97, -56, -14, -42, -15, -4, 
+	62, 79, -2, 41, 20, -4, 35, 3, 
+	82, -66, -76, -77, -83, 54, 28, -60, 
+	-62, -79, 56, 8, 29, 7, 13, -31, 
+	-45, -64, -15, -17, 17, 53, -18, -16, 
+	-17, -8, 78, -55, -93, -15, 63, -66, 
+	-20, -81, 47, 25, -95, -37, 41, 81, 
+	67, -14, -58, -27, 24, -88, 8, -94, 
+	17, -90, -40, 77, -42, 12, 68, 2, 
+	-71, -85, 48, -23, -23, -37, -1, -79, 
+	-8, 16, 56, -95, -79, -77, -62, 5, 
+	7, -79, -2, -9, -26, -50, -21, 0, 
+	3, -62, -46, 35, -33, 67, -69, -9, 
+	42, 16, 34, -61, -74, 70, -68, 18, 
+	-15, -19, -89, -45, -86, 10, -19, 20, 
+	59, 9, -48, -41, -27, -78, 70, -19, 
+	72, 69, 7, 16, 62, -70, -28, 14, 
+	-44, -75, -101, 50, -98, 23, 15, -8, 
+	52, 32, 24, -89, -52, -82, -70, -38, 
+	-33, 58, -29, -56, 17, 55, -70, 62, 
+	29, -92, -109, -22, -9, -55, 33, -34, 
+	24, -80, 28, 3, -36, 78, 7, -5, 
+	9, -10, -79, 48, 0, -24, -72, 84, 
+	82, -78, -63, 15, -15, 51, 19, -59, 
+	-45, 26, -70, 15, 53, -60, -1, 1, 
+	-97, 5, -121, 27, 85, 34, -68, -26, 
+	-99, -11, 23, -54, 46, -55, 58, -84, 
+	-38, 58, 10, 52, -98, -19, -72, -51, 
+	47, 1, 42, -39, -50, -55, -56, 19, 
+	-67, 10, -65, 79, 85, 11, -73, 7, 
+	-9, -87, 39, -64, -20, -33, -5, 27, 
+	73, 44, 1, 9, 70, -8, 39, -43, 
+	-63, 30, 77, -42, 41, 49, 44, -42, 
+	67, -60, -38, -62, -101, 57, 5, 20, 
+	28, -65, 1, 83, 53, -90, 86, -13, 
+	-74, 65, -23, -46, 53, -20, 8, -87, 
+	70, 12, -72, -37, -21, -41, 85, 23, 
+	65, 39, -17, 29, -43, -46, -19, -56, 
+	-67, -111, -46, -45, 46, -84, -80, -55, 
+	47, 55, -92, 76, -91, -19, 0, -2, 
+	34, 31, -87, -2, 75, -65, -4, -22, 
+	9, -85, -88, -29, -49, 51, -96, 56, 
+	23, -88, -29, -64, 1, -11, 70, 80, 
+	36, -67, 42, -13, 17, -18, -83, -89, 
+	10, -41, -130, 46, 54, -96, 1, -62, 
+	-130, -12, 44, -19, -3, -52, -92, -37, 
+	54, -4, -98, 67, 84, 19, -19, 49, 
+	-76, -52, -63, 3, 28, -45, -26, 42, 
+	-73, 56, -61, 45, -35, 29, 8, 1, 
+	-70, -88, 21, -32, 29, -64, 25, -94, 
+	29, -70, 91, 17, -62, 46, -69, -73, 
+	-61, -21, 0, 68, -20, 10, -23, 84, 
+	127, 80, -52, 28, 30, -9, -24, -61, 
+	36, 37, 9, -8, 4, -72, 132, 114, 
+	152, -83, -6, 7, -59, -7, 47, -30, 
+	-19, 18, 76, -64, 10, 110, 2, 8, 
+	-21, -115, -119, -46, -20, -88, -3, -44, 
+	16, 117, 42, -4, -158, -37, -27, -81, 
+	-159, 25, 5, 68, 11, 98, -82, -45, 
+	23, 15, 47, -18, -3, 25, -87, 45, 
+	-26, 46, 29, 20, 75, -18, 43, -152, 
+	-57, -115, -11, 47, 29, 30, -159, -16, 
+	-44, 41, -51, 123, -68, -12, 44, -70, 
+	81, -125, -11, 38, -57, -55, -98, -52, 
+	60, 31, 16, 39, 91, 2, -43, 63, 
+	-71, -118, -27, 28, -47, 49, 140, -83, 
+	-19, -98, 38, 47, 77, -136, 36, 99, 
+	-58, 47, 57, -68, 28, 29, -5, 54, 
+	-102, 62, 74, -30, -6, -35, -18, 107, 
+	150, 61, 73, -31, 78, -116, 18, 9, 
+	3, 120, 0, -98, 9, 52, -36, 0, 
+	-36, 179, 88, 180, -6, 3, 44, -1, 
+	-117, 146, 21, 7, 129, -27, -69, -98, 
+	35, 121, -31, 118, -33, 88, -105, 120, 
+	53, 85, -144, -43, 43, 43, -26, 102, 
+	52, 57, -28, -22, -52, -38, -85, -85, 
+	-10, 13, -49, -68, 5, 65, 40, 94, 
+	-25, 59, -125, 63, -65, 83, 22, 27, 
+	63, 37, 18, -128, -14, 112, 26, -5, 
+	77, -45, 90, -103, -58, -5, 134, 19, 
+	76, 79, 147, -272, -142, -27, 14, 39, 
+	37, 175, -82, 37, -6, -84, 61, -59, 
+	-76, 17, 55, 86, 72, 14, -31, 22, 
+	-7, 85, 100, 84, 203, 61, -88, 83, 
+	-8, 92, 248, 136, -25, 86, 28, -7, 
+	-18, 64, 86, 16, -33, -22, -71, -78, 
+	-117, 22, -39, 115, 27, 13, 123, -107, 
+	64, 65, -76, -25, -82, -92, 41, 105, 
+	-16, -131, 119, 6, -233, -44, -3, 75, 
+	-29, -110, 55, -48, 43, 67, -15, -59, 
+	-132, -55, -41, 90, 55, -18, 83, -45, 
+	-2, -102, -29, 20, 69, 85, 11, 143, 
+	86, -18, -70, -68, 63, -25, 47, 70, 
+	-43, -67, 66, 55, 69, 67, 97, -58, 
+	112, 60, 126, -72, -35, 121, 36, 160, 
+	-53, -34, 161, 92, 23, -24, 34, -67, 
+	57, 208, 70, -44, 78, 17, 134, 122, 
+	24, 88, 90, 10, 7, 0, 61, 76, 
+	-43, -87, -133, -50, 77, -7, -60, -6, 
+	-14, 34, -70, 39, 14, 75, 3, -1, 
+	120, -83, 110, 59, -49, -45, -80, 98, 
+	-99, 94, -49, 2, 46, -38, 80, -23, 
+	139, -4, -22, 59, -4, 95, 90, 112, 
+	27, -3, -33, -89, 43, 92, 12, -91, 
+	113, -11, 111, -13, 68, 87, 101, 31, 
+	-24, 142, -22, -63, 23, -129, 126, 19, 
+	41, -53, -150, -80, 12, 120, -51, -30, 
+	34, 82, 64, -32, 94, -18, -103, -16, 
+	44, 61, -6, -29, 34, 42, -118, -53, 
+	28, 162, -10, 19, -76, -2, 30, 135, 
+	66, -37, 1, 86, 118, 158, -25, 17, 
+	-86, -44, 34, -15, -3, 12, 32, 55, 
+	89, -61, 144, -50, 103, -21, -48, -111, 
+	-50, -11, 1, -79, 20, 61, 53, -3, 
+	14, -82, 53, 7, -96, 47, 83, 72, 
+	-49, 16, -28, 11, 69, -36, 121, 38, 
+	73, -179, 75, -18, -5, 95, -206, 72, 
+	38, -80, -109, 68, 108, -33, 4, 60, 
+	137, 15, 71, 32, 39, 14, -13, 61, 
+	63, 162, 73, -119, 113, -21, -161, -23, 
+	6, -55, 17, 74, -36, 16, -39, 96, 
+	41, -122, 68, -57, 8, -87, -105, 43, 
+	119, 98, -213, -25, -51, -66, 12, -68, 
+	77, -66, 103, 34, -154, -88, 31, -142, 
+	37, -35, 7, 13, -34, 92, 79, -6, 
+	-40, -15, -80, 29, 79, -94, 14, -27, 
+	-80, 43, 45, -41, -28, -12, -1, -12, 
+	-41, 43, 16, -21, -3, -87, 46, -65, 
+	-70, -42, -8, -58, 57, -68, 4, 40, 
+	-89, -76, 15, -94, 68, 36, 80, 95, 
+	4, -33, 58, 41, 52, 52, -57, -38, 
+	41, 72, -63, -55, -15, 82, 58, -10, 
+	-33, -30, 39, -60, -22, 102, 65, 20, 
+	-75, -49, 10, 30, -87, 7, 81, 63, 
+	-72, 5, -27, 6, -6, -43, -20, 73, 
+	16, -62, 52, 60, 68, 63, 41, -67, 
+	-8, 39, 56, 39, 24, 38, 27, -106, 
+	49, -14, 26, -58, 78, -10, 42, -84, 
+	-66, 40, -17, 43, -42, -54, -5, -46, 
+	15, 34, 30, -38, 19, -86, -54, 50, 
+	59, -25, 55, -11, -80, -34, 73, -9, 
+	83, -7, -67, -83, -3, -97, -24, 56, 
+	1, 95, -64, 54, 65, -71, -6, 74, 
+	42, 19, -88, 96, -85, 9, 11, 88, 
+	-65, 88, 62, -13, -72, 19, -103, -37, 
+	-104, 62, 78, -38, 89, 29, 69, 49, 
+	-32, 44, 31, -15, -59, -3, 7, -7, 
+	-75, 60, -82, -33, -42, -77, -82, -2, 
+	-80, 10, 37, 63, -79, -95, 3, -24, 
+	-72, -35, 27, -56, -86, -62, -81, -33, 
+	32, -102, -81, -76, -4, -21, -54, 40, 
+	-72, -38, 19, 22, -65, -47, -20, 18, 
+	45, 66, -6, 72, 26, -92, -14, -27, 
+	26, -78, 54, 71, -15, 38, 27, -12, 
+	31, -99, 11, -89, -44, 37, -60, -98, 
+	14, -29, -97, -67, -28, -101, -65, -65, 
+	-13, -11, -8, 78, 80, -29, 38, 6, 
+	37, 68, 16, -90, -104, 39, 21, -31, 
+	80, -65, -25, -24, -13, 74, 10, 56, 
+	54, -9, 89, -5, -70, -57, 7, 73, 
+	-35, 53, -80, 11, 71, 50, 64, 23, 
+	29, 42, -26, -77, 7, 11, -93, -74, 
+	-96, -78, 42, -31, -67, 60, -13, 43, 
+	-78, 66, -89, -49, 48, -5, 13, 22, 
+	-30, -94, -35, 29, 76, -19, 14, 80, 
+	-24, 59, -87, -80, 46, 86, -95, 36, 
+	41, -69, -49, -12, -3, 64, -88, -95, 
+	-98, -92, 58, 45, -58, 6, -11, 53, 
+	-92, 21, 7, 78, -75, -64, 74, 82, 
+	7, -65, 6, -96, -52, 70, -59, 30, 
+	-55, -49, -20, -73, 25, 20, 0, 38, 
+	-75, 4, 13, 7, 12, -61, 51, -66, 
+	76, 61, 84, 62, -40, -26, 20, 18, 
+	-109, -37, -46, 73, -28, -32, -74, -33, 
+	-65, -46, -36, 49, 47, -26, -33, -52, 
+	92, -58, 38, 11, 62, 45, 17, -92, 
+	-87, 33, -12, -27, 70, 19, -25, 55, 
+	-54, 18, 11, -16, -92, -31, -98, 63, 
+	-41, 21, 63, -58, 103, 110, -31, -40, 
+	-65, -67, -43, -76, -97, -2, 93, -66, 
+	-17, -16, -50, -90, 40, -86, 4, 62, 
+	53, 69, -99, -64, -1, -28, 4, -72, 
+	-75, -55, -86, 51, -53, 13, 15, 10, 
+	49, 75, -7, -76, 3, 13, 107, -62, 
+	-33, -19, -58, -52, 15, 37, -102, -40, 
+	0, -97, -6, 37, 51, -2, -82, -97, 
+	-105, -11, -73, -65, -82, -98, -13, 56, 
+	-39, -85, -56, 49, 79, 23, 22, -67, 
+	70, -107, -43, -33, 78, -35, 71, -75, 
+	4, 56, -7, -70, 85, 81, -84, -69, 
+	103, 10, -104, 32, -30, 37, -12, -20, 
+	65, -7, 77, -44, -23, 52, 65, 28, 
+	42, 63, 20, 13, 26, 62, -55, -36, 
+	12, 76, 87, -107, 57, -91, -94, -80, 
+	-22, 36, 94, -79, 78, -71, -30, -103, 
+	52, -96, -7, -7, -35, -81, -83, 42, 
+	-114, -18, 126, 13, -29, 109, 20, 157, 
+	-32, -68, -131, -85, 47, 186, 77, -34, 
+	-1, 118, -39, 27, 77, 100, -24, -36, 
+	39, 41, 64, 17, 102, -63, 70, -8, 
+	182, -52, 53, -82, 12, -3, -16, 21, 
+	45, -89, 73, 126, 79, 79, -72, 103, 
+	157, -30, 103, 117, 46, 29, 129, -16, 
+	-65, 27, 86, -94, -53, 55, -11, -97, 
+	52, -74, 96, 72, -60, 156, 51, -10, 
+	-26, 7, 28, -47, 120, -36, 94, -117, 
+	-22, -53, 223, -2, -29, 21, 115, 35, 
+	74, -122, 97, 3, 89, 57, 93, 42, 
+	57, 8, -15, -109, 11, 79, -39, 18, 
+	-34, 78, 22, -14, 31, 109, 41, -150, 
+	6, -17, -34, 107, -63, 201, 57, 97, 
+	-117, 3, -18, -49, -52, 2, -6, 21, 
+	16, 12, -127, -56, -5, -3, 31, 37, 
+	-95, 60, 19, 106, 150, -34, 16, 86, 
+	2, 101, 39, -56, 47, 10, -37, -98, 
+	66, 121, 2, 8, 19, -11, -11, -148, 
+	-107, 8, -38, 1, 69, -144, -98, 120, 
+	-35, -71, 11, -24, -86, 17, 46, -142, 
+	-65, 15, 263, 17, 106, 134, 21, 26, 
+	-58, -97, 61, 23, 13, -142, -62, 123, 
+	-11, -45, -140, 0, 36, -64, -8, -13, 
+	37, -41, 122, 21, 9, 20, -48, 74, 
+	38, -34, -122, -62, -17, 3, -23, -102, 
+	31, -22, -40, -114, 54, -4, 139, -57, 
+	-92, 73, 99, 2, 98, -167, -44, -135, 
+	98, -110, -110, -19, -56, 105, -168, 31, 
+	-25, 87, -40, -62, 99, -9, -47, 163, 
+	-37, 6, -14, 45, -68, 10, 87, 57, 
+	17, 39, 130, -22, -116, 21, 110, -58, 
+	184, -74, -70, -53, -65, -76, -92, -70, 
+	86, 72, 49, 49, -39, 89, 82, 44, 
+	29, -82, 1, -148, -12, 100, -59, 107, 
+	-144, 154, 73, -144, 24, 66, -59, 106, 
+	-65, 19, 34, 22, 41, 59, 89, -71, 
+	-10, 16, -24, -54, -68, 26, -131, 135, 
+	29, 55, -22, 31, 37, 23, -8, 52, 
+	-13, -63, -82, 23, -87, -34, 73, 37, 
+	5, 16, 50, -128, -77, 39, 48, 41, 
+	69, 23, -62, 64, 110, -61, -51, -52, 
+	-130, -147, 2, 17, -55, 69, -67, -53, 
+	-56, -93, -3, 41, 148, 32, 139, 42, 
+	-70, -136, 38, 121, -10, 64, 95, -102, 
+	-148, 169, -96, 86, 0, -64, 57, 67, 
+	63, 65, 95, 66, -27, -127, -26, 60, 
+	67, 46, 112, 8, 111, 70, 43, -160, 
+	-121, -62, -67, -83, -66, 94, 93, 22, 
+	-78, 54, -73, -21, -77, -35, 54, 11, 
+	-30, -39, 96, 127, -93, -216, 82, -37, 
+	133, -240, -126, -29, -97, 46, 70, -5, 
+	-34, 115, 79, 10, 6, 116, -122, -103, 
+	14, -143, 48, 135, -70, -26, -59, -8, 
+	146, 51, -60, 0, -142, 85, -41, -55, 
+	39, -23, -213, -11, -21, -38, 7, -82, 
+	24, 27, -75, -23, 7, -104, -62, 36, 
+	-199, 112, -21, 84, 70, -86, -1, 43, 
+	4, 19, -48, 140, 17, -104, -136, -87, 
+	76, -48, -65, 106, -113, -1, -35, 12, 
+	50, -15, -65, -49, 62, -146, -1, -12, 
+	-7, -51, -53, -44, 223, 134, -3, 187, 
+	-41, -62, 66, -54, -135, -110, -4, 126, 
+	87, 91, -111, -42, 24, 34, 88, 46, 
+	136, -55, 10, -24, 26, -127, 73, 15, 
+	-72, -118, -58, 56, 50, -35, -12, 158, 
+	-109, -36, 140, 36, 117, -143, 88, 68, 
+	-89, 61, -60, 109, 22, 150, 151, 45, 
+	36, -74, 116, -35, 61, 49, 152, 128, 
+	-152, 84, -63, 150, 185, 44, 35, 101, 
+	155, 37, 176, -64, -32, 33, 92, 72, 
+	-45, 12, -97, 34, -61, -117, 23, -29, 
+	41, -38, -36, 89, 133, -64, 45, 10, 
+	-40, 118, 13, 121, 40, -47, -94, -12, 
+	-32, -21, 62, 159, 101, -129, -34, -29, 
+	9, 27, -91, 90, 14, 75, 28, 85, 
+	78, -175, 75, -44, 59, 54, 95, 15, 
+	-33, -31, 85, -32, -43, 74, -13, 104, 
+	-18, -30, -15, -79, -10, 6, 99, 16, 
+	120, 109, -123, -100, 96, -96, 19, 109, 
+	64, -97, 180, 32, 97, -174, 23, -79, 
+	126, -28, 51, 83, 87, 63, 68, -76, 
+	-42, 48, 109, 49, 57, -43, 93, -39, 
+	38, -84, -12, 49, 59, -60, 43, -47, 
+	-43, 1, 46, 24, -116, -7, -79, 105, 
+	113, 84, 18, -27, 46, 42, -75, 47, 
+	108, -43, -112, -106, -73, -62, 60, -39, 
+	-34, 138, -146, 97, 12, -51, 27, -20, 
+	-218, -46, 8, 27, -126, -33, -54, 112, 
+	-22, 34, -67, -42, -77, -8, -31, -89, 
+	19, -163, -55, -152, -4, -7, 54, -145, 
+	-12, -56, -36, 21, 180, -116, 1, -66, 
+	-78, 111, -164, 4, -28, 50, 126, -184, 
+	76, 51, 389, -31, 18, 14, 90, 48, 
+	-58, -78, 78, -63, 88, -57, -42, 1, 
+	-3, -39, -262, -54, 33, 41, 2, -31, 
+	-67, -90, 175, -2, -62, 116, -41, -91, 
+	-130, -199, -51, -53, 35, -150, 90, -65, 
+	-35, 82, -114, 11, -15, -35, 16, -24, 
+	-88, -128, -65, 26, -41, -30, -151, -97, 
+	39, -86, -57, -56, -59, -87, -86, -57, 
+	44, 85, -7, -146, -105, 79, 16, 82, 
+	-67, -19, -62, 33, 16, -30, -53, 28, 
+	9, -7, 98, 14, 22, -31, -20, -21, 
+	90, -6, 64, -18, 4, -28, -62, -33, 
+	20, -150, 64, -5, 116, -44, 174, 26, 
+	4, 162, -13, -159, 20, 160, -26, -7, 
+	-138, 161, 87, 2, 57, -86, 23, -20, 
+	118, 108, -17, 42, -20, 57, -46, 117, 
+	100, -33, -13, -49, -84, -63, 35, -55, 
+	42, 138, -158, 18, -42, 24, 124, -110, 
+	-24, 189, 62, -89, -84, 51, -73, -126, 
+	-13, 33, -43, -3, -112, 10, 41, -38, 
+	110, 26, -69, -28, 57, 70, -74, 44, 
+	-61, -213, -55, 100, -21, -135, 57, -125, 
+	-59, -92, 19, -24, 70, -21, 63, -61, 
+	-71, 66, -15, 18, 53, 108, 103, 53, 
+	13, -118, 246, -39, 138, -16, 57, -62, 
+	15, 99, 92, -73, -25, -106, 92, 38, 
+	-118, -33, -65, -17, 48, 36, 130, -99, 
+	30, 143, -120, 61, -89, -180, -51, -11, 
+	-2, -59, 83, -160, 30, -151, -118, -16, 
+	-39, 72, 70, -28, -23, -66, 18, -15, 
+	2, -181, -79, 160, 27, -30, 65, -91, 
+	-51, -118, 64, -41, 9, 99, -114, -45, 
+	-198, 62, -72, -69, -7, 33, 77, -69, 
+	56, -86, -14, 1, 12, -89, 129, -71, 
+	-11, 11, 15, -84, 36, -42, 31, 21, 
+	32, 70, -76, 46, -71, -69, 26, 249, 
+	-118, -69, 28, -54, -34, -63, -96, -42, 
+	-17, 49, 20, -86, -19, 87, 35, 8, 
+	-22, 114, 57, 7, 0, -9, 76, -115, 
+	49, -78, 145, -89, 77, -126, -79, 109, 
+	-4, 70, 67, -33, -10, -61, -68, 13, 
+	80, 73, 42, 35, -38, -34, -150, 150, 
+	-90, -96, 134, 73, 27, -25, -20, -3, 
+	-16, 23, -146, 124, 37, 33, 74, 74, 
+	-122, 8, 16, -27, 34, 5, 56, 8, 
+	38, 74, 66, -58, 95, -149, -126, -20, 
+	-82, 76, 99, 85, 169, 93, 55, -40, 
+	-83, -58, 22, -18, -34, -24, -50, 74, 
+	116, 69, -116, 2, -61, 68, 86, 45, 
+	141, 56, 38, 71, 26, 121, 33, -59, 
+	-68, 35, -34, 66, 18, -57, 68, -54, 
+	-105, -93, -87, -24, -99, -33, 83, -72, 
+	-36, -35, -29, -34, -97, -22, -47, -18, 
+	-72, -93, 4, 45, 17, -56, 50, -22, 
+	-102, -13, 23, -99, -91, -74, 36, -94, 
+	-55, 6, 41, -67, -45, -24, 65, 21, 
+	37, -66, 73, 3, -59, 26, 82, -73, 
+	-54, -37, 69, 82, -82, -93, -59, -33, 
+	29, -97, 49, -86, 59, -33, -57, -19, 
+	-106, -20, -31, 40, 15, 4, 20, -23, 
+	14, 41, 20, -74, -3, 16, -46, -28, 
+	-82, 67, 44, -65, 60, 1, -109, -27, 
+	68, -75, -3, 64, -109, 56, -95, -73, 
+	-82, 6, -106, -6, -38, 26, 70, -47, 
+	-42, -6, -54, 74, 35, -59, -63, 20, 
+	-22, -90, -39, -68, -14, -98, 83, 80, 
+	45, -80, -64, -25, 22, 0, -11, 46, 
+	-50, -32, 47, 3, -31, -53, -3, 24, 
+	27, 20, -7, -37, 76, -72, 59, -20, 
+	45, -89, -71, -8, 58, -124, -8, -97, 
+	-48, 79, -65, 73, -38, -71, -59, 33, 
+	-8, 68, -32, -32, -15, -42, -62, -44, 
+	-91, 52, -61, -81, 14, 28, 23, 34, 
+	-88, 7, 57, -61, 53, -82, 36, -102, 
+	24, -37, 26, 30, -94, -115, -104, 37, 
+	-73, 69, -76, 17, 53, -67, 38, -6, 
+	-65, 69, -89, -111, -103, 58, -87, 69, 
+	-101, -103, -85, 8, 76, -50, -80, 61, 
+	-68, -104, -37, 72, 76, 6, 52, -12, 
+	-41, 51, -114, -62, -107, -51, 3, -75, 
+	58, -83, -59, 2, -81, -89, 0, -64, 
+	77, 34, 32, -65, 81, 13, -1, -90, 
+	67, -85, -83, -75, 53, -52, -52, 29, 
+	-29, -13, 75, -76, 49, 80, 34, -27, 
+	-43, 31, 75, -49, -58, -57, -19, -32, 
+	53, 56, -15, -92, 3, -30, 18, -2, 
+	71, -43, -40, -100, -61, 71, -96, 77, 
+	-102, 61, 7, 20, -39, -103, 59, -77, 
+	26, 54, -66, -62, 48, 61, -72, 75, 
+	41, -17, 48, -95, -36, -28, -54, 81, 
+	27, 62, 36, -14, 72, -61, 40, 10, 
+	-51, 59, -14, -42, 29, -9, -87, -145, 
+	38, 16, 51, 38, 17, -91, -33, 21, 
+	-83, -24, 46, 11, 49, -54, -5, 67, 
+	64, 64, 63, 17, 19, -84, -95, -29, 
+	40, -16, 48, -11, 52, -32, 63, -83, 
+	-49, -3, -96, 49, -28, -111, 79, -40, 
+	-84, 19, -56, -93, -62, 6, 62, 50, 
+	52, -37, -33, 42, -22, 20, -55, 48, 
+	-93, 61, -96, -8, -9, 66, 15, 74, 
+	-79, 73, 81, -82, -82, -41, 56, 37, 
+	2, 15, 31, 67, -84, 50, -88, -87, 
+	-25, 62, -90, 7, -76, 62, 38, -91, 
+	-101, -62, -78, 25, -79, -68, -18, -85, 
+	-40, -89, -76, -33, 63, -54, -33, -71, 
+	12, -40, -39, 17, -54, -21, 17, 35, 
+	63, -47, 1, -98, -83, 86, -41, -53, 
+	-73, -85, -83, 54, -38, -52, -91, 15, 
+	-132, -92, -7, -71, 74, -3, -61, 60, 
+	41, -78, 58, -40, -64, -34, 3, -81, 
+	2, 75, -90, 52, 44, -33, 60, -64, 
+	21, 67, -28, -21, -80, -87, -104, -44, 
+	-102, -34, -72, 19, 41, -86, 54, 30, 
+	-89, -16, 66, -75, 25, -104, 4, -33, 
+	36, 66, -123, -48, -88, -56, 79, -80, 
+	57, -35, -77, -100, -27, -110, -77, 49, 
+	-29, -82, -3, 55, -87, 57, -20, -66, 
+	68, -28, 23, -38, 23, 0, -89, 45, 
+	46, -71, 34, -51, -81, -6, -1, -45, 
+	5, -19, -121, 70, -30, -93, 62, -50, 
+	-69, 64, 11, -4, 46, -68, 60, 44, 
+	-82, 34, -91, 28, 17, -79, -36, -94, 
+	-148, -218, 193, 89, -2, -133, -178, -122, 
+	-136, -94, -192, -28, 65, 18, -174, -266, 
+	-76, -243, -63, -22, -76, -18, 15, -19, 
+	-121, -224, -168, -202, -222, -122, -52, -79, 
+	108, -129, -147, -83, 63, -150, -138, 62, 
+	-145, -50, -117, -157, -120, 21, -2, 168, 
+	-106, -48, 85, 28, -228, -2, -13, 25, 
+	-139, -76, -85, 24, -67, -129, -189, -216, 
+	10, -4, 197, 85, -135, 95, -139, -130, 
+	-189, -105, 111, -126, -66, -56, 90, 15, 
+	-29, -134, -77, 33, -68, -54, 232, -249, 
+	31, 201, -143, -159, -31, 88, -241, -269, 
+	-75, 7, 135, -86, -65, -111, -9, 49, 
+	-22, 373, -172, -157, -121, -206, -176, -67, 
+	-4, -65, 62, -2, 9, 104, 2, -84, 
+	80, 21, -108, -48, 16, 84, -31, -10, 
+	47, -106, 217, 21, 58, -54, 178, -60, 
+	-40, -204, 93, -174, -118, 202, -349, 148, 
+	-146, -143, -61, -94, -201, 14, 0, -38, 
+	-10, 128, 94, -199, 12, -10, -133, -151, 
+	147, -34, -12, -56, -74, -66, -2, 33, 
+	-110, 16, 19, -88, -73, -32, -24, -61, 
+	-6, -11, 218, 36, -180, 178, 106, -73, 
+	20, 92, -38, -34, 44, -127, 113, -91, 
+	7, -224, 40, -29, -104, 51, 43, -20, 
+	-26, 93, -194, -96, -22, -165, -90, 48, 
+	-188, -58, -76, -131, -50, -132, 62, -145, 
+	50, -239, -53, -71, -22, 226, -98, -57, 
+	-129, -314, -21, -17, 11, -134, -180, -151, 
+	-98, -244, 59, -52, -165, -144, -131, -149, 
+	-314, -85, 302, -100, -10, 165, 6, -114, 
+	-178, -73, -85, -61, -76, -140, -157, -16, 
+	158, -114, -72, -108, 122, 2, -7, -47, 
+	-61, -101, 79, -24, -98, -76, 137, 199, 
+	9, -116, -61, -58, -78, 45, -56, -61, 
+	-155, -290, -111, -62, -46, 289, -12, -41, 
+	204, -205, 144, -258, 47, 123, -16, -32, 
+	-190, 164, -123, -57, 135, -177, -183, 3, 
+	17, -69, -32, 279, -147, -115, 72, -40, 
+	-144, 70, 145, -91, 56, -120, -182, -101, 
+	-79, -19, 132, 33, 40, 2, -72, -96, 
+	6, -102, 129, -188, -20, -72, -274, 85, 
+	85, -144, -127, -27, -112, 195, 60, -126, 
+	42, 7, -133, -172, -19, -10, -68, -96, 
+	38, -3, -5, -134, -12, 61, -209, -117, 
+	7, -31, 35, 135, 157, -98, -65, -53, 
+	177, -10, 137, 22, -89, 16, 43, -128, 
+	62, 98, -120, -76, 84, 19, 6, -71, 
+	89, 54, 27, 49, -17, -185, -151, 74, 
+	-14, 84, 154, 133, -16, 153, -7, -25, 
+	2, -200, -100, 124, -75, 56, -190, 32, 
+	-66, -133, -80, 128, 18, 12, 122, -43, 
+	-171, -137, 148, 77, 273, -67, 74, -6, 
+	-44, 88, -118, -94, 15, -122, -143, 14, 
+	68, 90, 253, -58, -2, -116, 81, -25, 
+	-14, 100, -100, 49, 21, -18, 94, -77, 
+	-30, 87, 238, -154, -16, -36, -59, -58, 
+	78, -55, -96, -96, -33, -17, -57, 218, 
+	-39, -172, 25, 67, -127, 172, 72, 72, 
+	-13, -16, 30, 68, -81, 11, 9, -101, 
+	-49, 3, 14, -90, 110, 59, -53, -113, 
+	-6, 72, 97, -30, -54, -63, 117, 50, 
+	-108, -140, 42, 23, -54, -33, -120, 74, 
+	-25, -5, 99, 0, 166, 36, -105, 44, 
+	24, 100, 224, 50, -146, 49, 55, -52, 
+	27, -51, 52, -104, -183, -8, 25, 110, 
+	-13, 31, 67, 37, -164, 52, -29, -117, 
+	-104, -158, 34, 5, -90, 119, -93, -132, 
+	-30, 51, -96, 106, 9, -35, -183, -187, 
+	25, -157, 84, -6, 33, 38, -142, 8, 
+	-54, 171, 95, -15, 58, -51, -58, -92, 
+	33, 3, -170, -130, -91, -23, -113, -226, 
+	8, -43, 21, -19, -97, -20, -84, -87, 
+	-64, -2, -14, -4, -95, 0, 37, -81, 
+	31, 66, -94, 61, -123, 15, -23, 80, 
+	76, -20, -77, -80, -44, -24, -39, 40, 
+	-42, -30, -59, -46, -70, -51, -99, 60, 
+	55, -105, -55, -55, 75, -66, -55, -22, 
+	-35, -36, -57, -15, -70, -121, -82, -67, 
+	47, 84, 36, 70, -82, 27, 59, -84, 
+	-46, -125, 12, -47, -12, -47, -54, 9, 
+	-51, -58, 8, 58, 66, -46, -66, -60, 
+	82, -51, -23, 15, 5, -75, -68, -54, 
+	-68, 0, -63, 23, 44, -57, 31, -5, 
+	-52, 38, -50, -126, -54, 24, -22, 30, 
+	18, 77, 48, -23, -40, 27, -82, 2, 
+	-50, -9, 56, -70, -91, 7, -26, -78, 
+	21, -56, -3, 71, -25, -5, 27, -92, 
+	-25, -3, 0, 4, -43, 19, -91, 24, 
+	-53, -121, -80, 9, 5, -29, 49, -64, 
+	38, -37, -68, 80, -6, -43, -59, -58, 
+	22, -22, 32, -39, -41, -97, -87, -57, 
+	-76, 13, 56, -119, -68, -100, -40, -65, 
+	-31, 48, -67, -110, 34, 45, 70, 32, 
+	81, 50, -22, 11, -122, -74, 45, 37, 
+	-69, 71, 12, 54, -81, -39, -24, -30, 
+	-70, -23, -48, 22, -50, -93, -25, -3, 
+	85, -85, -37, 48, -56, -16, -35, -48, 
+	-115, -47, -57, -105, -41, 26, -1, -75, 
+	-6, -95, -50, -80, -86, -13, -99, -101, 
+	82, -4, 63, 4, -93, -37, 14, 3, 
+	-82, -105, 56, -114, 9, -91, 56, -90, 
+	-31, -88, 40, -109, 3, 4, -94, 11, 
+	-32, -89, 51, -87, -15, -29, -84, 22, 
+	82, -71, 4, -4, 37, -116, -86, 69, 
+	0, 35, 15, -58, -44, 52, 59, -80, 
+	-128, 57, -40, -51, -74, 15, -42, -65, 
+	-55, -65, -78, 2, -15, -84, 27, 25, 
+	-70, -16, 17, -5, 26, 55, 24, -40, 
+	55, -8, 40, 26, 55, 56, 24, -24, 
+	70, -17, -56, 41, 3, -97, -82, -47, 
+	84, 6, -29, 51, -112, 16, -40, -98, 
+	16, 58, -61, -91, -69, -119, -42, -11, 
+	34, 68, -57, -7, -4, 17, -41, 69, 
+	-75, -40, 67, 80, -71, 12, -21, -11, 
+	-36, -34, -26, 49, -39, -74, -90, -79, 
+	77, 56, 2, -105, 90, 88, -77, -84, 
+	-60, 13, -6, -90, 42, -44, -104, 9, 
+	-37, -17, 15, 34, -90, -38, 83, -66, 
+	40, 62, 23, 19, 45, 43, -67, -39, 
+	10, -101, 18, 8, -94, -58, 4, 24, 
+	55, 73, 50, 44, -92, -83, -45, 60, 
+	48, 12, -16, 0, -60, 75, -11, -52, 
+	-15, 26, 7, -46, 52, 65, 85, 83, 
+	64, 7, 79, 4, 23, 24, -65, -22, 
+	-71, -78, -53, -45, 39, 41, -46, -9, 
+	68, 10, -74, 48, -64, -79, 76, 14, 
+	-1, -26, 62, -20, -15, -28, -30, -83, 
+	2, 74, -19, -32, -27, 61, -41, 50, 
+	9, 46, 63, 46, -91, -60, -57, -67, 
+	-23, -62, -38, 13, -46, -82, -77, -72, 
+	24, -51, 38, -25, 46, -36, -74, -42, 
+	-42, 59, 15, 34, -49, 63, -26, 82, 
+	-20, -57, -36, 15, 55, -81, -12, -81, 
+	-43, -64, 4, -20, -102, -11, -59, -22, 
+	-20, -118, 6, -12, -85, -49, -62, 23, 
+	2, -53, 6, 71, -92, -18, -58, -83, 
+	-9, 13, -69, 19, 50, 56, 36, 63, 
+	-16, -72, -6, -57, -70, -69, -42, 31, 
+	-66, -72, 16, -66, -76, -39, -93, -82, 
+	-27, -20, -95, 21, 18, -25, -20, -11, 
+	63, 18, 13, 48, -83, 65, -72, 24, 
+	47, 53, 23, -12, 13, -83, 18, -85, 
+	-14, -71, -118, -78, -115, -35, -106, 9, 
+	94, 52, -8, -95, -37, 11, -28, -38, 
+	-68, -66, 182, -22, 82, 5, -37, 107, 
+	17, 13, -14, 182, -49, 48, 99, 74, 
+	93, 93, 5, 31, -107, -83, 120, -67, 
+	71, -92, -38, 227, 168, 27, -20, -31, 
+	17, 61, 34, -15, -14, 67, 96, 26, 
+	27, -68, 72, 42, 14, -61, -60, 74, 
+	137, -51, -14, 25, -10, 21, 54, -37, 
+	38, -12, 1, -36, 100, -127, -114, 3, 
+	-45, 140, 101, -165, 16, -41, -17, -102, 
+	17, -71, -90, 27, -6, -17, -103, 68, 
+	51, -51, -17, 42, -78, -63, -43, 53, 
+	45, -65, -138, 71, -117, 24, -25, -25, 
+	-63, -77, -62, 22, 29, 36, -91, 47, 
+	-54, 78, -61, -70, 56, -53, 5, 21, 
+	-50, -31, -7, 78, 15, -48, -63, 75, 
+	192, 38, -187, -5, -40, 15, -5, -60, 
+	26, 60, 75, 74, -12, 179, 10, 23, 
+	-46, 9, -30, 2, -95, 21, -82, -80, 
+	92, 59, 35, -87, 8, 105, -52, -45, 
+	92, -98, 147, -71, -61, 165, 150, 22, 
+	-12, 64, 94, 78, 128, 12, 29, -131, 
+	-74, 16, -248, 17, 10, 57, 52, 2, 
+	-65, 66, 28, -43, 7, 33, 47, 80, 
+	-94, 26, 16, 62, 79, 135, 66, 53, 
+	98, -35, -6, 64, 53, -76, -55, -17, 
+	28, 161, 144, 83, 66, 24, 27, 106, 
+	28, 8, -36, 77, -63, -91, 19, 95, 
+	31, -19, -58, 69, -250, -77, 12, 92, 
+	109, 36, 56, -29, -2, -7, -41, 74, 
+	48, -42, -49, 145, -21, 100, 23, -88, 
+	-71, -4, -37, -71, -42, -15, -8, -96, 
+	17, -50, -14, 117, 36, -103, -64, 91, 
+	-4, -14, 65, -171, -7, -74, 13, -41, 
+	-45, 41, -149, 18, -57, -2, 5, -39, 
+	-66, -14, -13, -63, 104, -87, 42, 63, 
+	199, 41, -9, -204, -82, -68, 12, 4, 
+	-85, 42, -31, -16, 1, 57, -50, -32, 
+	19, -5, 55, -108, -31, 89, -65, -34, 
+	-120, -93, 91, -16, -4, -112, -5, -116, 
+	-15, 90, -35, -65, -143, -56, -54, 46, 
+	-14, 115, 68, 79, 77, -29, -18, 51, 
+	2, 210, 98, -26, 11, 2, 26, 204, 
+	137, -15, 18, 98, 56, 8, 17, 142, 
+	2, -40, -130, -55, -145, -70, 23, 24, 
+	4, -19, 98, -34, 73, 141, 102, 145, 
+	-67, 34, -73, 93, -52, -5, 63, -77, 
+	28, -31, -7, -55, -7, 44, -15, -81, 
+	-54, 80, 110, 129, -63, -79, 35, 113, 
+	19, 50, 248, 105, -45, 114, 52, 42, 
+	19, -34, -78, 79, -89, 60, -10, -82, 
+	-23, -83, 62, -136, -12, -4, 3, -12, 
+	128, 75, 138, -93, -32, -64, -62, -43, 
+	-88, 87, -113, -120, -36, 43, 66, -34, 
+	17, 57, -160, 78, 19, 59, 61, -80, 
+	-96, 82, 90, 43, 153, -95, 75, 64, 
+	6, -57, 47, -49, 148, 43, 139, -51, 
+	-173, -46, 52, -41, 31, 82, 1, -72, 
+	86, 24, -24, -175, -24, 121, -34, 18, 
+	148, -124, 75, -67, -122, 34, 80, -172, 
+	28, 105, -71, -294, 77, 10, -17, 128, 
+	88, -22, -159, 49, -62, 80, 70, -103, 
+	-21, 91, 88, 60, -151, 6, -70, -185, 
+	-31, 13, 9, 123, -18, 117, -20, -63, 
+	16, -133, 94, -93, -22, -16, 178, 11, 
+	1, -178, 152, 12, -92, -41, 40, -11, 
+	44, -112, -35, 29, -116, -93, -49, 52, 
+	124, 59, 76, -24, -8, 48, -18, 8, 
+	51, 2, 137, -25, 73, 50, -2, 67, 
+	-7, 12, 19, -120, -181, -111, -24, -26, 
+	-5, -74, 74, 81, -162, 4, 37, 106, 
+	128, -88, -140, 67, -9, 16, 41, 139, 
+	-30, 121, 4, -120, -30, -151, -85, 143, 
+	1, 84, 10, 40, -88, -9, -51, -91, 
+	39, -24, 60, 2, -19, 180, 15, -18, 
+	-120, 10, -29, 116, 111, -62, 79, -79, 
+	-119, 12, -132, 138, 30, -1, 65, 158, 
+	18, -65, 57, 77, -35, -57, 31, 53, 
+	133, 163, 12, 48, -149, -16, 119, -82, 
+	-22, 47, 155, -30, 70, 42, 150, -112, 
+	-154, 55, 160, 12, -102, -206, 18, -211, 
+	-70, -76, 166, -72, 46, 30, 4, -91, 
+	-47, -219, -42, 21, -92, -119, -40, 26, 
+	72, -115, -28, 32, 125, -74, 10, -81, 
+	-8, -45, -91, 37, -9, -12, -66, -62, 
+	101, 102, 33, -13, -33, -26, 87, 56, 
+	-29, -105, 21, 9, -165, 34, -51, -38, 
+	-130, -125, -19, -72, -156, -126, 20, -165, 
+	-21, -25, 131, -16, -120, -35, -30, -41, 
+	49, 22, -93, 56, 142, -63, 38, -69, 
+	-26, -81, 31, -56, -80, -161, -30, -79, 
+	24, 1, -95, 127, -35, 9, 6, -235, 
+	-42, 76, -39, -172, 249, 24, -82, -75, 
+	134, 49, -159, 65, -73, -142, 101, -100, 
+	34, -221, 163, -18, -107, -50, 17, -75, 
+	-151, -91, 14, -63, 64, -40, -107, -119, 
+	-159, 14, -66, -32, -110, 87, -38, 122, 
+	20, -161, -12, -43, 99, -38, -70, -63, 
+	-56, -85, 87, 32, 25, 68, -69, 6, 
+	-127, -20, 136, -69, 123, -151, -20, -59, 
+	-26, 100, -100, 11, -108, -134, -111, -32, 
+	55, -16, -56, -25, -96, -34, 18, -27, 
+	-34, -90, -70, -57, 21, -47, 17, -68, 
+	-110, 9, -111, -93, -147, -140, 12, -12, 
+	4, 102, 38, -25, 23, -15, -63, -60, 
+	57, 79, -20, -21, -165, -18, 13, -21, 
+	-39, 24, -72, -40, 100, -117, -44, 78, 
+	-175, -89, -63, 140, 111, 29, -10, -95, 
+	-20, 2, 30, 20, 72, -28, 50, -73, 
+	-21, -37, -33, 18, -124, 35, 62, 5, 
+	-131, -166, -32, -7, 83, -88, -7, 83, 
+	-50, -36, -92, -41, -145, -90, -23, 91, 
+	65, 122, -120, 179, -96, -113, -68, 87, 
+	2, 108, -92, -50, 17, -101, 76, -7, 
+	20, -85, 71, -148, 124, -85, -8, 118, 
+	-72, -83, -54, 153, 31, -89, 0, 112, 
+	44, 3, 53, 49, -21, 66, -74, -54, 
+	81, 69, 147, 125, 128, 18, 85, 14, 
+	-56, -25, -32, -138, -39, -31, -91, 11, 
+	-46, 52, 29, 92, -96, -109, 24, -190, 
+	43, -5, -29, -40, 72, -38, -30, -163, 
+	-8, 31, -2, 47, -114, 51, -97, -137, 
+	-1, -128, 14, -103, 37, -155, 35, -95, 
+	-11, -44, 98, -38, -131, 85, -88, -35, 
+	-89, 42, -74, 162, 32, 34, -38, -58, 
+	-15, 14, 59, -124, -152, 34, 52, -90, 
+	-20, -63, 75, -154, 126, 45, -136, 97, 
+	-32, -146, 30, -40, 41, 15, 38, 1, 
+	-22, -76, -68, -57, -26, -35, -71, 43, 
+	-7, -3, 205, 70, 173, 40, -45, 7, 
+	-24, 12, 77, -36, 64, 44, 13, -201, 
+	13, 26, -23, 84, -56, 235, -120, -87, 
+	-93, -36, 123, 97, -89, 23, -9, 54, 
+	87, -178, 69, -78, 42, 40, -103, 49, 
+	-94, 107, 35, -153, 75, 43, 42, 201, 
+	-74, -155, 131, -43, 4, 48, 87, 49, 
+	25, -79, -156, -62, -138, -42, -18, 49, 
+	-128, 63, 75, 103, -110, 32, 181, -130, 
+	25, 29, -104, -105, 89, 65, 121, 13, 
+	-135, -83, -33, 19, -103, 15, -94, -11, 
+	-147, 94, -40, 116, 70, -119, -67, -107, 
+	136, -6, 26, -78, -80, -49, 81, 28, 
+	-82, 217, -3, -113, 79, -21, -44, 30, 
+	19, 15, -19, -94, -13, 56, -66, 28, 
+	-5, 30, 48, 54, 30, -76, 8, 48, 
+	86, -35, -82, -46, -49, -16, 17, 38, 
+	-233, 14, 16, 44, 75, 70, 65, -46, 
+	85, -61, -75, -234, 13, 107, -165, -2, 
+	48, 28, 21, -113, -60, -85, -171, -105, 
+	55, 36, 24, -114, -83, 1, -64, -176, 
+	-64, -130, 31, -45, 149, 9, 89, -25, 
+	-78, 32, -62, -49, 132, 25, 1, 10, 
+	99, 38, -182, -109, -32, 88, 4, 31, 
+	21, -37, 44, -97, 103, -10, 67, 183, 
+	-80, -84, 114, -11, -6, -30, -36, -35, 
+	-53, 151, 111, -166, -24, -87, -51, 55, 
+	54, -82, 109, 28, 139, -10, 84, 66, 
+	26, -30, 52, 30, 59, -50, -22, 64, 
+	-62, 114, -106, 74, 47, -114, 86, 5, 
+	123, -6, -91, 56, -22, 0, -91, 17, 
+	94, -41, -52, 55, -56, 19, 108, -15, 
+	-81, -49, 45, 29, -19, 29, -78, -13, 
+	32, -13, 52, -50, -59, 70, -62, -171, 
+	40, -159, 46, -91, -53, 41, 13, 60, 
+	9, -76, -60, 25, -156, 10, 23, -43, 
+	-39, -5, -34, -89, 66, 52, -45, -105, 
+	-20, 41, 109, -49, 56, 20, 69, 92, 
+	66, -41, 53, 73, 50, -56, 115, 53, 
+	93, -159, -2, -3, 31, 47, -84, 38, 
+	-158, -6, -37, -22, 108, 131, 1, -86, 
+	122, 6, 62, -37, 15, 89, 7, 15, 
+	140, -93, -142, -100, -38, 62, 40, -31, 
+	43, 87, 112, -116, -278, -77, -61, 116, 
+	14, -32, 88, -105, 40, -40, -5, -117, 
+	-63, -33, 38, 49, -127, 5, -10, -155, 
+	-55, 127, -14, -52, 129, 69, 76, -123, 
+	-2, 52, -221, 122, 139, -146, -157, -72, 
+	-247, -56, -16, -57, -2, 104, 13, 162, 
+	-13, 61, -166, -121, -38, 66, 6, -76, 
+	33, -161, -69, -67, 120, 53, -168, -42, 
+	159, -83, -24, -94, -164, -63, 47, 79, 
+	-52, 129, -234, -14, 28, -39, 49, 80, 
+	148, -37, -16, -83, -165, 19, 90, -75, 
+	-81, 80, 77, -21, -25, -110, -80, -97, 
+	40, 87, 117, 4, -93, 18, -25, -45, 
+	81, -175, -54, -73, 48, -122, 37, 68, 
+	-176, -217, 11, -2, -89, -80, 105, 4, 
+	-7, -74, 9, -61, 60, -115, -72, 19, 
+	20, 31, -94, -59, -214, -42, -44, -61, 
+	43, 108, -79, 4, -59, 65, 55, -73, 
+	-6, -232, 103, 108, -184, 178, -121, -86, 
+	-145, 26, -5, -143, -12, -107, 108, -43, 
+	-127, -63, 98, 72, -4, -73, 15, 0, 
+	4, 121, 81, 66, 128, 99, -65, -108, 
+	166, -43, -75, -3, -33, 28, 113, 30, 
+	8, -106, -77, 33, -101, 3, 10, 140, 
+	103, 110, 61, 75, 111, 18, 70, -100, 
+	-90, 32, -27, -9, 66, -44, 105, 12, 
+	65, 81, -24, 93, -23, 21, -7, -122, 
+	-23, -64, 129, 10, 93, 54, 38, -133, 
+	-55, 21, -115, 86, 124, -20, 57, -80, 
+	24, 80, 47, 38, 54, 61, 15, -29, 
+	92, 7, 26, -38, 3, -80, 23, 88, 
+	101, -7, -22, 118, 10, -114, 31, 48, 
+	106, 9, -35, -60, 80, 69, -130, 2, 
+	-55, 98, -123, 60, 69, 122, -67, 60, 
+	85, 32, 69, 26, 83, -152, 6, -123, 
+	-63, -109, -88, 25, -120, 24, 48, 30, 
+	30, 15, -78, -14, 95, 18, 120, -38, 
+	150, 85, 98, -56, 1, -158, -3, 143, 
+	125, -76, 59, 91, -78, -35, -146, 147, 
+	24, 33, 39, 42, 61, 49, 183, -57, 
+	-162, 136, -192, -8, -55, -26, 13, -53, 
+	25, -29, 12, -48, -64, 68, -65, 74, 
+	-56, 41, 76, -120, -22, 41, 26, -1, 
+	119, 46, -139, 69, 76, 42, -3, 223, 
+	107, 5, -7, 6, -39, 144, 70, 28, 
+	-130, -133, -51, -43, 43, 54, 62, 39, 
+	86, -62, 113, 10, -129, 64, -31, 46, 
+	-3, 48, 90, -134, -67, 157, -69, -26, 
+	68, 10, 49, -133, -71, -44, 7, -17, 
+	-32, 102, -111, -65, -51, 5, -98, 66, 
+	-57, -116, 45, 21, 64, 122, 15, 38, 
+	29, -126, 27, -29, -42, -127, 57, 14, 
+	50, -55, -94, 14, 8, 154, 8, 20, 
+	-13, -98, 165, -1, 58, 140, 54, 170, 
+	89, -58, 136, -37, -59, 67, 9, -57, 
+	25, 120, -84, 5, -15, 158, 28, -143, 
+	-34, -256, 108, 80, -36, -19, -10, 34, 
+	12, 68, -129, 72, -77, -67, -187, -36, 
+	-27, -26, 132, -62, -72, 65, -42, -16, 
+	155, 122, -28, -26, -76, 74, -61, 116, 
+	81, -54, -4, 7, -38, 42, -9, -43, 
+	-57, -40, 157, 82, 45, 94, 90, 34, 
+	-54, 46, 38, -20, 10, -50, 70, -31, 
+	66, -76, 82, -110, 78, 96, -49, -110, 
+	114, 40, -22, -11, -12, 35, -100, -16, 
+	8, 156, 48, -70, -4, 34, -21, 19, 
+	-63, -72, 460, -60, -126, 15, -80, 114, 
+	23, 64, -121, -103, 96, 25, 70, 48, 
+	81, -89, -81, 56, -129, -40, -62, 70, 
+	-173, 99, -107, -119, -79, 6, 65, -72, 
+	101, -80, -46, -204, -107, -18, 44, 8, 
+	6, -37, -84, -170, -38, 131, 33, -55, 
+	40, -109, 67, 10, -19, -121, 2, -27, 
+	-51, 43, -140, 11, -86, -84, -44, -27, 
+	40, 43, 241, 1, -92, 23, -27, 37, 
+	-2, 14, 95, -7, 78, 7, -47, 16, 
+	22, -147, 11, 18, 50, -9, -6, -48, 
+	-23, 31, 118, -112, -139, 94, -58, 40, 
+	4, -137, -12, 30, -112, 79, -26, -168, 
+	101, 46, 33, -154, 111, 97, 133, 150, 
+	29, -9, 87, 21, 84, -102, 21, 4, 
+	13, 37, -46, -60, -14, -41, 38, -47, 
+	-5, 69, -140, 40, -59, 20, 68, 48, 
+	85, -16, 51, -68, -1, 3, -23, -24, 
+	37, -3, 26, -81, 84, 32, -91, -50, 
+	-67, -128, 172, 3, 36, -17, -18, -93, 
+	134, -148, 33, 29, 64, -19, -34, -260, 
+	49, 87, -45, 90, -97, -39, -90, -27, 
+	-69, 118, 106, -140, -158, -52, 6, 23, 
+	21, 15, -162, 112, -2, -84, -116, -52, 
+	-146, 45, 225, 17, -72, -32, 49, -57, 
+	-48, -46, -168, -17, 153, 22, 131, -8, 
+	-77, -103, 243, 4, 66, -105, 32, -84, 
+	-152, -36, -13, 0, -17, -26, 126, 15, 
+	88, 53, 98, 32, -53, 107, 121, 113, 
+	-96, -153, 56, -40, -78, -138, 184, -16, 
+	26, -224, -18, 38, 170, 61, 18, -117, 
+	-174, -3, -62, -84, -104, 0, -71, 7, 
+	-12, 7, 103, -43, 12, -124, 7, -3, 
+	64, -10, 43, 149, 24, 31, 29, 11, 
+	50, 81, -17, -3, -25, 45, 24, -101, 
+	-62, -29, -101, -97, -45, 20, -53, 65, 
+	-48, -66, 81, 29, -139, 40, 1, 111, 
+	121, -144, -89, 90, -31, -15, 116, 28, 
+	-47, -111, -164, -191, -33, 14, -49, 62, 
+	18, 133, 96, 77, -69, 75, -65, -43, 
+	0, 110, -20, 70, -119, -43, 101, -58, 
+	8, 71, -3, 98, -8, 24, -156, -62, 
+	27, 153, 33, 31, 23, 48, 35, -26, 
+	-12, -89, -120, -123, -106, 30, -39, 48, 
+	21, -42, 40, 62, -5, 44, -89, -103, 
+	92, -229, 1, -36, 28, -16, -64, -30, 
+	-66, -8, -1, -177, 20, -49, -64, 90, 
+	-95, -16, -22, 42, 88, 105, 63, -73, 
+	-88, -24, 190, 87, -100, 4, -45, -32, 
+	59, 26, 122, 143, -11, 34, 68, -96, 
+	-6, -40, 57, -52, 44, 51, 16, 108, 
+	55, -32, 114, -43, -19, -116, 37, 13, 
+	-34, -6, 64, 42, -85, -63, 7, -109, 
+	-73, 56, 97, 3, 88, -79, 10, 63, 
+	-148, 0, 8, -118, -61, -6, -74, -71, 
+	143, 217, 36, -90, -121, -20, -40, 37, 
+	42, -2, 113, -70, -101, -11, 79, -23, 
+	78, -95, -46, -5, 28, 74, -36, 31, 
+	-74, 53, -97, -108, -86, -43, -98, 18, 
+	40, -9, 68, 40, -14, -34, 85, 69, 
+	-8, 2, 54, -79, 87, -36, 61, 17, 
+	-88, -7, 25, 9, -18, 40, 44, 75, 
+	-35, 64, 6, 121, 35, -22, 78, 27, 
+	-74, 231, -16, -21, 68, 51, -87, 67, 
+	-16, -25, -24, 20, -6, -25, -63, 6, 
+	129, -106, 3, 72, 124, -56, -98, 24, 
+	68, -58, 74, -61, 43, 89, 81, -12, 
+	-114, 35, -30, -36, -137, 205, 39, -85, 
+	10, 2, -120, 82, 73, 104, -58, 22, 
+	2, -12, 37, -101, 81, 32, 77, -81, 
+	119, 68, 153, -88, -74, 52, -45, 100, 
+	29, 130, 101, 31, 41, -62, -86, -26, 
+	50, -13, 76, 46, -82, 30, 80, -78, 
+	-20, 107, 17, 66, 21, 106, 159, -89, 
+	80, 19, 32, 56, 91, -35, 109, -63, 
+	25, -132, 44, -120, -18, -139, 13, 83, 
+	-147, 130, 152, 26, -64, -65, 26, 101, 
+	-41, 59, 44, 26, -68, -150, -55, 120, 
+	74, 49, -24, 146, 271, -74, -10, 88, 
+	32, -75, 153, 84, 87, 42, -42, 119, 
+	89, 121, -16, -24, 74, -21, -36, -74, 
+	-96, 8, -27, -61, -49, -54, 73, 71, 
+	-59, -174, -34, 3, 0, 60, 14, 80, 
+	66, -27, -35, -26, -49, -49, -94, 98, 
+	51, 25, 19, 23, -136, -78, -50, 26, 
+	-18, -32, 32, 41, 139, 40, -100, -124, 
+	136, -18, 36, 94, 186, 152, -71, -61, 
+	-108, 78, -59, -66, 81, 96, -37, 92, 
+	79, 50, -24, -5, -3, -14, 31, 92, 
+	-134, 50, 187, -9, -73, -68, 60, 79, 
+	99, 171, 118, -37, -35, -27, 17, -53, 
+	-8, 99, 109, -44, 103, -53, -8, 83, 
+	79, 112, -61, 46, 58, 8, 110, 15, 
+	50, 205, -87, 120, -76, 137, -61, 52, 
+	-54, 47, 69, -20, 31, 61, -86, 3, 
+	18, 111, 30, -52, 126, -85, 15, 87, 
+	-6, -137, 202, -35, -89, -169, -6, -99, 
+	55, 42, 25, -86, -28, 53, -45, -99, 
+	-18, 95, -91, -11, 48, -125, 40, -130, 
+	27, -145, 171, 132, 22, 149, -12, 14, 
+	172, -11, 37, 114, -49, 40, 91, -54, 
+	57, -34, 118, 51, 15, -180, 15, -60, 
+	-59, 84, 19, -165, 34, -64, 74, -5, 
+	99, 99, -50, 22, 141, 119, 129, 82, 
+	121, -81, 126, 118, -3, 5, 93, -40, 
+	126, 67, 0, 78, -60, 88, 116, 30, 
+	-98, 68, 26, 59, 82, 77, 73, 118, 
+	110, 139, -76, 109, -15, -102, 20, 7, 
+	-34, -24, 103, 98, 37, -37, 15, 118, 
+	-29, 101, 207, 65, 28, -191, 190, -43, 
+	-58, 107, -141, 55, -13, 121, 5, 71, 
+	86, -69, -24, 121, -50, 80, 133, 144, 
+	-85, 14, 9, 89, 40, 102, 91, 18, 
+	13, -98, 75, 100, -119, 52, 103, -55, 
+	61, 200, -172, 136, 60, 110, 212, 8, 
+	22, 9, 88, 21, -11, -60, 140, -86, 
+	-29, -20, 54, 3, 166, 45, -66, 97, 
+	-142, 8, 50, 107, 85, -120, 102, 112, 
+	16, 101, -15, 13, -99, -73, 129, -10, 
+	99, 70, -39, 63, 161, 43, 28, -13, 
+	-105, 69, 44, -38, 154, 57, -86, 238, 
+	-60, 10, -27, 81, -56, -11, -13, 156, 
+	-10, -94, -75, -76, -51, 56, 74, -79, 
+	0, 15, -23, -165, 77, 71, -4, -4, 
+	-110, 30, -3, -63, 75, -14, -11, -50, 
+	75, 78, 67, 13, 21, 69, -12, 46, 
+	-29, 72, -6, -60, -119, 29, -51, -59, 
+	93, -128, 12, -34, -41, 23, -51, -31, 
+	-6, -85, -56, -105, -71, -75, 31, 111, 
+	-46, 124, 10, 92, -29, -20, 22, -56, 
+	23, -87, 7, 32, 46, 145, 67, 40, 
+	93, 15, -8, 59, -37, 79, -57, 31, 
+	-105, -9, -157, 38, -71, 41, 166, 21, 
+	-36, -93, -65, -136, 38, 85, -26, -7, 
+	7, 20, 32, -81, 68, 59, 40, -53, 
+	14, -71, -38, -25, 107, 28, -51, -16, 
+	81, 113, -86, 126, 33, -103, -38, 71, 
+	-110, 81, 25, -85, -22, 40, -65, 115, 
+	129, -40, 161, -16, -1, -9, 29, 57, 
+	58, -33, -174, 60, 71, 5, 57, 157, 
+	-79, 0, -11, -107, 82, 36, 1, -11, 
+	42, -33, 88, 13, -66, 156, 39, 86, 
+	133, -55, 125, -60, 116, 190, -43, -22, 
+	-46, -76, 87, -24, -71, -62, -52, 85, 
+	70, 126, -207, 15, 28, 35, -49, -84, 
+	92, 208, -17, -89, -37, -35, -32, -43, 
+	101, -142, 115, -18, -39, -90, -65, 37, 
+	50, -38, -30, -59, -10, -7, -14, -11, 
+	-6, 36, 186, -91, 63, -24, 91, -110, 
+	14, -102, -113, -53, -34, 125, 12, -124, 
+	2, -107, -41, -283, -39, -171, -59, -49, 
+	-105, 14, 44, -51, -138, -10, 8, 1, 
+	64, -2, -20, -23, 147, -46, 102, -145, 
+	110, -77, 7, -43, 12, -87, 57, 0, 
+	-140, -110, 149, -40, 65, -186, -28, 90, 
+	-19, -69, -11, 102, -33, 56, -95, -38, 
+	-66, 20, -50, 21, 71, 27, -112, -100, 
+	101, -144, -97, -112, 11, -10, -135, 10, 
+	99, -40, 12, -61, -26, -43, 68, 77, 
+	-52, -41, -199, 3, -72, -69, -66, -33, 
+	-37, 58, 25, -77, -40, -26, 6, 40, 
+	-13, 49, -105, -55, 112, 10, 10, 206, 
+	25, 20, 121, -79, -41, -66, 120, 76, 
+	106, -21, -83, 49, 6, 21, 20, -69, 
+	-61, -166, -40, 89, 77, -62, 27, 67, 
+	35, 167, -69, -72, 14, 143, 35, 20, 
+	-30, 146, 63, 104, 163, -105, 18, 43, 
+	-19, 183, 76, 108, 85, -44, 88, -145, 
+	-32, 8, -115, 44, 157, -65, -42, 91, 
+	-9, 96, 48, -92, -15, -78, 11, -60, 
+	-59, -98, 44, 146, 86, -149, 29, -8, 
+	-30, 11, 60, -159, -58, 175, 141, 34, 
+	190, 1, -205, 50, 54, 68, 93, 8, 
+	-7, -128, -24, -88, 30, 73, 66, 20, 
+	50, -3, 70, -192, -67, -26, 48, 17, 
+	-33, 140, -130, -79, 63, -47, -49, -3, 
+	168, -6, -16, -1, -79, -29, 98, -174, 
+	27, 123, 35, 44, 62, 90, -107, -94, 
+	-161, 81, -131, -7, 124, -5, 213, -70, 
+	101, -3, 2, 12, -57, -45, -177, -74, 
+	-95, -39, -51, -24, 103, -58, -28, 50, 
+	84, -134, 128, 77, 0, -85, -49, -54, 
+	-3, -163, -108, -4, 14, -66, 69, 39, 
+	13, -145, -66, 82, -1, 82, 51, 40, 
+	60, 71, 56, 3, 97, 38, 105, -26, 
+	-51, -77, 18, 141, -72, 50, -45, -5, 
+	75, -31, -112, 7, 180, 94, -15, 22, 
+	194, -124, 74, -98, -9, -45, -87, 216, 
+	-21, -171, -35, 98, -89, -89, -91, 96, 
+	32, 53, 11, -83, -11, -74, 114, -83, 
+	-104, -109, -85, 79, -18, 76, 129, -39, 
+	47, -188, -49, 45, 92, -150, -21, -69, 
+	-83, -44, -52, 69, -45, 104, -46, -3, 
+	124, -1, 135, -104, -35, -15, 166, 17, 
+	13, -41, -1, -88, -96, 33, 48, -41, 
+	-81, -34, -14, 30, 106, -19, -8, -3, 
+	47, 58, 0, 42, 34, -101, -26, 10, 
+	-4, -40, -48, 67, -12, -18, 67, -98, 
+	34, -129, -5, -73, -33, -53, -21, 132, 
+	74, 50, -2, 62, -1, 31, -144, 40, 
+	27, 6, 164, -3, 37, 36, 44, 4, 
+	-31, -64, -56, 55, -147, 115, 45, -30, 
+	108, 6, -65, -31, 38, -14, 117, 10, 
+	-22, 8, 26, 103, 50, -60, 45, -41, 
+	124, 38, -37, -7, 6, -71, -104, -114, 
+	73, 32, 30, 144, -117, 91, 63, -38, 
+	-47, -118, -31, 36, -43, -28, -12, 51, 
+	93, 177, -116, -20, -72, 27, -95, 130, 
+	68, -68, 17, -58, -10, 10, 100, 88, 
+	24, 44, -16, 11, 44, 45, 95, 97, 
+	49, -12, 109, 126, 35, -111, 58, 39, 
+	53, -18, -80, 46, 27, 104, 48, 126, 
+	-14, 120, -73, 42, 2, 26, 4, -4, 
+	86, 18, 20, 74, 45, -104, -48, 79, 
+	30, 13, -7, -20, -118, 27, 13, -55, 
+	52, 60, 3, -85, 82, -109, 5, 36, 
+	-64, 111, 97, -43, -78, 9, 63, 48, 
+	-66, 11, 27, 3, -15, 61, -35, 8, 
+	-53, -35, -83, 36, -84, -34, -16, -62, 
+	-16, -174, -65, -123, 33, -121, 57, -112, 
+	-73, -84, 64, -3, 108, -66, 0, 66, 
+	-116, 75, 3, 20, -73, -31, -86, -80, 
+	-41, 86, -33, 281, 57, -146, -148, -94, 
+	27, -136, 34, 115, -110, 77, -147, 11, 
+	66, 102, 8, -155, -147, -16, -47, 129, 
+	-87, -63, -104, -58, -6, -60, -29, 12, 
+	-46, -189, 220, -157, 100, -6, -76, 79, 
+	116, -67, 239, -16, -70, 108, -20, -66, 
+	-58, -248, 41, 138, -58, -68, 170, -26, 
+	-69, 9, -96, -141, 56, 38, 63, 3, 
+	15, 14, 12, 19, 125, -64, 14, 38, 
+	-19, 171, -95, -84, 10, 51, -219, 122, 
+	128, 46, 108, 55, -38, 42, 42, -82, 
+	-115, 50, 60, -110, -29, 31, 82, 58, 
+	55, 120, 198, 43, 47, -142, 7, -101, 
+	-36, 91, 62, -105, 47, 101, 79, 120, 
+	52, 77, -93, 37, 64, 121, -26, -184, 
+	47, 90, -172, 21, -33, 138, 62, -73, 
+	96, 27, 71, -116, -103, -24, -168, -66, 
+	8, 66, -57, 35, -73, 56, -90, -66, 
+	99, -168, 189, 21, -111, -82, 67, -51, 
+	13, 119, -76, 65, 6, 72, 88, -68, 
+	-21, 52, -109, 27, 25, -34, 42, -70, 
+	88, -110, 21, -27, -57, 69, -78, 109, 
+	128, -9, 116, -94, -15, 41, -30, -23, 
+	-63, -49, 98, 55, -5, -102, -46, -67, 
+	-51, 43, 4, 53, -66, -5, 11, 27, 
+	-60, 85, 2, 78, -36, 70, 37, -135, 
+	-98, 94, -10, 96, -155, -119, 130, -11, 
+	34, 16, 33, 30, -64, -102, 37, -5, 
+	-6, 43, 2, 16, 97, -50, 69, -107, 
+	-116, 64, -91, 4, 38, -38, -107, 220, 
+	-45, 75, -33, -80, -46, -66, -99, 63, 
+	99, -112, 104, -39, 93, -134, 87, 65, 
+	-50, 135, -36, 8, 9, -63, 115, -64, 
+	119, -14, 84, 51, 41, -14, -112, 13, 
+	-29, 36, 97, 75, -1, -56, 88, -52, 
+	32, -16, -1, -14, 41, 31, 29, -15, 
+	144, 38, 127, 138, -31, 79, -49, -16, 
+	-14, -9, -56, 10, -4, 109, -67, -9, 
+	18, 54, -125, 45, 53, 71, -101, 61, 
+	-79, 21, 13, 30, -107, -19, -25, -28, 
+	89, 168, 19, -112, -52, -13, 43, 74, 
+	48, -18, -54, -75, 132, -19, -35, 48, 
+	-84, -26, 226, -51, -33, -49, 86, 20, 
+	7, 21, -6, 138, 63, 116, -40, -13, 
+	34, -59, -86, -51, -139, 18, 2, -56, 
+	65, 75, -65, -63, 99, -163, -52, -81, 
+	-118, -21, -21, 11, -78, -150, 98, 106, 
+	-80, -46, 94, 73, 24, 36, 80, -73, 
+	-61, -25, -92, 25, -7, 90, -14, -67, 
+	34, -70, 125, 83, 68, -3, 20, -76, 
+	-101, -19, -149, 18, 102, 35, 18, 30, 
+	8, -26, 80, 16, -80, 55, -3, 86, 
+	102, 50, -343, -8, -38, -119, 72, 99, 
+	47, -78, -34, 12, -110, -122, -92, 40, 
+	-31, 17, -84, -50, 74, -117, -19, 47, 
+	-139, -25, 51, 105, 17, -173, -41, 109, 
+	-60, -111, -39, 99, 91, 35, 53, -35, 
+	22, -284, 71, 12, -43, -47, 68, 147, 
+	57, 11, 95, -74, 13, -54, 0, 84, 
+	52, 71, -8, -49, -23, -91, 18, -49, 
+	-107, -45, -100, -12, -97, -7, -48, 45, 
+	32, -53, 44, -58, 14, 48, 40, -183, 
+	-9, -33, -179, -37, -24, -70, 18, 90, 
+	-55, -48, 23, -39, 45, -73, 39, 133, 
+	-68, 129, -132, 118, 99, 13, 43, -38, 
+	-3, 156, -79, -56, 104, 1, 78, 138, 
+	-66, 33, 99, -62, 44, -35, -53, 81, 
+	-47, -292, -30, 92, -37, 13, -34, 95, 
+	-46, -44, -85, 26, -29, 54, -12, -12, 
+	-62, -60, 5, 1, 89, 50, -19, -20, 
+	86, -76, -1, -68, -60, 46, -73, 17, 
+	16, 75, 38, 109, -131, 102, 38, -66, 
+	-17, 11, -75, -54, -239, 22, -31, 90, 
+	-66, 89, -9, -58, 82, -150, 26, -102, 
+	134, -20, 2, 116, -95, 73, 85, -33, 
+	123, 30, -56, 110, -8, -9, -34, -35, 
+	51, 136, 143, -54, 34, 56, 131, 90, 
+	-15, -87, 101, -45, -11, 33, -69, 11, 
+	25, -80, 95, 118, 19, 69, 45, -3, 
+	-53, 86, 25, -21, -107, 95, 145, -89, 
+	-51, 125, 110, 21, -98, 29, -61, 51, 
+	47, 23, -63, -71, -54, -72, -92, 27, 
+	125, -44, -31, -72, -94, -4, -14, -191, 
+	-79, 92, -9, 3, -114, 102, 22, 12, 
+	24, 165, 183, -72, 150, -43, 110, 19, 
+	-23, 39, 152, -4, 63, 33, 60, -129, 
+	148, -64, -79, 97, -21, 44, 71, -116, 
+	4, 50, -39, 71, 74, -138, 127, -153, 
+	93, 39, -50, -57, -262, -24, -66, 81, 
+	-31, 60, -100, -19, -71, -53, -91, -21, 
+	21, -96, 139, -32, -74, 60, -26, 39, 
+	28, 129, 43, -64, -57, -103, 42, 105, 
+	24, -88, -32, -121, -12, 61, 107, 149, 
+	-10, 198, -2, -9, 2, -142, -60, 13, 
+	29, 11, 46, -210, -44, 15, -81, 54, 
+	-57, -86, -1, -59, -28, 195, -6, 61, 
+	-72, 13, -55, -4, 62, -14, -6, 84, 
+	-58, -61, 154, 59, -119, 69, -31, -47, 
+	-145, -64, -79, -11, 38, 100, 58, 4, 
+	-167, -154, -27, -2, -8, -11, 62, 62, 
+	141, 0, 26, -97, 77, -134, -170, -91, 
+	-56, 125, -78, -180, -82, 70, -45, 179, 
+	127, -32, -82, -107, 37, 96, -58, 117, 
+	-112, -54, 27, -152, 38, 131, -66, 11, 
+	70, 158, 6, -125, 8, 56, 7, -117, 
+	-66, 83, 167, 116, 33, 26, 22, 18, 
+	-42, 88, -76, -30, 37, -28, 14, -64, 
+	-50, 92, -11, -104, 79, 2, 19, 33, 
+	83, -81, 193, 81, -5, 54, -180, 3, 
+	109, 82, 66, 55, 45, 35, -121, 15, 
+	-40, 135, -45, 60, -28, -18, 188, -21, 
+	84, -86, -96, -152, 56, -26, 27, 16, 
+	146, -4, 116, -102, 128, 62, -44, -75, 
+	22, -4, -7, -34, -32, -38, -163, 53, 
+	117, 112, 115, 103, -184, -28, -88, -175, 
+	60, 66, -57, 44, 56, 201, -37, -117, 
+	35, -12, -5, 111, -25, -22, 42, 4, 
+	-142, -81, 164, 93, 8, 99, 51, 0, 
+	54, -84, 72, -14, -63, -11, -24, 5, 
+	71, 115, -125, -135, -2, -73, -68, 2, 
+	-28, 7, 11, -62, -124, 2, 83, -63, 
+	114, 80, -111, -28, -19, -67, -10, -67, 
+	41, -42, 44, 26, 32, -19, 26, 85, 
+	3, 54, 1, 77, 131, -95, -60, -52, 
+	-54, -82, 90, -8, 84, 6, 59, -92, 
+	54, -16, 116, -12, -62, 107, -71, 120, 
+	-85, -174, -23, -81, 51, -8, 44, -59, 
+	48, 13, 14, -225, 61, 149, 46, -38, 
+	-5, 1, 51, -95, -214, 31, -32, -57, 
+	0, 91, 23, -54, -1, -140, 36, 19, 
+	-129, 131, -108, 53, -44, -158, 74, 79, 
+	-39, -69, 2, -35, -25, 31, 4, 60, 
+	37, -84, -64, -38, 39, 15, 35, -46, 
+	32, -70, -10, -64, 48, 110, -27, 102, 
+	-145, 75, 162, -8, 16, -52, -83, 43, 
+	42, 18, 52, -61, 79, 59, 93, 54, 
+	137, -145, 165, -18, -91, -100, -26, 95, 
+	79, -82, 114, -24, -60, 16, -11, -26, 
+	75, 32, -125, 80, -52, 92, -99, 25, 
+	21, 84, -1, 3, 78, 121, -39, -19, 
+	-46, 15, 278, 25, -74, 46, 118, 103, 
+	11, 12, -21, -116, -88, -118, -23, -14, 
+	67, 75, 69, 86, 35, 55, -10, -11, 
+	-44, 41, 77, 120, 39, 65, -11, 3, 
+	20, 34, 103, -207, -18, 32, 107, 46, 
+	-47, 71, 51, -67, 7, 21, 23, 3, 
+	-15, -51, 54, -26, 121, 5, -70, -78, 
+	92, -59, -26, -22, 91, 8, -50, -13, 
+	132, 22, -14, 39, -28, -22, -29, 2, 
+	-110, 173, -50, -104, 33, -11, 58, 111, 
+	31, 20, -105, 40, -14, 61, -180, 44, 
+	-17, -121, 25, -3, 4, -33, 3, -46, 
+	120, -130, 31, -249, -51, -49, 110, -61, 
+	-51, -140, 20, 34, 28, -49, 86, -146, 
+	-96, 13, 173, -28, 64, -74, 14, 154, 
+	3, -41, 142, -45, 37, 43, -86, 122, 
+	-105, -20, -151, -15, 55, -43, 18, 137, 
+	13, 87, 20, 132, -102, -154, -108, 168, 
+	-86, 199, -16, 23, -42, 49, -49, 176, 
+	25, -131, 20, -79, 11, 5, 64, 32, 
+	66, -192, -149, -41, 178, -106, -1, 27, 
+	26, -135, 108, 17, 41, 36, 92, 102, 
+	62, 129, -113, 130, 28, -11, 68, 67, 
+	86, -146, 13, 70, 14, 156, -25, 48, 
+	87, 44, 10, 12, -13, 92, -116, -81, 
+	-1, -3, 93, -114, -34, -2, -32, 54, 
+	32, -17, -57, 175, 13, -55, -65, 44, 
+	-57, -46, -1, -71, -20, 36, -28, -67, 
+	109, -4, 71, 124, -92, -41, -52, -27, 
+	-46, 70, 6, -77, 120, 16, 17, 32, 
+	93, 18, 94, 30, -34, 23, -118, -89, 
+	108, 198, -32, -75, 66, -26, -8, 49, 
+	-111, -72, 121, -28, 26, -10, 78, 9, 
+	-18, 17, 90, -29, 12, 6, 18, -112, 
+	-9, 21, -20, -13, 82, 11, 128, 37, 
+	140, 20, -134, 25, 31, -154, -38, -34, 
+	148, -98, 57, -91, 93, 48, -60, 68, 
+	29, 121, -96, 10, -69, 108, 139, -68, 
+	27, -99, 7, 73, -117, 145, 62, -78, 
+	-104, 87, -78, 178, 21, 160, 104, -176, 
+	-74, 27, -63, -75, -70, -82, 54, 20, 
+	-60, 16, -49, -48, 63, -47, 64, -5, 
+	61, 89, -78, 67, 156, -153, -29, -51, 
+	58, 40, 75, 222, -4, 5, 61, 77, 
+	-92, 36, -14, -16, -31, -77, 43, 46, 
+	86, 112, 7, 79, 15, -40, 112, 10, 
+	-135, -111, -40, -98, -34, -71, -5, 77, 
+	-50, -57, -47, 38, -104, -114, -1, 24, 
+	24, -75, -44, -17, -47, 107, -104, -111, 
+	-14, 7, 104, 52, -12, 63, -13, -94, 
+	44, -8, 34, -57, -69, -50, -38, 80, 
+	56, 46, -8, -126, 2, -22, -4, -97, 
+	-31, -1, -45, -89, -42, -79, 19, 60, 
+	-60, -61, 54, -90, 42, 59, -9, 13, 
+	-92, -118, -49, -65, -88, 2, -50, 54, 
+	-87, -9, 82, -42, 1, 34, -28, 4, 
+	0, 40, -57, 46, 42, 73, -89, 43, 
+	50, -86, -39, 70, 48, 89, -106, -54, 
+	-100, -113, 59, 14, 45, -112, 79, -30, 
+	49, 100, -48, -47, 52, 95, -84, -106, 
+	-15, 47, 76, -65, 54, 59, -52, -74, 
+	-18, 20, -39, -110, 37, 52, 46, -43, 
+	-88, -57, 73, -64, 11, 47, 76, -94, 
+	-57, 36, -81, -17, 19, -68, -118, -45, 
+	-106, -50, -38, -18, 71, -48, 25, 57, 
+	-77, -118, -55, -7, 13, -78, -76, 41, 
+	66, -100, -87, 49, 8, -58, -75, -54, 
+	0, 56, 29, -24, -86, 11, 18, -103, 
+	-88, 97, -27, -17, 66, 13, -71, -83, 
+	88, 20, 30, 62, -70, -68, 60, 18, 
+	-20, -71, 49, 82, 61, -24, 31, -23, 
+	-19, -34, -24, 72, -40, -53, -65, 32, 
+	-18, -17, 7, 64, 12, -109, 49, 31, 
+	38, -18, 52, 12, -17, -31, 14, -81, 
+	71, -80, -8, 46, -36, -29, -36, 16, 
+	-10, -76, -38, -27, -22, -18, -27, -72, 
+	-29, 19, 52, 22, -19, 20, 56, -16, 
+	12, -56, 52, -10, -79, 94, 93, -99, 
+	-57, -16, 40, 2, -5, 15, 1, 45, 
+	89, 36, -24, 48, 31, 30, 8, -95, 
+	3, -13, 67, 59, -131, 17, -117, 30, 
+	16, -72, -46, 5, 41, -78, -25, -44, 
+	8, -67, -9, -69, -45, -69, 61, -93, 
+	-63, -7, 51, -41, 9, 0, -55, -112, 
+	-79, 63, -49, 29, 34, -42, 4, -22, 
+	45, -70, -30, -4, -29, -41, 50, 30, 
+	-42, -17, 18, -48, -125, 27, -88, 80, 
+	-98, -113, -49, -110, 14, -92, 59, 14, 
+	30, 68, -124, 14, 64, 19, -27, -15, 
+	-97, -111, -55, -3, -85, -50, -28, -73, 
+	-89, -45, 13, -53, -39, 59, 44, -109, 
+	-128, 90, -31, 14, -75, -78, -21, 72, 
+	106, -23, -63, -54, -66, -59, 45, 13, 
+	-27, 31, -54, 42, -70, 47, -100, -82, 
+	47, 23, 87, -24, 19, -60, 3, 43, 
+	-81, -88, 32, 44, -45, -10, 31, 13, 
+	-111, -63, -104, -72, -12, 40, -1, -27, 
+	-107, 8, -9, -4, -53, -32, -70, -74, 
+	-15, 8, -16, -116, -105, -17, 32, -100, 
+	-66, 28, 42, -4, -60, -55, -39, -97, 
+	-45, 45, 31, 28, -94, -106, -40, 1, 
+	51, -82, -35, -19, -69, 55, -4, 10, 
+	-67, -123, -17, -26, 35, 33, 41, -69, 
+	-16, 39, 51, -52, -64, 59, 52, 25, 
+	14, -90, -89, -70, -61, 86, -79, -89, 
+	-35, 69, -42, -89, -125, -92, 11, 28, 
+	-12, 37, 10, -61, -5, 24, -59, -20, 
+	18, -70, 33, -70, -62, 69, -56, -36, 
+	3, 11, -55, -14, 66, -10, -109, -90, 
+	27, -29, -20, -117, 32, -65, -113, 88, 
+	-34, 101, -45, -61, 64, -87, -29, 13, 
+	-108, -50, -75, -10, -42, -4, -69, -75, 
+	47, -12, 94, -61, 113, -45, -117, -10, 
+	-113, 17, -69, -70, 67, -59, -36, -11, 
+	8, -10, -127, -81, -28, 71, 42, 54, 
+	41, -107, -115, -15, -41, -71, -107, 0, 
+	-49, -4, -99, -94, 88, -53, -51, -65, 
+	64, -73, 61, -43, 13, 31, -25, 63, 
+	53, -85, -74, 4, 31, 46, -31, -14, 
+	73, -26, -80, -26, -64, 3, 35, -110, 
+	-74, -34, 48, -105, 49, -58, 43, -43, 
+	-46, 24, 26, 9, -27, -61, -72, -114, 
+	-22, -34, -27, 69, 33, 48, -86, -70, 
+	33, -67, -33, 35, -90, -63, -23, 33, 
+	-23, -11, -90, 5, 25, -88, 24, -87, 
+	13, -118, -3, 20, 59, -80, -2, 9, 
+	-81, 21, 18, 7, 58, 50, 31, 21, 
+	33, 25, 76, 62, -24, -26, -103, 78, 
+	29, -97, -29, 43, -12, 28, -125, -79, 
+	39, -8, 63, 62, 73, -27, -51, -121, 
+	-66, 48, -67, 0, -1, -90, 88, -26, 
+	29, -22, -93, -24, -15, 32, 38, -36, 
+	-82, 32, 28, -62, 49, -16, -134, -92, 
+	-86, 52, -80, 41, -57, -115, -59, -19, 
+	-42, 60, -22, -108, 28, 35, -43, -55, 
+	-92, 19, -43, -34, -86, -88, -75, -105, 
+	28, -77, 33, -41, 38, 63, -18, -17, 
+	58, -50, 21, -55, 43, -115, 51, -14, 
+	-39, -56, 31, 21, -95, -76, 84, 66, 
+	41, 36, -107, 68, 64, -50, -54, -99, 
+	55, 9, -95, -104, -30, 47, 74, -85, 
+	-29, 16, -102, 4, -2, -82, -83, 3, 
+	-59, -58, 16, -36, 23, 83, -56, -40, 
+	25, -72, 61, -34, 30, -62, -65, -30, 
+	-26, -28, 82, -78, -104, 66, -15, 42, 
+	39, -13, -68, 69, 1, -92, -109, -41, 
+	24, -35, -19, 17, -43, -25, 44, -34, 
+	44, -27, 69, -81, 88, -3, -31, -65, 
+	-80, -33, -17, 30, -22, 59, -30, -108, 
+	74, 14, -103, -45, 54, -45, -15, -22, 
+	-49, -105, -74, -54, -10, 70, 14, -13, 
+	35, -71, -50, -81, 65, -28, -105, -83, 
+	-76, -95, -64, 3, 55, -17, -79, -79, 
+	67, 66, -30, 14, -50, 24, -43, -38, 
+	-94, 31, -12, -37, -27, -45, 14, 52, 
+	30, 6, -56, -10, -103, 79, -39, -92, 
+	-73, -49, 16, -25, -2, 4, -51, -64, 
+	-107, 55, -90, -52, -78, -1, -27, 94, 
+	7, -92, 55, 3, -17, -62, -5, -93, 
+	-105, -105, 50, -59, -16, -33, 62, 8, 
+	16, -80, 10, -89, -106, 0, 13, 70, 
+	-70, -91, -6, 32, 75, -82, -16, -10, 
+	56, 86, -15, 34, -93, -108, 53, 30, 
+	-105, -59, 20, 11, 75, -12, 0, -1, 
+	47, 7, -9, -78, -37, 64, -11, -99, 
+	8, -63, -51, -74, -28, 17, -38, -54, 
+	-46, 67, 5, -87, -70, 64, -54, 22, 
+	7, 30, -54, -36, -74, 32, -32, 23, 
+	81, 56, -20, 16, -53, -79, -42, -7, 
+	-125, -63, -88, -22, -14, -57, -50, -37, 
+	-47, -93, -113, -97, 29, -10, -79, 41, 
+	-12, -5, -42, -33, -82, -25, 51, 33, 
+	-25, 57, 33, 3, -84, -90, 69, -54, 
+	52, -85, 62, 79, -42, -37, -88, -12, 
+	12, -81, 39, -107, 23, -5, -55, -83, 
+	-89, -21, 72, 72, -87, 12, -104, -14, 
+	-46, 33, -59, -16, -76, 7, -25, 62, 
+	-47, -86, 49, 20, 13, -77, -5, 66, 
+	-46, -2, 16, 17, -22, 23, -32, -45, 
+	-48, -98, 1, -5, -9, 54, -107, -61, 
+	65, 53, -93, 21, 18, -75, -39, -71, 
+	-79, -10, -54, -23, -13, -119, -10, -69, 
+	58, -21, -35, -80, -56, -60, 7, -48, 
+	62, 88, 44, -94, -58, -74, -33, -84, 
+	44, -81, -76, 0, -72, -120, -46, 45, 
+	-7, -50, 4, 8, 34, -5, 11, -16, 
+	-36, 21, -45, 7, -104, -29, -9, 45, 
+	14, 18, -59, -75, -22, 20, -115, -111, 
+	36, 35, 82, -53, -5, 47, 18, -103, 
+	-45, -70, 68, 38, 73, -84, -66, -101, 
+	-27, -8, -32, -107, -45, 25, -68, -21, 
+	2, 46, -31, -109, 45, 55, -129, -52, 
+	48, -192, -46, -77, -11, -10, 50, -97, 
+	-3, 44, -16, 6, -93, 83, -28, 57, 
+	8, -30, -47, 18, -42, 84, 61, -127, 
+	-125, -134, -69, 38, 11, 13, -10, -176, 
+	130, -190, -61, -89, -39, -53, 76, -54, 
+	-196, 206, -131, -161, -96, -33, -236, 34, 
+	141, -92, -5, -16, 7, -36, -57, -108, 
+	-41, 59, -80, -16, 21, -48, -29, -29, 
+	37, -54, 112, 19, 45, -5, -97, -95, 
+	78, -78, -101, 123, -78, 70, -45, -64, 
+	-130, 85, -90, -2, 50, 63, 141, 29, 
+	9, 17, -46, -18, 26, 131, -110, 48, 
+	108, -53, 123, 56, 65, 123, 0, 29, 
+	109, 39, -49, 8, -16, 56, -10, 102, 
+	-27, -109, -106, -11, -43, 45, 70, -97, 
+	53, 78, 0, 2, -65, 37, -23, -84, 
+	-75, 86, 109, 30, 61, 58, -22, 85, 
+	-61, 57, -122, -13, 19, -145, 65, 55, 
+	-68, 47, -34, 101, 12, 42, -58, 152, 
+	-63, 71, 54, 170, 84, 28, -80, -39, 
+	81, 115, -32, 118, 296, 41, -103, -62, 
+	9, 79, 91, 92, -26, 115, 66, 165, 
+	48, 19, -85, -106, -31, 64, -19, -60, 
+	100, -47, -52, -6, -52, -73, -79, -114, 
+	31, -6, -69, 12, -9, -24, -97, 20, 
+	-184, 9, 34, -31, -58, 51, -34, 9, 
+	96, -36, 22, -151, 55, -13, -45, -40, 
+	33, -48, 12, -39, 41, 40, 20, 61, 
+	66, -94, -14, -204, 76, -63, -66, 4, 
+	-31, -63, -234, 82, -22, -65, 61, 1, 
+	-74, -41, -46, -20, -42, -131, 18, 115, 
+	103, -47, -81, 23, 80, 8, -43, -107, 
+	51, 149, 128, -44, 46, -16, -28, 75, 
+	-54, 93, 133, 94, -93, 56, -21, -175, 
+	-3, -99, -78, 54, -48, 64, 59, -171, 
+	-1, -20, 90, -19, -108, 34, -61, 22, 
+	-106, -193, 117, 41, 28, 0, -84, 18, 
+	38, -34, 52, -96, 47, 29, 7, -72, 
+	82, -112, -89, 64, -43, -36, 31, -30, 
+	88, 88, 58, -71, 67, 30, 122, 107, 
+	47, 13, 102, 30, -61, 23, 35, 90, 
+	-144, -119, -45, -60, 112, 14, -11, -168, 
+	37, 17, -31, -92, 11, -14, -33, -194, 
+	-42, 83, 5, 57, -87, -65, 28, -102, 
+	13, 187, 191, 56, 37, 64, 22, 81, 
+	-13, 21, -165, 83, 40, 46, -53, -124, 
+	-7, -54, -58, -104, 125, 60, -53, 152, 
+	57, 20, -208, 60, -78, -120, 93, -35, 
+	-4, -67, 38, 21, 87, 73, -50, -20, 
+	17, 149, -139, -43, 44, -126, -21, 38, 
+	-58, 44, 55, 58, 15, -18, 18, -12, 
+	-115, -58, -12, 86, -64, 39, 38, 23, 
+	-11, -30, -124, 12, 122, 86, 55, -36, 
+	16, 68, 32, 88, -103, 89, -21, 66, 
+	-77, 57, -52, -48, 7, 102, -9, 21, 
+	-79, 0, 64, -10, 23, 67, 57, 7, 
+	58, 81, 17, -61, 73, -23, -91, -3, 
+	80, 191, -3, -18, -6, -26, -38, 119, 
+	-23, -16, 4, -9, 137, 37, -49, -55, 
+	2, -61, 17, 43, 46, 33, 149, 65, 
+	-71, -88, -19, 54, -98, -12, -19, -112, 
+	121, -192, 3, 39, 70, 55, -32, 4, 
+	-39, 24, 21, 28, -9, -3, -62, -30, 
+	-18, -165, -92, 25, 56, 64, -10, -55, 
+	76, -21, -29, 111, 104, 111, -103, 13, 
+	37, -15, -20, -82, -55, -104, -145, 121, 
+	-7, -46, 27, -64, -64, -30, 96, -48, 
+	-20, 162, -23, -33, 41, -147, -74, -54, 
+	50, 53, -22, 4, -42, 33, 82, 47, 
+	48, -46, -74, -127, 85, 75, 42, 37, 
+	25, 108, 92, 125, 85, -52, 46, 8, 
+	-86, -98, 118, 56, 44, 96, -35, 10, 
+	36, -47, 88, 40, 63, 55, -2, 25, 
+	-36, -19, 12, -77, 76, 49, 77, -23, 
+	81, -25, 122, 38, 35, 138, 39, -87, 
+	60, 114, 90, -18, 86, 56, 88, -4, 
+	-78, 60, -43, 111, 77, -48, -54, -69, 
+	-67, 148, 61, 106, 61, -24, 132, 19, 
+	-109, -57, 35, -63, -13, -35, 3, 179, 
+	64, 4, 31, 87, 72, 90, -9, 83, 
+	120, 14, 73, 7, 66, -34, -27, 25, 
+	-82, 115, 18, -61, -59, -80, 67, 3, 
+	26, -4, 106, -139, -24, 38, -171, -70, 
+	0, 86, 93, 74, 59, -23, 6, -32, 
+	29, -43, -39, 95, -257, -67, -150, -118, 
+	-18, -51, -52, 65, -178, -68, -1, 105, 
+	-14, 4, 87, 33, -7, -60, 85, 116, 
+	3, -97, -74, 71, -59, -91, -33, 118, 
+	89, -54, -57, -115, 78, -18, 114, -25, 
+	146, 88, -111, -40, 42, 11, -5, 65, 
+	55, 12, 93, 87, -98, 110, -10, -51, 
+	-32, -118, 52, -55, 127, 82, -5, 51, 
+	139, -220, 133, -18, -185, -7, -10, 53, 
+	0, -82, 73, -14, 63, 8, 50, -49, 
+	-16, -29, -206, 119, 36, 33, 35, -40, 
+	10, 213, -25, -75, 145, 123, 153, 132, 
+	-105, -63, -79, -24, 143, 15, -99, 27, 
+	-33, 180, 134, 125, 77, -65, -48, -71, 
+	-21, 42, 8, -4, 45, 100, -65, -100, 
+	123, 99, -18, 162, -51, -81, 139, 35, 
+	-16, 66, -8, 51, -63, 6, -83, 138, 
+	-33, -45, 44, 5, 39, -16, -24, 38, 
+	89, -17, 95, 179, -61, 38, -24, 46, 
+	-104, 68, 30, 32, 16, -2, -16, 20, 
+	-83, 111, -195, 162, -10, -22, -29, -38, 
+	-134, 29, -37, -172, -71, 120, 80, -1, 
+	43, -4, 49, -92, 129, -113, -95, 155, 
+	-28, 71, -115, 1, 102, -27, -19, -100, 
+	3, 220, -32, -152, -162, 83, -40, 94, 
+	55, -23, -13, 42, -122, -8, 81, 35, 
+	-30, 41, -81, -55, -23, -38, -68, -102, 
+	-82, 116, 74, 56, -61, 35, 29, -68, 
+	-103, -98, 19, 17, -4, 86, 80, -52, 
+	-72, -133, -95, 144, -7, -69, -54, -49, 
+	-106, -36, -56, 151, -74, -86, 132, 52, 
+	113, -125, 21, -11, 18, -90, 132, 61, 
+	8, -215, -64, 39, 47, -87, 43, -18, 
+	-4, -73, -61, 19, 59, 71, 105, 104, 
+	-62, -99, -115, 133, -43, 39, 94, -1, 
+	48, -126, 65, 73, 6, 3, -24, -27, 
+	14, 65, -133, 94, -128, -55, 14, 62, 
+	68, 30, -49, 67, 23, 12, -89, 35, 
+	-97, 126, -10, 5, 26, 75, -72, -74, 
+	-112, 87, -43, -18, -47, -6, -103, 2, 
+	-57, 107, 85, -142, 1, -73, -74, 24, 
+	38, -126, -9, 68, 7, 202, 53, 24, 
+	14, 59, -79, -3, -47, 106, -104, -80, 
+	-13, -28, -18, 41, -32, -102, 64, 6, 
+	52, -61, 96, 52, 167, 68, 69, -87, 
+	42, -43, 96, 81, 88, 88, 93, -73, 
+	106, -68, -26, -45, 26, 51, 61, -65, 
+	-42, 119, 60, -36, 64, 79, -203, -20, 
+	159, 95, 22, -233, 65, 1, -134, 83, 
+	-32, 76, -84, 17, 1, 73, -51, 59, 
+	110, 53, 75, -70, 111, -147, -99, -69, 
+	-26, 122, -123, 12, -27, -97, -60, -116, 
+	-62, -94, 41, -84, 45, 49, 162, 65, 
+	53, -157, 90, 44, -7, 18, -13, 146, 
+	140, -68, 59, 57, -189, -159, -76, 106, 
+	38, -90, 80, -22, 48, -66, 118, 50, 
+	-13, -94, -80, -60, -82, 2, 152, 21, 
+	-69, 183, -7, 49, -208, 52, -23, 82, 
+	140, -114, 74, 66, -115, -66, -21, -76, 
+	81, 172, 20, -147, 73, 0, 42, 100, 
+	-46, 149, 82, 7, 55, -69, -88, 54, 
+	-86, -11, 25, 119, 92, 85, -17, -79, 
+	128, -39, 120, 150, -78, 87, 109, 4, 
+	-3, -86, -30, 70, 36, -17, 128, -15, 
+	107, 38, -19, 22, -147, 109, 87, 24, 
+	12, 76, -138, 151, 21, 1, 17, 124, 
+	47, -41, 83, 183, -29, 71, 100, -30, 
+	31, 39, -31, -31, -86, -73, -79, -126, 
+	141, 137, 166, 75, -3, -19, -16, -61, 
+	-169, 61, 177, -120, 65, 10, -51, -59, 
+	73, 12, 7, 118, -17, 126, 119, 67, 
+	112, -48, -25, 92, 34, 37, -5, -173, 
+	86, 211, 23, -39, -37, 50, -64, 23, 
+	19, 269, -38, -79, -80, 54, 37, -38, 
+	-52, -191, 116, 8, 68, 22, -11, -103, 
+	-143, 17, 13, 63, -20, 52, 28, 74, 
+	-117, -55, 139, -58, 43, 147, 92, -67, 
+	162, -84, -30, -114, -5, 13, -82, 159, 
+	-213, -11, -14, -63, -69, 12, 161, 82, 
+	55, 14, -140, 15, 16, 97, 109, -137, 
+	23, 14, -74, -124, 277, 10, 38, -122, 
+	105, 6, 19, -152, -66, -115, -53, 12, 
+	73, -106, 265, -33, -108, -42, 55, -125, 
+	-91, 26, -96, -51, 26, -13, -95, 12, 
+	-11, 73, -15, -96, -1, 14, -39, -107, 
+	36, -10, 28, 58, -18, -87, -105, -72, 
+	81, 87, 15, -70, -105, 40, 67, -98, 
+	-38, 76, 112, -46, 13, 10, 42, -96, 
+	48, -28, -58, -66, 276, -42, 32, -88, 
+	83, -141, -15, 42, 45, 49, -172, -5, 
+	-145, -49, -22, -187, 132, 18, 81, 69, 
+	-40, -54, 27, -111, -15, -18, -50, -61, 
+	57, 160, -10, -18, -105, 147, -38, -81, 
+	135, 199, -19, -103, 2, -21, 66, 29, 
+	-75, 76, 80, -4, 60, -2, -50, -14, 
+	-146, 9, 46, -71, 64, -75, 145, 162, 
+	-56, 50, 76, -102, 142, 3, 38, -62, 
+	48, -55, 27, 141, 27, 9, 38, 13, 
+	-85, 78, 152, 27, 94, 96, -46, 33, 
+	14, -127, -3, 16, 63, 99, 2, -47, 
+	5, -56, -126, -15, 141, -55, 124, -39, 
+	-161, 136, -50, -39, -117, -145, 33, -118, 
+	153, 103, 32, 96, 46, -97, -12, -127, 
+	-13, -47, 187, -56, -48, -44, -8, 43, 
+	-52, -101, 48, 89, 161, -44, 48, 59, 
+	67, -71, 0, 15, 8, 22, 36, -112, 
+	62, 285, -33, 3, 117, 12, 42, 144, 
+	27, -6, -7, 105, 53, -21, 173, 108, 
+	60, -41, 100, 108, 65, 66, -70, 15, 
+	27, -118, 13, -138, -41, 102, 114, -9, 
+	5, 72, 43, -3, -90, 12, 25, -112, 
+	25, 57, -142, 46, -40, -118, -133, -91, 
+	87, -40, 55, 83, -226, 49, -45, -49, 
+	28, 45, 53, -100, -73, -141, 71, 34, 
+	-2, -56, -72, 38, -15, -10, 27, 115, 
+	68, 44, -91, -35, 40, -8, -15, 26, 
+	97, -55, 144, -62, -94, 85, -67, -80, 
+	-89, -19, 122, -148, 80, 28, 94, -85, 
+	-24, 9, -117, -38, 86, 136, 72, -64, 
+	-25, 60, -58, -50, -53, -21, -129, -77, 
+	-62, -31, 15, 57, -10, -71, 77, 36, 
+	118, 27, 136, -25, 149, -105, 40, 27, 
+	-50, 75, 124, -14, 82, 26, 75, -47, 
+	-41, 132, 72, -23, -5, 83, -59, -81, 
+	-8, -108, 111, -157, -80, 73, -114, 105, 
+	-46, -53, -70, 45, 133, 36, -31, -62, 
+	-97, -41, -94, 121, -35, 53, 56, -88, 
+	-51, -31, -72, 158, 88, -122, -72, -53, 
+	-88, -58, 162, 75, 38, 35, -105, 70, 
+	-8, 15, 33, -48, -59, -23, -76, -41, 
+	-57, -149, -75, 126, -30, 66, -9, -125, 
+	-100, 72, -27, -7, 103, 37, -8, -227, 
+	-47, -106, -28, -32, -48, 81, 18, 67, 
+	-21, 26, 103, -35, -38, 3, 15, -53, 
+	-33, -15, -31, -30, -48, -79, -2, -110, 
+	-89, -1, 3, -80, -71, 91, -31, 18, 
+	-129, -104, 72, -81, -1, -37, 2, -11, 
+	-86, -78, -45, -67, -86, -65, 0, -45, 
+	17, -119, -56, 21, 49, -29, 8, -92, 
+	51, 66, 36, -70, 56, -73, -87, 86, 
+	55, -126, 37, -68, -94, -38, 23, 43, 
+	-31, -65, -2, -107, 100, 60, -72, 10, 
+	-57, -40, -60, -132, -27, -59, 58, -28, 
+	-95, -64, -1, -1, -47, 101, -100, 22, 
+	-106, 55, 19, -32, 29, -13, -125, 31, 
+	-64, 98, 35, -68, -96, 42, -7, -6, 
+	61, -73, 68, -81, 34, -96, 14, 16, 
+	-77, 20, -22, -11, 25, 20, 66, -71, 
+	21, -134, -71, -26, -42, 14, -111, 10, 
+	-86, -46, 3, -150, 67, -38, 42, 80, 
+	-37, -26, -13, 109, -142, -25, 37, -64, 
+	-54, -62, 9, -126, 164, -116, -81, -51, 
+	86, 17, -102, 39, -21, -3, -95, 7, 
+	-5, 38, 17, 10, -116, -35, 35, -43, 
+	-43, -72, 6, -45, -1, -89, 43, -46, 
+	-117, -117, -109, 10, -79, -86, 5, -28, 
+	16, 84, 52, -88, 60, 57, -76, -150, 
+	-89, -56, -88, -25, -2, 1, 33, 30, 
+	22, -91, 27, 57, -50, -64, 39, 21, 
+	-16, 3, -8, -17, -84, -139, 10, 10, 
+	-5, -48, -77, -113, 41, 6, -99, 10, 
+	0, 21, -95, 60, 108, -49, 36, -54, 
+	-1, -37, -92, -53, 52, -145, 15, -73, 
+	60, -48, 85, -115, -113, 3, -58, -143, 
+	-26, 85, -31, -29, -4, -33, -23, 13, 
+	-104, 35, 66, 31, -151, -125, 10, 53, 
+	5, -27, -83, -10, 1, 36, -14, -44, 
+	43, 14, -131, -24, -14, -138, 51, 60, 
+	-94, 86, 1, -171, 31, -58, -107, 36, 
+	-75, -71, 7, 24, -34, 67, -87, -41, 
+	-72, 86, -24, -83, 64, -70, -78, -50, 
+	-44, 17, -26, -11, 73, -53, 26, 5, 
+	-91, 91, -76, -24, -140, -107, -118, -19, 
+	-123, 63, -8, 9, -137, -94, 43, -21, 
+	-132, 117, -131, 109, -42, -113, -67, -111, 
+	-9, -150, 1, -55, -77, 24, -91, -71, 
+	-81, -22, 39, -38, -20, -63, 57, -141, 
+	-86, 70, 26, 42, -79, 40, 7, -65, 
+	-61, -141, 79, 24, -79, -18, -20, -38, 
+	-130, 34, 11, -93, -128, -7, -53, -84, 
+	-79, 63, 98, -54, 85, 47, -71, -94, 
+	22, -31, 107, -58, -161, 70, -54, -26, 
+	17, -83, -208, -110, -43, -86, -43, -122, 
+	40, 73, 79, -117, 2, 55, -73, -86, 
+	-28, -18, -72, 17, 6, -38, -37, -18, 
+	15, -111, 86, -102, -56, -7, 97, -60, 
+	-86, 67, -58, -111, 122, 61, -3, -68, 
+	-43, 31, -89, -59, -37, -92, 52, 2, 
+	-101, 12, -103, 76, -94, -49, -41, 16, 
+	12, -93, 52, 8, -141, 83, 28, 31, 
+	-16, -161, -139, -46, 18, -95, -141, -47, 
+	30, -18, -4, 74, -33, 10, -3, -47, 
+	17, 4, 0, -78, 151, -31, 60, -53, 
+	55, -17, 26, -30, 81, -12, -14, -17, 
+	-21, 109, -89, 9, -129, 81, -73, -100, 
+	-45, 8, 60, -18, -30, 42, -120, -106, 
+	-78, 61, -105, 10, -54, 5, 78, 18, 
+	-117, 45, -57, -114, 36, -54, -94, 17, 
+	10, -75, 14, 4, -9, -105, -28, -30, 
+	-63, -12, 97, 119, 58, -36, 56, -109, 
+	-68, -69, -93, -70, 80, 104, 7, 65, 
+	59, -134, -55, 11, 12, -21, -8, -37, 
+	44, -68, -43, 89, -15, 63, -132, -74, 
+	-100, 20, 31, 32, 22, 4, -118, 38, 
+	-50, -57, 60, 17, 29, 28, -65, -62, 
+	-6, 79, -101, -50, 97, -98, -48, -15, 
+	-32, -38, -106, -18, -33, -119, 33, -129, 
+	-17, -55, -37, 50, 9, 51, -98, 83, 
+	-88, 113, -24, -90, 58, 93, -37, -22, 
+	55, -80, 11, 6, -87, -44, -34, -110, 
+	-60, -66, 111, -76, 43, 98, 30, 21, 
+	-78, -78, -5, 5, 45, -76, -8, -88, 
+	-68, 1, -14, 57, 31, -101, -15, 95, 
+	56, -107, 181, 82, -21, -107, 62, 98, 
+	129, -92, 162, -113, 136, -20, 24, 84, 
+	-53, 17, 111, 90, 23, -7, 94, -106, 
+	-6, 73, 63, 34, -13, 51, 59, 108, 
+	-18, -67, -93, 66, -26, 94, 110, -45, 
+	-61, 89, -85, 58, -16, 18, -5, 86, 
+	-48, -17, 55, 81, -93, 75, -54, 24, 
+	82, 31, 3, -41, 54, -117, 14, 46, 
+	-87, -49, 156, 40, 0, 136, -53, -215, 
+	15, -60, 32, -52, 3, -45, -62, -76, 
+	44, 12, -79, -201, -8, -176, -90, -61, 
+	-8, -27, 83, 49, -256, -38, 76, 62, 
+	-53, -27, -165, -149, -170, 33, -46, -60, 
+	16, -31, 395, 49, -6, 25, -26, 99, 
+	9, 34, -20, 99, 25, -82, 62, 134, 
+	-40, 14, -63, 46, -11, -14, -11, -144, 
+	72, 49, -6, -66, -69, -6, -6, -33, 
+	49, -52, -187, 167, 60, 51, 85, 12, 
+	-4, -36, -53, 51, -16, -70, -9, 77, 
+	-32, -69, -41, 157, 4, 87, 68, -96, 
+	73, -38, -22, 25, 34, -41, -35, 51, 
+	33, -133, 48, 68, 95, 26, -18, -74, 
+	102, 45, -19, -97, -7, -12, 40, 49, 
+	89, 49, -76, 37, -73, -4, 31, -117, 
+	64, -98, -64, -6, 5, 108, 87, 24, 
+	77, -9, -59, -77, -56, 31, 46, -26, 
+	17, 43, 62, -3, -62, -42, 122, -41, 
+	-28, 136, 0, 22, 126, 4, -90, 16, 
+	138, 20, 115, -33, -29, -10, -38, -47, 
+	92, 40, -77, -57, 67, -111, 65, -31, 
+	14, -53, -80, 2, 6, -41, -56, -76, 
+	-31, 31, -19, 16, 104, -54, -16, 22, 
+	43, 144, -59, -107, -27, -56, -180, 132, 
+	36, -87, -28, 81, -100, 11, 104, -9, 
+	29, -236, -100, -80, 100, -126, -43, 50, 
+	-42, -199, -23, -117, 60, 65, 16, -129, 
+	-36, -94, 56, -171, 66, 16, -76, -27, 
+	-20, -91, 148, 95, -131, 19, 33, -113, 
+	-3, -158, 69, 42, 86, 79, -16, -101, 
+	52, 97, -99, -57, 2, 1, 58, -57, 
+	85, -70, -124, 70, 80, 48, 24, -15, 
+	-182, 127, 61, 50, -32, -55, -86, 1, 
+	90, 107, -40, -13, -8, -85, -95, -14, 
+	-105, -30, 61, -26, 122, -65, 60, 60, 
+	69, -82, 63, 86, -60, 115, -23, 75, 
+	-71, 39, 49, 32, 107, -86, 67, -71, 
+	102, 105, -129, 42, 34, 17, 21, 25, 
+	-66, 13, -8, -4, -41, -33, 1, -26, 
+	71, -111, -69, 31, 3, -23, 30, 152, 
+	18, 32, -34, -62, -122, 40, 77, 121, 
+	-37, 70, -34, -63, 50, -52, -44, 12, 
+	6, -31, -39, -43, -34, 8, -62, 79, 
+	0, 101, 184, -43, 43, 15, 29, 3, 
+	74, 65, 85, 8, -49, 57, 25, 25, 
+	98, 7, 50, -108, 123, -118, 14, -96, 
+	-1, 209, -74, -131, -154, -73, -107, 50, 
+	-230, 116, -19, -4, 54, 67, 175, -114, 
+	25, 212, 60, -74, 147, 106, 85, -156, 
+	109, -143, 44, 177, -16, 19, 61, 28, 
+	-210, 158, -107, -131, 45, -98, -127, 30, 
+	-66, 97, -2, 122, 43, 117, 48, 30, 
+	-39, -113, -93, -63, -64, -57, -11, -108, 
+	29, 61, -78, 17, 63, -10, -90, -45, 
+	-26, -67, 87, 9, -103, -46, -27, -48, 
+	-47, 71, -116, -30, 82, 38, -15, 68, 
+	-42, -1, 43, -136, 12, -64, 101, 24, 
+	-14, 21, 41, -34, -65, -27, -114, -104, 
+	-31, -86, -52, -69, 76, 77, -65, -9, 
+	38, 118, -21, 56, 27, 65, -79, -81, 
+	50, 9, -17, -28, 2, 14, 48, -79, 
+	-7, -43, 117, -12, 5, 6, -19, -5, 
+	-73, -64, 103, 55, 56, 34, -41, -44, 
+	30, 70, -132, -73, 102, -18, -115, -42, 
+	-72, 55, 59, 118, 46, -72, -8, -46, 
+	55, -72, 74, 21, -11, -73, 14, 112, 
+	-73, -156, 7, 68, 168, 15, 50, -13, 
+	52, -187, -36, -11, 92, -41, 110, 25, 
+	-2, -64, 75, 57, 0, -48, 85, 17, 
+	51, 9, 67, 6, -69, 8, 41, -43, 
+	-122, 15, 54, -23, -61, 100, -39, 2, 
+	60, 37, -50, 63, 60, -180, -41, -142, 
+	-60, 29, 25, -40, 27, 97, -41, -46, 
+	-96, 17, -22, 51, 0, -50, -8, 21, 
+	-105, 253, -240, 78, 62, 60, -116, 39, 
+	-61, 31, -36, -82, -52, -14, -8, 77, 
+	10, -76, 297, -96, 4, -209, -28, -12, 
+	-56, -40, -19, -97, -67, -53, -64, -101, 
+	99, -8, -57, 87, 34, -127, 33, 75, 
+	-204, -88, 20, -19, 23, 90, -1, 40, 
+	132, 21, -79, 74, 89, 119, -80, -44, 
+	32, -60, 56, -4, 61, 16, 29, -37, 
+	73, 2, 101, -121, -105, 127, 51, 60, 
+	-12, 100, -170, -108, 57, -147, -56, -86, 
+	92, 31, -110, -19, -4, 39, -12, 37, 
+	47, 156, 61, -13, 23, 107, -65, -101, 
+	-37, 133, 224, -120, -45, -35, -37, 49, 
+	-105, -150, 99, 109, -11, 110, -126, -47, 
+	-71, 43, -5, -61, 59, -47, 140, -45, 
+	-23, 13, -87, 4, -65, -115, 84, -14, 
+	-49, -85, -86, 13, -131, -94, -34, 88, 
+	-46, -25, -1, -21, 101, -37, 13, -70, 
+	66, 9, -108, -16, -136, -43, 9, -140, 
+	97, -75, -71, -7, -97, 57, -52, 74, 
+	-14, -7, 59, -77, -45, 63, 77, 46, 
+	-130, -22, 158, -70, 71, -56, 125, -152, 
+	126, -181, -77, 8, 92, -96, -12, -15, 
+	-10, 31, -37, 71, -145, -111, 81, -125, 
+	-81, 182, 67, 50, 5, -102, 41, 80, 
+	35, -35, -234, -100, -167, 30, -164, -106, 
+	-159, -12, 196, -33, 12, -7, 59, 98, 
+	-107, -107, 29, 7, -87, -125, 53, 32, 
+	-68, -159, 214, -102, -5, 112, 45, 24, 
+	-74, -97, -151, -142, 39, -178, -90, -81, 
+	-47, -93, 23, -71, 60, 109, 137, 73, 
+	36, 44, -140, -58, -43, 44, -10, -30, 
+	-102, -4, -29, -92, -159, -65, 6, -81, 
+	5, -58, 69, -2, -142, -8, 79, -210, 
+	-47, 29, -112, -38, -47, 57, -96, -100, 
+	-168, -34, -31, -89, -24, 58, 44, -148, 
+	28, 221, -68, -121, 64, 24, 13, -75, 
+	67, -1, 34, -22, 80, -57, 22, 145, 
+	99, 92, -51, -38, 107, 49, -52, 2, 
+	-116, 3, -39, -60, 20, 95, -21, -147, 
+	-28, 67, -94, -18, -163, -14, -48, -73, 
+	-15, 80, -47, 118, -146, 34, -32, -101, 
+	-28, -52, 112, 86, 3, -4, -55, -109, 
+	-2, 44, -66, -124, -36, 33, 47, -24, 
+	30, 61, -18, 70, 51, -39, 0, -75, 
+	-35, 23, -46, 49, 5, -60, -64, 81, 
+	68, 82, -77, 3, -74, -24, -41, 81, 
+	70, 36, 34, -143, 81, 119, -39, -99, 
+	-99, -40, 66, -7, 1, 81, -16, -98, 
+	-31, -112, -50, -73, -70, 119, -155, 22, 
+	81, -121, -91, 36, 123, 25, -28, -189, 
+	-120, -43, -17, -69, 26, 36, -30, -79, 
+	52, 16, 60, 14, 23, -132, -105, 15, 
+	0, 57, -6, -7, -21, -80, 83, -135, 
+	-58, -68, 48, -15, -102, 54, -106, 86, 
+	49, -94, -5, 52, -48, -17, 16, 38, 
+	68, -60, -6, -58, 35, 71, 17, -18, 
+	-48, 103, -88, -7, 8, -100, 76, 9, 
+	24, 11, 24, -55, 51, 21, 6, -53, 
+	-100, 5, -28, 17, -86, -24, -43, -46, 
+	46, -30, 13, 83, -38, -100, -3, -22, 
+	-64, 18, -13, -79, -49, 48, -33, 53, 
+	-52, -18, 18, -83, -111, 15, 26, -52, 
+	25, -20, -58, -72, 17, -57, -6, -63, 
+	-93, 120, -110, 18, -92, 30, -111, 42, 
+	-27, -63, 56, 34, -22, -42, -1, 32, 
+	98, 21, 51, 34, 58, -3, 27, -51, 
+	6, 87, -44, 97, 21, -25, -108, 55, 
+	-38, -2, -87, 23, -83, 16, -75, -2, 
+	11, -73, 94, -7, -72, 41, -44, 99, 
+	48, -79, -81, 97, 28, -88, -24, -75, 
+	-8, 6, -85, 21, -93, -26, -132, 31, 
+	68, -51, -18, -31, 46, -71, -56, -91, 
+	-101, -84, -101, -137, 24, -65, -86, -49, 
+	64, 58, -25, -109, -38, 13, -28, 83, 
+	-93, 44, -65, -47, -89, -71, 28, 23, 
+	-96, 1, -4, -17, 69, -38, -55, 38, 
+	-30, -72, -60, 72, -59, 35, 1, -68, 
+	-74, -25, -8, 57, -70, -60, -52, 38, 
+	41, 72, -68, -122, 30, 64, -18, -69, 
+	-80, -47, -85, -62, -2, -26, -15, 7, 
+	-122, -65, -31, -3, -25, -9, -50, -29, 
+	-80, -48, 60, 32, -20, -56, 91, -16, 
+	-78, -69, 0, 32, -110, 34, -31, 6, 
+	-41, 35, 30, -10, -48, -40, -111, -43, 
+	-48, 18, -10, -138, 2, -22, -81, 74, 
+	-22, -144, -35, -40, 15, -103, -16, -38, 
+	-124, 49, 11, -15, 22, -54, 15, -73, 
+	-5, 29, -100, -3, 18, -73, 36, 10, 
+	9, 36, -81, 8, -130, -81, -75, -58, 
+	37, -71, -61, 101, -132, -58, -27, -17, 
+	-121, 0, -44, -57, -72, -136, 31, 39, 
+	75, -47, -23, 5, 19, 1, -70, -2, 
+	69, 40, -124, -7, 36, -80, -16, -82, 
+	-76, 60, -19, -66, 36, 3, 14, 19, 
+	23, -43, -82, 28, -47, 50, 70, -100, 
+	-32, -86, 3, -113, -73, -50, -44, -123, 
+	-99, 3, 28, -12, 62, 50, 47, -65, 
+	25, -154, 22, -9, -37, 14, 48, -110, 
+	13, -3, 28, 14, -14, -32, 24, -113, 
+	-50, 49, 11, -35, -39, -38, -18, -12, 
+	-61, 10, -37, -30, -37, 31, -94, 21, 
+	-96, 49, 82, -55, -80, 12, -40, -35, 
+	70, -118, -30, -73, 99, 35, -79, 9, 
+	-21, -83, -75, -45, -65, -40, -80, -69, 
+	-9, 4, -80, -33, 32, 10, 65, -86, 
+	-54, -37, -14, 0, -61, 34, 88, -31, 
+	16, -43, 39, -62, 34, 3, 32, -28, 
+	-61, 104, -49, -122, 65, -142, -101, -67, 
+	84, -80, 18, -97, 12, -116, -52, -14, 
+	52, -6, -67, -37, -110, 78, -20, -117, 
+	4, 56, 45, -30, -24, 10, 52, 21, 
+	86, 76, -69, -19, -32, -117, -89, -29, 
+	57, -19, 88, -23, -9, 83, -36, -82, 
+	14, 23, -42, -110, -26, -118, -122, 43, 
+	86, -76, -90, -126, 23, 20, 0, -64, 
+	92, -66, -108, 5, 48, -96, 36, -18, 
+	-129, -5, 52, -89, -69, -95, -51, 31, 
+	-27, -27, -87, -32, -121, 96, -90, -97, 
+	-12, 1, 1, -23, -47, -65, -102, -126, 
+	-50, 70, -88, -57, 49, 64, -26, -11, 
+	-82, -33, 2, -73, -53, -92, -30, -31, 
+	-45, -65, -33, -88, -9, -96, -51, 58, 
+	-53, 17, -92, 30, -21, -60, 4, 42, 
+	-33, 91, -9, 135, 25, 27, -101, 118, 
+	-14, -111, -37, 60, 43, -111, 77, 14, 
+	19, 40, 158, 52, -6, -54, -94, 58, 
+	15, -74, -3, -163, 9, -51, -89, 70, 
+	-75, -29, 33, -121, -32, -6, 126, 78, 
+	20, -20, -137, 20, -96, 46, 32, 0, 
+	-83, -120, 36, -23, 67, 35, 3, -22, 
+	-79, 18, 122, -96, -4, -80, -127, -149, 
+	-4, -40, 64, -61, -44, 37, -81, -27, 
+	-6, -109, 141, -78, 57, 122, 16, 82, 
+	-17, -150, 27, -93, -42, 49, -42, -82, 
+	-62, 49, -96, -17, -4, 124, -44, -138, 
+	34, -38, 103, -64, -156, -48, 165, 19, 
+	-123, 122, -35, 37, 39, -37, 30, -32, 
+	-32, 24, -13, -121, -17, 90, 7, 62, 
+	-66, 182, -5, -25, 44, 85, -72, 128, 
+	-51, -61, 217, 24, -122, 48, 40, -71, 
+	-74, -200, 183, -32, 53, 1, -57, -112, 
+	53, -62, 40, -52, -140, 118, 25, -34, 
+	35, 0, -66, -28, -14, 125, -76, 14, 
+	-133, -187, 41, -75, -42, -13, -31, -130, 
+	-3, -23, -33, 102, -120, -139, -84, -177, 
+	216, -156, 284, -71, -9, -10, 83, -100, 
+	-125, 134, -64, -100, 51, -66, -14, 93, 
+	-45, -46, 139, -3, -9, 26, 136, -163, 
+	4, -16, 17, 43, -43, -2, -38, -120, 
+	56, -233, -81, 80, 18, -151, 38, 12, 
+	70, 66, -43, -122, -34, 52, 18, -87, 
+	36, 74, 6, -150, -9, -71, -49, -46, 
+	-57, 100, 5, 57, -55, -28, -96, 11, 
+	51, -31, 237, 65, -50, -47, -70, -68, 
+	80, 55, 48, 92, -61, 52, -130, -46, 
+	-47, -2, 36, -57, -26, 5, 62, -70, 
+	-11, -115, 116, -35, -61, 93, 67, 67, 
+	-56, -151, -168, -40, 8, 10, 153, 86, 
+	1, -97, -33, -15, -13, 52, 57, -77, 
+	32, -142, 72, -81, -129, 33, 34, 59, 
+	-113, 169, -10, -94, 53, -108, -97, -5, 
+	2, -13, 21, 71, -97, -101, -28, -23, 
+	-87, 67, 75, 28, 26, -112, -64, -15, 
+	-30, 43, 147, -22, 11, 4, -98, -124, 
+	-74, -3, 192, -9, 10, -77, -32, 38, 
+	41, 28, -67, 21, 6, -64, -154, -81, 
+	100, -39, -12, -32, -32, 17, -47, -122, 
+	-20, -73, 68, 69, 14, 26, -65, 7, 
+	98, -53, -89, 8, -112, -89, -67, -149, 
+	21, 41, 306, -87, -66, 16, -84, 72, 
+	-13, 47, -116, 11, 14, 5, 44, 5, 
+	-21, 3, 218, -86, 18, 60, 51, 67, 
+	-85, 135, 131, -35, -150, -66, 21, 79, 
+	5, -45, -115, -8, -103, -52, -17, 46, 
+	-57, -32, -14, -62, -58, -94, -92, 29, 
+	-72, 18, -83, -1, 72, -123, -47, -166, 
+	41, -139, -87, -98, -82, -51, 16, -59, 
+	-125, -82, 167, -6, -141, -75, 14, -132, 
+	-50, -56, -102, -43, 74, 35, 5, -99, 
+	25, 70, -18, 27, 15, 11, -42, -124, 
+	61, -44, 122, -91, -19, 23, -26, 37, 
+	-39, 0, -139, -23, -99, -114, 20, -67, 
+	-74, -112, 2, 89, -51, 101, 27, -88, 
+	-28, 21, -70, 17, 172, 22, 91, -39, 
+	43, 93, -92, -38, 21, 25, -127, -24, 
+	22, -30, 46, 18, -45, -18, 43, -13, 
+	-15, 120, 51, -15, -33, 6, -128, -40, 
+	-33, 109, 43, 78, -3, 9, 104, -118, 
+	-74, 16, -62, -82, 43, -32, 50, 6, 
+	-127, 56, 17, 59, 143, 30, -163, -111, 
+	-85, 75, -15, 83, 23, -89, -6, -195, 
+	-77, -88, 40, -65, -30, -41, 6, 1, 
+	-71, 96, -152, 24, -30, 81, 29, -22, 
+	-68, -14, 96, 37, 58, -86, 54, 36, 
+	-14, -173, -19, 211, 38, 39, 60, 86, 
+	62, 81, -24, -6, 25, 1, 67, -36, 
+	39, -5, 73, 66, -39, 2, 66, 49, 
+	-205, 21, 34, -59, -48, 36, 49, 66, 
+	-37, 28, -40, 28, 128, 72, -56, 41, 
+	-47, 157, 108, 100, 83, -16, 80, 36, 
+	-22, -202, 153, 22, 78, -51, 104, 124, 
+	11, 155, -146, 13, -4, 121, -81, -118, 
+	12, -92, -105, -49, -49, 84, 33, 58, 
+	-159, 25, -57, -28, -84, -7, -30, 75, 
+	95, 36, -170, -31, 4, 2, 78, -167, 
+	91, 95, 20, 104, 146, -76, -126, 114, 
+	-23, -107, 94, 16, 54, -25, 80, 25, 
+	-29, 177, 0, 83, 112, 50, -47, 82, 
+	-59, -232, 196, 25, -5, 106, 38, -8, 
+	11, -34, 43, -20, 20, 62, -40, -19, 
+	37, -19, 148, -19, 68, 53, 12, -26, 
+	-92, 25, 129, 6, -118, -4, -85, 12, 
+	-103, 76, 42, -40, -34, -60, 17, -136, 
+	70, 95, -21, 45, -83, -35, 111, 7, 
+	-111, 138, 10, 28, -93, -95, -58, 113, 
+	-112, 187, -80, -10, -120, 18, 45, -38, 
+	-33, -154, -97, -39, -14, 120, -7, 77, 
+	-117, -34, 96, -35, 87, -34, -98, 5, 
+	-97, -125, 25, -46, -109, -80, -118, 41, 
+	86, -59, 36, -40, 52, 9, -68, 5, 
+	118, -101, -62, 69, -6, 34, 81, 114, 
+	-64, 75, -112, 111, 61, 101, -65, 77, 
+	-23, 79, -8, -83, 34, 97, 14, -4, 
+	43, 75, -64, 119, 3, 123, -51, -11, 
+	31, -43, 116, 58, -8, 128, 18, -56, 
+	29, -158, -96, 99, 102, -73, 26, 4, 
+	72, -33, -29, -41, -49, -21, -66, 25, 
+	63, -38, 40, -141, 120, 70, 30, 4, 
+	24, 0, -73, 14, -51, 65, -81, 69, 
+	-88, 53, 121, -47, -112, -56, 89, -97, 
+	43, 5, 69, 35, -13, -117, -134, 19, 
+	71, -169, 78, 123, 113, -89, -53, 22, 
+	66, 95, -36, 56, 70, 4, -33, -82, 
+	-52, 79, 19, -116, 109, 45, 75, 67, 
+	-44, -61, -120, 44, -97, 65, 135, -31, 
+	-28, -136, -62, 15, 15, -178, 71, 10, 
+	64, 11, -99, 56, 92, 128, -75, 45, 
+	12, 29, -111, 25, 61, -37, -43, -63, 
+	-50, 124, -71, -52, 111, -10, 53, 70, 
+	1, -79, 93, 78, -18, 6, 113, 25, 
+	-64, -79, 33, -69, -58, -65, 40, 44, 
+	37, 85, -140, 57, -95, 48, 26, 114, 
+	29, 66, 52, 79, -49, -100, -4, 83, 
+	138, 70, -88, 41, -119, 88, -119, 48, 
+	30, 64, 20, -120, -69, 55, -57, 57, 
+	-93, -92, 118, 129, 116, 36, 39, -20, 
+	69, 76, 53, 105, 42, 65, -45, 26, 
+	-95, 106, 62, -6, -93, -97, -16, -76, 
+	121, -48, -116, -82, 39, -4, -63, 190, 
+	-26, 50, -14, -35, -96, -34, -59, 92, 
+	118, 55, 13, -23, -97, 8, -14, -107, 
+	0, -206, 8, 34, 38, 123, 12, -38, 
+	18, -187, 58, -42, -104, -28, 52, 25, 
+	41, -73, 61, 34, -100, 74, -13, -55, 
+	-61, -133, 80, -109, 41, 156, 45, -6, 
+	-88, -36, 12, 43, -43, 98, 144, 55, 
+	36, 8, -63, -5, 88, 55, 113, -56, 
+	35, 50, -8, 0, 25, -88, 50, 56, 
+	95, -61, 149, -116, 135, -54, -64, -50, 
+	-113, 26, -100, 21, 14, -119, 0, -2, 
+	-81, 122, 66, -87, -99, 11, 38, -224, 
+	73, -3, 71, 39, 64, 17, -43, -109, 
+	16, -26, -40, 46, -53, 77, 71, -87, 
+	116, -125, -67, -133, 31, -57, 12, -100, 
+	-62, -30, -30, -22, -115, 93, 11, -97, 
+	1, -47, 144, -47, -14, 27, 71, 85, 
+	4, 132, -77, 30, 153, 75, -2, -68, 
+	79, 164, -49, 99, 57, -118, 32, 46, 
+	71, 113, 58, 8, 56, -97, 82, -3, 
+	-87, 78, 60, 69, 10, -63, -7, 215, 
+	-25, 49, 134, 110, -7, -27, -46, 59, 
+	7, 170, -16, 74, 176, 86, 36, 48, 
+	45, 13, 84, 209, 87, 101, 149, 15, 
+	142, 79, -37, -33, -67, -29, 74, 116, 
+	180, 89, 71, 12, 92, 31, -2, 55, 
+	-37, 40, -111, -55, 24, -27, 45, 5, 
+	-62, 42, -40, -146, -12, 56, -28, -236, 
+	-34, 19, -32, -37, 86, -18, -162, 141, 
+	-59, -6, 30, 130, 77, -59, 49, 96, 
+	-17, -62, -211, -6, -112, 10, -75, -15, 
+	-81, -305, 130, 26, -10, 75, 15, 2, 
+	-61, 60, 56, 100, -45, 84, -43, 79, 
+	-37, 18, -67, 1, -87, -87, 27, 64, 
+	-37, 113, -63, -36, -46, -64, -54, 28, 
+	5, 142, -54, 38, -36, -57, 91, -90, 
+	170, 150, 112, 55, -44, -90, 80, 23, 
+	26, 75, 55, -2, 22, -17, 43, 111, 
+	-26, -1, -66, 66, 176, 44, 28, -14, 
+	-9, 39, -27, -5, -13, -8, -44, -8, 
+	30, -100, -65, 83, 118, -4, -103, 11, 
+	-27, -133, 74, 29, -69, 13, 28, 77, 
+	-42, -106, 54, -77, -76, 109, 65, 42, 
+	122, -117, -46, -47, 57, -50, 55, -27, 
+	-16, 72, -42, -53, 9, 13, -1, 67, 
+	76, 116, 25, 26, -63, -78, -39, -52, 
+	-36, -42, -80, 102, -23, -108, -131, 15, 
+	27, 70, 209, 27, 41, -55, -20, 19, 
+	61, -126, -66, 54, 153, 74, -32, 128, 
+	-70, 19, -30, 95, -79, 14, 63, 114, 
+	69, -63, 142, -29, 86, 94, 6, 128, 
+	5, -138, -104, 11, -38, 34, -18, 151, 
+	-3, -47, 59, 11, 68, -53, 82, 11, 
+	139, -16, 14, -204, 14, -100, -181, -3, 
+	-12, -1, 71, 51, 109, 1, 32, -15, 
+	40, -29, 26, -59, -175, -128, -51, -106, 
+	-32, -3, 67, -71, 190, -17, 52, -35, 
+	48, -146, -6, 29, 148, -41, 87, 67, 
+	59, -117, -47, 40, 82, -45, 23, -47, 
+	113, 3, 114, 93, 42, 130, 15, -28, 
+	29, 22, -98, -34, -29, -14, 47, 177, 
+	-1, -4, 115, -106, 66, -17, -13, 104, 
+	147, -166, 3, 56, 46, 118, 29, 22, 
+	40, -133, 192, 65, -22, 32, 106, 69, 
+	-110, 15, -108, 45, 126, -74, 62, 42, 
+	23, 159, -90, 82, -123, -39, 48, -67, 
+	29, -134, -57, 38, 8, 21, 104, 89, 
+	-39, -82, 103, -103, -130, -11, -13, -9, 
+	-30, -168, 124, -50, -9, -60, -46, -25, 
+	82, -42, 79, -26, 58, 62, -87, 39, 
+	65, 88, 17, -99, -7, 54, -3, -34, 
+	-81, 135, -161, -176, 9, -267, -139, 188, 
+	94, 147, -25, -70, -99, -32, 98, 49, 
+	-128, 77, 54, 20, 127, -7, 118, 32, 
+	26, 1, -59, 85, -39, -5, 23, 29, 
+	-8, -67, -59, -71, -13, 87, 58, 21, 
+	-1, -123, 38, 119, -65, -18, 88, -32, 
+	66, -126, 51, 2, -105, 20, 71, -90, 
+	-26, 134, -78, -115, 78, 21, 18, -3, 
+	-94, 82, -177, 23, 43, -51, -14, -5, 
+	148, 78, 56, -41, -217, 7, 46, -60, 
+	123, 100, 56, 6, 25, 72, -35, -23, 
+	12, -29, 39, -201, 9, -40, 67, -32, 
+	-41, 33, 62, 37, -34, -107, -67, -53, 
+	84, -153, 8, 88, 50, 36, 31, -52, 
+	165, 123, -68, 163, -74, 45, 9, -91, 
+	-66, -25, -51, -2, 119, -108, -55, 112, 
+	-9, -18, -97, 4, -8, -82, 73, 35, 
+	110, -81, -6, 52, -12, 28, 47, 7, 
+	68, -155, 18, -27, 89, -81, 47, 34, 
+	-57, 10, 93, 31, 115, -124, -81, -71, 
+	-30, -55, -12, -69, 31, -39, 12, -70, 
+	-34, -8, -100, 59, 150, 5, -36, 73, 
+	17, 162, 34, 44, 41, -57, -31, 126, 
+	-16, 8, -32, 70, 151, 1, -5, -8, 
+	68, -156, 162, -23, 79, 43, -10, 92, 
+	4, 42, -106, 47, 115, 66, -111, -47, 
+	128, -22, -7, -55, 19, -101, 33, 48, 
+	-107, 35, -136, 44, -128, 15, -149, 158, 
+	109, 112, 29, -15, 24, -154, -51, -87, 
+	-34, 35, 6, -32, 9, -100, -41, -81, 
+	14, 2, 92, 5, -11, -149, 0, 77, 
+	-5, 155, -94, 126, 292, -31, -107, 5, 
+	-52, -119, 18, 47, 114, 161, 125, -124, 
+	99, 72, 37, -3, -3, -52, -106, 119, 
+	-76, 47, 131, -31, -125, -31, -20, 59, 
+	-39, 170, 69, -65, -91, -128, -30, -5, 
+	-80, -11, 175, 24, 4, 138, 122, -267, 
+	223, 83, -22, 39, -84, -108, -57, -71, 
+	-80, 6, 10, 1, -119, -103, -59, 9, 
+	-156, 30, -118, -52, -120, -84, -5, 5, 
+	46, 27, -147, 36, -24, -5, 139, -90, 
+	-137, 13, 143, -64, 124, 71, -24, 58, 
+	45, -73, 23, 5, -58, -141, -18, 116, 
+	64, -64, 122, -18, 153, 28, 109, -85, 
+	79, -156, 105, 141, 35, 44, 8, 54, 
+	-78, 139, 117, 161, 84, 95, 58, 6, 
+	-82, 79, -27, -39, -114, -69, -73, 163, 
+	56, 46, 95, 39, 102, -81, -66, 56, 
+	45, 90, 87, -108, 18, -61, -66, -31, 
+	81, -51, -24, 150, -47, -68, 57, -14, 
+	-7, -35, -45, -137, 71, 82, -6, -35, 
+	-51, 9, -43, -85, 3, 79, 58, 7, 
+	32, 8, 42, -34, 80, 19, -56, 90, 
+	-117, 69, 90, -42, 30, 30, 108, -8, 
+	0, -61, 37, 41, 75, -162, -62, -174, 
+	86, -7, 74, -27, 95, -52, -41, 84, 
+	78, -15, -103, 8, -43, 80, -23, 13, 
+	54, 111, -10, 7, 88, 36, -6, -46, 
+	46, -68, -9, -75, 33, -51, 8, -106, 
+	168, 74, -88, 62, -90, -55, 24, -58, 
+	-6, -70, -130, 24, 9, 91, 37, -17, 
+	48, -3, -85, -57, -15, 140, 39, 180, 
+	53, 24, -124, 24, 116, 21, 21, -47, 
+	75, -115, 62, -74, 78, 36, 159, -146, 
+	-84, -44, -41, -2, -165, -106, 69, 51, 
+	-64, -178, -97, 121, -11, -181, -83, 18, 
+	-19, 32, 125, -55, 84, -35, -135, 51, 
+	147, 53, -190, 57, 39, 29, -89, 48, 
+	13, 9, 118, -15, 34, 97, 84, 44, 
+	-24, -41, -60, 47, -82, 67, 25, -37, 
+	221, 26, 49, 130, -99, 36, -14, -48, 
+	51, 77, 59, -85, -58, 90, -1, 65, 
+	100, -14, -52, 34, 107, -4, -96, 70, 
+	-12, -101, 143, 136, 17, 3, 41, 18, 
+	31, -18, 53, 61, 23, -36, -139, 89, 
+	8, 30, -28, 81, 8, 67, -26, 111, 
+	126, -92, 36, -131, 88, -35, -114, 7, 
+	-17, 66, 66, -72, -63, 33, 31, -68, 
+	8, 45, 108, 27, -51, 187, -74, -70, 
+	-103, -28, -58, 8, -38, -60, -81, 38, 
+	-11, -90, -44, -9, -7, -89, 13, 88, 
+	-97, 138, -50, 35, 163, 39, 34, -6, 
+	-28, -15, 48, 73, 89, -23, -6, -12, 
+	66, 43, -107, -77, -16, -39, -33, 8, 
+	67, 22, 60, -11, -57, -54, -67, -110, 
+	-10, -47, 36, -91, 109, 77, 85, 58, 
+	21, -108, 40, -37, 127, 100, 54, -33, 
+	59, -16, 67, 54, 111, 80, 112, -62, 
+	-9, 8, 33, 100, 15, -37, -39, -83, 
+	56, 84, -54, 126, 21, -93, 16, 120, 
+	64, -37, -101, -122, 87, -65, 12, 83, 
+	-143, 85, -86, -17, 46, -15, 21, 140, 
+	25, -6, 154, 111, 133, -116, 4, -125, 
+	-43, 141, -23, 80, 89, -38, -57, 50, 
+	1, -63, 113, 103, -38, -135, 31, 37, 
+	35, -83, -29, 114, 104, 107, 29, 148, 
+	82, -39, -25, 129, 11, 136, 125, -28, 
+	20, 81, -1, 73, -91, -42, 12, -58, 
+	-32, -31, 44, -24, -130, 106, 32, -57, 
+	16, 23, -23, -62, -39, 22, -2, 126, 
+	-56, -60, 113, -97, 35, -164, 84, -64, 
+	38, 14, 153, 13, -24, -68, -53, 91, 
+	5, 35, 23, 57, -41, -62, 39, -46, 
+	52, -60, -132, -34, -4, -81, 43, 75, 
+	-87, 50, -44, -40, -160, 94, 78, -30, 
+	35, -7, -46, 43, -4, 98, -49, 43, 
+	-83, -28, 45, 29, -38, -46, 90, -18, 
+	-49, 160, -138, 75, 49, -138, 100, 105, 
+	-70, 136, 61, 107, 38, 44, -21, -8, 
+	-40, 51, 17, 24, -55, -64, -129, 39, 
+	52, -105, -56, -9, 65, 56, -12, 64, 
+	67, -152, -5, 44, 75, 50, 73, 2, 
+	1, -18, 31, 56, 65, -9, 97, -212, 
+	-95, -73, 24, 147, 94, -73, 56, 48, 
+	-29, -105, -46, -56, 62, 63, -127, 106, 
+	-110, -101, -223, -25, -37, 43, -82, 33, 
+	41, 49, 129, 15, 8, 24, -137, 16, 
+	-145, -123, -64, -119, 76, -56, 96, 35, 
+	6, 125, -42, -116, -14, 7, -62, 15, 
+	-35, 100, -43, 171, -56, -124, -45, 35, 
+	95, -138, -38, 46, 37, -15, -64, 89, 
+	66, 19, -86, -126, -2, 108, -50, 10, 
+	7, -130, -127, -53, -126, -118, 67, 107, 
+	-34, -92, -52, 38, -92, -25, 38, 28, 
+	48, -60, -30, -17, 44, -83, 93, -22, 
+	-113, 10, 62, -75, -2, -79, -11, 129, 
+	-106, 97, -66, -185, -44, 19, -103, 127, 
+	-13, 191, -35, -20, -95, 16, -31, -13, 
+	123, 118, -153, 33, -148, 0, -12, -110, 
+	-57, 19, -93, 24, 131, -86, 23, -37, 
+	21, 36, -115, -99, 30, 9, 76, -108, 
+	-20, 78, -56, -4, -12, -31, -47, -85, 
+	-96, 63, -47, -17, 9, 69, 57, 66, 
+	77, 12, -7, -51, 62, 86, -30, 90, 
+	55, -241, 57, 69, 70, -165, 71, 0, 
+	27, -211, 49, -27, -153, 29, 74, -60, 
+	-27, -29, 76, 57, -27, -10, 109, -11, 
+	-23, -81, -24, 25, 147, 35, -93, 78, 
+	29, 35, 117, 3, -60, -134, -13, -7, 
+	-68, 73, -27, -14, -88, 36, -40, -69, 
+	26, -60, 47, -60, -139, -104, -64, 145, 
+	10, 127, 83, -79, -23, -14, -50, -120, 
+	-76, -33, 68, -25, -14, -14, 17, 60, 
+	1, -165, -124, 29, -129, 20, -83, 30, 
+	1, -2, 52, 89, -150, 72, -63, -85, 
+	-140, 104, -105, -107, -45, -71, -57, 56, 
+	34, -72, -36, -68, -113, -65, -49, -21, 
+	-23, 20, -19, 54, 162, -6, -31, -55, 
+	-91, -124, -18, -102, -3, -67, -100, 179, 
+	111, 37, 56, 4, -113, 48, -102, 85, 
+	51, -28, 8, -147, -37, 96, -172, 27, 
+	109, 111, 57, -105, -107, -42, -36, -74, 
+	37, 30, -35, -73, 102, -147, -24, 47, 
+	61, 20, -74, -39, -65, -128, -44, 111, 
+	98, -48, -61, -87, -23, 57, -80, 121, 
+	-47, -61, 89, -98, 153, 98, 73, -82, 
+	116, -131, 97, 27, -12, -44, -190, 146, 
+	-59, -127, -42, 94, -84, 16, 31, 32, 
+	19, 18, 4, -197, 3, -2, -101, 40, 
+	35, -178, 104, -47, -3, -36, 29, 1, 
+	-89, -56, 62, -133, -15, -23, -45, -39, 
+	-3, -32, -78, -23, -109, 5, 61, 43, 
+	28, 7, 84, 22, 116, 125, -102, 73, 
+	-3, -22, 53, 91, -48, -103, -65, -28, 
+	-105, 65, -38, -34, 15, 67, -96, -13, 
+	-25, 30, 19, -15, -24, -57, -54, 43, 
+	-93, -79, 78, -1, 5, 53, 40, -45, 
+	-14, 20, -54, 14, 86, -8, 83, 71, 
+	-49, 36, 79, -58, 34, -47, 78, -81, 
+	-85, 36, -82, 41, 27, -42, -46, 16, 
+	28, -92, 2, -49, -95, -85, -67, 37, 
+	78, -14, 22, -10, 8, 52, 79, 45, 
+	-111, -105, 53, -22, 66, -67, 14, 34, 
+	-42, 34, -2, 6, -29, 77, -45, -94, 
+	-13, 30, -20, 58, -99, -82, -38, -71, 
+	4, -29, 27, 29, -68, -7, -13, -88, 
+	28, -38, -73, 72, -32, -17, -80, -78, 
+	-50, -59, 57, -90, 32, -52, -68, -87, 
+	21, -19, -59, -87, 25, 57, 36, -73, 
+	27, -60, -101, -17, 57, -69, -40, -39, 
+	-26, 75, -77, -75, 34, 48, -40, -51, 
+	-54, 42, -95, -6, 45, -88, 25, -99, 
+	-45, 0, -87, -44, 87, 0, 74, -22, 
+	-20, 95, 51, -85, -36, 65, -85, -21, 
+	47, -3, -62, 28, -54, -93, 1, 42, 
+	7, 59, -3, 18, -36, -13, -87, -100, 
+	-6, 24, -93, 7, -75, -33, -78, 39, 
+	-78, -98, 53, 60, -46, -56, 12, 6, 
+	-56, -65, 12, -72, 58, -39, 38, -97, 
+	-78, 25, -84, 75, -77, 48, -48, -23, 
+	-23, -46, 42, -60, -69, 29, 42, 61, 
+	32, -27, -63, -2, 26, -18, -24, -65, 
+	-7, 84, -70, 13, 9, 18, -2, 58, 
+	-70, 60, 5, -79, -5, -70, 47, 6, 
+	-70, 6, -88, -24, 12, 30, 38, 85, 
+	38, 58, -85, -15, 71, -77, -105, 66, 
+	40, -49, 17, -25, 24, 85, -57, 18, 
+	-131, 51, -21, 18, 64, -13, -9, 0, 
+	-96, 48, -97, 30, -90, -74, 14, 27, 
+	-70, -59, 14, 7, 39, -25, -29, 8, 
+	18, 12, 57, 46, -92, -83, 12, -20, 
+	17, 1, -25, -41, 48, -83, -43, -71, 
+	-18, -103, 66, -60, 14, -76, 43, 9, 
+	26, -50, -61, -68, -80, -19, 73, 12, 
+	-65, 34, -13, -74, -4, -101, -2, -23, 
+	-21, -90, -96, 9, 51, 44, 30, -86, 
+	-46, -89, 44, -60, 73, -43, 64, 80, 
+	84, -58, 24, 77, 64, 50, -46, -34, 
+	74, -82, 31, 33, -80, 38, -10, -74, 
+	80, -40, 6, -39, -98, 38, -42, -80, 
+	-54, 16, 66, -80, -5, 73, -40, 30, 
+	58, -82, 87, 46, -66, 5, 58, 27, 
+	-53, -49, -92, 41, 24, -13, -62, 68, 
+	-21, 14, 47, -93, -31, -23, -6, 64, 
+	53, 54, 18, -20, 42, 74, -26, 4, 
+	47, 6, -27, 21, -37, -84, -102, -16, 
+	-76, 2, -56, -45, 51, 48, 24, 65, 
+	33, 49, -83, -83, -26, -14, -56, -45, 
+	62, -46, -70, 9, 41, -16, 53, -63, 
+	-22, 91, -1, -43, 78, -104, -5, -25, 
+	-1, -34, -75, -58, -83, -86, -19, 52, 
+	38, -71, -87, -76, -114, 88, -1, 44, 
+	-15, -47, -104, -10, 3, -19, 32, -4, 
+	-53, -98, -64, -71, 42, -70, 57, 31, 
+	-84, -1, 35, 12, -16, 19, -6, 31, 
+	56, 29, -7, 67, -61, 35, 10, -17, 
+	-46, -98, -63, 66, 20, 54, -99, -16, 
+	87, -90, -54, -30, -69, -2, 63, -25, 
+	82, -94, 29, -6, -71, 33, 2, 22, 
+	-41, -44, 12, 41, 1, -82, 11, -73, 
+	-60, -8, 37, -4, 2, 75, -37, -92, 
+	-97, 60, 48, -59, 67, 4, -71, -60, 
+	-68, -16, -70, -69, 66, 46, -22, -17, 
+	45, 72, 57, -93, -38, -6, 3, 80, 
+	-79, 62, 75, -4, -10, -52, 70, -32, 
+	51, -135, 205, 27, 55, 17, -104, -77, 
+	-104, -28, 130, -16, -9, -34, -13, 60, 
+	73, -12, -62, -96, 93, 14, -42, 10, 
+	45, 76, -156, -161, 44, -72, -40, -31, 
+	-103, 164, 19, -55, 58, -127, 115, -18, 
+	28, 34, -27, -133, 53, -74, -107, -65, 
+	81, 23, 29, -20, -13, -101, 54, 35, 
+	25, -63, 26, 24, 63, 34, 90, 5, 
+	-35, -31, -78, 69, -61, -66, -124, -37, 
+	93, -33, -63, 36, 83, 96, -29, 89, 
+	-59, 17, -84, -51, 64, 49, -10, -99, 
+	-50, -54, 39, -173, -105, 102, -72, 106, 
+	133, 61, -74, 21, 44, 11, -39, 86, 
+	98, 113, 5, -26, -62, 4, 106, 29, 
+	55, 133, -47, -52, 81, -89, -4, -122, 
+	75, -116, 24, 34, 2, -6, 81, -41, 
+	-41, -92, 87, 55, -134, -51, 52, -15, 
+	20, -39, 34, 21, 105, 97, 76, -171, 
+	28, 53, 43, -5, 15, 89, -37, 108, 
+	-10, -29, 10, -105, -117, -73, 31, 132, 
+	63, -96, 97, -56, -193, 22, -10, 24, 
+	-40, -38, 99, 122, 15, -63, 33, 110, 
+	12, 133, -166, 72, -57, -128, 40, 13, 
+	-3, 60, 59, 7, -8, -2, -95, -60, 
+	65, 130, 95, -3, 77, 70, -58, -46, 
+	-50, 91, 109, -54, 71, -150, 101, 97, 
+	-63, 13, 23, 325, 65, -50, 14, 39, 
+	31, 86, -71, 145, 82, -13, 21, -3, 
+	-51, 5, 76, -10, 130, 112, 215, 127, 
+	-78, 101, -112, -80, 47, 26, 195, -76, 
+	153, 17, -28, 329, -57, -81, 1, 51, 
+	-28, 134, -44, -63, 106, 51, -5, -134, 
+	29, 29, -366, 94, -20, -122, 15, -36, 
+	-173, -56, 33, 62, -84, -26, -34, 52, 
+	-52, 45, -126, 38, 3, -39, -118, 140, 
+	-56, -67, 36, 216, -87, -115, 21, -67, 
+	76, 71, -108, 14, 35, 70, 22, 21, 
+	-25, 155, -100, 109, -69, 143, 168, 148, 
+	-9, -14, 5, 21, 16, -63, 64, 64, 
+	-78, -128, -22, 113, -212, 111, -97, 49, 
+	-66, -50, 57, -70, -114, 84, 119, 19, 
+	-50, -13, -58, 205, 113, -74, -69, -49, 
+	-115, -72, -63, -74, -99, -116, -44, 132, 
+	78, 209, 56, 85, 58, -124, -48, 82, 
+	-79, 56, -43, -29, -146, -101, 102, -6, 
+	1, 64, -49, 35, 36, -28, -13, 9, 
+	-25, -104, -25, 11, -121, -94, 31, -83, 
+	-83, -142, 184, -29, 80, 163, -19, 127, 
+	55, 244, -172, 24, -65, -36, -159, 36, 
+	198, -46, -29, 55, 145, 39, -110, 11, 
+	-117, 179, 42, 122, 103, 175, 86, -16, 
+	105, 28, 70, 55, 19, -19, -13, -42, 
+	-19, 236, 56, -92, 81, -132, 48, 40, 
+	7, -172, 52, 154, 77, 160, 47, 23, 
+	-122, 29, 71, 11, 20, 54, 59, 111, 
+	33, -46, -166, 104, 11, -59, -156, 6, 
+	131, -204, 36, -56, 126, 102, 128, 63, 
+	198, -160, 78, -9, -36, 18, 72, -93, 
+	-13, 55, 153, 18, 74, -24, -32, 133, 
+	1, 78, -4, -25, 24, 63, -112, -2, 
+	130, 30, 112, 85, -33, -29, -17, 79, 
+	-53, -128, 130, 35, -87, 0, 42, 96, 
+	-37, -58, 86, -70, 139, 75, 10, -63, 
+	-74, 52, -31, -182, 59, -90, 122, 4, 
+	13, -6, 30, 55, 156, -11, 177, -57, 
+	46, 110, 202, 34, -125, 112, -52, 35, 
+	172, -46, 146, 5, -107, -27, 15, -17, 
+	89, -213, 40, -94, 80, 19, 14, -109, 
+	16, -205, 106, -228, -41, 52, 180, 17, 
+	-41, 180, 8, -61, -45, -12, -149, -197, 
+	-59, 40, 80, 57, 30, -67, 32, 35, 
+	-42, 24, -75, 2, 0, -131, 50, 73, 
+	-22, -15, -12, -25, -40, 83, 22, -69, 
+	32, 20, -73, 7, -85, 124, 19, 66, 
+	77, -104, 91, -45, -62, -73, 42, 3, 
+	37, 16, 69, -99, 68, 93, 44, -75, 
+	-1, 40, -73, -40, -53, 20, -103, 42, 
+	-55, 96, 7, 12, -131, 24, 7, -57, 
+	17, 90, 38, -27, 15, -39, 15, 105, 
+	-13, -19, -58, 53, -38, -25, 41, 77, 
+	130, 38, 2, 82, 16, 0, 64, -34, 
+	-85, 10, 115, -86, -62, 100, 5, 175, 
+	26, -3, 22, -54, -97, 9, 50, -11, 
+	126, 59, -29, -141, -68, 189, 55, -26, 
+	25, 13, 34, 77, 72, 17, 135, -79, 
+	7, 83, -185, -96, 31, -65, -32, -91, 
+	-15, -161, -125, -113, -19, -7, 107, -59, 
+	71, -15, -80, 6, -24, -24, -78, 46, 
+	111, 100, 146, -23, 130, -133, 0, 60, 
+	135, 45, 107, -5, 1, 140, 31, 160, 
+	-95, -107, -65, 73, -79, -23, -20, -127, 
+	53, -100, -69, -3, -13, -33, 16, -163, 
+	58, 113, 229, -88, -6, -89, 13, -29, 
+	14, 126, -43, -103, 2, 64, 19, 27, 
+	-41, 45, 53, -122, 14, 94, 68, 75, 
+	121, 207, 33, -10, 103, 45, 174, -26, 
+	3, 106, 226, 33, 13, -72, 186, 75, 
+	-56, 55, -56, -4, -13, 73, -17, 69, 
+	-6, 68, 48, -110, 145, -103, 5, 66, 
+	-27, -120, 106, -45, 117, 44, -98, 74, 
+	92, 85, -32, -175, 87, -7, -3, -47, 
+	-66, -12, 131, 103, -49, -102, 11, 16, 
+	-99, 78, 49, -44, 141, -13, -20, 6, 
+	-60, -68, 28, -58, 147, -63, 91, 148, 
+	-45, 81, 67, 110, 41, -44, -34, 1, 
+	-70, 20, 60, 108, 84, -48, -2, 87, 
+	57, -33, -7, 161, -32, 44, -11, -85, 
+	-79, -53, -82, -25, 10, 17, -12, 75, 
+	-35, -132, 52, 58, 12, 173, -49, 78, 
+	-93, 79, 11, 90, -56, -4, -24, -9, 
+	84, 114, 113, 43, -13, 21, -27, 2, 
+	116, 15, 45, -94, 1, 13, -12, 78, 
+	62, 94, -89, 68, -29, -74, -125, -86, 
+	45, 143, -2, -26, -96, 56, 5, 108, 
+	-71, 97, 77, -108, -34, 58, -15, -72, 
+	-69, -57, -80, -65, -11, 138, -21, 56, 
+	109, 146, 7, -134, 98, 131, 28, 30, 
+	18, 59, -12, 29, 230, 29, -105, -54, 
+	42, -53, 79, 47, 46, -108, -75, -169, 
+	31, -50, -29, -98, 22, 45, -109, 44, 
+	68, -76, 164, -28, 160, 78, 109, 8, 
+	-1, -84, 129, 5, -54, 64, 77, -67, 
+	111, 20, -172, 189, -100, 16, -6, 72, 
+	210, 106, -66, 35, -41, 10, 98, 2, 
+	105, -54, 44, -18, -33, -22, -47, 51, 
+	-43, 141, -48, -118, 4, -79, 146, 131, 
+	124, 17, 79, 62, 50, -57, -6, -34, 
+	-20, 167, 150, 61, 35, 72, 9, 94, 
+	-125, 50, 91, 36, -95, 28, -90, 93, 
+	61, 147, -16, 116, 61, 29, 6, -97, 
+	43, -57, -27, 64, -10, -93, 32, 26, 
+	32, -4, 100, 151, 112, -47, 118, 71, 
+	30, -26, 15, 114, 109, 18, -49, -29, 
+	133, -94, 150, -5, -36, 124, -22, 106, 
+	97, -81, 37, -45, -7, 179, 93, 51, 
+	-50, 38, 48, 199, -68, 65, 13, -87, 
+	40, 22, -50, 120, -103, 65, -58, -16, 
+	-90, -29, -90, 106, 36, 33, 245, -22, 
+	-60, 61, -97, -16, 65, 44, -82, 91, 
+	64, 198, 72, 212, -53, 67, -15, 18, 
+	-147, 287, 101, 253, 32, -33, -129, -1, 
+	87, -148, -1, 85, 155, 113, 34, 142, 
+	-45, 76, -37, -76, 99, 79, 31, -11, 
+	-39, -140, 84, 108, 8, -45, 99, -50, 
+	4, -70, 9, 68, -19, 60, 42, 32, 
+	77, 29, -6, 122, 4, -115, 68, 73, 
+	-34, -50, -58, 32, 11, -148, 83, -38, 
+	54, -100, 13, 97, -88, -35, -83, 42, 
+	21, -40, 7, 6, 77, 49, 73, 60, 
+	-72, 126, -4, 20, -76, 97, 32, 23, 
+	-146, 36, 31, -64, -80, 123, -83, -66, 
+	82, -47, 47, -49, -51, -26, -27, 17, 
+	174, 140, -56, 108, -9, -44, 47, 42, 
+	44, -18, -9, -20, -56, 61, -35, -10, 
+	-18, 38, -67, -101, 39, 87, -46, -80, 
+	-17, 20, -29, 156, 34, 97, 31, -76, 
+	-37, -68, 68, 36, -43, 115, 63, 47, 
+	27, -19, 30, -64, -68, 16, 165, 102, 
+	-125, 68, 107, 72, 91, -15, -72, 66, 
+	87, 26, 108, 143, 136, 16, 77, 64, 
+	-115, -104, 87, -2, 80, 39, -5, -110, 
+	11, -27, -16, -50, -92, 26, 12, -17, 
+	-63, -129, -133, 49, -22, 16, -49, 166, 
+	71, 13, 35, -35, -63, 39, -42, 38, 
+	-29, -6, -65, 37, -111, -63, -72, -30, 
+	-65, -85, -58, -89, 85, 64, 6, 66, 
+	4, 49, 11, 35, -61, -108, -87, -5, 
+	-37, -87, 94, -68, 13, 80, 22, 12, 
+	69, 38, -90, 95, -19, -33, 99, -67, 
+	-79, 44, 118, 47, 25, 32, 21, -54, 
+	20, -135, -148, 137, 25, 49, -113, 58, 
+	15, 89, -50, 181, 16, 26, -4, -15, 
+	45, 58, 30, -25, -52, 164, 143, 10, 
+	-55, 21, -92, -90, -43, 93, -50, 15, 
+	-7, -10, 21, 156, -70, -69, 11, -30, 
+	53, 42, 14, 13, 79, -50, -115, -26, 
+	68, -14, 55, 47, -29, 42, 21, 80, 
+	45, 100, 53, 2, 24, -39, -50, -55, 
+	52, -103, 97, 140, 123, 42, 80, 22, 
+	-42, 94, 48, 62, -1, 39, 149, 76, 
+	-71, -54, 13, -10, -58, 46, 12, -47, 
+	142, 71, 33, 87, 84, -62, -7, 34, 
+	87, -50, 12, -38, -51, -70, 18, -40, 
+	-38, 38, -19, 52, -82, -15, 28, -29, 
+	-56, 44, 87, -101, 161, -5, 5, -85, 
+	43, 10, -4, 63, -118, 64, 80, -9, 
+	145, -170, -22, 86, 27, 2, -63, -79, 
+	47, -10, -44, 1, 16, 19, 177, 0, 
+	-57, 43, 45, 8, -256, 79, 51, 20, 
+	-4, -7, -104, -7, -81, -98, -128, 33, 
+	150, -56, 118, -111, -27, 115, 92, -30, 
+	33, -100, 62, 22, -33, 156, 1, 87, 
+	-21, -41, -44, -34, -60, 47, -16, 18, 
+	201, 54, -98, 16, -37, -116, -96, 84, 
+	-174, 92, 170, -167, 61, 44, -102, 27, 
+	-166, 89, 62, -66, 29, -10, 40, 67, 
+	-161, 22, -13, 50, 74, -76, -35, -8, 
+	76, -80, 101, 65, -107, 69, -38, -47, 
+	-46, -44, -71, 39, -14, -57, 40, 121, 
+	-11, -48, -28, -29, 69, -40, -7, 47, 
+	68, -14, 127, -85, -70, 36, -106, 10, 
+	75, 63, -89, -30, -9, 23, 74, 185, 
+	105, 105, -27, 19, -96, -15, -14, 22, 
+	-30, 1, -81, -170, 113, 74, -99, -5, 
+	111, 134, 58, 41, -160, -91, 71, -80, 
+	-88, 113, 188, 91, -60, 149, -107, 30, 
+	-112, 86, -28, 96, -102, -5, -31, 101, 
+	-38, 147, 23, -173, 125, -167, -84, 62, 
+	30, 96, 134, 25, -128, -52, -116, -184, 
+	-124, 126, 79, 100, 4, 6, -13, 12, 
+	-4, 234, 158, 43, -43, 14, 66, -15, 
+	60, -210, -97, -122, 21, 41, -110, -102, 
+	-22, -135, 111, -24, 33, -6, -52, -68, 
+	-28, 88, 43, 121, 85, 61, -17, -160, 
+	168, -98, 64, -10, -236, -12, -81, -77, 
+	-69, -30, -169, -118, -42, 98, 20, -84, 
+	9, -37, -13, 107, 0, 76, 54, -58, 
+	-16, 77, -119, -31, 63, -52, 4, 69, 
+	127, -61, -17, -89, 8, -53, 94, -86, 
+	-71, -56, 25, -119, -130, 123, -110, -124, 
+	-22, -53, -2, 10, -131, -99, 71, -73, 
+	-215, 27, -33, -105, 74, -28, -201, 34, 
+	-37, -55, 145, -63, 50, -23, 2, -130, 
+	45, 43, -66, -45, -130, 15, -1, 16, 
+	39, -48, -107, 105, 82, -54, -43, -200, 
+	68, -10, -69, 174, 64, 81, -108, 100, 
+	-64, -83, -103, 36, -108, -68, 45, 14, 
+	-81, 10, -78, 49, 42, 71, -6, -66, 
+	-9, -114, 50, 34, 154, 36, 101, 41, 
+	63, -14, 12, -39, 48, 65, -41, -4, 
+	37, -103, 134, 21, -29, -74, -35, -97, 
+	94, 149, 98, 107, -14, -48, -54, 66, 
+	-10, 50, 23, 114, -6, 76, -107, 33, 
+	-62, 79, -77, -34, 17, -174, 31, -133, 
+	-131, -82, -119, -4, 40, 23, -14, 106, 
+	63, 75, 61, 89, 53, -90, 41, -12, 
+	60, 225, -79, -36, 205, 92, -39, -85, 
+	17, 82, -68, -28, 12, 0, -108, 150, 
+	30, -57, 29, -100, -36, 96, 21, -82, 
+	2, 18, 45, -85, -117, -42, -2, -148, 
+	-54, 64, -163, 67, -114, 3, -16, 16, 
+	-18, 67, -30, -126, -23, 6, 42, 18, 
+	14, -28, 34, 21, 57, -85, -9, -59, 
+	30, -32, -40, -63, 52, 72, -12, 21, 
+	-23, -197, -3, -169, 112, -83, -8, -91, 
+	-49, -4, -168, -73, -72, -65, 36, 42, 
+	26, -56, 116, -132, -64, 22, -2, 26, 
+	-58, 10, 60, 69, -20, -33, -88, -40, 
+	-7, 65, 64, -102, 64, -34, 78, -75, 
+	10, 62, 174, 68, -57, 115, -101, -132, 
+	-123, -4, 3, 94, -79, -54, 127, -64, 
+	81, 37, 2, 30, -104, -114, 67, 114, 
+	-47, -125, -99, 130, 86, 90, -61, 52, 
+	-6, 38, 80, 78, 135, 123, -11, 12, 
+	23, 44, 42, -55, -48, -115, -24, -5, 
+	-71, 154, -99, 34, 62, 79, 87, -34, 
+	-13, -95, -29, 90, -18, -8, 96, -110, 
+	60, -32, 41, 9, 104, 37, 3, -78, 
+	53, -72, 111, -83, 119, -58, 7, -106, 
+	54, 279, -19, 128, -35, 12, -135, 47, 
+	-13, 244, 96, 153, -28, 70, -36, -49, 
+	120, 40, -20, -44, 7, -88, -47, 1, 
+	111, -48, -111, -83, 121, 49, -17, 56, 
+	-54, 51, -119, 16, -23, -74, 36, 29, 
+	-108, 14, -17, -45, 12, 14, -126, 59, 
+	-101, 126, -145, -45, -82, -6, -55, 0, 
+	-82, -45, -92, -55, -36, -40, 61, 30, 
+	-122, 43, 28, -42, -10, -48, 72, -45, 
+	64, -48, -53, 3, 24, 115, -13, -34, 
+	67, 62, -61, -74, -86, -92, -19, -22, 
+	70, -75, 8, 10, -114, 76, 21, -57, 
+	41, -115, 99, 73, 41, 26, -46, -109, 
+	29, -48, -17, -14, -46, 22, 92, -40, 
+	-3, 187, -186, 37, 60, -80, 9, -53, 
+	-108, 111, 2, 62, 65, -106, -33, 85, 
+	-3, -14, -2, 38, -77, 2, -16, -69, 
+	-140, 58, 10, 37, 40, -67, -35, -74, 
+	113, -194, -134, -93, 61, -41, 12, -55, 
+	50, -22, -32, 22, 28, 52, -71, 25, 
+	43, -138, 75, 81, -75, 33, 34, 92, 
+	39, -80, -94, 126, 23, -47, 2, -36, 
+	28, -64, -37, -7, 45, -27, -4, 64, 
+	-55, -81, -70, -71, -36, -58, -68, 74, 
+	3, 88, -1, -53, 120, 84, -83, 18, 
+	46, 6, -50, 6, 33, 29, 57, -15, 
+	7, -23, 69, -67, -36, 67, -34, 44, 
+	14, 57, 98, 123, -9, -9, -47, -10, 
+	-10, -86, 34, 34, 0, 24, 10, -34, 
+	31, -53, 96, 16, -95, 22, -30, -8, 
+	14, 69, -35, 57, -106, 79, 101, 114, 
+	114, -64, 91, -146, -12, -60, 17, -1, 
+	-47, -74, 1, -153, -52, 2, -47, -111, 
+	-62, -54, -19, 126, 36, -169, 87, -134, 
+	-154, -3, -98, 106, -40, 63, 13, -20, 
+	-149, -55, 56, 35, 24, 71, -73, 134, 
+	109, -3, 9, 30, 46, 24, -86, -35, 
+	46, -28, 49, -6, 80, 1, -69, -178, 
+	-9, -47, 74, -87, -10, -13, -41, 20, 
+	-36, -111, -89, -95, -143, 54, -45, -49, 
+	-30, -55, -93, -65, -65, 62, -126, -20, 
+	86, -48, -119, -63, -98, -69, -41, 22, 
+	-27, -51, 25, -97, 47, -128, 52, -144, 
+	61, -125, 90, -26, 20, -215, -48, -51, 
+	36, -37, -57, 53, 59, -14, 84, -7, 
+	91, -73, -1, 9, 43, -60, 6, -48, 
+	24, 4, 3, -100, -168, -53, 24, 97, 
+	-9, -31, -94, 76, -5, 30, 55, -29, 
+	44, -43, -29, -30, 56, 57, 8, -38, 
+	56, -100, 166, 90, 42, -61, -121, -115, 
+	52, -94, -59, 18, 64, -37, -18, -92, 
+	70, 44, -149, -30, 92, -112, -61, -75, 
+	-32, 68, 68, 48, 83, 63, 26, 26, 
+	23, 71, -8, -45, 83, 21, 22, 40, 
+	53, 95, 12, -91, -92, 134, 96, 73, 
+	33, -57, 71, -87, -73, 165, -88, 15, 
+	54, -130, 32, -85, -3, 91, 126, 30, 
+	68, -71, 98, -148, -29, 20, 177, 52, 
+	-80, 21, -212, 40, 82, -98, 68, -11, 
+	35, -18, 54, -43, 29, -17, 74, -40, 
+	-15, 77, 50, 21, -5, 10, -107, -48, 
+	70, 111, 178, 103, -68, 48, 18, -46, 
+	74, 144, -91, -39, 1, -14, -58, -70, 
+	73, 63, 37, -23, -61, 9, 18, -1, 
+	31, -37, 29, -35, -64, -80, 129, -53, 
+	-81, -71, -59, -140, -236, -107, -39, -77, 
+	-35, -80, 130, -42, -60, 102, 106, -56, 
+	-99, 73, 43, 36, 21, 136, -8, -11, 
+	40, -139, 61, 77, 56, 8, 82, 1, 
+	-68, -116, -205, -66, 30, -3, 104, 66, 
+	-16, -7, -70, -20, -35, 117, 78, -203, 
+	80, 112, -76, 75, -44, 49, 18, 122, 
+	21, -125, 9, 26, -5, 41, 59, 87, 
+	111, 14, -100, -56, -19, 18, 43, 40, 
+	-97, -43, -16, 8, -4, -6, -68, 75, 
+	-12, 69, -145, 7, -82, -15, 38, -138, 
+	66, -59, -48, 71, -102, 107, -101, 21, 
+	-19, -84, -58, 0, 78, 85, -66, 29, 
+	64, -44, 19, 128, 1, -46, 35, -9, 
+	-79, 5, 23, 93, 54, -37, -113, 9, 
+	-31, 131, -40, -67, 0, -37, -67, 37, 
+	53, 24, -80, 162, 30, 173, 116, -8, 
+	19, -5, 82, 2, -97, -33, 116, 96, 
+	49, 77, 5, 58, 60, 1, -47, -27, 
+	59, -94, 4, 36, -77, -3, 56, 130, 
+	95, -74, -70, -102, -7, -41, -124, 65, 
+	57, -40, -32, -134, 106, 98, 49, -8, 
+	-39, 105, 75, 90, 30, 93, 62, -13, 
+	-154, -62, -62, -26, 80, -77, -180, 71, 
+	-24, 26, 74, -30, 88, -92, 38, 54, 
+	-71, 79, -24, 17, 45, -55, -70, 33, 
+	95, -93, -63, -5, 17, 130, -40, -56, 
+	25, 38, 32, 8, -20, -93, 18, -99, 
+	18, -79, 179, 80, 4, -105, -120, 0, 
+	-88, 10, -8, 108, 113, 8, -75, -37, 
+	4, 19, -75, -24, -92, -10, 80, 7, 
+	102, 40, -124, 9, -31, -63, -183, 101, 
+	68, -120, -17, -52, 24, 54, -103, 53, 
+	101, 7, 108, -20, -20, 94, -83, -19, 
+	68, -113, -8, -87, -146, 24, 138, 7, 
+	-96, 26, 109, -18, -188, -67, -12, -114, 
+	-70, 78, -2, 89, 28, -25, -62, -50, 
+	-25, -12, 44, -64, 70, 96, 94, 10, 
+	-128, -10, -81, -66, 94, 97, -110, -12, 
+	115, -134, 44, -118, 60, 133, -46, 21, 
+	11, 28, 56, -86, 144, 24, 52, -41, 
+	3, -27, 27, -75, 77, -19, 132, 114, 
+	-32, 76, 2, -90, -40, 93, -12, -90, 
+	-49, 9, 90, -46, 111, -31, -35, 68, 
+	-45, 85, 83, -48, -82, 1, -51, 154, 
+	139, 95, -225, -7, 38, 55, 26, -37, 
+	-20, -5, 69, -138, -40, 70, 56, 8, 
+	-89, 21, 52, 112, -20, -78, 89, -21, 
+	-71, 123, 15, -82, -125, 1, 31, 83, 
+	37, -222, 193, -52, 0, 69, 52, 0, 
+	-105, 14, 135, -41, 75, 174, -53, 36, 
+	-61, -77, 93, 19, -6, -47, 104, -106, 
+	-55, -115, -49, -74, -95, 126, -90, 58, 
+	-27, -40, -31, -14, 75, -63, 87, -56, 
+	18, 69, 85, 4, -24, 17, -47, 117, 
+	79, -84, 72, 64, -24, -26, -128, 30, 
+	-150, -42, -229, 43, -140, -15, -52, 105, 
+	37, -148, -39, 8, 63, 122, -70, 34, 
+	9, -21, 57, 116, 48, -126, -26, 105, 
+	-33, -198, -25, -53, -21, -106, -132, 8, 
+	50, -116, -21, -58, -35, -13, -61, -123, 
+	41, 99, 42, 110, -7, 130, -53, -45, 
+	-12, 82, -109, 97, -93, -9, -93, -58, 
+	-34, 62, 21, 44, 30, 67, 19, 1, 
+	20, -77, -45, 197, -137, 161, -86, -89, 
+	57, -3, -74, 37, 106, 106, 74, -107, 
+	-46, -38, -28, 67, 10, -70, 48, -73, 
+	33, 60, 1, 97, -94, 52, 63, 45, 
+	58, 11, 13, -125, 15, -101, 39, 10, 
+	-9, 56, -111, -115, -51, 5, -3, -6, 
+	71, 86, -35, 33, -61, -28, -60, -35, 
+	-63, 135, 71, 91, -7, 32, 128, -32, 
+	-72, 79, 34, -22, -48, -47, -5, 48, 
+	132, -92, 3, 89, -16, -141, 50, -30, 
+	3, -36, -34, -26, 4, -97, -43, -43, 
+	38, 48, -134, 101, 47, 5, 78, -68, 
+	-151, -177, -3, -125, 42, 101, -33, -49, 
+	-81, -94, 31, -49, 56, 51, -1, 85, 
+	-23, -60, -83, 57, -111, -141, 69, -5, 
+	65, -107, 35, -70, 111, -26, 67, -30, 
+	-59, -131, -5, 37, 25, -3, 19, -64, 
+	-33, -105, -35, -12, -114, -62, -9, 25, 
+	60, 204, -66, 34, 91, 28, -89, 179, 
+	-19, -47, 3, -32, 51, -51, 61, 14, 
+	-80, 131, -42, 97, -81, -6, 98, 88, 
+	86, 13, -132, -7, -94, -141, -61, 43, 
+	-141, 6, 106, -94, -18, -80, 19, -25, 
+	-87, -26, -35, -122, 8, 56, -12, 22, 
+	-34, 93, -61, -1, -102, -9, -8, -14, 
+	61, 17, 55, 70, 17, 38, 2, 0, 
+	-125, 74, -71, -139, 30, -4, -70, -93, 
+	-136, -50, 19, -6, -54, 83, -49, -67, 
+	144, -30, 83, -25, 42, -14, -163, 9, 
+	17, -206, 50, -160, -53, -59, 113, 88, 
+	106, 33, -96, -151, 9, 106, 61, -67, 
+	9, 51, -36, -39, 79, 92, -81, -36, 
+	-8, -61, 82, -36, -139, 96, 6, 23, 
+	17, -3, 10, 54, 58, -30, -36, -97, 
+	87, 13, 131, 52, -15, -40, 17, -120, 
+	67, 63, 46, -113, 80, 33, -111, -37, 
+	-22, 121, 26, -185, -93, -85, -10, -52, 
+	-10, 41, 65, 83, -132, 34, -26, -74, 
+	-72, 2, -63, 115, -65, 73, 88, 6, 
+	68, -80, 24, 37, -17, 44, 88, -78, 
+	-82, -166, -77, -171, 34, -5, -104, -2, 
+	-118, 18, 42, 79, -135, 8, -50, -13, 
+	-18, -9, -56, 28, -142, -63, 38, -157, 
+	-63, 26, -31, -91, 86, 149, -13, -45, 
+	71, 57, -44, -30, -24, 46, -21, 111, 
+	-49, -62, 8, -10, -32, 143, -9, -73, 
+	109, 25, 95, -88, -49, 107, 59, 71, 
+	72, 3, -34, 66, -10, -117, 32, 4, 
+	29, -26, 53, 43, -166, 47, -41, 80, 
+	22, 22, 4, 71, -60, 86, -59, -62, 
+	66, 23, 123, -8, -92, -61, 40, 69, 
+	-35, 14, -37, -33, -45, 86, 70, 36, 
+	142, 33, 48, -47, -34, 137, -41, -34, 
+	-3, -76, 254, -36, 10, 120, -55, 133, 
+	26, -79, 60, 85, -117, 147, 172, -136, 
+	20, -6, -31, 13, -14, 141, -4, -99, 
+	-9, 80, 0, -95, -118, 0, 164, 17, 
+	-7, 40, -20, -60, 1, 29, 51, -51, 
+	-53, -16, -11, -16, -65, -15, 106, -72, 
+	31, -6, -69, -33, 21, 114, -45, 102, 
+	-37, 50, 103, 120, 90, -24, -27, 55, 
+	16, -69, 32, -85, -24, 20, -28, 270, 
+	-10, 36, 58, -63, 87, -92, 117, -29, 
+	36, -64, -4, 59, 31, 42, 58, -70, 
+	92, -30, -8, 0, 145, -92, -22, -22, 
+	38, -54, 36, -46, -40, -93, 89, -104, 
+	22, -11, 268, -107, 2, -11, 43, 80, 
+	84, 76, -93, -31, 33, 36, 109, 102, 
+	47, -70, -5, 39, -150, -7, 0, 79, 
+	-34, 49, 92, -91, -122, -59, -50, 41, 
+	19, -117, -115, -210, 71, -117, 24, -20, 
+	-100, 26, -46, -130, 80, 51, -95, -78, 
+	-72, -106, -132, 101, -10, -166, -96, -84, 
+	94, -24, -11, 19, -126, 85, -159, 66, 
+	-142, 71, -71, -243, 111, 98, 14, -51, 
+	-37, -85, 54, 58, 57, -94, 128, 126, 
+	0, -100, 190, -126, 20, 177, 42, -11, 
+	197, 60, -33, 89, 32, -43, -30, 30, 
+	98, -68, 7, 20, 39, 77, 37, -51, 
+	-95, 88, 11, -182, 52, 140, 111, 199, 
+	-136, -42, 43, 57, 37, 99, 114, -73, 
+	-110, -28, 139, -35, 3, -23, -56, 2, 
+	-86, -35, 90, -52, -45, -14, -87, 13, 
+	19, -36, -55, -22, 95, -92, 30, 142, 
+	-30, 76, 107, -52, 30, -71, -140, -90, 
+	71, -8, 20, -84, -67, 18, 76, -61, 
+	165, 76, 16, -64, -70, 103, -67, -207, 
+	70, 95, -47, -83, -55, 79, -115, -178, 
+	-24, 51, -33, 77, 233, 57, -80, 30, 
+	93, -73, -49, 122, -20, -28, 31, -121, 
+	-43, 18, 47, 36, 86, -82, -72, -6, 
+	8, 3, -108, 105, 86, 77, -16, 6, 
+	-34, 8, 69, -76, 141, -87, -40, -73, 
+	-47, -61, -24, 124, -98, -64, 29, -61, 
+	76, 56, -131, 24, -101, 25, -38, 80, 
+	11, 55, -77, 69, -73, -41, -12, -1, 
+	-48, -139, -73, 12, 14, 62, 92, 64, 
+	13, 36, 57, -39, 61, -67, -16, 40, 
+	125, 85, 170, 61, 47, -11, -36, 9, 
+	23, 28, 10, -76, 42, 35, 41, 6, 
+	-114, 47, -88, -14, 29, 102, 46, 25, 
+	-12, 55, -35, 99, 7, -21, -96, 67, 
+	-51, 66, -73, 150, 15, 28, 28, 69, 
+	63, -3, -86, 2, -2, -133, 120, 159, 
+	55, 38, -16, 79, 41, 12, 44, 68, 
+	42, 73, 23, 30, 115, -24, 8, 114, 
+	55, 5, -71, 9, 1, 139, 112, -8, 
+	24, 11, -86, 83, 20, 18, -94, -47, 
+	67, 176, 2, 139, -66, 87, -3, 32, 
+	19, -31, -23, 36, 136, 68, 175, -143, 
+	-48, 32, -68, 10, 36, 44, 7, 68, 
+	10, 127, 59, 146, -76, -96, 25, 94, 
+	-141, 82, -101, 143, 7, 93, -68, 49, 
+	135, -174, -90, 140, 101, 3, 270, 31, 
+	-108, -3, -14, 83, 180, 47, 37, 93, 
+	-106, -132, 102, 67, -35, 30, 156, -153, 
+	10, -34, 91, 36, -16, 1, -95, 16, 
+	-107, 85, -43, -2, -27, -85, 48, -8, 
+	-49, -75, -16, 59, -70, 2, -47, -128, 
+	7, 28, 59, -99, -50, 30, -29, 42, 
+	24, -2, -97, 44, 68, -40, 24, -14, 
+	34, -10, -19, -75, 50, -44, 28, -85, 
+	63, 17, -76, -59, -51, 83, -4, -36, 
+	-32, -78, -28, 47, 6, -14, -14, -119, 
+	-110, 13, 65, 52, 72, -99, -91, -125, 
+	24, -87, -63, 69, -53, -95, 21, -45, 
+	21, 63, 40, 53, -81, 41, -88, -49, 
+	-81, 29, 59, -22, 7, 23, -60, -30, 
+	-44, 80, 47, -52, 49, 42, -49, 14, 
+	-69, 69, -76, -37, -5, -29, -43, 17, 
+	-59, -78, 57, 72, -83, -53, -37, -31, 
+	48, -34, -100, 65, -23, 82, 48, 14, 
+	-7, -100, -82, 51, 14, 74, -34, -78, 
+	-89, -25, -61, 33, -52, -12, -23, -43, 
+	-68, -29, 57, 82, -15, -118, -41, 35, 
+	-11, 90, -79, -25, -69, -62, -55, -36, 
+	-57, 61, 48, -151, -88, -99, -45, -30, 
+	-46, -88, -1, -50, -47, 27, 6, 18, 
+	11, -52, 2, -33, -75, -116, -59, -90, 
+	24, -68, -18, -47, -128, 22, -37, -99, 
+	-87, 36, -85, 1, -8, -94, -26, 17, 
+	37, 50, 73, -94, 12, -75, -50, -44, 
+	-40, -81, 25, -39, 38, -67, -52, -71, 
+	60, -56, 12, 55, -116, -114, 64, 67, 
+	-95, 47, 20, -7, -69, -82, -85, -12, 
+	47, -75, 48, 7, -10, -63, 21, 89, 
+	-49, 70, 61, -84, -8, -41, 53, -27, 
+	-33, 11, -79, 71, 1, -28, -56, 22, 
+	-97, -17, -56, 83, 40, -46, 19, 34, 
+	25, -32, 4, -98, 13, -101, -100, -15, 
+	26, -86, -61, -95, 39, -3, 42, 56, 
+	-39, 7, -104, -20, -56, -113, -64, -88, 
+	-44, 52, -117, 20, -9, -61, -105, -16, 
+	-27, -46, -118, -56, -124, 20, -83, -31, 
+	-61, 42, -22, -58, -62, -91, 48, -66, 
+	0, -48, 5, 2, 41, -79, -100, -53, 
+	-56, 78, 2, -70, -77, 61, 58, -12, 
+	1, -108, 8, -87, -49, 31, -21, -127, 
+	38, 56, 8, 43, -83, -18, 12, -26, 
+	10, 58, 30, -45, -48, 5, -99, 16, 
+	-1, -19, -86, -91, -58, -73, -72, 37, 
+	80, 63, 54, -11, -5, -85, -79, -7, 
+	45, 30, 63, -17, 53, -44, -9, 58, 
+	-67, -122, -87, -82, 34, -124, -109, -56, 
+	-93, 65, -42, -57, -99, 15, 33, -86, 
+	-16, -104, 20, -81, -21, 28, -45, 0, 
+	-97, -103, 55, -100, 62, -65, 73, -89, 
+	52, -13, -10, 18, 24, -82, 28, 2, 
+	-92, -47, -68, 19, -31, -86, 13, -65, 
+	13, -27, 15, 40, -75, 20, 49, -29, 
+	47, 54, -81, -23, 55, -51, -86, -50, 
+	-36, 4, 74, 18, -82, 52, -9, -80, 
+	-50, 23, -17, 75, 10, -84, 53, 5, 
+	8, 50, -1, 66, 19, 60, 34, -34, 
+	-41, 54, -74, -71, 26, 28, -67, 23, 
+	53, -89, 18, 24, 17, -3, -51, -46, 
+	-95, -69, -43, -79, -83, 42, 41, -13, 
+	72, 61, 16, 13, -62, -112, -28, 29, 
+	-81, 17, -31, -49, 37, -12, 71, 20, 
+	11, -58, -17, 3, -17, -83, 63, 25, 
+	1, -10, -120, -84, -43, -75, -50, -84, 
+	-110, -98, -91, -27, -64, -20, -18, -59, 
+	-83, 18, -104, -92, -26, -3, -15, -75, 
+	71, 6, -27, -57, -65, -100, -24, -12, 
+	-84, -87, -9, 75, -65, 28, -66, -28, 
+	-34, -8, -67, -79, 25, -87, 23, -17, 
+	-37, 2, 23, 41, -7, 58, -57, -46, 
+	49, 34, 37, -32, -23, -33, 40, -18, 
+	51, 108, -69, -128, 96, 6, -36, -34, 
+	52, -89, 11, -34, -75, -90, -89, -36, 
+	-22, -61, 37, 73, 27, 8, 118, 3, 
+	119, 89, 97, -35, 62, -75, -64, -31, 
+	-30, -8, 41, 26, 148, -21, -23, -75, 
+	115, 53, 87, 75, 8, -27, 44, 17, 
+	122, 108, 104, -81, 42, -111, 79, -76, 
+	42, 59, -104, 44, 94, -100, -71, 26, 
+	-91, 38, -107, -125, -32, -103, 37, 3, 
+	21, 114, 176, -85, 18, -27, -48, 34, 
+	-59, -112, 26, 82, 122, -65, -90, 28, 
+	-89, 117, -57, -30, 89, -27, 14, -42, 
+	-122, -4, -106, 143, 177, 14, 45, 44, 
+	-19, 141, -82, -25, -48, -4, -179, -66, 
+	-32, 84, -134, -86, 96, -18, -61, 14, 
+	101, -3, 75, -99, 29, -105, -65, -90, 
+	2, 118, -61, -119, -42, -87, -43, 46, 
+	-100, 4, 158, 74, -81, 84, -51, -162, 
+	-1, -45, 35, 59, 50, 66, -94, -104, 
+	-9, -29, -17, -112, 3, 2, 14, 40, 
+	29, 39, 31, 41, -66, -64, -35, -24, 
+	-82, 213, 71, -17, -28, 65, -70, 54, 
+	-162, 22, -2, -104, -9, -67, 37, 96, 
+	-98, 72, -4, 66, -27, 47, -36, -41, 
+	-40, 42, 5, -37, -18, -36, -5, -50, 
+	69, -154, -94, -81, 70, 31, 49, 63, 
+	-84, 149, 70, 118, 63, -39, -9, 88, 
+	9, 116, -44, -42, 86, -87, -174, 28, 
+	-10, -24, 37, 55, 161, -45, 50, 52, 
+	88, -106, 47, 122, 111, -39, 8, -22, 
+	-63, 79, -29, 37, 25, 2, -67, -42, 
+	-6, 23, -17, -67, 61, 59, -2, 91, 
+	66, -88, 2, -7, 46, 47, -129, -13, 
+	-50, -118, -89, -73, -8, -28, 53, 134, 
+	27, 4, 18, 3, -52, -15, 43, 16, 
+	24, -85, 54, 32, 17, -15, -170, -164, 
+	179, 116, -51, -44, 156, 116, -56, -67, 
+	-134, -10, 4, 13, -84, 102, -67, 69, 
+	116, -5, -43, -83, 26, 75, 94, 15, 
+	-53, 30, 113, 38, -15, -85, -98, 73, 
+	-6, 58, 16, 50, -143, 11, -51, -52, 
+	-78, 22, -88, -73, 89, 8, -48, 19, 
+	-164, 2, 31, -26, 33, 61, -39, 161, 
+	13, 46, -91, 161, 50, 10, -49, 42, 
+	25, 134, 46, -42, 73, -29, 53, 12, 
+	17, 103, 11, -10, -29, -4, 86, -61, 
+	-13, -27, -101, -53, -138, 13, -47, 27, 
+	-29, -71, 35, -28, 66, -52, -9, 21, 
+	40, 51, -127, 33, 68, -136, 52, -78, 
+	66, -157, 158, -66, 127, 213, -57, 115, 
+	138, 77, -85, 190, 57, 70, -86, -80, 
+	71, -24, 95, 25, -9, -104, 60, -1, 
+	80, -5, 22, -89, 145, -20, 57, 53, 
+	76, -20, -142, 2, 119, -25, -34, 34, 
+	110, 46, 107, 127, 9, 39, -34, -57, 
+	146, -17, 16, 84, -24, -8, -79, -13, 
+	-20, 20, -173, 105, -103, 41, 38, 100, 
+	-41, 47, 75, 143, 30, -112, -148, -59, 
+	7, 85, 71, -11, -84, -113, -13, 71, 
+	14, -6, 53, 35, 39, -163, 12, -99, 
+	-138, 43, -101, 95, 23, -42, -32, 23, 
+	-1, -160, -156, 108, -28, 24, 59, 75, 
+	-55, 128, -177, -97, 63, 118, 42, -43, 
+	-6, -170, 102, -16, -165, -56, -15, 64, 
+	-22, 188, -91, 79, 151, 18, 141, 17, 
+	-6, -49, -16, -49, 46, -63, 18, -84, 
+	12, -82, 34, -7, 5, -51, -139, 32, 
+	-105, 85, 128, 96, 6, -14, 79, 107, 
+	95, 204, -16, 28, -74, 0, 221, -65, 
+	41, 89, -48, -20, -24, -39, -41, 116, 
+	-133, 16, 46, -1, 186, 81, 74, 205, 
+	-38, 121, 27, 59, 5, 27, 20, 188, 
+	38, -22, 6, -22, -35, -1, -24, 9, 
+	-53, 80, 80, -18, 129, -92, -30, 88, 
+	-63, 18, 73, 36, 65, 71, 63, 110, 
+	29, -9, 36, 194, 61, -43, 145, -3, 
+	59, -70, 62, 124, 40, 57, -49, 66, 
+	138, -180, -44, 89, -41, 93, 165, 33, 
+	118, -32, -73, 176, -51, -1, 108, -7, 
+	-20, 32, 115, -25, 28, 71, -82, 15, 
+	-27, 59, 151, 5, 82, -25, 46, -62, 
+	-81, -90, 132, -41, 47, 11, 45, -122, 
+	10, 26, 102, -84, -103, 104, 1, 31, 
+	83, -9, -5, 123, -70, -58, -42, -6, 
+	74, -6, 34, -55, 34, -74, 91, -61, 
+	80, -111, 52, -66, -92, 63, -60, 9, 
+	61, 91, 98, -48, -75, 93, -31, 56, 
+	-95, 50, 63, -39, -34, -89, 44, -54, 
+	63, 131, -135, -114, -30, -122, 27, -9, 
+	-66, -12, 67, -9, -124, -17, 12, 93, 
+	47, 7, -107, 62, -54, -130, -72, -164, 
+	41, 32, 58, -29, -33, 114, -94, -90, 
+	57, -47, 84, 67, 214, -29, 50, -51, 
+	47, -103, -2, 53, 15, -56, 66, -13, 
+	26, -11, 163, -5, -46, 108, -103, 42, 
+	-74, 41, 13, 38, 51, 24, -55, 36, 
+	-54, -14, 28, -82, -64, 125, 92, -56, 
+	158, -97, -81, 33, -103, 85, -58, 51, 
+	53, -56, -8, -148, 67, -111, -44, 20, 
+	-85, 58, 8, -66, 74, 43, -7, -65, 
+	-88, 123, -82, 19, 0, -97, -127, -10, 
+	134, -67, -14, 132, 53, -25, -45, 125, 
+	-82, 78, 44, -83, 56, -18, -42, -7, 
+	-47, 63, -77, -46, -41, -33, 59, 31, 
+	-93, 73, 58, 106, -73, 1, 8, 75, 
+	207, 87, 32, -95, -67, -23, 116, -48, 
+	31, 86, -35, 38, 17, 38, 103, -65, 
+	9, 10, -31, -62, 47, -103, -66, 110, 
+	-21, 68, -99, -55, -74, 78, 29, 15, 
+	-53, 32, 10, 78, 78, 82, 46, -52, 
+	-134, 109, 132, 18, -16, 90, 7, 142, 
+	57, -93, 53, -29, 108, -87, 12, 72, 
+	62, 47, -156, 88, -17, -75, -77, 81, 
+	-84, 118, 29, -65, -32, 27, 91, -133, 
+	-7, 197, 60, 119, -103, -48, -14, 60, 
+	38, -217, 87, 28, 58, -45, -19, 24, 
+	-21, -55, -4, -51, -4, -40, 60, 15, 
+	-116, -6, 94, 175, 56, 133, 177, -50, 
+	-122, 113, -21, 31, 27, -17, 9, 101, 
+	-8, 81, -41, 121, -34, 87, 39, -78, 
+	74, 23, 16, -21, 9, 10, -31, -38, 
+	-149, -59, 138, -78, -1, 88, 56, 74, 
+	87, 53, -106, 29, -107, 13, -91, 46, 
+	28, -16, 57, -13, 17, -7, -48, -1, 
+	124, -142, 14, 49, -58, 34, 107, -5, 
+	-26, 151, -91, -91, 36, 22, -74, 64, 
+	112, -36, -57, 98, -25, -51, -89, -60, 
+	63, -56, 83, -38, 65, -70, 8, 22, 
+	28, 48, -138, 69, -85, 80, -92, 4, 
+	60, -115, 31, -115, -73, 2, -23, 8, 
+	41, 58, -40, -2, -51, -57, 6, -49, 
+	48, -91, -7, 38, -18, 46, -122, -77, 
+	-76, 52, -26, -32, 16, 37, -86, -48, 
+	16, -7, -25, -55, 139, 44, -112, 70, 
+	91, -43, -33, -32, 25, 2, -39, 104, 
+	-10, -84, -123, 61, -76, 41, 73, -75, 
+	-71, -28, 113, 1, 98, 47, -42, 82, 
+	-43, -194, -176, -6, 65, -5, 64, 82, 
+	-23, -58, 51, 58, 57, -31, 80, 73, 
+	92, 41, -30, -9, 111, -33, -21, 41, 
+	22, -51, 161, 17, -7, -77, -19, 35, 
+	-38, -145, -73, -114, 100, -94, 148, 55, 
+	23, 62, -286, 125, 55, -65, -22, 46, 
+	-103, -32, 75, 51, -114, 29, -102, -88, 
+	-29, 84, -36, -21, 90, 27, -8, -38, 
+	36, -40, -65, 92, -94, -86, -100, -101, 
+	-76, 68, -19, -61, -101, -87, -27, 5, 
+	23, 84, -30, 30, -8, 29, -21, 0, 
+	-49, 114, 38, 40, 200, -16, 13, -22, 
+	129, -207, 107, 44, -27, -19, 37, -86, 
+	-61, -36, -60, -9, -21, 70, 44, 55, 
+	-113, 64, -112, -59, 5, -76, 54, -61, 
+	-176, 92, -51, -30, -102, 35, -19, 65, 
+	92, 13, 24, -41, 48, -37, -54, 38, 
+	37, 85, -55, 19, 102, -13, -171, 18, 
+	-55, 90, 93, -21, 25, -120, -36, 115, 
+	-56, 132, -18, 39, 259, -74, 33, 66, 
+	11, -174, 72, 93, 127, -28, 31, -20, 
+	-2, 78, -43, 5, 107, 9, 55, 31, 
+	-21, 67, 142, 66, -26, -19, 27, 60, 
+	-26, -44, 88, -89, -123, 39, 5, 56, 
+	-26, 4, 93, -50, -18, 72, 142, -79, 
+	16, 16, 68, -67, -54, 24, 46, -45, 
+	5, 4, 83, 25, -28, -120, -16, -29, 
+	-184, -11, -71, 28, -128, -37, 62, 41, 
+	22, 15, 32, 58, -109, 76, 24, -69, 
+	-36, -49, 229, -83, -9, 22, 26, 50, 
+	-38, -164, 52, -46, -112, -187, 2, 18, 
+	67, -147, 279, 82, 85, 144, 134, -59, 
+	77, 48, -63, 43, 78, 68, 73, -20, 
+	-47, 19, -82, 78, 32, 11, 36, -36, 
+	94, -31, 85, 14, -4, 181, -165, 40, 
+	-108, 76, 94, -75, 17, 94, -3, 14, 
+	-34, 54, 59, 19, 28, -101, 65, 11, 
+	15, -44, -124, 150, 185, 56, -21, -58, 
+	95, -40, -57, 4, 19, -66, 121, 67, 
+	0, 36, 6, 42, 61, 29, 145, 93, 
+	16, -167, -70, -7, 44, -52, 169, 161, 
+	70, -22, -6, -38, -47, 23, 47, -25, 
+	-57, 81, -6, 115, -35, -7, -116, -39, 
+	190, -276, -83, 99, 30, -3, 74, 87, 
+	70, -40, 12, -59, 50, -41, -127, -21, 
+	-102, 140, 33, -71, 122, -125, 38, 89, 
+	-74, -27, 34, 58, 119, 56, 7, 38, 
+	59, -50, -34, -17, 104, 18, -108, -82, 
+	37, 31, 43, 41, 37, 14, -91, 143, 
+	-66, -45, -33, 53, -140, 9, 62, -4, 
+	-61, -132, -103, -168, 168, 109, -37, 102, 
+	143, -93, 35, -106, 83, 162, 11, -85, 
+	31, -31, 42, -171, -4, -28, -95, 68, 
+	32, -76, 92, 91, -126, 25, 19, -184, 
+	-140, 8, -73, 46, 4, -48, 75, -27, 
+	55, -8, 104, -6, 1, 95, 14, 58, 
+	-75, 27, 84, 117, 70, 194, 124, -47, 
+	42, -173, -72, 13, -2, -26, 76, -39, 
+	84, -72, -38, -56, -34, 40, 16, -117, 
+	40, 61, 103, 27, 43, 109, 151, 39, 
+	-4, 84, -173, -168, 200, -108, -6, 160, 
+	-37, 37, 53, -23, -60, -10, 86, -18, 
+	24, 4, -13, -11, 252, 31, 58, 35, 
+	-14, -84, 75, -32, -222, 106, -37, 103, 
+	-61, -15, 0, -46, -90, 98, -74, 79, 
+	168, 44, 25, 75, -17, 47, 4, -25, 
+	57, -65, -107, 46, -21, 105, 138, -109, 
+	77, -11, -55, 110, -17, 175, 55, 24, 
+	-82, 55, -60, -45, 52, 57, 126, 77, 
+	105, -52, -40, -60, -162, -51, 98, -128, 
+	32, 106, -18, 150, 117, -66, 92, -76, 
+	-87, 105, 117, -60, -175, -88, -47, -131, 
+	33, 110, -159, -59, -25, 58, 78, -101, 
+	-79, 109, 82, 80, 169, 53, 7, 23, 
+	53, -13, 11, 171, -25, 119, -20, -30, 
+	-146, 139, 97, 81, 64, -23, -148, 18, 
+	87, 55, -33, 114, 74, 62, 36, 24, 
+	-32, 44, 1, -16, -24, -104, -6, 3, 
+	51, 55, -99, 26, 31, -5, -121, -56, 
+	48, -73, 31, 4, -155, 103, -28, -52, 
+	28, -84, 47, 156, -34, -44, -18, 9, 
+	-14, -119, 95, 24, -155, -172, -46, -29, 
+	-76, 47, -35, -10, -107, 60, 106, 37, 
+	-128, 72, -103, -1, -106, -7, 17, -50, 
+	143, 107, -113, -98, -131, -4, 57, -43, 
+	-124, 42, 150, 17, -69, -55, -92, 54, 
+	-93, 1, -61, 18, 10, 33, -10, 29, 
+	111, -61, -4, 20, 27, 73, 95, -110, 
+	0, 15, 166, 43, 21, 22, -2, 54, 
+	-37, -46, -24, 30, -84, 65, -157, -78, 
+	89, 160, -45, -14, -132, 165, -34, 18, 
+	-42, -100, -44, -19, 31, -19, -28, -72, 
+	-73, -14, -272, -63, 16, -26, 16, 12, 
+	-66, -168, -97, -162, 14, -100, 92, 94, 
+	-27, 93, -137, -14, -20, 107, -17, 81, 
+	60, 52, -70, 33, 105, -44, -124, 87, 
+	127, -139, 173, -88, -56, 157, 113, 30, 
+	27, -33, -70, -43, 39, -106, -81, -146, 
+	-20, -130, 12, -64, 86, 108, -26, 42, 
+	12, 37, 237, -86, -193, -168, -12, 42, 
+	-45, -47, 15, -81, -13, -151, -55, -27, 
+	-11, 32, -126, -70, -124, 87, 76, -3, 
+	89, 158, -56, 98, 20, 138, 108, 17, 
+	72, -18, 69, -21, 32, 137, 20, 11, 
+	26, -2, -142, -67, -77, -1, 13, 6, 
+	-24, -73, 81, -72, 128, -68, -71, 72, 
+	2, 32, -55, 102, 95, 116, 54, -82, 
+	-30, 61, 2, -140, 30, 66, 109, 75, 
+	131, -38, -36, -27, 49, -113, 46, 20, 
+	-113, 125, 41, -52, -20, 119, 53, -16, 
+	98, -9, -82, 80, 133, -139, -33, 108, 
+	67, 76, 23, 147, 108, 3, 17, 6, 
+	-14, 91, 49, -44, 20, -63, 95, -76, 
+	116, 27, 82, 111, -18, -80, -3, -100, 
+	-69, -4, -94, -12, 32, 78, 79, 53, 
+	107, -3, -2, -40, -90, 104, 0, 86, 
+	-14, 93, 144, -28, -19, 59, 106, -97, 
+	104, 3, 30, 129, 25, -44, 70, 19, 
+	-35, 82, 125, -13, 117, 30, -49, 48, 
+	61, 69, -27, -62, -49, -61, -79, -96, 
+	56, 128, 113, -89, 9, -35, 38, -8, 
+	7, 49, -99, -134, -33, 133, -46, -75, 
+	-21, -60, -28, -83, -95, 67, 10, -80, 
+	2, -60, -3, -209, -117, 128, -72, 49, 
+	-33, 147, -10, -38, 62, -91, 27, -7, 
+	87, -171, 191, -144, -59, 24, -31, -242, 
+	-18, 54, -110, -72, 35, 122, -109, -135, 
+	-40, -27, 116, -86, 95, 23, -68, -13, 
+	68, 32, 85, 138, 98, 65, 70, -30, 
+	153, -4, 0, 61, -59, 5, -43, -6, 
+	97, -41, -35, -52, 87, 111, 30, 145, 
+	-12, -64, 115, 173, 75, 64, 52, 95, 
+	8, -37, 69, -66, 103, 78, 58, 185, 
+	74, -3, 3, -30, 45, 35, 9, -32, 
+	47, 69, 135, -13, 58, 119, 118, 77, 
+	64, 94, 119, -14, -5, -85, -27, 83, 
+	76, 106, -31, 4, -37, 23, -34, -12, 
+	7, -29, -55, 165, -33, 5, 96, 15, 
+	48, 124, -47, 30, -3, -100, 141, 134, 
+	11, -73, 79, 76, 202, 40, 15, -57, 
+	-14, 120, 94, -30, -47, 86, 77, 4, 
+	-112, -64, -153, -2, -91, 143, -36, -3, 
+	-125, 14, -104, 100, 73, -55, 34, 45, 
+	31, 15, 47, 93, -150, -9, -69, -82, 
+	-33, 1, -133, 96, 82, 32, -34, 19, 
+	-70, 185, 107, -43, 35, 5, 85, -96, 
+	119, -49, -26, 119, -106, -7, -106, 2, 
+	-114, 120, 87, 71, 81, -52, -150, 104, 
+	104, 181, 54, 108, 160, 132, 13, -69, 
+	45, 100, -110, -83, 41, -85, 106, 23, 
+	-27, -52, 105, 109, -177, -85, 50, -199, 
+	-43, -1, 91, -70, -69, -36, 35, 24, 
+	4, -152, -66, 54, 5, -78, -37, -68, 
+	-35, 105, 77, 15, -54, 16, -105, 8, 
+	46, 20, 73, 16, 41, -99, -43, -33, 
+	89, 68, 78, 20, -23, 23, 67, -10, 
+	33, -225, 15, 20, 105, 20, 108, -57, 
+	131, 20, -6, 92, 33, 98, 5, -56, 
+	47, 17, -104, 56, -79, -2, 96, -1, 
+	-78, -51, 128, 61, -83, 89, -78, 62, 
+	-19, 31, 61, -68, 111, -37, 38, 34, 
+	142, -74, 100, 126, -82, -49, 59, -78, 
+	-81, 32, 51, -28, -32, 0, -2, -55, 
+	72, 62, 62, -30, -15, -95, 37, 102, 
+	-48, 117, -56, 23, -98, 16, -28, -12, 
+	-48, 62, -12, -43, -38, 13, -24, 113, 
+	31, 39, 5, -52, 4, -28, -23, -22, 
+	108, 14, -6, -77, 40, -7, 66, -67, 
+	-26, -75, 77, 73, -71, -59, 76, -113, 
+	-46, 8, 14, -29, 68, -140, 162, -56, 
+	32, 90, -99, 41, -43, -17, -33, -98, 
+	-15, 82, -70, -29, 136, -63, 87, 16, 
+	12, 13, 65, -81, 54, -90, -89, -63, 
+	76, -130, 141, -52, 44, -23, -77, 16, 
+	48, -55, -90, 78, -65, -10, 0, -76, 
+	55, -7, 68, -17, -46, -31, 24, -69, 
+	48, -137, -126, 19, -12, -2, 15, 85, 
+	-9, -95, 29, -135, 30, -42, 60, -58, 
+	60, 73, 34, -56, 12, 63, 2, -37, 
+	-32, -42, 96, -176, 153, -69, -103, -35, 
+	-40, -13, -144, -150, 20, -122, -102, -31, 
+	-148, -138, -91, -91, 114, 5, 85, 17, 
+	-33, -111, -60, -114, -63, -50, 107, 146, 
+	-34, -96, 15, 60, 55, 94, 165, 16, 
+	33, -18, -141, -18, 28, 64, -52, 64, 
+	97, 76, -59, 50, -98, -21, 39, 90, 
+	27, -71, 11, -64, 56, -37, -69, -66, 
+	71, -137, 110, -88, -13, 114, 65, 90, 
+	-19, -22, 135, 47, -20, 33, -38, -109, 
+	1, 90, 10, 51, -28, 78, -127, 12, 
+	101, -4, -79, -7, -15, -36, 39, -57, 
+	-64, 75, -80, 129, 48, -32, -139, 32, 
+	15, 86, 88, 80, 0, -33, 60, 31, 
+	53, 140, -114, -50, -58, 88, 65, -142, 
+	-64, -122, -84, 121, -64, 90, 20, -67, 
+	-55, 41, -135, 124, 145, 3, 30, -68, 
+	-48, -117, -19, -35, -6, 2, 47, -5, 
+	-94, 61, 48, -56, -33, -15, -40, 14, 
+	-59, -118, -162, 45, 28, 21, 5, 26, 
+	102, -111, -135, 37, 115, 45, -14, 12, 
+	-22, -67, 37, -111, -45, 133, 108, -120, 
+	-35, -136, -164, 9, -14, -17, -98, 8, 
+	2, 73, -13, 7, 8, -130, -53, -20, 
+	-82, -201, 73, -4, -54, -1, 58, -102, 
+	-66, 147, -80, -47, -50, 18, -138, 34, 
+	-5, 13, 82, 116, -71, -158, -71, 20, 
+	162, 178, -83, -106, -15, -19, -120, 0, 
+	-39, 73, -25, -15, -14, 63, -103, 78, 
+	27, -109, -68, 9, -30, -112, -105, 64, 
+	-17, 38, 44, -29, -99, -1, 57, -112, 
+	54, 2, -60, -43, 91, 72, 70, -96, 
+	78, -133, 38, 8, 13, 47, 54, 107, 
+	-3, -136, 91, -60, -17, -2, -13, 31, 
+	56, 49, 72, -26, 8, 117, 46, -31, 
+	86, -61, 36, 108, -98, 82, 82, -57, 
+	71, 90, -143, 26, -134, 18, -115, 136, 
+	-14, -35, -105, 88, 98, -51, 121, -283, 
+	-103, 5, 97, -77, 36, 23, -34, -21, 
+	86, 75, 69, 139, -13, 41, -100, -16, 
+	-51, 136, 7, -6, 82, 9, 13, 16, 
+	127, 49, 88, -10, -4, -55, 169, -61, 
+	-134, 45, -51, -4, 62, 91, 31, -31, 
+	-81, 4, 41, -74, -31, -104, 28, -2, 
+	20, 64, -35, 23, 66, -79, -106, 76, 
+	50, 14, -17, 1, -63, -55, -87, -80, 
+	-25, -32, -46, -70, -40, 8, 23, -114, 
+	-84, -22, 64, 2, -68, 30, -115, 89, 
+	-4, -160, -43, -25, 13, -116, 56, -88, 
+	-73, -66, -14, -20, 89, -25, 6, -17, 
+	-138, 40, 64, 84, 4, -78, 21, -75, 
+	-97, -45, 40, -72, -58, -88, -75, -61, 
+	62, -38, -2, -3, 76, 71, -16, 35, 
+	53, -133, 93, -71, 54, -1, -34, -52, 
+	65, -83, -67, 4, 52, 4, -18, 57, 
+	-84, 26, -127, 20, -71, 53, 7, 35, 
+	-125, -14, -23, -32, -15, 9, -14, -47, 
+	45, 4, -54, 25, -63, -28, 23, 77, 
+	-108, -83, 29, -29, -75, -92, -58, 52, 
+	-53, -68, -77, 46, -94, 13, -17, -48, 
+	-25, -7, 22, -19, -69, 66, -136, -95, 
+	35, -45, 21, 33, -30, -87, 73, -8, 
+	-5, -82, -69, -13, -11, -43, 46, -39, 
+	-124, 4, -75, 106, 6, -23, -55, -1, 
+	-97, 129, 40, 26, -9, 9, -132, 34, 
+	-58, 16, -28, 10, -1, -107, -115, -98, 
+	28, -23, -83, 12, 6, -64, -93, -6, 
+	0, 24, -130, -30, 14, -87, -78, -10, 
+	-23, 10, 58, -113, 20, -100, 51, 73, 
+	-22, -112, -23, 94, 79, 15, -52, -107, 
+	69, -106, -111, -41, 5, 69, -62, 1, 
+	-34, 64, -87, 52, 52, -80, -111, -109, 
+	-81, -1, -24, 17, 118, -115, -21, -44, 
+	2, -76, 30, 62, -69, 25, -18, -51, 
+	-42, 30, 30, 28, 62, 49, 81, -16, 
+	-41, -11, -61, 7, -111, -38, -63, 13, 
+	-66, 39, -22, -13, -36, -38, -33, 10, 
+	-14, -38, -1, 102, -32, 62, -71, -67, 
+	-29, -153, -18, -23, 10, 63, 37, -118, 
+	69, 64, 67, -114, -56, 56, 84, -42, 
+	-17, 67, 54, -33, 26, -12, -27, -122, 
+	-34, 82, -60, -74, -2, -2, -15, -73, 
+	-104, -119, 69, -76, -103, -75, 38, 25, 
+	-11, -38, -73, -90, 4, -15, -111, -47, 
+	48, 34, -78, 92, -72, 3, -16, 47, 
+	-95, -50, -84, -99, 54, -58, -47, 7, 
+	-61, -87, 46, -73, -57, -24, -92, -35, 
+	-79, 29, -114, -63, 33, -62, -46, -43, 
+	-111, 41, -80, -30, -21, 39, -44, -72, 
+	48, 19, -34, 46, -97, -89, -4, 28, 
+	58, 86, -42, -101, 82, 15, 2, -116, 
+	-1, -72, -125, -89, -42, -2, -56, -140, 
+	-138, 47, -104, -81, -39, -141, 53, 7, 
+	70, 5, -90, 71, -28, 41, -90, 15, 
+	-39, -41, -60, -47, 46, 19, 28, -98, 
+	-43, -4, -57, -3, -18, -39, -96, 95, 
+	-2, 86, -26, -20, -90, -79, -29, -147, 
+	-6, -155, -11, 54, -18, 2, -44, 59, 
+	-14, 54, -77, -145, 39, -89, -3, 33, 
+	31, -133, 58, 76, -20, -132, -96, -51, 
+	-68, 55, -47, -99, 57, 54, -68, -4, 
+	53, 26, -40, 6, -62, -59, -19, 2, 
+	-4, -115, 8, -100, -125, -99, -16, -89, 
+	-59, 60, -58, -24, -5, -34, -57, -108, 
+	18, 72, -30, 16, -98, 29, 75, -110, 
+	-155, -61, -114, -27, -78, -13, -21, -11, 
+	-24, 63, -4, -82, -60, 46, -44, 37, 
+	-111, 4, 1, 49, 60, -106, 9, -38, 
+	-64, 3, -108, -58, 74, -135, -62, 27, 
+	-37, -86, -71, -103, -35, -89, 104, 52, 
+	-56, 42, -64, -65, 19, -85, 36, -32, 
+	-40, -123, -86, 10, 5, -42, -68, -85, 
+	-61, 73, -70, -16, 1, 35, 86, 24, 
+	-88, 127, -20, -112, -60, 42, -16, -63, 
+	-21, -116, 40, -57, 20, -34, -59, 48, 
+	11, -38, 65, 28, -41, 23, -25, 52, 
+	9, -11, 35, 60, -4, -83, -16, -161, 
+	80, 79, -242, 106, -79, -135, -89, 5, 
+	-134, 37, 45, -80, -101, -116, 22, 39, 
+	65, 39, -77, 47, -104, 89, -178, 59, 
+	-185, -26, -28, -100, -118, -30, 90, -119, 
+	-12, -103, 63, -147, -86, 30, 24, 26, 
+	-80, -54, 70, -78, 125, 8, -93, 17, 
+	75, -117, 62, -97, 65, -66, 75, -2, 
+	74, 40, -160, -43, -22, -84, 46, -6, 
+	-92, -55, -148, 132, -89, -27, 26, 47, 
+	-19, 89, -102, 66, -9, 19, -128, 33, 
+	-84, 106, -6, 1, -75, -92, 21, -22, 
+	81, 78, 12, -2, 117, 29, 29, -2, 
+	-89, -1, -69, 36, -43, 32, -59, 73, 
+	-74, -43, 83, -75, 29, 127, 110, 61, 
+	155, 45, 99, 39, -83, 107, -50, 36, 
+	-2, -96, 41, 31, 32, 40, -38, 24, 
+	97, 1, 25, 13, -127, -46, 36, -106, 
+	158, 62, -100, -44, 2, -17, -40, 52, 
+	-104, 5, -50, 18, 39, -113, 33, 157, 
+	33, 77, -154, -41, -201, -83, 83, -19, 
+	59, 11, 17, 96, 95, -43, -111, 25, 
+	-96, -67, 214, 53, 45, 26, -20, 52, 
+	-7, 2, -34, 85, -51, 32, -80, -17, 
+	120, 30, 66, 83, 67, 79, 36, -62, 
+	-34, 32, -97, 37, 84, 49, -6, 104, 
+	73, -98, -38, 178, 80, 67, -13, 101, 
+	103, -120, 21, 171, -22, 19, 64, -18, 
+	15, -80, 139, 26, -102, 40, 21, -20, 
+	17, 50, -114, -158, 150, -142, 37, 35, 
+	-21, -125, 69, 87, 31, 20, 32, 35, 
+	105, 10, 24, -51, 41, 19, -118, -23, 
+	100, 40, -62, -64, 150, 30, 17, 83, 
+	-10, 6, 141, 108, -6, 3, 65, -44, 
+	-14, -38, 71, -32, -1, -33, -24, 14, 
+	-42, 169, 4, 30, -78, 81, 69, -46, 
+	115, -207, 17, 17, 13, -102, -20, 82, 
+	21, 146, 23, -61, -11, 34, 23, 130, 
+	82, 86, -97, 88, -35, -123, -23, -16, 
+	55, 58, 27, -19, -45, 107, 20, -123, 
+	-41, -37, 36, -99, 61, 73, -75, -25, 
+	-9, 4, 95, 175, -79, -45, 36, 161, 
+	69, -215, 27, 34, -45, -72, 6, -104, 
+	32, 47, -86, -89, -22, 0, -19, 4, 
+	-6, -14, 124, -205, 25, 147, -83, 38, 
+	-52, 41, 86, -213, -26, -204, -83, 101, 
+	9, -171, 227, -39, -92, 3, 40, -173, 
+	-56, 58, -109, -53, 55, -12, 27, -9, 
+	100, -1, -35, -43, 74, 79, 66, 91, 
+	116, 138, -96, 38, -29, 46, 26, 19, 
+	-66, 19, 26, -20, 116, 98, -35, -46, 
+	-27, 40, -53, -30, -72, 41, 74, 112, 
+	-46, 8, 108, -65, 107, -13, 66, 18, 
+	119, -2, 104, 44, 105, -85, 41, -30, 
+	80, 16, -78, 56, 57, 83, 113, 94, 
+	-116, -4, -54, 133, 113, -44, 66, -39, 
+	3, -20, -18, -72, -31, -114, -97, 76, 
+	74, 88, -17, -24, -60, 68, 36, 75, 
+	129, -49, -41, 40, -116, 21, 82, 24, 
+	77, 16, -37, -123, 134, 57, 127, 108, 
+	53, 88, 93, 22, 43, 107, -38, -85, 
+	72, 107, 111, 28, 20, 64, 59, 46, 
+	-114, 2, 51, 37, -73, -140, 38, 34, 
+	-14, 127, 132, -147, 76, -103, -118, -14, 
+	103, 103, 58, 23, -129, 13, -53, -148, 
+	-64, 248, -16, -59, 27, 110, 46, 49, 
+	-108, 202, 0, -48, -81, 34, 112, -61, 
+	114, -156, -142, 50, -120, -12, 57, 23, 
+	-79, 62, 61, 29, 2, -94, -192, -89, 
+	5, 138, 31, -14, 49, 160, -40, -72, 
+	104, -1, 117, -8, 13, -75, 48, -125, 
+	-79, -55, -33, 15, 30, 29, -105, -81, 
+	-85, 99, -53, 13, -77, -64, -28, 5, 
+	6, 105, -12, -20, -42, -156, -41, 25, 
+	-64, -3, 69, -50, -54, -106, -47, -22, 
+	-5, 13, 63, 7, -47, 71, 42, 25, 
+	-75, 5, -108, 125, -18, 77, 83, -66, 
+	-116, -148, 76, -12, 54, -33, 67, -27, 
+	-64, -13, -74, -9, 85, 94, -100, 49, 
+	-106, -167, -41, -87, -88, -45, -65, 33, 
+	-49, -5, -131, -38, 47, 16, -55, -38, 
+	-58, -42, -14, -46, 81, 34, -13, 89, 
+	-80, -12, -1, -23, -74, -40, 34, 8, 
+	71, -58, 100, -17, 47, -17, 14, -10, 
+	-63, 51, -5, 55, -55, 29, -102, 32, 
+	-13, -261, 73, 73, -33, 2, 52, -26, 
+	-72, -22, 104, 95, -63, 16, 69, -12, 
+	-81, -113, -67, -70, 83, 79, -18, -23, 
+	-24, 39, -175, -12, -102, 50, -1, 95, 
+	140, -34, 93, 81, 58, 28, 102, 22, 
+	34, 28, 51, 11, 5, 59, -15, 158, 
+	50, 21, -50, -76, -27, -134, 33, 51, 
+	89, 96, -45, 6, -97, -86, -28, -48, 
+	60, -156, 62, 17, 109, -13, 3, 9, 
+	-1, 67, -133, -27, 44, 69, -29, 50, 
+	85, -30, 22, 44, -65, 7, -158, 1, 
+	-29, -42, -17, 5, 116, 131, 85, 22, 
+	-161, 138, -22, -20, 112, 99, -45, -17, 
+	133, -80, -90, 26, 19, -21, -12, -41, 
+	16, 16, 4, 125, 15, -31, 161, 56, 
+	-60, 33, 31, 24, -60, 140, 45, -11, 
+	33, 35, -83, -86, 78, -13, 89, -58, 
+	3, 87, -38, 136, 126, 82, -97, 57, 
+	0, 75, 19, 43, 13, 55, -46, 63, 
+	22, 144, -65, 115, 108, -5, -18, 113, 
+	36, -52, -137, -39, 69, 84, 49, -123, 
+	-81, -23, 101, -18, 152, 68, -45, 82, 
+	11, -11, -43, 154, -46, 41, 38, 36, 
+	-5, -87, -50, -84, -121, -110, 101, -12, 
+	80, -55, -9, -89, 11, 0, 111, 142, 
+	-67, 99, -96, -13, 77, -35, -41, 51, 
+	42, 27, 57, 77, 33, -28, 71, 39, 
+	34, -27, 1, 21, 125, 25, 4, 37, 
+	36, -65, -96, 92, -84, -13, 134, -84, 
+	38, 37, -33, 84, -94, 52, -64, 80, 
+	50, 61, 114, -121, 73, -103, 142, -1, 
+	39, -19, -110, -28, -257, 125, -52, 32, 
+	-56, -66, -96, 19, -28, -163, -131, 71, 
+	-80, 97, -73, -8, -136, 210, -4, 13, 
+	-78, -65, -38, 89, 17, 96, 73, 113, 
+	-52, -56, -167, 11, -82, 72, 75, 102, 
+	109, 132, -113, -16, -114, -77, 29, 25, 
+	-115, 55, 68, 29, -28, 22, 11, -71, 
+	-60, -31, 56, -68, 108, 49, 59, -53, 
+	-120, 98, 90, 77, -32, 16, -15, -68, 
+	112, -38, 97, -24, 27, 15, -99, 52, 
+	-30, -50, -43, -78, 134, -35, -81, 70, 
+	-102, -95, -154, 74, 73, -122, -121, 90, 
+	120, -75, 61, 38, 12, -11, -42, 75, 
+	-85, -123, 132, -146, -30, 82, 57, 55, 
+	145, 71, 104, 83, 46, 13, 90, 39, 
+	-50, -10, -195, -164, 108, 81, -254, 14, 
+	140, 59, 52, -144, -205, -67, -82, -58, 
+	36, 105, 184, -29, -63, -57, 36, -72, 
+	-31, 23, 0, -9, -31, -127, -73, 46, 
+	47, 119, -52, -98, 145, -67, 13, 38, 
+	6, -110, 181, -136, -87, -161, -97, -67, 
+	-109, 43, 124, 56, 43, 152, -147, 142, 
+	-8, 121, -38, 83, -56, 37, 180, -171, 
+	150, -107, -202, -36, -80, 6, -73, -16, 
+	6, -121, -45, -7, -32, -25, -248, 117, 
+	-8, 9, -3, 121, -11, 126, -48, -128, 
+	199, 3, 69, 81, -262, -45, 73, -172, 
+	-100, 53, -81, 31, -72, -113, -130, -95, 
+	-6, -142, -43, -45, -112, 9, -18, -58, 
+	-30, -30, 64, -162, 30, -48, -104, 4, 
+	-17, 38, 60, -137, 28, 37, 115, -78, 
+	-24, 58, 45, -54, -91, 36, -141, -123, 
+	63, -137, -99, 2, -8, -93, -49, -30, 
+	-68, 168, -17, -39, -94, -84, -28, -55, 
+	-32, -55, -12, -83, 42, 95, -17, 85, 
+	43, -54, -40, 102, 70, 4, -109, -73, 
+	116, -142, -179, -93, 84, 80, 75, -56, 
+	-39, -86, 206, -107, -20, 76, -86, 117, 
+	-89, -23, -2, -86, -66, -60, -5, 10, 
+	29, 151, 46, -173, -88, 163, -111, -77, 
+	60, -185, 36, -62, 29, 15, -21, 45, 
+	18, 60, -8, 21, -77, -8, -231, -73, 
+	106, 9, -74, -72, -58, -206, 47, 74, 
+	81, -44, -27, 10, -57, -123, 19, 64, 
+	-23, 36, -39, 72, 88, -8, -22, -21, 
+	6, -107, 71, -93, -107, -10, 9, -15, 
+	81, 20, 83, -67, 73, 53, -111, -194, 
+	-81, -28, 77, -44, 82, 101, 77, -23, 
+	-28, 107, 96, 106, -63, -48, -66, -62, 
+	87, 97, 60, -92, -84, -45, -41, -63, 
+	-71, 154, -34, -11, 19, 76, 8, -70, 
+	89, 208, -97, 28, 27, 117, 154, -5, 
+	-62, 128, 90, 105, -26, 48, 51, -21, 
+	65, 77, -84, -125, -118, 2, 108, 89, 
+	-34, 90, 60, -91, 85, -70, 16, -20, 
+	-5, 2, -90, 43, 124, 2, -75, -55, 
+	-61, -46, 71, -169, -57, -33, -70, -51, 
+	68, 11, 74, 72, -37, -87, 118, 54, 
+	-47, 67, 40, 72, -42, 4, 5, -1, 
+	33, -35, 57, -71, 113, -45, -44, -32, 
+	-8, -73, 28, 98, -11, -20, -115, 8, 
+	-73, -51, -2, -27, -77, -24, 88, 81, 
+	46, 26, 12, 63, 15, -6, 47, 86, 
+	27, -105, -13, -36, 59, 130, 46, -33, 
+	49, -148, -82, 3, 41, 94, -17, -65, 
+	-56, -3, -64, -78, 61, 67, -12, 58, 
+	60, 35, 64, -11, -53, 47, 33, 41, 
+	61, -22, 134, 30, 3, -19, -117, 104, 
+	-2, 161, -19, 33, 48, 4, -11, -125, 
+	116, 42, -48, 15, -24, 51, 40, 113, 
+	35, 62, 32, -4, -45, 55, -31, 108, 
+	70, -44, -134, -25, -56, 102, -116, -33, 
+	57, 66, -108, -115, -142, -23, -88, -12, 
+	-7, 47, -45, -55, 165, -41, 16, 80, 
+	35, -153, 205, -121, 50, 11, -76, -100, 
+	-30, -71, -33, -135, 86, 58, 62, -80, 
+	-15, -61, 43, -11, 56, 57, 47, -13, 
+	68, 59, 165, 17, 58, 73, 62, -2, 
+	145, -68, -170, 115, -23, 36, 91, 0, 
+	106, 86, 107, 83, -5, -55, 134, 64, 
+	95, 13, 66, -16, 97, 66, 52, 6, 
+	-86, 99, -74, -152, 126, -85, 150, 146, 
+	111, 81, 213, 98, -59, 18, -43, -71, 
+	94, 40, 193, 166, 26, -37, 56, 97, 
+	-126, 104, 92, 89, 34, 12, 29, -7, 
+	92, 92, -98, 202, 21, 35, -171, -93, 
+	4, -33, 61, -42, -33, 32, -18, 2, 
+	-8, 89, 132, -9, -25, -94, 232, 80, 
+	63, 95, -75, 148, 128, -20, -63, 37, 
+	57, -28, 36, 90, 75, -13, 1, 101, 
+	41, -111, -84, -81, -98, 48, 66, -40, 
+	68, 44, -98, 185, -95, 61, -26, -123, 
+	70, 34, -14, 76, 56, 122, 73, 11, 
+	66, -15, -37, 81, 132, -44, 67, 58, 
+	-11, -126, -80, -66, -7, -27, -110, 174, 
+	-43, 157, 75, 131, 7, -30, 11, -94, 
+	-7, 158, 17, 245, 64, -74, 84, 2, 
+	134, -39, -40, -76, 52, -80, -79, 65, 
+	-15, 62, -20, -77, 157, -17, 63, 150, 
+	-18, -11, 76, 22, -54, 17, 127, -13, 
+	6, -25, -24, 35, -15, 15, 58, 9, 
+	-72, 73, 1, 42, -84, -73, 73, -64, 
+	69, 74, 79, 27, -88, -40, 4, 55, 
+	-32, -42, -45, 78, 73, -72, -56, -63, 
+	-40, -22, 13, 88, 32, -61, -32, -60, 
+	-94, 57, 4, 1, 41, 42, -13, -8, 
+	-79, -71, -33, -103, -35, -62, 59, -17, 
+	-23, 27, -61, 37, -62, -42, 45, -2, 
+	-58, -81, 86, 78, 52, 23, 54, 10, 
+	-15, -47, -98, 27, 51, 53, -6, -67, 
+	-13, 5, -61, -69, 35, 16, -29, -53, 
+	-95, -92, 47, 86, -31, 34, 59, -54, 
+	-67, 83, -30, -29, -25, -75, 28, 50, 
+	-15, 57, 70, -94, -21, -106, 70, -27, 
+	-81, 24, 62, -60, 29, 48, -37, 5, 
+	-29, -21, 41, 12, -75, -47, -20, 40, 
+	-8, -16, 35, 36, 55, -74, -118, -43, 
+	-17, 11, -19, 69, -92, -92, 79, -85, 
+	17, -43, -30, -36, -6, 17, 43, -98, 
+	-76, 21, 21, -15, 4, -22, 59, -85, 
+	84, 10, -110, 14, 42, -68, -54, 55, 
+	40, -44, -39, -47, -14, -55, -19, 46, 
+	-44, -44, 56, 5, -12, -32, -91, 41, 
+	-80, 59, -92, -14, -5, 85, 45, -40, 
+	-81, 22, 35, -75, 4, -27, -20, -23, 
+	2, 71, -70, 22, -85, 68, -38, -11, 
+	2, -14, -8, 51, 63, -87, 60, -31, 
+	-49, -4, -12, 68, 50, -114, 75, -16, 
+	-9, -52, -99, 86, -26, -65, -30, -60, 
+	47, -43, 5, 29, 39, 61, -55, 27, 
+	4, 59, 91, 68, -103, -74, 35, 15, 
+	89, 80, 29, -87, -64, -45, -3, -31, 
+	-92, 79, -48, 20, -36, 40, 56, 60, 
+	1, -10, 61, -59, -93, 57, -76, 0, 
+	-18, 53, -8, 49, 56, -7, -74, -94, 
+	6, -71, -41, -71, -72, -125, -26, 68, 
+	32, -76, -26, -27, -51, -72, 37, -73, 
+	-70, 27, -53, -11, 16, 79, 4, 20, 
+	-13, -88, 21, -42, -75, 23, 7, -18, 
+	-54, 50, -28, -4, 32, 75, 2, 24, 
+	-86, -39, -53, -7, -70, -18, -42, -3, 
+	-78, -81, 26, 61, -28, -117, 90, -5, 
+	-55, 8, 9, -73, -87, -6, -2, 13, 
+	7, 56, 49, -27, -66, -90, 53, 45, 
+	-112, -18, 29, 62, -71, -99, 48, -27, 
+	10, 37, -20, -65, 60, -92, 55, -55, 
+	-112, -79, -80, -120, -44, -42, -64, 19, 
+	-63, -45, 40, 52, 22, -6, -60, -21, 
+	-64, -38, 0, -35, -34, -63, 4, -80, 
+	-52, -116, -62, -9, 84, 32, 35, -76, 
+	-25, 55, -53, -45, -11, -106, -95, -63, 
+	-81, 38, 49, -100, 42, 60, -54, -97, 
+	-48, -112, 15, 24, 47, 22, -103, -43, 
+	40, 76, -44, -82, 3, 21, 76, -14, 
+	-30, -43, 22, 52, -42, -28, 33, -20, 
+	-80, 18, 85, -16, -41, 12, -34, -91, 
+	-104, 5, 41, 73, 37, -110, -83, 29, 
+	-14, -12, 7, -70, -106, 62, 75, 58, 
+	-98, -30, 16, -70, -67, -36, -59, -118, 
+	-74, 79, -46, -3, -1, 84, -103, -17, 
+	2, 10, 76, 18, -48, -102, 36, -46, 
+	-71, -11, 11, 53, 55, -70, 15, 13, 
+	6, 0, 17, 44, -63, -67, -48, -58, 
+	-36, -92, -68, 33, 33, -20, -28, -13, 
+	16, -41, -29, 46, 26, -33, -18, -86, 
+	27, -68, -113, -65, -36, -55, -37, -21, 
+	-50, 36, -84, -99, -36, -27, 75, -3, 
+	-82, -3, 22, -70, -109, -29, 62, -6, 
+	9, 60, -98, 51, 54, 10, 5, 0, 
+	-32, -41, -55, -100, 74, -51, 22, -12, 
+	-73, -6, -31, -81, 48, -14, 72, -47, 
+	-94, -114, -13, -65, 22, -103, -43, -86, 
+	-29, 45, 83, -85, 144, 102, 89, 16, 
+	11, 8, -146, -29, 49, 109, 18, -8, 
+	-84, -25, -66, -62, 86, 221, 37, 117, 
+	-12, -19, 94, -71, 126, -29, -26, 77, 
+	83, 90, 155, 16, 58, 59, -84, 75, 
+	75, -115, -28, -9, 18, 30, -37, 114, 
+	94, 42, 50, 82, 79, -36, 14, -103, 
+	-116, 93, 95, 57, -11, -54, 88, 48, 
+	-48, -67, 120, 69, 58, 60, -103, 75, 
+	95, 11, -47, -44, 13, 19, -16, -92, 
+	-52, -24, 96, 124, 43, 56, 69, 44, 
+	2, -126, 99, -146, 149, -63, -51, 46, 
+	135, 141, 62, -93, 152, 95, -118, 185, 
+	121, -36, 179, 29, 142, 110, 25, -165, 
+	26, 19, -33, 146, 30, 134, -95, 92, 
+	4, 11, 40, -8, 82, -66, 33, -41, 
+	-45, -5, 64, -113, -78, 24, -36, 116, 
+	-62, -31, 66, 111, -27, -85, 84, -66, 
+	30, 131, 87, 33, -9, -55, -49, -115, 
+	58, 116, 85, -24, -79, 47, -91, -127, 
+	-70, 39, -30, -33, 292, 37, -22, 110, 
+	-69, -59, -87, 83, -77, 14, 76, 8, 
+	0, 18, -29, -122, 77, 145, 86, 83, 
+	70, -101, 68, 4, -82, -90, -106, -57, 
+	94, -92, 98, 1, 47, -30, 16, -50, 
+	56, 80, 30, -30, -57, -17, -66, 35, 
+	107, 65, 92, -131, 52, -67, 92, -31, 
+	-19, 22, 3, -261, 121, -12, 23, 114, 
+	-95, -63, 84, 47, 185, -35, -13, 47, 
+	-82, 24, 8, 106, -30, 58, -62, -67, 
+	-33, -108, 22, -85, 86, -52, 44, -30, 
+	77, -21, -23, -46, 95, -131, 64, 107, 
+	47, -70, 202, -37, -81, 7, 2, 7, 
+	114, -52, 73, -92, -26, -61, -108, -31, 
+	2, 25, -21, -127, -21, 111, 29, 31, 
+	-31, -137, 38, -125, 9, -90, 16, 112, 
+	86, 57, 46, -149, -68, 11, 56, 103, 
+	-125, -24, -6, 7, -17, -41, -55, -127, 
+	-155, 72, 33, -41, -6, 56, -86, 154, 
+	23, -147, -21, -40, 126, 72, -43, 44, 
+	-29, -13, -2, 241, 16, -83, 144, 29, 
+	72, -59, 53, -21, -3, 51, 37, -50, 
+	34, 18, -61, -117, -65, 13, -90, 58, 
+	-103, -78, 25, -67, 0, 30, -13, -77, 
+	111, 25, 29, -78, 143, 173, 256, -6, 
+	13, -95, -7, 48, -107, 89, 18, -129, 
+	-18, 134, -257, 86, 32, -70, -16, 85, 
+	53, 99, -68, 71, 87, -120, 119, -26, 
+	156, 56, 66, -65, -2, -83, -51, -23, 
+	-214, -104, 132, -249, -57, 135, 153, -102, 
+	46, -72, -219, 5, -56, -7, 42, 93, 
+	109, -9, -24, 76, -59, 10, -24, -56, 
+	53, -121, 51, -109, -53, 111, -18, -84, 
+	46, 160, -225, -157, -16, -16, -5, 119, 
+	46, -7, 144, -14, -36, -124, 91, -41, 
+	58, 11, 48, -81, 91, -20, -1, -25, 
+	-106, 67, -173, 20, -73, -18, 60, 20, 
+	52, -27, -114, 55, -21, -76, -218, -37, 
+	-36, -53, -35, 131, 98, -3, 72, -177, 
+	104, -12, 39, 6, 6, -76, 35, 62, 
+	-10, -137, -27, -20, 11, -61, -78, 102, 
+	65, -94, -112, -38, 115, -13, 21, 102, 
+	151, -106, 29, 90, 129, 15, 2, 127, 
+	17, -41, 61, 180, -101, -57, 130, -52, 
+	2, 115, -156, 29, 81, 42, -18, 57, 
+	18, -101, -12, -59, -6, -22, 108, -26, 
+	-129, -45, -140, -13, 14, 20, -34, 162, 
+	6, 71, 164, 41, 108, -63, -56, 102, 
+	-94, 41, -83, 139, 126, 64, 70, 55, 
+	88, -279, -13, -44, 164, -109, 256, 5, 
+	-38, -10, -37, -2, 64, -24, 26, 112, 
+	-14, -144, 124, 22, -57, -71, -21, 73, 
+	-14, -80, 70, -62, 4, -24, -36, 15, 
+	-59, -26, -46, 98, -29, -55, 62, 117, 
+	-55, 137, 50, -91, 34, -69, -47, 88, 
+	-4, 39, 17, 9, -62, 48, -43, -47, 
+	50, -2, -10, -4, 85, 9, -7, -46, 
+	-93, 25, -62, -127, -71, 50, 35, -85, 
+	-32, -45, 67, -55, -2, 103, 23, 12, 
+	-34, -89, -46, -5, -94, 87, -36, 82, 
+	-11, -24, -112, 55, -1, 72, 109, -41, 
+	-37, 14, 134, -74, 14, 54, 11, -19, 
+	-97, -61, 0, 64, -63, -69, -44, -91, 
+	40, 160, -24, 84, 3, 71, 49, 120, 
+	61, -31, 79, 118, 121, -52, -48, 10, 
+	52, -109, -113, 64, -21, -22, 17, -101, 
+	-58, -2, 38, -69, -23, -92, -63, -3, 
+	99, -15, -15, -1, -13, 19, 86, -6, 
+	-28, 69, -208, 77, 61, -171, -40, 84, 
+	156, -45, 123, -14, -105, -83, -41, -19, 
+	129, 56, -101, 52, -41, -46, -116, 100, 
+	-108, -107, 39, -7, -82, 90, 12, 80, 
+	93, 130, 74, 28, -28, 40, -61, 21, 
+	-15, 67, -99, 6, 71, 15, -70, -46, 
+	-57, -34, 158, -82, 68, -50, -86, 22, 
+	94, -51, 57, -50, 58, -18, 62, 109, 
+	13, 24, 90, 23, 42, 13, 76, -22, 
+	-16, 111, -94, 82, -60, 48, 80, -60, 
+	40, 24, 6, 36, -27, 6, -39, 36, 
+	30, -147, 78, 155, -55, 119, 79, -33, 
+	109, 21, 44, -120, -234, 113, 147, 106, 
+	-96, 77, -169, -4, -5, -190, 164, -14, 
+	-6, 62, 134, -39, 135, -1, -52, 42, 
+	9, 82, 125, 139, 188, 48, -115, -110, 
+	105, 179, 21, 110, 11, 62, 46, 91, 
+	-85, 56, 83, 77, 105, 20, 38, -60, 
+	1, -11, 33, -36, 84, 1, 129, -86, 
+	30, 87, 33, 98, 29, 116, 110, -52, 
+	36, 18, 57, -1, -211, -57, 90, -25, 
+	-9, -59, 54, 70, 27, -40, -47, 21, 
+	-64, 130, 18, 84, 18, -41, -53, -117, 
+	-20, 88, -18, 81, -41, -72, 60, -110, 
+	92, 95, -12, -40, 240, 105, -11, 3, 
+	30, -33, 0, 78, -56, -23, 14, -41, 
+	19, -91, -12, -27, -10, 2, 48, -38, 
+	-25, -10, 104, -144, 117, -147, 81, -49, 
+	164, -37, 1, -310, -342, -13, 22, 12, 
+	23, 1, -67, -21, -75, -82, -120, 140, 
+	26, -112, 306, -22, -62, 188, 15, -130, 
+	-75, 77, -41, 77, 62, 122, 133, 49, 
+	52, -171, 30, 40, 87, 72, -22, -32, 
+	102, 35, -29, 127, -48, -128, 52, 96, 
+	73, -87, -73, -53, 27, -30, 37, 141, 
+	-5, 42, -62, -33, -19, 92, 29, -41, 
+	-19, -19, 176, 234, 56, 92, 50, 8, 
+	27, 67, 30, -26, 0, -159, 70, -9, 
+	40, -40, -147, -75, 121, 45, -15, 14, 
+	77, -35, 89, 94, 80, -61, -34, -1, 
+	64, -50, 148, -53, -121, -58, -139, -30, 
+	-35, 133, -31, -63, -32, 92, 114, 161, 
+	121, -80, 52, 142, -98, 61, -23, 46, 
+	126, -13, -83, -111, 80, 64, -80, 23, 
+	18, 17, 60, 76, 133, 27, -28, -135, 
+	46, 111, 215, 34, 64, -86, 55, -45, 
+	-100, -40, -44, 78, -25, 60, 49, -6, 
+	54, 231, -76, -8, 41, -111, -79, -20, 
+	-55, -84, 293, -5, -100, -80, -119, -134, 
+	13, 76, -45, -50, 71, 123, -221, 124, 
+	-42, 12, -6, 79, -67, -39, -7, -158, 
+	44, -128, -108, -205, -3, 118, -87, -58, 
+	-101, -116, -24, -61, 111, -77, -168, -7, 
+	29, 206, 53, 17, 26, 46, -57, -117, 
+	169, 25, -29, 68, -199, 16, 58, -101, 
+	54, -55, -118, 70, -38, 26, -175, -173, 
+	-65, -83, 48, -83, -9, 33, -7, 61, 
+	40, 10, -90, 42, -10, -98, -35, 35, 
+	-107, -48, -92, 33, -85, -14, -37, 87, 
+	-44, 53, -1, -103, -94, -51, -108, -5, 
+	64, 14, -95, 10, 58, -29, -59, -41, 
+	-83, 35, 5, 46, -41, 37, -40, 16, 
+	-43, -4, -62, -9, -49, -54, -98, 38, 
+	-85, -37, 9, 21, -66, -51, -53, -52, 
+	45, 8, -84, -76, 79, -84, -12, -27, 
+	-52, -134, 68, 42, 12, -76, -131, -30, 
+	-47, -15, -73, -104, -116, -114, 62, -98, 
+	77, -85, -46, -21, -114, 8, -11, 14, 
+	-112, 39, -77, -125, -12, -143, -110, 68, 
+	-46, 4, -42, -49, -26, -76, 8, 62, 
+	36, -104, 71, 2, -9, -81, -47, 17, 
+	-96, 54, -101, -79, -44, -101, -18, 15, 
+	-96, -133, -48, 13, -3, -101, -56, 101, 
+	67, -118, 4, -72, 20, 1, -37, 77, 
+	32, -101, 87, -28, -20, -59, 92, 35, 
+	-138, -89, 83, -119, -48, -31, -30, 73, 
+	-62, -41, 11, -14, -55, -101, -27, -41, 
+	46, 28, -37, 37, 21, -34, -11, -131, 
+	-104, 114, 62, -32, -44, -44, -106, -16, 
+	-137, -14, -35, 11, -52, 26, -6, -59, 
+	-118, -56, -5, -12, -22, -91, -10, -116, 
+	19, 62, -63, -68, -70, -72, 17, -117, 
+	-99, -33, -99, 58, 58, -115, 18, -2, 
+	21, 5, -75, -4, 72, 49, -79, 0, 
+	-70, -111, 3, 109, -1, 10, -34, 81, 
+	-94, 9, -27, 19, -52, -23, 60, 35, 
+	43, 88, 85, 28, -44, -64, -55, 23, 
+	-99, -3, -59, -9, 68, -83, 13, 29, 
+	-124, 1, 32, 60, -44, -50, -71, -128, 
+	-79, 94, 31, -8, 22, -115, -29, -4, 
+	42, -94, -32, 37, -96, 32, 34, 73, 
+	-74, -49, -94, -13, -77, 33, 84, 128, 
+	-121, 24, -82, 28, 22, 22, -86, 17, 
+	-6, -53, -1, 30, 80, 58, 27, -86, 
+	59, -9, 94, -40, -24, -52, 63, 46, 
+	58, -102, -6, -46, 86, -30, 22, 50, 
+	-51, 53, -57, 25, -72, -75, 4, -90, 
+	-47, 54, 0, -59, 2, -43, 68, 82, 
+	-80, -95, -25, -135, -80, -30, 12, 21, 
+	19, -7, -131, 54, -63, -111, 35, 24, 
+	-46, 44, -56, 100, 96, 23, -80, -96, 
+	36, 62, 81, -44, 22, -66, 80, 60, 
+	-136, -37, 0, -94, -98, -67, -119, 3, 
+	-61, 1, 32, -69, -72, -65, -12, -56, 
+	-119, -114, -44, -57, -122, 32, 54, -116, 
+	-68, -28, -65, 77, -90, -84, 41, -57, 
+	-22, 37, -50, 55, 40, -138, -34, 51, 
+	-79, 19, 48, -87, 47, -40, 18, 44, 
+	36, -151, -39, -3, -15, 21, -90, 13, 
+	59, -48, -44, -105, 37, 29, 79, 55, 
+	114, -28, -56, -66, -24, -48, -126, -4, 
+	-62, -42, -81, 112, -73, 14, -27, -96, 
+	-51, -29, -97, -94, -87, -113, -10, -50, 
+	-111, 14, -82, 65, 41, -46, 71, -131, 
+	31, -41, -67, 3, 28, -77, -79, -130, 
+	5, -83, -43, -77, -133, -43, 29, 18, 
+	32, 8, -83, -26, -91, 39, -70, -5, 
+	-54, -7, -85, -106, 66, 48, 105, -39, 
+	45, -103, -73, 47, -103, -44, -71, 49, 
+	-87, -54, -124, 53, -20, 18, -71, -117, 
+	-43, 18, -55, -6, -55, -113, -53, 21, 
+	23, -95, 88, -49, -72, -46, 37, -58, 
+	3, 62, 25, -81, -66, -50, -7, -50, 
+	22, -115, -57, 51, -78, -20, -135, -53, 
+	6, -49, 23, 55, -11, -62, -15, 19, 
+	23, 26, -44, 29, -119, -127, 29, -101, 
+	0, -92, -38, -98, 10, 43, -100, -89, 
+	-109, 32, -59, -74, -21, -100, 60, -90, 
+	-3, 71, 143, 50, 83, -73, 15, -22, 
+	-61, 53, 122, 64, -56, -107, -101, -17, 
+	-145, -8, 66, 118, 84, -60, 44, -78, 
+	-72, 82, 12, -92, 24, -6, 18, -79, 
+	-82, -8, 18, 35, 58, -22, -135, -47, 
+	-39, 86, -55, 29, -11, -77, 9, 23, 
+	68, -128, 146, 36, -2, -32, -15, 60, 
+	30, -50, 62, -10, -175, -30, -56, -41, 
+	53, 85, -94, -108, -24, 13, -8, -20, 
+	-52, -13, 135, 74, 77, -28, -4, -46, 
+	41, -45, -37, 82, 30, -102, -23, 15, 
+	-41, 145, 18, -22, -125, -59, -42, 58, 
+	24, 77, 46, 39, 81, 34, 14, 9, 
+	121, 85, 7, 40, 7, -44, 61, -78, 
+	-16, 38, 88, 37, -39, -76, 13, 78, 
+	16, -117, -18, 49, -83, 15, -54, -46, 
+	-69, 127, -128, 43, -7, -123, 88, -31, 
+	61, 66, 12, 5, 56, 12, -127, -2, 
+	-104, 72, -11, 133, -57, 169, 56, -68, 
+	-45, -72, 16, 115, -35, 92, -3, -61, 
+	109, 15, 46, 117, 132, 74, 98, 32, 
+	69, 250, 31, 40, 87, 11, 43, 61, 
+	28, 100, 9, 11, 67, -18, 82, 45, 
+	-34, 93, 32, -25, -20, -46, 64, 137, 
+	48, 31, -124, 62, 85, -11, -98, 113, 
+	-67, 140, 176, 10, -21, 20, 19, 41, 
+	-82, -68, 35, -118, -106, -39, 82, -102, 
+	-56, -22, 1, -54, -145, 96, 36, 49, 
+	-36, -79, -18, -53, 8, -97, -124, 3, 
+	23, -11, -70, 152, -79, 90, -15, 16, 
+	-59, -15, 8, 45, -122, 76, 44, 156, 
+	-16, 24, -49, 108, 9, 33, -6, 85, 
+	-51, 19, 40, 108, 15, -70, -117, -23, 
+	-97, -47, 87, -26, 60, -6, -10, -123, 
+	89, -31, -50, -58, 125, 49, 0, -58, 
+	-10, 48, 84, 80, 104, 75, -155, -107, 
+	-9, 94, 29, -130, -43, -28, 14, -4, 
+	106, -72, -81, 16, -28, -115, -40, 132, 
+	22, 5, 150, 3, -21, 73, -11, -151, 
+	15, 28, 92, 54, -39, 43, 7, -33, 
+	-44, 40, 121, -110, -26, 150, 112, 77, 
+	-46, -161, 88, 65, 26, -59, -26, -28, 
+	56, -168, -30, -13, 67, 14, 50, 13, 
+	102, 64, 56, 141, -25, -54, 51, -47, 
+	10, 110, 124, 103, -94, -68, -27, 1, 
+	-49, 40, -23, 68, -19, -20, 111, 22, 
+	-3, -44, 5, 28, 129, 97, 44, 187, 
+	8, -74, 25, -14, -11, -203, 31, 60, 
+	-74, 3, 145, 72, 75, -90, 96, 5, 
+	-101, 73, -32, -123, 56, 8, -29, 126, 
+	-112, 52, -4, -44, 45, 93, -21, -79, 
+	-32, -129, -67, 17, -84, -14, -2, 0, 
+	78, 93, -66, -4, -30, 28, 74, 56, 
+	-93, 80, -59, -7, -102, 28, 51, 39, 
+	-40, -77, 30, -67, -28, 57, 38, -34, 
+	26, -85, 57, 109, -90, -102, -32, 65, 
+	81, 45, -57, -45, 126, -45, 110, -91, 
+	54, 105, -24, 15, -62, -80, -69, 198, 
+	115, -63, 6, -16, 3, 65, 36, -15, 
+	-135, -42, 69, 23, -15, -67, 59, 79, 
+	108, -43, 49, -116, -63, -3, -64, -2, 
+	-60, 55, -16, -12, 84, -67, 11, 61, 
+	-48, 93, 85, -65, -27, -58, 77, -72, 
+	87, -94, 48, 36, 72, -31, -22, -16, 
+	-62, -97, 141, -17, 159, 72, 140, -10, 
+	172, -160, 113, -126, -92, -92, -65, 176, 
+	-40, -152, 69, -55, -122, -35, -19, 65, 
+	-65, -18, 10, -55, -13, -48, 126, -80, 
+	56, 51, -129, 47, 70, 88, 31, -72, 
+	-115, -70, 120, -106, 2, -74, -134, 40, 
+	47, -43, 92, 32, 6, -74, 32, 38, 
+	161, 79, 117, 2, 155, 117, -57, -11, 
+	22, 39, -85, 25, -12, -12, 80, 28, 
+	11, 10, -84, -40, 21, 2, -85, -47, 
+	22, 48, -2, 49, -68, -59, 56, 22, 
+	62, 25, 59, -51, -39, 54, -8, -77, 
+	37, 38, -31, -18, 74, 76, 72, -49, 
+	-21, 56, -34, 61, 29, -67, -9, 85, 
+	28, -45, 59, 55, 59, 81, -50, 66, 
+	35, -81, -97, -48, -93, 10, -33, 36, 
+	72, 32, 33, -2, 23, -56, 21, 49, 
+	-12, -94, 40, -100, -24, -15, -67, 16, 
+	-13, 15, -78, 25, -61, -53, -46, -15, 
+	10, 45, 63, 25, -4, -89, -61, 70, 
+	-16, -74, -89, -7, -75, 77, 74, -69, 
+	30, -67, -19, 31, -5, -55, -60, 3, 
+	-85, -58, -32, -95, 44, 56, -89, -30, 
+	-42, -51, -40, -31, -6, 13, 2, -71, 
+	-30, -2, 65, -14, -49, -51, 53, 49, 
+	35, -62, 43, 47, -105, -15, -71, -43, 
+	-4, -64, -13, 23, -91, -73, 52, -63, 
+	70, 9, -18, 55, -93, 49, -58, -71, 
+	73, -78, 22, -11, -25, -16, -65, -48, 
+	-87, -49, 54, -70, -63, -59, -49, 39, 
+	-8, -72, -78, 79, 0, -86, -98, 60, 
+	-59, -8, 29, -12, -79, -15, 50, -36, 
+	-86, -104, 27, -66, -76, 15, 14, -90, 
+	-65, -53, -79, 35, 70, 76, 12, -17, 
+	-34, 21, 8, -22, 3, 30, 76, -41, 
+	-46, 27, -3, -68, 91, 71, -35, -23, 
+	51, -86, -104, -37, -56, -78, -18, -56, 
+	-34, -40, -37, -64, -52, -10, 30, -15, 
+	31, -50, 80, -102, -93, 22, -29, -85, 
+	-36, -50, 16, -39, -23, 33, 78, 60, 
+	59, -107, 63, 54, -63, 47, 81, -82, 
+	49, 37, 55, -37, 3, -53, 73, 52, 
+	-8, -46, 34, -58, 83, -77, -16, -80, 
+	-18, 32, 18, 61, -88, 43, 6, -96, 
+	-21, -16, -42, 36, -73, 72, -38, 77, 
+	39, -18, 42, -32, 18, -85, 2, -65, 
+	-94, 81, 28, -101, -51, -38, -15, -65, 
+	-101, 84, 27, -45, -90, -87, 36, 10, 
+	-23, -76, 29, -91, -80, -74, -17, -100, 
+	81, 62, 8, -8, 56, 36, 70, -83, 
+	-108, -72, 48, -28, 70, 3, 69, 11, 
+	9, -72, -12, -86, 72, -90, 72, 64, 
+	-52, 49, 84, 39, 10, -51, -110, 80, 
+	-78, 77, 26, 28, -1, -49, -92, -36, 
+	29, -93, -57, -30, -34, -31, 37, 27, 
+	-13, -26, 23, -60, 68, 62, -54, -36, 
+	31, -96, 2, 7, -22, 84, 92, 75, 
+	-31, -3, -9, 38, 34, -51, 63, -70, 
+	15, -45, -77, 65, -65, -14, -4, -47, 
+	68, -112, -76, 28, 24, -15, 77, 62, 
+	32, -61, 47, 22, -42, 58, -11, 61, 
+	-58, -71, 49, -31, -85, -85, 3, -31, 
+	61, -24, -46, 1, -22, 12, -36, -108, 
+	-9, -78, -48, -79, 17, -91, -25, 24, 
+	-19, 40, 14, 88, -53, 26, -6, 30, 
+	-30, 71, 79, -1, -15, 37, 20, 40, 
+	-83, -54, -105, -81, 27, 55, -68, -50, 
+	-95, -83, -73, -71, -25, -95, 7, -103, 
+	-27, -89, 19, 40, 51, 52, 6, -98, 
+	-42, 34, 10, 52, -95, -52, 33, -88, 
+	-21, -58, -67, 60, 38, 71, -28, 75, 
+	6, -77, -45, 30, 8, -67, 62, 25, 
+	28, 74, -99, -70, -27, 62, -3, 83, 
+	-50, 6, -65, 13, -63, -67, -103, 76, 
+	-65, -101, 6, -93, -111, 2, -16, 74, 
+	-82, 39, -90, -31, 73, -87, 50, 7, 
+	-47, -7, -51, 40, -67, -13, -37, 30, 
+	1, 46, -70, -48, -24, -81, -75, -1, 
+	-37, -12, 68, -70, -17, 29, -46, -95, 
+	32, 21, 18, -92, -90, -80, 42, -77, 
+	93, -36, 34, 43, -48, 71, -46, -11, 
+	107, -54, -45, 43, 20, -81, -90, 66, 
+	77, -112, -36, -48, -63, 69, 69, 38, 
+	40, 136, 22, -23, -19, -5, -77, -16, 
+	-74, -20, 68, 82, 22, -34, 10, -64, 
+	-83, 62, 3, 0, 10, -17, 7, -46, 
+	-180, 122, 84, 22, -28, -6, 6, -31, 
+	-32, -8, 4, 31, 32, -26, -3, -2, 
+	-77, -121, -102, 38, 104, 49, 90, -3, 
+	-24, -70, 22, -87, -102, 27, -105, -104, 
+	60, -117, -50, -29, -112, -65, -76, -31, 
+	-76, -10, -140, -46, 28, 84, -10, -46, 
+	-3, 90, -8, -61, 179, -3, -2, -57, 
+	97, -25, 22, -123, 94, 25, -32, -12, 
+	-75, 54, 54, -27, 71, 0, -93, 76, 
+	46, -74, 79, -19, -45, 55, -64, 31, 
+	83, -25, 66, -32, 29, -30, 74, -22, 
+	43, 48, -193, 48, 119, -68, -112, 102, 
+	-32, 119, -24, -54, -28, -24, -35, -59, 
+	11, -52, 29, 73, -17, 190, -41, 53, 
+	117, 88, 188, 9, 185, 133, 24, 94, 
+	-37, 117, 158, -24, -37, 49, 25, -9, 
+	-11, 88, -23, 38, -111, 108, 86, -81, 
+	27, 184, -35, -78, -25, 84, 17, -40, 
+	126, -66, 36, 96, -21, -123, 16, -64, 
+	-101, 34, -134, 19, 7, 2, 39, 113, 
+	-9, 150, -2, 74, 83, 13, -20, 132, 
+	108, -47, 88, 5, 4, -16, 51, 84, 
+	96, -29, 74, -154, -130, 77, -16, 87, 
+	36, 123, -97, 65, -38, -57, 106, 39, 
+	15, -16, 69, -20, -99, -23, -60, -79, 
+	55, -4, 41, -57, -53, -41, -46, -96, 
+	-46, 27, -151, -3, 34, -55, 8, 25, 
+	-72, 100, 3, 92, 77, -25, -83, -168, 
+	-28, 119, -51, 75, -77, 12, -12, -18, 
+	124, -97, 39, -71, 61, -91, -23, 2, 
+	-71, -100, 43, -109, -145, 17, 71, 46, 
+	-143, -59, -64, -15, -64, 4, -102, 30, 
+	-45, 11, 91, -51, -49, 21, 68, 55, 
+	-46, -50, -4, -20, -69, -100, 38, -25, 
+	126, -75, -146, 96, -134, -40, -78, -17, 
+	105, -152, -148, 63, 22, 34, 48, -61, 
+	4, 1, 44, 48, -47, 88, 82, 199, 
+	-30, 188, -1, 97, 12, 54, 27, 138, 
+	79, 139, 25, -1, 61, -84, 55, -77, 
+	136, 166, 139, -8, 13, 64, 88, 22, 
+	-1, -30, -10, 124, -96, 75, 58, -48, 
+	33, 15, 7, -48, -87, 79, 31, -134, 
+	-108, -94, -43, 75, 13, 70, -45, -57, 
+	-44, -93, 54, -163, 4, 8, -51, 113, 
+	146, 70, -71, -53, 21, -44, -12, 53, 
+	-27, -70, -75, 50, -35, -32, -121, 74, 
+	-24, 17, -44, -95, -247, 33, -98, 44, 
+	73, -29, -40, 43, -3, -41, 140, -20, 
+	-33, 24, -77, 49, -207, -29, -87, 4, 
+	17, -43, -40, -90, 22, -65, 0, -37, 
+	-1, -99, -130, -121, -29, -25, 190, 66, 
+	-117, -66, -120, -139, -72, -16, -46, -122, 
+	-34, -9, 11, -108, -7, 4, -83, 37, 
+	17, -157, 104, -16, -70, -118, -27, -26, 
+	33, -134, -37, -103, 14, 5, -13, 93, 
+	63, 40, -138, 68, -92, -58, 135, -34, 
+	-49, -74, 6, 10, 32, -61, -56, -23, 
+	31, -118, -69, 52, -128, 4, 52, -21, 
+	32, -47, -37, 24, 17, 23, 6, -56, 
+	19, -173, 201, -101, -118, -157, -47, 106, 
+	-14, -150, -5, 31, -101, -7, -4, -27, 
+	8, -49, -25, 38, 87, 66, -89, 46, 
+	40, -110, -91, 87, 33, -141, -41, 15, 
+	-34, -60, 53, -133, -8, -65, -9, -30, 
+	-60, 88, 10, -67, -31, 16, -28, 208, 
+	44, 18, -14, 29, 116, -214, 53, 37, 
+	18, 38, 72, -27, 20, -89, -86, -51, 
+	-77, -94, -33, -27, -62, -31, -54, -27, 
+	-61, -74, 36, -37, -30, -47, -38, -98, 
+	-76, -98, -13, 31, -86, -89, -6, -38, 
+	-125, -67, -52, -140, -65, -152, -46, -137, 
+	-119, 234, 34, -35, 29, -96, -261, 0, 
+	28, 1, 10, -117, -72, 3, -97, -110, 
+	149, 10, -95, 41, -94, 15, 30, 28, 
+	-110, -67, -291, 60, -33, 19, 75, -206, 
+	-78, 81, -260, 168, 4, 110, 41, -14, 
+	-97, 5, -214, 50, -64, -108, 30, 48, 
+	58, -60, -78, 37, -130, 26, 87, 121, 
+	50, -31, -128, 119, 146, -26, 48, 26, 
+	21, 37, 41, -111, -48, -35, 90, 113, 
+	134, -105, -67, 105, 82, -180, 56, -201, 
+	-74, 47, 54, 60, 67, -21, 102, -90, 
+	-55, 112, 110, 100, -14, 129, -90, -23, 
+	-21, 27, -208, -7, -18, -172, -20, 156, 
+	-142, 96, -69, -7, -10, -74, -16, 116, 
+	86, 65, -12, 45, -1, -73, -1, 100, 
+	13, 115, -113, -64, 58, 6, -66, 45, 
+	54, 214, 77, 39, 62, 36, -82, 64, 
+	-15, 88, 54, -7, -114, 32, 18, -143, 
+	-68, 58, -24, 31, -72, -26, -106, -118, 
+	27, 198, -111, 113, -65, -119, 45, 108, 
+	18, -36, 56, -66, 97, 66, 34, 17, 
+	22, 50, 16, 45, -6, 33, -22, 98, 
+	-5, -95, 143, 60, -4, -151, -60, 84, 
+	2, -8, -77, -61, 276, 57, 59, 13, 
+	-71, 127, -104, 40, 143, 159, 11, -98, 
+	-21, 42, 42, 50, -106, 28, 75, 97, 
+	66, 90, 85, 31, -47, 57, -187, -148, 
+	-77, 42, 62, -138, 31, 38, 43, 126, 
+	48, -64, 85, 74, -45, -66, -164, -68, 
+	-84, -82, 121, 25, -84, 3, 2, -22, 
+	25, -34, 38, 86, 22, 7, -94, -16, 
+	-35, -198, 39, 157, 53, 53, -27, 91, 
+	-12, 126, 72, -66, 15, 151, 27, 167, 
+	146, 14, -122, -22, -74, -22, 15, 74, 
+	-79, -31, 59, -64, -224, 119, 181, 122, 
+	84, -40, -4, -41, -22, -9, 117, -38, 
+	-55, -108, -9, -101, 45, -6, 84, 50, 
+	56, -6, 126, -7, 139, -77, -55, -37, 
+	-10, 122, -19, 186, -240, 39, -153, -13, 
+	-78, 260, 167, 179, -46, 67, -49, 3, 
+	48, 34, -175, 155, 12, -132, -27, 77, 
+	35, 59, -39, -194, 20, -32, 18, -24, 
+	-61, 68, -57, -67, 80, -101, 29, 121, 
+	42, -96, -190, 35, -63, -23, -16, -43, 
+	78, -177, 45, -45, -11, -54, 51, -89, 
+	-21, 53, 192, -57, 51, 165, 2, -28, 
+	18, 69, -58, -55, 25, 16, 2, -18, 
+	-89, 30, 47, 0, 75, -156, -88, 110, 
+	41, -9, 106, 132, -5, -106, 26, 5, 
+	-30, 14, -73, 50, -68, 106, 34, 87, 
+	-26, -65, -14, -18, -73, -132, -60, 5, 
+	64, -65, 126, 53, -115, -74, 55, 108, 
+	12, -15, 89, -22, 105, -186, -32, 13, 
+	-130, -47, 33, 114, 21, -91, -52, -30, 
+	-60, 48, 161, -65, 32, -170, -77, -3, 
+	-131, 4, -45, 120, -22, -91, 173, 30, 
+	98, -216, 102, 28, -242, -19, 15, 77, 
+	-137, 24, -8, 29, -82, 81, -141, 92, 
+	-132, -71, 116, -158, -3, -76, 22, 44, 
+	2, -103, 26, 54, -23, 88, -9, -40, 
+	48, -17, 193, 3, -38, 76, -27, -61, 
+	84, 32, -63, -25, -31, 13, 96, -8, 
+	-10, 114, -25, -57, 121, -40, 55, -123, 
+	113, 96, 98, 167, -54, 6, 92, 54, 
+	71, -63, -80, -62, -9, -12, 15, 3, 
+	-34, -3, 154, -31, 215, 28, 59, 95, 
+	67, -4, 75, -5, 68, 7, -50, 69, 
+	-53, -154, 76, -65, -40, 89, -45, -61, 
+	-24, 69, -83, -6, -159, 126, 59, 100, 
+	-57, 32, 56, -83, 61, -103, -47, -51, 
+	-94, -121, -85, 17, -43, -27, -73, -61, 
+	-86, 66, 90, -32, -43, -47, -24, -97, 
+	-3, 76, -43, 16, 57, -94, 76, -54, 
+	-44, -54, 20, 24, 13, 128, 45, -26, 
+	-63, -102, 3, -23, 46, 67, -132, -65, 
+	31, -44, 112, 40, -114, -105, -95, 9, 
+	-75, 20, -193, 14, -31, 67, -5, -120, 
+	67, 81, -95, -35, 9, 59, 77, 55, 
+	-92, 46, -32, 0, 85, -89, 15, -23, 
+	-12, 28, -43, 66, 102, -61, -32, 33, 
+	63, -25, 57, 33, 81, -60, -42, 131, 
+	3, -15, 95, -108, -108, -56, -82, -165, 
+	-148, -105, -2, -105, 108, 8, 111, -44, 
+	-77, 102, 73, 110, 100, 72, -45, 43, 
+	1, 117, -277, -14, 9, -25, -38, 129, 
+	-167, -21, 7, -16, 81, 5, 180, -37, 
+	43, -239, -81, -19, 62, -28, 71, -48, 
+	-21, 189, 100, -111, 69, 55, -4, 14, 
+	44, 199, 79, 20, 20, 64, -110, -2, 
+	166, -26, -168, 121, -130, -96, -80, -172, 
+	37, 108, 18, -29, 12, 27, 71, -76, 
+	46, 38, 37, -10, -56, -117, 0, -125, 
+	-4, 31, -108, 67, 74, -34, -34, -130, 
+	-60, -83, -58, 72, -14, -62, -76, 36, 
+	-122, 90, 104, -70, -18, -107, -67, -86, 
+	-85, -40, 27, -97, 246, 95, 114, -128, 
+	67, 43, -23, -26, 100, 93, 94, 89, 
+	-92, -24, -65, 66, -95, -34, 42, -73, 
+	80, 102, 59, 41, 30, -31, -7, 29, 
+	-72, 1, -44, -125, 33, -93, 61, -64, 
+	-36, 79, 130, 53, 68, -34, 27, 77, 
+	-100, -6, 19, 36, -137, 76, 17, -29, 
+	52, -66, 32, -23, 50, -66, -25, 35, 
+	-3, 98, -77, -52, 57, 121, 10, -42, 
+	-106, -6, 79, 10, -15, 30, -21, 60, 
+	-83, -66, -7, 28, -32, -85, -13, 93, 
+	28, 80, -57, 98, 10, 106, -25, -44, 
+	-10, -20, 66, -34, -167, -87, 1, -67, 
+	-42, -141, -17, 56, -41, -100, -80, -92, 
+	89, -129, 74, -9, -21, -11, -1, -65, 
+	-5, 135, 40, 143, -77, 45, -184, -33, 
+	12, 290, 13, 171, -79, -93, -113, -73, 
+	4, 190, -150, 74, 120, -82, -107, 142, 
+	-4, 65, 11, -29, -90, -57, -13, 46, 
+	31, -45, -55, -50, -22, -62, -13, -54, 
+	-115, 5, -20, -102, 73, 4, -17, -9, 
+	100, -72, 26, 30, -39, -124, -97, -99, 
+	-14, 5, -72, -14, 36, -155, -100, -20, 
+	-57, 90, -6, -111, 108, -102, 19, 53, 
+	-99, 38, 7, -116, 104, -63, -116, -32, 
+	-41, -120, 8, -133, 66, -156, 38, -6, 
+	-3, -69, -33, -55, 127, 91, 20, -80, 
+	-74, -88, 54, -34, -109, -60, 52, 49, 
+	-62, -23, -47, -106, -29, 109, 35, -60, 
+	-19, -51, -91, 48, 22, -64, -86, -62, 
+	-5, -143, -16, -67, -127, 33, -119, 0, 
+	-69, 26, -12, -118, 21, -39, -90, -157, 
+	142, 116, 57, -10, 61, -39, 97, 45, 
+	-13, -39, 1, -119, -106, -128, -76, -31, 
+	-18, 35, 3, -54, 74, -35, -34, 32, 
+	-65, 16, -56, -63, 34, -55, 108, 28, 
+	-8, -64, 89, 108, 3, 64, 47, 51, 
+	76, -24, 19, -42, 39, 94, -93, 50, 
+	-7, -8, 98, 105, -24, -25, 3, -102, 
+	94, -116, 81, -75, -54, -46, 40, -171, 
+	0, 46, 108, -20, 15, -102, 105, -39, 
+	31, -121, -68, 18, -65, 60, 184, -18, 
+	-96, 58, 36, 83, -83, 41, -53, 76, 
+	22, -15, 52, -98, 10, -61, 38, -72, 
+	116, 84, -108, 81, -38, 68, 60, -55, 
+	-53, -28, -5, 44, -16, 18, 83, 30, 
+	11, 25, -6, 13, 17, -68, -26, 8, 
+	-62, 68, 50, 81, 69, 11, 14, -52, 
+	-17, 147, -80, 60, 37, 14, 59, -46, 
+	-41, 27, -64, -70, -1, 24, 71, -66, 
+	10, 72, -45, 5, -124, -74, 58, 87, 
+	20, 68, -66, -41, 95, -1, 0, 18, 
+	35, 117, 306, 4, -3, 58, 64, 0, 
+	-11, 58, 9, 11, 24, 84, -119, -39, 
+	57, -78, -34, 3, -115, 24, -23, -25, 
+	86, -72, 29, 0, 80, 99, 51, -11, 
+	-6, 34, 98, -30, 97, 52, -90, -40, 
+	20, 63, 74, 40, -30, -24, 45, 37, 
+	-78, -8, 167, -89, -120, 60, 19, -22, 
+	75, 25, -32, 3, -57, 123, -1, -39, 
+	-17, -93, 155, 98, 84, 135, -68, 5, 
+	92, -86, -38, -70, 74, -79, -13, 89, 
+	-90, 7, 9, -35, 56, 25, 69, 153, 
+	8, 29, -40, 140, 112, -44, -31, 95, 
+	-45, 100, 65, 35, 131, -59, 91, -16, 
+	27, -94, -32, -31, 66, 37, -69, 140, 
+	17, -4, 78, -46, 69, -20, 29, -65, 
+	8, 51, 50, -58, 44, -74, -37, -66, 
+	-19, -103, 189, 88, -23, -55, 44, -33, 
+	-2, -51, -214, -15, -53, -6, -7, -98, 
+	6, 122, 77, 63, -15, 75, -56, 91, 
+	57, 58, 148, 29, 30, 88, -80, 89, 
+	-15, -77, -15, 81, -19, 27, -57, -5, 
+	-11, 90, 196, -19, 48, -32, -35, -89, 
+	-89, -88, -45, 64, 110, -35, -21, -37, 
+	-35, -84, -16, 15, -6, -31, -82, 5, 
+	46, -78, 9, 27, -21, 112, -53, 34, 
+	113, -52, 1, 88, 96, -11, 86, 86, 
+	-12, 109, 3, -89, 30, -20, -42, 40, 
+	-4, 96, 92, 87, 87, 114, -1, 68, 
+	14, -204, -23, 17, 10, -84, -42, 24, 
+	-25, 66, 142, -35, 86, -6, -49, 87, 
+	-32, 66, -146, -12, 82, -60, -73, -7, 
+	59, -41, 120, -121, -27, 15, 59, 21, 
+	-137, -17, -1, 18, 89, -100, -103, 17, 
+	101, 55, 116, 104, 64, 60, -89, -13, 
+	-49, -13, 34, 61, -23, 82, -23, 28, 
+	12, -6, 123, -103, -18, 62, 115, 39, 
+	-11, -24, -101, -56, 180, 63, 31, -17, 
+	-51, -20, 160, 9, -38, 41, -56, 76, 
+	114, 46, 176, 88, -50, 32, -32, 37, 
+	33, 82, -168, -24, 47, 151, 116, -39, 
+	121, 51, -47, -1, -50, 26, 1, 34, 
+	-14, 73, -55, 9, -71, -65, 136, -34, 
+	41, 14, -74, 99, 75, 0, -92, 106, 
+	16, 98, 17, 41, 59, 52, -20, -42, 
+	23, 81, 115, 17, 49, 31, 8, 17, 
+	97, 59, 58, -43, 56, -110, 99, 192, 
+	62, 123, 117, 49, 31, -37, -73, 109, 
+	28, 163, 23, -108, 165, -23, 5, -70, 
+	-42, 84, 188, -23, -118, 18, -49, 23, 
+	-105, -83, 8, 77, -100, 144, 102, -51, 
+	114, -16, -12, 98, 25, 80, -5, -107, 
+	122, -2, -150, -65, -57, -13, 42, 64, 
+	-49, 23, 55, 78, -91, 120, 3, -7, 
+	-70, 127, 21, -8, -32, 49, 93, -55, 
+	72, -40, 123, 82, -170, -2, 2, 6, 
+	-18, 54, 15, 58, 150, 104, 133, -103, 
+	21, 134, 93, -76, -92, -91, -147, 73, 
+	-26, 173, 46, 27, 104, 23, -59, -15, 
+	16, 73, -69, 69, 113, 20, 143, -87, 
+	116, -87, -94, 86, -176, 2, -40, 25, 
+	-36, -54, 102, -51, 75, -96, -56, 109, 
+	22, 187, -175, 66, -80, 40, -15, -34, 
+	118, -131, -28, -21, -66, -10, 58, 22, 
+	-121, -58, -55, 40, -140, 34, 15, -148, 
+	-15, 126, 25, -40, 97, -101, -13, 85, 
+	-55, -46, 66, 13, 26, 48, -25, -6, 
+	-61, 74, -13, 59, 122, -161, 29, -32, 
+	27, -14, 117, 149, 19, -41, 94, -25, 
+	-23, -15, -10, -22, 18, 136, 129, 144, 
+	83, -160, 60, 66, -24, 84, -20, 80, 
+	120, 103, 115, 54, 42, 10, -37, -112, 
+	-18, -32, 29, 34, -69, -42, 29, 38, 
+	77, -28, 7, 8, -45, -133, -96, 86, 
+	31, 21, 106, 100, 76, -15, 143, -37, 
+	166, 103, 113, 91, 21, -10, -27, 48, 
+	19, -119, 29, 147, -119, 34, 18, 41, 
+	106, 95, 37, 72, 25, 37, -39, 41, 
+	60, 50, 137, 47, 7, 29, 102, 55, 
+	98, 57, 137, -1, 78, 161, -58, 21, 
+	14, -46, 51, 68, 116, -51, 21, 103, 
+	14, 127, -27, -47, -102, -50, -106, -18, 
+	-28, 140, 141, 105, 25, 142, 48, -97, 
+	151, 33, 74, -67, 34, -52, 67, 18, 
+	-19, -6, 33, 42, -56, -12, 33, 93, 
+	-97, 49, 2, 8, -196, 17, 74, 80, 
+	-85, -94, -92, -10, 112, -22, 12, -2, 
+	-34, -23, 133, 44, 77, 4, -2, -30, 
+	-79, -43, 52, 26, -65, 14, -159, -1, 
+	19, -48, -173, -63, 132, 97, 112, 5, 
+	157, 26, 121, 119, -26, 19, 48, 99, 
+	30, -5, -51, 8, -32, -72, -40, -50, 
+	-48, 185, -26, 152, -67, -49, 89, 94, 
+	-91, 65, -122, 215, 160, 112, 42, -31, 
+	-27, -61, -93, 45, 45, 155, -184, -18, 
+	66, -32, -31, -87, -12, -9, -51, 206, 
+	10, -11, -74, -101, 8, -30, 22, 29, 
+	-46, -24, 107, 38, -65, 63, 104, -68, 
+	193, 2, -15, -6, 36, -104, -8, -77, 
+	-31, -20, 16, -34, -31, -24, 52, 69, 
+	59, 143, 37, -13, -33, 91, 128, -92, 
+	-51, 241, 3, 179, 43, -25, 94, 51, 
+	184, 149, -44, -74, 51, 106, 62, -23, 
+	1, -52, -89, 70, 27, 81, -37, 25, 
+	64, 71, 38, 57, -69, -31, 79, -145, 
+	47, -35, 35, 71, 102, 19, 126, 6, 
+	-114, 50, 86, -31, 59, 44, 90, -20, 
+	2, -39, -53, 32, 0, -52, -28, -132, 
+	-46, -80, -85, 219, 53, -35, 85, -101, 
+	25, -128, 150, 33, 62, 123, 83, -12, 
+	-17, 21, 26, 73, -172, -30, -61, -88, 
+	10, -41, -13, -106, -73, -57, 112, -28, 
+	79, 79, 26, 64, -56, 96, -38, 99, 
+	47, 113, -202, -162, -14, 132, -69, -102, 
+	204, 47, -48, -128, 65, -97, -30, 192, 
+	-160, 127, 117, -38, -15, -124, -91, -69, 
+	94, 22, 13, 24, 61, 6, -92, 62, 
+	-73, -32, -68, 112, 76, -9, -6, 34, 
+	-31, -59, 7, 2, 32, 25, -140, -6, 
+	28, 82, -6, 32, 160, -100, 2, 100, 
+	126, -121, -154, 16, -156, -67, -65, 43, 
+	155, -52, -77, -46, 46, -101, -44, -32, 
+	103, 22, -93, -66, 112, -129, 47, 69, 
+	-112, 141, 105, -79, 96, -33, -46, 128, 
+	-130, -87, -2, -100, 125, 192, -165, 97, 
+	109, 101, 73, 49, -42, -96, 91, 8, 
+	-29, -49, 252, 66, -17, 22, -122, -30, 
+	-22, -3, 100, 104, 15, -8, -68, 141, 
+	54, 144, 79, -169, 68, -57, -6, 46, 
+	14, 4, 56, 40, 12, 8, -84, -46, 
+	3, 88, -94, 89, 68, 101, -43, 10, 
+	29, -9, -23, 6, -37, 113, 58, -6, 
+	28, -180, -3, -152, 91, -60, -2, -18, 
+	7, -150, 92, -134, -2, 56, 21, -58, 
+	-36, 56, 27, 15, -56, -21, -97, -6, 
+	16, -41, -7, 154, 30, 33, -54, -56, 
+	-95, 117, 39, 19, 77, 10, -3, 14, 
+	69, -150, 1, 17, 41, 12, -137, 2, 
+	25, -26, -5, -129, -101, -99, 62, 49, 
+	42, 8, -21, 6, -36, -61, 38, -56, 
+	-55, 9, -139, 15, -106, -11, -102, 21, 
+	84, -24, 84, 15, -59, -67, 67, -59, 
+	-103, -84, 38, -125, 20, -49, 36, -28, 
+	0, -22, -131, -35, 70, 0, 72, 102, 
+	-16, 64, 36, 58, 117, -8, -87, 7, 
+	-50, -10, -50, -5, -26, 111, -11, 4, 
+	35, -13, -59, -96, 77, 76, -19, -41, 
+	-79, 64, -127, 12, -59, 102, -18, -64, 
+	72, -107, -73, -56, 11, -104, -76, 7, 
+	-84, -160, -42, -42, -47, -12, 45, 35, 
+	-66, 14, 47, 52, 82, 36, 28, -29, 
+	-70, -26, -59, 42, -99, 18, -53, -59, 
+	11, -97, -129, 78, 64, -35, -27, -32, 
+	92, 75, -44, -15, -12, -72, 38, -9, 
+	-60, 34, 47, -39, -7, -103, 78, 62, 
+	55, -38, -1, 43, 1, -107, -75, 50, 
+	-97, 84, 68, 0, 23, -9, -61, 3, 
+	22, -46, 4, -72, 43, 39, -13, -37, 
+	-30, -92, -33, -96, -16, 26, -22, 70, 
+	-37, -76, 9, -60, 59, 9, -127, 21, 
+	-18, -8, -71, 11, -44, -87, -95, -75, 
+	95, 34, -62, -48, -105, -132, 17, -77, 
+	-7, -89, -67, -38, 41, -60, -77, -67, 
+	-39, -101, -31, -78, -71, -33, 33, 61, 
+	30, -16, 2, 21, 54, -73, 43, 25, 
+	-64, 68, -83, -41, -98, -113, -8, 52, 
+	19, 96, 52, 17, -69, -51, -58, 101, 
+	51, 64, 59, 13, -74, 5, -49, 25, 
+	9, -100, 50, -84, -57, -20, -71, -7, 
+	-21, -24, 12, -30, 27, 6, -8, -68, 
+	-9, -25, -43, 49, -5, -39, -10, -62, 
+	62, -62, -27, 23, -105, -71, -51, -92, 
+	17, 35, -134, 60, -16, 14, 84, -33, 
+	-56, -57, 17, 1, 36, 51, -48, -17, 
+	81, -61, 71, -85, 31, 24, 9, -58, 
+	-80, -22, 24, -47, -87, 3, 13, -140, 
+	-3, -124, -42, -50, -96, -94, 24, -50, 
+	59, 91, 44, -1, 34, 10, -98, -64, 
+	41, 41, 8, 47, 113, -31, -28, -131, 
+	96, -56, -17, 53, 5, -62, 32, -47, 
+	-76, 16, -113, 40, -103, -24, 6, -10, 
+	39, 139, 75, 7, -1, 43, 40, 67, 
+	72, 93, -49, -58, -65, -86, -98, 10, 
+	-92, -67, 20, -18, 67, -16, 7, 22, 
+	22, -24, -13, 71, -92, -78, -104, -87, 
+	-102, 5, 94, 29, -92, -93, -130, 68, 
+	-61, 50, -48, -21, -60, -21, -74, 35, 
+	-119, 20, 66, -50, -41, -89, 11, -46, 
+	47, -6, 49, 25, 69, -78, -37, -91, 
+	74, -87, 20, -13, -58, -96, -97, -17, 
+	23, -85, -43, -62, -5, 12, -32, -27, 
+	-41, -73, -3, -56, -59, -71, -75, 46, 
+	-30, -104, -97, -105, -110, -46, 102, 70, 
+	-117, -63, -45, -56, -155, 25, -72, 46, 
+	21, -23, 22, 88, 32, 28, 96, 37, 
+	-42, -59, 81, -75, 93, 37, 79, 11, 
+	-9, -35, -149, -121, -134, 105, 37, -128, 
+	-92, -62, 59, -46, -139, 0, -40, -120, 
+	9, -32, -69, 69, -107, -56, 72, 19, 
+	-107, -20, 92, -35, -75, -53, -12, -162, 
+	39, -4, -13, -120, 27, 90, 99, -72, 
+	28, 27, -94, 76, -96, -23, -66, 37, 
+	-81, 62, -159, 128, 26, 73, 51, -23, 
+	-103, 114, -109, 31, 71, -63, 9, -104, 
+	-53, 107, -40, -55, -123, -36, -4, -43, 
+	25, 17, 53, 104, -63, -80, -89, -52, 
+	35, -78, -98, 79, -33, -55, 29, 83, 
+	31, -119, -85, -14, 48, 18, -128, -101, 
+	-6, -31, -54, -102, -98, -30, -89, -23, 
+	27, -120, -77, -6, 131, 118, 36, 51, 
+	4, 49, -42, -86, 34, 187, -24, -125, 
+	113, -14, -48, 33, 13, 93, -79, 63, 
+	89, -71, -43, 50, 35, -57, 23, 108, 
+	139, -98, 52, -1, -25, -49, 17, 76, 
+	-47, -149, 67, 112, 34, -33, 17, 77, 
+	91, 38, 19, 106, -36, -44, 60, -6, 
+	-59, 127, -45, 47, 10, -54, 86, 77, 
+	-51, -24, 200, -23, 15, 119, 38, 103, 
+	-96, -140, 91, -7, 111, 115, -94, -84, 
+	-52, 4, 98, 109, -50, 101, 139, 57, 
+	65, -171, -47, -48, -10, -77, -76, 47, 
+	48, 115, 162, -6, -55, 15, -91, -21, 
+	40, 79, 133, 89, -32, 26, 100, -84, 
+	-16, -66, -53, 66, -86, 28, 41, 14, 
+	-179, 61, 65, -154, -43, 90, 57, 39, 
+	-25, 65, 69, 2, -30, -42, 58, 68, 
+	-73, -69, 157, 39, 20, 22, -28, 150, 
+	-96, 82, 73, 18, 118, -123, 159, 29, 
+	4, 143, -64, 52, 10, -98, -42, -118, 
+	-69, -52, -66, -54, 252, -48, -30, -3, 
+	-42, 16, -52, 9, -159, 32, -69, -137, 
+	-3, -133, 316, 35, 53, -15, 72, 17, 
+	-60, -135, -24, -83, -64, 13, -65, 34, 
+	76, -169, -9, -31, -5, 40, 52, -34, 
+	22, -99, -68, 56, -42, -38, -89, 65, 
+	128, -92, -98, -215, -20, -62, 91, -155, 
+	-57, 54, -7, -204, 56, 78, -15, -75, 
+	11, 30, 104, 19, 132, -160, -108, 35, 
+	90, -22, -126, 22, -43, 55, -57, -21, 
+	-178, 17, 14, -241, 180, 87, -23, 66, 
+	33, -16, -82, -37, 42, -147, 2, 56, 
+	28, 40, 151, -22, 8, 21, 67, 32, 
+	240, -25, 36, -9, 6, -60, -161, 31, 
+	-48, 105, -47, -74, -61, 72, 128, -27, 
+	-34, -71, 29, -212, 63, -60, 2, 64, 
+	37, -27, -21, -140, -100, 17, 130, 58, 
+	-96, -163, 136, -74, 60, 50, 75, -98, 
+	-103, 26, -25, -121, -9, 105, -55, 186, 
+	59, -15, -23, -72, 114, 87, 58, 71, 
+	94, 16, -157, 9, 43, -133, -95, 138, 
+	-61, 103, 111, -50, -73, 40, -1, -22, 
+	51, -9, 96, -139, -28, -86, 35, 2, 
+	-104, -58, -26, 12, -75, 163, -37, 54, 
+	-19, -128, -66, 45, 93, -14, 63, 128, 
+	-122, -10, 37, 65, -8, 116, -47, -78, 
+	4, 259, -102, -92, 7, 20, 16, 135, 
+	74, 78, -108, 65, 62, 22, -58, 41, 
+	121, -15, 28, -81, 54, 3, -20, -109, 
+	-201, -12, 53, -124, 28, -31, 173, 39, 
+	-67, -139, -96, -45, -87, -60, -26, -13, 
+	109, -60, 22, 47, -111, -111, 25, -163, 
+	19, -260, -8, 32, -5, 5, 114, 94, 
+	-107, 198, -114, -179, 52, -48, -42, 10, 
+	144, -55, 212, 122, 44, -103, -61, -65, 
+	172, 153, -31, 57, -53, 94, -19, -22, 
+	-130, 29, -111, -79, 1, 110, -80, 35, 
+	-41, -73, -26, -64, 42, -175, -118, 11, 
+	-73, -48, 1, 110, 63, -21, 8, -48, 
+	-10, -7, -129, -27, -63, 6, -41, 34, 
+	-50, -186, 0, 48, -106, -51, 86, -67, 
+	40, -159, -24, -36, -48, -70, 130, 81, 
+	2, -103, 67, 70, 10, 29, 85, 38, 
+	51, -142, -25, 151, -80, 54, 42, 86, 
+	-12, 41, -57, -89, -27, 57, -120, -18, 
+	-100, -72, -70, 82, 93, -20, 86, -120, 
+	-191, -31, 12, 30, 60, -45, -46, 41, 
+	42, 30, 15, 170, 3, -56, -105, 32, 
+	-2, 72, 41, 144, 1, -42, 27, 43, 
+	2, -210, 43, 97, 146, 0, 235, 42, 
+	-52, 111, -56, 50, 125, 69, -76, 44, 
+	14, -204, -6, 61, -124, -39, 22, -21, 
+	15, -95, 79, -67, 139, -1, -21, -102, 
+	-83, 35, 68, -95, 47, 193, 104, -17, 
+	-31, -38, -43, -59, -54, 89, 94, -70, 
+	87, 100, -60, -56, -50, 130, 50, 0, 
+	139, -80, 163, -40, -47, -44, -99, -93, 
+	-9, -10, -123, 11, 29, -62, -11, 82, 
+	-18, -23, -59, 39, 37, -43, 73, 18, 
+	60, 8, 109, 19, 198, -30, -37, -30, 
+	-51, 69, 198, 108, -32, 99, 19, 62, 
+	20, -41, -5, 45, 108, 54, -98, 32, 
+	68, -68, 63, 83, -5, 125, 72, 18, 
+	-43, -124, -9, -46, 145, 79, -31, -6, 
+	3, 85, 113, -61, 16, 105, -48, 26, 
+	-66, 90, 112, -106, 31, 3, 2, 66, 
+	33, 87, -39, 13, 126, 66, 107, 39, 
+	-91, -29, -56, 76, -17, 19, -55, 5, 
+	126, -59, 71, 85, 66, 191, 76, 33, 
+	81, 124, -138, 100, 138, -142, 127, 85, 
+	-18, 24, 161, -50, 47, 48, 114, 59, 
+	86, 171, 27, 26, 64, 37, -72, 30, 
+	-17, 55, 29, 48, 40, 15, 24, -31, 
+	-66, -16, 177, -67, 59, 107, -67, 64, 
+	15, -8, -21, -20, 69, 36, -100, 36, 
+	-54, 24, 50, -101, -25, -69, 54, -136, 
+	-10, 52, 71, 55, -18, -8, 81, 29, 
+	56, 31, -2, -36, 20, 52, 6, 89, 
+	27, 185, 45, 25, -70, 27, -73, -89, 
+	136, -12, -74, -68, 104, 62, 45, 40, 
+	-15, 65, 130, -67, 58, 56, 82, 7, 
+	0, 66, -70, -19, -58, -16, 111, -73, 
+	-123, 0, 103, 150, 58, -98, 45, -38, 
+	-3, 75, 86, -69, 122, 56, 0, -90, 
+	129, 0, -47, 3, 52, 15, 84, -127, 
+	-71, 44, -104, 89, 20, 29, 29, 161, 
+	68, 117, -47, -77, -42, 6, -174, -44, 
+	-66, -6, 136, 43, -85, 39, 32, -10, 
+	59, -299, 19, -117, 11, 19, 98, -76, 
+	-146, -78, 36, -4, 16, -82, -37, -6, 
+	-131, 14, -49, 21, -67, -118, -12, 108, 
+	-24, -66, -2, 119, -10, 139, -115, 57, 
+	-54, -186, -59, 56, 33, -30, 56, 11, 
+	128, -46, 0, 106, 89, 2, 9, 41, 
+	-15, 36, -12, -3, 31, -122, 65, 48, 
+	59, 185, 164, -195, -65, -95, 17, 137, 
+	-186, -85, 62, 201, 206, -92, -37, 13, 
+	-37, -171, 75, -82, 95, -38, -40, 3, 
+	55, 192, -181, 20, 20, 149, -109, 21, 
+	13, -71, 36, -74, -94, -130, -26, 14, 
+	25, 119, -39, 126, -91, -73, -41, -59, 
+	-62, 45, 52, -16, 97, 53, 63, 37, 
+	46, -76, -46, 135, 64, 100, -15, 8, 
+	-87, -39, 29, -52, 17, 45, -22, -50, 
+	-1, 23, 46, -138, 25, 120, -4, 94, 
+	68, 39, -209, -24, 126, -118, 98, 29, 
+	146, -24, 31, -74, -165, 48, -44, 12, 
+	101, 181, -9, 24, 155, 126, -148, 16, 
+	-19, -4, -3, -123, -48, 36, 55, -34, 
+	-4, 9, 103, -28, 31, -1, 42, -17, 
+	113, 46, -15, -87, -82, -3, 103, -102, 
+	130, -20, 54, 36, -83, 46, -98, -148, 
+	-94, -33, -49, -62, 40, 155, 53, 84, 
+	23, 126, -46, -26, 99, 20, 221, -2, 
+	138, -160, 71, 37, 78, -45, 51, -140, 
+	-116, -66, -54, 48, 28, 64, 76, -3, 
+	-115, 44, -78, -52, -35, -93, 68, 55, 
+	-87, 71, 141, 43, -57, 47, 32, -43, 
+	1, 108, 25, 63, 21, -8, 28, 72, 
+	22, -105, 123, 84, -25, -2, 31, -94, 
+	-161, -30, 62, -26, 37, -55, 78, -35, 
+	-90, -24, -106, 32, -130, 31, -11, -45, 
+	34, -121, -41, -94, 34, -40, -121, 20, 
+	-52, 78, 26, -116, 49, 61, -99, 39, 
+	67, 59, 88, 26, 17, 36, -90, 58, 
+	-84, 74, -22, 85, -58, 148, 77, -37, 
+	34, -144, 43, 18, 56, 35, 83, -126, 
+	-91, 65, 92, -22, 9, 47, 83, -115, 
+	43, -102, -41, 82, -73, 50, -28, -21, 
+	-34, 83, -132, 69, 45, -29, 31, -142, 
+	-18, 26, 121, -66, -73, 68, 2, 17, 
+	-15, 102, 97, -20, 48, -32, 41, 106, 
+	63, -102, 113, -17, -35, 49, -2, -26, 
+	0, -7, 23, -5, -98, 62, 18, 83, 
+	-116, 50, 47, 69, -6, 6, 39, 13, 
+	60, 23, 40, -45, -45, 124, 42, 9, 
+	-59, -69, -32, -39, -77, -5, 112, -76, 
+	53, -30, 79, -12, -51, 10, -41, 48, 
+	129, -87, 112, 38, 4, -93, -17, 90, 
+	81, 5, -21, -28, 86, 58, 75, 44, 
+	16, 18, -30, -72, -55, -75, -50, 136, 
+	127, 56, 10, 11, 34, -192, -9, 232, 
+	7, 74, 53, -60, 92, -47, -98, -8, 
+	19, 62, -29, 56, 41, 146, -85, -87, 
+	-70, 98, -28, 7, 91, -47, -35, -74, 
+	-62, -20, 89, -18, 25, 51, -9, -3, 
+	57, 18, 207, -115, 51, -86, -6, 120, 
+	118, -18, -48, -52, 32, -8, -31, -14, 
+	10, -85, 40, -43, -89, -129, -50, -37, 
+	-174, 40, 2, -28, -128, -10, 95, -122, 
+	45, -123, 142, -265, -100, -28, -9, 2, 
+	-119, -112, 51, -183, -96, -38, -51, 40, 
+	-29, -90, -72, -49, 155, -98, 16, 67, 
+	-52, 54, -214, 71, 0, -38, -12, -14, 
+	-56, -7, 150, -117, -31, 31, -44, 108, 
+	38, 29, -17, 10, -27, -77, 4, 133, 
+	42, -6, 157, 112, 47, -71, 38, 114, 
+	-116, -5, 124, -40, -36, -51, -5, 3, 
+	-73, -112, 12, -15, -23, -45, 123, -221, 
+	-56, -80, -54, -66, 59, 98, 2, -17, 
+	-30, -62, 112, -122, -49, 41, 61, -67, 
+	-81, 56, -239, -148, 116, -20, -38, -90, 
+	-84, -95, -46, -18, 3, 139, 9, 53, 
+	87, -78, -106, -40, 32, -10, -105, 63, 
+	66, -58, 26, -20, 111, 37, 82, 45, 
+	14, 1, 116, -65, -64, -24, 89, -120, 
+	166, -236, 13, 59, -8, -1, 51, 57, 
+	-58, 102, 110, -97, -26, 123, 27, -14, 
+	16, 128, 83, -130, -112, 4, 56, 37, 
+	-50, 186, 54, 106, -16, -16, -15, 36, 
+	97, 43, 162, 81, 47, 198, 14, 95, 
+	-15, 195, -81, 65, -55, -95, 81, 58, 
+	-62, -35, 90, 41, 81, -63, -1, 84, 
+	-58, 120, -94, -54, 19, -128, -13, 67, 
+	86, -115, -141, 83, 90, 5, 93, 96, 
+	-107, -71, 37, 37, 44, 51, 79, -126, 
+	115, -195, -93, 144, 112, 46, -55, 11, 
+	-83, 65, 13, 80, -99, -97, -38, -79, 
+	67, -28, 12, -27, -87, -109, -7, 81, 
+	-7, 49, 159, -59, 104, -83, -89, 50, 
+	80, 111, 154, -70, 73, -52, -5, -107, 
+	27, 129, 121, -17, -61, -82, -114, 173, 
+	54, 1, 78, -46, 114, 64, 20, 84, 
+	-7, -7, -1, 69, 34, -10, 101, -76, 
+	-14, -144, -1, 153, 222, 16, 69, -33, 
+	-11, -15, -117, -64, 118, 28, -58, 51, 
+	-44, 21, -3, 93, -109, -17, 27, -68, 
+	114, -116, 26, 115, 65, 163, -108, -21, 
+	-52, -29, 82, -5, 27, 72, -59, 3, 
+	147, -94, 31, 5, 6, -104, -40, 149, 
+	5, -187, -4, -38, -154, 8, -48, 24, 
+	27, 103, -13, -91, 94, 1, 22, -95, 
+	102, -2, -137, -36, 94, 92, 1, 54, 
+	-6, -126, -65, -4, 58, -26, -12, 35, 
+	8, -44, -29, 79, -73, -41, -69, -72, 
+	122, -27, -18, -42, 20, 117, 97, -93, 
+	-1, 101, -104, 17, 42, 5, 30, -22, 
+	78, 61, 151, 61, 40, -48, 68, -30, 
+	2, -12, -66, -1, -11, 36, -56, 146, 
+	-40, 180, 86, 22, -23, 105, 45, 13, 
+	-2, 82, 37, 191, 209, -30, 58, -33, 
+	41, -45, 10, 6, 33, -15, 135, -62, 
+	-76, 79, -23, 28, 97, -55, -99, 27, 
+	127, -91, -17, -40, 46, -85, 32, -20, 
+	-128, -83, -178, 37, -110, -6, -57, 1, 
+	55, -2, 38, -92, -42, -31, -86, -58, 
+	-53, -76, 26, -89, 4, -166, -252, -121, 
+	63, 88, 54, -124, -25, -123, 3, 134, 
+	13, 82, -49, 152, 239, -141, -96, -62, 
+	95, -83, 35, 63, -24, 104, 10, -33, 
+	18, 12, 62, 8, -15, -7, -79, 76, 
+	-9, 38, 94, -50, -51, -96, -66, -2, 
+	82, -56, -25, -45, 32, -42, -43, 43, 
+	75, -67, 127, -4, -144, 93, 85, -149, 
+	168, 41, -70, -2, -42, -75, 15, 32, 
+	-36, -17, 21, 25, -44, 88, -62, 43, 
+	-111, 52, 13, 44, -92, -76, -1, -5, 
+	-14, 107, 17, 148, 35, -6, -31, -33, 
+	-37, 71, -127, 37, 60, 62, 33, 79, 
+	-49, 24, 78, -3, 65, -15, 93, 50, 
+	36, -41, 257, 67, -27, 184, 61, -24, 
+	22, 99, -214, 78, 67, -66, 19, 59, 
+	-32, 194, 40, 45, 122, 21, 88, 10, 
+	107, 61, 57, 46, 119, 1, -50, -20, 
+	-14, 31, 208, -222, -50, -28, 49, 130, 
+	22, 106, 136, 80, 51, -193, 139, -130, 
+	19, -73, -127, 159, 123, 130, 86, -84, 
+	-35, 70, -78, 20, 95, 86, 28, 109, 
+	20, -15, 94, 139, 72, -39, 18, 35, 
+	-15, 33, 17, -8, -70, -114, 109, 59, 
+	-94, 60, 92, -20, -50, 36, 27, 94, 
+	-47, 51, -98, 77, -29, -72, -119, -10, 
+	124, -261, -83, -121, 14, -18, 103, -57, 
+	-46, -60, 62, 17, -130, 24, -41, 23, 
+	9, 44, 158, 79, 11, -77, -58, 0, 
+	-23, -75, 70, -60, -53, -31, -53, 90, 
+	179, 50, -72, 169, -17, -61, 65, 67, 
+	40, -30, -83, 108, -2, 87, -38, 0, 
+	-15, 51, -61, -2, -12, 208, 102, 119, 
+	52, -108, -104, 81, 15, 41, 139, 40, 
+	166, 53, 20, -176, 48, 206, 173, 41, 
+	-39, 94, 60, -102, 88, -98, 20, 85, 
+	60, -148, -15, 85, -173, 83, -3, -123, 
+	11, 147, 67, -29, 13, 161, -110, -93, 
+	186, -91, 79, 69, 39, -3, -1, 91, 
+	-71, -4, 56, -63, 66, 59, -43, 20, 
+	151, -152, -141, 45, -14, 67, 37, 130, 
+	76, -89, -53, -2, -16, 172, 29, -88, 
+	54, -1, 239, 46, -20, 137, 37, -77, 
+	31, 121, -144, -197, 56, -197, 89, 151, 
+	107, 63, 50, 5, 7, 30, -29, 73, 
+	113, -29, 92, 90, 234, 58, 39, 161, 
+	-71, 23, -86, -88, -129, 66, 31, 173, 
+	27, 50, -11, -49, 75, 123, -15, -46, 
+	104, -17, -75, -12, 78, 17, 5, -66, 
+	153, 4, 5, 63, -24, 152, 30, 43, 
+	48, -45, 2, -41, 73, 3, -136, 57, 
+	56, 23, -88, 40, 11, 1, 155, 28, 
+	-3, 2, -19, 35, -129, -14, 31, -113, 
+	-20, 25, 22, 13, 17, 62, 26, -39, 
+	38, 77, -42, -6, 35, 1, 53, -19, 
+	-58, 25, 26, -79, 50, 111, -33, 16, 
+	112, -67, 103, -25, 99, 18, -19, -46, 
+	8, 61, -70, 52, 49, 9, -3, 3, 
+	-104, -3, 20, 113, 9, -51, -102, 21, 
+	39, 40, -42, 24, 72, -70, -131, 13, 
+	-38, 103, -37, -19, 42, -10, -34, 53, 
+	91, -55, 1, 45, -53, -81, -42, 71, 
+	-8, -66, -92, 32, -83, -52, -92, -92, 
+	40, -47, -44, -47, 49, 39, -94, -6, 
+	5, -16, -80, 56, -130, 47, -40, -36, 
+	-44, -82, -8, -16, -60, -101, -27, 55, 
+	-133, -12, -92, 42, -80, -7, -79, -10, 
+	-103, -28, 57, -13, 29, -4, -60, 52, 
+	-77, -112, -80, -99, -93, -44, -30, -5, 
+	-2, -73, -106, 26, -63, -106, 18, 51, 
+	-46, -18, 14, -65, -57, 117, -109, -88, 
+	-38, -105, -52, 25, 0, -20, -122, -100, 
+	-55, -10, -45, 72, -3, 37, -50, 8, 
+	-84, 30, -42, 82, -101, -12, -126, 19, 
+	-37, -100, -13, -93, 5, 14, -8, -96, 
+	51, 46, -114, -22, -21, 45, 31, -72, 
+	21, 9, 38, -13, 64, -33, -55, -95, 
+	6, -61, -121, -88, -17, 36, -132, 49, 
+	56, 2, -43, -34, -49, -18, -32, -92, 
+	-44, -17, 50, 38, 13, 18, 1, 39, 
+	-108, -8, -13, 58, -25, 53, 72, -98, 
+	-79, 30, 50, -24, -5, -33, -18, -97, 
+	-83, 5, -37, -98, -51, -18, -40, -34, 
+	-24, -63, -89, 56, -27, -114, -80, -93, 
+	-44, -57, -23, 64, -59, 61, 24, -73, 
+	93, 49, -8, -74, 32, -9, 83, -96, 
+	-117, 51, -58, 67, -8, -76, -40, -70, 
+	-98, -37, -22, 17, -62, 54, -52, -32, 
+	56, 68, 73, -94, 50, -29, -41, 28, 
+	-37, 13, 10, 4, 85, 36, 1, 37, 
+	59, -22, -73, 41, 29, -30, -45, -57, 
+	32, -54, 75, -65, -7, 60, -30, -68, 
+	18, -100, 18, -50, -57, -102, -89, 41, 
+	-96, -113, -52, 11, -141, -133, -64, 29, 
+	-56, -72, 6, -51, 30, -122, 0, -2, 
+	53, 17, -84, -7, 2, -17, -16, -73, 
+	34, -40, -26, -96, 3, -112, -127, 62, 
+	29, 35, -2, -105, 32, -63, -9, 45, 
+	-40, 56, -3, -42, 35, -71, -21, -117, 
+	-17, -111, 24, -3, -135, 64, -83, 31, 
+	13, -68, 5, 51, 81, 13, -102, -8, 
+	-27, 55, -111, -39, -48, -10, -20, -81, 
+	41, 35, -7, -51, -36, 33, -23, -69, 
+	82, 27, -131, -101, -2, -99, -105, 6, 
+	-92, 14, 28, 10, 39, 69, -43, 54, 
+	-23, -17, 7, -149, 100, -3, -110, 39, 
+	3, 1, -117, 1, -65, -102, -62, -100, 
+	-3, -45, 45, 22, 42, -41, -126, 28, 
+	37, 67, -68, 38, 3, -62, -63, 44, 
+	-41, 33, -43, -63, 44, -95, -25, 36, 
+	-105, -57, 56, 12, 63, 3, 47, 6, 
+	-45, -52, -43, -113, -17, -92, 59, -126, 
+	-89, 34, -57, 55, 65, 33, -9, -24, 
+	-107, -40, 32, -111, -99, -12, 21, 46, 
+	9, 46, -96, 29, 15, 34, -101, -18, 
+	-80, 4, -136, -63, -54, -71, 57, -119, 
+	-21, -4, -69, -59, 61, 48, 37, -57, 
+	11, -74, 46, -118, 5, -66, -29, -21, 
+	-142, 12, -78, -112, 39, -45, 14, -114, 
+	-144, -52, -95, 58, -54, -68, 2, -46, 
+	62, 70, 39, -44, -16, 45, 22, 28, 
+	-32, -57, 50, 25, -30, 40, -66, 4, 
+	-134, 39, -8, -26, 30, -33, 62, -12, 
+	28, -10, 12, 35, -82, -74, 60, -76, 
+	-104, -110, 31, -21, -72, 51, -70, -36, 
+	-23, -99, -30, -26, -100, -8, -7, -17, 
+	-58, 5, 34, 17, -32, -82, -117, 65, 
+	30, -72, -1, -22, -17, -59, -27, -18, 
+	25, -8, 19, -103, 9, 44, -53, -75, 
+	-118, 61, -96, -92, -52, 68, 38, -4, 
+	-18, 60, -121, 45, 74, 30, -18, -65, 
+	-42, -6, -41, -83, -7, -12, 39, 56, 
+	-108, 26, 76, -79, -57, -45, 6, -90, 
+	-66, 5, 50, 27, -69, -99, -130, 57, 
+	44, 2, -67, 82, 13, 115, 73, -12, 
+	-22, -48, 18, 16, -78, 107, 82, 17, 
+	71, -126, -52, 64, -51, -4, -24, -46, 
+	16, -22, -68, -22, -14, 136, 71, -120, 
+	4, 91, 23, 59, 51, -76, 46, 65, 
+	121, 54, 17, 115, -81, -60, -31, -5, 
+	48, 76, -119, 28, 61, -53, 66, 38, 
+	-17, 86, 49, 86, 9, 9, -85, 34, 
+	52, -48, 309, 7, 87, 103, 61, -19, 
+	109, -89, 127, -124, -106, 88, -134, 58, 
+	5, -65, -8, -113, -13, 126, 1, -52, 
+	60, -8, -57, -13, -18, -19, 14, 17, 
+	-47, -34, -23, -54, -29, 80, 63, 110, 
+	62, -62, 46, -18, -35, 29, -106, -109, 
+	-115, 22, 78, 54, -23, 48, 12, 61, 
+	31, 92, 7, 28, 56, 139, 5, -25, 
+	127, -124, 19, -84, 119, 36, 12, -12, 
+	154, 2, -106, -29, 95, 48, 39, 69, 
+	9, 15, 20, 16, -45, -59, 52, -83, 
+	-67, -101, 61, 23, 108, 166, 15, 79, 
+	42, 53, 80, -47, 59, 76, 74, -33, 
+	-14, 0, 116, 24, -58, -33, -22, -98, 
+	74, 5, -131, 44, -15, -65, -17, -53, 
+	-97, 0, -36, 26, -78, -70, -41, 110, 
+	-57, -12, 142, -60, 88, -27, 21, -67, 
+	161, -53, -104, 55, -68, -9, 40, -44, 
+	43, 157, 78, 15, 132, 25, -9, -3, 
+	9, -1, 46, 46, 88, 65, -81, 42, 
+	49, 25, 27, -74, 41, 35, 35, 32, 
+	-13, -23, 46, 114, 15, 66, -96, -69, 
+	-54, -44, -14, 45, 148, 76, 49, 9, 
+	47, -3, -61, -64, -39, -122, 102, 45, 
+	92, -60, 164, -17, 99, -22, -33, 36, 
+	4, 157, -244, -41, -52, 34, 149, 109, 
+	5, 92, 5, -139, 45, -54, 59, 63, 
+	0, -142, -93, -54, 6, -41, -17, -20, 
+	41, -113, -14, -71, -71, 128, 102, -61, 
+	-33, -173, -35, 55, -49, 33, -2, -8, 
+	-97, -62, 117, 25, 177, 0, -36, 100, 
+	-30, 46, 63, -60, 197, -17, 57, -12, 
+	77, -6, -67, -38, -70, 25, -137, 11, 
+	69, 152, 25, 12, 56, 17, -104, -7, 
+	8, 243, 118, 83, 25, 16, 35, 49, 
+	-3, -125, 42, -44, 119, -27, -77, 159, 
+	38, -252, -14, -19, 124, -18, -33, 140, 
+	0, -184, 199, -33, 17, 150, 172, 74, 
+	-38, 126, 5, 77, 37, -95, -18, -68, 
+	-36, 139, 34, -8, -78, -17, -73, 16, 
+	65, -40, 129, -18, 124, 11, 84, 13, 
+	-136, -62, 137, -65, -28, 62, -4, 48, 
+	125, -156, -150, 39, -42, -106, -80, 64, 
+	-4, -50, -49, -94, -115, 127, -136, -72, 
+	99, 115, 80, 25, -65, 122, -15, 61, 
+	-82, 186, -49, -211, 91, -147, -94, 91, 
+	91, 133, 58, 26, 56, -52, 73, -29, 
+	55, 41, 113, 0, 93, -39, -90, 69, 
+	54, 86, 131, 37, 34, 99, -68, 27, 
+	-129, -106, 5, 67, -111, 122, -43, 96, 
+	7, -103, 16, 88, -64, 71, 118, -76, 
+	112, 5, -127, 74, -66, 78, 89, -69, 
+	104, -47, -69, -10, 62, 171, -14, -6, 
+	-2, 165, -145, -34, 167, 136, 158, -130, 
+	175, 28, 132, 83, -168, 42, 128, 11, 
+	-36, 88, 62, 76, -2, 132, 16, -129, 
+	-46, 46, 5, -201, -83, -20, 0, 16, 
+	-136, -139, -25, -10, 74, 74, 53, -62, 
+	83, -105, 64, 96, 136, -107, 38, -47, 
+	69, 155, -18, 215, -14, 96, 1, 51, 
+	51, -142, 8, 176, -101, -37, -115, 143, 
+	172, -72, -115, 35, 14, -32, 129, 11, 
+	-9, -179, -138, -45, -66, -38, -4, 51, 
+	-94, -25, 10, -39, 22, -149, 79, -12, 
+	-12, 0, 27, -3, 10, 22, 56, -51, 
+	48, 38, -74, -37, -69, 39, 10, -5, 
+	-126, 35, -88, -98, 82, -69, -3, -104, 
+	50, 34, 40, -106, -114, -53, -121, -117, 
+	-35, 27, 7, -97, -81, 27, -58, -48, 
+	-117, -136, 13, -55, -155, -8, 43, -36, 
+	-6, -50, 49, -77, 63, 66, -90, 36, 
+	48, 37, -26, -21, 84, -88, -46, -82, 
+	-93, -108, -40, 27, -103, 12, -40, 60, 
+	28, -103, -106, -65, -91, -77, 18, 26, 
+	-36, 52, -96, 48, 35, -16, -43, 27, 
+	-51, -25, -113, -24, -104, 96, 69, -122, 
+	7, -85, -53, -1, -15, -4, 68, -40, 
+	-2, 73, -20, -113, -57, 56, -85, 21, 
+	-46, -6, 37, 71, -77, 5, -40, -6, 
+	-74, 5, -45, 3, 74, -66, -3, -70, 
+	32, -121, 134, -101, 42, -42, 22, -43, 
+	73, 39, -51, 78, 105, -5, -4, 30, 
+	-70, -64, 35, -96, 49, -4, 182, 44, 
+	-54, -94, 30, -39, 27, 52, -49, -75, 
+	72, 84, -77, 56, 110, 1, -52, -99, 
+	-71, 38, 26, -46, -27, -80, -29, 82, 
+	48, 9, -80, -99, 26, -8, 21, 29, 
+	-79, -45, 12, -87, 76, -51, -81, -93, 
+	48, -5, -62, 58, 6, -87, 75, -64, 
+	-93, -12, 20, -157, 85, -77, -70, -71, 
+	33, -113, -140, 21, 48, 23, -13, -78, 
+	-54, -28, -6, -47, -111, -7, -36, -33, 
+	-73, -67, -21, 66, 179, 3, -76, -41, 
+	-8, -70, -44, -100, -85, 59, -110, 45, 
+	-43, -71, -31, 7, -23, -86, 50, -84, 
+	41, -13, -113, 14, -41, -35, -84, -65, 
+	-59, 57, -32, 44, -29, -33, -11, 13, 
+	31, -1, -25, 63, -14, 58, 5, 25, 
+	55, -26, 19, -102, -27, 79, 21, -51, 
+	19, 82, -68, -23, -130, 68, -24, 31, 
+	-1, 59, -99, -9, 15, -77, 28, -50, 
+	-52, -22, -51, -63, -63, 54, -38, -43, 
+	2, 11, 45, 75, 60, 45, -71, -62, 
+	-90, 64, 44, -76, -73, 69, -72, -53, 
+	-45, 54, 90, 9, -14, 23, 56, -80, 
+	32, -82, 3, -48, 43, 42, -63, -43, 
+	-5, 18, -87, -15, -75, -15, 70, -85, 
+	-42, 149, -18, 6, -101, 49, -63, -127, 
+	43, 111, 38, 87, 78, 37, -71, 50, 
+	55, -33, -18, -56, -96, -28, -106, -12, 
+	101, -11, 45, -17, -80, -37, -8, -56, 
+	-69, -75, -19, 43, -68, 46, -56, 84, 
+	-120, -68, 27, -59, 41, -42, 19, 106, 
+	27, -91, -74, -15, -99, 6, 44, 48, 
+	-23, 74, 44, 43, 60, -23, 41, -12, 
+	6, 33, 35, -45, -60, -38, -91, 30, 
+	28, -13, -20, -54, -64, -18, -47, 2, 
+	-23, 34, 59, 36, 24, 18, -70, -22, 
+	15, 45, -47, -57, -60, 3, 66, 41, 
+	-52, -136, -19, -85, 64, 57, -17, -146, 
+	-33, -83, -125, 99, -123, 73, -107, -6, 
+	-48, -53, -69, -85, -2, -10, -35, 89, 
+	35, -19, -69, 0, 22, 20, -51, -47, 
+	-166, -73, 36, -95, 2, 119, 39, 0, 
+	10, -48, -63, -94, -57, -22, -68, 10, 
+	-44, -67, 38, -8, -10, 22, -80, -113, 
+	33, -25, 26, -95, -55, 13, 61, 26, 
+	-45, -16, 98, -79, -87, -41, -67, -56, 
+	-76, -103, -58, 79, 30, -79, -79, -11, 
+	2, -13, -38, -119, -69, -44, -82, -18, 
+	41, -72, 32, -10, 17, -15, 62, 43, 
+	61, 46, -104, -42, -7, -33, 33, 28, 
+	75, -69, 3, -66, 52, 21, -49, -107, 
+	-42, 42, 79, 3, -7, 6, 37, 42, 
+	-40, 45, 77, -127, 5, -82, 16, -20, 
+	128, -20, -4, -133, 24, 30, 49, -114, 
+	-123, -97, 114, -60, -96, 31, -10, 82, 
+	6, -122, 147, 32, 58, -48, 18, -153, 
+	-36, -134, -105, 92, -125, 42, 102, -93, 
+	13, -120, -108, 29, -32, -3, -125, -14, 
+	1, 78, 8, -37, 25, -75, -54, -79, 
+	13, -36, -19, -128, -58, -181, -88, -101, 
+	96, -4, 200, -88, -189, -89, -51, -186, 
+	-67, -73, -28, -58, -88, 20, -59, 7, 
+	-49, 146, 220, -103, -24, 76, -70, 81, 
+	89, -153, 2, 8, -40, -6, -74, 17, 
+	84, -13, 52, 66, 52, 32, -8, 23, 
+	-119, -34, 86, 19, -70, -68, 20, -86, 
+	65, 250, -49, -53, 102, 2, 13, 14, 
+	52, 21, -40, -60, 51, -1, 43, 52, 
+	-120, 14, 5, -5, -151, 35, 49, -65, 
+	12, -51, -67, -55, -33, -40, 26, 38, 
+	-17, 59, 110, -60, 44, -34, 14, -32, 
+	39, -13, -65, -5, 87, 148, 17, -59, 
+	12, -15, 165, 14, -107, 5, 95, -6, 
+	-93, 68, 28, -33, -107, 75, -41, -94, 
+	-82, 178, 99, 11, 122, -46, -50, 3, 
+	-33, -108, -28, -96, -86, 94, 40, 6, 
+	12, -126, 188, -54, 36, 11, 75, 66, 
+	-6, 71, -2, -90, 135, 61, 102, -50, 
+	6, 126, -31, 22, -8, -129, -28, -48, 
+	35, 53, -51, -62, 52, -75, 45, -79, 
+	52, 264, -115, -36, -35, -115, -66, -126, 
+	-63, 38, 154, 37, -117, 52, 26, 82, 
+	-79, 8, -22, 9, -162, 72, -61, 14, 
+	-81, -107, 99, 94, -48, -13, -98, -188, 
+	-216, -30, 154, -10, 21, -83, -78, -105, 
+	-11, -86, -68, -22, 25, 100, -169, -142, 
+	-75, -72, -147, -85, -38, -123, 21, -121, 
+	81, -20, 5, 30, -41, -109, 3, 17, 
+	60, 37, -84, -89, -154, -64, -40, -3, 
+	-45, 95, 146, -53, -29, 50, 46, 113, 
+	-176, -35, -146, 69, 63, -1, 54, 55, 
+	-6, -105, 71, 55, -72, -64, -175, 62, 
+	-13, -5, 29, 24, 25, -166, -131, 235, 
+	35, -53, -34, 4, -32, -70, -129, 150, 
+	-31, 26, 42, -40, 73, -100, 67, 18, 
+	80, 160, 88, -46, -72, -105, -51, 84, 
+	-140, -47, -46, 62, 95, 111, -62, 48, 
+	-137, -91, -54, 45, 101, 66, -45, 65, 
+	15, 168, 75, -81, -46, -24, 17, -34, 
+	-40, -15, -38, -41, 21, -49, 113, -42, 
+	-68, -12, 120, -6, -102, 37, 11, 81, 
+	113, 66, 100, -5, 136, -58, -10, -72, 
+	21, -108, 23, -172, -110, -12, -45, 60, 
+	84, -72, -106, 48, -25, -112, 66, -81, 
+	-160, -75, -93, -114, 13, -84, 57, -40, 
+	152, 145, 54, 131, -13, -71, 32, -83, 
+	34, -106, -136, 209, -51, -78, -40, 42, 
+	-31, -107, 54, -19, -64, 3, 85, 114, 
+	8, 33, -73, -212, 155, -108, 113, 50, 
+	-54, -178, -111, 83, -43, 87, -79, 58, 
+	-167, -149, -49, -136, -133, -20, -17, -41, 
+	-103, 12, 71, 68, 70, -192, 32, 12, 
+	-61, -151, 206, 27, 32, -189, 172, -139, 
+	-5, 15, -105, -105, -66, 135, -20, -64, 
+	-54, -65, 10, 242, -55, -70, -101, 89, 
+	44, 63, 136, -133, -71, 34, 22, -72, 
+	83, 31, 5, -13, 66, -24, 89, 25, 
+	-31, -52, 188, -33, -90, -124, 38, 183, 
+	36, 172, -92, -128, -56, -60, -38, -5, 
+	-20, 58, 93, 29, 79, -51, -36, -130, 
+	86, 137, -50, -103, 138, -4, -22, -51, 
+	-62, -36, -72, -76, -208, 121, 67, -14, 
+	-132, 139, 84, -71, 21, -146, -48, 43, 
+	-41, 46, -21, -20, 36, -153, 50, -42, 
+	-48, -15, 132, -116, -14, -31, -13, 182, 
+	35, -76, -69, -135, 101, 9, -16, 120, 
+	99, 68, -17, -55, 9, 45, -97, 3, 
+	-51, -32, -9, 10, -17, 79, -58, 82, 
+	-27, -91, 76, 103, 81, 22, 30, -65, 
+	-66, -96, -32, -12, -70, -19, -35, -4, 
+	110, -45, -42, 59, -57, -44, 30, -39, 
+	56, 80, 81, -21, 141, 16, 58, -88, 
+	-83, 35, 114, 53, 51, -71, -38, -5, 
+	-41, 108, 53, 53, 76, 51, 0, -118, 
+	175, -100, 66, -87, 168, 120, 5, 149, 
+	71, -12, 149, 22, -68, 74, 160, 70, 
+	-5, 1, 86, -92, 65, -19, 167, 66, 
+	56, 87, -97, -96, 139, 93, -11, -98, 
+	-81, -115, 75, -54, -160, 95, 104, -71, 
+	-84, 171, 122, -45, 53, 14, -2, -49, 
+	-23, -12, 39, 69, 123, -21, 1, -98, 
+	15, -48, -15, 55, 51, 67, 64, 46, 
+	7, -76, 89, 12, 177, 56, 99, -91, 
+	55, 88, -145, 86, 192, -60, 15, 124, 
+	-44, -68, 59, 71, -148, 77, -26, 11, 
+	106, -90, 68, -52, 132, -12, 74, 33, 
+	59, -133, 87, -106, 149, 165, 93, -47, 
+	47, 145, 43, -122, 4, 40, -13, -31, 
+	47, -69, 113, 98, 69, -153, -12, 14, 
+	-34, 79, -126, 0, 63, -27, 120, -20, 
+	3, -135, -255, 12, -41, -28, -184, -88, 
+	95, -89, 96, 81, 90, 85, -27, -124, 
+	8, 8, -18, -41, -20, 2, -28, -59, 
+	74, -47, -44, -122, -68, -37, -25, -104, 
+	-14, 71, -8, 168, -85, -109, -44, -59, 
+	24, -135, 101, 63, -87, 62, 10, 18, 
+	51, 92, -47, 34, -73, 44, -93, -5, 
+	-50, -153, 58, 3, 42, -41, -36, -44, 
+	68, -90, -30, -101, -107, 40, -36, -41, 
+	-17, 74, -85, -79, -54, 76, -46, -40, 
+	-33, -4, -81, -141, 68, 32, -104, 151, 
+	-9, -124, -48, -79, 73, -42, -76, -53, 
+	-139, 267, -9, -4, 51, 20, 32, 21, 
+	98, -16, -66, 62, -20, -107, -7, -40, 
+	11, -113, 35, -6, 46, -33, 25, 55, 
+	-61, 105, -40, -19, -56, -35, 71, -131, 
+	-109, 43, 22, 25, -150, 82, 11, 31, 
+	-79, -94, -92, -120, 62, -116, -109, -56, 
+	-21, 72, 84, 108, -10, 44, -34, 81, 
+	32, 52, 41, 35, 3, -66, -88, -70, 
+	-134, -182, -213, 172, 70, -85, -127, 87, 
+	-8, 6, -59, 70, 113, 114, 144, -14, 
+	2, 12, 175, 125, 48, 10, -104, 275, 
+	-28, 34, 178, -27, -147, -138, -36, -49, 
+	8, 75, 5, 70, 3, -110, 93, -17, 
+	54, -29, -17, 42, 19, 49, 21, 14, 
+	-9, 109, -53, 1, -31, -113, -5, -26, 
+	-22, -79, 87, 75, -27, -110, 11, 138, 
+	98, 18, -38, -62, 3, -24, -30, 15, 
+	97, -50, -19, 163, 13, 111, -6, 7, 
+	-83, -45, -28, -17, 6, 37, -30, 36, 
+	-7, -24, -25, -141, -137, 55, 182, 43, 
+	-25, -77, -20, 21, 164, 54, 188, 7, 
+	88, 26, -23, 119, 31, -117, -102, -53, 
+	19, 18, 25, -131, -93, -9, 22, -29, 
+	47, 28, -41, 11, 37, -74, -73, 21, 
+	116, 24, 12, 42, -90, -30, -27, 75, 
+	100, -146, -132, -92, 32, -85, -88, 36, 
+	18, 101, -103, 13, 39, -58, 80, -66, 
+	15, -89, -95, 93, -21, 114, -108, 108, 
+	33, 69, -116, -84, 198, 161, 75, 177, 
+	146, -45, 52, -39, -94, -30, -12, 39, 
+	159, -164, 1, 97, -76, -173, -26, 140, 
+	-59, -8, 119, 138, 78, -73, 63, -34, 
+	48, 34, -102, 14, 5, 83, 136, 30, 
+	-137, 13, 95, -44, -56, 9, -24, 163, 
+	-39, -117, -51, 55, -21, 153, -96, 8, 
+	93, 76, 116, -11, 37, -11, -28, 125, 
+	22, -74, 28, -6, -82, 88, -17, -8, 
+	-82, 90, 42, -46, -76, 71, -68, 62, 
+	-16, -95, 21, -62, -82, 22, 0, -85, 
+	127, 76, -98, -189, 63, 155, -94, -58, 
+	64, 185, 77, -205, -227, -20, 82, -57, 
+	44, 126, -16, -84, -66, -145, 48, -200, 
+	21, 33, -70, 54, 66, 105, -38, -67, 
+	46, 96, -16, -93, 162, -33, 78, -24, 
+	30, -82, 122, 19, 42, 134, 99, 119, 
+	3, 41, 79, -66, 47, 58, 41, 33, 
+	42, -15, 32, 79, 73, 114, 151, 37, 
+	-32, -18, -15, -163, 126, 3, -47, -50, 
+	78, -56, 148, -121, -207, -5, -37, -38, 
+	-53, 28, 114, -5, 123, -64, -103, -67, 
+	7, -24, 112, 100, -106, 191, 25, 18, 
+	45, 117, 60, -43, -55, -64, 84, -55, 
+	-63, -153, 111, -83, 9, 53, 56, -112, 
+	41, 77, -175, -65, 53, -86, 63, -8, 
+	-110, 63, 127, 99, 77, 28, 106, 43, 
+	-20, -50, -2, 0, 37, -115, 34, 37, 
+	-96, -4, -121, -8, -75, 7, -37, -73, 
+	-5, -43, 39, -68, -46, 116, -126, -84, 
+	38, 37, 246, -48, 28, 52, -8, -10, 
+	70, 61, -65, 16, -44, -66, 84, 11, 
+	61, 15, 198, 76, 74, 30, 1, 2, 
+	26, -34, -31, -155, -35, 97, -48, -12, 
+	90, 149, -98, 121, -12, 88, 56, -40, 
+	-9, -15, -37, -32, 20, 5, 32, -4, 
+	29, 59, 5, -49, -66, 14, 59, -47, 
+	37, 94, 72, -5, -102, 16, 72, -123, 
+	104, -89, -104, 100, 57, 51, -92, 26, 
+	-88, -35, 86, -38, -17, -32, 38, -19, 
+	92, 88, -160, -125, 49, -100, 61, -75, 
+	-43, 16, -3, -6, -32, 61, 23, 167, 
+	64, -53, -62, -141, -47, -16, -101, -68, 
+	58, -60, 116, -31, -18, 57, -47, 86, 
+	-58, -94, 2, -112, 59, -64, -8, -33, 
+	62, -32, 107, 28, 72, -86, -62, 90, 
+	32, -58, 47, -102, -121, -50, 2, 107, 
+	83, -28, -108, 80, 25, 101, -99, 68, 
+	-104, 18, 38, -50, -90, 136, -73, 48, 
+	69, -24, 10, -65, -101, -17, -179, 16, 
+	-31, 4, -7, -66, 78, -155, -107, -6, 
+	-101, 25, 65, -103, 61, 15, -53, -64, 
+	-53, -162, 86, 148, 138, -182, 80, 21, 
+	56, -159, 22, -67, -91, 0, -114, -36, 
+	-170, 189, 48, 134, -46, 84, -117, 224, 
+	34, -101, 46, -61, 23, -163, 85, 44, 
+	-105, -36, 7, 78, 53, 37, -13, -20, 
+	-34, -88, 42, -3, -36, 32, -61, -42, 
+	-45, -138, -100, 24, 56, -39, 137, 45, 
+	-43, -87, -17, -89, -53, 8, -53, 87, 
+	-7, 17, -43, 68, 83, -51, 26, 12, 
+	18, 24, 41, 108, 17, -44, 24, -21, 
+	130, -51, 12, -57, -27, 33, -1, -76, 
+	-17, 30, -21, -70, -24, 69, 87, 3, 
+	-8, 67, -88, -39, 51, -48, 107, -123, 
+	-6, 15, 30, 137, 32, -40, 39, -76, 
+	131, 34, -13, -83, -24, -58, 18, -34, 
+	132, 23, 13, -41, -40, -70, 113, -59, 
+	36, -21, -11, -80, -86, 67, 77, 59, 
+	41, 63, -137, 16, 125, 102, 17, 64, 
+	63, 0, -5, -44, 29, -57, 27, -58, 
+	20, -65, 23, 73, -124, 26, 77, -73, 
+	-84, 31, 4, -44, 22, 61, 91, 27, 
+	-19, 127, -9, 46, -77, -108, 112, -111, 
+	82, 57, 46, 117, 25, -95, -158, 3, 
+	-67, 52, 118, 49, -120, 3, 136, -109, 
+	-224, 97, -65, -40, -109, -6, 77, -55, 
+	-122, -87, -185, 24, -136, -49, 43, -2, 
+	-154, 5, 46, 32, 73, -55, -121, -29, 
+	-27, 58, 51, -5, -39, 36, 12, 43, 
+	
+};
+
+const static dl_matrix3dq_t dense_kernel_q = {
+	.w = 576,
+	.h = 128,
+	.c = 1,
+	.n = 1,
+	.stride = 576,
+	.exponent = -10,
+	.item = (qtp_t *)(&dense_kernel_q_item_array[0])
+};
+
+const static qtp_t dense_bias_q_item_array[] = {
+	13073, -15677, -12309, 1727, -9593, -2109, 4769, 21994, 
+	-4589, 13956, 21743, 21433, -11096, 9292, -9018, -4344, 
+	-1671, 9421, 19169, 77, -7589, -1832, -2816, -19848, 
+	-6275, -3058, -584, -7251, -17362, -5600, -6093, 14013, 
+	21330, 8452, 17725, -3356, 3916, 24856, 16069, -5548, 
+	19203, 1578, -5759, -17081, 6546, 15474, -5117, 27913, 
+	-25295, -2127, 24038, -3544, 21275, 16448, 4591, -14166, 
+	298, -3102, -503, -2856, -7799, -3390, -4816, 6262, 
+	-3789, 23248, -23455, 24843, 24690, 24818, 11471, 12107, 
+	-2475, 10957, -14289, -20131, -8565, 26736, 2910, -15603, 
+	2645, -11402, -22666, -1888, -11255, 6699, -3596, 5642, 
+	-1087, 12916, 13723, 3351, -12543, -1875, -11263, -2273, 
+	-12127, 18394, -3043, 4322, 10596, -21854, -32450, -1895, 
+	-4705, 22496, -15511, -13309, 11097, -26671, 21171, -5403, 
+	6362, -2666, -11811, -1400, 1754, -21418, -29147, 842, 
+	10694, 12945, -13139, 8294, -16444, 1227, 23677, 5519, 
+	
+};
+
+const static dl_matrix3dq_t dense_bias_q = {
+	.w = 1,
+	.h = 1,
+	.c = 128,
+	.n = 1,
+	.stride = 128,
+	.exponent = -19,
+	.item = (qtp_t *)(&dense_bias_q_item_array[0])
+};
+
+const static qtp_t dense_1_kernel_q_item_array[] = {
+	-1054, 707, -50, -485, 530, -82, -1033, -396, 
+	116, -1161, -355, -166, 688, 783, 262, -585, 
+	20, 15, 270, -605, 689, -804, -478, -665, 
+	-593, 153, -138, -788, 391, -908, -284, -1029, 
+	-669, -454, 340, 162, 751, -1226, -624, 365, 
+	200, 738, -695, 381, 92, 342, -415, -1149, 
+	183, -692, -657, -786, -440, 641, -898, 903, 
+	-377, -177, 834, 403, 443, 286, -116, 255, 
+	618, -556, 125, 360, 161, 59, 640, 556, 
+	115, -601, 180, -13, 990, -488, -828, -741, 
+	-603, 691, 647, -268, -896, -326, 334, -270, 
+	496, -347, 645, -245, 839, 83, -721, 408, 
+	61, -14, 441, 102, 539, -344, -907, -123, 
+	-700, 642, -108, 51, 531, -840, 743, 343, 
+	138, 646, -596, -477, -458, -23, 156, -870, 
+	865, 763, -831, -358, 747, 457, -639, -283, 
+	627, -1204, 203, -346, -522, -695, 134, -845, 
+	320, 631, 483, 295, 406, 540, -284, -582, 
+	359, 528, 567, 645, 37, 64, -1195, 598, 
+	-722, 678, -805, -3, -733, 408, -685, -321, 
+	292, -523, 607, -465, 735, -645, -500, -159, 
+	-1009, -1278, -437, -182, -261, 368, -334, 526, 
+	571, -514, 1189, -662, 101, -292, -1170, -826, 
+	631, 666, -1030, 696, -965, 439, -640, 1182, 
+	745, -196, -430, 587, 786, 901, -121, 936, 
+	-296, 127, -873, 125, 27, -19, 110, -488, 
+	676, 318, 65, 915, -880, -399, -495, -538, 
+	723, -836, 742, 201, -278, -888, -204, 920, 
+	-761, 118, -535, 95, 384, -85, 221, 60, 
+	-473, 579, -475, -1029, 838, -107, 575, 353, 
+	-864, -321, -151, 467, -454, 318, -625, -501, 
+	344, -506, -80, 366, -454, -676, 782, 413, 
+	292, -1327, 538, 188, -494, -210, 266, -1162, 
+	-54, 9, -1130, -393, 469, 583, 755, -198, 
+	566, -929, -473, -99, 17, 370, -307, 784, 
+	-296, -934, 314, -696, 896, -488, 573, -798, 
+	56, 784, -1111, -471, 476, -777, 280, -142, 
+	-486, -899, 163, -212, 171, -164, -173, 109, 
+	416, -495, 156, -417, -663, -95, 673, -472, 
+	-928, -192, -242, -110, 313, 112, 762, -311, 
+	-367, -284, 774, -948, -550, 710, -31, 351, 
+	-878, 342, -705, 97, -586, -933, 479, -680, 
+	572, -1072, 67, 437, 765, 223, 880, 38, 
+	236, -112, 427, -197, -482, -568, 23, 505, 
+	697, 470, 678, 592, -27, 968, 425, -211, 
+	-1111, 62, -89, 90, -845, 329, -546, 3, 
+	-569, 306, -781, 468, 572, -507, 612, -72, 
+	-650, 596, -829, 668, -215, 1097, -518, -21, 
+	-539, -177, -530, -490, 528, 260, 81, 44, 
+	50, 978, 785, 405, -553, 618, 544, 100, 
+	249, -258, 620, -454, -787, 164, -254, -712, 
+	592, -391, -996, 619, -260, -1218, 454, 218, 
+	117, 756, 270, 163, -428, 492, 581, 0, 
+	-141, 429, 590, -626, -1210, 421, -244, 806, 
+	112, -589, -1127, 415, 114, 341, 450, -102, 
+	239, -633, -910, 361, 849, 688, -791, 145, 
+	-323, 166, -380, -63, -77, 332, 26, 568, 
+	-430, -914, -436, 269, -215, 587, 70, 446, 
+	286, -451, 473, 223, 208, -238, 771, 637, 
+	869, 489, -576, -126, -606, -86, 233, 17, 
+	-672, 495, 420, -961, -1044, 153, 338, -777, 
+	-875, -129, 119, -259, -920, 342, 817, 601, 
+	-308, -143, -402, -1032, 836, 484, -23, -1165, 
+	1, -740, 375, -728, -291, -957, 901, -140, 
+	90, 251, 228, -392, 141, -164, 869, 924, 
+	-171, -413, -343, 652, -737, -523, 177, 449, 
+	-810, -630, -1203, -1087, -261, -134, 360, 557, 
+	-857, -868, -646, 33, 684, 806, 263, -394, 
+	364, -1275, 529, 152, 481, 372, -372, 480, 
+	-1117, -200, -377, 861, 7, 708, 209, -563, 
+	217, 17, -678, 240, -1055, 34, 722, -97, 
+	574, 747, 409, -739, -898, -967, 285, -834, 
+	216, 254, -943, -756, -456, -1, -189, -320, 
+	-579, 632, 803, 95, -935, 522, 176, -549, 
+	166, -518, 224, -397, -475, -375, 266, -354, 
+	628, 675, 290, 396, -691, 837, -273, 66, 
+	-682, -318, 93, -162, 710, -105, 686, -38, 
+	650, 168, 62, -991, 759, 727, 187, -202, 
+	615, -239, -116, 473, 396, 223, -771, -163, 
+	-348, 603, 8, 426, -269, -31, -924, -508, 
+	-1048, 131, 554, -534, 847, -182, -3, -678, 
+	-51, -337, 482, -34, -259, -526, 260, 335, 
+	523, 322, 597, -120, -606, 614, 929, 188, 
+	20, 258, -616, 113, -897, 480, 283, 703, 
+	423, -711, 624, -86, 551, 683, 813, 715, 
+	-770, 669, 239, -1242, 258, -632, 584, 513, 
+	-663, 254, -103, 321, 580, -609, -139, 901, 
+	-508, 417, 31, 207, -76, -314, 516, -527, 
+	-426, -229, -181, -471, -499, 694, 221, 851, 
+	-252, -633, 421, 723, 749, 143, 292, -452, 
+	-895, 95, 158, -747, 485, -1110, 356, -182, 
+	649, 806, -398, 222, 427, -211, 198, -235, 
+	-666, 322, -376, -1092, -659, -775, -124, -200, 
+	-348, -62, 28, -495, -888, -470, 740, 391, 
+	588, 996, 479, -27, 447, -630, -506, 25, 
+	304, -787, -551, -983, 163, -617, 348, 70, 
+	-44, 391, 524, -1589, 618, 422, -1094, -479, 
+	-333, 495, 204, -686, -514, -1255, -847, 335, 
+	-602, 745, 629, -763, 736, -565, -1282, -571, 
+	21, -120, 359, -828, 801, 711, 6, 552, 
+	-231, -746, 555, -419, 463, -375, 75, -460, 
+	-678, 652, -66, -329, 43, 538, -358, 321, 
+	683, 810, -210, 236, -355, -237, 766, 710, 
+	-19, 384, 508, -233, 923, -225, 65, -517, 
+	97, -1005, -26, -201, -78, -820, 755, -636, 
+	-1077, 183, -710, -271, 870, -1, 980, -141, 
+	-966, 484, -449, -100, -268, -552, -514, 208, 
+	-555, -671, 164, -678, 568, 322, 262, 664, 
+	485, -780, 659, -973, -525, -16, 410, -1024, 
+	-277, 87, 502, 159, -350, -607, 704, -301, 
+	132, 12, -69, 98, -993, 608, 605, 478, 
+	769, -839, 88, 439, 410, 663, 673, 420, 
+	200, -56, 245, 884, -758, 167, 279, 855, 
+	721, 211, -186, 669, 768, 560, -699, 209, 
+	-436, -1014, 538, -751, -21, 426, 100, -186, 
+	-71, 754, -609, -378, -1038, -809, 502, 601, 
+	-987, 729, 65, 506, 810, 782, 706, -11, 
+	60, -469, -466, -609, 126, 322, 829, 150, 
+	-148, 189, 776, -501, 285, -886, -348, -896, 
+	-722, 581, 612, -546, -1125, 464, -563, -976, 
+	474, 403, -530, -793, -953, -838, -439, 479, 
+	613, -347, -347, -392, 180, 114, 666, 605, 
+	-127, 439, 195, 174, 603, 620, 529, 491, 
+	104, -699, -709, 443, -313, 655, 491, -285, 
+	-47, -557, 637, 182, -312, -366, 137, -36, 
+	237, -834, 364, -400, 740, -190, 594, 24, 
+	145, 157, 430, 516, 663, 483, -351, -581, 
+	210, 484, -456, 698, -379, -733, -288, -551, 
+	-841, -1048, -628, 156, 37, 477, -729, -83, 
+	317, -1119, 526, 395, 730, 103, -348, -368, 
+	-77, 557, 433, -325, 282, 168, -276, 272, 
+	-194, -826, 996, -571, -363, -287, -91, 244, 
+	425, -239, 737, 858, -817, -60, -152, 363, 
+	244, 634, -186, -1296, 113, -52, -373, 388, 
+	-694, 578, -85, -645, 845, 792, 394, -450, 
+	-442, -467, 22, -529, -382, -816, -438, 174, 
+	-611, 560, -487, 901, -1060, 492, 559, -154, 
+	-900, 336, 468, -98, -85, 512, -654, 286, 
+	-452, -282, 33, -549, 497, 240, 681, -195, 
+	414, 570, -65, -952, -213, -264, 196, -700, 
+	256, 842, 39, 193, -710, -421, -221, -375, 
+	-894, 394, -90, -96, -465, -95, 667, 101, 
+	802, -128, -282, 51, -774, 613, -414, 640, 
+	225, 926, 280, 432, -354, -195, 492, 365, 
+	343, 361, -358, 132, 158, -517, 455, -261, 
+	146, -989, 559, -259, -149, 768, -696, 827, 
+	434, -874, -174, -421, -147, -1143, 559, 336, 
+	-385, -303, 406, 157, 488, 312, -209, -49, 
+	-167, -482, 638, 390, -272, -881, -324, -425, 
+	-830, 411, -699, 204, -618, -823, 695, -87, 
+	291, -484, -876, -654, -262, 664, -813, 600, 
+	-413, -752, 265, 73, -307, 100, 633, 497, 
+	673, -622, 173, 75, -283, -915, -1090, -406, 
+	421, 38, -730, 627, 233, 311, -764, -589, 
+	592, 718, 505, 484, 474, -573, 565, 18, 
+	535, 720, -517, 836, 304, 351, 807, -728, 
+	-58, -777, -679, 298, -186, -282, -384, 401, 
+	871, -466, 783, -549, 905, 36, 426, 777, 
+	50, 167, -197, 432, 532, 445, -279, 312, 
+	-244, 109, 374, -191, -130, 663, -734, 135, 
+	
+};
+
+const static dl_matrix3dq_t dense_1_kernel_q = {
+	.w = 128,
+	.h = 10,
+	.c = 1,
+	.n = 1,
+	.stride = 128,
+	.exponent = -12,
+	.item = (qtp_t *)(&dense_1_kernel_q_item_array[0])
+};
+
+const static qtp_t dense_1_bias_q_item_array[] = {
+	-6960, 28306, -21842, 2863, 2761, -763, -27204, -4128, 
+	27340, -5702, 
+};
+
+const static dl_matrix3dq_t dense_1_bias_q = {
+	.w = 1,
+	.h = 1,
+	.c = 10,
+	.n = 1,
+	.stride = 10,
+	.exponent = -19,
+	.item = (qtp_t *)(&dense_1_bias_q_item_array[0])
+};
+
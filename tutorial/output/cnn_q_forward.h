@@ -0,0 +1,167 @@
+#pragma once
+#include <stdint.h>
+#include "cnn_q.h"
+
+// generated by model_codegen.py, exponents calibrated on 17 sample inputs
+#define CNN_Q_INPUT_H 28
+#define CNN_Q_INPUT_W 28
+#define CNN_Q_INPUT_C 1
+#define CNN_Q_INPUT_EXPONENT -14
+#define CNN_Q_OUTPUT_SIZE 10
+#define CNN_Q_OUTPUT_EXPONENT -9
+#define CNN_Q_BUFFER_SIZE 6272 /* largest activation between two layers */
+
+static qtp_t cnn_q_buffer[2][CNN_Q_BUFFER_SIZE];
+
+static inline qtp_t cnn_q_saturate(int32_t v)
+{
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+}
+
+/**
+ * @brief Forward the model in 16-bit fixed point, see cnn_forward. A value q stands
+ *        for q * 2^exponent, the exponents of the activations are constants.
+ *
+ * @param input     CNN_Q_INPUT_H x CNN_Q_INPUT_W x CNN_Q_INPUT_C, in hwc order, at CNN_Q_INPUT_EXPONENT
+ * @param output    CNN_Q_OUTPUT_SIZE, at CNN_Q_OUTPUT_EXPONENT
+ */
+static void cnn_q_forward(const qtp_t *input, qtp_t *output)
+{
+    // conv2d: 28x28x1, 5x5 same conv, bias, relu, 2x2 max pool -> 14x14x32
+    // 14-bit kernel, |sum| <= 1751324672
+    for (int y = 0; y < 14; y++)
+    {
+        for (int x = 0; x < 14; x++)
+        {
+            for (int n = 0; n < 32; n++)
+            {
+                int32_t best = 0;
+                for (int p = 0; p < 4; p++)
+                {
+                    int oy = y * 2 + p / 2;
+                    int ox = x * 2 + p % 2;
+                    int32_t sum = (int32_t)(conv2d_bias_q_item_array[n]) * 2048;
+                    for (int ky = 0; ky < 5; ky++)
+                    {
+                        int iy = oy * 1 + ky - 2;
+                        if (iy < 0 || iy >= 28)
+                            continue;
+                        for (int kx = 0; kx < 5; kx++)
+                        {
+                            int ix = ox * 1 + kx - 2;
+                            if (ix < 0 || ix >= 28)
+                                continue;
+                            const qtp_t *in = input + (iy * 28 + ix) * 1;
+                            const qtp_t *k = conv2d_kernel_q_item_array + ((n * 5 + ky) * 5 + kx) * 1;
+                            for (int i = 0; i < 1; i++)
+                                sum += in[i] * k[i];
+                        }
+                    }
+                    if (sum > best)
+                        best = sum;
+                }
+                cnn_q_buffer[0][(y * 14 + x) * 32 + n] = cnn_q_saturate(((best) + (1 << 13)) >> 14);
+            }
+        }
+    }
+
+    // conv2d_1: 14x14x32, 5x5 same conv, bias, relu, 2x2 max pool -> 7x7x64
+    // 10-bit kernel, |sum| <= 2028128044
+    for (int y = 0; y < 7; y++)
+    {
+        for (int x = 0; x < 7; x++)
+        {
+            for (int n = 0; n < 64; n++)
+            {
+                int32_t best = 0;
+                for (int p = 0; p < 4; p++)
+                {
+                    int oy = y * 2 + p / 2;
+                    int ox = x * 2 + p % 2;
+                    int32_t sum = (int32_t)(conv2d_1_bias_q_item_array[n]) * 64;
+                    for (int ky = 0; ky < 5; ky++)
+                    {
+                        int iy = oy * 1 + ky - 2;
+                        if (iy < 0 || iy >= 14)
+                            continue;
+                        for (int kx = 0; kx < 5; kx++)
+                        {
+                            int ix = ox * 1 + kx - 2;
+                            if (ix < 0 || ix >= 14)
+                                continue;
+                            const qtp_t *in = cnn_q_buffer[0] + (iy * 14 + ix) * 32;
+                            const qtp_t *k = conv2d_1_kernel_q_item_array + ((n * 5 + ky) * 5 + kx) * 32;
+                            for (int i = 0; i < 32; i++)
+                                sum += in[i] * k[i];
+                        }
+                    }
+                    if (sum > best)
+                        best = sum;
+                }
+                cnn_q_buffer[1][(y * 7 + x) * 64 + n] = cnn_q_saturate(((best) + (1 << 12)) >> 13);
+            }
+        }
+    }
+
+    // conv2d_2: 7x7x64, 3x3 same conv, bias, relu, 2x2 max pool -> 3x3x64
+    // 10-bit kernel, |sum| <= 1111414835
+    for (int y = 0; y < 3; y++)
+    {
+        for (int x = 0; x < 3; x++)
+        {
+            for (int n = 0; n < 64; n++)
+            {
+                int32_t best = 0;
+                for (int p = 0; p < 4; p++)
+                {
+                    int oy = y * 2 + p / 2;
+                    int ox = x * 2 + p % 2;
+                    int32_t sum = (int32_t)(conv2d_2_bias_q_item_array[n]) * 8;
+                    for (int ky = 0; ky < 3; ky++)
+                    {
+                        int iy = oy * 1 + ky - 1;
+                        if (iy < 0 || iy >= 7)
+                            continue;
+                        for (int kx = 0; kx < 3; kx++)
+                        {
+                            int ix = ox * 1 + kx - 1;
+                            if (ix < 0 || ix >= 7)
+                                continue;
+                            const qtp_t *in = cnn_q_buffer[1] + (iy * 7 + ix) * 64;
+                            const qtp_t *k = conv2d_2_kernel_q_item_array + ((n * 3 + ky) * 3 + kx) * 64;
+                            for (int i = 0; i < 64; i++)
+                                sum += in[i] * k[i];
+                        }
+                    }
+                    if (sum > best)
+                        best = sum;
+                }
+                cnn_q_buffer[0][(y * 3 + x) * 64 + n] = cnn_q_saturate(((best) + (1 << 9)) >> 10);
+            }
+        }
+    }
+
+    // dense: 576 -> 128, relu
+    // 10-bit kernel, |sum| <= 1133813501
+    for (int n = 0; n < 128; n++)
+    {
+        const qtp_t *k = dense_kernel_q_item_array + n * 576;
+        int32_t best = (int32_t)(dense_bias_q_item_array[n]) * 4;
+        for (int i = 0; i < 576; i++)
+            best += cnn_q_buffer[0][i] * k[i];
+        if (best < 0)
+            best = 0;
+        cnn_q_buffer[1][n] = cnn_q_saturate(((best) + (1 << 11)) >> 12);
+    }
+
+    // dense_1: 128 -> 10
+    // 12-bit kernel, |sum| <= 1175306648
+    for (int n = 0; n < 10; n++)
+    {
+        const qtp_t *k = dense_1_kernel_q_item_array + n * 128;
+        int32_t best = (int32_t)(dense_1_bias_q_item_array[n]) * 4;
+        for (int i = 0; i < 128; i++)
+            best += cnn_q_buffer[1][i] * k[i];
+        output[n] = cnn_q_saturate(((best) + (1 << 11)) >> 12);
+    }
+}
@@ -1,50 +1,59 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "cnn.h"
+#include "esp_timer.h"
+#include "cnn_forward.h"
+#include "cnn_q_forward.h"
 #include "input.h"
 
+static int print_result(const char *title, const fptp_t *result, int64_t us)
+{
+    int idx = 0;
+    fptp_t max = result[0];
+    printf("%s, %d us:\n", title, (int)us);
+    for (int i = 0; i < CNN_OUTPUT_SIZE; i++)
+    {
+        printf("%f\t", result[i]);
+        if (max < result[i])
+        {
+            max = result[i];
+            idx = i;
+        }
+    }
+    printf("\n");
+    return idx;
+}
+
 void test(void *arg)
 {
-    dl_matrix3d_t *image = dl_matrix3d_alloc(1, 28, 28, 1);
-    for (int i = 0; i < image->h * image->w; i++)
+    static fptp_t image[CNN_INPUT_H * CNN_INPUT_W * CNN_INPUT_C];
+    static qtp_t image_q[CNN_Q_INPUT_H * CNN_Q_INPUT_W * CNN_Q_INPUT_C];
+    for (int i = 0; i < CNN_INPUT_H * CNN_INPUT_W * CNN_INPUT_C; i++)
     {
-        image->item[i] = input_item_array[i] / 255.0f;
+        image[i] = input_item_array[i] / 255.0f;
+        image_q[i] = (qtp_t)roundf(ldexpf(image[i], -(CNN_Q_INPUT_EXPONENT)));
     }
 
+    fptp_t result[CNN_OUTPUT_SIZE];
+    qtp_t result_q[CNN_Q_OUTPUT_SIZE];
+    fptp_t result_dq[CNN_Q_OUTPUT_SIZE];
     while(1)
     {
-        dl_matrix3d_t *o1_1 = dl_matrix3dff_conv_common(image, &conv2d_kernel, &conv2d_bias, 1, 1, PADDING_SAME);
-        dl_matrix3d_t *o1_2 = dl_matrix3d_pooling(o1_1, 2, 2, 2, 2, PADDING_VALID, DL_POOLING_MAX);
-        dl_matrix3d_relu(o1_2);
-        dl_matrix3d_t *o2_1 = dl_matrix3dff_conv_common(o1_2, &conv2d_1_kernel, &conv2d_1_bias, 1, 1, PADDING_SAME);
-        dl_matrix3d_t *o2_2 = dl_matrix3d_pooling(o2_1, 2, 2, 2, 2, PADDING_VALID, DL_POOLING_MAX);
-        dl_matrix3d_relu(o2_2);
-        dl_matrix3d_t *o3_1 = dl_matrix3dff_conv_common(o2_2, &conv2d_2_kernel, &conv2d_2_bias, 1, 1, PADDING_SAME);
-        dl_matrix3d_t *o3_2 = dl_matrix3d_pooling(o3_1, 2, 2, 2, 2, PADDING_VALID, DL_POOLING_MAX);
-        dl_matrix3d_relu(o3_2);
-        dl_matrix3d_t *o4_1 = dl_matrix3d_alloc(1, 1, 1, dense_kernel.h);
-        dl_matrix3dff_fc_with_bias(o4_1, o3_2, &dense_kernel, &dense_bias);
-        dl_matrix3d_relu(o4_1);
-        dl_matrix3d_t *o4_2 = dl_matrix3d_alloc(1, 1, 1, dense_1_kernel.h);
-        dl_matrix3dff_fc_with_bias(o4_2, o4_1, &dense_1_kernel, &dense_1_bias);
+        int64_t t0 = esp_timer_get_time();
+        cnn_forward(image, result);
+        int64_t t1 = esp_timer_get_time();
+        cnn_q_forward(image_q, result_q);
+        int64_t t2 = esp_timer_get_time();
 
-        int idx = 0;
-        fptp_t max = o4_2->item[0];
-        printf("Result:\n");
-        for (int i = 0; i < o4_2->c; i++)
-        {
-            printf("%f\t", o4_2->item[i]);
-            if (max < o4_2->item[i])
-            {
-                max = o4_2->item[i];
-                idx = i;
-            }
-        }
-        printf("\nThe number is: %d.\n", idx);
+        for (int i = 0; i < CNN_Q_OUTPUT_SIZE; i++)
+            result_dq[i] = ldexpf(result_q[i], CNN_Q_OUTPUT_EXPONENT);
 
+        int idx = print_result("Result", result, t1 - t0);
+        int idx_q = print_result("Quantized result", result_dq, t2 - t1);
+        printf("The number is: %d, quantized: %d.\n", idx, idx_q);
 
         vTaskDelay(100);
     }